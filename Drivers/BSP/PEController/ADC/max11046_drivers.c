@@ -31,6 +31,9 @@
 #include "shared_memory.h"
 #include "monitoring_library.h"
 #include "pecontroller_timers.h"
+#if EN_ADC_PROTECTION
+#include "pecontroller_pwm.h"
+#endif
 /********************************************************************************
  * Defines
  *******************************************************************************/
@@ -65,6 +68,18 @@ typedef struct
 	uint16_t data[32];
 } adc_dma_data_t;
 #endif
+/**
+ * @brief Trigger configuration waiting to be applied by the conversion interrupt
+ */
+typedef struct
+{
+	tim_in_trigger_config_t slaveConfig;		/**< @brief Configuration for the slave */
+	tim_out_trigger_config_t masterConfig;		/**< @brief Configuration for the master */
+	bool isSlave;								/**< @brief <c>true</c> if slave configuration is valid */
+	bool isMaster;								/**< @brief <c>true</c> if master configuration is valid */
+	float fs;									/**< @brief Required sampling frequency */
+	volatile bool isPending;					/**< @brief Set when the request needs to be applied */
+} trigger_request_t;
 /********************************************************************************
  * Static Variables
  *******************************************************************************/
@@ -73,7 +88,7 @@ typedef struct
 static volatile bool moduleActive = false;
 /** Current applied ADC configurations
  */
-static adc_cont_config_t adcContConfig = { .fs = 25000, .callback = NULL };
+static adc_cont_config_t adcContConfig = { .fs = 25000, .callback = NULL, .monitoringFs = 0 };
 /** Current ADC acquisition mode
  */
 static adc_acq_mode_t acqType = ADC_MODE_CONT;
@@ -90,6 +105,22 @@ static TIM_HandleTypeDef htim4;
  * @brief Handle for the ADC conversion timer
  */
 static TIM_HandleTypeDef htimCnv;
+/**
+ * @brief Trigger configuration requested by @ref BSP_MAX11046_UpdateInputOutputTrigger()
+ */
+static trigger_request_t triggerRequest = { .isPending = false };
+/**
+ * @brief Delay between the input trigger event and the start of conversion in micro-seconds
+ */
+static float triggerDelayInUsec = 0;
+/**
+ * @brief Number of conversions for each record stored for the monitoring consumers
+ */
+static uint32_t monitoringDecimation = 1;
+/**
+ * @brief Conversions since the last stored record
+ */
+static uint32_t decimationCount = 0;
 
 #if EN_DMA_ADC_DATA_COLLECTION
 static TIM_HandleTypeDef htimRead;			// TIM8
@@ -99,6 +130,28 @@ static DMA_HandleTypeDef hdma_rd_high;
 static adc_dma_data_t* dmaData = (adc_dma_data_t*)0x3800F000;
 static volatile bool isLastTimerCollect = false;
 #endif
+#if EN_ADC_PROTECTION
+/**
+ * @brief Trip limits of the channels compared after each conversion
+ */
+static adc_protection_limits_t protectionLimits;
+/**
+ * @brief <c>true</c> if the channels are compared against their limits
+ */
+static volatile bool isProtectionEnabled = false;
+/**
+ * @brief PWM channels disabled on a trip
+ */
+static uint32_t protectionPwmMask = 0;
+/**
+ * @brief Trip information reported by @ref BSP_MAX11046_GetProtectionStats()
+ */
+static adc_protection_stats_t protectionStats;
+/**
+ * @brief Value of the cycle counter at the entry of the conversion interrupt
+ */
+static uint32_t isrEntryCycles = 0;
+#endif
 /********************************************************************************
  * Global Variables
  *******************************************************************************/
@@ -433,6 +486,26 @@ static void Tim5_Init(void)
 		Error_Handler();
 }
 
+/**
+ * @brief Computes the decimation of the stored records for the selected sampling frequency
+ * @details The stored records are picked from the conversions so that the monitoring rate is as close as possible
+ * to adc_cont_config_t.monitoringFs without exceeding the sampling frequency.
+ * @param _fs Sampling frequency of the ADC converter
+ */
+static void UpdateMonitoringRate(float _fs)
+{
+	uint32_t decimation = 1;
+	if (adcContConfig.monitoringFs > 0 && adcContConfig.monitoringFs < _fs)
+		decimation = (uint32_t)((_fs / adcContConfig.monitoringFs) + 0.5f);
+	// keep the phase of the stored records if the rate doesn't change
+	if (decimation != monitoringDecimation)
+	{
+		monitoringDecimation = decimation;
+		decimationCount = 0;
+	}
+	processedData->info.fs = _fs / decimation;
+}
+
 // --FIXME-- Period, Pulse period etc.
 // --FIXME-- Start Stop
 /**
@@ -448,7 +521,7 @@ static void Tim5_Init(void)
 timer_trigger_src_t BSP_MAX11046_SetInputOutputTrigger(tim_in_trigger_config_t* _slaveConfig, tim_out_trigger_config_t* _masterConfig, float _fs)
 {
 	timer_trigger_src_t  result = TIM_TRG_SRC_NONE;
-	float inTriggerDelay = 0;
+	float inTriggerDelay = triggerDelayInUsec;
 	tim_in_trigger_config_t _slave;
 	tim_out_trigger_config_t _master;
 	isTim4OnePulse = false;
@@ -566,11 +639,57 @@ timer_trigger_src_t BSP_MAX11046_SetInputOutputTrigger(tim_in_trigger_config_t*
 	BSP_Timer_SetOutputTrigger(&htimCnv, NULL);
 	TIM4->ARR = TIM5->ARR = TIM12->ARR = (uint32_t)((240 * 1000000) / _fs) - 1;			// Dynamic Frequency Computation
 
-	// update the sampling frequency
-	processedData->info.fs = _fs;
+	// update the sampling frequency of the stored records
+	UpdateMonitoringRate(_fs);
 
 	return result;
 }
+
+/**
+ * @brief Sets the delay between the input trigger event and the start of conversion.
+ * @details The delay is generated by the compare unit of the first synchronization timer and is applied by the next
+ * call to @ref BSP_MAX11046_SetInputOutputTrigger() or @ref BSP_MAX11046_UpdateInputOutputTrigger().
+ * It is only effective if an input trigger is configured.
+ * @param delayInUsec Delay in micro-seconds. Should be less than the sampling period.
+ */
+void BSP_MAX11046_SetTriggerDelay(float delayInUsec)
+{
+	// delays shorter than a timer tick are generated directly by the reset event
+	triggerDelayInUsec = delayInUsec * MAX11046_CLK_Us < 1 ? 0 : delayInUsec;
+}
+
+/**
+ * @brief Sets the input and output trigger functions for the ADC without stopping the conversions.
+ * @details In continuous mode the configuration is copied and applied by the conversion interrupt just after
+ * the current conversion completes. The new period is loaded from the auto-reload preload registers on the
+ * next timer update event, so no conversion is lost. Only the first period after enabling a reset trigger
+ * can be shorter as the conversion timer gets aligned to the trigger source.
+ * If the drivers are not running in continuous mode the configuration is applied immediately.
+ * @note Can be called from the ADC callback. A request not yet applied is replaced by the new one.
+ * @param _slaveConfig Configuration for the slave. Send NULL if no slave functionality needed.
+ * @param _masterConfig Configuration for the master. Send NULL if no master functionality needed.
+ * @param _fs Required sampling frequency of the ADC converter
+ * @return timer_trigger_src_t Trigger source if configuration required as master else returns NULL.
+ */
+timer_trigger_src_t BSP_MAX11046_UpdateInputOutputTrigger(tim_in_trigger_config_t* _slaveConfig, tim_out_trigger_config_t* _masterConfig, float _fs)
+{
+	if (!moduleActive || acqType == ADC_MODE_SINGLE)
+		return BSP_MAX11046_SetInputOutputTrigger(_slaveConfig, _masterConfig, _fs);
+
+	// hide the request from the interrupt while it is being modified
+	triggerRequest.isPending = false;
+	triggerRequest.isSlave = _slaveConfig != NULL;
+	if (_slaveConfig)
+		triggerRequest.slaveConfig = *_slaveConfig;
+	triggerRequest.isMaster = _masterConfig != NULL;
+	if (_masterConfig)
+		triggerRequest.masterConfig = *_masterConfig;
+	triggerRequest.fs = _fs;
+	__DMB();
+	triggerRequest.isPending = true;
+
+	return _masterConfig ? TIM_TRG_SRC_TIM4 : TIM_TRG_SRC_NONE;
+}
 /**
  * @brief Initializes the MAX11046 drivers
  * @param type ADC_MODE_SINGLE or ADC_MODE_CONT for single or continuous conversions respectively
@@ -592,6 +711,13 @@ void BSP_MAX11046_Init(adc_acq_mode_t type, adc_cont_config_t* contConfig, volat
 	acqType = type;
 	adcContConfig.fs = contConfig->fs;
 	adcContConfig.callback = contConfig->callback;
+	adcContConfig.monitoringFs = contConfig->monitoringFs;
+	triggerRequest.isPending = false;
+#if EN_ADC_PROTECTION
+	isProtectionEnabled = false;
+	ADCProtection_ResetLimits(&protectionLimits);
+	memset(&protectionStats, 0, sizeof(protectionStats));
+#endif
 
 	GPIOs_Init();
 #if EN_DMA_ADC_DATA_COLLECTION
@@ -679,9 +805,98 @@ void BSP_MAX11046_DeInit(void)
 	moduleActive = false;
 }
 
+#if EN_ADC_PROTECTION
+/**
+ * @brief Sets the trip limits of a channel for the protection.
+ * @note Can be called from the ADC callback. The limits are disabled by @ref BSP_MAX11046_Init().
+ * @param channelIndex ADC channel index. Should be valid.
+ * @param lower The channel trips if its value is below this limit
+ * @param upper The channel trips if its value is above this limit
+ */
+void BSP_MAX11046_SetProtectionLimits(int channelIndex, float lower, float upper)
+{
+	protectionLimits.lower[channelIndex] = lower;
+	protectionLimits.upper[channelIndex] = upper;
+}
+
+/**
+ * @brief Enables or disables the comparison of the channels against their limits after each conversion.
+ * @details The cycle counter is enabled to measure the trip latency.
+ * @param pwmMask PWM channels to be disabled on a trip, as for @ref BSP_PWMOut_Enable()
+ * @param en <c>true</c> if needs to be enabled else <c>false</c>
+ */
+void BSP_MAX11046_EnableProtection(uint32_t pwmMask, bool en)
+{
+	isProtectionEnabled = false;
+	protectionPwmMask = pwmMask;
+	if (en)
+	{
+		CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+		DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+		__DMB();
+		isProtectionEnabled = true;
+	}
+}
+
+/**
+ * @brief Re-arms the protection by clearing the tripped channels.
+ */
+void BSP_MAX11046_ResetProtection(void)
+{
+	protectionStats.tripMask = 0;
+}
+
+/**
+ * @brief Gets the trip information of the protection.
+ * @param stats Structure to be filled.
+ */
+void BSP_MAX11046_GetProtectionStats(adc_protection_stats_t* stats)
+{
+	*stats = protectionStats;
+}
+#endif
+
+/**
+ * @brief Applies the trigger configuration requested by @ref BSP_MAX11046_UpdateInputOutputTrigger()
+ * @note Called by the conversion interrupt so the timers keep running.
+ */
+static void ApplyTriggerRequest(void)
+{
+	triggerRequest.isPending = false;
+	(void)BSP_MAX11046_SetInputOutputTrigger(triggerRequest.isSlave ? &triggerRequest.slaveConfig : NULL,
+			triggerRequest.isMaster ? &triggerRequest.masterConfig : NULL, triggerRequest.fs);
+}
+
 #pragma GCC push_options
 #pragma GCC optimize ("-Ofast")
 
+#if EN_ADC_PROTECTION
+/**
+ * @brief Compares the converted channels against their limits and disables the PWM outputs on a trip.
+ * @details The comparison has no branches, so it takes the same time for all samples.
+ * @param fData Converted data of the channels.
+ */
+TCritical static inline void CheckProtection(const float* fData)
+{
+	uint32_t trips = ADCProtection_GetTrips(fData, &protectionLimits);
+	if (trips == 0)
+		return;
+	// disable the outputs at every tripped sample, in case they were enabled without resetting the protection
+	if (protectionPwmMask)
+		BSP_PWMOut_DisableFromISR(protectionPwmMask);
+	protectionStats.tripCount++;
+	uint32_t newTrips = trips & ~protectionStats.tripMask;
+	if (newTrips == 0)
+		return;
+	uint32_t latency = DWT->CYCCNT - isrEntryCycles;
+	protectionStats.latencyCycles = latency;
+	if (latency > protectionStats.maxLatencyCycles)
+		protectionStats.maxLatencyCycles = latency;
+	protectionStats.tripMask |= newTrips;
+	BSP_ADC_ProtectionTrippedCallback(newTrips);
+}
+#endif
+
 TCritical static inline void ManipulateData(void)
 {
 #if USE_LOCAL_ADC_STORAGE
@@ -695,8 +910,19 @@ TCritical static inline void ManipulateData(void)
 	uint16_t* uData = (uint16_t*)&rawData->dataRecord[rawData->recordIndex << 4];
 #endif
 	CollectConvertData_BothADCs(fData, uData, adcSensitivity, adcOffsets);
+#if EN_ADC_PROTECTION
+	if (isProtectionEnabled)
+		CheckProtection(fData);
+#endif
 	if(adcContConfig.callback)
 		adcContConfig.callback((adc_measures_t*)fData);
+	// apply the trigger changes before the next conversion starts
+	if (triggerRequest.isPending)
+		ApplyTriggerRequest();
+	// only keep the decimated records, the others are overwritten by the next conversion
+	if (++decimationCount < monitoringDecimation)
+		return;
+	decimationCount = 0;
 #if USE_LOCAL_ADC_STORAGE
 	RingBuffer_Write(&adcLocalIndexRingBuff);
 #else
@@ -729,6 +955,9 @@ TCritical static inline void AcquistionComplete(void)
  */
 TCritical void EXTI15_10_IRQHandler(void)
 {
+#if EN_ADC_PROTECTION && !EN_DMA_ADC_DATA_COLLECTION
+	isrEntryCycles = DWT->CYCCNT;
+#endif
 #if PROFILE_CONVERSION
 	SET_Pin(PROFILE_GPIO_PORT, PROFILE_GPIO_Pin);
 #endif
@@ -757,6 +986,9 @@ TCritical void EXTI15_10_IRQHandler(void)
 #if EN_DMA_ADC_DATA_COLLECTION
 TCritical void TIM8_UP_TIM13_IRQHandler(void)
 {
+#if EN_ADC_PROTECTION
+	isrEntryCycles = DWT->CYCCNT;
+#endif
 #if PROFILE_CONVERSION
 	SET_Pin(PROFILE_GPIO_PORT, PROFILE_GPIO_Pin);
 #endif
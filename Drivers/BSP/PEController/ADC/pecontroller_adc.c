@@ -36,6 +36,8 @@
 #include "max11046_drivers.h"
 #endif
 #include "monitoring_library.h"
+#include "capture_format.h"
+#include <math.h>
 /********************************************************************************
  * Defines
  *******************************************************************************/
@@ -69,6 +71,10 @@ temp_stats_data_t tempStats[TOTAL_MEASUREMENT_COUNT] = {0};
 #if (IS_ADC_STATS_CORE && ADC_BULK_STATS) || IS_STORAGE_CORE || IS_ADC_CORE
 static adc_processed_data_t* processedAdcData = NULL;
 #endif
+/**
+ * @brief Unit texts placed in the capture file headers
+ */
+static const char* captureUnitTxts[UNIT_COUNT] = {"V", "A", "W", "Hz"};
 #if IS_ADC_CORE
 static adc_raw_data_t* rawAdcData = NULL;
 #if USE_LOCAL_ADC_STORAGE
@@ -246,6 +252,124 @@ timer_trigger_src_t BSP_ADC_SetInputOutputTrigger(tim_in_trigger_config_t* _slav
 #endif
 }
 
+/**
+ * @brief Sets the delay between the input trigger event and the start of conversion.
+ * @details The delay is applied by the next call to @ref BSP_ADC_SetInputOutputTrigger() or
+ * @ref BSP_ADC_UpdateInputOutputTrigger(). It is only effective if an input trigger is configured.
+ * Use @ref BSP_TimerSync_Apply() to compute the delay from the required sampling instant.
+ * @param delayInUsec Delay in micro-seconds. Should be less than the sampling period.
+ */
+void BSP_ADC_SetTriggerDelay(float delayInUsec)
+{
+#if MAX11046_ENABLE
+	BSP_MAX11046_SetTriggerDelay(delayInUsec);
+#else
+#error "Invalid ADC.";
+#endif
+}
+
+/**
+ * @brief Sets the input and output trigger functions for the ADC without stopping the conversions.
+ * @details In continuous mode the configuration is applied by the conversion interrupt just after the current
+ * conversion completes and the new period is loaded on the next timer update event. Use this instead of
+ * stopping and restarting the ADC when switching between the monitoring and control modes.
+ * @note Can be called from the ADC callback. A request not yet applied is replaced by the new one.
+ * @param _slaveConfig Configuration for the slave. Send NULL if no slave functionality needed.
+ * @param _masterConfig Configuration for the master. Send NULL if no master functionality needed.
+ * @param _fs Required sampling frequency of the ADC converter
+ * @return timer_trigger_src_t Trigger source if configuration required as master else returns NULL.
+ */
+timer_trigger_src_t BSP_ADC_UpdateInputOutputTrigger(tim_in_trigger_config_t* _slaveConfig, tim_out_trigger_config_t* _masterConfig, float _fs)
+{
+#if MAX11046_ENABLE
+	return BSP_MAX11046_UpdateInputOutputTrigger(_slaveConfig, _masterConfig, _fs);
+#else
+#error "Invalid ADC.";
+#endif
+}
+
+#endif
+
+#if EN_ADC_PROTECTION
+#pragma GCC push_options
+#pragma GCC optimize ("no-fast-math")
+/**
+ * @brief Sets the trip limits of a channel for the protection.
+ * @details The limits are disabled by @ref BSP_ADC_Init(). Use @ref ADC_PROTECTION_NO_LOWER_LIMIT or
+ * @ref ADC_PROTECTION_NO_UPPER_LIMIT to disable one side of the channel.
+ * @note Can be called from the ADC callback. The new limits are used from the next conversion. Non-finite limits are
+ * rejected, as the comparisons in the conversion interrupt assume finite values.
+ * @param _channelIndex ADC channel index
+ * @param _lower The channel trips if its value is below this limit
+ * @param _upper The channel trips if its value is above this limit
+ * @return <c>ERR_OK</c> if setting successful else @ref device_err_t.
+ */
+device_err_t BSP_ADC_SetProtectionLimits(int _channelIndex, float _lower, float _upper)
+{
+	if (_channelIndex < 0 || _channelIndex >= ADC_PROTECTION_CHANNEL_COUNT ||
+			!isfinite(_lower) || !isfinite(_upper) || !(_lower <= _upper))
+		return ERR_ILLEGAL;
+#if MAX11046_ENABLE
+	BSP_MAX11046_SetProtectionLimits(_channelIndex, _lower, _upper);
+#else
+#error "Invalid ADC.";
+#endif
+	return ERR_OK;
+}
+#pragma GCC pop_options
+
+/**
+ * @brief Enables or disables the protection of the ADC channels.
+ * @details When enabled all channels are compared against their limits after each conversion, before the ADC callback.
+ * If any channel trips the PWM outputs in <b>_pwmMask</b> are disabled with @ref BSP_PWMOut_DisableFromISR() in the same
+ * interrupt, and @ref BSP_ADC_ProtectionTrippedCallback() is called for the newly tripped channels.
+ * @param _pwmMask PWM channels to be disabled on a trip, as for @ref BSP_PWMOut_Enable()
+ * @param _en <c>true</c> if needs to be enabled else <c>false</c>
+ */
+void BSP_ADC_EnableProtection(uint32_t _pwmMask, bool _en)
+{
+#if MAX11046_ENABLE
+	BSP_MAX11046_EnableProtection(_pwmMask, _en);
+#else
+#error "Invalid ADC.";
+#endif
+}
+
+/**
+ * @brief Re-arms the protection by clearing the tripped channels.
+ * @note Call before enabling the PWM outputs again. Channels still beyond their limits trip again at the next conversion.
+ */
+void BSP_ADC_ResetProtection(void)
+{
+#if MAX11046_ENABLE
+	BSP_MAX11046_ResetProtection();
+#else
+#error "Invalid ADC.";
+#endif
+}
+
+/**
+ * @brief Gets the trip information of the protection.
+ * @param _stats Structure to be filled.
+ */
+void BSP_ADC_GetProtectionStats(adc_protection_stats_t* _stats)
+{
+#if MAX11046_ENABLE
+	BSP_MAX11046_GetProtectionStats(_stats);
+#else
+#error "Invalid ADC.";
+#endif
+}
+
+/**
+ * @brief This function is called by the conversion interrupt when the protection trips new channels.
+ * @details The PWM outputs configured by @ref BSP_ADC_EnableProtection() are already disabled when it is called.
+ * @note A weak implementation of this function is provided. User can create a custom implementation if needed.
+ * @param channelMask Mask of the newly tripped channels. Bit 0 represents the first channel.
+ */
+__weak void BSP_ADC_ProtectionTrippedCallback(uint32_t channelMask)
+{
+}
 #endif
 
 #if IS_COMMS_CORE
@@ -287,12 +411,22 @@ device_err_t BSP_ADC_UpdateConfig(adc_info_t* _info, float _fs, int _channelInde
 
 #if IS_ADC_STATS_CORE && ADC_BULK_STATS
 
+/**
+ * @brief This function is called by @ref BSP_ADC_ComputeStatsInBulk() when the statistics of some channels are updated.
+ * @note A weak implementation of this function is provided. User can create a custom implementation if needed.
+ * @param channelMask Mask of the channels with updated statistics. Bit 0 represents the first channel.
+ */
+__weak void BSP_ADC_StatsUpdatedCallback(uint32_t channelMask)
+{
+}
+
 /**
  * @brief Call this function periodically to compute the statistics of the signals
  * @param _processedAdcData Pointer to the processed data structure.
  * @param _fs Sampling frequency of the ADC.
+ * @return Mask of the channels with updated statistics. Bit 0 represents the first channel.
  */
-void BSP_ADC_ComputeStatsInBulk(adc_processed_data_t* _processedAdcData, float _fs)
+uint32_t BSP_ADC_ComputeStatsInBulk(adc_processed_data_t* _processedAdcData, float _fs)
 {
 	static ring_buffer_t ringBuffLocal = { .wrIndex = 0, .rdIndex = 0, .modulo = MEASURE_SAVE_COUNT - 1 };
 	static bool init = false;
@@ -320,19 +454,22 @@ void BSP_ADC_ComputeStatsInBulk(adc_processed_data_t* _processedAdcData, float _
 
 	ringBuffLocal.wrIndex = processedAdcData->recordIndex;
 	int pend = RingBuffer_GetPendingReadCount(&ringBuffLocal);
-
+	uint32_t updatedChannels = 0;
 
 	if(pend)
 	{
 		int straightCount = RingBuffer_GetCountTillSize(&ringBuffLocal);
 		float* data = (float*)&processedAdcData->dataRecord[ringBuffLocal.rdIndex];
 
-		Stats_Compute_MultiSample_16ch(data, tempStats, (stats_data_t*)processedAdcData->info.stats, pend < straightCount ? pend : straightCount);
+		updatedChannels = Stats_Compute_MultiSample_16ch(data, tempStats, (stats_data_t*)processedAdcData->info.stats, pend < straightCount ? pend : straightCount);
 		if (pend > straightCount)
-			Stats_Compute_MultiSample_16ch((float*)&processedAdcData->dataRecord[0], tempStats, (stats_data_t*)processedAdcData->info.stats, pend - straightCount);
+			updatedChannels |= Stats_Compute_MultiSample_16ch((float*)&processedAdcData->dataRecord[0], tempStats, (stats_data_t*)processedAdcData->info.stats, pend - straightCount);
 
 		ringBuffLocal.rdIndex = ringBuffLocal.wrIndex;
+		if (updatedChannels)
+			BSP_ADC_StatsUpdatedCallback(updatedChannels);
 	}
+	return updatedChannels;
 }
 
 #endif
@@ -435,4 +572,29 @@ void BSP_ADC_ConfigStorage(state_storage_client_t* _config)
 
 #endif
 
+/**
+ * @brief Fill the capture file header according to the current ADC configuration.
+ * @details Channels are named as Ch1 - Ch16. Overwrite the names afterwards if required.
+ * @param _header Pointer to the header to be filled.
+ * @param _info ADC information.
+ */
+void BSP_ADC_FillCaptureHeader(capture_file_header_t* _header, const adc_info_t* _info)
+{
+	CaptureFormat_InitHeader(_header, TOTAL_MEASUREMENT_COUNT, _info->fs);
+	for (int i = 0; i < TOTAL_MEASUREMENT_COUNT; i++)
+	{
+		capture_channel_info_t* ch = &_header->channels[i];
+		char* name = ch->name;
+		*name++ = 'C';
+		*name++ = 'h';
+		if (i >= 9)
+			*name++ = '1';
+		*name = '0' + ((i + 1) % 10);
+		if (_info->units[i] < UNIT_COUNT)
+			strncpy(ch->unit, captureUnitTxts[_info->units[i]], CAPTURE_UNIT_LEN - 1);
+		ch->sensitivity = _info->sensitivity[i];
+		ch->offset = _info->offsets[i];
+	}
+}
+
 /* EOF */
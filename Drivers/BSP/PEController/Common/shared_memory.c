@@ -25,6 +25,9 @@
 #include "p2p_comms.h"
 #include "shared_memory.h"
 #include "pecontroller_adc.h"
+#if IS_ADC_STATS_CORE
+#include "cmsis_os.h"
+#endif
 /********************************************************************************
  * Defines
  *******************************************************************************/
@@ -40,6 +43,12 @@
 /********************************************************************************
  * Static Variables
  *******************************************************************************/
+#if IS_ADC_STATS_CORE
+/**
+ * @brief Task waiting for the ADC records
+ */
+static osThreadId_t volatile adcWaiter = NULL;
+#endif
 
 /********************************************************************************
  * Global Variables
@@ -70,6 +79,22 @@ void SharedMemory_Init(void)
 #endif
 }
 
+#if IS_ADC_CORE
+/**
+ * @brief Notify the CM4 core once @ref SHARED_MEMORY_ADC_NOTIFY_COUNT new records are published.
+ */
+static void NotifyAdcRecords(void)
+{
+	static int notifiedIndex = 0;
+	int recordIndex = PROCESSED_ADC_DATA.recordIndex;
+	if (((recordIndex - notifiedIndex) & (MEASURE_SAVE_COUNT - 1)) < SHARED_MEMORY_ADC_NOTIFY_COUNT)
+		return;
+	notifiedIndex = recordIndex;
+	if (HAL_HSEM_FastTake(SHARED_MEMORY_ADC_HSEM_ID) == HAL_OK)
+		HAL_HSEM_Release(SHARED_MEMORY_ADC_HSEM_ID, 0);
+}
+#endif
+
 /**
  * @brief Refresh the shared memory
  */
@@ -80,8 +105,61 @@ void SharedMemory_Refresh(void)
 #endif
 #if IS_ADC_CORE
 	BSP_ADC_RefreshData();
+	NotifyAdcRecords();
+#endif
+}
+
+#if IS_ADC_STATS_CORE
+/**
+ * @brief Enable the notification of the new ADC records from the ADC core.
+ * @note Call once after HAL_Init(). Without the notification @ref SharedMemory_WaitForAdcRecords() always waits
+ * till the timeout.
+ */
+void SharedMemory_InitAdcNotification(void)
+{
+	__HAL_RCC_HSEM_CLK_ENABLE();
+	__HAL_HSEM_CLEAR_FLAG(__HAL_HSEM_SEMID_TO_MASK(SHARED_MEMORY_ADC_HSEM_ID));
+	HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(SHARED_MEMORY_ADC_HSEM_ID));
+	// shares the interrupt with the completion notification of the interprocessor communication
+	HAL_NVIC_SetPriority(HSEM2_IRQn, P2P_COMMS_DOORBELL_IRQ_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(HSEM2_IRQn);
+}
+
+/**
+ * @brief Wait till @ref SHARED_MEMORY_ADC_NOTIFY_COUNT new records are available in @ref PROCESSED_ADC_DATA.
+ * @details A notification received while the records of the last one were processed ends the wait right away.
+ * Only a single task should wait for the records.
+ * @param timeout Maximum time to wait in ticks, which bounds the delay of the records following the last notification.
+ * @return <c>true</c> if notified, <c>false</c> if the timeout elapsed.
+ */
+bool SharedMemory_WaitForAdcRecords(uint32_t timeout)
+{
+	adcWaiter = osThreadGetId();
+	uint32_t flags = osThreadFlagsWait(SHARED_MEMORY_ADC_THREAD_FLAG, osFlagsWaitAny, timeout);
+	return (flags & osFlagsError) == 0;
+}
+#endif
+
+#if IS_COMMS_CORE || IS_ADC_STATS_CORE
+/**
+ * @brief Handles the notifications of the CM7 core.
+ */
+void HSEM2_IRQHandler(void)
+{
+	// HSEM_COMMON maps to the registers of the executing core
+	uint32_t flags = HSEM_COMMON->MISR;
+	__HAL_HSEM_CLEAR_FLAG(flags);
+#if IS_COMMS_CORE
+	if (flags & __HAL_HSEM_SEMID_TO_MASK(P2P_COMMS_HSEM_ID))
+		P2PComms_ProcessCompletedTransactions();
+#endif
+#if IS_ADC_STATS_CORE
+	osThreadId_t waiter = adcWaiter;
+	if ((flags & __HAL_HSEM_SEMID_TO_MASK(SHARED_MEMORY_ADC_HSEM_ID)) && waiter != NULL)
+		osThreadFlagsSet(waiter, SHARED_MEMORY_ADC_THREAD_FLAG);
 #endif
 }
+#endif
 
 /* EOF */
 
@@ -0,0 +1,270 @@
+/**
+ ********************************************************************************
+ * @file 		task_telemetry.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Run time, scheduling latency and stack usage of the FreeRTOS tasks
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include "task_telemetry.h"
+#include "shared_memory.h"
+#if IS_TASK_TELEMETRY_CORE
+#include "FreeRTOS.h"
+#include "task.h"
+#include "cmsis_os.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/**
+ * @brief Convert the cycles of the run time counter to micro-seconds
+ */
+#define CYCLES_TO_US(cycles)			((uint32_t)((uint64_t)(cycles) * 1000000U / configCPU_CLOCK_HZ))
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief Statistics of a task between the updates of the table
+ * @note The slot of a task is given by its application task tag, which is its index + 1.
+ */
+typedef struct
+{
+	TaskHandle_t handle;				/**< Task using the slot. NULL if free */
+	uint32_t lastRunTime;				/**< Run time counter of the task at the last update */
+	volatile uint32_t readyTime;		/**< Cycle counter when the task became ready */
+	volatile bool isReady;				/**< The task is ready and not switched in yet */
+	volatile uint32_t switchIns;		/**< No of times the task was switched in since the last update */
+	volatile uint32_t maxLatency;		/**< Longest latency since the last update in cycles */
+	uint32_t peakLatency;				/**< Longest latency since the last reset in cycles */
+	bool isSeen;						/**< The task was found in the last update */
+} task_slot_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static task_slot_t slots[TASK_TELEMETRY_MAX_TASKS];
+static TaskStatus_t taskStatus[TASK_TELEMETRY_MAX_TASKS];
+static uint32_t lastTotalRunTime = 0;
+static uint32_t lastResetRequests = 0;
+static osTimerId_t updateTimer = NULL;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Enable the DWT cycle counter for the run time statistics of FreeRTOS.
+ * @note Called by the kernel through portCONFIGURE_TIMER_FOR_RUN_TIME_STATS().
+ */
+void TaskTelemetry_InitCounter(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * @brief Get the run time counter of FreeRTOS.
+ * @note Called by the kernel through portGET_RUN_TIME_COUNTER_VALUE().
+ * @return Value of the DWT cycle counter.
+ */
+uint32_t TaskTelemetry_GetCounter(void)
+{
+	return DWT->CYCCNT;
+}
+
+/**
+ * @brief Note the time at which a task became ready.
+ * @note Called by the kernel through traceMOVED_TASK_TO_READY_STATE().
+ * @param tag Application task tag of the task. Ignored if it isn't assigned by this module.
+ */
+void TaskTelemetry_TaskReady(uint32_t tag)
+{
+	if (tag == 0 || tag > TASK_TELEMETRY_MAX_TASKS)
+		return;
+	task_slot_t* slot = &slots[tag - 1];
+	// keep the earliest time if the task is moved again before running, e.g. by a change of its priority
+	if (!slot->isReady)
+	{
+		slot->readyTime = DWT->CYCCNT;
+		slot->isReady = true;
+	}
+}
+
+/**
+ * @brief Measure the scheduling latency of the task being switched in.
+ * @note Called by the kernel through traceTASK_SWITCHED_IN().
+ * @param tag Application task tag of the task. Ignored if it isn't assigned by this module.
+ */
+void TaskTelemetry_TaskSwitchedIn(uint32_t tag)
+{
+	if (tag == 0 || tag > TASK_TELEMETRY_MAX_TASKS)
+		return;
+	task_slot_t* slot = &slots[tag - 1];
+	slot->switchIns++;
+	if (slot->isReady)
+	{
+		uint32_t latency = DWT->CYCCNT - slot->readyTime;
+		if (latency > slot->maxLatency)
+			slot->maxLatency = latency;
+		slot->isReady = false;
+	}
+}
+
+/**
+ * @brief Find the slot of a task from its tag.
+ * @return Index of the slot. -1 if the task has no slot yet.
+ */
+static int GetSlot(TaskHandle_t handle)
+{
+	uint32_t tag = (uint32_t)(uintptr_t)xTaskGetApplicationTaskTag(handle);
+	if (tag == 0 || tag > TASK_TELEMETRY_MAX_TASKS || slots[tag - 1].handle != handle)
+		return -1;
+	return tag - 1;
+}
+
+/**
+ * @brief Give a slot to a task, reusing the slots of the tasks not found in this update.
+ * @return Index of the slot. -1 if none is free.
+ */
+static int AssignSlot(TaskHandle_t handle, uint32_t runTime)
+{
+	for (int i = 0; i < TASK_TELEMETRY_MAX_TASKS; i++)
+	{
+		if (slots[i].handle != NULL && slots[i].isSeen)
+			continue;
+		taskENTER_CRITICAL();
+		slots[i].handle = handle;
+		slots[i].isReady = false;
+		slots[i].switchIns = 0;
+		slots[i].maxLatency = 0;
+		taskEXIT_CRITICAL();
+		slots[i].lastRunTime = runTime;
+		slots[i].peakLatency = 0;
+		slots[i].isSeen = true;
+		vTaskSetApplicationTaskTag(handle, (TaskHookFunction_t)(uintptr_t)(i + 1));
+		return i;
+	}
+	return -1;
+}
+
+/**
+ * @brief Fill the table in the shared memory with the statistics of the last period.
+ */
+static void Update_Callback(void* arg)
+{
+	UNUSED(arg);
+	uint32_t totalRunTime;
+	UBaseType_t count = uxTaskGetSystemState(taskStatus, TASK_TELEMETRY_MAX_TASKS, &totalRunTime);
+	uint32_t period = totalRunTime - lastTotalRunTime;
+	lastTotalRunTime = totalRunTime;
+	TaskHandle_t idleHandle = xTaskGetIdleTaskHandle();
+
+	// the slots of the tasks not found anymore can be reused
+	int slotIndex[TASK_TELEMETRY_MAX_TASKS];
+	for (int i = 0; i < TASK_TELEMETRY_MAX_TASKS; i++)
+		slots[i].isSeen = false;
+	for (UBaseType_t i = 0; i < count; i++)
+	{
+		slotIndex[i] = GetSlot(taskStatus[i].xHandle);
+		if (slotIndex[i] >= 0)
+			slots[slotIndex[i]].isSeen = true;
+	}
+
+	volatile task_telemetry_table_t* table = &TASK_TELEMETRY;
+	bool isReset = table->resetRequests != lastResetRequests;
+	lastResetRequests = table->resetRequests;
+
+	table->seq++;
+	__DMB();
+	table->updateCount++;
+	table->period_us = CYCLES_TO_US(period);
+	table->cpuLoad = 0;
+	table->taskCount = count;
+	table->totalTasks = uxTaskGetNumberOfTasks();
+	for (UBaseType_t i = 0; i < count; i++)
+	{
+		TaskStatus_t* status = &taskStatus[i];
+		volatile task_telemetry_entry_t* entry = &table->tasks[i];
+		uint32_t runTime = 0;
+		uint32_t switchIns = 0;
+		uint32_t maxLatency = 0;
+		uint32_t peakLatency = 0;
+		if (slotIndex[i] >= 0)
+		{
+			task_slot_t* slot = &slots[slotIndex[i]];
+			runTime = status->ulRunTimeCounter - slot->lastRunTime;
+			slot->lastRunTime = status->ulRunTimeCounter;
+			taskENTER_CRITICAL();
+			switchIns = slot->switchIns;
+			maxLatency = slot->maxLatency;
+			slot->switchIns = 0;
+			slot->maxLatency = 0;
+			taskEXIT_CRITICAL();
+			if (isReset)
+				slot->peakLatency = 0;
+			if (maxLatency > slot->peakLatency)
+				slot->peakLatency = maxLatency;
+			peakLatency = slot->peakLatency;
+		}
+		else
+			// the task is measured from the next period
+			AssignSlot(status->xHandle, status->ulRunTimeCounter);
+
+		strncpy((char*)entry->name, status->pcTaskName, TASK_TELEMETRY_NAME_LEN - 1);
+		entry->name[TASK_TELEMETRY_NAME_LEN - 1] = 0;
+		entry->priority = (uint8_t)status->uxBasePriority;
+		entry->state = (uint8_t)status->eCurrentState;
+		entry->cpuLoad = period ? (runTime * 100.f) / period : 0;
+		entry->runTime_us = CYCLES_TO_US(runTime);
+		entry->switchIns = switchIns;
+		entry->maxLatency_us = CYCLES_TO_US(maxLatency);
+		entry->peakLatency_us = CYCLES_TO_US(peakLatency);
+		entry->stackFree = status->usStackHighWaterMark * sizeof(StackType_t);
+		if (status->xHandle != idleHandle)
+			table->cpuLoad += entry->cpuLoad;
+	}
+	__DMB();
+	table->seq++;
+}
+
+/**
+ * @brief Start the periodic updates of @ref TASK_TELEMETRY.
+ * @note Call before starting the kernel. Needs the timers of FreeRTOS.
+ */
+void TaskTelemetry_Init(void)
+{
+	static const osTimerAttr_t attributes = { .name = "taskTelemetry" };
+	memset((void*)&TASK_TELEMETRY, 0, sizeof(task_telemetry_table_t));
+	memset(slots, 0, sizeof(slots));
+	updateTimer = osTimerNew(Update_Callback, osTimerPeriodic, NULL, &attributes);
+	if (updateTimer == NULL || osTimerStart(updateTimer, TASK_TELEMETRY_PERIOD_ms) != osOK)
+		Error_Handler();
+}
+
+#endif
+/* EOF */
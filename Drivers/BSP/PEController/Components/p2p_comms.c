@@ -25,9 +25,26 @@
 #include "p2p_comms.h"
 #include "shared_memory.h"
 #include "utility_lib.h"
+#include <stddef.h>
+#include <string.h>
+#if IS_COMMS_CORE
+#include "cmsis_os.h"
+#endif
 /********************************************************************************
  * Defines
  *******************************************************************************/
+/**
+ * @brief Command buffer entry describing a transaction item
+ */
+#define TXN_ITEM_HEADER(type, index)			((uint32_t)(type) | ((uint32_t)(index) << 8))
+/**
+ * @brief Number of command / response buffer entries used by each transaction item
+ */
+#define TXN_ENTRIES_PER_ITEM					(2)
+/**
+ * @brief Location of a data type in @ref p2p_data_buffs_t
+ */
+#define DATA_GROUP_INFO(member)					{ offsetof(p2p_data_buffs_t, member), sizeof(((p2p_data_buffs_t*)0)->member) }
 
 /********************************************************************************
  * Typedefs
@@ -36,10 +53,35 @@
 /********************************************************************************
  * Structures
  *******************************************************************************/
-
+/**
+ * @brief Location of a data type in the shared data buffers
+ */
+typedef struct
+{
+	uint32_t offset;			/**< Byte offset in @ref p2p_data_buffs_t */
+	uint32_t size;				/**< Size in bytes */
+} data_group_info_t;
 /********************************************************************************
  * Static Variables
  *******************************************************************************/
+#if IS_COMMS_CORE || IS_STORAGE_CORE
+/**
+ * @brief Location of each data type in the shared data buffers
+ * @note The order should strictly match @ref base_data_type_t
+ */
+static const data_group_info_t dataGroups[DTYPE_COUNT] =
+{
+		DATA_GROUP_INFO(bools),
+		DATA_GROUP_INFO(u8s),
+		DATA_GROUP_INFO(s8s),
+		DATA_GROUP_INFO(u16s),
+		DATA_GROUP_INFO(s16s),
+		DATA_GROUP_INFO(u32s),
+		DATA_GROUP_INFO(s32s),
+		DATA_GROUP_INFO(floats),
+		DATA_GROUP_INFO(bitAccess)
+};
+#endif
 #if IS_COMMS_CORE
 /**
  * @brief Describes the limits of each type of parameters
@@ -58,6 +100,20 @@ static uint8_t p2pItemsConfig[DTYPE_COUNT] =
 		P2P_BIT_ACCESS_COUNT
 };
 #endif
+#if IS_COMMS_CORE
+/**
+ * @brief Transactions waiting for completion indexed by their message slot
+ */
+static p2p_txn_t* volatile pendingTxns[P2P_COMMS_MSGS_SIZE] = {0};
+/**
+ * @brief Slot of the next message to be completed
+ */
+static int completionIndex = 0;
+/**
+ * @brief <c>true</c> if the completion notification is enabled
+ */
+static bool isDoorbellInitialized = false;
+#endif
 #if IS_STORAGE_CORE
 static uint32_t storageWordLen = 0;
 #endif
@@ -84,30 +140,186 @@ static uint32_t storageWordLen = 0;
  */
 __weak device_err_t P2PComms_SingleUpdateRequest_Blocking(p2p_msg_type_t type, uint8_t index, data_union_t value)
 {
+	p2p_txn_item_t item = { .type = type, .index = index, .value = value };
+	p2p_txn_t txn = { .items = &item, .count = 1 };
+	return P2PComms_Transaction_Blocking(&txn);
+}
+/**
+ * @brief Enable the completion notification from the CM7 core.
+ * @note Call once after HAL_Init(). Without the notification the completions are polled every tick.
+ */
+void P2PComms_InitDoorbell(void)
+{
+	__HAL_RCC_HSEM_CLK_ENABLE();
+	__HAL_HSEM_CLEAR_FLAG(__HAL_HSEM_SEMID_TO_MASK(P2P_COMMS_HSEM_ID));
+	HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(P2P_COMMS_HSEM_ID));
+	HAL_NVIC_SetPriority(HSEM2_IRQn, P2P_COMMS_DOORBELL_IRQ_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(HSEM2_IRQn);
+	isDoorbellInitialized = true;
+}
+/**
+ * @brief Post the transaction in the message buffers.
+ * @param txn Transaction to be posted.
+ * @param waiter Task to be notified on completion. If NULL the callback is used.
+ * @return device_err_t <c>ERR_OK</c> if posted else the relevant error.
+ */
+static device_err_t PostTransaction(p2p_txn_t* txn, void* waiter)
+{
+	if (txn == NULL || txn->items == NULL || txn->count < 1 || txn->count > P2P_COMMS_TXN_MAX_ITEMS)
+		return ERR_ILLEGAL;
+	for (int i = 0; i < txn->count; i++)
+	{
+		if (txn->items[i].type == MSG_TRANSACTION)
+			return ERR_ILLEGAL;
+	}
+
+	int len = txn->count * TXN_ENTRIES_PER_ITEM;
+	ring_buffer_t* msgs = (ring_buffer_t*)&CORE_MSGS.msgsRingBuff;
+	ring_buffer_t* cmds = (ring_buffer_t*)&CORE_MSGS.cmdsRingBuff;
+
 	// Disable IRQ to avoid clash
 	__disable_irq();
 
-	volatile p2p_msg_t* msg = &CORE_MSGS.msgs[CORE_MSGS.msgsRingBuff.wrIndex];
-	msg->type = type;
-	msg->firstReg = index;
-	msg->cmdIndex = CORE_MSGS.cmdsRingBuff.wrIndex;
-	CORE_MSGS.cmds[msg->cmdIndex] = value;
-	msg->cmdLen = 1;
+	// A slot is only reused after the completion of its previous message is handled, the write index never
+	// reaches the completion index as both being equal means that no message is pending
+	int slot = msgs->wrIndex;
+	int freeCmds = (cmds->rdIndex - cmds->wrIndex - 1) & cmds->modulo;
+	if (RingBuffer_IsFull(msgs) || RingBuffer_NextLoc(msgs, slot) == completionIndex || freeCmds < len)
+	{
+		__enable_irq();
+		return ERR_NOT_AVAILABLE;
+	}
+
+	txn->isComplete = false;
+	txn->err = ERR_OK;
+	txn->waiter = waiter;
+	volatile p2p_msg_t* msg = &CORE_MSGS.msgs[slot];
+	msg->type = MSG_TRANSACTION;
+	msg->firstReg = 0;
+	msg->cmdIndex = cmds->wrIndex;
+	msg->cmdLen = len;
 	msg->responseIndex = msg->responseLen = -1;
-	RingBuffer_Write((ring_buffer_t*)&CORE_MSGS.msgsRingBuff);
-	RingBuffer_Write((ring_buffer_t*)&CORE_MSGS.cmdsRingBuff);
+	for (int i = 0; i < txn->count; i++)
+	{
+		CORE_MSGS.cmds[cmds->wrIndex].u32 = TXN_ITEM_HEADER(txn->items[i].type, txn->items[i].index);
+		RingBuffer_Write(cmds);
+		CORE_MSGS.cmds[cmds->wrIndex] = txn->items[i].value;
+		RingBuffer_Write(cmds);
+	}
+	pendingTxns[slot] = txn;
+
+	// Make the message contents visible to the CM7 core before publishing it
+	__DMB();
+	RingBuffer_Write(msgs);
 
 	// Enable IRQ after process done
 	__enable_irq();
+	return ERR_OK;
+}
+/**
+ * @brief Post a transaction and wait for its completion.
+ * @note The calling task sleeps till the CM7 core completes the transaction. @ref p2p_txn_t.Callback is not used.
+ * @param txn Transaction to be processed.
+ * @return device_err_t <c>ERR_OK</c> if all items are successful, the first error of the items or
+ * <c>ERR_ILLEGAL</c> if the transaction is invalid.
+ */
+device_err_t P2PComms_Transaction_Blocking(p2p_txn_t* txn)
+{
+	bool isKernelRunning = osKernelGetState() == osKernelRunning;
+	void* waiter = isKernelRunning ? (void*)osThreadGetId() : NULL;
 
-	int temp = -1;
-	while (temp == -1)
+	device_err_t err;
+	while ((err = PostTransaction(txn, waiter)) == ERR_NOT_AVAILABLE)
 	{
-		osDelay(1);
-		temp = msg->responseIndex;
+		if (isKernelRunning)
+			osDelay(1);
 	}
+	if (err != ERR_OK)
+		return err;
+
+	while (!txn->isComplete)
+	{
+		// Timeout makes sure that a stale notification can't block the task
+		if (isKernelRunning)
+			osThreadFlagsWait(P2P_COMMS_TXN_THREAD_FLAG, osFlagsWaitAny, 1);
+		if (!isDoorbellInitialized || !isKernelRunning)
+		{
+			__disable_irq();
+			P2PComms_ProcessCompletedTransactions();
+			__enable_irq();
+		}
+	}
+	return txn->err;
+}
+/**
+ * @brief Post a transaction without waiting for its completion.
+ * @note @ref p2p_txn_t.Callback is called from the interrupt context on completion. Poll
+ * @ref p2p_txn_t.isComplete if no callback is provided.
+ * @param txn Transaction to be processed.
+ * @return device_err_t <c>ERR_OK</c> if posted, <c>ERR_NOT_AVAILABLE</c> if the message buffers are full or
+ * <c>ERR_ILLEGAL</c> if the transaction is invalid.
+ */
+device_err_t P2PComms_Transaction_Async(p2p_txn_t* txn)
+{
+	return PostTransaction(txn, NULL);
+}
+/**
+ * @brief Complete the transactions processed by the CM7 core.
+ * @note Called by the completion notification interrupt. Interrupts should be disabled if called from elsewhere.
+ */
+void P2PComms_ProcessCompletedTransactions(void)
+{
+	ring_buffer_t* msgs = (ring_buffer_t*)&CORE_MSGS.msgsRingBuff;
+	ring_buffer_t* responses = (ring_buffer_t*)&CORE_MSGS.responseRingBuff;
+	bool isUpdated = false;
+
+	// Messages are completed in order so stop at the first pending message
+	while (completionIndex != msgs->wrIndex && CORE_MSGS.msgs[completionIndex].responseIndex != -1)
+	{
+		// Read the responses only after the completion is visible
+		__DMB();
+		volatile p2p_msg_t* msg = &CORE_MSGS.msgs[completionIndex];
+		p2p_txn_t* txn = pendingTxns[completionIndex];
+		int index = msg->responseIndex;
+		if (txn != NULL)
+		{
+			for (int i = 0; i < txn->count; i++)
+			{
+				txn->items[i].err = (device_err_t)CORE_MSGS.response[index].u32;
+				index = RingBuffer_NextLoc(responses, index);
+				txn->items[i].value = *(data_union_t*)&CORE_MSGS.response[index];
+				index = RingBuffer_NextLoc(responses, index);
+				if (txn->err == ERR_OK)
+					txn->err = txn->items[i].err;
+				isUpdated |= txn->items[i].type < MSG_GET_BOOL && txn->items[i].err == ERR_OK;
+			}
+			pendingTxns[completionIndex] = NULL;
+		}
+		// Release the response buffer for the next transactions
+		responses->rdIndex = (msg->responseIndex + msg->responseLen) & responses->modulo;
+		completionIndex = RingBuffer_NextLoc(msgs, completionIndex);
 
-	return (device_err_t)CORE_MSGS.response[msg->responseIndex].u8;
+		if (txn != NULL)
+		{
+			void* waiter = txn->waiter;
+			txn->isComplete = true;
+			if (waiter != NULL)
+				osThreadFlagsSet((osThreadId_t)waiter, P2P_COMMS_TXN_THREAD_FLAG);
+			else if (txn->Callback != NULL)
+				txn->Callback(txn);
+		}
+	}
+	if (isUpdated)
+		P2PComms_ParametersUpdatedCallback();
+}
+/**
+ * @brief This function is called by @ref P2PComms_ProcessCompletedTransactions() when the completed transactions
+ * have updated some parameters, e.g. to store the new states.
+ * @note Called from the interrupt context. A weak implementation of this function is provided. User can create a
+ * custom implementation if needed.
+ */
+__weak void P2PComms_ParametersUpdatedCallback(void)
+{
 }
 /**
  * @brief Validates that the parameter is valid.
@@ -329,6 +541,51 @@ __weak device_err_t Default_SetDataParameter(data_param_info_t* _paramInfo, data
 
 #endif
 
+#if IS_COMMS_CORE || IS_STORAGE_CORE
+/**
+ * @brief Copy the shared data buffers if they were updated since the last copy.
+ * @details The copy is retried till no update section of the CM7 core overlaps with it. Only the data types
+ * updated since the last copy are copied.
+ * @note Only available on the CM4 core as the CM7 core can't wait for its own update sections.
+ * @param snapshot Snapshot to be refreshed.
+ * @return Mask of the data types updated since the last copy (See @ref P2P_DATA_GROUP()). Zero if nothing changed.
+ */
+uint32_t P2PComms_TakeSnapshot(p2p_data_snapshot_t* snapshot)
+{
+	volatile p2p_data_sync_t* sync = &INTER_CORE_DATA_SYNC;
+	while (1)
+	{
+		uint32_t seq = sync->seq;
+		__DMB();
+		if (sync->writers != 0)
+			continue;
+		if (snapshot->isValid && seq == snapshot->seq)
+			return 0;
+
+		uint32_t groups = 0;
+		for (int i = 0; i < DTYPE_COUNT; i++)
+		{
+			// Sequence comparison is safe against the overflow of the counter
+			if (!snapshot->isValid || (int32_t)(sync->groupSeq[i] - snapshot->seq) > 0)
+			{
+				groups |= P2P_DATA_GROUP(i);
+				memcpy((uint8_t*)&snapshot->data + dataGroups[i].offset,
+						(const uint8_t*)&INTER_CORE_DATA + dataGroups[i].offset, dataGroups[i].size);
+			}
+		}
+
+		// The copy is consistent only if no update section was opened or closed in the meantime
+		__DMB();
+		if (sync->writers == 0 && sync->seq == seq)
+		{
+			snapshot->seq = seq;
+			snapshot->isValid = true;
+			return groups;
+		}
+	}
+}
+#endif
+
 #if IS_STORAGE_CORE
 
 /**
@@ -340,12 +597,13 @@ __weak device_err_t Default_SetDataParameter(data_param_info_t* _paramInfo, data
  */
 __weak uint32_t P2PComms_RefreshStates(uint32_t* data, uint32_t* indexPtr)
 {
+	static p2p_data_snapshot_t snapshot = {0};
 	uint32_t len = 0;
 	p2p_data_buffs_t* dest = (p2p_data_buffs_t*)data;
-	p2p_data_buffs_t* src = (p2p_data_buffs_t*)&INTER_CORE_DATA;
+	p2p_data_buffs_t* src = &snapshot.data;
 
 	// @note Only update values and signal to update if values have been changed
-	if (P2PComms_IsStateStorageUpdateNeeded(dest, src))
+	if (P2PComms_TakeSnapshot(&snapshot) != 0 && P2PComms_IsStateStorageUpdateNeeded(dest, src))
 	{
 		P2PComms_UpdateStorableStates(dest, src);
 		len = storageWordLen;
@@ -513,45 +771,239 @@ __weak device_err_t P2PComms_ToggleBits(uint8_t index, uint8_t value)
 	return ERR_OK;
 }
 /**
- * @brief Process the pending request for interprocessor communications.
- * @note Call this function frequently to make sure that interprocessor communications work flawlessly.
- * @note A weak implementation of this function is provided. User can create a custom implementation if needed.
+ * @brief Start a section updating the shared data buffers.
+ * @details Readers don't copy the data while any section is open, so multiple registers updated in a
+ * single section are always seen together. Sections can be nested and can be used in the interrupts.
+ * Keep the sections short as the readers retry till all of them are closed.
  */
-__weak void P2PComms_ProcessPendingRequests(void)
+void P2PComms_BeginUpdate(void)
+{
+	// Sequentially consistent atomics also order the data accesses around them
+	__atomic_fetch_add(&INTER_CORE_DATA_SYNC.writers, 1, __ATOMIC_SEQ_CST);
+}
+/**
+ * @brief End the section started with @ref P2PComms_BeginUpdate().
+ * @param groups Mask of the data types updated in the section (See @ref P2P_DATA_GROUP()).
+ */
+void P2PComms_EndUpdate(uint32_t groups)
+{
+	volatile p2p_data_sync_t* sync = &INTER_CORE_DATA_SYNC;
+	// A nested section closing in the meantime only advances the sequence further, so the readers
+	// still see the data types as updated after their last copy
+	uint32_t seq = sync->seq + 1;
+	for (int i = 0; i < DTYPE_COUNT; i++)
+	{
+		if (groups & P2P_DATA_GROUP(i))
+			sync->groupSeq[i] = seq;
+	}
+	__atomic_fetch_add(&sync->seq, 1, __ATOMIC_SEQ_CST);
+	__atomic_fetch_sub(&sync->writers, 1, __ATOMIC_SEQ_CST);
+}
+/**
+ * @brief Write a boolean register from the control code and signal the readers if it changed.
+ * @param index Register index.
+ * @param value Desired value.
+ */
+void P2PComms_WriteBool(uint8_t index, bool value)
 {
-	if (RingBuffer_IsEmpty((ring_buffer_t*)&CORE_MSGS.msgsRingBuff))
+	if (INTER_CORE_DATA.bools[index] == value)
 		return;
+	P2PComms_BeginUpdate();
+	INTER_CORE_DATA.bools[index] = value;
+	P2PComms_EndUpdate(P2P_DATA_GROUP(DTYPE_BOOL));
+}
+/**
+ * @brief Write a single-precision floating register from the control code and signal the readers if it changed.
+ * @param index Register index.
+ * @param value Desired value.
+ */
+void P2PComms_WriteFloat(uint8_t index, float value)
+{
+	if (INTER_CORE_DATA.floats[index] == value)
+		return;
+	P2PComms_BeginUpdate();
+	INTER_CORE_DATA.floats[index] = value;
+	P2PComms_EndUpdate(P2P_DATA_GROUP(DTYPE_FLOAT));
+}
+/**
+ * @brief Get the data type updated by a message type.
+ * @param type Message type.
+ * @return Mask of the updated data type. Zero if the type doesn't update any register.
+ */
+static uint32_t GetUpdatedGroups(p2p_msg_type_t type)
+{
+	switch (type)
+	{
+	case MSG_SET_BOOL: return P2P_DATA_GROUP(DTYPE_BOOL);
+	case MSG_SET_U8: return P2P_DATA_GROUP(DTYPE_U8);
+	case MSG_SET_S8: return P2P_DATA_GROUP(DTYPE_S8);
+	case MSG_SET_U16: return P2P_DATA_GROUP(DTYPE_U16);
+	case MSG_SET_S16: return P2P_DATA_GROUP(DTYPE_S16);
+	case MSG_SET_U32: return P2P_DATA_GROUP(DTYPE_U32);
+	case MSG_SET_S32: return P2P_DATA_GROUP(DTYPE_S32);
+	case MSG_SET_FLOAT: return P2P_DATA_GROUP(DTYPE_FLOAT);
+	case MSG_SET_BITS: case MSG_CLR_BITS: case MSG_TOGGLE_BITS: return P2P_DATA_GROUP(DTYPE_BIT_ACCESS);
+	default: return 0;
+	}
+}
+/**
+ * @brief Get the number of registers available for a message type.
+ * @param type Message type.
+ * @return Number of registers. Zero if the type is not a set or get message.
+ */
+static int GetRegisterCount(p2p_msg_type_t type)
+{
+	switch (type)
+	{
+	case MSG_SET_BOOL: case MSG_GET_BOOL: return P2P_BOOL_COUNT;
+	case MSG_SET_U8: case MSG_GET_U8: return P2P_U8_COUNT;
+	case MSG_SET_S8: case MSG_GET_S8: return P2P_S8_COUNT;
+	case MSG_SET_U16: case MSG_GET_U16: return P2P_U16_COUNT;
+	case MSG_SET_S16: case MSG_GET_S16: return P2P_S16_COUNT;
+	case MSG_SET_U32: case MSG_GET_U32: return P2P_U32_COUNT;
+	case MSG_SET_S32: case MSG_GET_S32: return P2P_S32_COUNT;
+	case MSG_SET_FLOAT: case MSG_GET_FLOAT: return P2P_FLOAT_COUNT;
+	case MSG_SET_BITS: case MSG_CLR_BITS: case MSG_TOGGLE_BITS: return P2P_BIT_ACCESS_COUNT;
+	default: return 0;
+	}
+}
+/**
+ * @brief Process a single register access.
+ * @param type Message type.
+ * @param index Register index.
+ * @param value Value to be set. Updated with the register value for the get messages.
+ * @return device_err_t If successful <c>ERR_OK</c> else some other error.
+ */
+static device_err_t ProcessItem(p2p_msg_type_t type, uint8_t index, data_union_t* value)
+{
+	if (index >= GetRegisterCount(type))
+		return ERR_ILLEGAL;
+
+	switch (type)
+	{
+	case MSG_SET_BOOL: return P2PComms_UpdateBool(index, value->b);
+	case MSG_SET_U8: return P2PComms_UpdateU8(index, value->u8);
+	case MSG_SET_U16: return P2PComms_UpdateU16(index, value->u16);
+	case MSG_SET_U32: return P2PComms_UpdateU32(index, value->u32);
+	case MSG_SET_S8: return P2PComms_UpdateS8(index, value->s8);
+	case MSG_SET_S16: return P2PComms_UpdateS16(index, value->s16);
+	case MSG_SET_S32: return P2PComms_UpdateS32(index, value->s32);
+	case MSG_SET_FLOAT: return P2PComms_UpdateFloat(index, value->f);
+	case MSG_SET_BITS: return P2PComms_SetBits(index, value->bits);
+	case MSG_CLR_BITS: return P2PComms_ClearBits(index, value->bits);
+	case MSG_TOGGLE_BITS: return P2PComms_ToggleBits(index, value->bits);
+	case MSG_GET_BOOL: value->b = INTER_CORE_DATA.bools[index]; return ERR_OK;
+	case MSG_GET_U8: value->u8 = INTER_CORE_DATA.u8s[index]; return ERR_OK;
+	case MSG_GET_U16: value->u16 = INTER_CORE_DATA.u16s[index]; return ERR_OK;
+	case MSG_GET_U32: value->u32 = INTER_CORE_DATA.u32s[index]; return ERR_OK;
+	case MSG_GET_S8: value->s8 = INTER_CORE_DATA.s8s[index]; return ERR_OK;
+	case MSG_GET_S16: value->s16 = INTER_CORE_DATA.s16s[index]; return ERR_OK;
+	case MSG_GET_S32: value->s32 = INTER_CORE_DATA.s32s[index]; return ERR_OK;
+	case MSG_GET_FLOAT: value->f = INTER_CORE_DATA.floats[index]; return ERR_OK;
+	default: return ERR_ILLEGAL;
+	}
+}
+/**
+ * @brief Process all items of a transaction and write their responses.
+ * @param msg Transaction message.
+ * @return <c>true</c> if processed, <c>false</c> if the response buffer doesn't have enough space yet.
+ */
+static bool ProcessTransaction(p2p_msg_t* msg)
+{
+	ring_buffer_t* cmds = (ring_buffer_t*)&CORE_MSGS.cmdsRingBuff;
+	ring_buffer_t* responses = (ring_buffer_t*)&CORE_MSGS.responseRingBuff;
+	int count = msg->cmdLen / TXN_ENTRIES_PER_ITEM;
+	int freeResponses = (responses->rdIndex - responses->wrIndex - 1) & responses->modulo;
+	if (freeResponses < msg->cmdLen)
+		return false;
+
+	int cmdIndex = msg->cmdIndex;
+	int responseIndex = responses->wrIndex;
+	uint32_t groups = 0;
+	for (int i = 0; i < count; i++)
+	{
+		uint32_t header = CORE_MSGS.cmds[cmdIndex].u32;
+		cmdIndex = RingBuffer_NextLoc(cmds, cmdIndex);
+		data_union_t value = *(data_union_t*)&CORE_MSGS.cmds[cmdIndex];
+		cmdIndex = RingBuffer_NextLoc(cmds, cmdIndex);
+
+		// All updates of the transaction become visible to the readers together
+		p2p_msg_type_t type = (p2p_msg_type_t)(header & 0xFF);
+		uint32_t itemGroups = GetUpdatedGroups(type);
+		if (itemGroups != 0 && groups == 0)
+			P2PComms_BeginUpdate();
+		groups |= itemGroups;
+		device_err_t err = type == MSG_TRANSACTION ? ERR_ILLEGAL : ProcessItem(type, (uint8_t)(header >> 8), &value);
+
+		CORE_MSGS.response[responses->wrIndex].u32 = (uint32_t)err;
+		RingBuffer_Write(responses);
+		CORE_MSGS.response[responses->wrIndex] = value;
+		RingBuffer_Write(responses);
+	}
+	if (groups != 0)
+		P2PComms_EndUpdate(groups);
 
-	device_err_t err = ERR_OK;
-	p2p_msg_t* msg = (p2p_msg_t*)&CORE_MSGS.msgs[CORE_MSGS.msgsRingBuff.rdIndex];
-	uint8_t index = msg->firstReg;
+	msg->responseLen = msg->cmdLen;
+	// Make the responses visible before marking the message as complete
+	__DMB();
+	msg->responseIndex = responseIndex;
+	return true;
+}
+/**
+ * @brief Process a single register access message.
+ * @param msg Message to be processed.
+ */
+static void ProcessSingleMessage(p2p_msg_t* msg)
+{
+	device_err_t err = ERR_ILLEGAL;
+	uint32_t groups = GetUpdatedGroups(msg->type);
 	if (msg->cmdLen == 1)
 	{
-		data_union_t* value = (data_union_t*)&CORE_MSGS.cmds[msg->cmdIndex];
-		switch (msg->type)
-		{
-		case MSG_SET_BOOL: err = P2PComms_UpdateBool(index, value->b); break;
-		case MSG_SET_U8: err = P2PComms_UpdateU8(index, value->u8); break;
-		case MSG_SET_U16: err = P2PComms_UpdateU16(index, value->u16); break;
-		case MSG_SET_U32: err = P2PComms_UpdateU32(index, value->u32); break;
-		case MSG_SET_S8: err = P2PComms_UpdateS8(index, value->s8); break;
-		case MSG_SET_S16: err = P2PComms_UpdateS16(index, value->s16); break;
-		case MSG_SET_S32: err = P2PComms_UpdateS32(index, value->s32); break;
-		case MSG_SET_FLOAT: err = P2PComms_UpdateFloat(index, value->f); break;
-		case MSG_SET_BITS: err = P2PComms_SetBits(index, value->bits); break;
-		case MSG_CLR_BITS: err = P2PComms_ClearBits(index, value->bits); break;
-		case MSG_TOGGLE_BITS: err = P2PComms_ToggleBits(index, value->bits); break;
-		default: err = ERR_ILLEGAL; break;
-		}
+		if (groups != 0)
+			P2PComms_BeginUpdate();
+		err = ProcessItem(msg->type, msg->firstReg, (data_union_t*)&CORE_MSGS.cmds[msg->cmdIndex]);
+		if (groups != 0)
+			P2PComms_EndUpdate(groups);
 	}
 
 	msg->responseLen = 1;
 	CORE_MSGS.response[CORE_MSGS.responseRingBuff.wrIndex].u8 = (device_err_t)err;
+	__DMB();
 	msg->responseIndex = CORE_MSGS.responseRingBuff.wrIndex;
-
 	RingBuffer_Write((ring_buffer_t*)&CORE_MSGS.responseRingBuff);
-	RingBuffer_Read((ring_buffer_t*)&CORE_MSGS.msgsRingBuff);
+}
+/**
+ * @brief Process the pending request for interprocessor communications.
+ * @details All pending messages are processed in a single pass after which the CM4 core is notified
+ * by releasing @ref P2P_COMMS_HSEM_ID.
+ * @note Call this function frequently to make sure that interprocessor communications work flawlessly.
+ * @note A weak implementation of this function is provided. User can create a custom implementation if needed.
+ */
+__weak void P2PComms_ProcessPendingRequests(void)
+{
+	bool isProcessed = false;
+	while (!RingBuffer_IsEmpty((ring_buffer_t*)&CORE_MSGS.msgsRingBuff))
+	{
+		// Read the message only after it is published
+		__DMB();
+		p2p_msg_t* msg = (p2p_msg_t*)&CORE_MSGS.msgs[CORE_MSGS.msgsRingBuff.rdIndex];
+		if (msg->type == MSG_TRANSACTION)
+		{
+			// Retry in the next call once the CM4 core has consumed the older responses
+			if (!ProcessTransaction(msg))
+				break;
+		}
+		else
+			ProcessSingleMessage(msg);
+
+		RingBuffer_Read_Count((ring_buffer_t*)&CORE_MSGS.cmdsRingBuff, msg->cmdLen);
+		RingBuffer_Read((ring_buffer_t*)&CORE_MSGS.msgsRingBuff);
+		isProcessed = true;
+	}
 
+	// Notify the CM4 core about the completed messages
+	if (isProcessed && HAL_HSEM_FastTake(P2P_COMMS_HSEM_ID) == HAL_OK)
+		HAL_HSEM_Release(P2P_COMMS_HSEM_ID, 0);
 }
 /**
  * @brief Initialize the buffers and storage for the interprocessor communications.
@@ -564,6 +1016,10 @@ void P2PComms_InitData(void)
 	RingBuffer_Reset((ring_buffer_t*)&CORE_MSGS.msgsRingBuff);
 	RingBuffer_Reset((ring_buffer_t*)&CORE_MSGS.cmdsRingBuff);
 	RingBuffer_Reset((ring_buffer_t*)&CORE_MSGS.responseRingBuff);
+	INTER_CORE_DATA_SYNC.seq = 0;
+	INTER_CORE_DATA_SYNC.writers = 0;
+	for (int i = 0; i < DTYPE_COUNT; i++)
+		INTER_CORE_DATA_SYNC.groupSeq[i] = 0;
 }
 
 #endif
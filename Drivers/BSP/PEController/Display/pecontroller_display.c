@@ -28,11 +28,13 @@
 #include "LCD_AFY800480A0_B0.h"
 #endif
 #include "clut_data.h"
+#include "pecontroller_display_flush.h"
 #include "lvgl.h"
 #include "pecontroller_ts.h"
 #include "screen_data.h"
 #include "screen_manager.h"
 #include "shared_memory.h"
+#include "cmsis_os.h"
 /********************************************************************************
  * Defines
  *******************************************************************************/
@@ -40,6 +42,14 @@
  * @brief Because the LCD is installed in reverse direction, 180 degrees rotation is required
  */
 #define LV_ROTATION			(LV_DISP_ROT_180)
+/**
+ * @brief The 180 degrees rotation is applied by the flush while writing the frame buffer,
+ * other rotations are done by the software rotation of LVGL.
+ */
+#define IS_ROTATION_FUSED	(LV_ROTATION == LV_DISP_ROT_180)
+#if (LV_COLOR_DEPTH != 16) || LV_COLOR_16_SWAP
+#error "The flush expects unswapped RGB565 colors from LVGL"
+#endif
 /********************************************************************************
  * Typedefs
  *******************************************************************************/
@@ -68,6 +78,18 @@ static ltdc_layer_info_t nullLayerInfo =
 		.xAlign = ALIGN_LEFT_X,
 		.yAlign = ALIGN_UP_Y,
 };
+/**
+ * @brief Input device of the touch screen
+ */
+static lv_indev_t* touchIndev = NULL;
+/**
+ * @brief Task waiting for the display events
+ */
+static osThreadId_t volatile displayTask = NULL;
+/**
+ * @brief Tick of LVGL at the last touch
+ */
+static uint32_t lastTouchTick = 0;
 /********************************************************************************
  * Global Variables
  *******************************************************************************/
@@ -84,7 +106,10 @@ uint8_t frame_buff[DISPLAY_HEIGHT_RAM][DISPLAY_WIDTH_RAM] __attribute__((section
  *******************************************************************************/
 static void ReadTouchPad(struct _lv_indev_drv_t * indev, lv_indev_data_t * data)
 {
-	TS_StateTypeDef* state = BSP_TS_GetState();
+	// the queued events are read before the current state, so short taps between the reads are not lost
+	TS_StateTypeDef event;
+	TS_StateTypeDef* state = BSP_TS_GetEvent(&event) ? &event : BSP_TS_GetState();
+	data->continue_reading = BSP_TS_IsEventPending();
 	if(state->touchDetected) {
 		data->state = LV_INDEV_STATE_PRESSED;
 		data->point.x = state->touchX;
@@ -92,18 +117,44 @@ static void ReadTouchPad(struct _lv_indev_drv_t * indev, lv_indev_data_t * data)
 	} else {
 		data->state = LV_INDEV_STATE_RELEASED;
 	}
+	// stop reading the idle touch screen, the reads are resumed by the next touch event
+	if (state->touchDetected || data->continue_reading)
+		lastTouchTick = lv_tick_get();
+	else if (lv_tick_elaps(lastTouchTick) > DISPLAY_TOUCH_IDLE_ms)
+		lv_timer_pause(indev->read_timer);
 }
 
+#if DISPLAY_SYNC_FLUSH
+/**
+ * @brief Wait till the scan of the LTDC is out of the given rows of the panel.
+ * @details The areas are written from top to bottom faster than the LTDC scans them, so the scan can't reach
+ * the written rows once it is out of the area.
+ * @param y1 First row of the area on the panel.
+ * @param y2 Last row of the area on the panel.
+ */
+static void WaitForScanOutOfRows(int y1, int y2)
+{
+	int line;
+	do
+	{
+		// CYPOS counts the synchronization and back porch lines before the active rows
+		line = (int)(hltdc.Instance->CPSR & LTDC_CPSR_CYPOS) - (ACCUMULATED_VBP + 1);
+	} while (line >= y1 - DISPLAY_SYNC_GUARD_LINES && line <= y2);
+}
+#endif
+
 static void FlushLVGLScreen(lv_disp_drv_t * disp, const lv_area_t * area, lv_color_t * color_p)
 {
-	int32_t x, y;
-	for(y = area->y1; y <= area->y2; y++) {
-		for(x = area->x1; x <= area->x2; x++) {
-			frame_buff[y][x] = color_map[((uint16_t)(color_p->full))];
-			color_p++;
-		}
-	}
-	writeAtScreenEnd = (area->x2 > DISPLAY_WIDTH - 30);
+#if DISPLAY_SYNC_FLUSH
+	if (IS_ROTATION_FUSED)
+		WaitForScanOutOfRows(DISPLAY_HEIGHT - 1 - area->y2, DISPLAY_HEIGHT - 1 - area->y1);
+	else
+		WaitForScanOutOfRows(area->y1, area->y2);
+#endif
+	DisplayFlush_ConvertArea((uint8_t*)frame_buff, DISPLAY_WIDTH_RAM, DISPLAY_HEIGHT_RAM, area->x1, area->y1, area->x2, area->y2,
+			(const uint16_t*)color_p, color_map, IS_ROTATION_FUSED);
+	// right end of the area on the panel
+	writeAtScreenEnd = ((IS_ROTATION_FUSED ? DISPLAY_WIDTH - 1 - area->x1 : area->x2) > DISPLAY_WIDTH - 30);
 	lv_disp_flush_ready(disp); /* Indicate you are ready with the flushing*/
 }
 
@@ -205,7 +256,7 @@ static void ConfigLVGL(void)
 	disp_drv.hor_res = DISPLAY_WIDTH; /*Set the horizontal resolution of the display*/
 	disp_drv.ver_res = DISPLAY_HEIGHT; /*Set the vertical resolution of the display*/
 	disp_drv.rotated = LV_ROTATION;
-	disp_drv.sw_rotate = 1;
+	disp_drv.sw_rotate = !IS_ROTATION_FUSED;
 	lv_disp_t* disp = lv_disp_drv_register(&disp_drv); /*Finally register the driver*/
 	disp->theme = lv_theme_taraz_init(disp, lv_color_make(0, 100, 100), lv_color_make(0, 200, 200), true, LV_FONT_DEFAULT);
 
@@ -213,7 +264,7 @@ static void ConfigLVGL(void)
 	lv_indev_drv_init(&indev_drv); /*Basic initialization*/
 	indev_drv.type = LV_INDEV_TYPE_POINTER; /*Touch pad is a pointer-like device*/
 	indev_drv.read_cb = ReadTouchPad; /*Set your driver function*/
-	lv_indev_drv_register(&indev_drv);
+	touchIndev = lv_indev_drv_register(&indev_drv);
 }
 
 static void ConfigLTDC(void)
@@ -240,10 +291,33 @@ static void ConfigLTDC(void)
 	HAL_LTDC_EnableCLUT(&hltdc, LVGL_LAYER);
 }
 
+/**
+ * @brief Wait till the pending layer configuration is loaded by the LTDC in the vertical blanking.
+ */
+static void WaitForLayerReload(void)
+{
+	uint32_t start = HAL_GetTick();
+	while ((hltdc.Instance->SRCR & LTDC_SRCR_VBR) && (HAL_GetTick() - start) < DISPLAY_RELOAD_TIMEOUT_ms)
+	{
+		// the layers are also configured before the scheduler starts
+		if (osKernelGetState() == osKernelRunning)
+			osDelay(1);
+	}
+}
+
+/**
+ * @brief Display a layer from the next frame.
+ * @details A hidden layer (layerInfo is NULL) is out of the display when the function returns, so its pixels can be
+ * overwritten, e.g. by the images decoded by the next screen.
+ * @param layerInfo Information of the layer. NULL to hide the layer.
+ * @param layerIdx Index of the LTDC layer.
+ */
 static void LayerDisplay(ltdc_layer_info_t* layerInfo, int layerIdx)
 {
 	LTDC_LayerCfgTypeDef pLayerCfg;
-	if (layerInfo == NULL)
+	bool isHidden = layerInfo == NULL;
+	// the layer is kept empty if the image couldn't be loaded
+	if (layerInfo == NULL || layerInfo->data == NULL)
 		layerInfo = &nullLayerInfo;
 
 	// remodeling of positions for inverted images
@@ -295,8 +369,14 @@ static void LayerDisplay(ltdc_layer_info_t* layerInfo, int layerIdx)
 	/* Configure the number of lines and number of pixels per line */
 	pLayerCfg.ImageWidth  = layerInfo->width;
 	pLayerCfg.ImageHeight = layerInfo->height;
-	if (HAL_LTDC_ConfigLayer(&hltdc, &pLayerCfg, layerIdx) != HAL_OK)
+	// the new configuration is applied in the vertical blanking, so the layers don't change in the middle of a frame,
+	// after any pending configuration is displayed
+	WaitForLayerReload();
+	if (HAL_LTDC_ConfigLayer_NoReload(&hltdc, &pLayerCfg, layerIdx) != HAL_OK)
 		Error_Handler();
+	__HAL_LTDC_VERTICAL_BLANKING_RELOAD_CONFIG(&hltdc);
+	if (isHidden)
+		WaitForLayerReload();
 }
 
 /**
@@ -311,6 +391,47 @@ void BSP_Display_Init(void)
 	ScreenManager_Init(LayerDisplay, (adc_info_t*)&ADC_INFO);
 }
 
+/**
+ * @brief Wake the display task with the given events.
+ * @note Can be called from the interrupts. The events sent before the display task starts waiting are ignored.
+ * @param events Events to be signaled, e.g. @ref DISPLAY_EVENT_TOUCH.
+ */
+void BSP_Display_NotifyEvents(uint32_t events)
+{
+	osThreadId_t task = displayTask;
+	if (task != NULL)
+		osThreadFlagsSet(task, events & DISPLAY_EVENT_ALL);
+}
+
+/**
+ * @brief Wait for the events of the display, and prepare LVGL to handle them in the next call of lv_timer_handler().
+ * @note Call from the display task only.
+ * @param timeout Maximum time to wait in ticks, e.g. the time till the next timer of LVGL.
+ * @return Mask of the received events. 0 if the timeout elapsed.
+ */
+uint32_t BSP_Display_WaitForEvents(uint32_t timeout)
+{
+	displayTask = osThreadGetId();
+	uint32_t events = osThreadFlagsWait(DISPLAY_EVENT_ALL, osFlagsWaitAny, timeout);
+	if (events & osFlagsError)
+		return 0;
+	// read the new touch events right away
+	if ((events & DISPLAY_EVENT_TOUCH) && touchIndev != NULL)
+	{
+		lastTouchTick = lv_tick_get();
+		lv_timer_resume(touchIndev->driver->read_timer);
+		lv_timer_ready(touchIndev->driver->read_timer);
+	}
+	// draw the new statistics once the screens show them, instead of at the next refresh period of LVGL
+	if (events & DISPLAY_EVENT_STATS)
+	{
+		lv_disp_t* disp = lv_disp_get_default();
+		if (disp != NULL && disp->refr_timer != NULL)
+			lv_timer_ready(disp->refr_timer);
+	}
+	return events;
+}
+
 /**
  * @brief De-initializes the display module
  */
@@ -42,6 +42,12 @@ extern "C" {
  * 	-# <b>@ref BSP_MAX11046_Run() :</b> Performs the conversion.
  * 	-# <b>@ref BSP_MAX11046_Stop() :</b> Stops the ADC data collection module, only effective for ADC_MODE_CONT.
  * 	-# <b>@ref BSP_MAX11046_SetInputOutputTrigger() :</b> Sets the input and output trigger functions for the ADC.
+ * 	-# <b>@ref BSP_MAX11046_SetTriggerDelay() :</b> Sets the delay between the input trigger event and the start of conversion.
+ * 	-# <b>@ref BSP_MAX11046_UpdateInputOutputTrigger() :</b> Sets the input and output trigger functions without stopping the conversions.
+ * 	-# <b>@ref BSP_MAX11046_SetProtectionLimits() :</b> Sets the trip limits of a channel for the protection.
+ * 	-# <b>@ref BSP_MAX11046_EnableProtection() :</b> Enables or disables the protection of the channels.
+ * 	-# <b>@ref BSP_MAX11046_ResetProtection() :</b> Re-arms the protection by clearing the tripped channels.
+ * 	-# <b>@ref BSP_MAX11046_GetProtectionStats() :</b> Gets the trip information of the protection.
  * @{
  */
 /********************************************************************************
@@ -106,6 +112,49 @@ extern void BSP_MAX11046_DeInit(void);
  * @return timer_trigger_src_t Trigger source if configuration required as master else returns NULL.
  */
 extern timer_trigger_src_t BSP_MAX11046_SetInputOutputTrigger(tim_in_trigger_config_t* _slaveConfig, tim_out_trigger_config_t* _masterConfig, float _fs);
+/**
+ * @brief Sets the delay between the input trigger event and the start of conversion.
+ * @details The delay is applied by the next call to @ref BSP_MAX11046_SetInputOutputTrigger() or
+ * @ref BSP_MAX11046_UpdateInputOutputTrigger(). It is only effective if an input trigger is configured.
+ * @param delayInUsec Delay in micro-seconds. Should be less than the sampling period.
+ */
+extern void BSP_MAX11046_SetTriggerDelay(float delayInUsec);
+/**
+ * @brief Sets the input and output trigger functions for the ADC without stopping the conversions.
+ * @details In continuous mode the configuration is applied by the conversion interrupt just after the current
+ * conversion completes and the new period is loaded on the next timer update event.
+ * @note Can be called from the ADC callback. A request not yet applied is replaced by the new one.
+ * @param _slaveConfig Configuration for the slave. Send NULL if no slave functionality needed.
+ * @param _masterConfig Configuration for the master. Send NULL if no master functionality needed.
+ * @param _fs Required sampling frequency of the ADC converter
+ * @return timer_trigger_src_t Trigger source if configuration required as master else returns NULL.
+ */
+extern timer_trigger_src_t BSP_MAX11046_UpdateInputOutputTrigger(tim_in_trigger_config_t* _slaveConfig, tim_out_trigger_config_t* _masterConfig, float _fs);
+#if EN_ADC_PROTECTION
+/**
+ * @brief Sets the trip limits of a channel for the protection.
+ * @note Can be called from the ADC callback. The limits are disabled by @ref BSP_MAX11046_Init().
+ * @param channelIndex ADC channel index. Should be valid.
+ * @param lower The channel trips if its value is below this limit
+ * @param upper The channel trips if its value is above this limit
+ */
+extern void BSP_MAX11046_SetProtectionLimits(int channelIndex, float lower, float upper);
+/**
+ * @brief Enables or disables the comparison of the channels against their limits after each conversion.
+ * @param pwmMask PWM channels to be disabled on a trip, as for @ref BSP_PWMOut_Enable()
+ * @param en <c>true</c> if needs to be enabled else <c>false</c>
+ */
+extern void BSP_MAX11046_EnableProtection(uint32_t pwmMask, bool en);
+/**
+ * @brief Re-arms the protection by clearing the tripped channels.
+ */
+extern void BSP_MAX11046_ResetProtection(void);
+/**
+ * @brief Gets the trip information of the protection.
+ * @param stats Structure to be filled.
+ */
+extern void BSP_MAX11046_GetProtectionStats(adc_protection_stats_t* stats);
+#endif
 /********************************************************************************
  * Code
  *******************************************************************************/
@@ -722,7 +722,13 @@ extern "C" {
 /********************************************************************************
  * Typedefs
  *******************************************************************************/
-
+/**
+ * @brief Receives the touch events decoded from the T100 messages
+ * @param isPressed <c>true</c> if the touch is detected at the position else <c>false</c> if it is released.
+ * @param x Horizontal position of the touch.
+ * @param y Vertical position of the touch.
+ */
+typedef void (*mxt_touch_callback_t)(bool isPressed, uint16_t x, uint16_t y);
 /********************************************************************************
  * Structures
  *******************************************************************************/
@@ -873,6 +879,19 @@ extern uint16_t MXTDrivers_Init(uint16_t ts_SizeX, uint16_t ts_SizeY);
  * @return <c>true</c> if touch screen pressed else <c>false</c>
  */
 extern bool MXTDrivers_GetState(uint16_t* x, uint16_t* y);
+/**
+ * @brief Read the pending messages of the controller and process them.
+ * @details The message count (T44) and the first message (T5) are read together, followed by a single read of the
+ * remaining messages. The touch events of the T100 messages are reported to the touch callback.
+ * @param maxCount Maximum no of messages to read, the rest stays pending in the controller. 0 for no limit.
+ * @return No of processed messages if successful else a negative value.
+ */
+extern int MXTDrivers_ReadMessages(uint8_t maxCount);
+/**
+ * @brief Set the callback receiving the touch events of the processed messages.
+ * @param callback Touch callback. NULL if not required.
+ */
+extern void MXTDrivers_SetTouchCallback(mxt_touch_callback_t callback);
 /********************************************************************************
  * Code
  *******************************************************************************/
@@ -42,6 +42,18 @@ extern "C" {
  * These messages are used to update settings and parameter values in the CM7 core.
  * These values cannot be directly updated in the registers because they are critical for the
  * control system and cannot be changed without a specific control sequence from the CM7 core.
+ *
+ * Multiple register writes and reads can be combined in a single transaction (@ref p2p_txn_t), which is
+ * posted as one @ref MSG_TRANSACTION message and processed by the CM7 core in a single pass. The CM7 core
+ * signals the completion of the messages by releasing the hardware semaphore @ref P2P_COMMS_HSEM_ID, which
+ * interrupts the CM4 core, so the waiting task is woken up immediately instead of polling for the response.
+ * Use @ref P2PComms_Transaction_Blocking() to wait for the completion or @ref P2PComms_Transaction_Async() to
+ * get a callback on completion.
+ *
+ * The data buffers are written by the CM7 core inside update sections (@ref P2PComms_BeginUpdate(),
+ * @ref P2PComms_EndUpdate()) which advance the sequence counters of @ref p2p_data_sync_t. Readers on the
+ * other core use @ref P2PComms_TakeSnapshot() to get a consistent copy of all registers, which is only
+ * refreshed if the sequence advanced, along with a mask of the data types changed since their last copy.
  * @{
  */
 /*******************************************************************************
@@ -52,7 +64,40 @@ extern "C" {
 /*******************************************************************************
  * Defines
  ******************************************************************************/
-
+/** @addtogroup P2PComms_Exported_Macros
+ * @{
+ */
+#ifndef P2P_COMMS_HSEM_ID
+/**
+ * @brief Hardware semaphore used by the CM7 core to notify the CM4 core about the completed messages.
+ * @note Semaphore 0 is used during the boot sequence.
+ */
+#define P2P_COMMS_HSEM_ID					(1U)
+#endif
+/**
+ * @brief Interrupt priority of the completion notification in the CM4 core.
+ * @note Should not be higher than the maximum priority allowed for the RTOS calls.
+ */
+#define P2P_COMMS_DOORBELL_IRQ_PRIORITY		(5)
+/**
+ * @brief Maximum number of items in a single transaction.
+ */
+#define P2P_COMMS_TXN_MAX_ITEMS				(32)
+/**
+ * @brief Thread flag used to wake up the tasks waiting for the completion of a transaction.
+ */
+#define P2P_COMMS_TXN_THREAD_FLAG			(1UL << 30)
+/**
+ * @brief Bit of a data type (@ref base_data_type_t) in the masks of changed data types.
+ */
+#define P2P_DATA_GROUP(dtype)				(1UL << (dtype))
+/**
+ * @brief Mask containing all data types.
+ */
+#define P2P_DATA_GROUP_ALL					((1UL << DTYPE_COUNT) - 1)
+/**
+ * @}
+ */
 /*******************************************************************************
  * Typedefs
  ******************************************************************************/
@@ -83,6 +128,7 @@ typedef enum
 	MSG_GET_U32,      /**< Message to get uint32_t parameter value */
 	MSG_GET_S32,      /**< Message to get int32_t parameter value */
 	MSG_GET_FLOAT,    /**< Message to get single precision parameter value */
+	MSG_TRANSACTION = 60,/**< Message containing multiple set and get items. See @ref p2p_txn_t */
 } p2p_msg_type_t;
 /**
  * @brief Defines types of bits management
@@ -130,12 +176,33 @@ typedef struct
 	float floats[P2P_FLOAT_COUNT];				/*!< Contains all shared single precisions variables */
 	uint32_t bitAccess[P2P_BIT_ACCESS_COUNT];	/*!< Contains all shared bit accessible registers */
 } p2p_data_buffs_t;
+/**
+ * @brief Defines the sequence counters for the consistent reads of @ref p2p_data_buffs_t.
+ * @note Only updated by the CM7 core.
+ */
+typedef struct
+{
+	volatile uint32_t seq;						/*!< Advanced at the end of each update section */
+	volatile uint32_t writers;					/*!< Number of open update sections */
+	volatile uint32_t groupSeq[DTYPE_COUNT];	/*!< Sequence at which each data type was last updated */
+} p2p_data_sync_t;
+/**
+ * @brief Defines a consistent copy of the shared data buffers.
+ * @note Initialize with zeros. The first call of @ref P2PComms_TakeSnapshot() copies all data types.
+ */
+typedef struct
+{
+	p2p_data_buffs_t data;						/*!< Copy of the shared data buffers */
+	uint32_t seq;								/*!< Sequence of the data at the time of the copy */
+	bool isValid;								/*!< <c>true</c> once the first copy is taken */
+} p2p_data_snapshot_t;
 /**
  * @brief Defines the processor to processor messaging data.
  */
 typedef struct
 {
 	p2p_data_buffs_t dataBuffs;							/*!< Shared data buffers for both processors */
+	p2p_data_sync_t dataSync;							/*!< Sequence counters of the shared data buffers */
 	ring_buffer_t msgsRingBuff;							/*!< Ring buffer keeping message buffer info */
 	ring_buffer_t cmdsRingBuff;							/*!< Ring buffer keeping command buffer info */
 	ring_buffer_t responseRingBuff;						/*!< Ring buffer keeping response buffer info */
@@ -143,6 +210,33 @@ typedef struct
 	data_union_t cmds[P2P_COMMS_CMD_BUFF_SIZE];			/*!< Command buffer */
 	data_union_t response[P2P_COMMS_RESPONSE_BUFF_SIZE];/*!< Response buffer */
 } p2p_msg_data_t;
+/**
+ * @brief Defines a single register access in a transaction.
+ */
+typedef struct
+{
+	p2p_msg_type_t type;			/*!< Set or get message type for the register. @ref MSG_TRANSACTION is not allowed */
+	uint8_t index;					/*!< Register index */
+	data_union_t value;				/*!< Value for the set messages. Updated with the register value for the get messages */
+	device_err_t err;				/*!< Result of the access. Updated on completion */
+} p2p_txn_item_t;
+/**
+ * @brief Defines a transaction carrying multiple register accesses in a single message.
+ * @details The transaction and its items are owned by the caller and should stay valid till completion.
+ * In the shared command buffer each item takes two entries, the first containing the message type in the
+ * lowest byte and the register index in the next byte and the second containing the value. The response
+ * contains the error followed by the value for each item.
+ */
+typedef struct _p2p_txn_t
+{
+	p2p_txn_item_t* items;			/*!< Register accesses to be processed in order */
+	int count;						/*!< Number of items. Should not exceed @ref P2P_COMMS_TXN_MAX_ITEMS */
+	void (*Callback)(struct _p2p_txn_t* txn);/*!< Called on completion from the interrupt context. Can be NULL */
+	void* arg;						/*!< User argument for the callback */
+	volatile bool isComplete;		/*!< <c>true</c> when the response is available */
+	device_err_t err;				/*!< First error in the items. Updated on completion */
+	void* waiter;					/*!< Internal. Task waiting for the completion */
+} p2p_txn_t;
 /**
  * @}
  */
@@ -169,6 +263,17 @@ extern data_param_info_t p2pCommsParams[P2P_PARAM_COUNT];
 /** @defgroup P2PComms_Exported_Functions Functions
  * @{
  */
+#if IS_COMMS_CORE || IS_STORAGE_CORE
+/**
+ * @brief Copy the shared data buffers if they were updated since the last copy.
+ * @details The copy is retried till no update section of the CM7 core overlaps with it. Only the data types
+ * updated since the last copy are copied.
+ * @note Only available on the CM4 core as the CM7 core can't wait for its own update sections.
+ * @param snapshot Snapshot to be refreshed.
+ * @return Mask of the data types updated since the last copy (See @ref P2P_DATA_GROUP()). Zero if nothing changed.
+ */
+extern uint32_t P2PComms_TakeSnapshot(p2p_data_snapshot_t* snapshot);
+#endif
 #if IS_COMMS_CORE
 /**
  * @brief Update a parameter in control.
@@ -180,6 +285,40 @@ extern data_param_info_t p2pCommsParams[P2P_PARAM_COUNT];
  * @return device_err_t If successful <c>ERR_OK</c> else some other error.
  */
 extern device_err_t P2PComms_SingleUpdateRequest_Blocking(p2p_msg_type_t type, uint8_t index, data_union_t value);
+/**
+ * @brief Enable the completion notification from the CM7 core.
+ * @note Call once after HAL_Init(). Without the notification the completions are polled every tick.
+ */
+extern void P2PComms_InitDoorbell(void);
+/**
+ * @brief Post a transaction and wait for its completion.
+ * @note The calling task sleeps till the CM7 core completes the transaction. @ref p2p_txn_t.Callback is not used.
+ * @param txn Transaction to be processed.
+ * @return device_err_t <c>ERR_OK</c> if all items are successful, the first error of the items or
+ * <c>ERR_ILLEGAL</c> if the transaction is invalid.
+ */
+extern device_err_t P2PComms_Transaction_Blocking(p2p_txn_t* txn);
+/**
+ * @brief Post a transaction without waiting for its completion.
+ * @note @ref p2p_txn_t.Callback is called from the interrupt context on completion. Poll
+ * @ref p2p_txn_t.isComplete if no callback is provided.
+ * @param txn Transaction to be processed.
+ * @return device_err_t <c>ERR_OK</c> if posted, <c>ERR_NOT_AVAILABLE</c> if the message buffers are full or
+ * <c>ERR_ILLEGAL</c> if the transaction is invalid.
+ */
+extern device_err_t P2PComms_Transaction_Async(p2p_txn_t* txn);
+/**
+ * @brief Complete the transactions processed by the CM7 core.
+ * @note Called by the completion notification interrupt. Interrupts should be disabled if called from elsewhere.
+ */
+extern void P2PComms_ProcessCompletedTransactions(void);
+/**
+ * @brief This function is called by @ref P2PComms_ProcessCompletedTransactions() when the completed transactions
+ * have updated some parameters, e.g. to store the new states.
+ * @note Called from the interrupt context. A weak implementation of this function is provided. User can create a
+ * custom implementation if needed.
+ */
+extern void P2PComms_ParametersUpdatedCallback(void);
 /**
  * @brief Validates that the parameter is valid.
  * @note A weak implementation of this function is provided. User can create a custom implementation if needed.
@@ -310,6 +449,30 @@ extern device_err_t P2PComms_ClearBits(uint8_t index, uint8_t value);
  * @return device_err_t If successful <c>ERR_OK</c> else some other error.
  */
 extern device_err_t P2PComms_ToggleBits(uint8_t index, uint8_t value);
+/**
+ * @brief Start a section updating the shared data buffers.
+ * @details Readers don't copy the data while any section is open, so multiple registers updated in a
+ * single section are always seen together. Sections can be nested and can be used in the interrupts.
+ * Keep the sections short as the readers retry till all of them are closed.
+ */
+extern void P2PComms_BeginUpdate(void);
+/**
+ * @brief End the section started with @ref P2PComms_BeginUpdate().
+ * @param groups Mask of the data types updated in the section (See @ref P2P_DATA_GROUP()).
+ */
+extern void P2PComms_EndUpdate(uint32_t groups);
+/**
+ * @brief Write a boolean register from the control code and signal the readers if it changed.
+ * @param index Register index.
+ * @param value Desired value.
+ */
+extern void P2PComms_WriteBool(uint8_t index, bool value);
+/**
+ * @brief Write a single-precision floating register from the control code and signal the readers if it changed.
+ * @param index Register index.
+ * @param value Desired value.
+ */
+extern void P2PComms_WriteFloat(uint8_t index, float value);
 /**
  * @brief Process the pending request for interprocessor communications.
  * @note Call this function frequently to make sure that interprocessor communications work flawlessly.
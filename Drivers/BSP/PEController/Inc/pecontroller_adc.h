@@ -39,6 +39,8 @@ extern "C" {
 #include "general_header.h"
 #include "adc_config.h"
 #include "error_config.h"
+#include "capture_format.h"
+#include "pecontroller_adc_protection.h"
 #if IS_CONTROL_CORE
 #include "pecontroller_timers.h"
 #endif
@@ -53,6 +55,11 @@ extern "C" {
 #define LOCAL_ADC_STORAGE_COUNT				(32)
 #endif
 #define EN_DMA_ADC_DATA_COLLECTION			(IS_DMA_ADC_DATA_COLLECTION_SUPERIOR)
+/**
+ * @brief The protection of the ADC channels disables the PWM outputs, so it is only available if the conversions
+ * are done by the core generating the PWM outputs.
+ */
+#define EN_ADC_PROTECTION					(IS_ADC_CORE && IS_CONTROL_CORE)
 /********************************************************************************
  * Typedefs
  *******************************************************************************/
@@ -88,7 +95,20 @@ typedef struct
 {
 	float fs;							/**< @brief Sampling Frequency for the ADC */
 	adcMeauresDataCallback callback;	/**< @brief Callback function called when results are ready */
+	float monitoringFs;					/**< @brief Rate of the records stored in @ref adc_processed_data_t and @ref adc_raw_data_t.
+											The records are decimated from fs if this is lower than fs. Set 0 to store all records */
 } adc_cont_config_t;
+/**
+ * @brief Trip information of the protection of the ADC channels
+ */
+typedef struct
+{
+	uint32_t tripMask;					/**< @brief Channels tripped since the protection was last reset. Bit 0 represents the first channel */
+	uint32_t tripCount;					/**< @brief No of samples with tripped channels since the initialization */
+	uint32_t latencyCycles;				/**< @brief CPU cycles from the entry of the conversion interrupt till the PWM outputs
+											are disabled, for the last sample tripping new channels */
+	uint32_t maxLatencyCycles;			/**< @brief Maximum value of <b>latencyCycles</b> since the initialization */
+} adc_protection_stats_t;
 
 /**
  * @}
@@ -180,6 +200,65 @@ extern void BSP_ADC_DeInit(void);
  * @return timer_trigger_src_t Trigger source if configuration required as master else returns NULL.
  */
 extern timer_trigger_src_t BSP_ADC_SetInputOutputTrigger(tim_in_trigger_config_t* _slaveConfig, tim_out_trigger_config_t* _masterConfig, float _fs);
+/**
+ * @brief Sets the delay between the input trigger event and the start of conversion.
+ * @details The delay is applied by the next call to @ref BSP_ADC_SetInputOutputTrigger() or
+ * @ref BSP_ADC_UpdateInputOutputTrigger(). It is only effective if an input trigger is configured.
+ * Use @ref BSP_TimerSync_Apply() to compute the delay from the required sampling instant.
+ * @param delayInUsec Delay in micro-seconds. Should be less than the sampling period.
+ */
+extern void BSP_ADC_SetTriggerDelay(float delayInUsec);
+/**
+ * @brief Sets the input and output trigger functions for the ADC without stopping the conversions.
+ * @details In continuous mode the configuration is applied by the conversion interrupt just after the current
+ * conversion completes and the new period is loaded on the next timer update event. Use this instead of
+ * stopping and restarting the ADC when switching between the monitoring and control modes.
+ * @note Can be called from the ADC callback. A request not yet applied is replaced by the new one.
+ * @param _slaveConfig Configuration for the slave. Send NULL if no slave functionality needed.
+ * @param _masterConfig Configuration for the master. Send NULL if no master functionality needed.
+ * @param _fs Required sampling frequency of the ADC converter
+ * @return timer_trigger_src_t Trigger source if configuration required as master else returns NULL.
+ */
+extern timer_trigger_src_t BSP_ADC_UpdateInputOutputTrigger(tim_in_trigger_config_t* _slaveConfig, tim_out_trigger_config_t* _masterConfig, float _fs);
+#endif
+#if EN_ADC_PROTECTION
+/**
+ * @brief Sets the trip limits of a channel for the protection.
+ * @details The limits are disabled by @ref BSP_ADC_Init(). Use @ref ADC_PROTECTION_NO_LOWER_LIMIT or
+ * @ref ADC_PROTECTION_NO_UPPER_LIMIT to disable one side of the channel.
+ * @note Can be called from the ADC callback. The new limits are used from the next conversion.
+ * @param _channelIndex ADC channel index
+ * @param _lower The channel trips if its value is below this limit
+ * @param _upper The channel trips if its value is above this limit
+ * @return <c>ERR_OK</c> if setting successful else @ref device_err_t.
+ */
+extern device_err_t BSP_ADC_SetProtectionLimits(int _channelIndex, float _lower, float _upper);
+/**
+ * @brief Enables or disables the protection of the ADC channels.
+ * @details When enabled all channels are compared against their limits after each conversion, before the ADC callback.
+ * If any channel trips the PWM outputs in <b>_pwmMask</b> are disabled with @ref BSP_PWMOut_DisableFromISR() in the same
+ * interrupt, and @ref BSP_ADC_ProtectionTrippedCallback() is called for the newly tripped channels.
+ * @param _pwmMask PWM channels to be disabled on a trip, as for @ref BSP_PWMOut_Enable()
+ * @param _en <c>true</c> if needs to be enabled else <c>false</c>
+ */
+extern void BSP_ADC_EnableProtection(uint32_t _pwmMask, bool _en);
+/**
+ * @brief Re-arms the protection by clearing the tripped channels.
+ * @note Call before enabling the PWM outputs again. Channels still beyond their limits trip again at the next conversion.
+ */
+extern void BSP_ADC_ResetProtection(void);
+/**
+ * @brief Gets the trip information of the protection.
+ * @param _stats Structure to be filled.
+ */
+extern void BSP_ADC_GetProtectionStats(adc_protection_stats_t* _stats);
+/**
+ * @brief This function is called by the conversion interrupt when the protection trips new channels.
+ * @details The PWM outputs configured by @ref BSP_ADC_EnableProtection() are already disabled when it is called.
+ * @note A weak implementation of this function is provided. User can create a custom implementation if needed.
+ * @param channelMask Mask of the newly tripped channels. Bit 0 represents the first channel.
+ */
+extern void BSP_ADC_ProtectionTrippedCallback(uint32_t channelMask);
 #endif
 #if IS_COMMS_CORE
 
@@ -201,8 +280,15 @@ extern device_err_t BSP_ADC_UpdateConfig(adc_info_t* _info, float _fs, int _chan
  * @brief Call this function periodically to compute the statistics of the signals
  * @param _processedAdcData Pointer to the processed data structure.
  * @param _fs Sampling frequency of the ADC.
+ * @return Mask of the channels with updated statistics. Bit 0 represents the first channel.
  */
-extern void BSP_ADC_ComputeStatsInBulk(adc_processed_data_t* _processedAdcData, float _fs);
+extern uint32_t BSP_ADC_ComputeStatsInBulk(adc_processed_data_t* _processedAdcData, float _fs);
+/**
+ * @brief This function is called by @ref BSP_ADC_ComputeStatsInBulk() when the statistics of some channels are updated.
+ * @note A weak implementation of this function is provided. User can create a custom implementation if needed.
+ * @param channelMask Mask of the channels with updated statistics. Bit 0 represents the first channel.
+ */
+extern void BSP_ADC_StatsUpdatedCallback(uint32_t channelMask);
 #endif
 #if IS_STORAGE_CORE
 /**
@@ -212,6 +298,13 @@ extern void BSP_ADC_ComputeStatsInBulk(adc_processed_data_t* _processedAdcData,
  */
 extern void BSP_ADC_ConfigStorage(state_storage_client_t* _config);
 #endif
+/**
+ * @brief Fill the capture file header according to the current ADC configuration.
+ * @details Channels are named as Ch1 - Ch16. Overwrite the names afterwards if required.
+ * @param _header Pointer to the header to be filled.
+ * @param _info ADC information.
+ */
+extern void BSP_ADC_FillCaptureHeader(capture_file_header_t* _header, const adc_info_t* _info);
 /********************************************************************************
  * Code
  *******************************************************************************/
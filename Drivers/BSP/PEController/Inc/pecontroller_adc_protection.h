@@ -0,0 +1,164 @@
+/**
+ ********************************************************************************
+ * @file 		pecontroller_adc_protection.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Per-sample protection comparators of the ADC channels
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef PECONTROLLER_ADC_PROTECTION_H_
+#define PECONTROLLER_ADC_PROTECTION_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @addtogroup BSP
+ * @{
+ */
+
+/** @addtogroup ADC
+ * @{
+ */
+
+/** @defgroup ADCProtection Protection Kernel
+ * @brief Compares the converted ADC channels against the upper and lower trip limits of each channel.
+ * @details The comparisons of all channels are evaluated without branches and packed into a trip mask, so the
+ * cost of the check is the same for every sample, tripped or not, and the loop can be unrolled or vectorized by the
+ * compiler. A channel trips if its value is above the upper limit or below the lower limit. Values equal to a limit
+ * don't trip.
+ *
+ * Disabled limits are set to <c>+/-FLT_MAX</c> instead of infinity, as the conversion interrupt is compiled with
+ * <c>-Ofast</c>, which assumes finite values.
+ * @{
+ */
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdint.h>
+#include <float.h>
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+// save diagnostic state
+#pragma GCC diagnostic push
+// turn off the specific warning. Can also use "-Wall"
+#pragma GCC diagnostic ignored "-Wunused-function"
+/** @defgroup ADCPROTECTION_Exported_Macros Macros
+  * @{
+  */
+/**
+ * @brief No of channels compared by the protection
+ */
+#define ADC_PROTECTION_CHANNEL_COUNT		(16)
+/**
+ * @brief Upper limit of a channel without upper protection
+ */
+#define ADC_PROTECTION_NO_UPPER_LIMIT		(FLT_MAX)
+/**
+ * @brief Lower limit of a channel without lower protection
+ */
+#define ADC_PROTECTION_NO_LOWER_LIMIT		(-FLT_MAX)
+/**
+ * @}
+ */
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/** @defgroup ADCPROTECTION_Exported_Structures Structures
+  * @{
+  */
+/**
+ * @brief Trip limits of the ADC channels
+ * @note The limits are kept in separate arrays so the comparisons of consecutive channels use consecutive memory.
+ */
+typedef struct
+{
+	float upper[ADC_PROTECTION_CHANNEL_COUNT];		/**< @brief A channel trips if its value is above this limit */
+	float lower[ADC_PROTECTION_CHANNEL_COUNT];		/**< @brief A channel trips if its value is below this limit */
+} adc_protection_limits_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+/** @defgroup ADCPROTECTION_Exported_Functions Functions
+  * @{
+  */
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Disable the upper and lower limits of all channels.
+ * @param limits Limits to be reset.
+ */
+static inline void ADCProtection_ResetLimits(adc_protection_limits_t* limits)
+{
+	for (int i = 0; i < ADC_PROTECTION_CHANNEL_COUNT; i++)
+	{
+		limits->upper[i] = ADC_PROTECTION_NO_UPPER_LIMIT;
+		limits->lower[i] = ADC_PROTECTION_NO_LOWER_LIMIT;
+	}
+}
+
+/**
+ * @brief Compare all channels of a sample against their limits.
+ * @param data Converted values of the channels.
+ * @param limits Limits of the channels.
+ * @return Mask of the tripped channels. Bit 0 represents the first channel.
+ */
+static inline __attribute__((always_inline)) uint32_t ADCProtection_GetTrips(const float* data, const adc_protection_limits_t* limits)
+{
+	// bits of the channels in a table instead of shifting by the channel index, so the loop can be vectorized
+	static const uint32_t channelBits[ADC_PROTECTION_CHANNEL_COUNT] =
+	{
+			0x0001, 0x0002, 0x0004, 0x0008, 0x0010, 0x0020, 0x0040, 0x0080,
+			0x0100, 0x0200, 0x0400, 0x0800, 0x1000, 0x2000, 0x4000, 0x8000,
+	};
+	uint32_t trips = 0;
+	for (int i = 0; i < ADC_PROTECTION_CHANNEL_COUNT; i++)
+		trips |= channelBits[i] & -(uint32_t)((data[i] > limits->upper[i]) | (data[i] < limits->lower[i]));
+	return trips;
+}
+/**
+ * @}
+ */
+// restore diagnostic state
+#pragma GCC diagnostic pop
+/**
+ * @}
+ */
+/**
+ * @}
+ */
+/**
+ * @}
+ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */
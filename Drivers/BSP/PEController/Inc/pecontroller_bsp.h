@@ -107,6 +107,10 @@ extern "C" {
 #define MAX11046_GPIO GPIOF
 #define ADC_TIMER TIM12
 #define MAX11046_CLK_Us	240					// --todo-- configure 240 seperately
+/**
+ * @brief Time between the start of conversion and the availability of the results for the MAX11046 in micro-seconds
+ */
+#define MAX11046_CONVERSION_TIME_Us				(3.f)
 
 /*********** Device Constants **************/
 /**
@@ -134,6 +138,10 @@ extern "C" {
  * @brief Select the core analog to digital conversion.
  */
 #define IS_ADC_STATS_CORE						(defined(CORE_CM4))
+/**
+ * @brief Select the core whose FreeRTOS tasks are monitored by the task telemetry.
+ */
+#define IS_TASK_TELEMETRY_CORE					(defined(CORE_CM4))
 /**
  * @brief Compute the statistics of the ADC in bulk.
  */
@@ -84,6 +84,47 @@ extern "C" {
  * @brief Display format used by the lvgl layer in LTDC
  */
 #define RAM_PIXEL_FORMAT			(LTDC_PIXEL_FORMAT_L8)
+#ifndef DISPLAY_SYNC_FLUSH
+/**
+ * @brief Synchronize the flush of the LVGL areas with the scan of the LTDC to avoid tearing.
+ * @details The flush waits till the scan line is out of the rows of the area before writing it to the frame buffer.
+ */
+#define DISPLAY_SYNC_FLUSH			(0)
+#endif
+/**
+ * @brief Lines before an area in which the scan of the LTDC is considered inside the area by @ref DISPLAY_SYNC_FLUSH
+ */
+#define DISPLAY_SYNC_GUARD_LINES	(2)
+/**
+ * @brief Longest wait in milli-seconds for a new layer configuration to be loaded in the vertical blanking
+ */
+#define DISPLAY_RELOAD_TIMEOUT_ms	(50)
+/**
+ * @brief Event of @ref BSP_Display_NotifyEvents() signaling new touch events in the queue of the touch screen
+ */
+#define DISPLAY_EVENT_TOUCH			(1UL << 0)
+/**
+ * @brief Event of @ref BSP_Display_NotifyEvents() signaling new statistics of the measurements
+ */
+#define DISPLAY_EVENT_STATS			(1UL << 1)
+/**
+ * @brief Mask of all display events
+ */
+#define DISPLAY_EVENT_ALL			(DISPLAY_EVENT_TOUCH | DISPLAY_EVENT_STATS)
+#ifndef DISPLAY_POLL_PERIOD_ms
+/**
+ * @brief Longest time between the refreshes of the screens without any event in milli-seconds.
+ * @details Bounds the delay of the values refreshed without an event, e.g. the parameters shared with the CM7 core.
+ */
+#define DISPLAY_POLL_PERIOD_ms		(100)
+#endif
+#ifndef DISPLAY_TOUCH_IDLE_ms
+/**
+ * @brief Time after the last touch in milli-seconds after which LVGL stops reading the touch screen.
+ * @details The reads are resumed by @ref DISPLAY_EVENT_TOUCH. The time covers the scrolling continuing after the release.
+ */
+#define DISPLAY_TOUCH_IDLE_ms		(1000)
+#endif
 /**
   * @}
   */
@@ -118,6 +159,19 @@ extern uint8_t frame_buff[DISPLAY_HEIGHT_RAM][DISPLAY_WIDTH_RAM];
  * @brief Initializes the display module
  */
 extern void BSP_Display_Init(void);
+/**
+ * @brief Wake the display task with the given events.
+ * @note Can be called from the interrupts. The events sent before the display task starts waiting are ignored.
+ * @param events Events to be signaled, e.g. @ref DISPLAY_EVENT_TOUCH.
+ */
+extern void BSP_Display_NotifyEvents(uint32_t events);
+/**
+ * @brief Wait for the events of the display, and prepare LVGL to handle them in the next call of lv_timer_handler().
+ * @note Call from the display task only.
+ * @param timeout Maximum time to wait in ticks, e.g. the time till the next timer of LVGL.
+ * @return Mask of the received events. 0 if the timeout elapsed.
+ */
+extern uint32_t BSP_Display_WaitForEvents(uint32_t timeout);
 /********************************************************************************
  * Code
  *******************************************************************************/
@@ -0,0 +1,197 @@
+/**
+ ********************************************************************************
+ * @file 		pecontroller_display_flush.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Conversion kernels from the LVGL draw buffer to the L8 frame buffer
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef PECONTROLLER_DISPLAY_FLUSH_H_
+#define PECONTROLLER_DISPLAY_FLUSH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @addtogroup BSP
+ * @{
+ */
+
+/** @addtogroup Display
+ * @{
+ */
+
+/** @defgroup DisplayFlush Flush Kernels
+ * @brief Converts the RGB565 pixels rendered by LVGL to the CLUT indices of the frame buffer.
+ * @details The rotation of the display is applied while writing the frame buffer, so LVGL doesn't need a separate
+ * pass for the software rotation of its draw buffer. Four converted pixels are packed in a word, so the frame buffer
+ * is written with aligned 32-bit stores instead of single bytes. The pixels are mapped with @ref color_map indexed by
+ * the RGB565 value.
+ * @{
+ */
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+// save diagnostic state
+#pragma GCC diagnostic push
+// turn off the specific warning. Can also use "-Wall"
+#pragma GCC diagnostic ignored "-Wunused-function"
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+/** @defgroup DISPLAYFLUSH_Exported_Functions Functions
+  * @{
+  */
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Map a RGB565 color to the CLUT index.
+ * @param color RGB565 color.
+ * @param map Color map used for the conversion.
+ * @return CLUT index of the color.
+ */
+static inline __attribute__((always_inline)) uint32_t DisplayFlush_MapColor(uint32_t color, const uint8_t* map)
+{
+	return map[color];
+}
+/**
+ * @brief Convert a row of pixels to CLUT indices.
+ * @param dest Pointer to the frame buffer location of the first pixel.
+ * @param src Pointer to the RGB565 pixels.
+ * @param count No of pixels in the row.
+ * @param map Color map used for the conversion.
+ */
+static inline __attribute__((always_inline)) void DisplayFlush_ConvertRow(uint8_t* dest, const uint16_t* src, uint32_t count, const uint8_t* map)
+{
+	// single pixels till the destination is word aligned
+	while (count && ((uintptr_t)dest & 3))
+	{
+		*dest++ = DisplayFlush_MapColor(*src++, map);
+		count--;
+	}
+	uint32_t* dest32 = (uint32_t*)dest;
+	for (; count >= 4; count -= 4, src += 4)
+	{
+		// source alignment is not guaranteed, memcpy compiles to unaligned word loads
+		uint32_t lo, hi;
+		memcpy(&lo, src, 4);
+		memcpy(&hi, src + 2, 4);
+		*dest32++ = DisplayFlush_MapColor(lo & 0xFFFF, map) | (DisplayFlush_MapColor(lo >> 16, map) << 8) |
+				(DisplayFlush_MapColor(hi & 0xFFFF, map) << 16) | (DisplayFlush_MapColor(hi >> 16, map) << 24);
+	}
+	dest = (uint8_t*)dest32;
+	while (count--)
+		*dest++ = DisplayFlush_MapColor(*src++, map);
+}
+/**
+ * @brief Convert a row of pixels to CLUT indices in the reverse order.
+ * @param dest Pointer to the frame buffer location of the last pixel, which is the lowest address of the row.
+ * @param src Pointer to the RGB565 pixels.
+ * @param count No of pixels in the row.
+ * @param map Color map used for the conversion.
+ */
+static inline __attribute__((always_inline)) void DisplayFlush_ConvertRowReversed(uint8_t* dest, const uint16_t* src, uint32_t count, const uint8_t* map)
+{
+	src += count;
+	// single pixels till the destination is word aligned
+	while (count && ((uintptr_t)dest & 3))
+	{
+		*dest++ = DisplayFlush_MapColor(*--src, map);
+		count--;
+	}
+	uint32_t* dest32 = (uint32_t*)dest;
+	for (; count >= 4; count -= 4)
+	{
+		src -= 4;
+		uint32_t lo, hi;
+		memcpy(&lo, src, 4);
+		memcpy(&hi, src + 2, 4);
+		*dest32++ = DisplayFlush_MapColor(hi >> 16, map) | (DisplayFlush_MapColor(hi & 0xFFFF, map) << 8) |
+				(DisplayFlush_MapColor(lo >> 16, map) << 16) | (DisplayFlush_MapColor(lo & 0xFFFF, map) << 24);
+	}
+	dest = (uint8_t*)dest32;
+	while (count--)
+		*dest++ = DisplayFlush_MapColor(*--src, map);
+}
+/**
+ * @brief Convert an area rendered by LVGL to CLUT indices in the frame buffer.
+ * @param frame Pointer to the frame buffer.
+ * @param width Width of the frame buffer in pixels.
+ * @param height Height of the frame buffer in pixels.
+ * @param x1 Left coordinate of the area before the rotation.
+ * @param y1 Top coordinate of the area before the rotation.
+ * @param x2 Right coordinate of the area before the rotation.
+ * @param y2 Bottom coordinate of the area before the rotation.
+ * @param src Pointer to the RGB565 pixels of the area.
+ * @param map Color map used for the conversion.
+ * @param isRotated180 <c>true</c> if the area should be rotated by 180 degrees in the frame buffer.
+ */
+static inline __attribute__((always_inline)) void DisplayFlush_ConvertArea(uint8_t* frame, int width, int height, int x1, int y1, int x2, int y2,
+		const uint16_t* src, const uint8_t* map, bool isRotated180)
+{
+	int count = x2 - x1 + 1;
+	if (isRotated180)
+	{
+		// last row first, so the frame buffer is written from top to bottom in the scan order of the display
+		src += (y2 - y1) * count;
+		for (int y = y2; y >= y1; y--, src -= count)
+			DisplayFlush_ConvertRowReversed(frame + (height - 1 - y) * width + (width - 1 - x2), src, count, map);
+	}
+	else
+	{
+		for (int y = y1; y <= y2; y++, src += count)
+			DisplayFlush_ConvertRow(frame + y * width + x1, src, count, map);
+	}
+}
+/**
+ * @}
+ */
+// restore diagnostic state
+#pragma GCC diagnostic pop
+/**
+ * @}
+ */
+/**
+ * @}
+ */
+/**
+ * @}
+ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */
@@ -65,6 +65,7 @@ extern "C" {
  * 		-# <b>BSP_PWM_Start:</b> Starts the PWM on required PWM pins
  * 		-# <b>BSP_PWM_Stop:</b> Stops the PWM on required PWM pins
  * 		-# <b>BSP_PWMOut_Enable:</b> Enable / disable the output for required PWM channels
+ * 		-# <b>BSP_PWMOut_DisableFromISR:</b> Disable the output for required PWM channels from an interrupt
  * 		-# <b>BSP_PWM_Config_Interrupt:</b> Enable / Disable interrupt for a PWM channel as per requirement<br>
  * @{
  */
@@ -233,6 +234,16 @@ extern void BSP_PWM_GetDefaultConfig(pwm_config_t* pwmConfig, pwm_module_config_
  * @param en <c>true</c> if needs to be enabled else <c>false</c>
  */
 extern void BSP_PWMOut_Enable(uint32_t pwmMask, bool en);
+/**
+ * @brief Disable the output for required PWM channels from an interrupt
+ * @details The registers are written directly instead of using the HAL, which returns without disabling the
+ * outputs if its handle is locked by the interrupted code. The HRTIM outputs are disabled by a single write to
+ * the ODISR register. The main output of TIM1 is disabled if any of its channels is required, so the outputs stay
+ * disabled even if the interrupted code was enabling them. Enable the outputs again with @ref BSP_PWMOut_Enable().
+ * @param pwmMask Set the PWM channels needed to be disabled.<br>
+ * 				<b>Valid Range</b> =  (0x0001 - 0xffff)
+ */
+extern void BSP_PWMOut_DisableFromISR(uint32_t pwmMask);
 /*******************************************************************************
  * Code
  ******************************************************************************/
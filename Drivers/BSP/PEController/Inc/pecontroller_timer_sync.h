@@ -0,0 +1,232 @@
+/**
+ ********************************************************************************
+ * @file 		pecontroller_timer_sync.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Declarative description of the timer synchronization graph
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef PECONTROLLER_TIMER_SYNC_H_
+#define PECONTROLLER_TIMER_SYNC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @addtogroup BSP
+ * @{
+ */
+
+/** @addtogroup Timers
+ * @{
+ */
+
+/** @defgroup TimerSync Timer Synchronization
+ * @brief Describes the synchronization between the timers as a graph and applies it in one call.
+ * @details Each node of the graph is a timer (or timer chain) which follows the trigger output of another node
+ * as described by its @ref tim_in_trigger_config_t. The following nodes are available.
+ * -# <b>TIM1:</b> Reference PWM timer. It is configured by the PWM drivers through pwm_config_t.slaveOpts and
+ * pwm_config_t.masterOpts, so the node only describes it for validation and timing.
+ * -# <b>HRTIM Master:</b> Configured using @ref BSP_MasterHRTIM_Config(). Can only follow TIM1.
+ * -# <b>Fiber Rx (TIM2):</b> Configured using @ref BSP_TIM2_ConfigFiberRx(). Follows the Fiber/Sync Rx pin.
+ * -# <b>Fiber Tx (TIM3):</b> Configured using @ref BSP_TIM3_ConfigFiberTx(). Its trigger output can be delayed.
+ * -# <b>ADC:</b> Conversion timer chain of the ADC configured using @ref BSP_ADC_UpdateInputOutputTrigger().
+ * The start of conversion is placed relative to its source according to @ref tim_sync_placement_t.
+ *
+ * @ref BSP_TimerSync_Validate() checks the graph and computes the timing of each node relative to the root of its
+ * chain without touching the hardware, so it can also be used on the PC to review a configuration.
+ * @ref BSP_TimerSync_Apply() validates the graph and configures all the nodes. The timers are started by the
+ * relevant start functions as before.
+ * @{
+ */
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include "general_header.h"
+#include "pecontroller_timers.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** @defgroup TimerSync_Exported_Macros Macros
+ * @{
+ */
+/**
+ * @brief Maximum sampling frequency of the ADC in Hz
+ */
+#define TIM_SYNC_ADC_MAX_FREQUENCY_Hz			(100000)
+/**
+ * @brief Clock frequency of the general purpose timers in Hz
+ */
+#define TIM_SYNC_TIMER_CLOCK_Hz					(240000000)
+/**
+ * @}
+ */
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+/** @defgroup TimerSync_Exported_Typedefs Type Definitions
+ * @{
+ */
+/**
+ * @brief Nodes of the synchronization graph
+ */
+typedef enum
+{
+	TIM_SYNC_NODE_TIM1,				/**< Reference PWM timer. Trigger source @ref TIM_TRG_SRC_TIM1 */
+	TIM_SYNC_NODE_HRTIM_MASTER,		/**< Master timer of the HRTIM. Trigger source @ref TIM_TRG_SRC_HRTIM_MASTER_PERIOD */
+	TIM_SYNC_NODE_FIBER_RX,			/**< Fiber/Sync Rx timer (TIM2). Trigger source @ref TIM_TRG_SRC_TIM2 */
+	TIM_SYNC_NODE_FIBER_TX,			/**< Fiber/Sync Tx timer (TIM3). Trigger source @ref TIM_TRG_SRC_TIM3 */
+	TIM_SYNC_NODE_ADC,				/**< ADC conversion timers. Trigger source @ref TIM_TRG_SRC_TIM4 */
+	TIM_SYNC_NODE_COUNT,			/**< Not a node. Use this to get the total number of nodes. */
+} tim_sync_node_t;
+/**
+ * @brief Placement rules for the start of conversion of the ADC
+ * @details For the rules referring to the source period the data is ready at the required instant, so the
+ * conversion starts @ref MAX11046_CONVERSION_TIME_Us before it. For center aligned PWMs synchronized by their update
+ * event both the center and the end of the period are away from the switching instants.
+ * tim_sync_graph_t.sampleOffsetInUsec is added to the computed instant in all cases.
+ */
+typedef enum
+{
+	TIM_SYNC_SAMPLE_AT_TRIGGER,			/**< Start the conversion at the trigger event of the source */
+	TIM_SYNC_SAMPLE_DATA_AT_CENTER,		/**< Data ready at the center of the source period */
+	TIM_SYNC_SAMPLE_DATA_AT_END,		/**< Data ready at the end of the source period */
+} tim_sync_placement_t;
+/**
+ * @brief Issues detected while validating the graph
+ */
+typedef enum
+{
+	TIM_SYNC_OK,						/**< The graph is valid */
+	TIM_SYNC_ERR_FREQUENCY,				/**< Frequency of the node is out of the range of its timer */
+	TIM_SYNC_ERR_SOURCE,				/**< The selected trigger source is not available for the node */
+	TIM_SYNC_ERR_SOURCE_DISABLED,		/**< The trigger source is a disabled node */
+	TIM_SYNC_ERR_TRIGGER_TYPE,			/**< The selected trigger type is not available for the node */
+	TIM_SYNC_ERR_LOOP,					/**< The node follows itself through other nodes */
+	TIM_SYNC_ERR_RATIO,					/**< The node is reset by its source but its frequency is not an integer multiple of the source */
+	TIM_SYNC_ERR_DELAY,					/**< The output delay is not available for the node or is longer than its period */
+	TIM_SYNC_ERR_PLACEMENT,				/**< The sampling instant can't be computed or the conversion doesn't fit in the sampling period */
+} tim_sync_issue_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/** @defgroup TimerSync_Exported_Structures Structures
+ * @{
+ */
+/**
+ * @brief Configuration of a node of the synchronization graph
+ */
+typedef struct
+{
+	bool isEnabled;						/**< @brief <c>true</c> if the node is part of the graph */
+	timer_frequency_t f;				/**< @brief Frequency of the node in Hz */
+	tim_in_trigger_config_t in;			/**< @brief Input trigger of the node. Use @ref TIM_TRG_SRC_NONE for free running nodes */
+	float outDelayInUsec;				/**< @brief Delay of the trigger output from the start of the period. Only available for @ref TIM_SYNC_NODE_FIBER_TX */
+} tim_sync_node_config_t;
+/**
+ * @brief Declarative description of the synchronization between the timers
+ */
+typedef struct
+{
+	tim_sync_node_config_t nodes[TIM_SYNC_NODE_COUNT];	/**< @brief Node configurations indexed by @ref tim_sync_node_t */
+	tim_sync_placement_t samplePlacement;				/**< @brief Placement rule for the start of conversion of the ADC */
+	float sampleOffsetInUsec;							/**< @brief Offset added to the sampling instant. Can be negative */
+} tim_sync_graph_t;
+/**
+ * @brief Timing of a node relative to the event of the root of its chain
+ */
+typedef struct
+{
+	bool isEnabled;						/**< @brief <c>true</c> if the node is part of the graph */
+	bool isLocked;						/**< @brief <c>true</c> if the node is reset by the root in each period. Nodes started once drift with the clock tolerance */
+	tim_sync_node_t root;				/**< @brief First node of the chain. Same as the node for free running nodes */
+	float periodInUsec;					/**< @brief Period of the node */
+	float startInUsec;					/**< @brief Start of the first period of the node */
+	float eventInUsec;					/**< @brief First trigger output or start of conversion for the ADC */
+} tim_sync_timing_t;
+/**
+ * @brief Result of the validation of a graph
+ */
+typedef struct
+{
+	tim_sync_issue_t issue;							/**< @brief First issue detected */
+	tim_sync_node_t node;							/**< @brief Node having the issue */
+	tim_sync_timing_t timing[TIM_SYNC_NODE_COUNT];	/**< @brief Timing of the nodes. Valid only if no issue is detected */
+	float adcDelayInUsec;							/**< @brief Delay between the trigger event of the ADC source and the start of conversion */
+	float adcDataReadyInUsec;						/**< @brief Instant when the first conversion results are ready */
+	uint32_t adcSamplesPerTrigger;					/**< @brief Number of conversions between two trigger events of the ADC source */
+} tim_sync_report_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+/** @defgroup TimerSync_Exported_Functions Functions
+ * @{
+ */
+/**
+ * @brief Get the trigger source generated by a node.
+ * @param node Node of the graph.
+ * @return Trigger source used by the nodes following this node.
+ */
+extern timer_trigger_src_t BSP_TimerSync_GetNodeSource(tim_sync_node_t node);
+/**
+ * @brief Validate the graph and compute the timing of the nodes.
+ * @note Doesn't access the hardware.
+ * @param graph Synchronization graph.
+ * @param report Filled with the first issue and the timing of the nodes.
+ * @return <c>true</c> if the graph is valid else <c>false</c>.
+ */
+extern bool BSP_TimerSync_Validate(const tim_sync_graph_t* graph, tim_sync_report_t* report);
+/**
+ * @brief Validate the graph and configure all the nodes except @ref TIM_SYNC_NODE_TIM1.
+ * @details Nothing is configured if the graph is invalid. The ADC triggers are changed using
+ * @ref BSP_ADC_UpdateInputOutputTrigger() so the conversions keep running if already started.
+ * @param graph Synchronization graph.
+ * @param report Filled with the first issue and the timing of the nodes. Can be NULL.
+ * @return <c>true</c> if the graph is valid and applied else <c>false</c>.
+ */
+extern bool BSP_TimerSync_Apply(const tim_sync_graph_t* graph, tim_sync_report_t* report);
+/**
+ * @}
+ */
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+
+
+/**
+ * @}
+ */
+/**
+ * @}
+ */
+#ifdef __cplusplus
+}
+#endif
+/**
+ * @}
+ */
+#endif
+/* EOF */
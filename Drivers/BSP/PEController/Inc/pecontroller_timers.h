@@ -57,6 +57,9 @@ extern "C" {
  * configuring them as slaves. @ref BSP_TIM3_FiberTxStart() starts the TIM3 with optional synching of HRTIM.
  * -# <b>Other timers: </b> Use @ref BSP_Timer_SetInputTrigger() and @ref BSP_Timer_SetOutputTrigger() to set the trigger
  * characteristics of other timers.
+ *
+ * The complete synchronization between these timers, the PWMs and the ADC can also be described as a graph and
+ * validated and applied in one call using @ref TimerSync.
  * @{
  */
 /********************************************************************************
@@ -57,6 +57,55 @@ extern "C" {
 #define TS_SWAP_X                       ((uint8_t) 0x02)
 #define TS_SWAP_Y                       ((uint8_t) 0x04)
 #define TS_SWAP_XY                      ((uint8_t) 0x08)
+/** @defgroup BSPTS_Exported_Macros Macros
+  * @{
+  */
+#ifndef TS_IRQ_MODE
+/**
+ * @brief Read the messages of the touch screen controller when it asserts the CHG line, instead of polling it.
+ * @details The touch task sleeps in @ref BSP_TS_WaitAndProcess() till the EXTI interrupt of the CHG line. The messages
+ * are then read with DMA transfers on I2C2, during which the task sleeps as well. When disabled, the touch task
+ * should call @ref BSP_TS_Poll() periodically, which reads the messages with blocking transfers.
+ */
+#define TS_IRQ_MODE						(1)
+#endif
+/**
+ * @brief No of touch events buffered for @ref BSP_TS_GetEvent(). Should be a power of 2.
+ */
+#define TS_EVENT_QUEUE_SIZE				(16)
+/**
+ * @brief Time in milli-seconds after which the touch task checks again for space in a full event queue
+ */
+#define TS_QUEUE_FULL_DELAY_ms			(5)
+/**
+ * @brief No of consecutive reads without messages while the CHG line is asserted, after which the controller is reset
+ */
+#define TS_STUCK_READ_LIMIT				(10)
+/**
+ * @brief Longest wait of the touch task in milli-seconds for the CHG line after a read without messages while the
+ * line is asserted
+ */
+#define TS_STUCK_RETRY_DELAY_ms			(5)
+/**
+ * @brief Priority of the interrupts of the CHG line, the I2C and its DMA stream in @ref TS_IRQ_MODE
+ * @note Should not be more urgent than the configMAX_SYSCALL_INTERRUPT_PRIORITY of FreeRTOS.
+ */
+#define TS_IRQ_PRIORITY					(6)
+/**
+ * @brief Timeout of the I2C transfers in milli-seconds
+ */
+#define TS_I2C_TIMEOUT_ms				(100)
+/**
+ * @brief Thread flag used to wake up the touch task on the assertion of the CHG line.
+ */
+#define TS_CHG_THREAD_FLAG				(1UL << 28)
+/**
+ * @brief Thread flag used to wake up the touch task on the completion of a DMA transfer.
+ */
+#define TS_DMA_THREAD_FLAG				(1UL << 29)
+/**
+  * @}
+  */
 /********************************************************************************
  * Typedefs
  *******************************************************************************/
@@ -94,6 +143,20 @@ typedef struct
   uint16_t touchX;      				 /*!< Contains horizontal touch location state */
   uint16_t touchY;      				/*!< Contains vertical touch location state */
 } TS_StateTypeDef;
+/**
+ *  @brief TS_StatsTypeDef
+ *  Counters of the message processing of the touch screen controller
+ */
+typedef struct
+{
+  uint32_t interrupts;					/*!< No of assertions of the CHG line */
+  uint32_t reads;						/*!< No of I2C reads of the controller */
+  uint32_t messages;					/*!< No of processed messages */
+  uint32_t events;						/*!< No of queued touch events */
+  uint32_t droppedEvents;				/*!< No of touch events lost as the queue was full */
+  uint32_t errors;						/*!< No of failed I2C reads */
+  uint32_t recoveries;					/*!< No of resets of the controller asserting the CHG line without messages */
+} TS_StatsTypeDef;
 /**
   * @}
   */
@@ -123,6 +186,33 @@ extern TS_StateTypeDef* BSP_TS_GetState(void);
  * @brief Poll the touch screen drivers to get touch events
  */
 extern void BSP_TS_Poll(void);
+#if TS_IRQ_MODE
+/**
+ * @brief Wait till the touch screen controller has messages and process them.
+ * @details The calling task sleeps till the controller asserts the CHG line, unless it is still asserted. The messages
+ * are then read with DMA transfers and the touch events are queued for @ref BSP_TS_GetEvent().
+ * @note Call in a loop from the task which initialized the touch screen with @ref BSP_TS_Init().
+ */
+extern void BSP_TS_WaitAndProcess(void);
+#endif
+/**
+ * @brief Get the oldest touch event of the queue.
+ * @details The queue keeps the touches and releases happening between two reads of the input device, so short taps
+ * and the path of a drag are not lost.
+ * @param event Structure to be filled with the event.
+ * @return <c>true</c> if an event was available else <c>false</c>.
+ */
+extern bool BSP_TS_GetEvent(TS_StateTypeDef* event);
+/**
+ * @brief Check if touch events are queued.
+ * @return <c>true</c> if the queue has events else <c>false</c>.
+ */
+extern bool BSP_TS_IsEventPending(void);
+/**
+ * @brief Get the counters of the message processing.
+ * @param stats Structure to be filled with the counters.
+ */
+extern void BSP_TS_GetStats(TS_StatsTypeDef* stats);
 /********************************************************************************
  * Code
  *******************************************************************************/
@@ -45,6 +45,7 @@ extern "C" {
 #include "general_header.h"
 #include "adc_config.h"
 #include "p2p_comms.h"
+#include "task_telemetry.h"
 /********************************************************************************
  * Defines
  *******************************************************************************/
@@ -71,6 +72,32 @@ extern "C" {
  * @brief Shortcut for accessing data shared between CM4 and CM7 core.
  */
 #define INTER_CORE_DATA				(sharedData->p2pMsgs.dataBuffs)
+/**
+ * @brief Shortcut for accessing the sequence counters of the data shared between CM4 and CM7 core.
+ */
+#define INTER_CORE_DATA_SYNC		(sharedData->p2pMsgs.dataSync)
+/**
+ * @brief Shortcut for accessing the statistics of the tasks of the CM4 core.
+ */
+#define TASK_TELEMETRY				(sharedData->taskTelemetry)
+#ifndef SHARED_MEMORY_ADC_HSEM_ID
+/**
+ * @brief Hardware semaphore used by the ADC core to notify the CM4 core about the new records.
+ * @note Semaphore 0 is used during the boot sequence and @ref P2P_COMMS_HSEM_ID by the interprocessor communication.
+ */
+#define SHARED_MEMORY_ADC_HSEM_ID	(2U)
+#endif
+#ifndef SHARED_MEMORY_ADC_NOTIFY_COUNT
+/**
+ * @brief Number of new records in @ref PROCESSED_ADC_DATA after which the CM4 core is notified.
+ * @note Should be less than MEASURE_SAVE_COUNT, so that the records are processed before being overwritten.
+ */
+#define SHARED_MEMORY_ADC_NOTIFY_COUNT	(MEASURE_SAVE_COUNT / 2)
+#endif
+/**
+ * @brief Thread flag used to wake up the task waiting for the ADC records.
+ */
+#define SHARED_MEMORY_ADC_THREAD_FLAG	(1UL << 27)
 /**
  * @}
  */
@@ -93,6 +120,7 @@ typedef struct
 	adc_raw_data_t rawAdcData;						/**< Raw ADC data */
 	adc_processed_data_t processedAdcData;			/**< Converted ADC data */
 	p2p_msg_data_t p2pMsgs;							/**< Structure handling the parameters and commjunications between CM4 and CM7 core. */
+	task_telemetry_table_t taskTelemetry;			/**< Statistics of the tasks of the CM4 core. */
 } shared_data_t;
 /**
  * @}
@@ -123,6 +151,22 @@ extern void SharedMemory_Init(void);
  * @brief Refresh the shared memory
  */
 extern void SharedMemory_Refresh(void);
+#if IS_ADC_STATS_CORE
+/**
+ * @brief Enable the notification of the new ADC records from the ADC core.
+ * @note Call once after HAL_Init(). Without the notification @ref SharedMemory_WaitForAdcRecords() always waits
+ * till the timeout.
+ */
+extern void SharedMemory_InitAdcNotification(void);
+/**
+ * @brief Wait till @ref SHARED_MEMORY_ADC_NOTIFY_COUNT new records are available in @ref PROCESSED_ADC_DATA.
+ * @details A notification received while the records of the last one were processed ends the wait right away.
+ * Only a single task should wait for the records.
+ * @param timeout Maximum time to wait in ticks, which bounds the delay of the records following the last notification.
+ * @return <c>true</c> if notified, <c>false</c> if the timeout elapsed.
+ */
+extern bool SharedMemory_WaitForAdcRecords(uint32_t timeout);
+#endif
 /********************************************************************************
  * Code
  *******************************************************************************/
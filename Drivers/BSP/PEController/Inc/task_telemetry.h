@@ -0,0 +1,216 @@
+/**
+ ********************************************************************************
+ * @file 		task_telemetry.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Run time, scheduling latency and stack usage of the FreeRTOS tasks
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef TASK_TELEMETRY_H_
+#define TASK_TELEMETRY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @addtogroup BSP
+ * @{
+ */
+
+/** @addtogroup Common
+ * @{
+ */
+
+/** @defgroup TaskTelemetry Task Telemetry
+ * @brief Publishes the statistics of the FreeRTOS tasks in the shared memory.
+ * @details The statistics are collected on the @ref IS_TASK_TELEMETRY_CORE by a periodic timer of FreeRTOS, and
+ * written to @ref TASK_TELEMETRY every @ref TASK_TELEMETRY_PERIOD_ms for all tasks including the idle and timer
+ * tasks:
+ * - The run time counters of FreeRTOS are clocked by the DWT cycle counter. The CPU share of each task is computed
+ * over the last period, so the counters can wrap around between the periods.
+ * - The scheduling latency is the time from a task being moved to the ready list, e.g. by the end of its delay or by
+ * a notification, to it being switched in. It is measured by the trace hooks of FreeRTOSConfig.h, which find the
+ * statistics of the task through its application task tag.
+ * - The stack headroom is the high water mark of the stack since the creation of the task.
+ *
+ * Any core can read a consistent copy of the table with @ref TaskTelemetry_Read().
+ * @note The time spent in the interrupts is counted in the task it interrupts.
+ * @{
+ */
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include "general_header.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** @defgroup TaskTelemetry_Exported_Macros Macros
+ * @{
+ */
+/**
+ * @brief Maximum no of tasks in the table.
+ * @note The table is left empty if there are more tasks than this.
+ */
+#ifndef TASK_TELEMETRY_MAX_TASKS
+#define TASK_TELEMETRY_MAX_TASKS			(12)
+#endif
+/**
+ * @brief Length of the task names in the table including the terminating character
+ */
+#define TASK_TELEMETRY_NAME_LEN				(16)
+/**
+ * @brief Time between the updates of the table in milli-seconds
+ * @note Should be shorter than the wrap around time of the cycle counter, i.e. 2^32 cycles.
+ */
+#ifndef TASK_TELEMETRY_PERIOD_ms
+#define TASK_TELEMETRY_PERIOD_ms			(1000)
+#endif
+/**
+ * @}
+ */
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/** @defgroup TaskTelemetry_Exported_Structures Structures
+ * @{
+ */
+/**
+ * @brief Statistics of a single task
+ */
+typedef struct
+{
+	char name[TASK_TELEMETRY_NAME_LEN];	/**< Name of the task */
+	uint8_t priority;					/**< Base priority of the task */
+	uint8_t state;						/**< State of the task at the update as eTaskState */
+	uint16_t reserved;					/**< Reserved for future use */
+	float cpuLoad;						/**< Share of the CPU in the last period in percent */
+	uint32_t runTime_us;				/**< Run time in the last period in micro-seconds */
+	uint32_t switchIns;					/**< No of times the task was switched in during the last period */
+	uint32_t maxLatency_us;				/**< Longest scheduling latency in the last period in micro-seconds */
+	uint32_t peakLatency_us;			/**< Longest scheduling latency since the last reset in micro-seconds */
+	uint32_t stackFree;					/**< Minimum free stack since the creation of the task in bytes */
+} task_telemetry_entry_t;
+/**
+ * @brief Table of the task statistics in the shared memory
+ */
+typedef struct
+{
+	volatile uint32_t seq;				/**< Odd while the table is being updated */
+	volatile uint32_t resetRequests;	/**< Advanced by the readers to reset the peak latencies */
+	uint32_t updateCount;				/**< No of updates of the table */
+	uint32_t period_us;					/**< Length of the last period in micro-seconds */
+	float cpuLoad;						/**< Share of the CPU used by all tasks apart from the idle task in percent */
+	uint16_t taskCount;					/**< No of valid entries in @ref tasks */
+	uint16_t totalTasks;				/**< No of tasks in the system */
+	task_telemetry_entry_t tasks[TASK_TELEMETRY_MAX_TASKS];	/**< Statistics of the tasks in the order of FreeRTOS */
+} task_telemetry_table_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+/** @defgroup TaskTelemetry_Exported_Functions Functions
+ * @{
+ */
+#if IS_TASK_TELEMETRY_CORE
+/**
+ * @brief Start the periodic updates of @ref TASK_TELEMETRY.
+ * @note Call before starting the kernel. Needs the timers of FreeRTOS.
+ */
+extern void TaskTelemetry_Init(void);
+/**
+ * @brief Enable the DWT cycle counter for the run time statistics of FreeRTOS.
+ * @note Called by the kernel through portCONFIGURE_TIMER_FOR_RUN_TIME_STATS().
+ */
+extern void TaskTelemetry_InitCounter(void);
+/**
+ * @brief Get the run time counter of FreeRTOS.
+ * @note Called by the kernel through portGET_RUN_TIME_COUNTER_VALUE().
+ * @return Value of the DWT cycle counter.
+ */
+extern uint32_t TaskTelemetry_GetCounter(void);
+/**
+ * @brief Note the time at which a task became ready.
+ * @note Called by the kernel through traceMOVED_TASK_TO_READY_STATE().
+ * @param tag Application task tag of the task. Ignored if it isn't assigned by this module.
+ */
+extern void TaskTelemetry_TaskReady(uint32_t tag);
+/**
+ * @brief Measure the scheduling latency of the task being switched in.
+ * @note Called by the kernel through traceTASK_SWITCHED_IN().
+ * @param tag Application task tag of the task. Ignored if it isn't assigned by this module.
+ */
+extern void TaskTelemetry_TaskSwitchedIn(uint32_t tag);
+#endif
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Get a consistent copy of the table.
+ * @param src Table in the shared memory, i.e. &@ref TASK_TELEMETRY.
+ * @param dest Copy to be filled.
+ */
+static inline void TaskTelemetry_Read(const volatile task_telemetry_table_t* src, task_telemetry_table_t* dest)
+{
+	while (1)
+	{
+		uint32_t seq = src->seq;
+		__DMB();
+		if (seq & 1)
+			continue;
+		memcpy(dest, (const void*)src, sizeof(task_telemetry_table_t));
+		// the copy is consistent only if no update started in the meantime
+		__DMB();
+		if (src->seq == seq)
+			return;
+	}
+}
+/**
+ * @brief Request the reset of the peak latencies, which is done by the next update.
+ * @param table Table in the shared memory, i.e. &@ref TASK_TELEMETRY.
+ */
+static inline void TaskTelemetry_RequestReset(volatile task_telemetry_table_t* table)
+{
+	__atomic_fetch_add(&table->resetRequests, 1, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @}
+ */
+/**
+ * @}
+ */
+/**
+ * @}
+ */
+/**
+ * @}
+ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */
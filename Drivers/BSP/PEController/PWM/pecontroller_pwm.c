@@ -369,6 +369,9 @@ void BSP_PWMOut_Enable(uint32_t pwmMask, bool en)
 			TIM_CCxChannelCmd(htim1.Instance, TIM_CHANNEL_3, TIM_CCx_ENABLE);
 			TIM_CCxNChannelCmd(htim1.Instance, TIM_CHANNEL_3, TIM_CCxN_ENABLE);
 		}
+		// restore the main output if disabled by BSP_PWMOut_DisableFromISR() while the timer is running
+		if ((pwmMask & 0xfc00) && (htim1.Instance->CR1 & TIM_CR1_CEN))
+			__HAL_TIM_MOE_ENABLE(&htim1);
 
 		HAL_HRTIM_WaveformOutputStart(&hhrtim,
 				(pwmMask & 0x1 ? HRTIM_OUTPUT_TA1 : 0) |
@@ -414,4 +417,36 @@ void BSP_PWMOut_Enable(uint32_t pwmMask, bool en)
 	}
 }
 
+/**
+ * @brief Disable the output for required PWM channels from an interrupt
+ * @details The registers are written directly instead of using the HAL, which returns without disabling the
+ * outputs if its handle is locked by the interrupted code. The HRTIM outputs are disabled by a single write to
+ * the ODISR register. The main output of TIM1 is disabled if any of its channels is required, so the outputs stay
+ * disabled even if the interrupted code was enabling them. Enable the outputs again with @ref BSP_PWMOut_Enable().
+ * @param pwmMask Set the PWM channels needed to be disabled.<br>
+ * 				<b>Valid Range</b> =  (0x0001 - 0xffff)
+ */
+void BSP_PWMOut_DisableFromISR(uint32_t pwmMask)
+{
+	hhrtim.Instance->sCommonRegs.ODISR =
+			(pwmMask & 0x1 ? HRTIM_OUTPUT_TA1 : 0) |
+			(pwmMask & 0x2 ? HRTIM_OUTPUT_TA2 : 0) |
+			(pwmMask & 0x4 ? HRTIM_OUTPUT_TB1 : 0) |
+			(pwmMask & 0x8 ? HRTIM_OUTPUT_TB2 : 0) |
+			(pwmMask & 0x10 ? HRTIM_OUTPUT_TC1 : 0) |
+			(pwmMask & 0x20 ? HRTIM_OUTPUT_TC2 : 0) |
+			(pwmMask & 0x40 ? HRTIM_OUTPUT_TD1 : 0) |
+			(pwmMask & 0x80 ? HRTIM_OUTPUT_TD2 : 0) |
+			(pwmMask & 0x100 ? HRTIM_OUTPUT_TE1 : 0) |
+			(pwmMask & 0x200 ? HRTIM_OUTPUT_TE2 : 0);
+	if (pwmMask & 0xfc00)
+	{
+		htim1.Instance->BDTR &= ~TIM_BDTR_MOE;
+		htim1.Instance->CCER &= ~(
+				(pwmMask & 0xC00 ? (TIM_CCER_CC1E | TIM_CCER_CC1NE) : 0) |
+				(pwmMask & 0x3000 ? (TIM_CCER_CC2E | TIM_CCER_CC2NE) : 0) |
+				(pwmMask & 0xC000 ? (TIM_CCER_CC3E | TIM_CCER_CC3NE) : 0));
+	}
+}
+
 /* EOF */
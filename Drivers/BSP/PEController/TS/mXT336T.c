@@ -127,6 +127,7 @@ void mXT336T_Init(uint16_t DeviceAddr)
   */
 void mXT336T_Reset(uint16_t DeviceAddr)
 {
+  (void)DeviceAddr;
   /* Do nothing */
   /* No software reset sequence available in MXT336T IC */
 	ts_bsp_drv.Reset();
@@ -281,6 +282,7 @@ void mXT336T_TS_DisableIT(uint16_t DeviceAddr)
   */
 uint8_t mXT336T_TS_ITStatus(uint16_t DeviceAddr)
 {
+  (void)DeviceAddr;
   /* Always return 0 as feature not applicable to MXT336T */
   return 0;
 }
@@ -294,6 +296,7 @@ uint8_t mXT336T_TS_ITStatus(uint16_t DeviceAddr)
   */
 void mXT336T_TS_ClearIT(uint16_t DeviceAddr)
 {
+  (void)DeviceAddr;
   /* Nothing to be done here for MXT336T */
 }
 
@@ -433,6 +436,7 @@ static uint32_t mXT336T_TS_Calibration(uint16_t DeviceAddr)
   */
 static uint32_t mXT336T_TS_Configure(uint16_t DeviceAddr)
 {
+  (void)DeviceAddr;
   uint32_t status = MXT336T_STATUS_OK;
 
   /* Nothing special to be done for MXT336T */
@@ -47,6 +47,7 @@
 static uint8_t objectTable[OBJECT_COUNT][MXT_OBJECT_SIZE];
 static uint8_t msgBuffer[MSG_COUNT][MXT_T5_MSG_LEN];
 static uint16_t xPress, yPress;
+static mxt_touch_callback_t touchCallback = NULL;
 /********************************************************************************
  * Global Variables
  *******************************************************************************/
@@ -146,6 +147,9 @@ static void mxt_proc_t100_messages(mxt_data_t *data, uint8_t *message)
 		data->touch_num = message[2];
 	}
 	else if (id >= 2) {
+		/* only the tracked touches are reported */
+		if (id - 2 >= MXT_MAX_FINGER_NUM)
+			return;
 		/* deal with each point report */
 		status = message[1];
 		touch_event = status & 0x0F;
@@ -158,18 +162,28 @@ static void mxt_proc_t100_messages(mxt_data_t *data, uint8_t *message)
 				/* Touch in detect, report X/Y position */
 				if (touch_event == MXT_T100_EVENT_DOWN ||
 						touch_event == MXT_T100_EVENT_UNSUP)
-				{
 					data->finger_down[id - 2] = true;
-					xPress = x;
-					yPress = y;
-				}
-				if ((touch_event == MXT_T100_EVENT_MOVE ||
-						touch_event == MXT_T100_EVENT_NONE) &&
-						!data->finger_down[id - 2])
+				else if (!data->finger_down[id - 2])
 					return;
+				xPress = x;
+				yPress = y;
+				if (touchCallback)
+					touchCallback(true, xPress, yPress);
+			}
+		} else if (touch_event == MXT_T100_EVENT_UP || touch_event == MXT_T100_EVENT_UNSUPUP
+				|| touch_event == MXT_T100_EVENT_DOWNUP) {
+			/* a touch shorter than the acquisition is reported as a press and a release */
+			if (touch_event == MXT_T100_EVENT_DOWNUP) {
+				xPress = x;
+				yPress = y;
+				if (touchCallback)
+					touchCallback(true, xPress, yPress);
 			}
-		} else if (touch_event == 5) {
+			else if (!data->finger_down[id - 2])
+				return;
 			data->finger_down[id - 2] = false;
+			if (touchCallback)
+				touchCallback(false, xPress, yPress);
 		}
 	}
 }
@@ -229,7 +243,7 @@ static int mxt_read_count_messages(mxt_data_t *data, uint8_t count)
 	return num_valid;
 }
 
-static void mxt_read_messages_t44(mxt_data_t *data)
+static int mxt_read_messages_t44(mxt_data_t *data, uint8_t maxCount)
 {
 	int error;
 	uint8_t count, num_left;
@@ -237,20 +251,26 @@ static void mxt_read_messages_t44(mxt_data_t *data)
 	/* Read T44 and T5 together */
 	error = ts_bsp_drv.ReadMultiple(data->shiftedAddress, data->T44_address, data->msg_buf, data->T5_msg_size + 1);
 	if (error != HAL_OK)
-		return;
+		return -1;
 
 	count = data->msg_buf[0];
 
 	if (count == 0) {
-		return;
+		return 0;
 	} else if (count > data->max_reportid) {
 		count = data->max_reportid;
 	}
+	/* the remaining messages are read after the first message in the buffer */
+	if (count > MSG_COUNT)
+		count = MSG_COUNT;
+	/* the rest stays in the controller for the next read */
+	if (maxCount != 0 && count > maxCount)
+		count = maxCount;
 
 	/* Process first message */
 	error = mxt_proc_message(data, data->msg_buf + 1);
 	if (error < 0) {
-		return;
+		return 0;
 	}
 
 	num_left = count - 1;
@@ -259,9 +279,11 @@ static void mxt_read_messages_t44(mxt_data_t *data)
 	if (num_left) {
 		error = mxt_read_count_messages(data, num_left);
 		if (error < 0) {
-			return;
+			return -1;
 		}
+		return error + 1;
 	}
+	return 1;
 }
 
 // gets the object table
@@ -569,7 +591,7 @@ uint16_t MXTDrivers_Init(uint16_t ts_SizeX, uint16_t ts_SizeY)
  */
 bool MXTDrivers_GetState(uint16_t* x, uint16_t* y)
 {
-	mxt_read_messages_t44(&mxtData);
+	mxt_read_messages_t44(&mxtData, 0);
 	for (int i = 0; i < MXT_MAX_FINGER_NUM; i++)
 	{
 		if(mxtData.finger_down[i] == true)
@@ -582,4 +604,25 @@ bool MXTDrivers_GetState(uint16_t* x, uint16_t* y)
 	return false;
 }
 
+/**
+ * @brief Read the pending messages of the controller and process them.
+ * @details The message count (T44) and the first message (T5) are read together, followed by a single read of the
+ * remaining messages. The touch events of the T100 messages are reported to the touch callback.
+ * @param maxCount Maximum no of messages to read, the rest stays pending in the controller. 0 for no limit.
+ * @return No of processed messages if successful else a negative value.
+ */
+int MXTDrivers_ReadMessages(uint8_t maxCount)
+{
+	return mxt_read_messages_t44(&mxtData, maxCount);
+}
+
+/**
+ * @brief Set the callback receiving the touch events of the processed messages.
+ * @param callback Touch callback. NULL if not required.
+ */
+void MXTDrivers_SetTouchCallback(mxt_touch_callback_t callback)
+{
+	touchCallback = callback;
+}
+
 /* EOF */
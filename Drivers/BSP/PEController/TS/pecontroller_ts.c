@@ -26,10 +26,19 @@
 #include "user_config.h"
 #include "mxt_drivers.c"
 #include "pecontroller_ts.h"
+#if TS_IRQ_MODE
+#include "cmsis_os.h"
+#endif
 /********************************************************************************
  * Defines
  *******************************************************************************/
 #define TS_I2C_ADDRESS				(0x4A << 1)
+/**
+ * @brief DMA stream of the I2C reads. DMA1 streams 0-2 are used by the ADC and DMA2 stream 0 by intelliSENS.
+ */
+#define TS_DMA_STREAM				DMA1_Stream3
+#define TS_DMA_IRQn					DMA1_Stream3_IRQn
+#define TS_DMA_IRQHandler			DMA1_Stream3_IRQHandler
 /********************************************************************************
  * Typedefs
  *******************************************************************************/
@@ -44,6 +53,16 @@
 static I2C_HandleTypeDef hi2c2;
 static bool initComplete = false;
 static TS_StateTypeDef tsState;
+static TS_StateTypeDef eventQueue[TS_EVENT_QUEUE_SIZE];
+static volatile uint32_t eventWrIndex = 0;
+static volatile uint32_t eventRdIndex = 0;
+static TS_StatsTypeDef tsStats = {0};
+static uint16_t sizeX = 800, sizeY = 480;
+#if TS_IRQ_MODE
+static DMA_HandleTypeDef hdma_i2c2_rx;
+static osThreadId_t tsTask = NULL;
+static volatile HAL_StatusTypeDef dmaStatus = HAL_OK;
+#endif
 /********************************************************************************
  * Global Variables
  *******************************************************************************/
@@ -107,14 +126,31 @@ static uint8_t TS_Read(uint8_t addr, uint16_t reg)
 static uint16_t TS_ReadMultiple(uint8_t addr, uint16_t reg, uint8_t *buffer, uint16_t len)
 {
 	HAL_StatusTypeDef status = HAL_OK;
-	uint16_t wait_ms = len;// / 4;
-	if (wait_ms == 0)
-		wait_ms = 1;
 	int retry_count = 2;
 	do
 	{
-		status = HAL_I2C_Mem_Read(&hi2c2, addr, GetReg(reg), I2C_MEMADD_SIZE_16BIT, buffer, len, 1000);
+#if TS_IRQ_MODE
+		// the task sleeps during the transfer instead of polling the I2C
+		status = HAL_I2C_Mem_Read_DMA(&hi2c2, addr, GetReg(reg), I2C_MEMADD_SIZE_16BIT, buffer, len);
+		if (status == HAL_OK)
+		{
+			if (osThreadFlagsWait(TS_DMA_THREAD_FLAG, osFlagsWaitAny, TS_I2C_TIMEOUT_ms) == osFlagsErrorTimeout)
+			{
+				// recover the I2C from the stuck transfer
+				HAL_I2C_DeInit(&hi2c2);
+				HAL_I2C_Init(&hi2c2);
+				status = HAL_TIMEOUT;
+			}
+			else
+				status = dmaStatus;
+		}
+#else
+		status = HAL_I2C_Mem_Read(&hi2c2, addr, GetReg(reg), I2C_MEMADD_SIZE_16BIT, buffer, len, TS_I2C_TIMEOUT_ms);
+#endif
+		tsStats.reads++;
 	} while(status != HAL_OK && retry_count-- >= 0);
+	if (status != HAL_OK)
+		tsStats.errors++;
 	return status;
 }
 /**
@@ -141,6 +177,9 @@ static void ConfigClock(void)
 	__HAL_RCC_GPIOG_CLK_ENABLE();
 	__HAL_RCC_GPIOH_CLK_ENABLE();
 	__HAL_RCC_I2C2_CLK_ENABLE();
+#if TS_IRQ_MODE
+	__HAL_RCC_DMA1_CLK_ENABLE();
+#endif
 }
 /**
  * @brief Configure relevant IOs
@@ -161,7 +200,8 @@ static void ConfigIO(void)
 
 	/*Configure GPIO pin : CTP_INT_Pin */
 	GPIO_InitStruct.Pin = CTP_INT_Pin;
-	GPIO_InitStruct.Mode = GPIO_MODE_IT_RISING;
+	// the CHG line is asserted low by the controller when messages are pending
+	GPIO_InitStruct.Mode = TS_IRQ_MODE ? GPIO_MODE_IT_FALLING : GPIO_MODE_IT_RISING;
 	GPIO_InitStruct.Pull = GPIO_PULLUP;
 	HAL_GPIO_Init(CTP_INT_GPIO_Port, &GPIO_InitStruct);
 
@@ -205,6 +245,36 @@ static void ConfigI2C(void)
 		Error_Handler();
 	}
 }
+#if TS_IRQ_MODE
+/**
+ * @brief Configure the DMA reads of the I2C and the interrupts
+ */
+static void ConfigDMA(void)
+{
+	hdma_i2c2_rx.Instance = TS_DMA_STREAM;
+	hdma_i2c2_rx.Init.Request = DMA_REQUEST_I2C2_RX;
+	hdma_i2c2_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+	hdma_i2c2_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+	hdma_i2c2_rx.Init.MemInc = DMA_MINC_ENABLE;
+	hdma_i2c2_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+	hdma_i2c2_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+	hdma_i2c2_rx.Init.Mode = DMA_NORMAL;
+	hdma_i2c2_rx.Init.Priority = DMA_PRIORITY_LOW;
+	hdma_i2c2_rx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+	if (HAL_DMA_Init(&hdma_i2c2_rx) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	__HAL_LINKDMA(&hi2c2, hdmarx, hdma_i2c2_rx);
+
+	HAL_NVIC_SetPriority(TS_DMA_IRQn, TS_IRQ_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(TS_DMA_IRQn);
+	HAL_NVIC_SetPriority(I2C2_EV_IRQn, TS_IRQ_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(I2C2_EV_IRQn);
+	HAL_NVIC_SetPriority(I2C2_ER_IRQn, TS_IRQ_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(I2C2_ER_IRQn);
+}
+#endif
 /**
  * @brief Perform board related initializations of the touch screen controller
  */
@@ -215,6 +285,9 @@ static void TS_Init(void)
 	{
 		ConfigClock();
 		ConfigI2C();
+#if TS_IRQ_MODE
+		ConfigDMA();
+#endif
 		ConfigIO();
 		isActivated = true;
 	}
@@ -230,6 +303,36 @@ static void TS_Reset(void)
 	HAL_Delay(200);
 }
 
+/**
+ * @brief Queue a touch event decoded by the drivers.
+ * @details The touch task is the only producer and the reader of the input device the only consumer of the queue.
+ * The messages are only read when the queue has space for their events, so an event is dropped only if the queue
+ * is not read in time in the polling mode. The state always follows the events.
+ * @param isPressed <c>true</c> if the touch is detected else <c>false</c>.
+ * @param x Horizontal position of the touch.
+ * @param y Vertical position of the touch.
+ */
+static void TS_ReportTouch(bool isPressed, uint16_t x, uint16_t y)
+{
+	uint32_t wrIndex = eventWrIndex;
+	if (wrIndex - eventRdIndex >= TS_EVENT_QUEUE_SIZE)
+		tsStats.droppedEvents++;
+	else
+	{
+		TS_StateTypeDef* event = &eventQueue[wrIndex & (TS_EVENT_QUEUE_SIZE - 1)];
+		event->touchDetected = isPressed;
+		event->touchX = x;
+		event->touchY = y;
+		// publish the event after its contents
+		__DMB();
+		eventWrIndex = wrIndex + 1;
+		tsStats.events++;
+	}
+	tsState.touchDetected = isPressed;
+	tsState.touchX = x;
+	tsState.touchY = y;
+}
+
 /**
  * @brief Initialize the touch screen controller
  * @param ts_SizeX Horizontal Size of the touch screen
@@ -245,11 +348,22 @@ uint8_t BSP_TS_Init(uint16_t ts_SizeX, uint16_t ts_SizeY)
 	ts_bsp_drv.Write = TS_Write;
 	ts_bsp_drv.Delay = TS_Delay;
 
+#if TS_IRQ_MODE
+	// the DMA transfers and the CHG line wake up the initializing task
+	tsTask = osThreadGetId();
+#endif
+	sizeX = ts_SizeX;
+	sizeY = ts_SizeY;
 	TS_Init();
 	TS_Reset();
-	if(MXTDrivers_Init(800, 480) == HAL_OK)
+	MXTDrivers_SetTouchCallback(TS_ReportTouch);
+	if(MXTDrivers_Init(sizeX, sizeY) == HAL_OK)
 	{
 		initComplete = true;
+#if TS_IRQ_MODE
+		HAL_NVIC_SetPriority(EXTI2_IRQn, TS_IRQ_PRIORITY, 0);
+		HAL_NVIC_EnableIRQ(EXTI2_IRQn);
+#endif
 		return TS_OK;
 	}
 	return TS_DEVICE_NOT_FOUND;
@@ -277,4 +391,168 @@ void BSP_TS_Poll(void)
 	return;
 }
 
+#if TS_IRQ_MODE
+/**
+ * @brief Reset the controller and the I2C, and initialize the drivers again.
+ * @details The task sleeps during the reset, instead of the blocking delays of the initialization.
+ */
+static void TS_Recover(void)
+{
+	tsStats.recoveries++;
+	HAL_I2C_DeInit(&hi2c2);
+	HAL_I2C_Init(&hi2c2);
+	HAL_GPIO_WritePin(CTP_RST_GPIO_Port, CTP_RST_Pin, GPIO_PIN_RESET);
+	osDelay(20);
+	HAL_GPIO_WritePin(CTP_RST_GPIO_Port, CTP_RST_Pin, GPIO_PIN_SET);
+	osDelay(200);
+	if (MXTDrivers_Init(sizeX, sizeY) != HAL_OK)
+		tsStats.errors++;
+}
+
+/**
+ * @brief Wait till the touch screen controller has messages and process them.
+ * @details The calling task sleeps till the controller asserts the CHG line, unless it is still asserted. The messages
+ * are then read with DMA transfers and the touch events are queued for @ref BSP_TS_GetEvent(). While the queue is
+ * full the messages stay pending in the controller. If the line stays asserted without messages, the task waits up to
+ * @ref TS_STUCK_RETRY_DELAY_ms between the reads, and resets the controller after @ref TS_STUCK_READ_LIMIT reads.
+ * @note Call in a loop from the task which initialized the touch screen with @ref BSP_TS_Init().
+ */
+void BSP_TS_WaitAndProcess(void)
+{
+	static int stuckReads = 0;
+	if (!initComplete)
+		return;
+	// the line stays asserted while messages are pending, so an edge may not follow the last read
+	bool isAsserted = HAL_GPIO_ReadPin(CTP_INT_GPIO_Port, CTP_INT_Pin) == GPIO_PIN_RESET;
+	if (!isAsserted)
+	{
+		osThreadFlagsWait(TS_CHG_THREAD_FLAG, osFlagsWaitAny, osWaitForever);
+		stuckReads = 0;
+	}
+	// a message gives at most 2 events, the rest stays in the controller till the queue is read
+	uint32_t freeEvents = TS_EVENT_QUEUE_SIZE - (eventWrIndex - eventRdIndex);
+	if (freeEvents < 2)
+	{
+		osDelay(TS_QUEUE_FULL_DELAY_ms);
+		return;
+	}
+	int count = MXTDrivers_ReadMessages(freeEvents / 2);
+	if (count > 0)
+	{
+		tsStats.messages += count;
+		stuckReads = 0;
+	}
+	else if (isAsserted)
+	{
+		// a controller holding the line without messages would keep the task reading back to back
+		if (++stuckReads >= TS_STUCK_READ_LIMIT)
+		{
+			TS_Recover();
+			stuckReads = 0;
+		}
+		else
+			osThreadFlagsWait(TS_CHG_THREAD_FLAG, osFlagsWaitAny, TS_STUCK_RETRY_DELAY_ms);
+	}
+}
+
+/**
+ * @brief Wakes up the touch task on the assertion of the CHG line.
+ */
+void EXTI2_IRQHandler(void)
+{
+#if defined(DUAL_CORE) && defined(CORE_CM4)
+	if (__HAL_GPIO_EXTID2_GET_IT(CTP_INT_Pin) != 0x00U)
+	{
+		__HAL_GPIO_EXTID2_CLEAR_IT(CTP_INT_Pin);
+#else
+	if (__HAL_GPIO_EXTI_GET_IT(CTP_INT_Pin) != 0x00U)
+	{
+		__HAL_GPIO_EXTI_CLEAR_IT(CTP_INT_Pin);
+#endif
+		tsStats.interrupts++;
+		if (tsTask != NULL)
+			osThreadFlagsSet(tsTask, TS_CHG_THREAD_FLAG);
+	}
+}
+
+void I2C2_EV_IRQHandler(void)
+{
+	HAL_I2C_EV_IRQHandler(&hi2c2);
+}
+
+void I2C2_ER_IRQHandler(void)
+{
+	HAL_I2C_ER_IRQHandler(&hi2c2);
+}
+
+void TS_DMA_IRQHandler(void)
+{
+	HAL_DMA_IRQHandler(&hdma_i2c2_rx);
+}
+
+/**
+ * @brief Wakes up the touch task on the completion of a read.
+ * @param hi2c I2C handle.
+ */
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c == &hi2c2)
+	{
+		dmaStatus = HAL_OK;
+		osThreadFlagsSet(tsTask, TS_DMA_THREAD_FLAG);
+	}
+}
+
+/**
+ * @brief Wakes up the touch task on the failure of a read.
+ * @param hi2c I2C handle.
+ */
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+	if (hi2c == &hi2c2)
+	{
+		dmaStatus = HAL_ERROR;
+		osThreadFlagsSet(tsTask, TS_DMA_THREAD_FLAG);
+	}
+}
+#endif
+
+/**
+ * @brief Get the oldest touch event of the queue.
+ * @details The queue keeps the touches and releases happening between two reads of the input device, so short taps
+ * and the path of a drag are not lost.
+ * @param event Structure to be filled with the event.
+ * @return <c>true</c> if an event was available else <c>false</c>.
+ */
+bool BSP_TS_GetEvent(TS_StateTypeDef* event)
+{
+	uint32_t rdIndex = eventRdIndex;
+	if (rdIndex == eventWrIndex)
+		return false;
+	// read the event after its publication
+	__DMB();
+	*event = eventQueue[rdIndex & (TS_EVENT_QUEUE_SIZE - 1)];
+	__DMB();
+	eventRdIndex = rdIndex + 1;
+	return true;
+}
+
+/**
+ * @brief Check if touch events are queued.
+ * @return <c>true</c> if the queue has events else <c>false</c>.
+ */
+bool BSP_TS_IsEventPending(void)
+{
+	return eventRdIndex != eventWrIndex;
+}
+
+/**
+ * @brief Get the counters of the message processing.
+ * @param stats Structure to be filled with the counters.
+ */
+void BSP_TS_GetStats(TS_StatsTypeDef* stats)
+{
+	*stats = tsStats;
+}
+
 /* EOF */
@@ -0,0 +1,352 @@
+/**
+ ********************************************************************************
+ * @file    	pecontroller_timer_sync.c
+ * @author 		Waqas Ehsan Butt
+ * @date    	Oct 18, 2026
+ *
+ * @brief   Declarative description of the timer synchronization graph
+ ********************************************************************************
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <math.h>
+#include "pecontroller_timer_sync.h"
+#include "pecontroller_adc.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** Mask for a trigger source in the list of the available sources
+ */
+#define SRC_MASK(src)					(1UL << (src))
+/** Maximum period of the 16-bit timers in timer ticks
+ */
+#define MAX_16BIT_PERIOD				(65536)
+/** Tolerance for the frequency ratios of the nodes reset by their source
+ */
+#define RATIO_TOLERANCE					(0.001f)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+/** Trigger source generated by each node
+ */
+static const timer_trigger_src_t nodeSources[TIM_SYNC_NODE_COUNT] =
+{
+		[TIM_SYNC_NODE_TIM1] = TIM_TRG_SRC_TIM1,
+		[TIM_SYNC_NODE_HRTIM_MASTER] = TIM_TRG_SRC_HRTIM_MASTER_PERIOD,
+		[TIM_SYNC_NODE_FIBER_RX] = TIM_TRG_SRC_TIM2,
+		[TIM_SYNC_NODE_FIBER_TX] = TIM_TRG_SRC_TIM3,
+		[TIM_SYNC_NODE_ADC] = TIM_TRG_SRC_TIM4,
+};
+/** Trigger sources available for each node. See @ref BSP_Timer_SetInputTrigger() for the details.
+ */
+static const uint32_t availableSources[TIM_SYNC_NODE_COUNT] =
+{
+		[TIM_SYNC_NODE_TIM1] = SRC_MASK(TIM_TRG_SRC_NONE) | SRC_MASK(TIM_TRG_SRC_TIM15) | SRC_MASK(TIM_TRG_SRC_TIM2) |
+				SRC_MASK(TIM_TRG_SRC_TIM3) | SRC_MASK(TIM_TRG_SRC_TIM4),
+		[TIM_SYNC_NODE_HRTIM_MASTER] = SRC_MASK(TIM_TRG_SRC_NONE) | SRC_MASK(TIM_TRG_SRC_TIM1),
+		[TIM_SYNC_NODE_FIBER_RX] = SRC_MASK(TIM_TRG_SRC_PIN),
+		[TIM_SYNC_NODE_FIBER_TX] = SRC_MASK(TIM_TRG_SRC_NONE) | SRC_MASK(TIM_TRG_SRC_TIM1) | SRC_MASK(TIM_TRG_SRC_TIM2) |
+				SRC_MASK(TIM_TRG_SRC_TIM15) | SRC_MASK(TIM_TRG_SRC_TIM4),
+		[TIM_SYNC_NODE_ADC] = SRC_MASK(TIM_TRG_SRC_NONE) | SRC_MASK(TIM_TRG_SRC_TIM1) | SRC_MASK(TIM_TRG_SRC_TIM2) |
+				SRC_MASK(TIM_TRG_SRC_TIM3) | SRC_MASK(TIM_TRG_SRC_TIM8),
+};
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Get the trigger source generated by a node.
+ * @param node Node of the graph.
+ * @return Trigger source used by the nodes following this node.
+ */
+timer_trigger_src_t BSP_TimerSync_GetNodeSource(tim_sync_node_t node)
+{
+	return node < TIM_SYNC_NODE_COUNT ? nodeSources[node] : TIM_TRG_SRC_NONE;
+}
+
+/**
+ * @brief Get the node generating a trigger source.
+ * @param src Trigger source.
+ * @return Index of the node. -1 if the source is not generated by a node of the graph.
+ */
+static int GetSourceNode(timer_trigger_src_t src)
+{
+	for (int i = 0; i < TIM_SYNC_NODE_COUNT; i++)
+	{
+		if (nodeSources[i] == src)
+			return i;
+	}
+	return -1;
+}
+
+/**
+ * @brief Record an issue in the report.
+ * @return Always <c>false</c>.
+ */
+static bool SetIssue(tim_sync_report_t* report, tim_sync_issue_t issue, tim_sync_node_t node)
+{
+	report->issue = issue;
+	report->node = node;
+	return false;
+}
+
+/**
+ * @brief Check the configuration of a node independently of the other nodes.
+ */
+static bool CheckNode(const tim_sync_graph_t* graph, tim_sync_node_t node, tim_sync_report_t* report)
+{
+	const tim_sync_node_config_t* config = &graph->nodes[node];
+	timer_trigger_src_t src = config->in.src;
+
+	// frequency range of the relevant timers
+	if (!(config->f > 0))
+		return SetIssue(report, TIM_SYNC_ERR_FREQUENCY, node);
+	if ((node == TIM_SYNC_NODE_FIBER_TX || node == TIM_SYNC_NODE_ADC) && (TIM_SYNC_TIMER_CLOCK_Hz / config->f) > MAX_16BIT_PERIOD)
+		return SetIssue(report, TIM_SYNC_ERR_FREQUENCY, node);
+	if (node == TIM_SYNC_NODE_ADC && config->f > TIM_SYNC_ADC_MAX_FREQUENCY_Hz)
+		return SetIssue(report, TIM_SYNC_ERR_FREQUENCY, node);
+
+	// trigger source and type
+	if (src > TIM_TRG_SRC_PIN || (availableSources[node] & SRC_MASK(src)) == 0)
+		return SetIssue(report, TIM_SYNC_ERR_SOURCE, node);
+	if (src != TIM_TRG_SRC_NONE)
+	{
+		if (config->in.type == TIM_TRGI_TYPE_NONE)
+			return SetIssue(report, TIM_SYNC_ERR_TRIGGER_TYPE, node);
+		// the conversion timers only follow the reset events
+		if (node == TIM_SYNC_NODE_ADC && config->in.type != TIM_TRGI_TYPE_RST)
+			return SetIssue(report, TIM_SYNC_ERR_TRIGGER_TYPE, node);
+		int srcNode = GetSourceNode(src);
+		if (srcNode >= 0 && !graph->nodes[srcNode].isEnabled)
+			return SetIssue(report, TIM_SYNC_ERR_SOURCE_DISABLED, node);
+	}
+
+	// output delay generated by the compare unit
+	if (config->outDelayInUsec != 0)
+	{
+		if (node != TIM_SYNC_NODE_FIBER_TX || config->outDelayInUsec < 0 || config->outDelayInUsec >= (1000000.f / config->f))
+			return SetIssue(report, TIM_SYNC_ERR_DELAY, node);
+	}
+	return true;
+}
+
+/**
+ * @brief Compute the timing of a node after computing the timing of its source.
+ * @param depth Number of nodes visited before this node. Used to detect loops.
+ * @param resolved Nodes with computed timing.
+ */
+static bool ResolveNode(const tim_sync_graph_t* graph, tim_sync_node_t node, int depth, bool* resolved, tim_sync_report_t* report)
+{
+	if (resolved[node])
+		return true;
+	if (depth >= TIM_SYNC_NODE_COUNT)
+		return SetIssue(report, TIM_SYNC_ERR_LOOP, node);
+
+	const tim_sync_node_config_t* config = &graph->nodes[node];
+	tim_sync_timing_t* timing = &report->timing[node];
+	int srcNode = GetSourceNode(config->in.src);
+	timing->periodInUsec = 1000000.f / config->f;
+	if (srcNode < 0)
+	{
+		// free running or following an event from outside the graph
+		timing->root = node;
+		timing->isLocked = true;
+		timing->startInUsec = 0;
+	}
+	else
+	{
+		if (!ResolveNode(graph, (tim_sync_node_t)srcNode, depth + 1, resolved, report))
+			return false;
+		tim_sync_timing_t* srcTiming = &report->timing[srcNode];
+		timing->root = srcTiming->root;
+		timing->startInUsec = srcTiming->eventInUsec;
+		timing->isLocked = srcTiming->isLocked && config->in.type != TIM_TRGI_TYPE_START;
+		// nodes reset in each period of the source should complete an integer number of periods
+		if (config->in.type != TIM_TRGI_TYPE_START)
+		{
+			float ratio = config->f / graph->nodes[srcNode].f;
+			float count = roundf(ratio);
+			if (count < 1 || fabsf(ratio - count) > RATIO_TOLERANCE * ratio)
+				return SetIssue(report, TIM_SYNC_ERR_RATIO, node);
+		}
+	}
+	timing->eventInUsec = timing->startInUsec + config->outDelayInUsec;
+	timing->isEnabled = true;
+	resolved[node] = true;
+	return true;
+}
+
+/**
+ * @brief Compute the start of conversion of the ADC according to the placement rule.
+ */
+static bool PlaceSamples(const tim_sync_graph_t* graph, tim_sync_report_t* report)
+{
+	const tim_sync_node_config_t* config = &graph->nodes[TIM_SYNC_NODE_ADC];
+	tim_sync_timing_t* timing = &report->timing[TIM_SYNC_NODE_ADC];
+	int srcNode = GetSourceNode(config->in.src);
+	float instant;
+
+	if (timing->periodInUsec <= MAX11046_CONVERSION_TIME_Us)
+		return SetIssue(report, TIM_SYNC_ERR_PLACEMENT, TIM_SYNC_NODE_ADC);
+	if (graph->samplePlacement == TIM_SYNC_SAMPLE_AT_TRIGGER)
+		instant = timing->startInUsec;
+	else
+	{
+		// period of the source is needed to place the samples
+		if (srcNode < 0)
+			return SetIssue(report, TIM_SYNC_ERR_PLACEMENT, TIM_SYNC_NODE_ADC);
+		tim_sync_timing_t* srcTiming = &report->timing[srcNode];
+		if (graph->samplePlacement == TIM_SYNC_SAMPLE_DATA_AT_CENTER)
+			instant = srcTiming->startInUsec + srcTiming->periodInUsec * 0.5f;
+		else if (graph->samplePlacement == TIM_SYNC_SAMPLE_DATA_AT_END)
+			instant = srcTiming->startInUsec + srcTiming->periodInUsec;
+		else
+			return SetIssue(report, TIM_SYNC_ERR_PLACEMENT, TIM_SYNC_NODE_ADC);
+		instant -= MAX11046_CONVERSION_TIME_Us;
+	}
+	instant += graph->sampleOffsetInUsec;
+
+	// free running conversions can't be placed
+	if (srcNode < 0 && config->in.src == TIM_TRG_SRC_NONE && instant != timing->startInUsec)
+		return SetIssue(report, TIM_SYNC_ERR_PLACEMENT, TIM_SYNC_NODE_ADC);
+
+	// the delay is generated in each sampling period after the trigger
+	float delay = fmodf(instant - timing->startInUsec, timing->periodInUsec);
+	if (delay < 0)
+		delay += timing->periodInUsec;
+	report->adcDelayInUsec = delay;
+	timing->eventInUsec = timing->startInUsec + delay;
+	report->adcDataReadyInUsec = timing->eventInUsec + MAX11046_CONVERSION_TIME_Us;
+	report->adcSamplesPerTrigger = srcNode < 0 ? 1 : (uint32_t)roundf(config->f / graph->nodes[srcNode].f);
+	return true;
+}
+
+/**
+ * @brief Validate the graph and compute the timing of the nodes.
+ * @note Doesn't access the hardware.
+ * @param graph Synchronization graph.
+ * @param report Filled with the first issue and the timing of the nodes.
+ * @return <c>true</c> if the graph is valid else <c>false</c>.
+ */
+bool BSP_TimerSync_Validate(const tim_sync_graph_t* graph, tim_sync_report_t* report)
+{
+	bool resolved[TIM_SYNC_NODE_COUNT] = {0};
+	memset(report, 0, sizeof(tim_sync_report_t));
+	report->adcSamplesPerTrigger = 1;
+
+	for (int i = 0; i < TIM_SYNC_NODE_COUNT; i++)
+	{
+		report->timing[i].root = (tim_sync_node_t)i;
+		if (graph->nodes[i].isEnabled && !CheckNode(graph, (tim_sync_node_t)i, report))
+			return false;
+	}
+	for (int i = 0; i < TIM_SYNC_NODE_COUNT; i++)
+	{
+		if (graph->nodes[i].isEnabled && !ResolveNode(graph, (tim_sync_node_t)i, 0, resolved, report))
+			return false;
+	}
+	if (graph->nodes[TIM_SYNC_NODE_ADC].isEnabled)
+		return PlaceSamples(graph, report);
+	return true;
+}
+
+/**
+ * @brief Check if any enabled node follows a node.
+ */
+static bool IsSourceUsed(const tim_sync_graph_t* graph, tim_sync_node_t node)
+{
+	for (int i = 0; i < TIM_SYNC_NODE_COUNT; i++)
+	{
+		if (graph->nodes[i].isEnabled && graph->nodes[i].in.src == nodeSources[node])
+			return true;
+	}
+	return false;
+}
+
+/**
+ * @brief Validate the graph and configure all the nodes except @ref TIM_SYNC_NODE_TIM1.
+ * @details Nothing is configured if the graph is invalid. The ADC triggers are changed using
+ * @ref BSP_ADC_UpdateInputOutputTrigger() so the conversions keep running if already started.
+ * @param graph Synchronization graph.
+ * @param report Filled with the first issue and the timing of the nodes. Can be NULL.
+ * @return <c>true</c> if the graph is valid and applied else <c>false</c>.
+ */
+bool BSP_TimerSync_Apply(const tim_sync_graph_t* graph, tim_sync_report_t* report)
+{
+	tim_sync_report_t localReport;
+	if (report == NULL)
+		report = &localReport;
+	if (!BSP_TimerSync_Validate(graph, report))
+		return false;
+
+	// all nodes pass their period start to the followers, Fiber Tx can delay it
+	tim_out_trigger_config_t outTrigger = { .type = TIM_TRGO_OUT_UPDATE, .isTriggerDelayInitRequired = false, .triggerDelayInUsec = 0 };
+	const tim_sync_node_config_t* config = &graph->nodes[TIM_SYNC_NODE_HRTIM_MASTER];
+	if (config->isEnabled)
+	{
+		hrtim_opts_t opts = { .syncSrc = config->in.src, .syncType = config->in.type, .f = config->f };
+		BSP_MasterHRTIM_Config(&opts);
+	}
+
+	config = &graph->nodes[TIM_SYNC_NODE_FIBER_RX];
+	if (config->isEnabled)
+		BSP_TIM2_ConfigFiberRx(config->in.type, config->in.edge,
+				IsSourceUsed(graph, TIM_SYNC_NODE_FIBER_RX) ? &outTrigger : NULL, config->f);
+
+	config = &graph->nodes[TIM_SYNC_NODE_FIBER_TX];
+	if (config->isEnabled)
+	{
+		tim_in_trigger_config_t inTrigger = config->in;
+		tim_out_trigger_config_t txTrigger = outTrigger;
+		if (config->outDelayInUsec > 0)
+		{
+			txTrigger.type = TIM_TRGO_OUT_OC1;
+			txTrigger.isTriggerDelayInitRequired = true;
+			txTrigger.triggerDelayInUsec = config->outDelayInUsec;
+		}
+		BSP_TIM3_ConfigFiberTx(inTrigger.src == TIM_TRG_SRC_NONE ? NULL : &inTrigger, &txTrigger, config->f);
+	}
+
+#if IS_ADC_CORE
+	config = &graph->nodes[TIM_SYNC_NODE_ADC];
+	if (config->isEnabled)
+	{
+		tim_in_trigger_config_t inTrigger = config->in;
+		BSP_ADC_SetTriggerDelay(report->adcDelayInUsec);
+		(void)BSP_ADC_UpdateInputOutputTrigger(inTrigger.src == TIM_TRG_SRC_NONE ? NULL : &inTrigger,
+				IsSourceUsed(graph, TIM_SYNC_NODE_ADC) ? &outTrigger : NULL, config->f);
+	}
+#endif
+	return true;
+}
+
+/* EOF */
@@ -559,7 +559,8 @@ void BSP_Timer_SetOutputTrigger(TIM_HandleTypeDef* _htim, tim_out_trigger_config
 	{
 		sConfigOC.OCMode = TIM_OCMODE_PWM1;
 		// --FIXME-- Frequency calculation etc.
-		sConfigOC.Pulse = (uint32_t)((_config->triggerDelayInUsec * (TIM3_FREQ_Hz / 1000000.f)) - 1);
+		float ticks = _config->triggerDelayInUsec * (TIM3_FREQ_Hz / 1000000.f);
+		sConfigOC.Pulse = ticks >= 1 ? (uint32_t)(ticks - 1) : 0;
 		sConfigOC.OCPolarity = TIM_OCPOLARITY_HIGH;
 		sConfigOC.OCFastMode = TIM_OCFAST_DISABLE;
 		if (HAL_TIM_PWM_ConfigChannel(_htim, &sConfigOC, TIM_CHANNEL_1) != HAL_OK)
@@ -47,7 +47,7 @@ extern "C" {
 /********************************************************************************
  * Includes
  *******************************************************************************/
-#include "Coordinates.h"
+#include "coordinates.h"
 /********************************************************************************
  * Defines
  *******************************************************************************/
@@ -4,7 +4,7 @@
  * @author 		Waqas Ehsan Butt
  * @date    	May 18, 2023
  *
- * @brief   
+ * @brief   Decoding and caching of the images displayed in the direct LTDC layer
  ********************************************************************************
  ********************************************************************************
  * @attention
@@ -27,7 +27,9 @@
 /********************************************************************************
  * Defines
  *******************************************************************************/
-
+#define RLE_LITERAL_MASK				(0x80)
+#define RLE_COPY_MASK					(0x40)
+#define RLE_COUNT_MASK					(0x3F)
 /********************************************************************************
  * Typedefs
  *******************************************************************************/
@@ -35,11 +37,24 @@
 /********************************************************************************
  * Structures
  *******************************************************************************/
-
+/**
+ * @brief Information of an image decoded in the cache
+ */
+typedef struct
+{
+	const image_info_t* img;		/**< @brief Decoded image. NULL if the entry is free */
+	uint32_t offset;				/**< @brief Offset of the pixels in the cache */
+	uint32_t size;					/**< @brief Size of the pixels in bytes */
+	uint32_t lastLoad;				/**< @brief Load count at the last load of the image */
+} image_cache_entry_t;
 /********************************************************************************
  * Static Variables
  *******************************************************************************/
-
+/** Decoded images, placed after the frame buffer */
+static uint8_t imageCache[IMAGE_CACHE_SIZE] __attribute__((aligned(4), section(".FrameBuffer")));
+static image_cache_entry_t cacheEntries[IMAGE_CACHE_ENTRIES];
+static image_cache_stats_t cacheStats = {0};
+static uint32_t loadCount = 0;
 /********************************************************************************
  * Global Variables
  *******************************************************************************/
@@ -51,7 +66,248 @@
 /********************************************************************************
  * Code
  *******************************************************************************/
+/**
+ * @brief Get the size of a pixel.
+ * @param pixelFormat Pixel format (LTDC_Pixelformat).
+ * @return Size of the pixel in bytes. 0 if the format is unknown.
+ */
+uint32_t Image_GetPixelSize(uint32_t pixelFormat)
+{
+	switch (pixelFormat)
+	{
+	case LTDC_PIXEL_FORMAT_ARGB8888:
+		return 4;
+	case LTDC_PIXEL_FORMAT_RGB888:
+		return 3;
+	case LTDC_PIXEL_FORMAT_RGB565:
+	case LTDC_PIXEL_FORMAT_ARGB1555:
+	case LTDC_PIXEL_FORMAT_ARGB4444:
+	case LTDC_PIXEL_FORMAT_AL88:
+		return 2;
+	case LTDC_PIXEL_FORMAT_L8:
+	case LTDC_PIXEL_FORMAT_AL44:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+/**
+ * @brief Repeat a pixel.
+ * @param dst Destination of the pixels.
+ * @param pixel Pixel to be repeated.
+ * @param size Size of the repeated pixels in bytes.
+ * @param pixelSize Size of the pixel in bytes.
+ */
+static void FillPixels(uint8_t* dst, const uint8_t* pixel, uint32_t size, uint32_t pixelSize)
+{
+	memcpy(dst, pixel, pixelSize);
+	// double the written pixels till the end
+	for (uint32_t filled = pixelSize; filled < size; filled *= 2)
+		memcpy(dst + filled, dst, (size - filled) < filled ? (size - filled) : filled);
+}
+
+/**
+ * @brief Copy the pixels of the row above.
+ * @param dst Destination of the pixels.
+ * @param rowSize Size of a row in bytes.
+ * @param size Size of the copied pixels in bytes, which can be more than a row for narrow images.
+ */
+static void CopyRowAbove(uint8_t* dst, uint32_t rowSize, uint32_t size)
+{
+	for (uint32_t copied = 0; copied < size; copied += rowSize)
+		memcpy(dst + copied, dst + copied - rowSize, (size - copied) < rowSize ? (size - copied) : rowSize);
+}
+
+/**
+ * @brief Decode an image into a buffer.
+ * @details The data is decoded in a single pass from start to end, writing each row of the image to the buffer once,
+ * so the buffer can be the memory read by the LTDC layer. Uncompressed images are copied.
+ * @param img Image to be decoded.
+ * @param buff Buffer receiving the pixels row by row.
+ * @param buffSize Size of the buffer in bytes.
+ * @return <c>ERR_OK</c> if successful, <c>ERR_OUT_OF_RANGE</c> if the buffer is too small,
+ * else <c>ERR_ILLEGAL</c> for unknown formats and corrupt data.
+ */
+device_err_t Image_Decode(const image_info_t* img, uint8_t* buff, uint32_t buffSize)
+{
+	uint32_t pixelSize = Image_GetPixelSize(img->pixelFormat);
+	uint32_t rowSize = img->width * pixelSize;
+	uint32_t size = rowSize * img->height;
+	if (pixelSize == 0)
+		return ERR_ILLEGAL;
+	if (buffSize < size)
+		return ERR_OUT_OF_RANGE;
+	if (img->compression == IMAGE_UNCOMPRESSED)
+	{
+		memcpy(buff, img->data, size);
+		return ERR_OK;
+	}
+	if (img->compression != IMAGE_COMPRESSED_RLE)
+		return ERR_ILLEGAL;
 
+	const uint8_t* src = img->data;
+	const uint8_t* srcEnd = src + img->dataSize;
+	uint8_t* dst = buff;
+	uint8_t* dstEnd = buff + size;
+	while (dst < dstEnd)
+	{
+		if (src == srcEnd)
+			return ERR_ILLEGAL;
+		uint8_t control = *src++;
+		uint32_t len;
+		if ((control & RLE_LITERAL_MASK) == 0)
+		{
+			len = (control + 1) * pixelSize;
+			if (len > (uint32_t)(srcEnd - src) || len > (uint32_t)(dstEnd - dst))
+				return ERR_ILLEGAL;
+			memcpy(dst, src, len);
+			src += len;
+		}
+		else
+		{
+			len = ((control & RLE_COUNT_MASK) + 2) * pixelSize;
+			if (len > (uint32_t)(dstEnd - dst))
+				return ERR_ILLEGAL;
+			if ((control & RLE_COPY_MASK) == 0)
+			{
+				if (pixelSize > (uint32_t)(srcEnd - src))
+					return ERR_ILLEGAL;
+				FillPixels(dst, src, len, pixelSize);
+				src += pixelSize;
+			}
+			else
+			{
+				if ((uint32_t)(dst - buff) < rowSize)
+					return ERR_ILLEGAL;
+				CopyRowAbove(dst, rowSize, len);
+			}
+		}
+		dst += len;
+	}
+	return ERR_OK;
+}
 
+/**
+ * @brief Find a free space in the cache.
+ * @param size Required size in bytes.
+ * @return Offset of the space in the cache. -1 if not available.
+ */
+static int32_t FindFreeSpace(uint32_t size)
+{
+	// the space can start at the start of the cache or after any decoded image
+	for (int i = -1; i < IMAGE_CACHE_ENTRIES; i++)
+	{
+		uint32_t offset = 0;
+		if (i >= 0)
+		{
+			if (cacheEntries[i].img == NULL)
+				continue;
+			offset = (cacheEntries[i].offset + cacheEntries[i].size + 3) & ~3U;
+		}
+		if (offset + size > IMAGE_CACHE_SIZE)
+			continue;
+		bool isFree = true;
+		for (int j = 0; j < IMAGE_CACHE_ENTRIES && isFree; j++)
+			isFree = cacheEntries[j].img == NULL || offset + size <= cacheEntries[j].offset
+					|| cacheEntries[j].offset + cacheEntries[j].size <= offset;
+		if (isFree)
+			return (int32_t)offset;
+	}
+	return -1;
+}
+
+/**
+ * @brief Remove the least recently loaded image from the cache.
+ * @return <c>true</c> if an image was removed, <c>false</c> if the cache is empty.
+ */
+static bool RemoveLeastRecent(void)
+{
+	image_cache_entry_t* oldest = NULL;
+	for (int i = 0; i < IMAGE_CACHE_ENTRIES; i++)
+	{
+		if (cacheEntries[i].img != NULL && (oldest == NULL || cacheEntries[i].lastLoad < oldest->lastLoad))
+			oldest = &cacheEntries[i];
+	}
+	if (oldest == NULL)
+		return false;
+	oldest->img = NULL;
+	cacheStats.usedSize -= oldest->size;
+	cacheStats.evictions++;
+	return true;
+}
+
+/**
+ * @brief Get a free entry of the cache.
+ * @return Pointer to the entry. NULL if all entries are used.
+ */
+static image_cache_entry_t* GetFreeEntry(void)
+{
+	for (int i = 0; i < IMAGE_CACHE_ENTRIES; i++)
+	{
+		if (cacheEntries[i].img == NULL)
+			return &cacheEntries[i];
+	}
+	return NULL;
+}
+
+/**
+ * @brief Get the pixels of an image for display.
+ * @details Uncompressed images are displayed from their data. Compressed images are decoded into the image cache,
+ * unless already decoded. If the cache has no space for the image, the least recently loaded images are removed.
+ * Load the images of a screen each time the screen is loaded, as the pixels may be removed by the images of other
+ * screens.
+ * @param img Image to be displayed.
+ * @return Pointer to the pixels. NULL if the image doesn't fit in the cache or its data is corrupt.
+ */
+const uint8_t* Image_Load(const image_info_t* img)
+{
+	if (img->compression == IMAGE_UNCOMPRESSED)
+		return img->data;
+
+	loadCount++;
+	for (int i = 0; i < IMAGE_CACHE_ENTRIES; i++)
+	{
+		if (cacheEntries[i].img == img)
+		{
+			cacheEntries[i].lastLoad = loadCount;
+			cacheStats.hits++;
+			return &imageCache[cacheEntries[i].offset];
+		}
+	}
+
+	cacheStats.misses++;
+	uint32_t size = img->width * img->height * Image_GetPixelSize(img->pixelFormat);
+	image_cache_entry_t* entry;
+	int32_t offset;
+	while ((entry = GetFreeEntry()) == NULL || (offset = FindFreeSpace(size)) < 0)
+	{
+		if (!RemoveLeastRecent())
+		{
+			cacheStats.failures++;
+			return NULL;
+		}
+	}
+	if (Image_Decode(img, &imageCache[offset], size) != ERR_OK)
+	{
+		cacheStats.failures++;
+		return NULL;
+	}
+	entry->img = img;
+	entry->offset = (uint32_t)offset;
+	entry->size = size;
+	entry->lastLoad = loadCount;
+	cacheStats.usedSize += size;
+	return &imageCache[offset];
+}
+
+/**
+ * @brief Get the usage statistics of the image cache.
+ * @param stats Structure to be filled with the statistics.
+ */
+void Image_GetCacheStats(image_cache_stats_t* stats)
+{
+	*stats = cacheStats;
+}
 
 /* EOF */
@@ -68,7 +68,6 @@ ltdc_layer_info_t defaultLayer =
 		.posY = 0,
 		.width = DISPLAY_WIDTH_RAM,
 		.height = DISPLAY_HEIGHT_RAM,
-		.PixelFormat = 0,
 		.xAlign = ALIGN_LEFT_X,
 		.yAlign = ALIGN_UP_Y,
 		.PixelFormat = RAM_PIXEL_FORMAT
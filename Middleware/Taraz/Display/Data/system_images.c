@@ -41,273 +41,837 @@
 /********************************************************************************
  * Static Variables
  *******************************************************************************/
-// array size is 57240
-static const uint32_t Taraz_Logo[] __attribute__((section(".SystemImages"))) = {
-		0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0dd8d8d8, 0x52cdcdcd, 0xa4cdcdcd, 0xd9cecece, 0xeacecece, 0xedcecece, 0xedcecece, 0xedcecece, 0xdbcecece, 0xadcecece, 0x5acfcfcf, 0x11d2d2d2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x19cccccc, 0x66cdcdcd, 0xb2cecece, 0xe0cecece, 0xedcecece, 0xedcecece, 0xedcecece, 0xeacecece, 0xd7cecece, 0x9fcdcdcd, 0x47cdcdcd, 0x09c6c6c6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xedcecece, 0xedcecece, 0xedcecece, 0xc2cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0x3fc60000, 0x8bc60000, 0xc1c80000, 0xedc70000, 0xf3c70000, 0xf2c70000, 0xf2c70000, 0xf2c70000, 0xf2c70000, 0xf2c70000, 0xf2c70000, 0xeec70000, 0xc6c80000, 0x8fc80000, 0x51c60000, 0x0bd10000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x28c60000, 0x6cc60000, 0x78c80000, 0x78c80000, 0x78c80000, 0x78c80000, 0x79c60000, 0x6ac80000, 0x3fc60000, 0x02ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02ff0000, 0x4cc60000, 0x82c60000, 0x97c70000, 0x9fc70000, 0x9dc80000, 0x8dc70000, 0x6ac80000, 0x18ca0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x44c70000, 0x63c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x62c60000, 0x5ec60000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x21c90000, 0x6bc80000, 0xaec70000, 0xddc60000, 0xf3c70000, 0xf2c70000, 0xf2c70000, 0xf2c70000, 0xf2c70000, 0xf2c70000, 0xf2c70000, 0xf1c70000, 0xdbc70000, 0xa8c70000, 0x6ac80000, 0x26c90000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1fb5b5b5, 0x7db4b4b4, 0x9bb3b3b3, 0x9fb4b4b4, 0x94b3b3b3, 0x67b2b2b2, 0x08bfbfbf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04bfbfbf, 0x6bb3b3b3, 0x95b4b4b4, 0x9fb4b4b4, 0x9bb3b3b3, 0x7bb2b2b2, 0x20afafaf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x66b4b4b4, 0x94b3b3b3, 0x9eb3b3b3, 0x9cb4b4b4, 0x84b4b4b4, 0x2ab0b0b0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0x27b1b1b1, 0x63b2b2b2, 0x97b3b3b3, 0xc2b3b3b3, 0xe6b3b3b3, 0xf2b3b3b3, 0xf2b3b3b3, 0xf2b3b3b3, 0xf2b3b3b3, 0xf2b3b3b3, 0xf1b3b3b3, 0xd9b3b3b3, 0xb2b3b3b3, 0x76b3b3b3, 0x2cb4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0eb6b6b6, 0x70b4b4b4, 0xafb3b3b3, 0xdbb3b3b3, 0xf1b3b3b3, 0xf2b3b3b3, 0xf3b3b3b3, 0xeab3b3b3, 0xc5b3b3b3, 0x88b2b2b2, 0x22b4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3bb1b1b1, 0x8bb4b4b4, 0x9db3b3b3, 0x9eb3b3b3, 0x92b2b2b2, 0x55b4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cccccc, 0x58b4b4b4, 0x93b3b3b3, 0x9eb3b3b3, 0x9cb4b4b4, 0x86b3b3b3, 0x2eb1b1b1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x42b2b2b2, 0x8bb4b4b4, 0x9eb3b3b3, 0x9eb3b3b3, 0x8bb4b4b4, 0x43b3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x30cfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x51cdcdcd, 0x4ececece, 0x4ececece, 0x4ececece, 0x4ececece, 0x4ececece, 0x4ececece, 0x4ececece, 0x4ececece, 0x4ececece, 0x4ececece, 0x4dcdcdcd, 0x0ec8c8c8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16d1d1d1, 0x8dcecece, 0xe0cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xe2cecece, 0x7bcdcdcd, 0x04bfbfbf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03aaaaaa, 0x47cdcdcd, 0x52cdcdcd, 0x52cdcdcd, 0x52cdcdcd, 0x52cdcdcd, 0x52cdcdcd, 0x52cdcdcd, 0x52cdcdcd, 0x52cdcdcd, 0x52cdcdcd, 0x23cccccc, 0x00000000, 0x1fcecece, 0x50cfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x49cecece, 0x03aaaaaa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x28cccccc, 0xa6cecece, 0xebcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xd7cecece, 0x61cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09c6c6c6, 0x4ccdcdcd, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x4fcfcfcf, 0x49cecece, 0x06d5d5d5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd5cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1fc50000, 0x79c60000, 0xdbc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xeac70000, 0x99c60000, 0x43c60000, 0x01ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6fc80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xcbc60000, 0x34c90000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01ff0000, 0x8dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xefc80000, 0x08bf0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2ac80000, 0xf2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xfbc70000, 0x53c80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x06d50000, 0x53c80000, 0xb2c70000, 0xfcc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xfec70000, 0xbac70000, 0x6ac80000, 0x0fcc0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb2b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x49b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5ab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xa5b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x53b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xc9b3b3b3, 0x02808080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3fb2b2b2, 0x84b4b4b4, 0xd3b3b3b3, 0xfeb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xbfb3b3b3, 0x5ab3b3b3, 0x07b6b6b6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x23b6b6b6, 0xe0b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf6b3b3b3, 0x8cb3b3b3, 0x07b6b6b6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0db1b1b1, 0xe9b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x31b1b1b1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x38b2b2b2, 0xfeb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xeab3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xfcb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc0cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x78cecece, 0x00000000, 0x00000000, 0x00000000, 0x67cdcdcd, 0xe4cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xafcdcdcd, 0x0bd1d1d1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1bd0d0d0, 0xfacecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x54cecece, 0x00000000, 0x8bcdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x4acfcfcf, 0x00000000, 0x00000000, 0x0acccccc, 0x8bcdcdcd, 0xf2cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x94cfcfcf, 0x02ffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x30cfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xd7cecece, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7cc70000, 0xf4c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xfdc70000, 0xbec70000, 0x23c50000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2cc50000, 0xf5c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xf0c70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb4c60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x55c60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xd4c60000, 0x0dc40000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x27c40000, 0xcac70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe8c70000, 0x5fc70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc4b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x55b4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6eb2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xaeb3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x65b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xceb3b3b3, 0x06aaaaaa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x19b8b8b8, 0xb4b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xd2b3b3b3, 0x2fb3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6eb2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xc6b3b3b3, 0x01ffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3fb2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf6b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x07dbdbdb, 0xddcfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x61cdcdcd, 0xbacecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xaecfcfcf, 0x00000000, 0x16d1d1d1, 0xb3cfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xaecfcfcf, 0x04bfbfbf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x35cfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf7cecece, 0x23cccccc, 0x00000000, 0x29cdcdcd, 0xe3cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x81cecece, 0x00000000, 0x2fcecece, 0xd0cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x8dcecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x57cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x90cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x25c80000, 0xcbc60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xf6c70000, 0x4fc80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5dc80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe5c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x73c80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe5c70000, 0x1ec30000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x74c80000, 0xf6c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xaec70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8db3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf7b3b3b3, 0x68b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x89b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x96b3b3b3, 0x02808080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3eb5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x23cccccc, 0xf7cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf7cecece, 0x16d1d1d1, 0x3dcdcdcd, 0xfdcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x98cecece, 0x26d0d0d0, 0xdacecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x77cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xcccecece, 0x02ffffff, 0x00000000, 0x00000000, 0x76cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x5fcfcfcf, 0x43cecece, 0xefcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x56cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x97cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x64cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x23c50000, 0xecc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xc5c70000, 0x0acc0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ec70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x81c80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7ec60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x85c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x45c80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb2b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf5b3b3b3, 0xe5b3b3b3, 0xddb3b3b3, 0xdbb3b3b3, 0xe2b3b3b3, 0xf2b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x62b4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x88b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf8b3b3b3, 0x1db0b0b0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3eb5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x59cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xcccecece, 0x00000000, 0x01ffffff, 0xd5cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xcfcecece, 0xe5cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xe9cecece, 0x1acecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xa2cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x8fcfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x26d0d0d0, 0xf8cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xc0cecece, 0xf6cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xcdcecece, 0x03aaaaaa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cccccc, 0xd3cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x42cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x23c50000, 0xe9c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xecc70000, 0x15c20000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ec70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x21c90000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x70c60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7dc80000, 0xfec70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x7ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb5b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xeab3b3b3, 0xa6b4b4b4, 0x65b3b3b3, 0x34b5b5b5, 0x10afafaf, 0x04bfbfbf, 0x00000000, 0x00000000, 0x01ffffff, 0x0eb6b6b6, 0x30b5b5b5, 0x73b4b4b4, 0xcfb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf8b3b3b3, 0x49b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x64b2b2b2, 0xffb3b3b3, 0xe0b3b3b3, 0x8db3b3b3, 0x4db3b3b3, 0x3bb1b1b1, 0x4ab3b3b3, 0x8eb4b4b4, 0xf6b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x80b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3eb5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x9ccecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x92cecece, 0x00000000, 0x00000000, 0xc5cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x7acfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08bfbfbf, 0xdacecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x64cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x17d3d3d3, 0xf1cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x4ececece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1dcacaca, 0xf3cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xeccecece, 0x16d1d1d1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xfdc70000, 0x1ac40000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x86c80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x50c60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3fc60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x94c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x95b4b4b4, 0xffb3b3b3, 0xf4b3b3b3, 0x9eb3b3b3, 0x4eb4b4b4, 0x0caaaaaa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5ab3b3b3, 0xddb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xe0b3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11b4b4b4, 0x47b4b4b4, 0x06aaaaaa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2fb3b3b3, 0xfdb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xe3b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3eb5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc7cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x65cfcfcf, 0x00000000, 0x0dd8d8d8, 0xe3cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xafcdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x21d1d1d1, 0xf6cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x42cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x38cdcdcd, 0xfececece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x93cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x37cccccc, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xb6cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x65c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xf8c70000, 0xcec70000, 0xb2c70000, 0xa8c70000, 0xafc80000, 0xbfc70000, 0xdfc70000, 0xfcc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xfec70000, 0x1ac40000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x0acc0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x27c40000, 0xeec70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xebc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xfec70000, 0xe2c70000, 0xbbc70000, 0xaac80000, 0xacc70000, 0xb8c80000, 0xcfc80000, 0xf4c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x96c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x22b4b4b4, 0x67b2b2b2, 0x1cb6b6b6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xddb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x7db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7eb2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3eb5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0bd1d1d1, 0xe8cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x44cecece, 0x00000000, 0x3bcfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xb4cdcdcd, 0x6ccdcdcd, 0x4fcfcfcf, 0x37cccccc, 0x36d0d0d0, 0x4dcdcdcd, 0x66cdcdcd, 0xaecfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xcecdcdcd, 0x03aaaaaa, 0x00000000, 0x00000000, 0x00000000, 0x3dcdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xeececece, 0x18cacaca, 0x00000000, 0x00000000, 0x00000000, 0x71cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf8cecece, 0xa1cecece, 0x64cfcfcf, 0x4dcdcdcd, 0x35cfcfcf, 0x3bcfcfcf, 0x51cdcdcd, 0x6fcfcfcf, 0xc5cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xafcdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x66cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x84cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0acc0000, 0xf5c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xd3c70000, 0x52c70000, 0x15c20000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03aa0000, 0x1dca0000, 0x4cc60000, 0xa2c60000, 0xf2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xfec70000, 0x1ac40000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xaec70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2ac80000, 0x40c70000, 0x3fc60000, 0x3fc60000, 0x3fc60000, 0x3fc60000, 0x3fc60000, 0x3fc60000, 0x3fc60000, 0x3fc60000, 0x3fc60000, 0x3fc60000, 0x3fc60000, 0x3fc60000, 0x3fc60000, 0x3fc60000, 0x3fc60000, 0x3fc60000, 0xc6c80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x74c80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xf4c70000, 0x87c60000, 0x27c40000, 0x04bf0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10bf0000, 0x34c90000, 0x7bc70000, 0xd7c70000, 0xfec70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x96c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x14b3b3b3, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf9b3b3b3, 0x09aaaaaa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x31b1b1b1, 0xf7b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x20afafaf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3eb5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x28cccccc, 0xdbcecece, 0xddcfcfcf, 0xddcfcfcf, 0xddcfcfcf, 0xddcfcfcf, 0xddcfcfcf, 0xddcfcfcf, 0xddcfcfcf, 0xddcfcfcf, 0xddcfcfcf, 0xddcfcfcf, 0xddcfcfcf, 0xddcfcfcf, 0xddcfcfcf, 0xddcfcfcf, 0xddcfcfcf, 0xddcfcfcf, 0xddcfcfcf, 0xddcfcfcf, 0xd7cecece, 0xfccecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf3cecece, 0x18cacaca, 0x00000000, 0x73cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xbdcecece, 0x42cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ccdcdcd, 0xfbcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xdececece, 0x09c6c6c6, 0x00000000, 0x00000000, 0x00000000, 0x73cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xbbcecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x9acdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xa4cdcdcd, 0x30cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x06d5d5d5, 0x96cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xb4cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xa5cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x5ececece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ac80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x9fc70000, 0x0bd10000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16c50000, 0x7fc70000, 0xdfc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xefc80000, 0x16c50000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xf4c70000, 0x36c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb1c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0bd10000, 0xcac70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe8c70000, 0x30c50000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04bf0000, 0x4ec70000, 0xb9c60000, 0xfcc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x81c80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x63b2b2b2, 0xfcb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x66b4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x17b1b1b1, 0xdeb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3ab4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3eb5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cccccc, 0x0bd1d1d1, 0x09c6c6c6, 0x09c6c6c6, 0x09c6c6c6, 0x09c6c6c6, 0x09c6c6c6, 0x09c6c6c6, 0x09c6c6c6, 0x09c6c6c6, 0x09c6c6c6, 0x09c6c6c6, 0x09c6c6c6, 0x09c6c6c6, 0x09c6c6c6, 0x09c6c6c6, 0x09c6c6c6, 0x09c6c6c6, 0x09c6c6c6, 0x01ffffff, 0x6dcecece, 0xfbcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfbcecece, 0x5ccdcdcd, 0x00000000, 0x00000000, 0x9fcdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x9dcecece, 0x07dbdbdb, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb1cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xd9cecece, 0x06d5d5d5, 0x00000000, 0x00000000, 0x00000000, 0xb3cfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x84cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xbfcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x79cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x07dbdbdb, 0xd4cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xb3cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0acccccc, 0xdececece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x37cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xadc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xd1c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x07b60000, 0x86c80000, 0xf8c70000, 0xffc70000, 0xcec70000, 0x0cbf0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xa8c70000, 0x01ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1fc50000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xfdc70000, 0x2fc90000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x42c90000, 0xd8c80000, 0xffc70000, 0xffc70000, 0x51c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08bfbfbf, 0xe8b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x03aaaaaa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0ab3b3b3, 0xd1b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x4cb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3eb5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x66cdcdcd, 0xfacecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf0cecece, 0x4fcfcfcf, 0x00000000, 0x00000000, 0x00000000, 0xc2cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xadcecece, 0x01ffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x89cfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xc0cecece, 0x00000000, 0x00000000, 0x00000000, 0x10cfcfcf, 0xe8cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x5ececece, 0x00000000, 0x00000000, 0x00000000, 0x13c9c9c9, 0xebcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x87cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xa7cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xa4cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x25cfcfcf, 0xfacecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xe3cecece, 0x0dd8d8d8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xd4c60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x38c80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2ec80000, 0x7ec60000, 0x41c80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x2dc60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5fc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xb0c60000, 0x04bf0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0bd10000, 0x69c70000, 0x75c60000, 0x03aa0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x9ab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xddb3b3b3, 0x10afafaf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3eb5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x71cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xeacecece, 0x44cecece, 0x00000000, 0x00000000, 0x00000000, 0x16d1d1d1, 0xedcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xe2cecece, 0x13c9c9c9, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8bcdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xa1cecece, 0x00000000, 0x00000000, 0x00000000, 0x29cdcdcd, 0xfccecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x38cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x47cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xc9cecece, 0x02ffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xa9cfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x81cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x42cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xabcecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xf0c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe5c70000, 0x14cc0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xd0c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x9cc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x72c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x1bb3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3eb5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x85cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xe4cecece, 0x34cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4acfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x65cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xa2cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x69cecece, 0x00000000, 0x00000000, 0x00000000, 0x4bcfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xe3cecece, 0x0ec8c8c8, 0x00000000, 0x00000000, 0x00000000, 0x7ececece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf8cecece, 0x3acfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc7cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfececece, 0x3ccccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7ececece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x74cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xd0c70000, 0x0ec80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xfbc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x56c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc4c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x55c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3cb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3eb5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01ffffff, 0x8bcdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xdacecece, 0x2fcecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7ececece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xe1cecece, 0x08bfbfbf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16d1d1d1, 0xe3cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xeacecece, 0x18cacaca, 0x00000000, 0x00000000, 0x00000000, 0x80cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xafcdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x9fcdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xc7cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3dcdcdcd, 0xfacecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xcbcecece, 0x03aaaaaa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xbacecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x54cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xd9c70000, 0x10bf0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x9fc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xc6c80000, 0x0acc0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xd7c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x62c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x69b4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3eb5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03aaaaaa, 0x92cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xd5cecece, 0x25cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xa2cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x96cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x9ccecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x91cecece, 0x00000000, 0x00000000, 0x00000000, 0x01ffffff, 0xc1cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x6dcecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc4cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x63cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09c6c6c6, 0xc4cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x6ececece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x10cfcfcf, 0xe8cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf9cecece, 0x29cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x36c60000, 0xf3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x4dc70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xd6c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xa0c70000, 0x01ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xe8b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x8db3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3eb5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0acccccc, 0x9ccecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xcecdcdcd, 0x20cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01ffffff, 0xc7cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfdcecece, 0x38cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x06d5d5d5, 0x87cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xebcecece, 0x21d1d1d1, 0x00000000, 0x00000000, 0x00000000, 0x14cccccc, 0xeccecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x39cecece, 0x00000000, 0x00000000, 0x00000000, 0x19cccccc, 0xefcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xeececece, 0x15cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x18cacaca, 0xa8cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xcecdcdcd, 0x08bfbfbf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2acecece, 0xfccecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xd0cecece, 0x04bfbfbf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xcdc70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x30c50000, 0x97c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xf1c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xbfc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xfac70000, 0x35c50000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x06aaaaaa, 0x14b3b3b3, 0x14b3b3b3, 0x14b3b3b3, 0x14b3b3b3, 0x14b3b3b3, 0x14b3b3b3, 0x14b3b3b3, 0x14b3b3b3, 0x14b3b3b3, 0x14b3b3b3, 0x14b3b3b3, 0x14b3b3b3, 0x14b3b3b3, 0x14b3b3b3, 0x14b3b3b3, 0x14b3b3b3, 0x14b3b3b3, 0x14b3b3b3, 0x14b3b3b3, 0x14b3b3b3, 0x14b3b3b3, 0x07b6b6b6, 0xdeb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xa0b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3eb5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0ec8c8c8, 0xaccecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xc0cecece, 0x18cacaca, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1bd0d0d0, 0xf0cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xe1cecece, 0x09c6c6c6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04bfbfbf, 0x4acfcfcf, 0xc0cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x6dcecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2dcccccc, 0xfdcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf6cecece, 0x1ecccccc, 0x00000000, 0x00000000, 0x00000000, 0x4dcdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xcbcecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0fcccccc, 0x5ccdcdcd, 0xd9cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfacecece, 0x47cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4ececece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x98cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xecc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xa6c80000, 0x09c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x38c80000, 0x2cc50000, 0xfec70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x75c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x92c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xf2c70000, 0x2bca0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x52b4b4b4, 0xe4b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xf7b3b3b3, 0xfdb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xaeb3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3eb5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11d2d2d2, 0xb2cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xb7cecece, 0x0ec8c8c8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x51cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xc5cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x12d5d5d5, 0x33cdcdcd, 0x54cecece, 0x7dcecece, 0xcecdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xa2cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x56cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xd3cdcdcd, 0x06d5d5d5, 0x00000000, 0x00000000, 0x00000000, 0x82cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x9dcecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02ffffff, 0x1acecece, 0x3acfcfcf, 0x5bcfcfcf, 0x8ccecece, 0xdececece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x7ccecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8acdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x69cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xcbc60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xd1c70000, 0x2ec80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x3fc60000, 0x00000000, 0xbac70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe0c70000, 0x1ac40000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4bc90000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xf4c70000, 0x74c80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0ab3b3b3, 0xfeb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xafb3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3eb5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x15cecece, 0xb8cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xaccecece, 0x0bd1d1d1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x89cfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x86cecece, 0x00000000, 0x36d0d0d0, 0x58cecece, 0x73cecece, 0x9bcecece, 0xc6cecece, 0xe5cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xb6cecece, 0x09c6c6c6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x95cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x97cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xa8cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x4dcdcdcd, 0x0acccccc, 0x40cfcfcf, 0x5dcecece, 0x79cfcfcf, 0xa4cdcdcd, 0xd1cecece, 0xedcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x98cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03aaaaaa, 0xcccecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x48cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x99c60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xf8c70000, 0x9fc70000, 0x2bca0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x46c80000, 0x00000000, 0x20c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x7ac70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16c50000, 0xf3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xc7c70000, 0x59c60000, 0x02ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x32b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xa0b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3eb5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x26d0d0d0, 0xc6cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x99cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xaacecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xa6cecece, 0xbfcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xa4cdcdcd, 0x0bd1d1d1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cccccc, 0xd1cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x58cecece, 0x00000000, 0x00000000, 0x00000000, 0x02ffffff, 0xcfcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfbcecece, 0x93cecece, 0xd5cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfececece, 0x89cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x19cccccc, 0xf1cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf2cdcdcd, 0x1dcacaca, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3dc90000, 0xfec70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xfbc70000, 0xa2c60000, 0x33c80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x4dc70000, 0x00000000, 0x00000000, 0xabc60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x02ff0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb1c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04bf0000, 0xa8c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xd0c70000, 0x5cc80000, 0x08bf0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x39b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x8cb3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3eb5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x21d1d1d1, 0xd5cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x95cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03aaaaaa, 0xd0cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf0cecece, 0x83cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1dcacaca, 0xf5cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfececece, 0x31d0d0d0, 0x00000000, 0x00000000, 0x00000000, 0x22cbcbcb, 0xf6cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xe6cecece, 0x5ececece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x32cccccc, 0xfececece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xc8cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb9c60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xc0c70000, 0x58c80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x55c60000, 0x00000000, 0x00000000, 0x3cc80000, 0xf6c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xa2c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3fc60000, 0x4cc60000, 0x4bc90000, 0x4bc90000, 0x4bc90000, 0x4bc90000, 0x4bc90000, 0x4bc90000, 0x4bc90000, 0x4bc90000, 0x4bc90000, 0x4bc90000, 0x4bc90000, 0x4bc90000, 0x4bc90000, 0xc9c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2ec80000, 0xfec70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe3c70000, 0x84c70000, 0x18ca0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x31b1b1b1, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf6b3b3b3, 0x82b3b3b3, 0x71b2b2b2, 0x71b2b2b2, 0x71b2b2b2, 0x71b2b2b2, 0x71b2b2b2, 0x71b2b2b2, 0x71b2b2b2, 0x71b2b2b2, 0x71b2b2b2, 0x71b2b2b2, 0x71b2b2b2, 0x71b2b2b2, 0x71b2b2b2, 0x71b2b2b2, 0x71b2b2b2, 0x71b2b2b2, 0x69b4b4b4, 0xe9b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x66b4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16aeaeae, 0xecb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x3db4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3eb5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x25cfcfcf, 0xd7cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x8ecfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x27d1d1d1, 0xf7cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf2cdcdcd, 0xabcecece, 0x2acecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x36d0d0d0, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf0cecece, 0x19cccccc, 0x00000000, 0x00000000, 0x00000000, 0x5ccdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xeacecece, 0x97cecece, 0x1acecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5fcfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x85cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x13c90000, 0xf0c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xcbc60000, 0x5ec60000, 0x03aa0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x52c70000, 0x00000000, 0x00000000, 0x00000000, 0xbdc60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xf2c70000, 0x2dc60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x56c70000, 0xfec70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x84c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xf2c70000, 0x85c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x23b6b6b6, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xeeb3b3b3, 0x20afafaf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xedb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x36b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x15b6b6b6, 0xebb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x42b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3eb5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x32cccccc, 0xdececece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x82cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf3cecece, 0xd3cdcdcd, 0x89cfcfcf, 0x24cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6acfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xcbcecece, 0x02ffffff, 0x00000000, 0x00000000, 0x00000000, 0x90cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf0cecece, 0xcbcecece, 0x79cfcfcf, 0x18cacaca, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xa1cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x4acfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4ac80000, 0xf7c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xcfc80000, 0x3ac60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x57c70000, 0x00000000, 0x00000000, 0x00000000, 0x1ec30000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x9dc80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x9ec70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb1c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xf6c70000, 0x7bc70000, 0x04bf0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0caaaaaa, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf2b3b3b3, 0x2eb1b1b1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x19b8b8b8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0eb6b6b6, 0xeab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x55b4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3db4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3ccccccc, 0xeacecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfececece, 0x6ececece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x91cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfececece, 0xe9cecece, 0xd7cecece, 0xc6cecece, 0x9fcdcdcd, 0x5ececece, 0x21d1d1d1, 0x03aaaaaa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb8cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x88cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb0cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfdcecece, 0xe7cecece, 0xd3cdcdcd, 0xc1cecece, 0x95cdcdcd, 0x56cdcdcd, 0x1cd1d1d1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x07dbdbdb, 0xd9cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfbcecece, 0x28cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x50c60000, 0xfcc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xfac70000, 0x9dc80000, 0x07b60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x60c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xa0c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x23c50000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04bf0000, 0xb0c60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0ec80000, 0xb0c60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xd1c70000, 0x38c80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xf9b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf9b3b3b3, 0x47b4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x42b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xd5b4b4b4, 0x0eb6b6b6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03aaaaaa, 0xe7b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x72b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x42b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x43cecece, 0xeececece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf8cecece, 0x66cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb2cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf7cecece, 0xdccecece, 0xcacecece, 0xafcdcdcd, 0x8acdcdcd, 0x5ececece, 0x31d0d0d0, 0x13c9c9c9, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x20cfcfcf, 0xf6cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x4ccdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x07dbdbdb, 0xd9cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf2cdcdcd, 0xdacecece, 0xc8cfcfcf, 0xa9cfcfcf, 0x81cecece, 0x59cecece, 0x2dcccccc, 0x10cfcfcf, 0x03aaaaaa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x21d1d1d1, 0xf7cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xe3cecece, 0x0dd8d8d8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3ac60000, 0xddc60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xc9c70000, 0x1bc60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2dc60000, 0xf3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xc3c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x06d50000, 0xb5c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x94c60000, 0xfbc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x54c80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xbfb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x6fb3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xabb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xa2b3b3b3, 0x01ffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xe2b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x9fb4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcfb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4bcfcfcf, 0xf1cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf1cecece, 0x55cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09c6c6c6, 0xdccecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xeccecece, 0x8fcfcfcf, 0x27d1d1d1, 0x08bfbfbf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7fcfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfccecece, 0x2acecece, 0x00000000, 0x00000000, 0x00000000, 0x31d0d0d0, 0xfccecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xe0cecece, 0x7acfcfcf, 0x20cfcfcf, 0x08bfbfbf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3dcdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xb1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x07b60000, 0x91c70000, 0xfbc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe3c70000, 0x0bd10000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xa3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x4bc90000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04bf0000, 0xafc80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x38c80000, 0xdbc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xfcc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x66b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xbdb3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1db0b0b0, 0xeeb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x51b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xbdb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xd5b4b4b4, 0x0eb6b6b6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04bfbfbf, 0xbeb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62cecece, 0xf9cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xeacecece, 0x43cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x35cfcfcf, 0xfececece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xc7cecece, 0x22cbcbcb, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2ecdcdcd, 0xf4cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xe8cecece, 0x10cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x6bcdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xa9cfcfcf, 0x11d2d2d2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x70cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x6fcfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x34c90000, 0xa9c70000, 0xfdc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xc3c70000, 0x05cc0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x17c80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xb8c80000, 0x07b60000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x9ac70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0cbf0000, 0x7bc70000, 0xe5c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x2fc90000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0eb6b6b6, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x27b1b1b1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x86b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xeeb3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7cb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x40b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03aaaaaa, 0xa7b3b3b3, 0xfeb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x68cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xedcecece, 0x3bcfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6bcdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xdfcecece, 0x18cacaca, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08bfbfbf, 0xc3cfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xb4cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x94cfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xc4cecece, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb1cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x3bcfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x30c50000, 0xa5c70000, 0xfec70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xfec70000, 0x74c80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x86c80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x2bca0000, 0x00000000, 0x00000000, 0x05cc0000, 0xb2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4fc80000, 0xfec70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0cbf0000, 0x78c80000, 0xe4c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xddc60000, 0x09c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb8b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xd7b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x36b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x62b4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x26b5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xe3b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x06aaaaaa, 0xb5b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ececece, 0xfdcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xe5cecece, 0x38cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x93cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x81cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09c6c6c6, 0xa7cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x76cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb2cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x56cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0dd8d8d8, 0xe3cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf7cecece, 0x22cbcbcb, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x23c50000, 0x7dc80000, 0xebc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xf5c70000, 0x07b60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x13c90000, 0xe4c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xc7c70000, 0x00000000, 0x00000000, 0x05cc0000, 0xb3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2ec80000, 0x37c70000, 0x36c60000, 0x36c60000, 0x36c60000, 0x36c60000, 0x36c60000, 0x36c60000, 0x36c60000, 0x36c60000, 0x36c60000, 0x36c60000, 0x36c60000, 0x36c60000, 0x36c60000, 0xc3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08bf0000, 0x56c70000, 0xc2c60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xfec70000, 0x6ec70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4db3b3b3, 0xf9b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xa5b3b3b3, 0x07b6b6b6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x44b4b4b4, 0xf4b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x01ffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xe7b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x0ab3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x36b3b3b3, 0xd6b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x78cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xd9cecece, 0x2acecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb8cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x40cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01ffffff, 0x01ffffff, 0x00000000, 0x00000000, 0x00000000, 0x38cdcdcd, 0xc9cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x40cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x0dd8d8d8, 0xe0cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf5cecece, 0x1bd0d0d0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02ffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x26d0d0d0, 0xfacecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xdbcecece, 0x08bfbfbf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0fcc0000, 0x72c70000, 0xdbc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x71c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7fc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x38c80000, 0x00000000, 0x04bf0000, 0xb0c60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb1c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x46c80000, 0xb5c70000, 0xfcc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xd5c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc2b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xbbb3b3b3, 0x29b4b4b4, 0x01ffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0fbbbbbb, 0x7cb3b3b3, 0xf8b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf6b3b3b3, 0x40b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0x36b3b3b3, 0x3fb2b2b2, 0x3fb2b2b2, 0x3fb2b2b2, 0x3fb2b2b2, 0x3fb2b2b2, 0x3fb2b2b2, 0x3fb2b2b2, 0x40b3b3b3, 0xd7b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x7bb2b2b2, 0x3bb1b1b1, 0x3fb2b2b2, 0x3fb2b2b2, 0x3fb2b2b2, 0x20afafaf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6eb2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xc9b3b3b3, 0x43b3b3b3, 0x0fbbbbbb, 0x00000000, 0x00000000, 0x06aaaaaa, 0x31b1b1b1, 0x8bb4b4b4, 0xfeb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf3b3b3b3, 0xf3b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x8acdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xd3cdcdcd, 0x23cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0acccccc, 0xdececece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x46d0d0d0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x32cccccc, 0xc5cecece, 0xcacecece, 0xcacecece, 0xcacecece, 0xcacecece, 0xcacecece, 0xcacecece, 0xa3cfcfcf, 0x04bfbfbf, 0x00000000, 0x00000000, 0x48cdcdcd, 0xf7cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf8cecece, 0x23cccccc, 0x00000000, 0x00000000, 0x00000000, 0x32cccccc, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf6cecece, 0x1dcacaca, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5ccdcdcd, 0xcacecece, 0xcacecece, 0xcacecece, 0xcacecece, 0xcacecece, 0xcacecece, 0xcacecece, 0xcacecece, 0xcbcecece, 0x86cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x48cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xa2cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03aa0000, 0x6dc70000, 0xefc80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xebc70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04bf0000, 0xf2c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xc0c70000, 0x01ff0000, 0x03aa0000, 0xaac80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x32c70000, 0xc6c80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0bb9b9b9, 0xf1b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xfcb3b3b3, 0xc8b2b2b2, 0x7fb3b3b3, 0x58b4b4b4, 0x46b3b3b3, 0x4ab3b3b3, 0x66b4b4b4, 0xa4b3b3b3, 0xefb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x65b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4fb2b2b2, 0xfbb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xd8b3b3b3, 0x0fbbbbbb, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x14b3b3b3, 0xdbb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0xd3b3b3b3, 0xcab3b3b3, 0xe7b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x56b2b2b2, 0xbfb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x92cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xb4cdcdcd, 0x0ec8c8c8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x28cccccc, 0xf9cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x97cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2cd1d1d1, 0xddcfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x84cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x95cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xdececece, 0x0acccccc, 0x00000000, 0x00000000, 0x00000000, 0x5dcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x70cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4ccdcdcd, 0xf4cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x64cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x83cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x62cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ec30000, 0xbfc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x17c80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5bc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xf8c70000, 0x39c50000, 0x02ff0000, 0xa7c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x05cc0000, 0x70c60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x72c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x53b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x36b3b3b3, 0xeab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xfab3b3b3, 0x73b4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x81b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x1bb3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x41b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x5ab3b3b3, 0x00000000, 0xc3b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x00000000, 0x88cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfececece, 0xa3cfcfcf, 0x87cecece, 0x8ecfcfcf, 0x8ecfcfcf, 0x8ecfcfcf, 0x8ecfcfcf, 0x8ecfcfcf, 0x8ecfcfcf, 0x8ecfcfcf, 0x8ecfcfcf, 0x8ecfcfcf, 0x8ecfcfcf, 0x8ecfcfcf, 0x8ecfcfcf, 0x8ecfcfcf, 0x8ecfcfcf, 0x8ecfcfcf, 0x90cdcdcd, 0x3fcecece, 0x00000000, 0x00000000, 0x00000000, 0x32cccccc, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf8cecece, 0x93cecece, 0x26d0d0d0, 0x08bfbfbf, 0x00000000, 0x00000000, 0x00000000, 0x02ffffff, 0x0cd5d5d5, 0x30cfcfcf, 0x92cecece, 0xf0cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf1cecece, 0x25cfcfcf, 0x00000000, 0x00000000, 0x12d5d5d5, 0xe3cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfdcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xa7cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6bcdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf3cecece, 0x7fcfcfcf, 0x1ecccccc, 0x07dbdbdb, 0x00000000, 0x00000000, 0x00000000, 0x04bfbfbf, 0x12d5d5d5, 0x41d0d0d0, 0xa9cfcfcf, 0xfbcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xdbcecece, 0x0fcccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01ffffff, 0xc2cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfececece, 0x34cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0fcc0000, 0xcbc60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x3dc90000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xd5c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xa6c80000, 0x00000000, 0xa1c80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6bc80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xa9c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc2b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x54b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2db5b5b5, 0xe7b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf9b3b3b3, 0x55b4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x89b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x1cb6b6b6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x60b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xebb3b3b3, 0x3bb1b1b1, 0x00000000, 0x00000000, 0xc4b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf5b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x08bfbfbf, 0xe1cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x4dcdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x1fcecece, 0xf4cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf7cecece, 0xdccecece, 0xcdcecece, 0xcacecece, 0xcbcecece, 0xd0cecece, 0xe2cecece, 0xfbcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x7bcdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x61cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xb2cecece, 0xcbcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x66cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4ececece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf2cdcdcd, 0xd9cecece, 0xcccecece, 0xcbcecece, 0xcccecece, 0xd5cecece, 0xe8cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x63cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1ecccccc, 0xf5cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf1cecece, 0x19cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1fc50000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x56c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x56c70000, 0xfbc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x14cc0000, 0x97c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02ff0000, 0xbdc60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xcdc70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xc1b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x54b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x11b4b4b4, 0x8bb4b4b4, 0xfab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xfdb3b3b3, 0x9eb3b3b3, 0x1fb5b5b5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x73b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf6b3b3b3, 0x17b1b1b1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01ffffff, 0x3db4b4b4, 0xe1b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xfbb3b3b3, 0x9ab3b3b3, 0x13aeaeae, 0x00000000, 0x00000000, 0x00000000, 0xc3b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf5b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000,
-		  0x23cccccc, 0xf8cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfbcecece, 0x28cccccc, 0x00000000, 0x00000000, 0x00000000, 0x02ffffff, 0xc4cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xd9cecece, 0x16d1d1d1, 0x00000000, 0x00000000, 0x14cccccc, 0xd7cecece, 0xffcecece, 0xffcecece, 0xe0cecece, 0x3ececece, 0xe7cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x38cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x15cecece, 0xebcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xc1cecece, 0x0cd5d5d5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x47cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xcdcecece, 0x03aaaaaa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xd5c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5bc70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01ff0000, 0xd0c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x9ec70000, 0x84c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62c60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xd5c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xd2b3b3b3, 0xeab3b3b3, 0xecb3b3b3, 0xe3b3b3b3, 0xc5b3b3b3, 0x23b6b6b6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x29b4b4b4, 0x90b3b3b3, 0xcdb3b3b3, 0xfeb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xccb3b3b3, 0x91b3b3b3, 0x31b1b1b1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x29b4b4b4, 0xb7b2b2b2, 0xc2b3b3b3, 0xc2b3b3b3, 0xc2b3b3b3, 0xc2b3b3b3, 0xc2b3b3b3, 0xc2b3b3b3, 0xc2b3b3b3, 0xc2b3b3b3, 0xf2b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xd5b4b4b4, 0xc1b2b2b2, 0xc2b3b3b3, 0xc2b3b3b3, 0xc2b3b3b3, 0x8cb3b3b3, 0x06aaaaaa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0caaaaaa, 0x7eb2b2b2, 0xcbb2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xe6b3b3b3, 0xa1b3b3b3, 0x37b5b5b5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x69b4b4b4, 0xdcb2b2b2, 0xebb3b3b3, 0xebb3b3b3, 0xe1b3b3b3, 0x8fb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x9fb4b4b4, 0xdcb2b2b2, 0xecb3b3b3, 0xecb3b3b3, 0xdbb3b3b3, 0x9fb4b4b4, 0x00000000,
-		  0x41d0d0d0, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xe5cecece, 0x0ec8c8c8, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7acfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfdcecece, 0x4bcfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x80cdcdcd, 0xffcecece, 0xffcecece, 0xf8cecece, 0x3fcecece, 0x38cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xf3cecece, 0x1bd0d0d0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xa2cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xeacecece, 0x28cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x68cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x8bcdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xa2c60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x57c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x36c60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xebc70000, 0x9dc80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x36c60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xd0c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x07b6b6b6, 0x09aaaaaa, 0x03aaaaaa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x24b1b1b1, 0x50b3b3b3, 0x70b4b4b4, 0x82b3b3b3, 0x87b3b3b3, 0x83b3b3b3, 0x72b3b3b3, 0x4fb2b2b2, 0x23b6b6b6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2ab0b0b0, 0x59b2b2b2, 0x79b3b3b3, 0x87b3b3b3, 0x85b2b2b2, 0x70b4b4b4, 0x43b3b3b3, 0x09aaaaaa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01ffffff, 0x08bfbfbf, 0x08bfbfbf, 0x02808080, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x08bfbfbf, 0x08bfbfbf, 0x00000000, 0x00000000, 0x00000000,
-		  0x76cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xb2cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x12d5d5d5, 0xdbcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x75cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x38cdcdcd, 0xf2cdcdcd, 0xffcecece, 0xffcecece, 0x64cfcfcf, 0x00000000, 0x69cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xcfcecece, 0x03aaaaaa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2fcecece, 0xf2cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xefcecece, 0x42cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x96cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x4ececece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xbec70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x3fc60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb7c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xfbc70000, 0xe0c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xadc70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		  0xbccecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x72cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x47cdcdcd, 0xf4cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x86cecece, 0x02ffffff, 0x00000000, 0x00000000, 0x24cdcdcd, 0xd5cecece, 0xffcecece, 0xf5cecece, 0x60cfcfcf, 0x00000000, 0x00000000, 0x98cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x94cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ccdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xd8cdcdcd, 0x3dcdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04bfbfbf, 0xcfcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfccecece, 0x2bd0d0d0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x07b60000, 0x6ac80000, 0x45c80000, 0x04bf0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x1ac40000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x34c90000, 0xf7c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb3c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2dc60000, 0x6ec70000, 0x1ac40000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x9cc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x76c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		  0xe7cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x3dcdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4ccdcdcd, 0xe6cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xe7cecece, 0x63cecece, 0x00000000, 0x00000000, 0x00000000, 0x3fcecece, 0xe1cecece, 0xffcecece, 0xdbcecece, 0x44cecece, 0x00000000, 0x00000000, 0x06d5d5d5, 0xd3cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x53cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ececece, 0xf9cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfccecece, 0x97cecece, 0x1dcacaca, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x26d0d0d0, 0xf9cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xe8cecece, 0x10cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4cc60000, 0xfac70000, 0xffc70000, 0xc6c80000, 0x3bc70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8ac80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xefc80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xacc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb1c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb6c70000, 0xffc70000, 0xf3c70000, 0x88c70000, 0x0acc0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2bca0000, 0xecc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x23c50000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		  0xfbcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x1fcecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x26d0d0d0, 0x93cecece, 0xf2cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xb0cecece, 0x24cdcdcd, 0x00000000, 0x00000000, 0x02ffffff, 0x7ccecece, 0xffcecece, 0xfbcecece, 0x8acdcdcd, 0x1dcacaca, 0x00000000, 0x00000000, 0x00000000, 0x32cccccc, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x2dcccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3bcfcfcf, 0xaacecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xebcecece, 0x91cecece, 0x38cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x50cfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xbbcecece, 0x01ffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ac80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xfcc70000, 0xb4c60000, 0x5bc70000, 0x13c90000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x07b60000, 0x80c70000, 0xf9c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x85c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1fc50000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x13c90000, 0x30c50000, 0x2fc90000, 0x2fc90000, 0x2fc90000, 0x2fc90000, 0x2fc90000, 0x2fc90000, 0x2fc90000, 0x2fc90000, 0x2fc90000, 0x2fc90000, 0x2fc90000, 0x2fc90000, 0x2fc90000, 0x2fc90000, 0x2fc90000, 0x2fc90000, 0xc1c80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xe0c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe1c70000, 0x79c60000, 0x31c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3bc70000, 0xdbc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe2c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		  0x9bcecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa7cecece, 0xa8cecece, 0x92cecece, 0x07dbdbdb, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x27d1d1d1, 0x64cfcfcf, 0xa0cecece, 0xdbcecece, 0xfacecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xeccecece, 0xc9cecece, 0x8ccecece, 0x51cdcdcd, 0x01ffffff, 0x00000000, 0x02ffffff, 0x4ececece, 0xc1cecece, 0xe1cecece, 0x87cecece, 0x2ecdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x38cdcdcd, 0xabcecece, 0xa8cecece, 0xa8cecece, 0xa8cecece, 0xa8cecece, 0xa8cecece, 0xa8cecece, 0xa8cecece, 0xa9cfcfcf, 0xa0cecece, 0x12d5d5d5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3acfcfcf, 0x72cecece, 0xb1cecece, 0xe6cecece, 0xfececece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfececece, 0xeacecece, 0xbfcecece, 0x86cecece, 0x57cdcdcd, 0x1bd0d0d0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x75cfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x7bcdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x78c80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xf1c70000, 0xafc80000, 0x71c70000, 0x4ec70000, 0x3ec50000, 0x3ec50000, 0x54c80000, 0x8ac80000, 0xe0c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x0dc40000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x93c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0bd10000, 0xcac70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xeec70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xfec70000, 0xcac70000, 0x89c70000, 0x5ac60000, 0x43c60000, 0x3dc90000, 0x46c80000, 0x6fc80000, 0xbdc60000, 0xfcc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x7dc80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09c6c6c6, 0x2acecece, 0x48cdcdcd, 0x66cdcdcd, 0x6bcdcdcd, 0x77cecece, 0x7ccecece, 0x6bcdcdcd, 0x68cecece, 0x54cecece, 0x32cccccc, 0x19cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0ec8c8c8, 0x61cdcdcd, 0x49cecece, 0x0cd5d5d5, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x12d5d5d5, 0x31d0d0d0, 0x56cdcdcd, 0x69cecece, 0x70cdcdcd, 0x82cecece, 0x7fcfcfcf, 0x6dcecece, 0x68cecece, 0x52cdcdcd, 0x30cfcfcf, 0x15cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xa5cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x44cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7ac70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x88c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x16c50000, 0xeac70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2fc90000, 0xf7c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xf0c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe9c70000, 0x15c20000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x13aeaeae, 0x6fb3b3b3, 0x9eb3b3b3, 0xa7b3b3b3, 0x96b3b3b3, 0x5bb3b3b3, 0x06aaaaaa, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x02808080, 0xcab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x50b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x31b1b1b1, 0x84b4b4b4, 0xa4b3b3b3, 0xa5b3b3b3, 0x87b3b3b3, 0x37b5b5b5, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0cd5d5d5, 0xe0cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfacecece, 0x25cfcfcf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x78c80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xdec70000, 0x13c90000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x89c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3dc90000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xeec70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x56c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xdab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x96b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01ffffff, 0xc9b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x4db3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2cb4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x38b2b2b2,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x37cccccc, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xdfcecece, 0x0bd1d1d1, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ac80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xfac70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5ec60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0dc40000, 0xf8c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x28c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x42c90000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe7c70000, 0x20c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xe0c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x80c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x44b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5ab3b3b3, 0xd3b3b3b3, 0xe5b3b3b3, 0xe8b3b3b3, 0xddb3b3b3, 0xb1b3b3b3, 0x08bfbfbf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xb2b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xbeb3b3b3,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x57cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x9dcecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x44c70000, 0xf8c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe2c70000, 0x36c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ec70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x5fc70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5fc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x1fc50000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x41c80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe6c60000, 0x1fc50000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xaac80000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x7cc70000, 0x05cc0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x76b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x21b2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x03aaaaaa, 0x06aaaaaa, 0x01ffffff, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xe6b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf1b3b3b3,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x24cdcdcd, 0x58cecece, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x56cdcdcd, 0xa7cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x9fcdcdcd, 0x56cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x57cdcdcd, 0x49cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x93c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xc0c70000, 0x17c80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ec70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x61c80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xadc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xf1c70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x36c60000, 0xfec70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xd9c70000, 0x12c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2bca0000, 0xe1c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xecc70000, 0x59c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x7ab4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x23b6b6b6, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xeab3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xf4b3b3b3,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x9ccecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xbecdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x39c50000, 0xa4c70000, 0xfbc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xc2c60000, 0x48c60000, 0x03aa0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4dc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x2dc60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0dc40000, 0xa2c60000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xf5c70000, 0x3bc70000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x1dca0000, 0xe4c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0x70c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0bd10000, 0x6dc70000, 0xd7c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xeac70000, 0x7dc80000, 0x12c60000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x50b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xbeb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xc1b2b2b2,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xcbcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x93cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x21c90000, 0x6fc80000, 0xa5c70000, 0xd2c70000, 0xf8c70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xe5c70000, 0xb8c80000, 0x86c80000, 0x39c50000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x04bf0000, 0x55c60000, 0x92c70000, 0xa0c70000, 0xa3c70000, 0xa3c70000, 0x9dc80000, 0x88c70000, 0x3ec50000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x32c70000, 0x6fc80000, 0x86c80000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x8bc60000, 0x75c60000, 0x1fc50000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x59c60000, 0x8ac80000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x89c70000, 0x87c60000, 0x46c80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01ff0000, 0x4ec70000, 0x92c70000, 0xbec70000, 0xecc70000, 0xfec70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xffc70000, 0xf5c70000, 0xc9c70000, 0x9fc70000, 0x5bc70000, 0x0ec80000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x01ffffff, 0xf3b3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xaab3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6ab2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x48b5b5b5, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0x48b5b5b5,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0cd5d5d5, 0xe4cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x63cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x15c20000, 0x38c80000, 0x4dc70000, 0x5bc70000, 0x5ec60000, 0x55c60000, 0x42c90000, 0x28c60000, 0x05cc0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x09c60000, 0x2ac80000, 0x46c80000, 0x56c70000, 0x5fc70000, 0x59c60000, 0x4bc90000, 0x33c80000, 0x13c90000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x23b6b6b6, 0x8bb4b4b4, 0xb7b2b2b2, 0xbeb3b3b3, 0xabb3b3b3, 0x6db4b4b4, 0x08bfbfbf, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6bb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xadb2b2b2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x62b4b4b4, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4ab3b3b3, 0x9eb3b3b3, 0xbcb3b3b3, 0xbcb3b3b3, 0x9cb4b4b4, 0x46b3b3b3, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x31d0d0d0, 0xfccecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xfacecece, 0x29cdcdcd, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6cb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xaeb3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x63b2b2b2, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xffb3b3b3, 0xcdb3b3b3, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x6dcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xd3cdcdcd, 0x05cccccc, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x35b2b2b2, 0xfab3b3b3, 0xf2b3b3b3, 0xf2b3b3b3, 0xf2b3b3b3, 0xf2b3b3b3, 0x81b4b4b4, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x2eb1b1b1, 0xf6b3b3b3, 0xf3b3b3b3, 0xf2b3b3b3, 0xf2b3b3b3, 0xf4b3b3b3, 0xa2b3b3b3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xaecfcfcf, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xaacecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0cd5d5d5, 0xe2cecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x87cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd1cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x29cdcdcd, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0xffcecece, 0x4ececece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffcecece, 0xffcecece, 0xffcecece, 0xd5cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
-		  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x3ccccccc, 0xddcfcfcf, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdbcecece, 0xdccecece, 0xd0cecece, 0x18cacaca, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xedcecece, 0xedcecece, 0xedcecece, 0xc2cecece, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+// array size is 13778, compressed from 128576
+static const uint8_t Taraz_Logo[] __attribute__((section(".SystemImages"))) = {
+		0xb9, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd8, 0xd8, 0xd8, 0x0d, 0xcd, 0xcd, 0xcd, 0x52, 0xcd, 0xcd, 0xcd, 0xa4, 0xce, 0xce, 0xce, 0xd9, 0xce, 0xce,
+		0xce, 0xea, 0x81, 0xce, 0xce, 0xce, 0xed, 0x03, 0xce, 0xce, 0xce, 0xdb, 0xce, 0xce, 0xce, 0xad, 0xcf, 0xcf, 0xcf, 0x5a, 0xd2, 0xd2, 0xd2, 0x11,
+		0xa8, 0x00, 0x00, 0x00, 0x00, 0x03, 0xcc, 0xcc, 0xcc, 0x19, 0xcd, 0xcd, 0xcd, 0x66, 0xce, 0xce, 0xce, 0xb2, 0xce, 0xce, 0xce, 0xe0, 0x81, 0xce,
+		0xce, 0xce, 0xed, 0x04, 0xce, 0xce, 0xce, 0xea, 0xce, 0xce, 0xce, 0xd7, 0xcd, 0xcd, 0xcd, 0x9f, 0xcd, 0xcd, 0xcd, 0x47, 0xc6, 0xc6, 0xc6, 0x09,
+		0xbf, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x81, 0xce, 0xce, 0xce, 0xed, 0x00, 0xce, 0xce, 0xce, 0xc2, 0xb4, 0x00, 0x00, 0x00,
+		0x00, 0x05, 0x00, 0x00, 0xcc, 0x05, 0x00, 0x00, 0xc6, 0x3f, 0x00, 0x00, 0xc6, 0x8b, 0x00, 0x00, 0xc8, 0xc1, 0x00, 0x00, 0xc7, 0xed, 0x00, 0x00,
+		0xc7, 0xf3, 0x84, 0x00, 0x00, 0xc7, 0xf2, 0x04, 0x00, 0x00, 0xc7, 0xee, 0x00, 0x00, 0xc8, 0xc6, 0x00, 0x00, 0xc8, 0x8f, 0x00, 0x00, 0xc6, 0x51,
+		0x00, 0x00, 0xd1, 0x0b, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xc6, 0x28, 0x00, 0x00, 0xc6, 0x6c, 0x82, 0x00, 0x00, 0xc8, 0x78, 0x03,
+		0x00, 0x00, 0xc6, 0x79, 0x00, 0x00, 0xc8, 0x6a, 0x00, 0x00, 0xc6, 0x3f, 0x00, 0x00, 0xff, 0x02, 0x91, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00,
+		0xff, 0x02, 0x00, 0x00, 0xc6, 0x4c, 0x00, 0x00, 0xc6, 0x82, 0x00, 0x00, 0xc7, 0x97, 0x00, 0x00, 0xc7, 0x9f, 0x00, 0x00, 0xc8, 0x9d, 0x00, 0x00,
+		0xc7, 0x8d, 0x00, 0x00, 0xc8, 0x6a, 0x00, 0x00, 0xca, 0x18, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xc7, 0x44, 0x00, 0x00, 0xc6, 0x63,
+		0x95, 0x00, 0x00, 0xc6, 0x62, 0x01, 0x00, 0x00, 0xc6, 0x5e, 0x00, 0x00, 0xc7, 0x20, 0x91, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xc9, 0x21,
+		0x00, 0x00, 0xc8, 0x6b, 0x00, 0x00, 0xc7, 0xae, 0x00, 0x00, 0xc6, 0xdd, 0x00, 0x00, 0xc7, 0xf3, 0x84, 0x00, 0x00, 0xc7, 0xf2, 0x04, 0x00, 0x00,
+		0xc7, 0xf1, 0x00, 0x00, 0xc7, 0xdb, 0x00, 0x00, 0xc7, 0xa8, 0x00, 0x00, 0xc8, 0x6a, 0x00, 0x00, 0xc9, 0x26, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x06,
+		0xb5, 0xb5, 0xb5, 0x1f, 0xb4, 0xb4, 0xb4, 0x7d, 0xb3, 0xb3, 0xb3, 0x9b, 0xb4, 0xb4, 0xb4, 0x9f, 0xb3, 0xb3, 0xb3, 0x94, 0xb2, 0xb2, 0xb2, 0x67,
+		0xbf, 0xbf, 0xbf, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x06, 0xbf, 0xbf, 0xbf, 0x04, 0xb3, 0xb3, 0xb3, 0x6b, 0xb4, 0xb4, 0xb4, 0x95, 0xb4, 0xb4,
+		0xb4, 0x9f, 0xb3, 0xb3, 0xb3, 0x9b, 0xb2, 0xb2, 0xb2, 0x7b, 0xaf, 0xaf, 0xaf, 0x20, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x05, 0xb4, 0xb4, 0xb4, 0x66,
+		0xb3, 0xb3, 0xb3, 0x94, 0xb3, 0xb3, 0xb3, 0x9e, 0xb4, 0xb4, 0xb4, 0x9c, 0xb4, 0xb4, 0xb4, 0x84, 0xb0, 0xb0, 0xb0, 0x2a, 0x8d, 0x00, 0x00, 0x00,
+		0x00, 0x05, 0x80, 0x80, 0x80, 0x02, 0xb1, 0xb1, 0xb1, 0x27, 0xb2, 0xb2, 0xb2, 0x63, 0xb3, 0xb3, 0xb3, 0x97, 0xb3, 0xb3, 0xb3, 0xc2, 0xb3, 0xb3,
+		0xb3, 0xe6, 0x83, 0xb3, 0xb3, 0xb3, 0xf2, 0x04, 0xb3, 0xb3, 0xb3, 0xf1, 0xb3, 0xb3, 0xb3, 0xd9, 0xb3, 0xb3, 0xb3, 0xb2, 0xb3, 0xb3, 0xb3, 0x76,
+		0xb4, 0xb4, 0xb4, 0x2c, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xb6, 0xb6, 0xb6, 0x0e, 0xb4, 0xb4, 0xb4, 0x70, 0xb3, 0xb3, 0xb3, 0xaf, 0xb3, 0xb3,
+		0xb3, 0xdb, 0xb3, 0xb3, 0xb3, 0xf1, 0xb3, 0xb3, 0xb3, 0xf2, 0xb3, 0xb3, 0xb3, 0xf3, 0xb3, 0xb3, 0xb3, 0xea, 0xb3, 0xb3, 0xb3, 0xc5, 0xb2, 0xb2,
+		0xb2, 0x88, 0xb4, 0xb4, 0xb4, 0x22, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x05, 0xb1, 0xb1, 0xb1, 0x3b, 0xb4, 0xb4, 0xb4, 0x8b, 0xb3, 0xb3, 0xb3, 0x9d,
+		0xb3, 0xb3, 0xb3, 0x9e, 0xb2, 0xb2, 0xb2, 0x92, 0xb4, 0xb4, 0xb4, 0x55, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x06, 0xcc, 0xcc, 0xcc, 0x05, 0xb4, 0xb4,
+		0xb4, 0x58, 0xb3, 0xb3, 0xb3, 0x93, 0xb3, 0xb3, 0xb3, 0x9e, 0xb4, 0xb4, 0xb4, 0x9c, 0xb3, 0xb3, 0xb3, 0x86, 0xb1, 0xb1, 0xb1, 0x2e, 0x8a, 0x00,
+		0x00, 0x00, 0x00, 0x01, 0xb2, 0xb2, 0xb2, 0x42, 0xb4, 0xb4, 0xb4, 0x8b, 0x80, 0xb3, 0xb3, 0xb3, 0x9e, 0x01, 0xb4, 0xb4, 0xb4, 0x8b, 0xb3, 0xb3,
+		0xb3, 0x43, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xcf, 0xcf, 0x30, 0x9e, 0xcf, 0xcf, 0xcf, 0x4f, 0x00, 0xcd, 0xcd, 0xcd, 0x51, 0x88, 0xce,
+		0xce, 0xce, 0x4e, 0x01, 0xcd, 0xcd, 0xcd, 0x4d, 0xc8, 0xc8, 0xc8, 0x0e, 0xc2, 0x02, 0xd1, 0xd1, 0xd1, 0x16, 0xce, 0xce, 0xce, 0x8d, 0xce, 0xce,
+		0xce, 0xe0, 0x88, 0xce, 0xce, 0xce, 0xff, 0x02, 0xce, 0xce, 0xce, 0xe2, 0xcd, 0xcd, 0xcd, 0x7b, 0xbf, 0xbf, 0xbf, 0x04, 0xc6, 0x01, 0xaa, 0xaa,
+		0xaa, 0x03, 0xcd, 0xcd, 0xcd, 0x47, 0x87, 0xcd, 0xcd, 0xcd, 0x52, 0x03, 0xcc, 0xcc, 0xcc, 0x23, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0x1f,
+		0xcf, 0xcf, 0xcf, 0x50, 0x87, 0xcf, 0xcf, 0xcf, 0x4f, 0x01, 0xce, 0xce, 0xce, 0x49, 0xaa, 0xaa, 0xaa, 0x03, 0xc2, 0x02, 0xcc, 0xcc, 0xcc, 0x28,
+		0xce, 0xce, 0xce, 0xa6, 0xce, 0xce, 0xce, 0xeb, 0x88, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xd7, 0xcd, 0xcd, 0xcd, 0x61, 0xc8, 0x01,
+		0xc6, 0xc6, 0xc6, 0x09, 0xcd, 0xcd, 0xcd, 0x4c, 0x87, 0xcf, 0xcf, 0xcf, 0x4f, 0x01, 0xce, 0xce, 0xce, 0x49, 0xd5, 0xd5, 0xd5, 0x06, 0xeb, 0x81,
+		0xce, 0xce, 0xce, 0xff, 0x00, 0xce, 0xce, 0xce, 0xd5, 0xf2, 0x02, 0x00, 0x00, 0xc5, 0x1f, 0x00, 0x00, 0xc6, 0x79, 0x00, 0x00, 0xc7, 0xdb, 0x8d,
+		0x00, 0x00, 0xc7, 0xff, 0x03, 0x00, 0x00, 0xc7, 0xea, 0x00, 0x00, 0xc6, 0x99, 0x00, 0x00, 0xc6, 0x43, 0x00, 0x00, 0xff, 0x01, 0xc9, 0x00, 0x00,
+		0x00, 0xc8, 0x6f, 0x87, 0x00, 0x00, 0xc7, 0xff, 0x01, 0x00, 0x00, 0xc6, 0xcb, 0x00, 0x00, 0xc9, 0x34, 0xcf, 0x01, 0x00, 0x00, 0xff, 0x01, 0x00,
+		0x00, 0xc7, 0x8d, 0x85, 0x00, 0x00, 0xc7, 0xff, 0x01, 0x00, 0x00, 0xc8, 0xef, 0x00, 0x00, 0xbf, 0x08, 0xc6, 0x01, 0x00, 0x00, 0xc8, 0x2a, 0x00,
+		0x00, 0xc7, 0xf2, 0x97, 0x00, 0x00, 0xc7, 0xff, 0x01, 0x00, 0x00, 0xc7, 0xfb, 0x00, 0x00, 0xc8, 0x53, 0xcd, 0x03, 0x00, 0x00, 0xd5, 0x06, 0x00,
+		0x00, 0xc8, 0x53, 0x00, 0x00, 0xc7, 0xb2, 0x00, 0x00, 0xc7, 0xfc, 0x8c, 0x00, 0x00, 0xc7, 0xff, 0x03, 0x00, 0x00, 0xc7, 0xfe, 0x00, 0x00, 0xc7,
+		0xba, 0x00, 0x00, 0xc8, 0x6a, 0x00, 0x00, 0xcc, 0x0f, 0xc9, 0x00, 0xb3, 0xb3, 0xb3, 0xb2, 0x83, 0xb3, 0xb3, 0xb3, 0xff, 0x00, 0xb2, 0xb2, 0xb2,
+		0x49, 0xc9, 0x00, 0xb3, 0xb3, 0xb3, 0x5a, 0x83, 0xb3, 0xb3, 0xb3, 0xff, 0x00, 0xb3, 0xb3, 0xb3, 0xa5, 0xc9, 0x00, 0xb2, 0xb2, 0xb2, 0x53, 0x83,
+		0xb3, 0xb3, 0xb3, 0xff, 0x01, 0xb3, 0xb3, 0xb3, 0xc9, 0x80, 0x80, 0x80, 0x02, 0xca, 0x03, 0xb2, 0xb2, 0xb2, 0x3f, 0xb4, 0xb4, 0xb4, 0x84, 0xb3,
+		0xb3, 0xb3, 0xd3, 0xb3, 0xb3, 0xb3, 0xfe, 0x8c, 0xb3, 0xb3, 0xb3, 0xff, 0x02, 0xb3, 0xb3, 0xb3, 0xbf, 0xb3, 0xb3, 0xb3, 0x5a, 0xb6, 0xb6, 0xb6,
+		0x07, 0xca, 0x01, 0xb6, 0xb6, 0xb6, 0x23, 0xb3, 0xb3, 0xb3, 0xe0, 0x87, 0xb3, 0xb3, 0xb3, 0xff, 0x02, 0xb3, 0xb3, 0xb3, 0xf6, 0xb3, 0xb3, 0xb3,
+		0x8c, 0xb6, 0xb6, 0xb6, 0x07, 0xcc, 0x01, 0xb1, 0xb1, 0xb1, 0x0d, 0xb3, 0xb3, 0xb3, 0xe9, 0x83, 0xb3, 0xb3, 0xb3, 0xff, 0x00, 0xb1, 0xb1, 0xb1,
+		0x31, 0xcd, 0x01, 0xb2, 0xb2, 0xb2, 0x38, 0xb3, 0xb3, 0xb3, 0xfe, 0x82, 0xb3, 0xb3, 0xb3, 0xff, 0x00, 0xb3, 0xb3, 0xb3, 0xea, 0xca, 0x83, 0xb3,
+		0xb3, 0xb3, 0xff, 0x00, 0xb3, 0xb3, 0xb3, 0xfc, 0xc6, 0x00, 0xce, 0xce, 0xce, 0xc0, 0xaa, 0xce, 0xce, 0xce, 0xff, 0x00, 0xce, 0xce, 0xce, 0x78,
+		0xc1, 0x01, 0xcd, 0xcd, 0xcd, 0x67, 0xce, 0xce, 0xce, 0xe4, 0x8c, 0xce, 0xce, 0xce, 0xff, 0x01, 0xcd, 0xcd, 0xcd, 0xaf, 0xd1, 0xd1, 0xd1, 0x0b,
+		0xc5, 0x01, 0xd0, 0xd0, 0xd0, 0x1b, 0xce, 0xce, 0xce, 0xfa, 0x87, 0xce, 0xce, 0xce, 0xff, 0x02, 0xce, 0xce, 0xce, 0x54, 0x00, 0x00, 0x00, 0x00,
+		0xcd, 0xcd, 0xcd, 0x8b, 0x89, 0xce, 0xce, 0xce, 0xff, 0x00, 0xcf, 0xcf, 0xcf, 0x4a, 0xc0, 0x02, 0xcc, 0xcc, 0xcc, 0x0a, 0xcd, 0xcd, 0xcd, 0x8b,
+		0xcd, 0xcd, 0xcd, 0xf2, 0x8c, 0xce, 0xce, 0xce, 0xff, 0x01, 0xcf, 0xcf, 0xcf, 0x94, 0xff, 0xff, 0xff, 0x02, 0xc6, 0x00, 0xcf, 0xcf, 0xcf, 0x30,
+		0x88, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xd7, 0xcc, 0xcc, 0xcc, 0x05, 0xee, 0x00, 0xce, 0xce, 0xce, 0xd1, 0xf1, 0x01, 0x00, 0x00,
+		0xc7, 0x7c, 0x00, 0x00, 0xc7, 0xf4, 0x91, 0x00, 0x00, 0xc7, 0xff, 0x02, 0x00, 0x00, 0xc7, 0xfd, 0x00, 0x00, 0xc7, 0xbe, 0x00, 0x00, 0xc5, 0x23,
+		0xc7, 0x01, 0x00, 0x00, 0xc5, 0x2c, 0x00, 0x00, 0xc7, 0xf5, 0xc7, 0x02, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc7, 0xf0, 0x00, 0x00, 0xc6, 0x28,
+		0xce, 0x01, 0x00, 0x00, 0xcc, 0x05, 0x00, 0x00, 0xc6, 0xb4, 0xc5, 0x01, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc6, 0x28, 0xc6, 0x00, 0x00, 0x00,
+		0xc6, 0x55, 0x99, 0x00, 0x00, 0xc7, 0xff, 0x01, 0x00, 0x00, 0xc6, 0xd4, 0x00, 0x00, 0xc4, 0x0d, 0xcb, 0x01, 0x00, 0x00, 0xc4, 0x27, 0x00, 0x00,
+		0xc7, 0xca, 0x92, 0x00, 0x00, 0xc7, 0xff, 0x01, 0x00, 0x00, 0xc7, 0xe8, 0x00, 0x00, 0xc7, 0x5f, 0xc8, 0x00, 0xb4, 0xb4, 0xb4, 0xc4, 0xc3, 0x00,
+		0xb4, 0xb4, 0xb4, 0x55, 0xc9, 0x00, 0xb2, 0xb2, 0xb2, 0x6e, 0xc3, 0x00, 0xb3, 0xb3, 0xb3, 0xae, 0xc9, 0x00, 0xb3, 0xb3, 0xb3, 0x65, 0xc3, 0x01,
+		0xb3, 0xb3, 0xb3, 0xce, 0xaa, 0xaa, 0xaa, 0x06, 0xc8, 0x01, 0xb8, 0xb8, 0xb8, 0x19, 0xb3, 0xb3, 0xb3, 0xb4, 0x92, 0xb3, 0xb3, 0xb3, 0xff, 0x01,
+		0xb3, 0xb3, 0xb3, 0xd2, 0xb3, 0xb3, 0xb3, 0x2f, 0xc9, 0x00, 0xb2, 0xb2, 0xb2, 0x6e, 0x8a, 0xb3, 0xb3, 0xb3, 0xff, 0x01, 0xb3, 0xb3, 0xb3, 0xc6,
+		0xff, 0xff, 0xff, 0x01, 0xcb, 0x01, 0xae, 0xae, 0xae, 0x16, 0xb3, 0xb3, 0xb3, 0xec, 0xc3, 0x00, 0xb4, 0xb4, 0xb4, 0x3d, 0xcd, 0x00, 0xb2, 0xb2,
+		0xb2, 0x3f, 0x83, 0xb3, 0xb3, 0xb3, 0xff, 0x00, 0xb3, 0xb3, 0xb3, 0xf6, 0xcf, 0x00, 0xb3, 0xb3, 0xb3, 0xff, 0xc5, 0x01, 0xdb, 0xdb, 0xdb, 0x07,
+		0xcf, 0xcf, 0xcf, 0xdd, 0xde, 0x01, 0xcd, 0xcd, 0xcd, 0x61, 0xce, 0xce, 0xce, 0xba, 0xc8, 0x03, 0xcf, 0xcf, 0xcf, 0xae, 0x00, 0x00, 0x00, 0x00,
+		0xd1, 0xd1, 0xd1, 0x16, 0xcf, 0xcf, 0xcf, 0xb3, 0x8f, 0xce, 0xce, 0xce, 0xff, 0x01, 0xcf, 0xcf, 0xcf, 0xae, 0xbf, 0xbf, 0xbf, 0x04, 0xc4, 0x00,
+		0xcf, 0xcf, 0xcf, 0x35, 0x87, 0xce, 0xce, 0xce, 0xff, 0x04, 0xce, 0xce, 0xce, 0xf7, 0xcc, 0xcc, 0xcc, 0x23, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd,
+		0xcd, 0x29, 0xce, 0xce, 0xce, 0xe3, 0xc8, 0x03, 0xce, 0xce, 0xce, 0x81, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0x2f, 0xce, 0xce, 0xce, 0xd0,
+		0x8f, 0xce, 0xce, 0xce, 0xff, 0x00, 0xce, 0xce, 0xce, 0x8d, 0xc6, 0x00, 0xcd, 0xcd, 0xcd, 0x57, 0xc8, 0x00, 0xcd, 0xcd, 0xcd, 0x90, 0xac, 0x00,
+		0x00, 0x00, 0x00, 0xf3, 0x01, 0x00, 0x00, 0xc8, 0x25, 0x00, 0x00, 0xc6, 0xcb, 0x95, 0x00, 0x00, 0xc7, 0xff, 0x01, 0x00, 0x00, 0xc7, 0xf6, 0x00,
+		0x00, 0xc8, 0x4f, 0xc6, 0x00, 0x00, 0x00, 0xc8, 0x5d, 0x8a, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0x00, 0xc7, 0xe5, 0xcf, 0x00, 0x00, 0x00, 0xc7,
+		0xb2, 0xcf, 0x00, 0x00, 0x00, 0xc8, 0x73, 0xd9, 0x01, 0x00, 0x00, 0xc7, 0xe5, 0x00, 0x00, 0xc3, 0x1e, 0xca, 0x01, 0x00, 0x00, 0xc8, 0x74, 0x00,
+		0x00, 0xc7, 0xf6, 0x95, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0x00, 0xc7, 0xae, 0xc7, 0x00, 0xb2, 0xb2, 0xb2, 0xc1, 0xc3, 0x00, 0xb2, 0xb2, 0xb2,
+		0x53, 0xc9, 0x00, 0xb2, 0xb2, 0xb2, 0x6a, 0xc3, 0x00, 0xb2, 0xb2, 0xb2, 0xad, 0xc9, 0x00, 0xb4, 0xb4, 0xb4, 0x62, 0xc3, 0x01, 0xb3, 0xb3, 0xb3,
+		0xcd, 0xcc, 0xcc, 0xcc, 0x05, 0xc8, 0x00, 0xb3, 0xb3, 0xb3, 0x8d, 0x94, 0xb3, 0xb3, 0xb3, 0xff, 0x01, 0xb3, 0xb3, 0xb3, 0xf7, 0xb3, 0xb3, 0xb3,
+		0x68, 0xc8, 0x00, 0xb3, 0xb3, 0xb3, 0x89, 0xca, 0x02, 0xb3, 0xb3, 0xb3, 0xff, 0xb3, 0xb3, 0xb3, 0x96, 0x80, 0x80, 0x80, 0x02, 0xe1, 0x00, 0xb5,
+		0xb5, 0xb5, 0x3e, 0xc3, 0x00, 0xb3, 0xb3, 0xb3, 0xf4, 0xd7, 0x01, 0xcc, 0xcc, 0xcc, 0x23, 0xce, 0xce, 0xce, 0xf7, 0xdd, 0x03, 0xce, 0xce, 0xce,
+		0xf7, 0xd1, 0xd1, 0xd1, 0x16, 0xcd, 0xcd, 0xcd, 0x3d, 0xce, 0xce, 0xce, 0xfd, 0xc7, 0x02, 0xce, 0xce, 0xce, 0x98, 0xd0, 0xd0, 0xd0, 0x26, 0xce,
+		0xce, 0xce, 0xda, 0x91, 0xce, 0xce, 0xce, 0xff, 0x00, 0xce, 0xce, 0xce, 0x77, 0xc4, 0x00, 0xce, 0xce, 0xce, 0x62, 0xc7, 0x01, 0xce, 0xce, 0xce,
+		0xcc, 0xff, 0xff, 0xff, 0x02, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd, 0x76, 0xc8, 0x02, 0xcf, 0xcf, 0xcf, 0x5f, 0xce, 0xce, 0xce,
+		0x43, 0xce, 0xce, 0xce, 0xef, 0x91, 0xce, 0xce, 0xce, 0xff, 0x00, 0xcd, 0xcd, 0xcd, 0x56, 0xc5, 0x00, 0xce, 0xce, 0xce, 0x97, 0xc8, 0x00, 0xcf,
+		0xcf, 0xcf, 0x64, 0xff, 0xdf, 0x01, 0x00, 0x00, 0xc5, 0x23, 0x00, 0x00, 0xc7, 0xec, 0x97, 0x00, 0x00, 0xc7, 0xff, 0x01, 0x00, 0x00, 0xc7, 0xc5,
+		0x00, 0x00, 0xcc, 0x0a, 0xc5, 0x00, 0x00, 0x00, 0xc7, 0x6e, 0xca, 0x01, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc8, 0x81, 0xe0, 0x00, 0x00, 0x00,
+		0xc6, 0x7e, 0xd9, 0x01, 0x00, 0x00, 0xc7, 0xe7, 0x00, 0x00, 0xc7, 0x20, 0xc9, 0x00, 0x00, 0x00, 0xc7, 0x85, 0x98, 0x00, 0x00, 0xc7, 0xff, 0x00,
+		0x00, 0x00, 0xc8, 0x45, 0xfc, 0x00, 0xb3, 0xb3, 0xb3, 0xb2, 0xc6, 0x05, 0xb3, 0xb3, 0xb3, 0xf5, 0xb3, 0xb3, 0xb3, 0xe5, 0xb3, 0xb3, 0xb3, 0xdd,
+		0xb3, 0xb3, 0xb3, 0xdb, 0xb3, 0xb3, 0xb3, 0xe2, 0xb3, 0xb3, 0xb3, 0xf2, 0x88, 0xb3, 0xb3, 0xb3, 0xff, 0x00, 0xb4, 0xb4, 0xb4, 0x62, 0xc7, 0x00,
+		0xb2, 0xb2, 0xb2, 0x88, 0xcb, 0x01, 0xb3, 0xb3, 0xb3, 0xf8, 0xb0, 0xb0, 0xb0, 0x1d, 0xff, 0xc0, 0x00, 0xce, 0xce, 0xce, 0x59, 0x9e, 0xce, 0xce,
+		0xce, 0xff, 0x03, 0xce, 0xce, 0xce, 0xcc, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xce, 0xce, 0xce, 0xd5, 0xc7, 0x01, 0xce, 0xce, 0xce,
+		0xcf, 0xce, 0xce, 0xce, 0xe5, 0x92, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xe9, 0xce, 0xce, 0xce, 0x1a, 0xc3, 0x00, 0xce, 0xce, 0xce,
+		0xa2, 0xc7, 0x00, 0xcf, 0xcf, 0xcf, 0x8f, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd0, 0xd0, 0xd0, 0x26, 0xce, 0xce, 0xce, 0xf8, 0xc7, 0x01, 0xce,
+		0xce, 0xce, 0xc0, 0xce, 0xce, 0xce, 0xf6, 0x92, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xcd, 0xaa, 0xaa, 0xaa, 0x03, 0xc3, 0x01, 0xcc,
+		0xcc, 0xcc, 0x05, 0xcd, 0xcd, 0xcd, 0xd3, 0xc8, 0x00, 0xcd, 0xcd, 0xcd, 0x42, 0xff, 0xde, 0x01, 0x00, 0x00, 0xc5, 0x23, 0x00, 0x00, 0xc7, 0xe9,
+		0x98, 0x00, 0x00, 0xc7, 0xff, 0x01, 0x00, 0x00, 0xc7, 0xec, 0x00, 0x00, 0xc2, 0x15, 0xd3, 0x01, 0x00, 0x00, 0xc7, 0xe7, 0x00, 0x00, 0xc9, 0x21,
+		0xdf, 0x00, 0x00, 0x00, 0xc6, 0x70, 0xe5, 0x01, 0x00, 0x00, 0xc8, 0x7d, 0x00, 0x00, 0xc7, 0xfe, 0xd8, 0x00, 0x00, 0x00, 0xc6, 0x7e, 0xfc, 0x00,
+		0xb3, 0xb3, 0xb3, 0xb5, 0xc2, 0x05, 0xb3, 0xb3, 0xb3, 0xea, 0xb4, 0xb4, 0xb4, 0xa6, 0xb3, 0xb3, 0xb3, 0x65, 0xb5, 0xb5, 0xb5, 0x34, 0xaf, 0xaf,
+		0xaf, 0x10, 0xbf, 0xbf, 0xbf, 0x04, 0x80, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x01, 0xb6, 0xb6, 0xb6, 0x0e, 0xb5, 0xb5, 0xb5, 0x30,
+		0xb4, 0xb4, 0xb4, 0x73, 0xb3, 0xb3, 0xb3, 0xcf, 0xc5, 0x01, 0xb3, 0xb3, 0xb3, 0xf8, 0xb2, 0xb2, 0xb2, 0x49, 0xc6, 0x08, 0xb2, 0xb2, 0xb2, 0x64,
+		0xb3, 0xb3, 0xb3, 0xff, 0xb3, 0xb3, 0xb3, 0xe0, 0xb3, 0xb3, 0xb3, 0x8d, 0xb3, 0xb3, 0xb3, 0x4d, 0xb1, 0xb1, 0xb1, 0x3b, 0xb3, 0xb3, 0xb3, 0x4a,
+		0xb4, 0xb4, 0xb4, 0x8e, 0xb3, 0xb3, 0xb3, 0xf6, 0xc3, 0x01, 0xb3, 0xb3, 0xb3, 0xff, 0xb3, 0xb3, 0xb3, 0x80, 0xff, 0xc0, 0x00, 0xce, 0xce, 0xce,
+		0x9c, 0xde, 0x00, 0xce, 0xce, 0xce, 0x92, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0xc5, 0x9e, 0xce, 0xce, 0xce, 0xff, 0x00, 0xcf,
+		0xcf, 0xcf, 0x7a, 0xc2, 0x01, 0xbf, 0xbf, 0xbf, 0x08, 0xce, 0xce, 0xce, 0xda, 0xc7, 0x00, 0xcf, 0xcf, 0xcf, 0x64, 0xc1, 0x01, 0xd3, 0xd3, 0xd3,
+		0x17, 0xce, 0xce, 0xce, 0xf1, 0x9e, 0xce, 0xce, 0xce, 0xff, 0x00, 0xce, 0xce, 0xce, 0x4e, 0xc3, 0x01, 0xca, 0xca, 0xca, 0x1d, 0xce, 0xce, 0xce,
+		0xf3, 0xc7, 0x01, 0xce, 0xce, 0xce, 0xec, 0xd1, 0xd1, 0xd1, 0x16, 0xff, 0xde, 0x00, 0x00, 0x00, 0xc7, 0xc3, 0x99, 0x00, 0x00, 0xc7, 0xff, 0x01,
+		0x00, 0x00, 0xc7, 0xfd, 0x00, 0x00, 0xc4, 0x1a, 0xc5, 0x00, 0x00, 0x00, 0xc7, 0x6d, 0xcb, 0x01, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc8, 0x86,
+		0xdf, 0x00, 0x00, 0x00, 0xc6, 0x50, 0xe4, 0x00, 0x00, 0x00, 0xc6, 0x3f, 0x9a, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0x00, 0xc6, 0x94, 0xfc, 0x05,
+		0xb4, 0xb4, 0xb4, 0x95, 0xb3, 0xb3, 0xb3, 0xff, 0xb3, 0xb3, 0xb3, 0xf4, 0xb3, 0xb3, 0xb3, 0x9e, 0xb4, 0xb4, 0xb4, 0x4e, 0xaa, 0xaa, 0xaa, 0x0c,
+		0x8a, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb3, 0xb3, 0xb3, 0x5a, 0xb3, 0xb3, 0xb3, 0xdd, 0xc3, 0x02, 0xb3, 0xb3, 0xb3, 0xff, 0xb3, 0xb3, 0xb3, 0xe0,
+		0xcc, 0xcc, 0xcc, 0x05, 0xc5, 0x02, 0xb4, 0xb4, 0xb4, 0x11, 0xb4, 0xb4, 0xb4, 0x47, 0xaa, 0xaa, 0xaa, 0x06, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01,
+		0xb3, 0xb3, 0xb3, 0x2f, 0xb3, 0xb3, 0xb3, 0xfd, 0xc3, 0x00, 0xb3, 0xb3, 0xb3, 0xe3, 0xff, 0xc0, 0x00, 0xce, 0xce, 0xce, 0xc7, 0xde, 0x03, 0xcf,
+		0xcf, 0xcf, 0x65, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xd8, 0xd8, 0x0d, 0xce, 0xce, 0xce, 0xe3, 0xde, 0x00, 0xcd, 0xcd, 0xcd, 0xaf, 0xc2, 0x01, 0xd1,
+		0xd1, 0xd1, 0x21, 0xce, 0xce, 0xce, 0xf6, 0xc7, 0x00, 0xcd, 0xcd, 0xcd, 0x42, 0xc1, 0x01, 0xcd, 0xcd, 0xcd, 0x38, 0xce, 0xce, 0xce, 0xfe, 0xde,
+		0x00, 0xce, 0xce, 0xce, 0x93, 0xc3, 0x00, 0xcc, 0xcc, 0xcc, 0x37, 0x88, 0xce, 0xce, 0xce, 0xff, 0x00, 0xce, 0xce, 0xce, 0xb6, 0xad, 0x00, 0x00,
+		0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xc7, 0x65, 0x8a, 0x00, 0x00, 0xc7, 0xff, 0x07, 0x00, 0x00, 0xc7, 0xf8, 0x00, 0x00, 0xc7, 0xce, 0x00, 0x00,
+		0xc7, 0xb2, 0x00, 0x00, 0xc7, 0xa8, 0x00, 0x00, 0xc8, 0xaf, 0x00, 0x00, 0xc7, 0xbf, 0x00, 0x00, 0xc7, 0xdf, 0x00, 0x00, 0xc7, 0xfc, 0xc6, 0x00,
+		0x00, 0x00, 0xc7, 0xfe, 0xd5, 0x01, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xcc, 0x0a, 0xde, 0x01, 0x00, 0x00, 0xc4, 0x27, 0x00, 0x00, 0xc7, 0xee,
+		0xe3, 0x00, 0x00, 0x00, 0xc7, 0xeb, 0xc9, 0x07, 0x00, 0x00, 0xc7, 0xfe, 0x00, 0x00, 0xc7, 0xe2, 0x00, 0x00, 0xc7, 0xbb, 0x00, 0x00, 0xc8, 0xaa,
+		0x00, 0x00, 0xc7, 0xac, 0x00, 0x00, 0xc8, 0xb8, 0x00, 0x00, 0xc8, 0xcf, 0x00, 0x00, 0xc7, 0xf4, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0x96, 0xfc, 0x02,
+		0xb4, 0xb4, 0xb4, 0x22, 0xb2, 0xb2, 0xb2, 0x67, 0xb6, 0xb6, 0xb6, 0x1c, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xae, 0xae, 0xae, 0x16, 0xb3, 0xb3,
+		0xb3, 0xdd, 0xc3, 0x01, 0xb3, 0xb3, 0xb3, 0xff, 0xb4, 0xb4, 0xb4, 0x7d, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xb2, 0xb2, 0x7e, 0xc3, 0x00,
+		0xb3, 0xb3, 0xb3, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xd1, 0xd1, 0x0b, 0xce, 0xce, 0xce, 0xe8, 0xde, 0x02, 0xce, 0xce, 0xce, 0x44,
+		0x00, 0x00, 0x00, 0x00, 0xcf, 0xcf, 0xcf, 0x3b, 0x8c, 0xce, 0xce, 0xce, 0xff, 0x07, 0xcd, 0xcd, 0xcd, 0xb4, 0xcd, 0xcd, 0xcd, 0x6c, 0xcf, 0xcf,
+		0xcf, 0x4f, 0xcc, 0xcc, 0xcc, 0x37, 0xd0, 0xd0, 0xd0, 0x36, 0xcd, 0xcd, 0xcd, 0x4d, 0xcd, 0xcd, 0xcd, 0x66, 0xcf, 0xcf, 0xcf, 0xae, 0xc9, 0x01,
+		0xcd, 0xcd, 0xcd, 0xce, 0xaa, 0xaa, 0xaa, 0x03, 0xc1, 0x00, 0xcd, 0xcd, 0xcd, 0x3d, 0x87, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xee,
+		0xca, 0xca, 0xca, 0x18, 0xc1, 0x00, 0xcd, 0xcd, 0xcd, 0x71, 0x8b, 0xce, 0xce, 0xce, 0xff, 0x08, 0xce, 0xce, 0xce, 0xf8, 0xce, 0xce, 0xce, 0xa1,
+		0xcf, 0xcf, 0xcf, 0x64, 0xcd, 0xcd, 0xcd, 0x4d, 0xcf, 0xcf, 0xcf, 0x35, 0xcf, 0xcf, 0xcf, 0x3b, 0xcd, 0xcd, 0xcd, 0x51, 0xcf, 0xcf, 0xcf, 0x6f,
+		0xce, 0xce, 0xce, 0xc5, 0xc9, 0x00, 0xcd, 0xcd, 0xcd, 0xaf, 0xc3, 0x00, 0xcd, 0xcd, 0xcd, 0x66, 0xc8, 0x00, 0xcf, 0xcf, 0xcf, 0x84, 0xff, 0xdd,
+		0x01, 0x00, 0x00, 0xcc, 0x0a, 0x00, 0x00, 0xc7, 0xf5, 0xc8, 0x02, 0x00, 0x00, 0xc7, 0xd3, 0x00, 0x00, 0xc7, 0x52, 0x00, 0x00, 0xc2, 0x15, 0x83,
+		0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xaa, 0x03, 0x00, 0x00, 0xca, 0x1d, 0x00, 0x00, 0xc6, 0x4c, 0x00, 0x00, 0xc6, 0xa2, 0x00, 0x00, 0xc7,
+		0xf2, 0xdc, 0x00, 0x00, 0x00, 0xc7, 0xae, 0xde, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x2a, 0x00, 0x00, 0xc7, 0x40, 0x8e, 0x00, 0x00,
+		0xc6, 0x3f, 0x00, 0x00, 0x00, 0xc8, 0xc6, 0xd0, 0x00, 0x00, 0x00, 0xc8, 0x74, 0x88, 0x00, 0x00, 0xc7, 0xff, 0x03, 0x00, 0x00, 0xc7, 0xf4, 0x00,
+		0x00, 0xc6, 0x87, 0x00, 0x00, 0xc4, 0x27, 0x00, 0x00, 0xbf, 0x04, 0x83, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xbf, 0x10, 0x00, 0x00, 0xc9,
+		0x34, 0x00, 0x00, 0xc7, 0x7b, 0x00, 0x00, 0xc7, 0xd7, 0x00, 0x00, 0xc7, 0xfe, 0xff, 0x95, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb3, 0xb3, 0xb3, 0x14,
+		0xb3, 0xb3, 0xb3, 0xec, 0xc3, 0x01, 0xb3, 0xb3, 0xb3, 0xf9, 0xaa, 0xaa, 0xaa, 0x09, 0xcd, 0x01, 0xb1, 0xb1, 0xb1, 0x31, 0xb3, 0xb3, 0xb3, 0xf7,
+		0xc3, 0x00, 0xaf, 0xaf, 0xaf, 0x20, 0xff, 0x01, 0xcc, 0xcc, 0xcc, 0x28, 0xce, 0xce, 0xce, 0xdb, 0x90, 0xcf, 0xcf, 0xcf, 0xdd, 0x01, 0xce, 0xce,
+		0xce, 0xd7, 0xce, 0xce, 0xce, 0xfc, 0xc9, 0x03, 0xce, 0xce, 0xce, 0xf3, 0xca, 0xca, 0xca, 0x18, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0x73,
+		0xca, 0x01, 0xce, 0xce, 0xce, 0xbd, 0xcd, 0xcd, 0xcd, 0x42, 0x86, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcd, 0xcd, 0xcd, 0x6c, 0xce, 0xce, 0xce, 0xfb,
+		0xc7, 0x01, 0xce, 0xce, 0xce, 0xde, 0xc6, 0xc6, 0xc6, 0x09, 0xc1, 0x00, 0xce, 0xce, 0xce, 0x73, 0xc7, 0x00, 0xce, 0xce, 0xce, 0xbb, 0x82, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd, 0x9a, 0xca, 0x01, 0xcd, 0xcd, 0xcd, 0xa4, 0xcf, 0xcf, 0xcf, 0x30, 0x85, 0x00, 0x00, 0x00, 0x00, 0x01,
+		0xd5, 0xd5, 0xd5, 0x06, 0xce, 0xce, 0xce, 0x96, 0xc8, 0x00, 0xcd, 0xcd, 0xcd, 0xb4, 0xc3, 0x00, 0xce, 0xce, 0xce, 0xa5, 0xc8, 0x00, 0xce, 0xce,
+		0xce, 0x5e, 0xff, 0xdd, 0x00, 0x00, 0x00, 0xc8, 0x6a, 0x88, 0x00, 0x00, 0xc7, 0xff, 0x01, 0x00, 0x00, 0xc7, 0x9f, 0x00, 0x00, 0xd1, 0x0b, 0x89,
+		0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xc5, 0x16, 0x00, 0x00, 0xc7, 0x7f, 0x00, 0x00, 0xc7, 0xdf, 0xc1, 0x01, 0x00, 0x00, 0xc8, 0xef, 0x00,
+		0x00, 0xc5, 0x16, 0xd5, 0x01, 0x00, 0x00, 0xc7, 0xf4, 0x00, 0x00, 0xc6, 0x36, 0xde, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xb1,
+		0xcf, 0x01, 0x00, 0x00, 0xd1, 0x0b, 0x00, 0x00, 0xc7, 0xca, 0xc7, 0x01, 0x00, 0x00, 0xc7, 0xe8, 0x00, 0x00, 0xc5, 0x30, 0x89, 0x00, 0x00, 0x00,
+		0x00, 0x03, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0xc7, 0x4e, 0x00, 0x00, 0xc6, 0xb9, 0x00, 0x00, 0xc7, 0xfc, 0xc1, 0x00, 0x00, 0x00, 0xc8, 0x81,
+		0xff, 0xcf, 0x02, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xb2, 0xb2, 0x63, 0xb3, 0xb3, 0xb3, 0xfc, 0xc2, 0x01, 0xb3, 0xb3, 0xb3, 0xff, 0xb4, 0xb4, 0xb4,
+		0x66, 0xcd, 0x01, 0xb1, 0xb1, 0xb1, 0x17, 0xb3, 0xb3, 0xb3, 0xde, 0xc3, 0x00, 0xb4, 0xb4, 0xb4, 0x3a, 0xff, 0x01, 0xcc, 0xcc, 0xcc, 0x05, 0xd1,
+		0xd1, 0xd1, 0x0b, 0x8f, 0xc6, 0xc6, 0xc6, 0x09, 0x02, 0xff, 0xff, 0xff, 0x01, 0xce, 0xce, 0xce, 0x6d, 0xce, 0xce, 0xce, 0xfb, 0xc8, 0x01, 0xce,
+		0xce, 0xce, 0xfb, 0xcd, 0xcd, 0xcd, 0x5c, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd, 0x9f, 0xc9, 0x01, 0xce, 0xce, 0xce, 0x9d, 0xdb,
+		0xdb, 0xdb, 0x07, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0xb1, 0xc7, 0x01, 0xce, 0xce, 0xce, 0xd9, 0xd5, 0xd5, 0xd5, 0x06, 0xc1,
+		0x00, 0xcf, 0xcf, 0xcf, 0xb3, 0xc7, 0x00, 0xcf, 0xcf, 0xcf, 0x84, 0xc2, 0x00, 0xce, 0xce, 0xce, 0xbf, 0xc9, 0x00, 0xcf, 0xcf, 0xcf, 0x79, 0x88,
+		0x00, 0x00, 0x00, 0x00, 0x01, 0xdb, 0xdb, 0xdb, 0x07, 0xce, 0xce, 0xce, 0xd4, 0xc7, 0x00, 0xcf, 0xcf, 0xcf, 0xb3, 0xc2, 0x01, 0xcc, 0xcc, 0xcc,
+		0x0a, 0xce, 0xce, 0xce, 0xde, 0xc8, 0x00, 0xcc, 0xcc, 0xcc, 0x37, 0xff, 0xdd, 0x00, 0x00, 0x00, 0xc7, 0xad, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0xd1,
+		0x8d, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xb6, 0x07, 0x00, 0x00, 0xc8, 0x86, 0x00, 0x00, 0xc7, 0xf8, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00,
+		0xc7, 0xce, 0x00, 0x00, 0xbf, 0x0c, 0xd5, 0x02, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc7, 0xa8, 0x00, 0x00, 0xff, 0x01, 0xef, 0x00, 0x00, 0x00,
+		0xc7, 0xb3, 0xcf, 0x00, 0x00, 0x00, 0xc5, 0x1f, 0x87, 0x00, 0x00, 0xc7, 0xff, 0x01, 0x00, 0x00, 0xc7, 0xfd, 0x00, 0x00, 0xc9, 0x2f, 0x8d, 0x00,
+		0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xc9, 0x42, 0x00, 0x00, 0xc8, 0xd8, 0xc0, 0x00, 0x00, 0x00, 0xc6, 0x51, 0xff, 0xd0, 0x01, 0xbf, 0xbf, 0xbf,
+		0x08, 0xb3, 0xb3, 0xb3, 0xe8, 0xc3, 0x01, 0xb2, 0xb2, 0xb2, 0xad, 0xaa, 0xaa, 0xaa, 0x03, 0xcc, 0x01, 0xb3, 0xb3, 0xb3, 0x0a, 0xb3, 0xb3, 0xb3,
+		0xd1, 0xc3, 0x00, 0xb2, 0xb2, 0xb2, 0x4c, 0xff, 0x91, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcd, 0xcd, 0xcd, 0x66, 0xce, 0xce, 0xce, 0xfa, 0x88, 0xce,
+		0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xf0, 0xcf, 0xcf, 0xcf, 0x4f, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0xc2, 0xc8, 0x01,
+		0xce, 0xce, 0xce, 0xad, 0xff, 0xff, 0xff, 0x01, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xcf, 0xcf, 0x89, 0xc7, 0x00, 0xce, 0xce, 0xce, 0xc0,
+		0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 0xcf, 0xcf, 0x10, 0xce, 0xce, 0xce, 0xe8, 0xc7, 0x00, 0xce, 0xce, 0xce, 0x5e, 0xc1, 0x01, 0xc9, 0xc9,
+		0xc9, 0x13, 0xce, 0xce, 0xce, 0xeb, 0xc8, 0x00, 0xce, 0xce, 0xce, 0x87, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0xa7, 0xc7, 0x00,
+		0xcd, 0xcd, 0xcd, 0xa4, 0xc2, 0x01, 0xcf, 0xcf, 0xcf, 0x25, 0xce, 0xce, 0xce, 0xfa, 0xc7, 0x01, 0xce, 0xce, 0xce, 0xe3, 0xd8, 0xd8, 0xd8, 0x0d,
+		0xff, 0xdd, 0x00, 0x00, 0x00, 0xc6, 0xd4, 0xc7, 0x00, 0x00, 0x00, 0xc8, 0x38, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xc8, 0x2e, 0x00,
+		0x00, 0xc6, 0x7e, 0x00, 0x00, 0xc8, 0x41, 0x86, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x01, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc6, 0x2d, 0xff, 0xc0,
+		0x00, 0x00, 0x00, 0xc7, 0x5f, 0xc7, 0x01, 0x00, 0x00, 0xc6, 0xb0, 0x00, 0x00, 0xbf, 0x04, 0xcd, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1,
+		0x0b, 0x00, 0x00, 0xc7, 0x69, 0x00, 0x00, 0xc6, 0x75, 0x00, 0x00, 0xaa, 0x03, 0xff, 0xd0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x9a,
+		0xc3, 0x01, 0xb3, 0xb3, 0xb3, 0xdd, 0xaf, 0xaf, 0xaf, 0x10, 0xcc, 0x01, 0x80, 0x80, 0x80, 0x02, 0xb3, 0xb3, 0xb3, 0xca, 0xc3, 0x00, 0xb3, 0xb3,
+		0xb3, 0x50, 0xff, 0xd0, 0x00, 0xcd, 0xcd, 0xcd, 0x71, 0x89, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xea, 0xce, 0xce, 0xce, 0x44, 0x81,
+		0x00, 0x00, 0x00, 0x00, 0x01, 0xd1, 0xd1, 0xd1, 0x16, 0xce, 0xce, 0xce, 0xed, 0xc7, 0x01, 0xce, 0xce, 0xce, 0xe2, 0xc9, 0xc9, 0xc9, 0x13, 0x8a,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd, 0x8b, 0xc7, 0x00, 0xce, 0xce, 0xce, 0xa1, 0xc1, 0x01, 0xcd, 0xcd, 0xcd, 0x29, 0xce, 0xce, 0xce,
+		0xfc, 0xc7, 0x00, 0xcd, 0xcd, 0xcd, 0x38, 0xc1, 0x00, 0xcd, 0xcd, 0xcd, 0x47, 0x88, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xc9, 0xff,
+		0xff, 0xff, 0x02, 0xca, 0x00, 0xcf, 0xcf, 0xcf, 0xa9, 0xc7, 0x00, 0xce, 0xce, 0xce, 0x81, 0xc2, 0x00, 0xcd, 0xcd, 0xcd, 0x42, 0x88, 0xce, 0xce,
+		0xce, 0xff, 0x00, 0xce, 0xce, 0xce, 0xab, 0xae, 0x00, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xc7, 0xf0, 0xc6, 0x01, 0x00, 0x00, 0xc7, 0xe5,
+		0x00, 0x00, 0xcc, 0x14, 0x9a, 0x00, 0x00, 0x00, 0x00, 0xd0, 0x00, 0x00, 0x00, 0xc7, 0xd0, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xc7, 0x9c, 0xc7, 0x00,
+		0x00, 0x00, 0xc7, 0x72, 0x9b, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc9, 0x00, 0xb3, 0xb3, 0xb3, 0x40, 0xc3, 0x01, 0xb3, 0xb3, 0xb3, 0xff, 0xb3, 0xb3,
+		0xb3, 0x1b, 0xff, 0xe5, 0x00, 0xcd, 0xcd, 0xcd, 0x85, 0x89, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xe4, 0xce, 0xce, 0xce, 0x34, 0x82,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xcf, 0xcf, 0x4a, 0x88, 0xce, 0xce, 0xce, 0xff, 0x00, 0xcf, 0xcf, 0xcf, 0x65, 0x8b, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xce, 0xce, 0xce, 0xa2, 0xc7, 0x00, 0xce, 0xce, 0xce, 0x69, 0xc1, 0x00, 0xcf, 0xcf, 0xcf, 0x4b, 0x87, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce,
+		0xce, 0xce, 0xe3, 0xc8, 0xc8, 0xc8, 0x0e, 0xc1, 0x00, 0xce, 0xce, 0xce, 0x7e, 0xc7, 0x01, 0xce, 0xce, 0xce, 0xf8, 0xcf, 0xcf, 0xcf, 0x3a, 0x8b,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0xc7, 0xc6, 0x01, 0xce, 0xce, 0xce, 0xfe, 0xcc, 0xcc, 0xcc, 0x3c, 0xc2, 0x00, 0xce, 0xce, 0xce,
+		0x7e, 0xc8, 0x00, 0xcf, 0xcf, 0xcf, 0x74, 0xff, 0xde, 0x87, 0x00, 0x00, 0xc7, 0xff, 0x01, 0x00, 0x00, 0xc7, 0xd0, 0x00, 0x00, 0xc8, 0x0e, 0xe3,
+		0x00, 0x00, 0x00, 0xc7, 0xfb, 0xc6, 0x01, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc7, 0x56, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7,
+		0xc4, 0xc7, 0x00, 0x00, 0x00, 0xc6, 0x55, 0xff, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x00, 0xb2, 0xb2, 0xb2, 0x3c, 0xff, 0xe3, 0x01, 0xff,
+		0xff, 0xff, 0x01, 0xcd, 0xcd, 0xcd, 0x8b, 0x89, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xda, 0xce, 0xce, 0xce, 0x2f, 0x83, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0x7e, 0xc7, 0x01, 0xce, 0xce, 0xce, 0xe1, 0xbf, 0xbf, 0xbf, 0x08, 0xca, 0x01, 0xd1, 0xd1, 0xd1, 0x16, 0xce,
+		0xce, 0xce, 0xe3, 0xc6, 0x01, 0xce, 0xce, 0xce, 0xea, 0xca, 0xca, 0xca, 0x18, 0xc1, 0x00, 0xcd, 0xcd, 0xcd, 0x80, 0xc7, 0x00, 0xcd, 0xcd, 0xcd,
+		0xaf, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd, 0x9f, 0xc7, 0x00, 0xce, 0xce, 0xce, 0xc7, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcd,
+		0xcd, 0xcd, 0x3d, 0xce, 0xce, 0xce, 0xfa, 0xc6, 0x01, 0xce, 0xce, 0xce, 0xcb, 0xaa, 0xaa, 0xaa, 0x03, 0xc2, 0x00, 0xce, 0xce, 0xce, 0xba, 0xc8,
+		0x00, 0xce, 0xce, 0xce, 0x54, 0xff, 0xe7, 0x01, 0x00, 0x00, 0xc7, 0xd9, 0x00, 0x00, 0xbf, 0x10, 0xe3, 0x00, 0x00, 0x00, 0xc7, 0x9f, 0xc7, 0x01,
+		0x00, 0x00, 0xc8, 0xc6, 0x00, 0x00, 0xcc, 0x0a, 0xff, 0x00, 0x00, 0x00, 0xc7, 0xd7, 0xc7, 0x00, 0x00, 0x00, 0xc6, 0x62, 0xff, 0xed, 0x00, 0xb4,
+		0xb4, 0xb4, 0x69, 0xff, 0xe2, 0x01, 0xaa, 0xaa, 0xaa, 0x03, 0xce, 0xce, 0xce, 0x92, 0x89, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xd5,
+		0xcf, 0xcf, 0xcf, 0x25, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0xa2, 0xc7, 0x00, 0xce, 0xce, 0xce, 0x96, 0x8b, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xce, 0xce, 0xce, 0x9c, 0x87, 0xce, 0xce, 0xce, 0xff, 0x00, 0xce, 0xce, 0xce, 0x91, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff,
+		0xff, 0x01, 0xce, 0xce, 0xce, 0xc1, 0xc7, 0x00, 0xce, 0xce, 0xce, 0x6d, 0xc2, 0x00, 0xce, 0xce, 0xce, 0xc4, 0xc7, 0x00, 0xce, 0xce, 0xce, 0x63,
+		0xca, 0x01, 0xc6, 0xc6, 0xc6, 0x09, 0xce, 0xce, 0xce, 0xc4, 0x87, 0xce, 0xce, 0xce, 0xff, 0x00, 0xce, 0xce, 0xce, 0x6e, 0x82, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0xcf, 0xcf, 0xcf, 0x10, 0xce, 0xce, 0xce, 0xe8, 0xc7, 0x01, 0xce, 0xce, 0xce, 0xf9, 0xcd, 0xcd, 0xcd, 0x29, 0xff, 0xe7, 0x01, 0x00,
+		0x00, 0xc7, 0xff, 0x00, 0x00, 0xc6, 0x28, 0xe3, 0x01, 0x00, 0x00, 0xc6, 0x36, 0x00, 0x00, 0xc7, 0xf3, 0xc6, 0x01, 0x00, 0x00, 0xc7, 0xff, 0x00,
+		0x00, 0xc7, 0x4d, 0xff, 0x00, 0x00, 0x00, 0xc7, 0xd6, 0xc7, 0x01, 0x00, 0x00, 0xc7, 0xa0, 0x00, 0x00, 0xff, 0x01, 0xff, 0xe6, 0x00, 0xb3, 0xb3,
+		0xb3, 0xe8, 0xc3, 0x00, 0xb3, 0xb3, 0xb3, 0x8d, 0xff, 0xe1, 0x01, 0xcc, 0xcc, 0xcc, 0x0a, 0xce, 0xce, 0xce, 0x9c, 0x89, 0xce, 0xce, 0xce, 0xff,
+		0x01, 0xcd, 0xcd, 0xcd, 0xce, 0xcf, 0xcf, 0xcf, 0x20, 0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x01, 0xce, 0xce, 0xce, 0xc7, 0xc6,
+		0x01, 0xce, 0xce, 0xce, 0xfd, 0xcd, 0xcd, 0xcd, 0x38, 0xc9, 0x01, 0xd5, 0xd5, 0xd5, 0x06, 0xce, 0xce, 0xce, 0x87, 0x87, 0xce, 0xce, 0xce, 0xff,
+		0x01, 0xce, 0xce, 0xce, 0xeb, 0xd1, 0xd1, 0xd1, 0x21, 0xc1, 0x01, 0xcc, 0xcc, 0xcc, 0x14, 0xce, 0xce, 0xce, 0xec, 0xc7, 0x00, 0xce, 0xce, 0xce,
+		0x39, 0xc1, 0x01, 0xcc, 0xcc, 0xcc, 0x19, 0xce, 0xce, 0xce, 0xef, 0xc6, 0x01, 0xce, 0xce, 0xce, 0xee, 0xce, 0xce, 0xce, 0x15, 0xc9, 0x01, 0xca,
+		0xca, 0xca, 0x18, 0xce, 0xce, 0xce, 0xa8, 0x87, 0xce, 0xce, 0xce, 0xff, 0x01, 0xcd, 0xcd, 0xcd, 0xce, 0xbf, 0xbf, 0xbf, 0x08, 0xc2, 0x01, 0xce,
+		0xce, 0xce, 0x2a, 0xce, 0xce, 0xce, 0xfc, 0xc7, 0x01, 0xce, 0xce, 0xce, 0xd0, 0xbf, 0xbf, 0xbf, 0x04, 0xff, 0xe8, 0x00, 0x00, 0x00, 0xc7, 0xcd,
+		0xe3, 0x01, 0x00, 0x00, 0xc5, 0x30, 0x00, 0x00, 0xc7, 0x97, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0xf1, 0xff, 0x00, 0x00, 0x00, 0xc7, 0xbf, 0xc7, 0x01,
+		0x00, 0x00, 0xc7, 0xfa, 0x00, 0x00, 0xc5, 0x35, 0xff, 0xcf, 0x00, 0xaa, 0xaa, 0xaa, 0x06, 0x93, 0xb3, 0xb3, 0xb3, 0x14, 0x01, 0xb6, 0xb6, 0xb6,
+		0x07, 0xb3, 0xb3, 0xb3, 0xde, 0xc3, 0x00, 0xb3, 0xb3, 0xb3, 0xa0, 0xff, 0xe0, 0x01, 0xc8, 0xc8, 0xc8, 0x0e, 0xce, 0xce, 0xce, 0xac, 0x89, 0xce,
+		0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xc0, 0xca, 0xca, 0xca, 0x18, 0x85, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd0, 0xd0, 0xd0, 0x1b, 0xce, 0xce,
+		0xce, 0xf0, 0xc6, 0x01, 0xce, 0xce, 0xce, 0xe1, 0xc6, 0xc6, 0xc6, 0x09, 0xc7, 0x02, 0xbf, 0xbf, 0xbf, 0x04, 0xcf, 0xcf, 0xcf, 0x4a, 0xce, 0xce,
+		0xce, 0xc0, 0x88, 0xce, 0xce, 0xce, 0xff, 0x00, 0xce, 0xce, 0xce, 0x6d, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcc, 0xcc, 0xcc, 0x2d, 0xce, 0xce,
+		0xce, 0xfd, 0xc6, 0x01, 0xce, 0xce, 0xce, 0xf6, 0xcc, 0xcc, 0xcc, 0x1e, 0xc1, 0x00, 0xcd, 0xcd, 0xcd, 0x4d, 0x87, 0xce, 0xce, 0xce, 0xff, 0x00,
+		0xce, 0xce, 0xce, 0xcb, 0x88, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcc, 0xcc, 0xcc, 0x0f, 0xcd, 0xcd, 0xcd, 0x5c, 0xce, 0xce, 0xce, 0xd9, 0x87, 0xce,
+		0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xfa, 0xcd, 0xcd, 0xcd, 0x47, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0x4e, 0x88, 0xce,
+		0xce, 0xce, 0xff, 0x00, 0xce, 0xce, 0xce, 0x98, 0xaf, 0x00, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0xc7, 0xec, 0xc7, 0x02, 0x00, 0x00, 0xc7,
+		0xff, 0x00, 0x00, 0xc8, 0xa6, 0x00, 0x00, 0xc6, 0x09, 0xe1, 0x02, 0x00, 0x00, 0xc8, 0x38, 0x00, 0x00, 0xc5, 0x2c, 0x00, 0x00, 0xc7, 0xfe, 0xc6,
+		0x01, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc6, 0x75, 0xfe, 0x00, 0x00, 0x00, 0xc7, 0x92, 0xc7, 0x02, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc7,
+		0xf2, 0x00, 0x00, 0xca, 0x2b, 0xff, 0xcd, 0x01, 0xb4, 0xb4, 0xb4, 0x52, 0xb3, 0xb3, 0xb3, 0xe4, 0x94, 0xb3, 0xb3, 0xb3, 0xf7, 0x00, 0xb3, 0xb3,
+		0xb3, 0xfd, 0xc3, 0x00, 0xb3, 0xb3, 0xb3, 0xae, 0xff, 0xdf, 0x01, 0xd2, 0xd2, 0xd2, 0x11, 0xce, 0xce, 0xce, 0xb2, 0x89, 0xce, 0xce, 0xce, 0xff,
+		0x01, 0xce, 0xce, 0xce, 0xb7, 0xc8, 0xc8, 0xc8, 0x0e, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd, 0x51, 0x87, 0xce, 0xce, 0xce, 0xff,
+		0x00, 0xce, 0xce, 0xce, 0xc5, 0x84, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd5, 0xd5, 0xd5, 0x12, 0xcd, 0xcd, 0xcd, 0x33, 0xce, 0xce, 0xce, 0x54, 0xce,
+		0xce, 0xce, 0x7d, 0xcd, 0xcd, 0xcd, 0xce, 0x89, 0xce, 0xce, 0xce, 0xff, 0x00, 0xce, 0xce, 0xce, 0xa2, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd,
+		0xcd, 0xcd, 0x56, 0x87, 0xce, 0xce, 0xce, 0xff, 0x01, 0xcd, 0xcd, 0xcd, 0xd3, 0xd5, 0xd5, 0xd5, 0x06, 0xc1, 0x00, 0xce, 0xce, 0xce, 0x82, 0xc7,
+		0x00, 0xce, 0xce, 0xce, 0x9d, 0xc3, 0x05, 0xff, 0xff, 0xff, 0x02, 0xce, 0xce, 0xce, 0x1a, 0xcf, 0xcf, 0xcf, 0x3a, 0xcf, 0xcf, 0xcf, 0x5b, 0xce,
+		0xce, 0xce, 0x8c, 0xce, 0xce, 0xce, 0xde, 0x89, 0xce, 0xce, 0xce, 0xff, 0x00, 0xce, 0xce, 0xce, 0x7c, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd,
+		0xcd, 0xcd, 0x8a, 0xc8, 0x00, 0xce, 0xce, 0xce, 0x69, 0xff, 0xdf, 0x00, 0x00, 0x00, 0xc6, 0xcb, 0xc8, 0x02, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00,
+		0xc7, 0xd1, 0x00, 0x00, 0xc8, 0x2e, 0xe0, 0x02, 0x00, 0x00, 0xc6, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xba, 0xc7, 0x01, 0x00, 0x00,
+		0xc7, 0xe0, 0x00, 0x00, 0xc4, 0x1a, 0xfd, 0x00, 0x00, 0x00, 0xc9, 0x4b, 0xc8, 0x02, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc7, 0xf4, 0x00, 0x00,
+		0xc8, 0x74, 0xff, 0xcb, 0x01, 0xb3, 0xb3, 0xb3, 0x0a, 0xb3, 0xb3, 0xb3, 0xfe, 0x9b, 0xb3, 0xb3, 0xb3, 0xff, 0x00, 0xb3, 0xb3, 0xb3, 0xaf, 0xff,
+		0xde, 0x01, 0xce, 0xce, 0xce, 0x15, 0xce, 0xce, 0xce, 0xb8, 0x89, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xac, 0xd1, 0xd1, 0xd1, 0x0b,
+		0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xcf, 0xcf, 0x89, 0xc7, 0x07, 0xce, 0xce, 0xce, 0x86, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xd0, 0xd0, 0x36,
+		0xce, 0xce, 0xce, 0x58, 0xce, 0xce, 0xce, 0x73, 0xce, 0xce, 0xce, 0x9b, 0xce, 0xce, 0xce, 0xc6, 0xce, 0xce, 0xce, 0xe5, 0x8c, 0xce, 0xce, 0xce,
+		0xff, 0x01, 0xce, 0xce, 0xce, 0xb6, 0xc6, 0xc6, 0xc6, 0x09, 0xc3, 0x00, 0xcd, 0xcd, 0xcd, 0x95, 0xc7, 0x00, 0xce, 0xce, 0xce, 0x97, 0x82, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0xa8, 0xc7, 0x07, 0xcd, 0xcd, 0xcd, 0x4d, 0xcc, 0xcc, 0xcc, 0x0a, 0xcf, 0xcf, 0xcf, 0x40, 0xce, 0xce,
+		0xce, 0x5d, 0xcf, 0xcf, 0xcf, 0x79, 0xcd, 0xcd, 0xcd, 0xa4, 0xce, 0xce, 0xce, 0xd1, 0xce, 0xce, 0xce, 0xed, 0x8c, 0xce, 0xce, 0xce, 0xff, 0x00,
+		0xce, 0xce, 0xce, 0x98, 0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0xaa, 0xaa, 0xaa, 0x03, 0xce, 0xce, 0xce, 0xcc, 0xc8, 0x00, 0xcd, 0xcd, 0xcd, 0x48,
+		0xff, 0xdf, 0x00, 0x00, 0x00, 0xc6, 0x99, 0xc9, 0x03, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc7, 0xf8, 0x00, 0x00, 0xc7, 0x9f, 0x00, 0x00, 0xca,
+		0x2b, 0xde, 0x02, 0x00, 0x00, 0xc8, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x20, 0xc7, 0x01, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc7,
+		0x7a, 0xfd, 0x01, 0x00, 0x00, 0xc5, 0x16, 0x00, 0x00, 0xc7, 0xf3, 0x8a, 0x00, 0x00, 0xc7, 0xff, 0x02, 0x00, 0x00, 0xc7, 0xc7, 0x00, 0x00, 0xc6,
+		0x59, 0x00, 0x00, 0xff, 0x02, 0xff, 0xc8, 0x00, 0xb2, 0xb2, 0xb2, 0x32, 0x9c, 0xb3, 0xb3, 0xb3, 0xff, 0x00, 0xb3, 0xb3, 0xb3, 0xa0, 0xff, 0xdd,
+		0x01, 0xd0, 0xd0, 0xd0, 0x26, 0xce, 0xce, 0xce, 0xc6, 0x89, 0xce, 0xce, 0xce, 0xff, 0x00, 0xcf, 0xcf, 0xcf, 0x99, 0x89, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xce, 0xce, 0xce, 0xaa, 0xc7, 0x01, 0xce, 0xce, 0xce, 0xa6, 0xce, 0xce, 0xce, 0xbf, 0x91, 0xce, 0xce, 0xce, 0xff, 0x01, 0xcd, 0xcd, 0xcd,
+		0xa4, 0xd1, 0xd1, 0xd1, 0x0b, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcc, 0xcc, 0xcc, 0x05, 0xce, 0xce, 0xce, 0xd1, 0xc7, 0x00, 0xce, 0xce, 0xce,
+		0x58, 0xc1, 0x01, 0xff, 0xff, 0xff, 0x02, 0xce, 0xce, 0xce, 0xcf, 0xc6, 0x02, 0xce, 0xce, 0xce, 0xfb, 0xce, 0xce, 0xce, 0x93, 0xce, 0xce, 0xce,
+		0xd5, 0x90, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xfe, 0xcf, 0xcf, 0xcf, 0x89, 0x85, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcc, 0xcc, 0xcc,
+		0x19, 0xce, 0xce, 0xce, 0xf1, 0xc7, 0x01, 0xcd, 0xcd, 0xcd, 0xf2, 0xca, 0xca, 0xca, 0x1d, 0xff, 0xdf, 0x01, 0x00, 0x00, 0xc9, 0x3d, 0x00, 0x00,
+		0xc7, 0xfe, 0x8b, 0x00, 0x00, 0xc7, 0xff, 0x02, 0x00, 0x00, 0xc7, 0xfb, 0x00, 0x00, 0xc6, 0xa2, 0x00, 0x00, 0xc8, 0x33, 0xdc, 0x00, 0x00, 0x00,
+		0xc7, 0x4d, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xab, 0xc7, 0x01, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xff, 0x02, 0xea, 0x00,
+		0x00, 0x00, 0xc7, 0xb1, 0xcf, 0x01, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0xc7, 0xa8, 0x8c, 0x00, 0x00, 0xc7, 0xff, 0x02, 0x00, 0x00, 0xc7, 0xd0,
+		0x00, 0x00, 0xc8, 0x5c, 0x00, 0x00, 0xbf, 0x08, 0xff, 0xc6, 0x00, 0xb3, 0xb3, 0xb3, 0x39, 0xdc, 0x00, 0xb3, 0xb3, 0xb3, 0x8c, 0xff, 0xdc, 0x01,
+		0xd1, 0xd1, 0xd1, 0x21, 0xce, 0xce, 0xce, 0xd5, 0x89, 0xce, 0xce, 0xce, 0xff, 0x00, 0xcd, 0xcd, 0xcd, 0x95, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01,
+		0xaa, 0xaa, 0xaa, 0x03, 0xce, 0xce, 0xce, 0xd0, 0x9a, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xf0, 0xce, 0xce, 0xce, 0x83, 0x85, 0x00,
+		0x00, 0x00, 0x00, 0x01, 0xca, 0xca, 0xca, 0x1d, 0xce, 0xce, 0xce, 0xf5, 0xc6, 0x01, 0xce, 0xce, 0xce, 0xfe, 0xd0, 0xd0, 0xd0, 0x31, 0xc1, 0x01,
+		0xcb, 0xcb, 0xcb, 0x22, 0xce, 0xce, 0xce, 0xf6, 0x9a, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xe6, 0xce, 0xce, 0xce, 0x5e, 0x86, 0x00,
+		0x00, 0x00, 0x00, 0x01, 0xcc, 0xcc, 0xcc, 0x32, 0xce, 0xce, 0xce, 0xfe, 0xc7, 0x00, 0xcf, 0xcf, 0xcf, 0xc8, 0xb0, 0x00, 0x00, 0x00, 0x00, 0xef,
+		0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xb9, 0x8e, 0x00, 0x00, 0xc7, 0xff, 0x01, 0x00, 0x00, 0xc7, 0xc0, 0x00, 0x00, 0xc8, 0x58, 0xda,
+		0x00, 0x00, 0x00, 0xc6, 0x55, 0xc0, 0x01, 0x00, 0x00, 0xc8, 0x3c, 0x00, 0x00, 0xc7, 0xf6, 0xc7, 0x00, 0x00, 0x00, 0xc6, 0xa2, 0xdb, 0x01, 0x00,
+		0x00, 0xc6, 0x3f, 0x00, 0x00, 0xc6, 0x4c, 0x8b, 0x00, 0x00, 0xc9, 0x4b, 0x00, 0x00, 0x00, 0xc7, 0xc9, 0xcf, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xc8, 0x2e, 0x00, 0x00, 0xc7, 0xfe, 0x8d, 0x00, 0x00, 0xc7, 0xff, 0x02, 0x00, 0x00, 0xc7, 0xe3, 0x00, 0x00, 0xc7, 0x84, 0x00, 0x00, 0xca,
+		0x18, 0xff, 0xc4, 0x00, 0xb1, 0xb1, 0xb1, 0x31, 0xc3, 0x01, 0xb3, 0xb3, 0xb3, 0xf6, 0xb3, 0xb3, 0xb3, 0x82, 0x8e, 0xb2, 0xb2, 0xb2, 0x71, 0x01,
+		0xb4, 0xb4, 0xb4, 0x69, 0xb3, 0xb3, 0xb3, 0xe9, 0xc3, 0x00, 0xb4, 0xb4, 0xb4, 0x66, 0xff, 0xdb, 0x01, 0xcf, 0xcf, 0xcf, 0x25, 0xce, 0xce, 0xce,
+		0xd7, 0x89, 0xce, 0xce, 0xce, 0xff, 0x00, 0xcf, 0xcf, 0xcf, 0x8e, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd1, 0xd1, 0xd1, 0x27, 0xce, 0xce, 0xce,
+		0xf7, 0xd8, 0x02, 0xcd, 0xcd, 0xcd, 0xf2, 0xce, 0xce, 0xce, 0xab, 0xce, 0xce, 0xce, 0x2a, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xd0, 0xd0,
+		0x36, 0x87, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xf0, 0xcc, 0xcc, 0xcc, 0x19, 0xc1, 0x00, 0xcd, 0xcd, 0xcd, 0x5c, 0x99, 0xce, 0xce,
+		0xce, 0xff, 0x02, 0xce, 0xce, 0xce, 0xea, 0xce, 0xce, 0xce, 0x97, 0xce, 0xce, 0xce, 0x1a, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xcf, 0xcf,
+		0x5f, 0x88, 0xce, 0xce, 0xce, 0xff, 0x00, 0xcd, 0xcd, 0xcd, 0x85, 0xff, 0xe1, 0x01, 0x00, 0x00, 0xc9, 0x13, 0x00, 0x00, 0xc7, 0xf0, 0x8f, 0x00,
+		0x00, 0xc7, 0xff, 0x02, 0x00, 0x00, 0xc6, 0xcb, 0x00, 0x00, 0xc6, 0x5e, 0x00, 0x00, 0xaa, 0x03, 0xd7, 0x00, 0x00, 0x00, 0xc7, 0x52, 0xc0, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xbd, 0xc7, 0x01, 0x00, 0x00, 0xc7, 0xf2, 0x00, 0x00, 0xc6, 0x2d, 0xd9, 0x01, 0x00, 0x00, 0xc7, 0x56,
+		0x00, 0x00, 0xc7, 0xfe, 0x95, 0x00, 0x00, 0xc7, 0xff, 0xc8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x84, 0x8f, 0x00, 0x00, 0xc7, 0xff,
+		0x02, 0x00, 0x00, 0xc7, 0xf2, 0x00, 0x00, 0xc7, 0x85, 0x00, 0x00, 0xc7, 0x20, 0xff, 0xc2, 0x00, 0xb6, 0xb6, 0xb6, 0x23, 0xc3, 0x01, 0xb3, 0xb3,
+		0xb3, 0xee, 0xaf, 0xaf, 0xaf, 0x20, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0xed, 0xc3, 0x00, 0xb3, 0xb3, 0xb3, 0x36, 0xdf, 0x01,
+		0xb6, 0xb6, 0xb6, 0x15, 0xb3, 0xb3, 0xb3, 0xeb, 0xc3, 0x00, 0xb2, 0xb2, 0xb2, 0x42, 0xf2, 0x01, 0xcc, 0xcc, 0xcc, 0x32, 0xce, 0xce, 0xce, 0xde,
+		0x89, 0xce, 0xce, 0xce, 0xff, 0x00, 0xce, 0xce, 0xce, 0x82, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0x62, 0x96, 0xce, 0xce, 0xce,
+		0xff, 0x03, 0xce, 0xce, 0xce, 0xf3, 0xcd, 0xcd, 0xcd, 0xd3, 0xcf, 0xcf, 0xcf, 0x89, 0xcd, 0xcd, 0xcd, 0x24, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xcf, 0xcf, 0xcf, 0x6a, 0xc7, 0x01, 0xce, 0xce, 0xce, 0xcb, 0xff, 0xff, 0xff, 0x02, 0xc1, 0x00, 0xcd, 0xcd, 0xcd, 0x90, 0xd6, 0x03, 0xce, 0xce,
+		0xce, 0xf0, 0xce, 0xce, 0xce, 0xcb, 0xcf, 0xcf, 0xcf, 0x79, 0xca, 0xca, 0xca, 0x18, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0xa1,
+		0xc8, 0x00, 0xcf, 0xcf, 0xcf, 0x4a, 0xff, 0xe1, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x4a, 0x00, 0x00, 0xc7, 0xf7, 0x90, 0x00, 0x00,
+		0xc7, 0xff, 0x01, 0x00, 0x00, 0xc8, 0xcf, 0x00, 0x00, 0xc6, 0x3a, 0xd6, 0x00, 0x00, 0x00, 0xc7, 0x57, 0xc1, 0x00, 0x00, 0x00, 0xc3, 0x1e, 0xc7,
+		0x01, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc8, 0x9d, 0xd9, 0x00, 0x00, 0x00, 0xc7, 0x9e, 0x96, 0x00, 0x00, 0xc7, 0xff, 0xc9, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xc7, 0xb1, 0x90, 0x00, 0x00, 0xc7, 0xff, 0x02, 0x00, 0x00, 0xc7, 0xf6, 0x00, 0x00, 0xc7, 0x7b, 0x00, 0x00, 0xbf, 0x04,
+		0xff, 0xc0, 0x00, 0xaa, 0xaa, 0xaa, 0x0c, 0xc3, 0x01, 0xb3, 0xb3, 0xb3, 0xf2, 0xb1, 0xb1, 0xb1, 0x2e, 0xcf, 0x84, 0xb3, 0xb3, 0xb3, 0xff, 0x00,
+		0xb8, 0xb8, 0xb8, 0x19, 0xdf, 0x01, 0xb6, 0xb6, 0xb6, 0x0e, 0xb3, 0xb3, 0xb3, 0xea, 0xc3, 0x00, 0xb4, 0xb4, 0xb4, 0x55, 0xcd, 0x00, 0xb4, 0xb4,
+		0xb4, 0x3d, 0xe1, 0x01, 0xcc, 0xcc, 0xcc, 0x3c, 0xce, 0xce, 0xce, 0xea, 0x88, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xfe, 0xce, 0xce,
+		0xce, 0x6e, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0x91, 0xd0, 0x07, 0xce, 0xce, 0xce, 0xfe, 0xce, 0xce, 0xce, 0xe9, 0xce, 0xce,
+		0xce, 0xd7, 0xce, 0xce, 0xce, 0xc6, 0xcd, 0xcd, 0xcd, 0x9f, 0xce, 0xce, 0xce, 0x5e, 0xd1, 0xd1, 0xd1, 0x21, 0xaa, 0xaa, 0xaa, 0x03, 0x8a, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0xb8, 0xc7, 0x00, 0xce, 0xce, 0xce, 0x88, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0xb0,
+		0xd0, 0x06, 0xce, 0xce, 0xce, 0xfd, 0xce, 0xce, 0xce, 0xe7, 0xcd, 0xcd, 0xcd, 0xd3, 0xce, 0xce, 0xce, 0xc1, 0xcd, 0xcd, 0xcd, 0x95, 0xcd, 0xcd,
+		0xcd, 0x56, 0xd1, 0xd1, 0xd1, 0x1c, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x01, 0xdb, 0xdb, 0xdb, 0x07, 0xce, 0xce, 0xce, 0xd9, 0xc7, 0x01, 0xce, 0xce,
+		0xce, 0xfb, 0xcc, 0xcc, 0xcc, 0x28, 0xff, 0xe2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x50, 0x00, 0x00, 0xc7, 0xfc, 0xcf, 0x03, 0x00,
+		0x00, 0xc7, 0xff, 0x00, 0x00, 0xc7, 0xfa, 0x00, 0x00, 0xc8, 0x9d, 0x00, 0x00, 0xb6, 0x07, 0xd4, 0x00, 0x00, 0x00, 0xc7, 0x60, 0xc1, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xa0, 0xc7, 0x01, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc5, 0x23, 0xd7, 0x01, 0x00, 0x00, 0xbf, 0x04, 0x00,
+		0x00, 0xc6, 0xb0, 0xe2, 0x01, 0x00, 0x00, 0xc8, 0x0e, 0x00, 0x00, 0xc6, 0xb0, 0x91, 0x00, 0x00, 0xc7, 0xff, 0x01, 0x00, 0x00, 0xc7, 0xd1, 0x00,
+		0x00, 0xc8, 0x38, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0xf9, 0xc2, 0x01, 0xb3, 0xb3, 0xb3, 0xf9, 0xb4, 0xb4, 0xb4, 0x47,
+		0xce, 0x00, 0xb2, 0xb2, 0xb2, 0x42, 0xc3, 0x01, 0xb4, 0xb4, 0xb4, 0xd5, 0xb6, 0xb6, 0xb6, 0x0e, 0xdf, 0x01, 0xaa, 0xaa, 0xaa, 0x03, 0xb3, 0xb3,
+		0xb3, 0xe7, 0xc3, 0x00, 0xb3, 0xb3, 0xb3, 0x72, 0xcd, 0x00, 0xb2, 0xb2, 0xb2, 0x42, 0xe0, 0x01, 0xce, 0xce, 0xce, 0x43, 0xce, 0xce, 0xce, 0xee,
+		0x88, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xf8, 0xcd, 0xcd, 0xcd, 0x66, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0xb2,
+		0xca, 0x08, 0xce, 0xce, 0xce, 0xf7, 0xce, 0xce, 0xce, 0xdc, 0xce, 0xce, 0xce, 0xca, 0xcd, 0xcd, 0xcd, 0xaf, 0xcd, 0xcd, 0xcd, 0x8a, 0xce, 0xce,
+		0xce, 0x5e, 0xd0, 0xd0, 0xd0, 0x31, 0xc9, 0xc9, 0xc9, 0x13, 0xcc, 0xcc, 0xcc, 0x05, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 0xcf, 0xcf, 0x20,
+		0xce, 0xce, 0xce, 0xf6, 0xc7, 0x00, 0xcd, 0xcd, 0xcd, 0x4c, 0xc1, 0x01, 0xdb, 0xdb, 0xdb, 0x07, 0xce, 0xce, 0xce, 0xd9, 0xca, 0x08, 0xcd, 0xcd,
+		0xcd, 0xf2, 0xce, 0xce, 0xce, 0xda, 0xcf, 0xcf, 0xcf, 0xc8, 0xcf, 0xcf, 0xcf, 0xa9, 0xce, 0xce, 0xce, 0x81, 0xce, 0xce, 0xce, 0x59, 0xcc, 0xcc,
+		0xcc, 0x2d, 0xcf, 0xcf, 0xcf, 0x10, 0xaa, 0xaa, 0xaa, 0x03, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd1, 0xd1, 0xd1, 0x21, 0xce, 0xce, 0xce, 0xf7,
+		0xc7, 0x01, 0xce, 0xce, 0xce, 0xe3, 0xd8, 0xd8, 0xd8, 0x0d, 0xff, 0xe3, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x3a, 0x00, 0x00, 0xc6,
+		0xdd, 0x91, 0x00, 0x00, 0xc7, 0xff, 0x01, 0x00, 0x00, 0xc7, 0xc9, 0x00, 0x00, 0xc6, 0x1b, 0xd3, 0x00, 0x00, 0x00, 0xc6, 0x5e, 0xc2, 0x01, 0x00,
+		0x00, 0xc6, 0x2d, 0x00, 0x00, 0xc7, 0xf3, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0xc3, 0xd7, 0x01, 0x00, 0x00, 0xd5, 0x06, 0x00, 0x00, 0xc7, 0xb5, 0xe2,
+		0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xc6, 0x94, 0x00, 0x00, 0xc7, 0xfb, 0x91, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0x00, 0xc8, 0x54,
+		0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0xbf, 0xc2, 0x01, 0xb3, 0xb3, 0xb3, 0xff, 0xb3, 0xb3, 0xb3, 0x6f, 0xce, 0x00, 0xb3, 0xb3,
+		0xb3, 0xab, 0xc3, 0x01, 0xb3, 0xb3, 0xb3, 0xa2, 0xff, 0xff, 0xff, 0x01, 0xdf, 0x01, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0xe2, 0xc3, 0x00,
+		0xb4, 0xb4, 0xb4, 0x9f, 0xcc, 0x01, 0x80, 0x80, 0x80, 0x02, 0xb3, 0xb3, 0xb3, 0xcf, 0xdf, 0x01, 0xcf, 0xcf, 0xcf, 0x4b, 0xce, 0xce, 0xce, 0xf1,
+		0x88, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xf1, 0xcf, 0xcf, 0xcf, 0x55, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc6, 0xc6, 0xc6, 0x09,
+		0xce, 0xce, 0xce, 0xdc, 0xc8, 0x03, 0xce, 0xce, 0xce, 0xec, 0xcf, 0xcf, 0xcf, 0x8f, 0xd1, 0xd1, 0xd1, 0x27, 0xbf, 0xbf, 0xbf, 0x08, 0x95, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xcf, 0xcf, 0xcf, 0x7f, 0x87, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xfc, 0xce, 0xce, 0xce, 0x2a, 0xc1, 0x01,
+		0xd0, 0xd0, 0xd0, 0x31, 0xce, 0xce, 0xce, 0xfc, 0xc8, 0x03, 0xce, 0xce, 0xce, 0xe0, 0xcf, 0xcf, 0xcf, 0x7a, 0xcf, 0xcf, 0xcf, 0x20, 0xbf, 0xbf,
+		0xbf, 0x08, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd, 0x3d, 0x88, 0xce, 0xce, 0xce, 0xff, 0x00, 0xce, 0xce, 0xce, 0xb1, 0xb1, 0x00,
+		0x00, 0x00, 0x00, 0xf3, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x07, 0x00, 0x00, 0xc7, 0x91, 0x00, 0x00, 0xc7, 0xfb, 0xcf, 0x02, 0x00,
+		0x00, 0xc7, 0xff, 0x00, 0x00, 0xc7, 0xe3, 0x00, 0x00, 0xd1, 0x0b, 0xd7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xa3, 0xc7, 0x01, 0x00,
+		0x00, 0xc7, 0xff, 0x00, 0x00, 0xc9, 0x4b, 0xd6, 0x01, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0xc8, 0xaf, 0xe4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xc8, 0x38, 0x00, 0x00, 0xc7, 0xdb, 0xd0, 0x01, 0x00, 0x00, 0xc7, 0xfc, 0x00, 0x00, 0xc6, 0x5e, 0xff, 0x00, 0xb4, 0xb4, 0xb4, 0x66, 0xc3,
+		0x00, 0xb3, 0xb3, 0xb3, 0xbd, 0xcd, 0x01, 0xb0, 0xb0, 0xb0, 0x1d, 0xb3, 0xb3, 0xb3, 0xee, 0xc3, 0x00, 0xb3, 0xb3, 0xb3, 0x51, 0x8d, 0x00, 0x00,
+		0x00, 0x00, 0xd2, 0x00, 0xb3, 0xb3, 0xb3, 0xbd, 0xc3, 0x01, 0xb4, 0xb4, 0xb4, 0xd5, 0xb6, 0xb6, 0xb6, 0x0e, 0xca, 0x01, 0xbf, 0xbf, 0xbf, 0x04,
+		0xb3, 0xb3, 0xb3, 0xbe, 0x84, 0xb3, 0xb3, 0xb3, 0xff, 0xd9, 0x01, 0xce, 0xce, 0xce, 0x62, 0xce, 0xce, 0xce, 0xf9, 0x88, 0xce, 0xce, 0xce, 0xff,
+		0x01, 0xce, 0xce, 0xce, 0xea, 0xce, 0xce, 0xce, 0x43, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcf, 0xcf, 0xcf, 0x35, 0xce, 0xce, 0xce, 0xfe, 0xc7,
+		0x01, 0xce, 0xce, 0xce, 0xc7, 0xcb, 0xcb, 0xcb, 0x22, 0x97, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcd, 0xcd, 0xcd, 0x2e, 0xce, 0xce, 0xce, 0xf4, 0xc7,
+		0x01, 0xce, 0xce, 0xce, 0xe8, 0xcf, 0xcf, 0xcf, 0x10, 0xc1, 0x00, 0xcd, 0xcd, 0xcd, 0x6b, 0x88, 0xce, 0xce, 0xce, 0xff, 0x01, 0xcf, 0xcf, 0xcf,
+		0xa9, 0xd2, 0xd2, 0xd2, 0x11, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd, 0x70, 0xc8, 0x00, 0xcf, 0xcf, 0xcf, 0x6f, 0xff, 0xa8, 0x00,
+		0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xc9, 0x34, 0x00, 0x00, 0xc7, 0xa9, 0x00, 0x00, 0xc7, 0xfd, 0xce, 0x02, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00,
+		0xc7, 0xc3, 0x00, 0x00, 0xcc, 0x05, 0xd7, 0x00, 0x00, 0x00, 0xc8, 0x17, 0xc8, 0x01, 0x00, 0x00, 0xc8, 0xb8, 0x00, 0x00, 0xb6, 0x07, 0xd5, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x9a, 0xe5, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x0c, 0x00, 0x00, 0xc7, 0x7b, 0x00, 0x00,
+		0xc7, 0xe5, 0x90, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0x00, 0xc9, 0x2f, 0xfe, 0x00, 0xb6, 0xb6, 0xb6, 0x0e, 0xc3, 0x01, 0xb3, 0xb3, 0xb3, 0xff,
+		0xb1, 0xb1, 0xb1, 0x27, 0xcc, 0x00, 0xb3, 0xb3, 0xb3, 0x86, 0x83, 0xb3, 0xb3, 0xb3, 0xff, 0x00, 0xb3, 0xb3, 0xb3, 0xee, 0x8e, 0x00, 0x00, 0x00,
+		0x00, 0xd2, 0x00, 0xb3, 0xb3, 0xb3, 0x7c, 0xc3, 0x01, 0xb3, 0xb3, 0xb3, 0xff, 0xb3, 0xb3, 0xb3, 0x40, 0xc9, 0x02, 0xaa, 0xaa, 0xaa, 0x03, 0xb3,
+		0xb3, 0xb3, 0xa7, 0xb3, 0xb3, 0xb3, 0xfe, 0xde, 0x00, 0xce, 0xce, 0xce, 0x68, 0x89, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xed, 0xcf,
+		0xcf, 0xcf, 0x3b, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd, 0x6b, 0x87, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xdf, 0xca,
+		0xca, 0xca, 0x18, 0x97, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbf, 0xbf, 0xbf, 0x08, 0xcf, 0xcf, 0xcf, 0xc3, 0x88, 0xce, 0xce, 0xce, 0xff, 0x00, 0xcd,
+		0xcd, 0xcd, 0xb4, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xcf, 0xcf, 0x94, 0xc7, 0x01, 0xce, 0xce, 0xce, 0xc4, 0xcc, 0xcc, 0xcc, 0x05, 0x9a,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0xb1, 0xc8, 0x00, 0xcf, 0xcf, 0xcf, 0x3b, 0xff, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+		0xc5, 0x30, 0x00, 0x00, 0xc7, 0xa5, 0x00, 0x00, 0xc7, 0xfe, 0xcd, 0x01, 0x00, 0x00, 0xc7, 0xfe, 0x00, 0x00, 0xc8, 0x74, 0xd7, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xc8, 0x86, 0xc7, 0x01, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xca, 0x2b, 0xd6, 0x01, 0x00, 0x00, 0xc8, 0x4f, 0x00, 0x00,
+		0xc7, 0xfe, 0xe5, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xbf, 0x0c, 0x00, 0x00, 0xc8, 0x78, 0x00, 0x00, 0xc7, 0xe4, 0xce, 0x01, 0x00,
+		0x00, 0xc6, 0xdd, 0x00, 0x00, 0xc6, 0x09, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0xb8, 0xc3, 0x00, 0xb3, 0xb3, 0xb3, 0xd7, 0xcb,
+		0x00, 0xb3, 0xb3, 0xb3, 0x36, 0x84, 0xb3, 0xb3, 0xb3, 0xff, 0x00, 0xb4, 0xb4, 0xb4, 0x62, 0xe2, 0x00, 0xb5, 0xb5, 0xb5, 0x26, 0xc4, 0x00, 0xb3,
+		0xb3, 0xb3, 0xe3, 0xc8, 0x01, 0xaa, 0xaa, 0xaa, 0x06, 0xb3, 0xb3, 0xb3, 0xb5, 0x86, 0xb3, 0xb3, 0xb3, 0xff, 0xd7, 0x01, 0xce, 0xce, 0xce, 0x6e,
+		0xce, 0xce, 0xce, 0xfd, 0xc8, 0x01, 0xce, 0xce, 0xce, 0xe5, 0xcd, 0xcd, 0xcd, 0x38, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0x93,
+		0xc7, 0x00, 0xce, 0xce, 0xce, 0x81, 0x97, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc6, 0xc6, 0xc6, 0x09, 0xce, 0xce, 0xce, 0xa7, 0x89, 0xce, 0xce, 0xce,
+		0xff, 0x00, 0xcd, 0xcd, 0xcd, 0x76, 0xc2, 0x00, 0xce, 0xce, 0xce, 0xb2, 0xc7, 0x00, 0xcd, 0xcd, 0xcd, 0x56, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x01,
+		0xd8, 0xd8, 0xd8, 0x0d, 0xce, 0xce, 0xce, 0xe3, 0xc7, 0x01, 0xce, 0xce, 0xce, 0xf7, 0xcb, 0xcb, 0xcb, 0x22, 0xff, 0xac, 0x00, 0x00, 0x00, 0x00,
+		0x02, 0x00, 0x00, 0xc5, 0x23, 0x00, 0x00, 0xc8, 0x7d, 0x00, 0x00, 0xc7, 0xeb, 0xcb, 0x02, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc7, 0xf5, 0x00,
+		0x00, 0xb6, 0x07, 0xd7, 0x01, 0x00, 0x00, 0xc9, 0x13, 0x00, 0x00, 0xc7, 0xe4, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0xc7, 0xc1, 0x00, 0x00, 0x00, 0xc7,
+		0xb3, 0xd2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x2e, 0x00, 0x00, 0xc7, 0x37, 0x8b, 0x00, 0x00, 0xc6, 0x36, 0x00, 0x00, 0x00, 0xc7,
+		0xc3, 0xd8, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xbf, 0x08, 0x00, 0x00, 0xc7, 0x56, 0x00, 0x00, 0xc6, 0xc2, 0xcc, 0x01, 0x00, 0x00,
+		0xc7, 0xfe, 0x00, 0x00, 0xc7, 0x6e, 0xfe, 0x01, 0xb3, 0xb3, 0xb3, 0x4d, 0xb3, 0xb3, 0xb3, 0xf9, 0xc2, 0x02, 0xb3, 0xb3, 0xb3, 0xff, 0xb3, 0xb3,
+		0xb3, 0xa5, 0xb6, 0xb6, 0xb6, 0x07, 0xc8, 0x01, 0xb4, 0xb4, 0xb4, 0x44, 0xb3, 0xb3, 0xb3, 0xf4, 0xc3, 0x01, 0xb3, 0xb3, 0xb3, 0xcd, 0xff, 0xff,
+		0xff, 0x01, 0xe2, 0x01, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0xe7, 0xc3, 0x02, 0xb3, 0xb3, 0xb3, 0xff, 0xb2, 0xb2, 0xb2, 0xad, 0xb3, 0xb3,
+		0xb3, 0x0a, 0xc5, 0x01, 0xb3, 0xb3, 0xb3, 0x36, 0xb3, 0xb3, 0xb3, 0xd6, 0x87, 0xb3, 0xb3, 0xb3, 0xff, 0xd6, 0x00, 0xce, 0xce, 0xce, 0x78, 0x89,
+		0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xd9, 0xce, 0xce, 0xce, 0x2a, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0xb8, 0xc7,
+		0x00, 0xcf, 0xcf, 0xcf, 0x40, 0xd1, 0x80, 0xff, 0xff, 0xff, 0x01, 0xc1, 0x01, 0xcd, 0xcd, 0xcd, 0x38, 0xce, 0xce, 0xce, 0xc9, 0x8a, 0xce, 0xce,
+		0xce, 0xff, 0x00, 0xcf, 0xcf, 0xcf, 0x40, 0xc1, 0x01, 0xd8, 0xd8, 0xd8, 0x0d, 0xce, 0xce, 0xce, 0xe0, 0xc6, 0x01, 0xce, 0xce, 0xce, 0xf5, 0xd0,
+		0xd0, 0xd0, 0x1b, 0xd3, 0x00, 0xff, 0xff, 0xff, 0x02, 0xc4, 0x01, 0xd0, 0xd0, 0xd0, 0x26, 0xce, 0xce, 0xce, 0xfa, 0xc7, 0x01, 0xce, 0xce, 0xce,
+		0xdb, 0xbf, 0xbf, 0xbf, 0x08, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xcc, 0x0f, 0x00, 0x00, 0xc7, 0x72, 0x00, 0x00, 0xc7, 0xdb,
+		0xca, 0x01, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc7, 0x71, 0xd7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x7f, 0xc7, 0x04, 0x00, 0x00,
+		0xc7, 0xff, 0x00, 0x00, 0xc8, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0xc6, 0xb0, 0xd3, 0x8d, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xc7, 0xb1, 0xda, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xc8, 0x46, 0x00, 0x00, 0xc7, 0xb5, 0x00, 0x00, 0xc7, 0xfc,
+		0xc9, 0x01, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc7, 0xd5, 0xfe, 0x01, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0xc2, 0xc3, 0x03, 0xb3, 0xb3,
+		0xb3, 0xff, 0xb3, 0xb3, 0xb3, 0xbb, 0xb4, 0xb4, 0xb4, 0x29, 0xff, 0xff, 0xff, 0x01, 0xc4, 0x02, 0xbb, 0xbb, 0xbb, 0x0f, 0xb3, 0xb3, 0xb3, 0x7c,
+		0xb3, 0xb3, 0xb3, 0xf8, 0x83, 0xb3, 0xb3, 0xb3, 0xff, 0x01, 0xb3, 0xb3, 0xb3, 0xf6, 0xb3, 0xb3, 0xb3, 0x40, 0x86, 0x00, 0x00, 0x00, 0x00, 0x01,
+		0x80, 0x80, 0x80, 0x02, 0xb3, 0xb3, 0xb3, 0x36, 0x85, 0xb2, 0xb2, 0xb2, 0x3f, 0x01, 0xb3, 0xb3, 0xb3, 0x40, 0xb3, 0xb3, 0xb3, 0xd7, 0xc3, 0x01,
+		0xb2, 0xb2, 0xb2, 0x7b, 0xb1, 0xb1, 0xb1, 0x3b, 0x81, 0xb2, 0xb2, 0xb2, 0x3f, 0x00, 0xaf, 0xaf, 0xaf, 0x20, 0xc6, 0x00, 0xb2, 0xb2, 0xb2, 0x6e,
+		0xc4, 0x03, 0xb3, 0xb3, 0xb3, 0xff, 0xb3, 0xb3, 0xb3, 0xc9, 0xb3, 0xb3, 0xb3, 0x43, 0xbb, 0xbb, 0xbb, 0x0f, 0xc0, 0x03, 0xaa, 0xaa, 0xaa, 0x06,
+		0xb1, 0xb1, 0xb1, 0x31, 0xb4, 0xb4, 0xb4, 0x8b, 0xb3, 0xb3, 0xb3, 0xfe, 0x82, 0xb3, 0xb3, 0xb3, 0xff, 0x80, 0xb3, 0xb3, 0xb3, 0xf3, 0xd9, 0x00,
+		0xcd, 0xcd, 0xcd, 0x8a, 0x89, 0xce, 0xce, 0xce, 0xff, 0x01, 0xcd, 0xcd, 0xcd, 0xd3, 0xcc, 0xcc, 0xcc, 0x23, 0x91, 0x00, 0x00, 0x00, 0x00, 0x01,
+		0xcc, 0xcc, 0xcc, 0x0a, 0xce, 0xce, 0xce, 0xde, 0xc7, 0x00, 0xd0, 0xd0, 0xd0, 0x46, 0xc9, 0x01, 0xcc, 0xcc, 0xcc, 0x32, 0xce, 0xce, 0xce, 0xc5,
+		0x84, 0xce, 0xce, 0xce, 0xca, 0x01, 0xcf, 0xcf, 0xcf, 0xa3, 0xbf, 0xbf, 0xbf, 0x04, 0xc0, 0x01, 0xcd, 0xcd, 0xcd, 0x48, 0xce, 0xce, 0xce, 0xf7,
+		0x8a, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xf8, 0xcc, 0xcc, 0xcc, 0x23, 0xc1, 0x00, 0xcc, 0xcc, 0xcc, 0x32, 0x87, 0xce, 0xce, 0xce,
+		0xff, 0x01, 0xce, 0xce, 0xce, 0xf6, 0xca, 0xca, 0xca, 0x1d, 0xc9, 0x00, 0xcd, 0xcd, 0xcd, 0x5c, 0x86, 0xce, 0xce, 0xce, 0xca, 0x01, 0xce, 0xce,
+		0xce, 0xcb, 0xce, 0xce, 0xce, 0x86, 0xc4, 0x00, 0xcd, 0xcd, 0xcd, 0x48, 0x88, 0xce, 0xce, 0xce, 0xff, 0x00, 0xce, 0xce, 0xce, 0xa2, 0xb2, 0x00,
+		0x00, 0x00, 0x00, 0xfc, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xaa, 0x03, 0x00, 0x00, 0xc7, 0x6d, 0x00, 0x00, 0xc8, 0xef, 0xc9, 0x00,
+		0x00, 0x00, 0xc7, 0xeb, 0xd8, 0x01, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0xc7, 0xf2, 0xc7, 0x03, 0x00, 0x00, 0xc7, 0xc0, 0x00, 0x00, 0xff, 0x01,
+		0x00, 0x00, 0xaa, 0x03, 0x00, 0x00, 0xc8, 0xaa, 0xe2, 0x00, 0x00, 0x00, 0xc7, 0xb3, 0xdd, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xc7,
+		0x32, 0x00, 0x00, 0xc8, 0xc6, 0xc9, 0x01, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc7, 0x20, 0xfe, 0x01, 0xb9, 0xb9, 0xb9, 0x0b, 0xb3, 0xb3, 0xb3,
+		0xf1, 0xc3, 0x09, 0xb3, 0xb3, 0xb3, 0xff, 0xb3, 0xb3, 0xb3, 0xfc, 0xb2, 0xb2, 0xb2, 0xc8, 0xb3, 0xb3, 0xb3, 0x7f, 0xb4, 0xb4, 0xb4, 0x58, 0xb3,
+		0xb3, 0xb3, 0x46, 0xb3, 0xb3, 0xb3, 0x4a, 0xb4, 0xb4, 0xb4, 0x66, 0xb3, 0xb3, 0xb3, 0xa4, 0xb3, 0xb3, 0xb3, 0xef, 0x85, 0xb3, 0xb3, 0xb3, 0xff,
+		0x00, 0xb3, 0xb3, 0xb3, 0x65, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb2, 0xb2, 0xb2, 0x4f, 0xb3, 0xb3, 0xb3, 0xfb, 0x91, 0xb3, 0xb3, 0xb3, 0xff,
+		0x01, 0xb3, 0xb3, 0xb3, 0xd8, 0xbb, 0xbb, 0xbb, 0x0f, 0xc5, 0x01, 0xb3, 0xb3, 0xb3, 0x14, 0xb3, 0xb3, 0xb3, 0xdb, 0x86, 0xb3, 0xb3, 0xb3, 0xff,
+		0x03, 0xb3, 0xb3, 0xb3, 0xf4, 0xb3, 0xb3, 0xb3, 0xd3, 0xb3, 0xb3, 0xb3, 0xca, 0xb3, 0xb3, 0xb3, 0xe7, 0x85, 0xb3, 0xb3, 0xb3, 0xff, 0x01, 0xb2,
+		0xb2, 0xb2, 0x56, 0xb3, 0xb3, 0xb3, 0xbf, 0xd8, 0x00, 0xce, 0xce, 0xce, 0x92, 0x89, 0xce, 0xce, 0xce, 0xff, 0x01, 0xcd, 0xcd, 0xcd, 0xb4, 0xc8,
+		0xc8, 0xc8, 0x0e, 0x92, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcc, 0xcc, 0xcc, 0x28, 0xce, 0xce, 0xce, 0xf9, 0xc7, 0x00, 0xce, 0xce, 0xce, 0x97, 0xc8,
+		0x01, 0xd1, 0xd1, 0xd1, 0x2c, 0xcf, 0xcf, 0xcf, 0xdd, 0x85, 0xce, 0xce, 0xce, 0xff, 0x00, 0xcf, 0xcf, 0xcf, 0x84, 0x81, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xcd, 0xcd, 0xcd, 0x95, 0x8b, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xde, 0xcc, 0xcc, 0xcc, 0x0a, 0xc1, 0x00, 0xce, 0xce, 0xce,
+		0x5d, 0xc7, 0x01, 0xce, 0xce, 0xce, 0xff, 0xcd, 0xcd, 0xcd, 0x70, 0xc8, 0x01, 0xcd, 0xcd, 0xcd, 0x4c, 0xce, 0xce, 0xce, 0xf4, 0x87, 0xce, 0xce,
+		0xce, 0xff, 0x00, 0xcf, 0xcf, 0xcf, 0x64, 0xc4, 0x00, 0xce, 0xce, 0xce, 0x83, 0xc8, 0x00, 0xce, 0xce, 0xce, 0x62, 0xff, 0xb3, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0x00, 0xc3, 0x1e, 0x00, 0x00, 0xc7, 0xbf, 0xc8, 0x01, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc8, 0x17, 0xd7, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xc7, 0x5b, 0xc7, 0x03, 0x00, 0x00, 0xc7, 0xf8, 0x00, 0x00, 0xc5, 0x39, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xc7, 0xa7,
+		0xff, 0xc3, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x05, 0x00, 0x00, 0xc6, 0x70, 0xc9, 0x00, 0x00, 0x00, 0xc7, 0x72, 0xfe, 0x02, 0x00,
+		0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x36, 0xb3, 0xb3, 0xb3, 0xea, 0x91, 0xb3, 0xb3, 0xb3, 0xff, 0x01, 0xb3, 0xb3, 0xb3, 0xfa, 0xb4, 0xb4, 0xb4,
+		0x73, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xb4, 0xb4, 0x81, 0x93, 0xb3, 0xb3, 0xb3, 0xff, 0x00, 0xb3, 0xb3, 0xb3, 0x1b, 0xc5, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0xb4, 0xb4, 0xb4, 0x41, 0x8f, 0xb3, 0xb3, 0xb3, 0xff, 0x03, 0xb3, 0xb3, 0xb3, 0xf4, 0xb3, 0xb3, 0xb3, 0x5a, 0x00, 0x00, 0x00,
+		0x00, 0xb3, 0xb3, 0xb3, 0xc3, 0xd7, 0x00, 0xce, 0xce, 0xce, 0x88, 0x89, 0xce, 0xce, 0xce, 0xff, 0x02, 0xce, 0xce, 0xce, 0xfe, 0xcf, 0xcf, 0xcf,
+		0xa3, 0xce, 0xce, 0xce, 0x87, 0x8d, 0xcf, 0xcf, 0xcf, 0x8e, 0x01, 0xcd, 0xcd, 0xcd, 0x90, 0xce, 0xce, 0xce, 0x3f, 0xc1, 0x00, 0xcc, 0xcc, 0xcc,
+		0x32, 0x88, 0xce, 0xce, 0xce, 0xff, 0x03, 0xce, 0xce, 0xce, 0xf8, 0xce, 0xce, 0xce, 0x93, 0xd0, 0xd0, 0xd0, 0x26, 0xbf, 0xbf, 0xbf, 0x08, 0xc1,
+		0x04, 0xff, 0xff, 0xff, 0x02, 0xd5, 0xd5, 0xd5, 0x0c, 0xcf, 0xcf, 0xcf, 0x30, 0xce, 0xce, 0xce, 0x92, 0xce, 0xce, 0xce, 0xf0, 0x85, 0xce, 0xce,
+		0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xf1, 0xcf, 0xcf, 0xcf, 0x25, 0xc0, 0x01, 0xd5, 0xd5, 0xd5, 0x12, 0xce, 0xce, 0xce, 0xe3, 0xc1, 0x00, 0xce,
+		0xce, 0xce, 0xfd, 0xc7, 0x00, 0xce, 0xce, 0xce, 0xa7, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd, 0x6b, 0xc8, 0x03, 0xce, 0xce, 0xce,
+		0xf3, 0xcf, 0xcf, 0xcf, 0x7f, 0xcc, 0xcc, 0xcc, 0x1e, 0xdb, 0xdb, 0xdb, 0x07, 0xc1, 0x04, 0xbf, 0xbf, 0xbf, 0x04, 0xd5, 0xd5, 0xd5, 0x12, 0xd0,
+		0xd0, 0xd0, 0x41, 0xcf, 0xcf, 0xcf, 0xa9, 0xce, 0xce, 0xce, 0xfb, 0x87, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xdb, 0xcc, 0xcc, 0xcc,
+		0x0f, 0xc3, 0x01, 0xff, 0xff, 0xff, 0x01, 0xce, 0xce, 0xce, 0xc2, 0xc7, 0x01, 0xce, 0xce, 0xce, 0xfe, 0xce, 0xce, 0xce, 0x34, 0xff, 0xf3, 0x02,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x0f, 0x00, 0x00, 0xc6, 0xcb, 0xc8, 0x00, 0x00, 0x00, 0xc9, 0x3d, 0xd8, 0x01, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xc7, 0xd5, 0xc6, 0x03, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc8, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xa1, 0xff, 0x86,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x6b, 0xc8, 0x00, 0x00, 0x00, 0xc7, 0xa9, 0xc7, 0x00, 0xb3, 0xb3, 0xb3, 0xc2, 0xc3, 0x00, 0xb3,
+		0xb3, 0xb3, 0x54, 0xef, 0x02, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xb5, 0xb5, 0x2d, 0xb3, 0xb3, 0xb3, 0xe7, 0xcf, 0x01, 0xb3, 0xb3, 0xb3, 0xf9, 0xb4,
+		0xb4, 0xb4, 0x55, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x89, 0xd3, 0x00, 0xb6, 0xb6, 0xb6, 0x1c, 0xc6, 0x01, 0x00, 0x00, 0x00,
+		0x00, 0xb2, 0xb2, 0xb2, 0x60, 0xcd, 0x01, 0xb3, 0xb3, 0xb3, 0xeb, 0xb1, 0xb1, 0xb1, 0x3b, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xb4, 0xb4,
+		0xc4, 0xc2, 0x00, 0xb3, 0xb3, 0xb3, 0xf5, 0xd1, 0x01, 0xbf, 0xbf, 0xbf, 0x08, 0xce, 0xce, 0xce, 0xe1, 0x9c, 0xce, 0xce, 0xce, 0xff, 0x00, 0xcd,
+		0xcd, 0xcd, 0x4d, 0xc1, 0x01, 0xce, 0xce, 0xce, 0x1f, 0xce, 0xce, 0xce, 0xf4, 0x89, 0xce, 0xce, 0xce, 0xff, 0x07, 0xce, 0xce, 0xce, 0xf7, 0xce,
+		0xce, 0xce, 0xdc, 0xce, 0xce, 0xce, 0xcd, 0xce, 0xce, 0xce, 0xca, 0xce, 0xce, 0xce, 0xcb, 0xce, 0xce, 0xce, 0xd0, 0xce, 0xce, 0xce, 0xe2, 0xce,
+		0xce, 0xce, 0xfb, 0x87, 0xce, 0xce, 0xce, 0xff, 0x00, 0xcd, 0xcd, 0xcd, 0x7b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd, 0x61, 0x81,
+		0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xb2, 0xce, 0xce, 0xce, 0xcb, 0xc7, 0x00, 0xcd, 0xcd, 0xcd, 0x66, 0xc2, 0x00, 0xce, 0xce, 0xce,
+		0x4e, 0x8a, 0xce, 0xce, 0xce, 0xff, 0x06, 0xcd, 0xcd, 0xcd, 0xf2, 0xce, 0xce, 0xce, 0xd9, 0xce, 0xce, 0xce, 0xcc, 0xce, 0xce, 0xce, 0xcb, 0xce,
+		0xce, 0xce, 0xcc, 0xce, 0xce, 0xce, 0xd5, 0xce, 0xce, 0xce, 0xe8, 0x8a, 0xce, 0xce, 0xce, 0xff, 0x00, 0xce, 0xce, 0xce, 0x63, 0x84, 0x00, 0x00,
+		0x00, 0x00, 0x01, 0xcc, 0xcc, 0xcc, 0x1e, 0xce, 0xce, 0xce, 0xf5, 0xc7, 0x01, 0xce, 0xce, 0xce, 0xf1, 0xcc, 0xcc, 0xcc, 0x19, 0xff, 0xf4, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x1f, 0xc8, 0x00, 0x00, 0x00, 0xc7, 0x56, 0xd9, 0x01, 0x00, 0x00, 0xc7, 0x56, 0x00, 0x00, 0xc7, 0xfb,
+		0xc6, 0x02, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xcc, 0x14, 0x00, 0x00, 0xc7, 0x97, 0xff, 0xc6, 0x01, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xc6,
+		0xbd, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0xcd, 0xc7, 0x00, 0xb2, 0xb2, 0xb2, 0xc1, 0xf6, 0x03, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xb4, 0xb4, 0x11, 0xb4,
+		0xb4, 0xb4, 0x8b, 0xb3, 0xb3, 0xb3, 0xfa, 0xcb, 0x02, 0xb3, 0xb3, 0xb3, 0xfd, 0xb3, 0xb3, 0xb3, 0x9e, 0xb5, 0xb5, 0xb5, 0x1f, 0x8a, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xb4, 0xb4, 0xb4, 0x73, 0xd2, 0x01, 0xb3, 0xb3, 0xb3, 0xf6, 0xb1, 0xb1, 0xb1, 0x17, 0xc7, 0x02, 0xff, 0xff, 0xff, 0x01, 0xb4,
+		0xb4, 0xb4, 0x3d, 0xb3, 0xb3, 0xb3, 0xe1, 0xc9, 0x02, 0xb3, 0xb3, 0xb3, 0xfb, 0xb3, 0xb3, 0xb3, 0x9a, 0xae, 0xae, 0xae, 0x13, 0x81, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0xc3, 0xd6, 0x01, 0xcc, 0xcc, 0xcc, 0x23, 0xce, 0xce, 0xce, 0xf8, 0xdb, 0x01, 0xce, 0xce, 0xce, 0xfb, 0xcc,
+		0xcc, 0xcc, 0x28, 0xc1, 0x01, 0xff, 0xff, 0xff, 0x02, 0xce, 0xce, 0xce, 0xc4, 0x99, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xd9, 0xd1,
+		0xd1, 0xd1, 0x16, 0xc0, 0x01, 0xcc, 0xcc, 0xcc, 0x14, 0xce, 0xce, 0xce, 0xd7, 0xc0, 0x02, 0xce, 0xce, 0xce, 0xe0, 0xce, 0xce, 0xce, 0x3e, 0xce,
+		0xce, 0xce, 0xe7, 0xc7, 0x00, 0xcd, 0xcd, 0xcd, 0x38, 0xc2, 0x01, 0xce, 0xce, 0xce, 0x15, 0xce, 0xce, 0xce, 0xeb, 0x9b, 0xce, 0xce, 0xce, 0xff,
+		0x01, 0xce, 0xce, 0xce, 0xc1, 0xd5, 0xd5, 0xd5, 0x0c, 0xc4, 0x00, 0xcd, 0xcd, 0xcd, 0x47, 0x88, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce,
+		0xcd, 0xaa, 0xaa, 0xaa, 0x03, 0xff, 0xf5, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xd5, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0x5b, 0xd9, 0x01,
+		0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xc7, 0xd0, 0xc7, 0x01, 0x00, 0x00, 0xc7, 0x9e, 0x00, 0x00, 0xc7, 0x84, 0xff, 0xc6, 0x01, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xc6, 0x62, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0xd5, 0xc7, 0x06, 0xb4, 0xb4, 0xb4, 0x62, 0xb3, 0xb3, 0xb3, 0xd2, 0xb3, 0xb3, 0xb3,
+		0xea, 0xb3, 0xb3, 0xb3, 0xec, 0xb3, 0xb3, 0xb3, 0xe3, 0xb3, 0xb3, 0xb3, 0xc5, 0xb6, 0xb6, 0xb6, 0x23, 0xf1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03,
+		0xb4, 0xb4, 0xb4, 0x29, 0xb3, 0xb3, 0xb3, 0x90, 0xb3, 0xb3, 0xb3, 0xcd, 0xb3, 0xb3, 0xb3, 0xfe, 0xc6, 0x02, 0xb3, 0xb3, 0xb3, 0xcc, 0xb3, 0xb3,
+		0xb3, 0x91, 0xb1, 0xb1, 0xb1, 0x31, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb4, 0xb4, 0xb4, 0x29, 0xb2, 0xb2, 0xb2, 0xb7, 0x86, 0xb3, 0xb3, 0xb3,
+		0xc2, 0x00, 0xb3, 0xb3, 0xb3, 0xf2, 0xc3, 0x01, 0xb4, 0xb4, 0xb4, 0xd5, 0xb2, 0xb2, 0xb2, 0xc1, 0x81, 0xb3, 0xb3, 0xb3, 0xc2, 0x01, 0xb3, 0xb3,
+		0xb3, 0x8c, 0xaa, 0xaa, 0xaa, 0x06, 0x89, 0x00, 0x00, 0x00, 0x00, 0x02, 0xaa, 0xaa, 0xaa, 0x0c, 0xb2, 0xb2, 0xb2, 0x7e, 0xb2, 0xb2, 0xb2, 0xcb,
+		0xc5, 0x02, 0xb3, 0xb3, 0xb3, 0xe6, 0xb3, 0xb3, 0xb3, 0xa1, 0xb5, 0xb5, 0xb5, 0x37, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb4, 0xb4, 0xb4, 0x69,
+		0xb2, 0xb2, 0xb2, 0xdc, 0x80, 0xb3, 0xb3, 0xb3, 0xeb, 0x01, 0xb3, 0xb3, 0xb3, 0xe1, 0xb2, 0xb2, 0xb2, 0x8f, 0xca, 0x01, 0xb4, 0xb4, 0xb4, 0x9f,
+		0xb2, 0xb2, 0xb2, 0xdc, 0x80, 0xb3, 0xb3, 0xb3, 0xec, 0x03, 0xb3, 0xb3, 0xb3, 0xdb, 0xb4, 0xb4, 0xb4, 0x9f, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xd0,
+		0xd0, 0x41, 0x9c, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xe5, 0xc8, 0xc8, 0xc8, 0x0e, 0xc1, 0x01, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xcf,
+		0xcf, 0x7a, 0xd8, 0x01, 0xce, 0xce, 0xce, 0xfd, 0xcf, 0xcf, 0xcf, 0x4b, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd, 0x80, 0x80, 0xce,
+		0xce, 0xce, 0xff, 0x02, 0xce, 0xce, 0xce, 0xf8, 0xce, 0xce, 0xce, 0x3f, 0xcd, 0xcd, 0xcd, 0x38, 0x87, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce,
+		0xce, 0xf3, 0xd0, 0xd0, 0xd0, 0x1b, 0xc2, 0x01, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0xa2, 0xda, 0x01, 0xce, 0xce, 0xce, 0xea, 0xcc, 0xcc,
+		0xcc, 0x28, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0x68, 0xc8, 0x00, 0xcd, 0xcd, 0xcd, 0x8b, 0xb3, 0x00, 0x00, 0x00, 0x00, 0xff,
+		0xc2, 0x00, 0x00, 0x00, 0xc6, 0xa2, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0x57, 0xd9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x36, 0xc7, 0x01,
+		0x00, 0x00, 0xc7, 0xeb, 0x00, 0x00, 0xc8, 0x9d, 0xff, 0xc7, 0x00, 0x00, 0x00, 0xc6, 0x36, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0xd0, 0x89, 0x00, 0x00,
+		0x00, 0x00, 0x02, 0xb6, 0xb6, 0xb6, 0x07, 0xaa, 0xaa, 0xaa, 0x09, 0xaa, 0xaa, 0xaa, 0x03, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x81, 0x00, 0x00,
+		0x00, 0x00, 0x08, 0xb1, 0xb1, 0xb1, 0x24, 0xb3, 0xb3, 0xb3, 0x50, 0xb4, 0xb4, 0xb4, 0x70, 0xb3, 0xb3, 0xb3, 0x82, 0xb3, 0xb3, 0xb3, 0x87, 0xb3,
+		0xb3, 0xb3, 0x83, 0xb3, 0xb3, 0xb3, 0x72, 0xb2, 0xb2, 0xb2, 0x4f, 0xb6, 0xb6, 0xb6, 0x23, 0x98, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x80, 0x80,
+		0x02, 0xb3, 0xb3, 0xb3, 0xca, 0xc3, 0x00, 0xb3, 0xb3, 0xb3, 0x50, 0x92, 0x00, 0x00, 0x00, 0x00, 0x07, 0xb0, 0xb0, 0xb0, 0x2a, 0xb2, 0xb2, 0xb2,
+		0x59, 0xb3, 0xb3, 0xb3, 0x79, 0xb3, 0xb3, 0xb3, 0x87, 0xb2, 0xb2, 0xb2, 0x85, 0xb4, 0xb4, 0xb4, 0x70, 0xb3, 0xb3, 0xb3, 0x43, 0xaa, 0xaa, 0xaa,
+		0x09, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x80, 0xbf, 0xbf, 0xbf, 0x08, 0x00, 0x80, 0x80, 0x80, 0x02, 0x8d, 0x00, 0x00,
+		0x00, 0x00, 0x80, 0xbf, 0xbf, 0xbf, 0x08, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd, 0x76, 0xdc, 0x00, 0xce, 0xce, 0xce, 0xb2, 0x83,
+		0x00, 0x00, 0x00, 0x00, 0x01, 0xd5, 0xd5, 0xd5, 0x12, 0xce, 0xce, 0xce, 0xdb, 0xd7, 0x00, 0xcf, 0xcf, 0xcf, 0x75, 0x81, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0xcd, 0xcd, 0xcd, 0x38, 0xcd, 0xcd, 0xcd, 0xf2, 0xc0, 0x02, 0xcf, 0xcf, 0xcf, 0x64, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0x69, 0xc7,
+		0x01, 0xce, 0xce, 0xce, 0xcf, 0xaa, 0xaa, 0xaa, 0x03, 0xc3, 0x01, 0xce, 0xce, 0xce, 0x2f, 0xcd, 0xcd, 0xcd, 0xf2, 0xd8, 0x01, 0xce, 0xce, 0xce,
+		0xef, 0xcd, 0xcd, 0xcd, 0x42, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0x96, 0xc8, 0x00, 0xce, 0xce, 0xce, 0x4e, 0xff, 0xf7, 0x00,
+		0x00, 0x00, 0xc7, 0xbe, 0xc7, 0x00, 0x00, 0x00, 0xc6, 0x3f, 0xda, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xb7, 0xc6, 0x01, 0x00, 0x00,
+		0xc7, 0xfb, 0x00, 0x00, 0xc7, 0xe0, 0xff, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0x4d, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0xad, 0x99, 0x00, 0x00, 0x00, 0x00,
+		0xeb, 0xa1, 0x00, 0x00, 0x00, 0x00, 0xda, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0xbc, 0xdc, 0x00, 0xce, 0xce, 0xce, 0x72, 0xc3,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd, 0x47, 0xce, 0xce, 0xce, 0xf4, 0xd5, 0x01, 0xce, 0xce, 0xce, 0x86, 0xff, 0xff, 0xff, 0x02, 0xc0,
+		0x04, 0xcd, 0xcd, 0xcd, 0x24, 0xce, 0xce, 0xce, 0xd5, 0xce, 0xce, 0xce, 0xff, 0xce, 0xce, 0xce, 0xf5, 0xcf, 0xcf, 0xcf, 0x60, 0x80, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0x98, 0xc7, 0x00, 0xcf, 0xcf, 0xcf, 0x94, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd, 0x6c, 0xd7,
+		0x01, 0xcd, 0xcd, 0xcd, 0xd8, 0xcd, 0xcd, 0xcd, 0x3d, 0x86, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbf, 0xbf, 0xbf, 0x04, 0xce, 0xce, 0xce, 0xcf, 0xc7,
+		0x01, 0xce, 0xce, 0xce, 0xfc, 0xd0, 0xd0, 0xd0, 0x2b, 0xff, 0xe5, 0x03, 0x00, 0x00, 0xb6, 0x07, 0x00, 0x00, 0xc8, 0x6a, 0x00, 0x00, 0xc8, 0x45,
+		0x00, 0x00, 0xbf, 0x04, 0xcc, 0x88, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0x00, 0xc4, 0x1a, 0xdb, 0x01, 0x00, 0x00, 0xc9, 0x34, 0x00, 0x00, 0xc7,
+		0xf7, 0x8f, 0x00, 0x00, 0xc7, 0xff, 0xef, 0x02, 0x00, 0x00, 0xc6, 0x2d, 0x00, 0x00, 0xc7, 0x6e, 0x00, 0x00, 0xc4, 0x1a, 0xcc, 0x00, 0x00, 0x00,
+		0xc7, 0x9c, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0x76, 0xff, 0xff, 0xeb, 0x00, 0xce, 0xce, 0xce, 0xe7, 0xdc, 0x00, 0xcd, 0xcd, 0xcd, 0x3d, 0xc4, 0x02,
+		0x00, 0x00, 0x00, 0x00, 0xcd, 0xcd, 0xcd, 0x4c, 0xce, 0xce, 0xce, 0xe6, 0xd2, 0x01, 0xce, 0xce, 0xce, 0xe7, 0xce, 0xce, 0xce, 0x63, 0x81, 0x00,
+		0x00, 0x00, 0x00, 0x04, 0xce, 0xce, 0xce, 0x3f, 0xce, 0xce, 0xce, 0xe1, 0xce, 0xce, 0xce, 0xff, 0xce, 0xce, 0xce, 0xdb, 0xce, 0xce, 0xce, 0x44,
+		0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd5, 0xd5, 0xd5, 0x06, 0xcd, 0xcd, 0xcd, 0xd3, 0xc7, 0x00, 0xce, 0xce, 0xce, 0x53, 0xc5, 0x02, 0x00, 0x00,
+		0x00, 0x00, 0xce, 0xce, 0xce, 0x6e, 0xce, 0xce, 0xce, 0xf9, 0xd3, 0x02, 0xce, 0xce, 0xce, 0xfc, 0xce, 0xce, 0xce, 0x97, 0xca, 0xca, 0xca, 0x1d,
+		0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd0, 0xd0, 0xd0, 0x26, 0xce, 0xce, 0xce, 0xf9, 0xc7, 0x01, 0xce, 0xce, 0xce, 0xe8, 0xcf, 0xcf, 0xcf, 0x10,
+		0xff, 0xe5, 0x04, 0x00, 0x00, 0xc6, 0x4c, 0x00, 0x00, 0xc7, 0xfa, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc8, 0xc6, 0x00, 0x00, 0xc7, 0x3b, 0xca,
+		0x00, 0x00, 0x00, 0xc8, 0x8a, 0xc7, 0x00, 0x00, 0x00, 0xc8, 0xef, 0x87, 0x00, 0x00, 0x00, 0x00, 0xd3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xc7, 0xac, 0xeb, 0x00, 0x00, 0x00, 0xc7, 0xb1, 0xd2, 0x04, 0x00, 0x00, 0xc7, 0xb6, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0xc7, 0xf3, 0x00, 0x00,
+		0xc7, 0x88, 0x00, 0x00, 0xcc, 0x0a, 0xc9, 0x01, 0x00, 0x00, 0xca, 0x2b, 0x00, 0x00, 0xc7, 0xec, 0xc7, 0x00, 0x00, 0x00, 0xc5, 0x23, 0xff, 0xff,
+		0xeb, 0x00, 0xce, 0xce, 0xce, 0xfb, 0xdc, 0x00, 0xce, 0xce, 0xce, 0x1f, 0xc5, 0x03, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xd0, 0xd0, 0x26, 0xce, 0xce,
+		0xce, 0x93, 0xcd, 0xcd, 0xcd, 0xf2, 0xcf, 0x01, 0xce, 0xce, 0xce, 0xb0, 0xcd, 0xcd, 0xcd, 0x24, 0x80, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff,
+		0xff, 0x02, 0xce, 0xce, 0xce, 0x7c, 0xce, 0xce, 0xce, 0xff, 0xce, 0xce, 0xce, 0xfb, 0xcd, 0xcd, 0xcd, 0x8a, 0xca, 0xca, 0xca, 0x1d, 0x81, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0x32, 0x88, 0xce, 0xce, 0xce, 0xff, 0x00, 0xcc, 0xcc, 0xcc, 0x2d, 0xc6, 0x02, 0x00, 0x00, 0x00, 0x00,
+		0xcf, 0xcf, 0xcf, 0x3b, 0xce, 0xce, 0xce, 0xaa, 0xd0, 0x02, 0xce, 0xce, 0xce, 0xeb, 0xce, 0xce, 0xce, 0x91, 0xcd, 0xcd, 0xcd, 0x38, 0x89, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xcf, 0xcf, 0xcf, 0x50, 0x88, 0xce, 0xce, 0xce, 0xff, 0x01, 0xce, 0xce, 0xce, 0xbb, 0xff, 0xff, 0xff, 0x01, 0xff, 0xe5,
+		0x00, 0x00, 0x00, 0xc8, 0x6a, 0x81, 0x00, 0x00, 0xc7, 0xff, 0x03, 0x00, 0x00, 0xc7, 0xfc, 0x00, 0x00, 0xc6, 0xb4, 0x00, 0x00, 0xc7, 0x5b, 0x00,
+		0x00, 0xc9, 0x13, 0xc5, 0x02, 0x00, 0x00, 0xb6, 0x07, 0x00, 0x00, 0xc7, 0x80, 0x00, 0x00, 0xc7, 0xf9, 0xc7, 0x00, 0x00, 0x00, 0xc7, 0x85, 0xdd,
+		0x00, 0x00, 0x00, 0xc5, 0x1f, 0xd9, 0x01, 0x00, 0x00, 0xc9, 0x13, 0x00, 0x00, 0xc5, 0x30, 0x8e, 0x00, 0x00, 0xc9, 0x2f, 0x00, 0x00, 0x00, 0xc8,
+		0xc1, 0xd2, 0x00, 0x00, 0x00, 0xc7, 0xe0, 0x81, 0x00, 0x00, 0xc7, 0xff, 0x02, 0x00, 0x00, 0xc7, 0xe1, 0x00, 0x00, 0xc6, 0x79, 0x00, 0x00, 0xc6,
+		0x31, 0xc6, 0x01, 0x00, 0x00, 0xc7, 0x3b, 0x00, 0x00, 0xc7, 0xdb, 0x87, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0x00, 0xc7, 0xe2, 0x9a, 0x00, 0x00,
+		0x00, 0x00, 0xff, 0xff, 0xd0, 0x00, 0xce, 0xce, 0xce, 0x9b, 0x9a, 0xce, 0xce, 0xce, 0xa7, 0x02, 0xce, 0xce, 0xce, 0xa8, 0xce, 0xce, 0xce, 0x92,
+		0xdb, 0xdb, 0xdb, 0x07, 0x88, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd1, 0xd1, 0xd1, 0x27, 0xcf, 0xcf, 0xcf, 0x64, 0xce, 0xce, 0xce, 0xa0, 0xce, 0xce,
+		0xce, 0xdb, 0xce, 0xce, 0xce, 0xfa, 0xc7, 0x0b, 0xce, 0xce, 0xce, 0xec, 0xce, 0xce, 0xce, 0xc9, 0xce, 0xce, 0xce, 0x8c, 0xcd, 0xcd, 0xcd, 0x51,
+		0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0xce, 0xce, 0xce, 0x4e, 0xce, 0xce, 0xce, 0xc1, 0xce, 0xce, 0xce, 0xe1,
+		0xce, 0xce, 0xce, 0x87, 0xcd, 0xcd, 0xcd, 0x2e, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0xcd, 0xcd, 0xcd, 0x38, 0xce, 0xce, 0xce, 0xab, 0x85, 0xce,
+		0xce, 0xce, 0xa8, 0x02, 0xcf, 0xcf, 0xcf, 0xa9, 0xce, 0xce, 0xce, 0xa0, 0xd5, 0xd5, 0xd5, 0x12, 0x89, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcf, 0xcf,
+		0xcf, 0x3a, 0xce, 0xce, 0xce, 0x72, 0xce, 0xce, 0xce, 0xb1, 0xce, 0xce, 0xce, 0xe6, 0xce, 0xce, 0xce, 0xfe, 0xc6, 0x05, 0xce, 0xce, 0xce, 0xfe,
+		0xce, 0xce, 0xce, 0xea, 0xce, 0xce, 0xce, 0xbf, 0xce, 0xce, 0xce, 0x86, 0xcd, 0xcd, 0xcd, 0x57, 0xd0, 0xd0, 0xd0, 0x1b, 0x8b, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0xcf, 0xcf, 0xcf, 0x75, 0xc8, 0x00, 0xcd, 0xcd, 0xcd, 0x7b, 0xb4, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x00, 0x00, 0x00, 0xc8, 0x78, 0x84,
+		0x00, 0x00, 0xc7, 0xff, 0x03, 0x00, 0x00, 0xc7, 0xf1, 0x00, 0x00, 0xc8, 0xaf, 0x00, 0x00, 0xc7, 0x71, 0x00, 0x00, 0xc7, 0x4e, 0x80, 0x00, 0x00,
+		0xc5, 0x3e, 0x02, 0x00, 0x00, 0xc8, 0x54, 0x00, 0x00, 0xc8, 0x8a, 0x00, 0x00, 0xc7, 0xe0, 0x89, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0x00, 0xc4,
+		0x0d, 0xdd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x93, 0xd7, 0x01, 0x00, 0x00, 0xd1, 0x0b, 0x00, 0x00, 0xc7, 0xca, 0x98, 0x00, 0x00,
+		0xc7, 0xff, 0xca, 0x00, 0x00, 0x00, 0xc7, 0xee, 0x83, 0x00, 0x00, 0xc7, 0xff, 0x09, 0x00, 0x00, 0xc7, 0xfe, 0x00, 0x00, 0xc7, 0xca, 0x00, 0x00,
+		0xc7, 0x89, 0x00, 0x00, 0xc6, 0x5a, 0x00, 0x00, 0xc6, 0x43, 0x00, 0x00, 0xc9, 0x3d, 0x00, 0x00, 0xc8, 0x46, 0x00, 0x00, 0xc8, 0x6f, 0x00, 0x00,
+		0xc6, 0xbd, 0x00, 0x00, 0xc7, 0xfc, 0x88, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0x00, 0xc8, 0x7d, 0xff, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x98,
+		0x00, 0x00, 0x00, 0x00, 0x0b, 0xc6, 0xc6, 0xc6, 0x09, 0xce, 0xce, 0xce, 0x2a, 0xcd, 0xcd, 0xcd, 0x48, 0xcd, 0xcd, 0xcd, 0x66, 0xcd, 0xcd, 0xcd,
+		0x6b, 0xce, 0xce, 0xce, 0x77, 0xce, 0xce, 0xce, 0x7c, 0xcd, 0xcd, 0xcd, 0x6b, 0xce, 0xce, 0xce, 0x68, 0xce, 0xce, 0xce, 0x54, 0xcc, 0xcc, 0xcc,
+		0x32, 0xcc, 0xcc, 0xcc, 0x19, 0x83, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc8, 0xc8, 0xc8, 0x0e, 0xcd, 0xcd, 0xcd, 0x61, 0xce, 0xce, 0xce, 0x49, 0xd5,
+		0xd5, 0xd5, 0x0c, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xd5, 0xd5, 0xd5, 0x12, 0xd0, 0xd0, 0xd0, 0x31, 0xcd, 0xcd, 0xcd, 0x56, 0xce, 0xce, 0xce,
+		0x69, 0xcd, 0xcd, 0xcd, 0x70, 0xce, 0xce, 0xce, 0x82, 0xcf, 0xcf, 0xcf, 0x7f, 0xce, 0xce, 0xce, 0x6d, 0xce, 0xce, 0xce, 0x68, 0xcd, 0xcd, 0xcd,
+		0x52, 0xcf, 0xcf, 0xcf, 0x30, 0xce, 0xce, 0xce, 0x15, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xce, 0xce, 0xa5, 0xc8, 0x00, 0xce, 0xce, 0xce,
+		0x44, 0xff, 0xe6, 0x00, 0x00, 0x00, 0xc7, 0x7a, 0x97, 0x00, 0x00, 0xc7, 0xff, 0x00, 0x00, 0x00, 0xc7, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, 0xd5,
+		0x01, 0x00, 0x00, 0xc5, 0x16, 0x00, 0x00, 0xc7, 0xea, 0xd6, 0x01, 0x00, 0x00, 0xc9, 0x2f, 0x00, 0x00, 0xc7, 0xf7, 0xe4, 0x00, 0x00, 0x00, 0xc7,
+		0xf0, 0x96, 0x00, 0x00, 0xc7, 0xff, 0x01, 0x00, 0x00, 0xc7, 0xe9, 0x00, 0x00, 0xc2, 0x15, 0xc8, 0x06, 0xae, 0xae, 0xae, 0x13, 0xb3, 0xb3, 0xb3,
+		0x6f, 0xb3, 0xb3, 0xb3, 0x9e, 0xb3, 0xb3, 0xb3, 0xa7, 0xb3, 0xb3, 0xb3, 0x96, 0xb3, 0xb3, 0xb3, 0x5b, 0xaa, 0xaa, 0xaa, 0x06, 0xff, 0xff, 0xd4,
+		0x05, 0xb1, 0xb1, 0xb1, 0x31, 0xb4, 0xb4, 0xb4, 0x84, 0xb3, 0xb3, 0xb3, 0xa4, 0xb3, 0xb3, 0xb3, 0xa5, 0xb3, 0xb3, 0xb3, 0x87, 0xb5, 0xb5, 0xb5,
+		0x37, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd5, 0xd5, 0xd5, 0x0c, 0xce, 0xce, 0xce, 0xe0, 0xc7, 0x01, 0xce, 0xce,
+		0xce, 0xfa, 0xcf, 0xcf, 0xcf, 0x25, 0xff, 0xe6, 0x00, 0x00, 0x00, 0xc8, 0x78, 0xd6, 0x01, 0x00, 0x00, 0xc7, 0xde, 0x00, 0x00, 0xc9, 0x13, 0xdf,
+		0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x89, 0xd6, 0x00, 0x00, 0x00, 0xc9, 0x3d, 0x99, 0x00, 0x00, 0xc7, 0xff, 0xca, 0x00, 0x00, 0x00,
+		0xc7, 0xee, 0xd6, 0x00, 0x00, 0x00, 0xc7, 0x56, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0xda, 0x83, 0xb3, 0xb3, 0xb3, 0xff, 0x00,
+		0xb3, 0xb3, 0xb3, 0x96, 0xff, 0xd8, 0x01, 0xff, 0xff, 0xff, 0x01, 0xb3, 0xb3, 0xb3, 0xc9, 0xc3, 0x00, 0xb3, 0xb3, 0xb3, 0x4d, 0xf2, 0x00, 0xb4,
+		0xb4, 0xb4, 0x2c, 0x84, 0xb3, 0xb3, 0xb3, 0xff, 0x00, 0xb2, 0xb2, 0xb2, 0x38, 0xff, 0xfc, 0x00, 0xcc, 0xcc, 0xcc, 0x37, 0x88, 0xce, 0xce, 0xce,
+		0xff, 0x01, 0xce, 0xce, 0xce, 0xdf, 0xd1, 0xd1, 0xd1, 0x0b, 0xff, 0xe6, 0x00, 0x00, 0x00, 0xc8, 0x6a, 0xd5, 0x01, 0x00, 0x00, 0xc7, 0xfa, 0x00,
+		0x00, 0xc7, 0x20, 0x89, 0x00, 0x00, 0x00, 0x00, 0xd6, 0x01, 0x00, 0x00, 0xc4, 0x0d, 0x00, 0x00, 0xc7, 0xf8, 0xd5, 0x00, 0x00, 0x00, 0xc9, 0x42,
+		0xe5, 0x00, 0x00, 0x00, 0xc7, 0xe0, 0xd5, 0x00, 0x00, 0x00, 0xc7, 0x80, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xb4, 0xb4, 0x44, 0x85, 0xb3,
+		0xb3, 0xb3, 0xff, 0xff, 0xd8, 0x07, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x5a, 0xb3, 0xb3, 0xb3, 0xd3, 0xb3, 0xb3, 0xb3, 0xe5, 0xb3, 0xb3,
+		0xb3, 0xe8, 0xb3, 0xb3, 0xb3, 0xdd, 0xb3, 0xb3, 0xb3, 0xb1, 0xbf, 0xbf, 0xbf, 0x08, 0xf2, 0x00, 0xb3, 0xb3, 0xb3, 0xb2, 0xc4, 0x00, 0xb3, 0xb3,
+		0xb3, 0xbe, 0xff, 0xfc, 0x00, 0xcd, 0xcd, 0xcd, 0x57, 0xc8, 0x00, 0xce, 0xce, 0xce, 0x9d, 0xb5, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x01, 0x00, 0x00,
+		0xc7, 0x44, 0x00, 0x00, 0xc7, 0xf8, 0xd3, 0x01, 0x00, 0x00, 0xc7, 0xe2, 0x00, 0x00, 0xc6, 0x36, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xc7, 0x6e, 0xc6, 0x00, 0x00, 0x00, 0xc7, 0x5f, 0xcc, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x5f, 0xcc, 0x00, 0x00, 0x00, 0xc5, 0x1f,
+		0xc6, 0x00, 0x00, 0x00, 0xc8, 0x41, 0xd9, 0x01, 0x00, 0x00, 0xc6, 0xe6, 0x00, 0x00, 0xc5, 0x1f, 0xc8, 0x00, 0x00, 0x00, 0xc8, 0xaa, 0xd4, 0x01,
+		0x00, 0x00, 0xc7, 0x7c, 0x00, 0x00, 0xcc, 0x05, 0xc9, 0x00, 0xb3, 0xb3, 0xb3, 0x76, 0xc5, 0x00, 0xb2, 0xb2, 0xb2, 0x21, 0xff, 0x9a, 0x00, 0x00,
+		0x00, 0x00, 0x02, 0xaa, 0xaa, 0xaa, 0x03, 0xaa, 0xaa, 0xaa, 0x06, 0xff, 0xff, 0xff, 0x01, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3,
+		0xe6, 0xc4, 0x00, 0xb3, 0xb3, 0xb3, 0xf1, 0xff, 0xec, 0x01, 0xcd, 0xcd, 0xcd, 0x24, 0xce, 0xce, 0xce, 0x58, 0x8b, 0xcd, 0xcd, 0xcd, 0x57, 0x01,
+		0xcd, 0xcd, 0xcd, 0x56, 0xce, 0xce, 0xce, 0xa7, 0xc8, 0x01, 0xcd, 0xcd, 0xcd, 0x9f, 0xcd, 0xcd, 0xcd, 0x56, 0x8c, 0xcd, 0xcd, 0xcd, 0x57, 0x00,
+		0xce, 0xce, 0xce, 0x49, 0xff, 0xd7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x93, 0xd2, 0x01, 0x00, 0x00, 0xc7, 0xc0, 0x00, 0x00, 0xc8,
+		0x17, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0xc8, 0x61, 0xcd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xad, 0xca, 0x00,
+		0x00, 0x00, 0xc7, 0xf1, 0x87, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xc6, 0x36, 0x00, 0x00, 0xc7, 0xfe, 0xd8, 0x01, 0x00, 0x00, 0xc7, 0xd9,
+		0x00, 0x00, 0xc6, 0x12, 0xc8, 0x01, 0x00, 0x00, 0xca, 0x2b, 0x00, 0x00, 0xc7, 0xe1, 0xd1, 0x01, 0x00, 0x00, 0xc7, 0xec, 0x00, 0x00, 0xc6, 0x59,
+		0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xb4, 0xb4, 0x7a, 0xc5, 0x00, 0xb6, 0xb6, 0xb6, 0x23, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x00,
+		0xb3, 0xb3, 0xb3, 0xea, 0xc4, 0x00, 0xb3, 0xb3, 0xb3, 0xf4, 0xff, 0xec, 0x00, 0xce, 0xce, 0xce, 0x9c, 0xa8, 0xce, 0xce, 0xce, 0xff, 0x00, 0xcd,
+		0xcd, 0xcd, 0xbe, 0xff, 0xd8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x39, 0x00, 0x00, 0xc7, 0xa4, 0x00, 0x00, 0xc7, 0xfb, 0xcd, 0x02,
+		0x00, 0x00, 0xc6, 0xc2, 0x00, 0x00, 0xc6, 0x48, 0x00, 0x00, 0xaa, 0x03, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x4d, 0xc6, 0x00,
+		0x00, 0x00, 0xc6, 0x2d, 0xce, 0x01, 0x00, 0x00, 0xc4, 0x0d, 0x00, 0x00, 0xc6, 0xa2, 0xc8, 0x01, 0x00, 0x00, 0xc7, 0xf5, 0x00, 0x00, 0xc7, 0x3b,
+		0xc7, 0x01, 0x00, 0x00, 0xca, 0x1d, 0x00, 0x00, 0xc7, 0xe4, 0xd8, 0x00, 0x00, 0x00, 0xc6, 0x70, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+		0xd1, 0x0b, 0x00, 0x00, 0xc7, 0x6d, 0x00, 0x00, 0xc7, 0xd7, 0xcd, 0x02, 0x00, 0x00, 0xc7, 0xea, 0x00, 0x00, 0xc8, 0x7d, 0x00, 0x00, 0xc6, 0x12,
+		0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x50, 0xc5, 0x89, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc8, 0x00, 0xb3, 0xb3, 0xb3, 0xbe,
+		0xc4, 0x00, 0xb2, 0xb2, 0xb2, 0xc1, 0xff, 0xec, 0x00, 0xce, 0xce, 0xce, 0xcb, 0xe8, 0x00, 0xce, 0xce, 0xce, 0x93, 0xff, 0x9b, 0x00, 0x00, 0x00,
+		0x00, 0x04, 0x00, 0x00, 0xc9, 0x21, 0x00, 0x00, 0xc8, 0x6f, 0x00, 0x00, 0xc7, 0xa5, 0x00, 0x00, 0xc7, 0xd2, 0x00, 0x00, 0xc7, 0xf8, 0xc5, 0x03,
+		0x00, 0x00, 0xc7, 0xe5, 0x00, 0x00, 0xc8, 0xb8, 0x00, 0x00, 0xc8, 0x86, 0x00, 0x00, 0xc5, 0x39, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+		0xbf, 0x04, 0x00, 0x00, 0xc6, 0x55, 0x00, 0x00, 0xc7, 0x92, 0x00, 0x00, 0xc7, 0xa0, 0x80, 0x00, 0x00, 0xc7, 0xa3, 0x02, 0x00, 0x00, 0xc8, 0x9d,
+		0x00, 0x00, 0xc7, 0x88, 0x00, 0x00, 0xc5, 0x3e, 0x91, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0xc7, 0x32, 0x00, 0x00, 0xc8, 0x6f, 0x00, 0x00,
+		0xc8, 0x86, 0x83, 0x00, 0x00, 0xc7, 0x89, 0x02, 0x00, 0x00, 0xc6, 0x8b, 0x00, 0x00, 0xc6, 0x75, 0x00, 0x00, 0xc5, 0x1f, 0x89, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0x00, 0xc6, 0x59, 0x00, 0x00, 0xc8, 0x8a, 0x95, 0x00, 0x00, 0xc7, 0x89, 0x01, 0x00, 0x00, 0xc6, 0x87, 0x00, 0x00, 0xc8, 0x46,
+		0x8d, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0xc7, 0x4e, 0x00, 0x00, 0xc7, 0x92, 0x00, 0x00, 0xc7, 0xbe, 0x00, 0x00,
+		0xc7, 0xec, 0x00, 0x00, 0xc7, 0xfe, 0xc4, 0x04, 0x00, 0x00, 0xc7, 0xf5, 0x00, 0x00, 0xc7, 0xc9, 0x00, 0x00, 0xc7, 0x9f, 0x00, 0x00, 0xc7, 0x5b,
+		0x00, 0x00, 0xc8, 0x0e, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0x01, 0xb3, 0xb3, 0xb3, 0xf3, 0xc3, 0x00, 0xb3, 0xb3, 0xb3, 0xaa,
+		0xff, 0xff, 0xd3, 0x00, 0xb5, 0xb5, 0xb5, 0x48, 0xc4, 0x00, 0xb5, 0xb5, 0xb5, 0x48, 0xff, 0xeb, 0x01, 0xd5, 0xd5, 0xd5, 0x0c, 0xce, 0xce, 0xce,
+		0xe4, 0xe8, 0x00, 0xce, 0xce, 0xce, 0x63, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0xc2, 0x15, 0x00, 0x00, 0xc8, 0x38, 0x00, 0x00,
+		0xc7, 0x4d, 0x00, 0x00, 0xc7, 0x5b, 0x00, 0x00, 0xc6, 0x5e, 0x00, 0x00, 0xc6, 0x55, 0x00, 0x00, 0xc9, 0x42, 0x00, 0x00, 0xc6, 0x28, 0x00, 0x00,
+		0xcc, 0x05, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0xc6, 0x09, 0x00, 0x00, 0xc8, 0x2a, 0x00, 0x00, 0xc8,
+		0x46, 0x00, 0x00, 0xc7, 0x56, 0x00, 0x00, 0xc7, 0x5f, 0x00, 0x00, 0xc6, 0x59, 0x00, 0x00, 0xc9, 0x4b, 0x00, 0x00, 0xc8, 0x33, 0x00, 0x00, 0xc9,
+		0x13, 0x93, 0x00, 0x00, 0x00, 0x00, 0x06, 0xb6, 0xb6, 0xb6, 0x23, 0xb4, 0xb4, 0xb4, 0x8b, 0xb2, 0xb2, 0xb2, 0xb7, 0xb3, 0xb3, 0xb3, 0xbe, 0xb3,
+		0xb3, 0xb3, 0xab, 0xb4, 0xb4, 0xb4, 0x6d, 0xbf, 0xbf, 0xbf, 0x08, 0xc9, 0x00, 0xb3, 0xb3, 0xb3, 0x6b, 0xff, 0xff, 0xc7, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0xb3, 0xb3, 0xb3, 0x4a, 0xb3, 0xb3, 0xb3, 0x9e, 0x80, 0xb3, 0xb3, 0xb3, 0xbc, 0x01, 0xb4, 0xb4, 0xb4, 0x9c, 0xb3, 0xb3, 0xb3, 0x46, 0xbf,
+		0x00, 0x00, 0x00, 0x00, 0xec, 0x01, 0xd0, 0xd0, 0xd0, 0x31, 0xce, 0xce, 0xce, 0xfc, 0xe7, 0x01, 0xce, 0xce, 0xce, 0xfa, 0xcd, 0xcd, 0xcd, 0x29,
+		0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xc9, 0x00, 0xb3, 0xb3, 0xb3, 0x6c, 0xc3, 0x00, 0xb3, 0xb3, 0xb3, 0xae,
+		0xc9, 0x00, 0xb2, 0xb2, 0xb2, 0x63, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xff, 0xea, 0x00, 0xce, 0xce, 0xce, 0x6d, 0xa8, 0xce, 0xce, 0xce, 0xff,
+		0x01, 0xcd, 0xcd, 0xcd, 0xd3, 0xcc, 0xcc, 0xcc, 0x05, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x01, 0xb2, 0xb2, 0xb2, 0x35, 0xb3, 0xb3, 0xb3, 0xfa, 0x82,
+		0xb3, 0xb3, 0xb3, 0xf2, 0x00, 0xb4, 0xb4, 0xb4, 0x81, 0xc9, 0x02, 0xb1, 0xb1, 0xb1, 0x2e, 0xb3, 0xb3, 0xb3, 0xf6, 0xb3, 0xb3, 0xb3, 0xf3, 0x80,
+		0xb3, 0xb3, 0xb3, 0xf2, 0x01, 0xb3, 0xb3, 0xb3, 0xf4, 0xb3, 0xb3, 0xb3, 0xa2, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xe4, 0x00, 0xcf, 0xcf,
+		0xcf, 0xae, 0xe8, 0x00, 0xce, 0xce, 0xce, 0xaa, 0xa6, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+		0xe0, 0x01, 0xd5, 0xd5, 0xd5, 0x0c, 0xce, 0xce, 0xce, 0xe2, 0xe8, 0x00, 0xce, 0xce, 0xce, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xc7, 0x00, 0xcd, 0xcd, 0xcd, 0x29, 0xa9, 0xce, 0xce, 0xce, 0xff, 0x00, 0xce, 0xce, 0xce, 0x4e, 0xe9, 0x00, 0xce, 0xce, 0xce, 0xd5, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0x01, 0xcc, 0xcc, 0xcc, 0x3c, 0xcf, 0xcf, 0xcf, 0xdd, 0xa6, 0xce, 0xce, 0xce, 0xdb, 0x02, 0xce, 0xce, 0xce,
+		0xdc, 0xce, 0xce, 0xce, 0xd0, 0xca, 0xca, 0xca, 0x18, 0xe6, 0x81, 0xce, 0xce, 0xce, 0xed, 0x00, 0xce, 0xce, 0xce, 0xc2, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xf1,
 		};
-// array size is 105800
-static const uint16_t BSP_Docs_QR[]  __attribute__((section(".SystemImages"))) = {
-		0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8508, 0x8508, 0x8508, 0x8508, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8508, 0x8508, 0x8508, 0x8508, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8508, 0x8508, 0x8508, 0x8508, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x8529, 0x8508, 0x8508, 0x8508, 0x8508, 0x85ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x85ad, 0x8508, 0x8508, 0x8508, 0x8508, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x858c, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x8210, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x88c6, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x854a, 0x854a, 0x854a, 0x854a, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x856b, 0x856b, 0x856b, 0x856b, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x854a, 0x854a, 0x854a, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x854a, 0x854a, 0x854a, 0x854a, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x854a, 0x854a, 0x854a, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x856b, 0x856b, 0x856b, 0x856b, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x85ad, 0x85ad, 0x85ad, 0x85ad, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8508, 0x8508, 0x8508, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x85ad, 0x85ad, 0x85ad, 0x85ad, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x85ad, 0x85ad, 0x85ad, 0x85ad, 0x854a, 0x8508, 0x8508, 0x8508, 0x8508, 0x858c, 0x85ad, 0x85ad, 0x85ad, 0x85ad, 0x85ad, 0x85ad, 0x85ad, 0x85ad, 0x85ad, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x85ad, 0x85ad, 0x85ad, 0x85ad, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x8529, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x854a, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8252, 0x8252, 0x8252, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8252, 0x8252, 0x8252, 0x8252, 0x858c, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8252, 0x8252, 0x8252, 0x8252, 0x88a5, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8252, 0x8252, 0x8252, 0x8252, 0x8231, 0x8863, 0x8863, 0x8863, 0x8863, 0x88e7, 0x8252, 0x8252, 0x8252, 0x8252, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8252, 0x8252, 0x8252, 0x8252, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x8508, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8210, 0x8210, 0x8210, 0x8210, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8210, 0x8210, 0x8210, 0x8210, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x81ce, 0x8210, 0x8210, 0x8210, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x856b, 0x8210, 0x8210, 0x8210, 0x8210, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88c6, 0x8210, 0x8210, 0x8210, 0x8210, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x858c, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x854a, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x856b, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x85ad, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x854a, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x854a, 0x854a, 0x854a, 0x854a, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x854a, 0x854a, 0x854a, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x854a, 0x854a, 0x854a, 0x854a, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x854a, 0x854a, 0x854a, 0x854a, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x858c, 0x858c, 0x858c, 0x858c, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x858c, 0x858c, 0x858c, 0x858c, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x858c, 0x858c, 0x858c, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x858c, 0x858c, 0x858c, 0x858c, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8529, 0x8529, 0x8529, 0x8529, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8529, 0x8529, 0x8529, 0x8529, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8529, 0x8529, 0x8529, 0x8529, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8529, 0x8529, 0x8529, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8529, 0x8529, 0x8529, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8529, 0x8529, 0x8529, 0x8529, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x854a, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x8529, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ce, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x8529, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x8508, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x81ce, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x85ad, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x854a, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x854a, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8231, 0x8231, 0x8231, 0x8231, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8231, 0x8231, 0x8231, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8884, 0x8884, 0x8884, 0x8884, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8231, 0x8231, 0x8231, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8884, 0x8884, 0x8884, 0x8884, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8884, 0x8884, 0x8884, 0x8884, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8231, 0x8231, 0x8231, 0x8231, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8884, 0x8884, 0x8884, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8231, 0x8231, 0x8231, 0x8231, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8884, 0x8884, 0x8884, 0x8884, 0x8529, 0x8231, 0x8231, 0x8231, 0x8231, 0x854a, 0x8884, 0x8884, 0x8884, 0x8884, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8231, 0x8231, 0x8231, 0x8231, 0x88e7, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8884, 0x8884, 0x8884, 0x8884, 0x858c, 0x8231, 0x8231, 0x8231, 0x8231, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8231, 0x8231, 0x8231, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8884, 0x8884, 0x8884, 0x88c6, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x858c, 0x8884, 0x8884, 0x8884, 0x8884, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8884, 0x8884, 0x8884, 0x8884, 0x84e7, 0x8231, 0x8231, 0x8231, 0x8231, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x81ef, 0x8231, 0x8231, 0x8231, 0x8231, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x858c, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x858c, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ad, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x858c, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8529, 0x8529, 0x8529, 0x8529, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8529, 0x8529, 0x8529, 0x8529, 0x856b, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x854a, 0x8529, 0x8529, 0x8529, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8529, 0x8529, 0x8529, 0x8529, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x8529, 0x8529, 0x8529, 0x8529, 0x854a, 0x858c, 0x858c, 0x858c, 0x858c, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x858c, 0x858c, 0x858c, 0x858c, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x854a, 0x858c, 0x858c, 0x858c, 0x858c, 0x856b, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8529, 0x8529, 0x8529, 0x8529, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8529, 0x8529, 0x8529, 0x8529, 0x856b, 0x858c, 0x858c, 0x858c, 0x858c, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8529, 0x8529, 0x8529, 0x8529, 0x856b, 0x858c, 0x858c, 0x858c, 0x858c, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x856b, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x854a, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8529, 0x8529, 0x8529, 0x8529, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x854a, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x854a, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8884, 0x8884, 0x8884, 0x8884, 0x8529, 0x8231, 0x8231, 0x8231, 0x8231, 0x856b, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x81ce, 0x8231, 0x8231, 0x8231, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8231, 0x8231, 0x8231, 0x8231, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8231, 0x8231, 0x8231, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8884, 0x8884, 0x8884, 0x8884, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x81ef, 0x8231, 0x8231, 0x8231, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8231, 0x8231, 0x8231, 0x81ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x81ef, 0x8231, 0x8231, 0x8231, 0x8231, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8884, 0x8884, 0x8884, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8231, 0x8231, 0x8231, 0x8231, 0x856b, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8231, 0x8231, 0x8231, 0x8231, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8884, 0x8884, 0x8884, 0x8884, 0x81ce, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8884, 0x8884, 0x8884, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8231, 0x8231, 0x8231, 0x8231, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8884, 0x8884, 0x8884, 0x8884, 0x8529, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8231, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x858c, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x854a, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x88e7, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x8529, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x854a, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x858c, 0x8529, 0x8529, 0x8529, 0x8529, 0x854a, 0x858c, 0x858c, 0x858c, 0x858c, 0x856b, 0x8529, 0x8529, 0x8529, 0x8529, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8508, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x858c, 0x858c, 0x858c, 0x858c, 0x856b, 0x8529, 0x8529, 0x8529, 0x8529, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8529, 0x8529, 0x8529, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x858c, 0x858c, 0x858c, 0x858c, 0x856b, 0x8529, 0x8529, 0x8529, 0x8529, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x854a, 0x854a, 0x854a, 0x854a, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x856b, 0x856b, 0x856b, 0x856b, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x854a, 0x854a, 0x854a, 0x854a, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x856b, 0x856b, 0x856b, 0x856b, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x856b, 0x856b, 0x856b, 0x856b, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x856b, 0x856b, 0x856b, 0x856b, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x858c, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x8529, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x85ad, 0x84e7, 0x84e7, 0x84e7, 0x84e7, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8508, 0x8210, 0x8210, 0x8210, 0x8210, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8210, 0x8210, 0x8210, 0x8210, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8210, 0x8210, 0x8210, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8210, 0x8210, 0x8210, 0x8210, 0x88e7, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x8508, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x88e7, 0x8508, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x84e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8863, 0x8863, 0x8863, 0x8863, 0x854a, 0x8252, 0x8252, 0x8252, 0x8252, 0x8252, 0x8252, 0x8252, 0x8252, 0x8252, 0x88e7, 0x8863, 0x8863, 0x8863, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8252, 0x8252, 0x8252, 0x8252, 0x8252, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8252, 0x8252, 0x8252, 0x8252, 0x854a, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8252, 0x8252, 0x8252, 0x8252, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8863, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x856b, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x85ad, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x88c6, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88c6, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8508, 0x8508, 0x8508, 0x8508, 0x85ad, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x85ad, 0x85ad, 0x85ad, 0x85ad, 0x8529, 0x8508, 0x8508, 0x8508, 0x8508, 0x85ad, 0x85ad, 0x85ad, 0x85ad, 0x85ad, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8508, 0x8508, 0x8508, 0x8508, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x85ad, 0x85ad, 0x85ad, 0x85ad, 0x85ad, 0x85ad, 0x85ad, 0x85ad, 0x85ad, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8863, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x84e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x88c6, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x8863, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x854a, 0x854a, 0x854a, 0x854a, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x854a, 0x854a, 0x854a, 0x854a, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x856b, 0x854a, 0x854a, 0x854a, 0x854a, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x8508, 0x856b, 0x856b, 0x856b, 0x856b, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8863, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x854a, 0x88c6, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ef, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x88c6, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ef, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x81ce, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x8884, 0x88c6, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8252, 0x8210, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x8210, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x854a, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x88e7, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8508, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8508, 0x8508, 0x8508, 0x8508, 0x8529, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x856b, 0x8508, 0x8508, 0x8508, 0x8508, 0x856b, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8508, 0x8508, 0x8508, 0x8508, 0x856b, 0x81ad, 0x81ad, 0x81ad, 0x81ad, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8210, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x81ef, 0x8210, 0x8252, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x8273, 0x8273, 0x8273, 0x8273, 0x81ce, 0x8842, 0x8842, 0x8842, 0x8842, 0x854a, 0x8273, 0x8273, 0x8273, 0x8273, 0x8529, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x858c, 0x8842, 0x8842, 0x8842, 0x8842, 0x858c, 0x8273, 0x8273, 0x8273, 0x8273, 0x88e7, 0x8842, 0x8842, 0x8842, 0x8842, 0x8231, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8231, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x856b, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x8273, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8863, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8884, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8884, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x88a5, 0x8863, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842,
-		  0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842, 0x8842
+// array size is 5864, compressed from 80000
+static const uint8_t BSP_Docs_QR[] __attribute__((section(".SystemImages"))) = {
+		0xbf, 0x42, 0x88, 0xbf, 0x42, 0x88, 0xbf, 0x42, 0x88, 0xbf, 0x42, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x63, 0x88, 0x8c, 0xa5, 0x88, 0x00, 0x63, 0x88, 0xc2, 0x83, 0xa5,
+		0x88, 0x00, 0x63, 0x88, 0xc2, 0x83, 0xa5, 0x88, 0xcc, 0x00, 0x84, 0x88, 0x91, 0xa5, 0x88, 0xd6, 0x00, 0x84, 0x88, 0x82, 0xa5, 0x88, 0x00, 0x63,
+		0x88, 0xc2, 0x8d, 0xa5, 0x88, 0xd1, 0x00, 0x84, 0x88, 0x82, 0xa5, 0x88, 0x00, 0x63, 0x88, 0xc2, 0xa0, 0xa5, 0x88, 0x00, 0x63, 0x88, 0xd0, 0x00,
+		0xa5, 0x88, 0x8c, 0x73, 0x82, 0x00, 0x08, 0x85, 0xc2, 0x00, 0xef, 0x81, 0x82, 0x73, 0x82, 0xc3, 0x83, 0x73, 0x82, 0xcc, 0x00, 0x4a, 0x85, 0x91,
+		0x73, 0x82, 0xd6, 0x00, 0x8c, 0x85, 0x82, 0x73, 0x82, 0x00, 0xe7, 0x88, 0xc2, 0x00, 0x31, 0x82, 0x8b, 0x73, 0x82, 0x00, 0x31, 0x82, 0xd1, 0x00,
+		0xce, 0x81, 0x82, 0x73, 0x82, 0x00, 0xa5, 0x88, 0xc2, 0xa0, 0x73, 0x82, 0x00, 0xa5, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xdf, 0x00, 0x84, 0x88, 0x87, 0xad, 0x81, 0x00, 0x10, 0x82, 0xc2, 0x00, 0x8c, 0x85, 0x82, 0x08, 0x85, 0x00, 0x31, 0x82, 0xc2, 0x00, 0x29, 0x85,
+		0x82, 0x08, 0x85, 0x83, 0xad, 0x81, 0xc2, 0x00, 0x63, 0x88, 0x82, 0x08, 0x85, 0x00, 0xc6, 0x88, 0xd1, 0x00, 0xce, 0x81, 0x82, 0xad, 0x81, 0xc7,
+		0x00, 0x63, 0x88, 0x87, 0x08, 0x85, 0x00, 0xa5, 0x88, 0xc2, 0x00, 0x29, 0x85, 0x82, 0xad, 0x81, 0x00, 0x29, 0x85, 0x82, 0x08, 0x85, 0x00, 0xad,
+		0x85, 0x8b, 0xad, 0x81, 0x00, 0xad, 0x85, 0x82, 0x08, 0x85, 0x00, 0xe7, 0x88, 0xc2, 0x00, 0xa5, 0x88, 0x87, 0x08, 0x85, 0x00, 0x8c, 0x85, 0x82,
+		0xad, 0x81, 0x00, 0x84, 0x88, 0xc7, 0x00, 0x10, 0x82, 0x94, 0xef, 0x81, 0x01, 0x10, 0x82, 0x52, 0x82, 0xd5, 0x88, 0x42, 0x88, 0x00, 0x4a, 0x85,
+		0x91, 0x73, 0x82, 0x87, 0x42, 0x88, 0x00, 0xa5, 0x88, 0x82, 0x73, 0x82, 0x00, 0xce, 0x81, 0xd1, 0x00, 0x84, 0x88, 0x8b, 0x42, 0x88, 0x00, 0x84,
+		0x88, 0x87, 0x73, 0x82, 0x00, 0x8c, 0x85, 0x87, 0x42, 0x88, 0x00, 0xce, 0x81, 0x82, 0x73, 0x82, 0x00, 0x84, 0x88, 0x8b, 0x42, 0x88, 0x00, 0x84,
+		0x88, 0x82, 0x73, 0x82, 0x00, 0xef, 0x81, 0xc2, 0x00, 0x29, 0x85, 0x87, 0x73, 0x82, 0x00, 0xe7, 0x84, 0x87, 0x42, 0x88, 0xc3, 0x00, 0x08, 0x85,
+		0x94, 0x84, 0x88, 0x01, 0xc6, 0x88, 0x10, 0x82, 0xff, 0xff, 0xeb, 0x00, 0xe7, 0x88, 0x94, 0x42, 0x88, 0x01, 0x84, 0x88, 0xef, 0x81, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xe9, 0x00, 0xc6, 0x88, 0x87, 0x6b, 0x85, 0x00, 0x31, 0x82, 0xc2, 0x83, 0x6b, 0x85, 0x87, 0x4a, 0x85, 0x00, 0x8c, 0x85,
+		0xc2, 0x00, 0x10, 0x82, 0x82, 0x4a, 0x85, 0x00, 0xce, 0x81, 0xc7, 0x00, 0xad, 0x85, 0x82, 0x6b, 0x85, 0x83, 0x4a, 0x85, 0xc3, 0x82, 0x4a, 0x85,
+		0x00, 0x6b, 0x85, 0xc2, 0x00, 0x31, 0x82, 0x83, 0x6b, 0x85, 0x82, 0x4a, 0x85, 0x00, 0xc6, 0x88, 0xd1, 0x82, 0x4a, 0x85, 0x00, 0x6b, 0x85, 0xcc,
+		0x00, 0xef, 0x81, 0x82, 0x6b, 0x85, 0x83, 0x4a, 0x85, 0x00, 0x84, 0x88, 0xcb, 0x00, 0x63, 0x88, 0x8c, 0x4a, 0x85, 0x00, 0xc6, 0x88, 0xe4, 0x88,
+		0x42, 0x88, 0x00, 0xef, 0x81, 0xc2, 0x00, 0x63, 0x88, 0x82, 0x42, 0x88, 0x9b, 0x73, 0x82, 0x00, 0xc6, 0x88, 0x82, 0x42, 0x88, 0x00, 0x31, 0x82,
+		0x82, 0x73, 0x82, 0xc3, 0x87, 0x73, 0x82, 0x00, 0xce, 0x81, 0x82, 0x42, 0x88, 0x00, 0x29, 0x85, 0x82, 0x73, 0x82, 0x00, 0x29, 0x85, 0xd1, 0x87,
+		0x73, 0x82, 0xc8, 0x00, 0x4a, 0x85, 0x82, 0x42, 0x88, 0x00, 0xce, 0x81, 0x82, 0x73, 0x82, 0x00, 0xa5, 0x88, 0xcc, 0x8c, 0x73, 0x82, 0x00, 0x4a,
+		0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x00, 0x84, 0x88, 0x82, 0xad, 0x85, 0x00, 0x29, 0x85, 0xdb, 0x82, 0x08, 0x85,
+		0x00, 0x4a, 0x85, 0xc7, 0x00, 0xce, 0x81, 0x87, 0x08, 0x85, 0x00, 0x84, 0x88, 0xd5, 0x00, 0x31, 0x82, 0x82, 0xad, 0x85, 0x00, 0xef, 0x81, 0xc2,
+		0x00, 0xef, 0x81, 0x82, 0xad, 0x85, 0x00, 0x4a, 0x85, 0x82, 0x08, 0x85, 0x00, 0x8c, 0x85, 0x87, 0xad, 0x85, 0x87, 0x08, 0x85, 0x00, 0xe7, 0x88,
+		0xc7, 0x00, 0x10, 0x82, 0x82, 0xad, 0x85, 0x00, 0x31, 0x82, 0xfc, 0x00, 0xa5, 0x88, 0x82, 0x73, 0x82, 0x00, 0xad, 0x81, 0xdb, 0x82, 0x42, 0x88,
+		0x00, 0xa5, 0x88, 0xc7, 0x00, 0x6b, 0x85, 0x8c, 0x42, 0x88, 0xd1, 0x8d, 0x73, 0x82, 0x00, 0xe7, 0x88, 0x82, 0x42, 0x88, 0x00, 0x31, 0x82, 0x87,
+		0x73, 0x82, 0x8c, 0x42, 0x88, 0xc3, 0x88, 0x73, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x00, 0x63, 0x88, 0x82,
+		0xc6, 0x88, 0x00, 0x29, 0x85, 0x82, 0xef, 0x81, 0x00, 0x29, 0x85, 0xc2, 0x00, 0x6b, 0x85, 0x82, 0xef, 0x81, 0x00, 0x52, 0x82, 0xc2, 0x00, 0x10,
+		0x82, 0x82, 0xef, 0x81, 0xc3, 0x82, 0xef, 0x81, 0x00, 0x10, 0x82, 0xc2, 0x00, 0xef, 0x81, 0x82, 0xc6, 0x88, 0x00, 0x4a, 0x85, 0x82, 0xef, 0x81,
+		0x00, 0xe7, 0x84, 0xd5, 0x00, 0x31, 0x82, 0x87, 0xc6, 0x88, 0x00, 0x6b, 0x85, 0xc2, 0x00, 0x6b, 0x85, 0x82, 0xc6, 0x88, 0x00, 0x63, 0x88, 0xd0,
+		0x00, 0x84, 0x88, 0x82, 0xef, 0x81, 0x00, 0x8c, 0x85, 0xc2, 0x00, 0x84, 0x88, 0x82, 0xc6, 0x88, 0x00, 0xad, 0x85, 0xc2, 0x00, 0x4a, 0x85, 0x82,
+		0xc6, 0x88, 0x00, 0x63, 0x88, 0xf7, 0x83, 0x42, 0x88, 0x00, 0x08, 0x85, 0x82, 0x73, 0x82, 0x00, 0x6b, 0x85, 0xc2, 0x00, 0xad, 0x85, 0x9a, 0x73,
+		0x82, 0x00, 0xce, 0x81, 0x82, 0x42, 0x88, 0x00, 0x4a, 0x85, 0x82, 0x73, 0x82, 0x00, 0x29, 0x85, 0xd6, 0x87, 0x42, 0x88, 0x00, 0x29, 0x85, 0xc2,
+		0x00, 0x29, 0x85, 0x87, 0x42, 0x88, 0xcd, 0x82, 0x73, 0x82, 0x00, 0xef, 0x81, 0x87, 0x42, 0x88, 0x00, 0x6b, 0x85, 0xc2, 0x00, 0xe7, 0x84, 0x87,
+		0x42, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x83, 0x63, 0x88, 0x00, 0x10, 0x82, 0xc2, 0x00, 0x84, 0x88, 0x8b,
+		0x63, 0x88, 0x00, 0xc6, 0x88, 0xc2, 0x00, 0x73, 0x82, 0x83, 0x52, 0x82, 0xd6, 0x83, 0x63, 0x88, 0xc2, 0x00, 0xe7, 0x88, 0x82, 0x52, 0x82, 0x00,
+		0x8c, 0x85, 0x83, 0x63, 0x88, 0xc2, 0x00, 0xce, 0x81, 0x82, 0x52, 0x82, 0x00, 0xa5, 0x88, 0x87, 0x63, 0x88, 0x82, 0x52, 0x82, 0x00, 0x31, 0x82,
+		0x82, 0x63, 0x88, 0x00, 0xe7, 0x88, 0x82, 0x52, 0x82, 0x00, 0x8c, 0x85, 0xc7, 0x83, 0x52, 0x82, 0x00, 0xa5, 0x88, 0xcb, 0x00, 0x42, 0x88, 0x8d,
+		0x63, 0x88, 0xe9, 0x83, 0x42, 0x88, 0x00, 0xef, 0x81, 0xc2, 0x00, 0x63, 0x88, 0x8b, 0x42, 0x88, 0x00, 0xa5, 0x88, 0x8c, 0x73, 0x82, 0xd2, 0x87,
+		0x42, 0x88, 0x00, 0xe7, 0x88, 0x82, 0x73, 0x82, 0x00, 0x8c, 0x85, 0x87, 0x42, 0x88, 0x00, 0xce, 0x81, 0x82, 0x73, 0x82, 0x00, 0x84, 0x88, 0x87,
+		0x42, 0x88, 0x82, 0x73, 0x82, 0x00, 0x31, 0x82, 0x82, 0x42, 0x88, 0x00, 0xc6, 0x88, 0x82, 0x73, 0x82, 0xc8, 0x83, 0x73, 0x82, 0xcd, 0x90, 0x42,
+		0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x4a, 0x85, 0x94, 0xe7, 0x88, 0x01, 0x08, 0x85, 0x10, 0x82, 0xd5, 0x00, 0xa5,
+		0x88, 0x8c, 0x73, 0x82, 0x00, 0x08, 0x85, 0xcc, 0x83, 0x73, 0x82, 0xc7, 0x00, 0xce, 0x81, 0x82, 0x42, 0x88, 0x00, 0x4a, 0x85, 0xc7, 0x00, 0xef,
+		0x81, 0x82, 0x73, 0x82, 0x00, 0x84, 0x88, 0x82, 0x42, 0x88, 0x83, 0x73, 0x82, 0x91, 0x42, 0x88, 0x00, 0x8c, 0x85, 0x82, 0x73, 0x82, 0x00, 0xe7,
+		0x88, 0x82, 0x42, 0x88, 0x00, 0x31, 0x82, 0x82, 0x73, 0x82, 0x87, 0x42, 0x88, 0x00, 0x84, 0x88, 0x82, 0x73, 0x82, 0x00, 0xef, 0x81, 0x87, 0x42,
+		0x88, 0xd2, 0x9b, 0x73, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x42, 0x88, 0xc3, 0x83, 0x73,
+		0x82, 0x00, 0x6b, 0x85, 0x87, 0x42, 0x88, 0xc3, 0x83, 0x73, 0x82, 0x83, 0x42, 0x88, 0x87, 0x73, 0x82, 0x00, 0xce, 0x81, 0xee, 0x83, 0x42, 0x88,
+		0x00, 0xce, 0x81, 0xc7, 0xb3, 0x42, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x00, 0x52, 0x82, 0x82, 0x10, 0x82, 0x00,
+		0x52, 0x82, 0xc2, 0x00, 0x4a, 0x85, 0x82, 0xa5, 0x88, 0x00, 0x10, 0x82, 0xc2, 0x00, 0xc6, 0x88, 0x8b, 0xa5, 0x88, 0x00, 0xe7, 0x88, 0xc2, 0x00,
+		0x52, 0x82, 0x82, 0x10, 0x82, 0x00, 0x4a, 0x85, 0xc2, 0x00, 0x84, 0x88, 0x82, 0xa5, 0x88, 0x00, 0xce, 0x81, 0x82, 0x10, 0x82, 0xc3, 0x83, 0xa5,
+		0x88, 0xcc, 0x00, 0x63, 0x88, 0x82, 0xa5, 0x88, 0x00, 0x6b, 0x85, 0x82, 0x10, 0x82, 0x00, 0xc6, 0x88, 0xc7, 0x87, 0xa5, 0x88, 0x00, 0xc6, 0x88,
+		0x82, 0x10, 0x82, 0x00, 0xad, 0x85, 0xc2, 0x00, 0x63, 0x88, 0x87, 0xa5, 0x88, 0x00, 0xef, 0x81, 0xc2, 0x00, 0xe7, 0x88, 0x90, 0xa5, 0x88, 0x00,
+		0x84, 0x88, 0xe9, 0x00, 0xad, 0x81, 0x82, 0x42, 0x88, 0x00, 0x4a, 0x85, 0x9f, 0x73, 0x82, 0x00, 0xce, 0x81, 0x87, 0x42, 0x88, 0x00, 0x8c, 0x85,
+		0x82, 0x73, 0x82, 0x00, 0xc6, 0x88, 0x82, 0x42, 0x88, 0x00, 0x31, 0x82, 0x90, 0x73, 0x82, 0xc3, 0x00, 0x29, 0x85, 0x82, 0x73, 0x82, 0x00, 0x29,
+		0x85, 0x87, 0x42, 0x88, 0xc3, 0x87, 0x73, 0x82, 0x00, 0x31, 0x82, 0x87, 0x42, 0x88, 0x00, 0x29, 0x85, 0x9f, 0x73, 0x82, 0x00, 0xef, 0x81, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x00, 0x84, 0x88, 0x82, 0xce, 0x81, 0x00, 0x8c, 0x85, 0x82, 0xe7, 0x84, 0x00, 0x4a, 0x85,
+		0x8c, 0xce, 0x81, 0xc3, 0x83, 0xce, 0x81, 0xc7, 0x00, 0xef, 0x81, 0x87, 0xe7, 0x84, 0x00, 0x6b, 0x85, 0x82, 0xce, 0x81, 0x00, 0xa5, 0x88, 0xc2,
+		0x00, 0xad, 0x85, 0x82, 0xce, 0x81, 0xd1, 0x00, 0xe7, 0x84, 0x82, 0xce, 0x81, 0x00, 0xe7, 0x84, 0xc2, 0x00, 0xc6, 0x88, 0x82, 0xe7, 0x84, 0x00,
+		0xad, 0x85, 0x82, 0xce, 0x81, 0xcc, 0x00, 0x84, 0x88, 0x82, 0xe7, 0x84, 0x00, 0x4a, 0x85, 0x82, 0xce, 0x81, 0x00, 0x31, 0x82, 0xc7, 0x00, 0xef,
+		0x81, 0x87, 0xce, 0x81, 0xc7, 0x00, 0x10, 0x82, 0x82, 0xe7, 0x84, 0x00, 0xc6, 0x88, 0xc7, 0x00, 0xc6, 0x88, 0x82, 0xe7, 0x84, 0x00, 0x63, 0x88,
+		0x95, 0x42, 0x88, 0x00, 0x08, 0x85, 0x82, 0x73, 0x82, 0x00, 0x6b, 0x85, 0x8c, 0x42, 0x88, 0x00, 0x52, 0x82, 0xc2, 0x83, 0x42, 0x88, 0x91, 0x73,
+		0x82, 0x00, 0x29, 0x85, 0x8c, 0x42, 0x88, 0xd1, 0x88, 0x42, 0x88, 0x00, 0xce, 0x81, 0x82, 0x73, 0x82, 0x00, 0x84, 0x88, 0x82, 0x42, 0x88, 0xcc,
+		0x00, 0xc6, 0x88, 0x82, 0x73, 0x82, 0x00, 0x8c, 0x85, 0x82, 0x42, 0x88, 0x00, 0x6b, 0x85, 0xc7, 0x00, 0xa5, 0x88, 0x87, 0x42, 0x88, 0x8c, 0x73,
+		0x82, 0x00, 0xad, 0x85, 0xc7, 0x00, 0xad, 0x81, 0x82, 0x73, 0x82, 0x00, 0xa5, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
+		0x00, 0x08, 0x85, 0x82, 0x4a, 0x85, 0x83, 0x6b, 0x85, 0xc7, 0x00, 0x52, 0x82, 0x87, 0x6b, 0x85, 0x00, 0xef, 0x81, 0xc2, 0x00, 0xad, 0x81, 0x87,
+		0x4a, 0x85, 0x00, 0x63, 0x88, 0xc2, 0x87, 0x6b, 0x85, 0x00, 0x8c, 0x85, 0xc2, 0x00, 0x10, 0x82, 0x8c, 0x4a, 0x85, 0x00, 0x10, 0x82, 0xc2, 0x00,
+		0x6b, 0x85, 0x82, 0x4a, 0x85, 0xc7, 0x00, 0x52, 0x82, 0x82, 0x4a, 0x85, 0x00, 0x8c, 0x85, 0xd1, 0x00, 0x6b, 0x85, 0x87, 0x4a, 0x85, 0x87, 0x6b,
+		0x85, 0x00, 0xad, 0x85, 0xc7, 0x00, 0xc6, 0x88, 0x82, 0x4a, 0x85, 0x83, 0x6b, 0x85, 0x00, 0x84, 0x88, 0xe4, 0x00, 0xef, 0x81, 0x82, 0x73, 0x82,
+		0x00, 0x63, 0x88, 0x87, 0x42, 0x88, 0xc2, 0x00, 0x10, 0x82, 0x87, 0x42, 0x88, 0x00, 0x4a, 0x85, 0x8c, 0x73, 0x82, 0x00, 0x84, 0x88, 0x8b, 0x42,
+		0x88, 0x00, 0x84, 0x88, 0xae, 0x73, 0x82, 0xcd, 0x88, 0x73, 0x82, 0x87, 0x42, 0x88, 0x00, 0xc6, 0x88, 0xc7, 0x00, 0x6b, 0x85, 0x82, 0x73, 0x82,
+		0x00, 0x08, 0x85, 0x9a, 0x42, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x00, 0x84, 0x88, 0x82, 0x8c, 0x85, 0x00, 0xef,
+		0x81, 0xc7, 0x00, 0x29, 0x85, 0x82, 0x8c, 0x85, 0x00, 0x52, 0x82, 0xc2, 0x00, 0xad, 0x85, 0x82, 0x8c, 0x85, 0xc3, 0x83, 0x29, 0x85, 0x82, 0x8c,
+		0x85, 0x00, 0x29, 0x85, 0xc7, 0x00, 0xad, 0x85, 0x82, 0x29, 0x85, 0x00, 0x10, 0x82, 0xd0, 0x00, 0x63, 0x88, 0x82, 0x29, 0x85, 0x00, 0x8c, 0x85,
+		0xc2, 0x00, 0xef, 0x81, 0x82, 0x29, 0x85, 0x00, 0xef, 0x81, 0xc7, 0x00, 0x4a, 0x85, 0x82, 0x29, 0x85, 0xc3, 0x82, 0x29, 0x85, 0x00, 0x4a, 0x85,
+		0xcc, 0x00, 0xc6, 0x88, 0x91, 0x29, 0x85, 0x87, 0x8c, 0x85, 0x00, 0xce, 0x81, 0xc7, 0x00, 0xc6, 0x88, 0x82, 0x29, 0x85, 0x00, 0xa5, 0x88, 0xd5,
+		0x00, 0xa5, 0x88, 0x87, 0x73, 0x82, 0xc3, 0x00, 0xad, 0x85, 0x8c, 0x73, 0x82, 0x87, 0x42, 0x88, 0x00, 0xa5, 0x88, 0x82, 0x73, 0x82, 0x00, 0xce,
+		0x81, 0xc7, 0x00, 0x29, 0x85, 0x82, 0x42, 0x88, 0x00, 0xef, 0x81, 0xd0, 0x83, 0x42, 0x88, 0x00, 0xe7, 0x88, 0xc2, 0x00, 0x8c, 0x85, 0x82, 0x42,
+		0x88, 0x00, 0x8c, 0x85, 0xc7, 0x00, 0x84, 0x88, 0x82, 0x42, 0x88, 0xc3, 0x82, 0x42, 0x88, 0x00, 0x84, 0x88, 0xcc, 0x92, 0x42, 0x88, 0x8c, 0x73,
+		0x82, 0xc3, 0x9b, 0x42, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x00, 0xef, 0x81, 0x82, 0xc6, 0x88, 0x00, 0x4a, 0x85,
+		0x82, 0xef, 0x81, 0x00, 0x29, 0x85, 0x82, 0xc6, 0x88, 0x00, 0x10, 0x82, 0xc2, 0x00, 0xe7, 0x84, 0x82, 0xc6, 0x88, 0x87, 0xef, 0x81, 0x00, 0xce,
+		0x81, 0x82, 0xc6, 0x88, 0x00, 0x29, 0x85, 0x82, 0xef, 0x81, 0x00, 0x31, 0x82, 0xc2, 0x00, 0x10, 0x82, 0x82, 0xef, 0x81, 0x00, 0x08, 0x85, 0x82,
+		0xc6, 0x88, 0x00, 0xce, 0x81, 0x87, 0xef, 0x81, 0xc2, 0x00, 0x84, 0x88, 0x82, 0xef, 0x81, 0x00, 0xad, 0x85, 0x82, 0xc6, 0x88, 0x00, 0x4a, 0x85,
+		0x82, 0xef, 0x81, 0x00, 0x4a, 0x85, 0x87, 0xc6, 0x88, 0x00, 0x63, 0x88, 0xd5, 0x00, 0x31, 0x82, 0x87, 0xef, 0x81, 0x00, 0xc6, 0x88, 0xc7, 0x83,
+		0xef, 0x81, 0x82, 0xc6, 0x88, 0x00, 0xe7, 0x84, 0xcc, 0x00, 0x29, 0x85, 0x87, 0xef, 0x81, 0x00, 0xa5, 0x88, 0xd5, 0x00, 0xad, 0x81, 0x82, 0x42,
+		0x88, 0x00, 0x4a, 0x85, 0x82, 0x73, 0x82, 0x00, 0x08, 0x85, 0x82, 0x42, 0x88, 0x00, 0xef, 0x81, 0xc2, 0x00, 0x63, 0x88, 0x82, 0x42, 0x88, 0x87,
+		0x73, 0x82, 0x00, 0x10, 0x82, 0x82, 0x42, 0x88, 0x00, 0xe7, 0x84, 0x8c, 0x73, 0x82, 0x00, 0xc6, 0x88, 0x82, 0x42, 0x88, 0x00, 0x31, 0x82, 0x87,
+		0x73, 0x82, 0xc3, 0x82, 0x73, 0x82, 0x00, 0xce, 0x81, 0x82, 0x42, 0x88, 0x00, 0x29, 0x85, 0x82, 0x73, 0x82, 0x00, 0x29, 0x85, 0x8c, 0x42, 0x88,
+		0xd1, 0x88, 0x73, 0x82, 0x00, 0xe7, 0x84, 0xc7, 0x83, 0x73, 0x82, 0x82, 0x42, 0x88, 0x00, 0x63, 0x88, 0xcc, 0x00, 0x6b, 0x85, 0x87, 0x73, 0x82,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x00, 0x52, 0x82, 0x82, 0x31, 0x82, 0x00, 0x52, 0x82, 0xc2, 0x00, 0x52, 0x82, 0x82,
+		0x31, 0x82, 0x83, 0x73, 0x82, 0xd1, 0x00, 0x63, 0x88, 0x82, 0x84, 0x88, 0x00, 0x6b, 0x85, 0xc7, 0x00, 0x52, 0x82, 0x82, 0x31, 0x82, 0x83, 0x73,
+		0x82, 0x83, 0x84, 0x88, 0xc2, 0x00, 0x63, 0x88, 0x82, 0x84, 0x88, 0x00, 0x63, 0x88, 0xc2, 0x00, 0x63, 0x88, 0x82, 0x84, 0x88, 0x00, 0x63, 0x88,
+		0xc7, 0x00, 0xef, 0x81, 0x82, 0x31, 0x82, 0x83, 0x84, 0x88, 0xc2, 0x00, 0x42, 0x88, 0x82, 0x84, 0x88, 0x00, 0x08, 0x85, 0xc2, 0x00, 0xad, 0x85,
+		0x87, 0x84, 0x88, 0x00, 0x63, 0x88, 0xc7, 0x83, 0x84, 0x88, 0x82, 0x31, 0x82, 0x00, 0x52, 0x82, 0xc2, 0x00, 0x10, 0x82, 0x82, 0x84, 0x88, 0x00,
+		0x29, 0x85, 0x82, 0x31, 0x82, 0x00, 0x4a, 0x85, 0x82, 0x84, 0x88, 0x00, 0xce, 0x81, 0xda, 0x92, 0x73, 0x82, 0xd1, 0x83, 0x42, 0x88, 0x00, 0x4a,
+		0x85, 0x91, 0x73, 0x82, 0xa0, 0x42, 0x88, 0x00, 0x31, 0x82, 0x82, 0x73, 0x82, 0x8c, 0x42, 0x88, 0x00, 0xc6, 0x88, 0xc2, 0x00, 0x8c, 0x85, 0x96,
+		0x42, 0x88, 0x87, 0x73, 0x82, 0x00, 0xef, 0x81, 0x82, 0x42, 0x88, 0x00, 0x08, 0x85, 0x82, 0x73, 0x82, 0x00, 0x4a, 0x85, 0x82, 0x42, 0x88, 0x00,
+		0xad, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x83, 0x42, 0x88, 0x00, 0x08, 0x85, 0xc2, 0x00, 0x6b, 0x85, 0x8c, 0x42,
+		0x88, 0x00, 0x52, 0x82, 0x87, 0x73, 0x82, 0x91, 0x42, 0x88, 0x00, 0x8c, 0x85, 0xc2, 0x00, 0xc6, 0x88, 0x82, 0x42, 0x88, 0x00, 0x31, 0x82, 0xd5,
+		0x00, 0x29, 0x85, 0x8c, 0x73, 0x82, 0x00, 0x84, 0x88, 0x87, 0x42, 0x88, 0x87, 0x73, 0x82, 0x00, 0xef, 0x81, 0x8c, 0x42, 0x88, 0x00, 0xce, 0x81,
+		0x82, 0x73, 0x82, 0x00, 0xa5, 0x88, 0xc2, 0x83, 0x73, 0x82, 0x87, 0x42, 0x88, 0x00, 0xc6, 0x88, 0x87, 0x73, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x88, 0x42, 0x88, 0x00, 0xad, 0x85, 0x82, 0x73, 0x82, 0x00, 0xc6, 0x88, 0x8c, 0x42, 0x88, 0x87,
+		0x73, 0x82, 0x00, 0xce, 0x81, 0xdf, 0x00, 0x84, 0x88, 0x87, 0x73, 0x82, 0x00, 0x8c, 0x85, 0x82, 0x42, 0x88, 0x00, 0x8c, 0x85, 0xcc, 0x83, 0x73,
+		0x82, 0x87, 0x42, 0x88, 0x00, 0xc6, 0x88, 0x87, 0x73, 0x82, 0x00, 0x4a, 0x85, 0x87, 0x42, 0x88, 0x00, 0x10, 0x82, 0x82, 0x73, 0x82, 0x83, 0x42,
+		0x88, 0x82, 0x73, 0x82, 0x00, 0x52, 0x82, 0xb8, 0x42, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x63, 0x88, 0x83, 0x84,
+		0x88, 0xc7, 0x00, 0x8c, 0x85, 0x82, 0x31, 0x82, 0x00, 0xe7, 0x88, 0x87, 0x84, 0x88, 0xd1, 0x00, 0x63, 0x88, 0x82, 0x84, 0x88, 0x00, 0x8c, 0x85,
+		0x82, 0x31, 0x82, 0xc3, 0x00, 0xef, 0x81, 0x82, 0x31, 0x82, 0xc3, 0x82, 0x84, 0x88, 0x00, 0xc6, 0x88, 0x87, 0x31, 0x82, 0x00, 0x8c, 0x85, 0x82,
+		0x84, 0x88, 0x00, 0xad, 0x85, 0xd5, 0x00, 0x63, 0x88, 0x82, 0x84, 0x88, 0x00, 0xe7, 0x84, 0x82, 0x31, 0x82, 0x00, 0x52, 0x82, 0xc7, 0x83, 0x84,
+		0x88, 0x00, 0xef, 0x81, 0x82, 0x31, 0x82, 0x83, 0x84, 0x88, 0xc3, 0x88, 0x84, 0x88, 0xdf, 0x00, 0xa5, 0x88, 0x82, 0x73, 0x82, 0x00, 0xad, 0x81,
+		0x8c, 0x42, 0x88, 0x00, 0xef, 0x81, 0x87, 0x73, 0x82, 0xd1, 0x00, 0x4a, 0x85, 0x82, 0x73, 0x82, 0x00, 0x29, 0x85, 0x91, 0x42, 0x88, 0x82, 0x73,
+		0x82, 0x00, 0x31, 0x82, 0x87, 0x42, 0x88, 0x00, 0x29, 0x85, 0x8c, 0x73, 0x82, 0xcc, 0x00, 0x84, 0x88, 0x82, 0x73, 0x82, 0x00, 0xef, 0x81, 0x82,
+		0x42, 0x88, 0x00, 0x29, 0x85, 0xc7, 0x00, 0xce, 0x81, 0x82, 0x73, 0x82, 0x00, 0xa5, 0x88, 0x82, 0x42, 0x88, 0x91, 0x73, 0x82, 0x00, 0xad, 0x85,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0x82, 0xce, 0x81, 0x00, 0x8c, 0x85, 0x82, 0xe7, 0x88, 0x00, 0xa5, 0x88, 0xc2, 0x00,
+		0xa5, 0x88, 0x82, 0xe7, 0x88, 0x00, 0x10, 0x82, 0xc2, 0x00, 0xef, 0x81, 0x82, 0xce, 0x81, 0x83, 0xe7, 0x88, 0x87, 0xce, 0x81, 0x00, 0x8c, 0x85,
+		0x82, 0xe7, 0x88, 0x00, 0x8c, 0x85, 0xd1, 0x83, 0xe7, 0x88, 0x82, 0xce, 0x81, 0x00, 0xad, 0x81, 0x82, 0xe7, 0x88, 0x00, 0xc6, 0x88, 0xcc, 0x00,
+		0x10, 0x82, 0x82, 0xce, 0x81, 0xc3, 0x83, 0xce, 0x81, 0xcc, 0x00, 0xe7, 0x88, 0x82, 0xce, 0x81, 0x00, 0x08, 0x85, 0xc7, 0x00, 0x29, 0x85, 0x82,
+		0xe7, 0x88, 0x91, 0xce, 0x81, 0x00, 0x8c, 0x85, 0x82, 0xe7, 0x88, 0x00, 0xa5, 0x88, 0x9f, 0x42, 0x88, 0x00, 0x08, 0x85, 0x82, 0x73, 0x82, 0x00,
+		0x6b, 0x85, 0xc2, 0x00, 0xad, 0x85, 0x87, 0x73, 0x82, 0x00, 0x63, 0x88, 0x82, 0x42, 0x88, 0x83, 0x73, 0x82, 0x87, 0x42, 0x88, 0x00, 0xe7, 0x84,
+		0x87, 0x73, 0x82, 0xcd, 0x83, 0x73, 0x82, 0x82, 0x42, 0x88, 0x00, 0x84, 0x88, 0x82, 0x73, 0x82, 0x00, 0xce, 0x81, 0xcc, 0x00, 0xe7, 0x88, 0x90,
+		0x42, 0x88, 0xc8, 0x88, 0x42, 0x88, 0xc3, 0x83, 0x73, 0x82, 0x91, 0x42, 0x88, 0x00, 0x08, 0x85, 0x82, 0x73, 0x82, 0x00, 0x4a, 0x85, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x00, 0x84, 0x88, 0x82, 0x29, 0x85, 0x00, 0xad, 0x85, 0xc2, 0x00, 0xce, 0x81, 0x82, 0x29, 0x85,
+		0x00, 0x6b, 0x85, 0x87, 0x8c, 0x85, 0x00, 0x4a, 0x85, 0x82, 0x29, 0x85, 0xc3, 0x87, 0x29, 0x85, 0x00, 0x8c, 0x85, 0xcc, 0x00, 0x08, 0x85, 0x82,
+		0x29, 0x85, 0x00, 0x63, 0x88, 0xc2, 0x83, 0x8c, 0x85, 0x82, 0x29, 0x85, 0x00, 0x4a, 0x85, 0x82, 0x8c, 0x85, 0x00, 0x29, 0x85, 0xc2, 0x00, 0xc6,
+		0x88, 0x82, 0x8c, 0x85, 0x00, 0x10, 0x82, 0xc2, 0x00, 0x8c, 0x85, 0x90, 0x29, 0x85, 0x00, 0x4a, 0x85, 0x82, 0x8c, 0x85, 0x00, 0x6b, 0x85, 0x87,
+		0x29, 0x85, 0x00, 0xa5, 0x88, 0xc2, 0x00, 0x29, 0x85, 0x87, 0x8c, 0x85, 0x88, 0x29, 0x85, 0xd1, 0x00, 0xe7, 0x88, 0x82, 0x29, 0x85, 0x00, 0x84,
+		0x88, 0xd0, 0x00, 0xa5, 0x88, 0x8c, 0x73, 0x82, 0x00, 0x08, 0x85, 0x87, 0x42, 0x88, 0x00, 0x52, 0x82, 0x9a, 0x73, 0x82, 0xc3, 0x00, 0xef, 0x81,
+		0x82, 0x73, 0x82, 0x00, 0x84, 0x88, 0x87, 0x42, 0x88, 0x82, 0x73, 0x82, 0x00, 0x31, 0x82, 0x8c, 0x42, 0x88, 0x00, 0x8c, 0x85, 0x95, 0x73, 0x82,
+		0x00, 0x31, 0x82, 0x82, 0x42, 0x88, 0x00, 0xc6, 0x88, 0x87, 0x73, 0x82, 0x00, 0x4a, 0x85, 0x8c, 0x42, 0x88, 0x87, 0x73, 0x82, 0x00, 0x52, 0x82,
+		0xd1, 0x00, 0xad, 0x81, 0x82, 0x73, 0x82, 0x00, 0xa5, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x00, 0xce, 0x81, 0x82,
+		0x29, 0x85, 0x00, 0x6b, 0x85, 0x82, 0x8c, 0x85, 0x00, 0x84, 0x88, 0xc2, 0x83, 0x29, 0x85, 0xc3, 0x87, 0x29, 0x85, 0x00, 0x8c, 0x85, 0xc2, 0x00,
+		0xef, 0x81, 0x82, 0x29, 0x85, 0x00, 0x6b, 0x85, 0x82, 0x8c, 0x85, 0x00, 0x31, 0x82, 0xc7, 0x83, 0x8c, 0x85, 0xdb, 0x00, 0x6b, 0x85, 0x8c, 0x29,
+		0x85, 0xc2, 0x00, 0x84, 0x88, 0x87, 0x29, 0x85, 0x00, 0x6b, 0x85, 0x8c, 0x8c, 0x85, 0x87, 0x29, 0x85, 0x00, 0x4a, 0x85, 0x87, 0x8c, 0x85, 0x00,
+		0xce, 0x81, 0xc7, 0x00, 0xe7, 0x88, 0x82, 0x29, 0x85, 0x00, 0x84, 0x88, 0xda, 0x00, 0x6b, 0x85, 0x82, 0x42, 0x88, 0x00, 0xad, 0x85, 0x82, 0x73,
+		0x82, 0x00, 0xc6, 0x88, 0x87, 0x42, 0x88, 0xc3, 0x87, 0x42, 0x88, 0x00, 0xe7, 0x84, 0xc2, 0x00, 0x6b, 0x85, 0x82, 0x42, 0x88, 0x00, 0x8c, 0x85,
+		0x87, 0x73, 0x82, 0xc3, 0x87, 0x73, 0x82, 0xd7, 0x00, 0x84, 0x88, 0x9a, 0x42, 0x88, 0x00, 0x6b, 0x85, 0x8c, 0x73, 0x82, 0x87, 0x42, 0x88, 0x00,
+		0x63, 0x88, 0x8c, 0x73, 0x82, 0xc3, 0x96, 0x42, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x00, 0xef, 0x81, 0x82, 0xe7,
+		0x88, 0x00, 0x4a, 0x85, 0x82, 0xce, 0x81, 0x00, 0x31, 0x82, 0xc7, 0x83, 0xce, 0x81, 0x83, 0xe7, 0x88, 0x82, 0xce, 0x81, 0x00, 0xad, 0x85, 0xc2,
+		0x00, 0x84, 0x88, 0x82, 0xe7, 0x88, 0x00, 0xa5, 0x88, 0xc7, 0x00, 0x4a, 0x85, 0x82, 0xe7, 0x88, 0x00, 0x63, 0x88, 0xcb, 0x00, 0x52, 0x82, 0x8c,
+		0xce, 0x81, 0x00, 0x4a, 0x85, 0x82, 0xe7, 0x88, 0x00, 0x10, 0x82, 0xcc, 0x82, 0xce, 0x81, 0x00, 0xad, 0x81, 0xc7, 0x00, 0xe7, 0x88, 0x82, 0xce,
+		0x81, 0x00, 0x31, 0x82, 0xc7, 0x00, 0x29, 0x85, 0x82, 0xe7, 0x88, 0x83, 0xce, 0x81, 0xcc, 0x00, 0xef, 0x81, 0x82, 0xe7, 0x88, 0x00, 0xa5, 0x88,
+		0xc2, 0x00, 0x4a, 0x85, 0x82, 0xce, 0x81, 0x00, 0xa5, 0x88, 0xd5, 0x00, 0xad, 0x81, 0x82, 0x42, 0x88, 0x00, 0x4a, 0x85, 0x87, 0x73, 0x82, 0xc3,
+		0x00, 0x52, 0x82, 0x82, 0x73, 0x82, 0x83, 0x42, 0x88, 0x82, 0x73, 0x82, 0x00, 0x10, 0x82, 0x8c, 0x42, 0x88, 0xc3, 0x00, 0xc6, 0x88, 0x87, 0x42,
+		0x88, 0x96, 0x73, 0x82, 0x00, 0x29, 0x85, 0x82, 0x42, 0x88, 0x00, 0xce, 0x81, 0xcc, 0x82, 0x73, 0x82, 0x00, 0x31, 0x82, 0xc7, 0x00, 0x29, 0x85,
+		0x8c, 0x73, 0x82, 0x00, 0xa5, 0x88, 0x82, 0x42, 0x88, 0x83, 0x73, 0x82, 0xcc, 0x00, 0xad, 0x85, 0x87, 0x42, 0x88, 0x00, 0xad, 0x81, 0x82, 0x73,
+		0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x63, 0x88, 0x82, 0x84, 0x88, 0x00, 0x29, 0x85, 0x82, 0x31, 0x82, 0x00,
+		0x6b, 0x85, 0x87, 0x84, 0x88, 0x00, 0xce, 0x81, 0x82, 0x31, 0x82, 0x83, 0x73, 0x82, 0x83, 0x31, 0x82, 0xc7, 0x00, 0xe7, 0x88, 0x82, 0x31, 0x82,
+		0x00, 0x4a, 0x85, 0xc2, 0x83, 0x84, 0x88, 0x00, 0x63, 0x88, 0xc2, 0x00, 0xef, 0x81, 0x82, 0x31, 0x82, 0xd1, 0x00, 0xad, 0x85, 0x82, 0x84, 0x88,
+		0x00, 0x63, 0x88, 0xc2, 0x83, 0x84, 0x88, 0x00, 0xef, 0x81, 0x82, 0x31, 0x82, 0xc7, 0x00, 0x73, 0x82, 0x82, 0x31, 0x82, 0x00, 0xad, 0x81, 0xc7,
+		0x00, 0x6b, 0x85, 0x87, 0x84, 0x88, 0x00, 0xef, 0x81, 0x82, 0x31, 0x82, 0x83, 0x84, 0x88, 0xee, 0x83, 0x42, 0x88, 0x00, 0x08, 0x85, 0x82, 0x73,
+		0x82, 0x00, 0x6b, 0x85, 0x87, 0x42, 0x88, 0x00, 0xef, 0x81, 0x90, 0x73, 0x82, 0xc3, 0x00, 0xe7, 0x84, 0x82, 0x73, 0x82, 0x00, 0x6b, 0x85, 0x8c,
+		0x42, 0x88, 0x00, 0x31, 0x82, 0x95, 0x73, 0x82, 0x00, 0x8c, 0x85, 0x8c, 0x42, 0x88, 0x00, 0x31, 0x82, 0x82, 0x73, 0x82, 0xc8, 0x82, 0x73, 0x82,
+		0x00, 0xef, 0x81, 0xc7, 0x00, 0x4a, 0x85, 0x87, 0x42, 0x88, 0x00, 0x10, 0x82, 0x82, 0x73, 0x82, 0x87, 0x42, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0x73, 0x82, 0x00, 0x08, 0x85, 0xc7, 0x00, 0x63, 0x88, 0x87, 0x42, 0x88, 0xc7, 0x8d, 0x42, 0x88, 0x00, 0xef,
+		0x81, 0x82, 0x73, 0x82, 0x00, 0x84, 0x88, 0x87, 0x42, 0x88, 0x91, 0x73, 0x82, 0x00, 0x29, 0x85, 0x8c, 0x42, 0x88, 0x83, 0x73, 0x82, 0x8c, 0x42,
+		0x88, 0xc3, 0x83, 0x73, 0x82, 0x00, 0xe7, 0x84, 0xc7, 0x91, 0x73, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xf9, 0x88, 0x42, 0x88, 0x00, 0xad, 0x85, 0x91, 0x73, 0x82, 0x82, 0x42, 0x88, 0x00, 0xa5, 0x88, 0x87, 0x73, 0x82, 0x00, 0x6b, 0x85, 0xda, 0x00,
+		0x31, 0x82, 0x82, 0x42, 0x88, 0x00, 0xe7, 0x88, 0xc2, 0x00, 0x8c, 0x85, 0x87, 0x42, 0x88, 0x00, 0xce, 0x81, 0x87, 0x73, 0x82, 0x83, 0x42, 0x88,
+		0x87, 0x73, 0x82, 0x00, 0xef, 0x81, 0xcc, 0x88, 0x73, 0x82, 0x83, 0x42, 0x88, 0xc7, 0x00, 0xef, 0x81, 0x82, 0x42, 0x88, 0x00, 0x08, 0x85, 0x8c,
+		0x73, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x63, 0x88, 0x8c, 0x84, 0x88, 0x00, 0xad, 0x81, 0xd1, 0x82, 0x84,
+		0x88, 0x00, 0xc6, 0x88, 0xc2, 0x00, 0x52, 0x82, 0x82, 0x31, 0x82, 0x00, 0x6b, 0x85, 0x87, 0x84, 0x88, 0xc8, 0x83, 0x84, 0x88, 0x82, 0x31, 0x82,
+		0x00, 0xef, 0x81, 0xcc, 0x00, 0x63, 0x88, 0x82, 0x84, 0x88, 0x00, 0xce, 0x81, 0x87, 0x31, 0x82, 0x83, 0x84, 0x88, 0xc8, 0x82, 0x84, 0x88, 0x00,
+		0x4a, 0x85, 0xc2, 0x00, 0x52, 0x82, 0x8c, 0x31, 0x82, 0x83, 0x84, 0x88, 0x82, 0x31, 0x82, 0x00, 0x52, 0x82, 0xc2, 0x00, 0x10, 0x82, 0x82, 0x84,
+		0x88, 0x00, 0x29, 0x85, 0x87, 0x31, 0x82, 0x00, 0x52, 0x82, 0xd5, 0x00, 0xa5, 0x88, 0xa9, 0x73, 0x82, 0x00, 0xce, 0x81, 0x82, 0x42, 0x88, 0x00,
+		0x4a, 0x85, 0x8c, 0x73, 0x82, 0xc3, 0x83, 0x73, 0x82, 0x87, 0x42, 0x88, 0xc8, 0x00, 0x8c, 0x85, 0x82, 0x73, 0x82, 0x00, 0xe7, 0x88, 0x87, 0x42,
+		0x88, 0x96, 0x73, 0x82, 0x00, 0x4a, 0x85, 0x8c, 0x42, 0x88, 0x83, 0x73, 0x82, 0x82, 0x42, 0x88, 0x00, 0x63, 0x88, 0x87, 0x73, 0x82, 0x00, 0xad,
+		0x85, 0x87, 0x42, 0x88, 0x00, 0xad, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x87, 0xef, 0x81, 0x00, 0x31, 0x82, 0xc7,
+		0x00, 0x10, 0x82, 0x82, 0xef, 0x81, 0xcc, 0x00, 0x52, 0x82, 0x82, 0xef, 0x81, 0x00, 0x8c, 0x85, 0x82, 0xc6, 0x88, 0x00, 0x4a, 0x85, 0x82, 0xef,
+		0x81, 0x00, 0x31, 0x82, 0xc2, 0x00, 0x10, 0x82, 0x82, 0xef, 0x81, 0x00, 0xe7, 0x88, 0x82, 0xc6, 0x88, 0x83, 0xef, 0x81, 0xc2, 0x00, 0x63, 0x88,
+		0x82, 0xc6, 0x88, 0x00, 0x29, 0x85, 0x82, 0xef, 0x81, 0x00, 0x4a, 0x85, 0xc2, 0x00, 0x4a, 0x85, 0x82, 0xef, 0x81, 0x00, 0xc6, 0x88, 0xc2, 0x83,
+		0xc6, 0x88, 0x8c, 0xef, 0x81, 0x00, 0x10, 0x82, 0xc2, 0x00, 0x31, 0x82, 0x82, 0xef, 0x81, 0x00, 0x4a, 0x85, 0x87, 0xc6, 0x88, 0x00, 0x63, 0x88,
+		0xc2, 0x83, 0xef, 0x81, 0xc3, 0x82, 0xef, 0x81, 0x00, 0x10, 0x82, 0xe4, 0x88, 0x42, 0x88, 0x00, 0x4a, 0x85, 0xc7, 0x00, 0xc6, 0x88, 0x82, 0x42,
+		0x88, 0x00, 0x52, 0x82, 0xcb, 0x00, 0x10, 0x82, 0x82, 0x42, 0x88, 0x00, 0xe7, 0x84, 0x82, 0x73, 0x82, 0x00, 0x6b, 0x85, 0x82, 0x42, 0x88, 0x00,
+		0x8c, 0x85, 0xc2, 0x00, 0xc6, 0x88, 0x82, 0x42, 0x88, 0x00, 0x31, 0x82, 0x82, 0x73, 0x82, 0x87, 0x42, 0x88, 0x00, 0x84, 0x88, 0x82, 0x73, 0x82,
+		0x00, 0xce, 0x81, 0x91, 0x42, 0x88, 0x00, 0x31, 0x82, 0x82, 0x73, 0x82, 0x8c, 0x42, 0x88, 0x00, 0xc6, 0x88, 0xc2, 0x00, 0x8c, 0x85, 0x82, 0x42,
+		0x88, 0x00, 0x6b, 0x85, 0x87, 0x73, 0x82, 0x00, 0xa5, 0x88, 0x90, 0x42, 0x88, 0x00, 0xc6, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xcb, 0x8d, 0x8c, 0x85, 0x82, 0x29, 0x85, 0x00, 0x4a, 0x85, 0x82, 0x8c, 0x85, 0x00, 0x6b, 0x85, 0x82, 0x29, 0x85, 0x00, 0xef, 0x81,
+		0xcc, 0x87, 0x29, 0x85, 0x00, 0x4a, 0x85, 0xc7, 0x00, 0xa5, 0x88, 0x87, 0x29, 0x85, 0x00, 0x84, 0x88, 0xc7, 0x87, 0x29, 0x85, 0x00, 0x08, 0x85,
+		0xc2, 0x00, 0xa5, 0x88, 0x82, 0x8c, 0x85, 0x00, 0x6b, 0x85, 0x82, 0x29, 0x85, 0x00, 0xce, 0x81, 0xcc, 0x83, 0x29, 0x85, 0xc7, 0x00, 0x84, 0x88,
+		0x82, 0x8c, 0x85, 0x00, 0x6b, 0x85, 0x82, 0x29, 0x85, 0x00, 0xa5, 0x88, 0xf3, 0x8c, 0x42, 0x88, 0x00, 0xa5, 0x88, 0x82, 0x73, 0x82, 0x00, 0xce,
+		0x81, 0x82, 0x42, 0x88, 0x00, 0x4a, 0x85, 0x87, 0x73, 0x82, 0xc8, 0x8c, 0x73, 0x82, 0xc3, 0x00, 0x29, 0x85, 0x87, 0x73, 0x82, 0x00, 0xe7, 0x88,
+		0xc7, 0x87, 0x73, 0x82, 0x00, 0x31, 0x82, 0x87, 0x42, 0x88, 0x00, 0x29, 0x85, 0x8c, 0x73, 0x82, 0xc3, 0x83, 0x73, 0x82, 0x8c, 0x42, 0x88, 0x00,
+		0x08, 0x85, 0x82, 0x73, 0x82, 0x00, 0x4a, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x00, 0xa5, 0x88, 0x83, 0x6b, 0x85,
+		0x82, 0x4a, 0x85, 0x00, 0x10, 0x82, 0xc7, 0x83, 0x6b, 0x85, 0xe0, 0x00, 0x29, 0x85, 0x87, 0x4a, 0x85, 0xc7, 0x00, 0x31, 0x82, 0x82, 0x6b, 0x85,
+		0x00, 0xef, 0x81, 0xc2, 0x00, 0xce, 0x81, 0x82, 0x4a, 0x85, 0x83, 0x6b, 0x85, 0x00, 0x52, 0x82, 0xc2, 0x83, 0x4a, 0x85, 0xc2, 0x00, 0x52, 0x82,
+		0x82, 0x6b, 0x85, 0x00, 0x29, 0x85, 0xc2, 0x00, 0xa5, 0x88, 0x87, 0x4a, 0x85, 0x00, 0x10, 0x82, 0xc2, 0x00, 0xad, 0x85, 0x82, 0x6b, 0x85, 0x83,
+		0x4a, 0x85, 0x8c, 0x6b, 0x85, 0x00, 0xce, 0x81, 0xc2, 0x00, 0xef, 0x81, 0x82, 0x6b, 0x85, 0x00, 0x10, 0x82, 0xda, 0x00, 0x08, 0x85, 0x82, 0x73,
+		0x82, 0x00, 0x6b, 0x85, 0x82, 0x42, 0x88, 0x00, 0xad, 0x85, 0xc7, 0x00, 0x52, 0x82, 0x82, 0x73, 0x82, 0xe0, 0x88, 0x42, 0x88, 0x91, 0x73, 0x82,
+		0x00, 0x29, 0x85, 0x82, 0x42, 0x88, 0x00, 0xce, 0x81, 0x87, 0x73, 0x82, 0x83, 0x42, 0x88, 0x87, 0x73, 0x82, 0x00, 0xef, 0x81, 0x8c, 0x42, 0x88,
+		0x00, 0xce, 0x81, 0x87, 0x73, 0x82, 0x83, 0x42, 0x88, 0x9b, 0x73, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x84,
+		0x88, 0x82, 0xce, 0x81, 0x00, 0x10, 0x82, 0xd1, 0x00, 0xe7, 0x88, 0x82, 0xe7, 0x84, 0x83, 0xce, 0x81, 0xd1, 0x00, 0x8c, 0x85, 0x82, 0xe7, 0x84,
+		0x00, 0x8c, 0x85, 0x8c, 0xce, 0x81, 0xc2, 0x00, 0x52, 0x82, 0x87, 0xe7, 0x84, 0x00, 0x8c, 0x85, 0xc2, 0x00, 0x10, 0x82, 0x82, 0xce, 0x81, 0x00,
+		0x52, 0x82, 0xd0, 0x00, 0x52, 0x82, 0x82, 0xe7, 0x84, 0x00, 0xc6, 0x88, 0xc2, 0x00, 0xe7, 0x88, 0x87, 0xce, 0x81, 0x00, 0x29, 0x85, 0x82, 0xe7,
+		0x84, 0x00, 0x31, 0x82, 0xc2, 0x83, 0xce, 0x81, 0xc2, 0x00, 0x52, 0x82, 0x82, 0xe7, 0x84, 0x00, 0x4a, 0x85, 0xc7, 0x00, 0xad, 0x85, 0x82, 0xe7,
+		0x84, 0x00, 0xef, 0x81, 0xd5, 0x00, 0xa5, 0x88, 0x87, 0x73, 0x82, 0xcd, 0x83, 0x42, 0x88, 0x83, 0x73, 0x82, 0xd1, 0x00, 0x29, 0x85, 0x82, 0x42,
+		0x88, 0x00, 0xef, 0x81, 0x90, 0x73, 0x82, 0x00, 0x31, 0x82, 0x87, 0x42, 0x88, 0x00, 0x29, 0x85, 0x91, 0x73, 0x82, 0xc7, 0x00, 0x31, 0x82, 0x87,
+		0x42, 0x88, 0x00, 0x29, 0x85, 0x87, 0x73, 0x82, 0x00, 0xe7, 0x84, 0x82, 0x42, 0x88, 0x00, 0x10, 0x82, 0x8b, 0x73, 0x82, 0x00, 0x52, 0x82, 0x82,
+		0x42, 0x88, 0x00, 0xc6, 0x88, 0xc7, 0x00, 0x4a, 0x85, 0x82, 0x42, 0x88, 0x00, 0xad, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xe4, 0x00, 0x63, 0x88, 0x87, 0xa5, 0x88, 0x00, 0x84, 0x88, 0xc2, 0x00, 0x84, 0x88, 0x82, 0xa5, 0x88, 0x00, 0x63, 0x88, 0xc7, 0x83, 0xa5, 0x88,
+		0xc2, 0x00, 0x63, 0x88, 0x82, 0xa5, 0x88, 0x00, 0x08, 0x85, 0x82, 0x10, 0x82, 0x00, 0x52, 0x82, 0xd1, 0x88, 0xa5, 0x88, 0xc7, 0x00, 0x63, 0x88,
+		0x82, 0xa5, 0x88, 0x00, 0xad, 0x85, 0xc7, 0x00, 0xe7, 0x88, 0x82, 0xa5, 0x88, 0x83, 0x10, 0x82, 0xc2, 0x00, 0x73, 0x82, 0x82, 0x10, 0x82, 0x00,
+		0xad, 0x85, 0xcc, 0x00, 0x31, 0x82, 0x82, 0x10, 0x82, 0x00, 0xe7, 0x88, 0x8c, 0xa5, 0x88, 0xc2, 0x00, 0x63, 0x88, 0x87, 0xa5, 0x88, 0x00, 0x84,
+		0x88, 0xc2, 0x00, 0x84, 0x88, 0x82, 0xa5, 0x88, 0x00, 0x63, 0x88, 0xbc, 0x42, 0x88, 0x00, 0xe7, 0x84, 0x87, 0x73, 0x82, 0xcd, 0x96, 0x42, 0x88,
+		0x00, 0x8c, 0x85, 0xc7, 0x00, 0x84, 0x88, 0x82, 0x42, 0x88, 0x8c, 0x73, 0x82, 0x00, 0xef, 0x81, 0xcc, 0x83, 0x73, 0x82, 0x00, 0xa5, 0x88, 0xbf,
+		0x42, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0x00, 0xa5, 0x88, 0xa0, 0x73, 0x82, 0xc2, 0x00, 0xa5, 0x88, 0x82, 0x73,
+		0x82, 0x00, 0xce, 0x81, 0x82, 0x42, 0x88, 0x00, 0x4a, 0x85, 0xcc, 0x00, 0x84, 0x88, 0x82, 0x42, 0x88, 0x83, 0x73, 0x82, 0xc2, 0x00, 0x84, 0x88,
+		0x82, 0x73, 0x82, 0x00, 0xce, 0x81, 0xc2, 0x00, 0x29, 0x85, 0x82, 0x73, 0x82, 0x00, 0x29, 0x85, 0x82, 0x42, 0x88, 0x00, 0xce, 0x81, 0xcc, 0x82,
+		0x42, 0x88, 0x00, 0x84, 0x88, 0xcc, 0x00, 0x4a, 0x85, 0x82, 0x42, 0x88, 0x00, 0xce, 0x81, 0xc7, 0xa0, 0x73, 0x82, 0x00, 0xa5, 0x88, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x01, 0x10, 0x82, 0x08, 0x85, 0x94, 0xe7, 0x88, 0x00, 0x4a, 0x85, 0xd6, 0x83,
+		0x73, 0x82, 0x00, 0xc6, 0x88, 0x87, 0x42, 0x88, 0xcc, 0x88, 0x73, 0x82, 0xc3, 0x83, 0x42, 0x88, 0x00, 0x31, 0x82, 0x82, 0x73, 0x82, 0x96, 0x42,
+		0x88, 0x00, 0x6b, 0x85, 0x82, 0x73, 0x82, 0x00, 0xe7, 0x84, 0x87, 0x42, 0x88, 0xc3, 0x00, 0x4a, 0x85, 0x94, 0xe7, 0x88, 0x01, 0x08, 0x85, 0x10,
+		0x82, 0xda, 0x01, 0xef, 0x81, 0x84, 0x88, 0x94, 0x42, 0x88, 0x00, 0xe7, 0x88, 0xff, 0xf7, 0x00, 0xe7, 0x88, 0x94, 0x42, 0x88, 0x01, 0x84, 0x88,
+		0xef, 0x81, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x8d, 0x63, 0x88, 0xd2, 0x82, 0x63, 0x88, 0x00, 0x4a, 0x85, 0x87, 0x52, 0x82, 0x00, 0xe7,
+		0x88, 0x82, 0x63, 0x88, 0xc3, 0x83, 0x52, 0x82, 0xcc, 0x83, 0x52, 0x82, 0x00, 0x4a, 0x85, 0x87, 0x63, 0x88, 0xcd, 0x83, 0x63, 0x88, 0xc8, 0x82,
+		0x52, 0x82, 0x00, 0xe7, 0x88, 0xd1, 0x8d, 0x63, 0x88, 0xe4, 0x00, 0x4a, 0x85, 0x8c, 0x73, 0x82, 0x00, 0x63, 0x88, 0xd0, 0x83, 0x73, 0x82, 0x00,
+		0x6b, 0x85, 0x87, 0x42, 0x88, 0x00, 0xef, 0x81, 0x82, 0x73, 0x82, 0x00, 0x84, 0x88, 0x8b, 0x42, 0x88, 0xc8, 0x00, 0x8c, 0x85, 0x82, 0x42, 0x88,
+		0x00, 0x8c, 0x85, 0x8c, 0x73, 0x82, 0xc7, 0x00, 0x84, 0x88, 0x82, 0x73, 0x82, 0x00, 0xef, 0x81, 0x96, 0x42, 0x88, 0xc7, 0x00, 0x63, 0x88, 0x8c,
+		0x73, 0x82, 0x00, 0x4a, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x00, 0x84, 0x88, 0x87, 0xef, 0x81, 0x00, 0x6b,
+		0x85, 0x87, 0xc6, 0x88, 0x00, 0x10, 0x82, 0xc7, 0x83, 0xc6, 0x88, 0xc3, 0x82, 0xef, 0x81, 0x00, 0x10, 0x82, 0xc7, 0x00, 0x4a, 0x85, 0x82, 0xef,
+		0x81, 0x00, 0x52, 0x82, 0xc7, 0x83, 0xc6, 0x88, 0xc3, 0x82, 0xef, 0x81, 0x00, 0xad, 0x85, 0x91, 0xc6, 0x88, 0x00, 0x63, 0x88, 0xff, 0xdd, 0x88,
+		0x42, 0x88, 0x00, 0x4a, 0x85, 0x8c, 0x73, 0x82, 0xc3, 0x83, 0x73, 0x82, 0x87, 0x42, 0x88, 0x00, 0xe7, 0x88, 0xc7, 0x83, 0x42, 0x88, 0x00, 0xce,
+		0x81, 0x8c, 0x73, 0x82, 0x87, 0x42, 0x88, 0x00, 0xc6, 0x88, 0x91, 0x73, 0x82, 0x00, 0xa5, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xf1, 0x00, 0x84, 0x88, 0x82, 0x08, 0x85, 0x00, 0xad, 0x85, 0xc7, 0x00, 0xce, 0x81, 0x82, 0xad, 0x85, 0x00, 0x29, 0x85, 0x82, 0x08,
+		0x85, 0x83, 0xad, 0x85, 0xcc, 0x00, 0xce, 0x81, 0x82, 0x08, 0x85, 0x00, 0xa5, 0x88, 0xd1, 0x87, 0x08, 0x85, 0x00, 0x6b, 0x85, 0xc7, 0x00, 0x10,
+		0x82, 0x87, 0xad, 0x85, 0x00, 0x84, 0x88, 0xff, 0xe2, 0x00, 0xe7, 0x84, 0x8c, 0x73, 0x82, 0x00, 0xc6, 0x88, 0x82, 0x42, 0x88, 0x00, 0x31, 0x82,
+		0x82, 0x73, 0x82, 0x8c, 0x42, 0x88, 0xc3, 0x83, 0x73, 0x82, 0x00, 0x29, 0x85, 0xd1, 0x91, 0x73, 0x82, 0x00, 0x4a, 0x85, 0x8c, 0x42, 0x88, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0x00, 0xc6, 0x88, 0x8c, 0x4a, 0x85, 0xd1, 0x00, 0xa5, 0x88, 0x82, 0x4a, 0x85, 0x00,
+		0xce, 0x81, 0xc2, 0x00, 0xce, 0x81, 0x82, 0x4a, 0x85, 0x83, 0x6b, 0x85, 0x00, 0x52, 0x82, 0xc2, 0x8d, 0x6b, 0x85, 0x82, 0x4a, 0x85, 0x00, 0xce,
+		0x81, 0xc7, 0x00, 0x08, 0x85, 0x9a, 0x4a, 0x85, 0x00, 0xce, 0x81, 0xc7, 0x00, 0x08, 0x85, 0x82, 0x6b, 0x85, 0x00, 0x84, 0x88, 0xcc, 0x8c, 0x4a,
+		0x85, 0x00, 0xc6, 0x88, 0xe4, 0x91, 0x42, 0x88, 0xcd, 0x83, 0x42, 0x88, 0x00, 0x4a, 0x85, 0xc2, 0x00, 0x29, 0x85, 0x82, 0x42, 0x88, 0x00, 0xef,
+		0x81, 0x95, 0x73, 0x82, 0x00, 0xce, 0x81, 0x82, 0x42, 0x88, 0x00, 0x29, 0x85, 0xc7, 0x9b, 0x42, 0x88, 0x00, 0x29, 0x85, 0xc7, 0x00, 0xce, 0x81,
+		0x82, 0x73, 0x82, 0x00, 0xa5, 0x88, 0xcb, 0x91, 0x42, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x01, 0x10, 0x82, 0xc6, 0x88, 0x94, 0x84,
+		0x88, 0x00, 0x08, 0x85, 0xff, 0xf7, 0x00, 0x08, 0x85, 0x94, 0x84, 0x88, 0x01, 0xc6, 0x88, 0x10, 0x82, 0xda, 0x01, 0x52, 0x82, 0x10, 0x82, 0x94,
+		0xef, 0x81, 0x00, 0x10, 0x82, 0xc7, 0x00, 0x84, 0x88, 0x82, 0xad, 0x81, 0x00, 0x4a, 0x85, 0xcc, 0x00, 0xe7, 0x88, 0x87, 0x08, 0x85, 0xc3, 0x82,
+		0x08, 0x85, 0x00, 0x29, 0x85, 0xc2, 0x00, 0x31, 0x82, 0x82, 0xad, 0x81, 0x00, 0x6b, 0x85, 0x82, 0x08, 0x85, 0x00, 0x6b, 0x85, 0x82, 0xad, 0x81,
+		0x00, 0xa5, 0x88, 0xc2, 0x00, 0x8c, 0x85, 0x8b, 0xad, 0x81, 0x00, 0x8c, 0x85, 0xc7, 0x00, 0xa5, 0x88, 0x82, 0x08, 0x85, 0x00, 0x6b, 0x85, 0x82,
+		0xad, 0x81, 0x00, 0x31, 0x82, 0xcc, 0x00, 0x10, 0x82, 0x94, 0xef, 0x81, 0x01, 0x10, 0x82, 0x52, 0x82, 0xda, 0x9c, 0x73, 0x82, 0xc2, 0x00, 0xa5,
+		0x88, 0x82, 0x73, 0x82, 0x00, 0xce, 0x81, 0xcc, 0x88, 0x42, 0x88, 0xc3, 0x82, 0x42, 0x88, 0x00, 0x84, 0x88, 0x87, 0x73, 0x82, 0x00, 0x8c, 0x85,
+		0x82, 0x42, 0x88, 0x00, 0x8c, 0x85, 0x82, 0x73, 0x82, 0x00, 0xe7, 0x88, 0xc2, 0x00, 0x31, 0x82, 0x8b, 0x73, 0x82, 0x00, 0x31, 0x82, 0x8c, 0x42,
+		0x88, 0x00, 0x6b, 0x85, 0x87, 0x73, 0x82, 0xc8, 0x9b, 0x73, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x63, 0x88,
+		0xa0, 0xa5, 0x88, 0xc2, 0x00, 0x63, 0x88, 0x82, 0xa5, 0x88, 0x00, 0x84, 0x88, 0xc2, 0x00, 0x84, 0x88, 0x82, 0xa5, 0x88, 0x00, 0x84, 0x88, 0xcc,
+		0x83, 0xa5, 0x88, 0xc2, 0x00, 0x63, 0x88, 0x87, 0xa5, 0x88, 0x00, 0x84, 0x88, 0xc2, 0x00, 0x84, 0x88, 0x82, 0xa5, 0x88, 0x00, 0x63, 0x88, 0xc2,
+		0x8d, 0xa5, 0x88, 0xcc, 0x00, 0x84, 0x88, 0x87, 0xa5, 0x88, 0x00, 0x63, 0x88, 0xc2, 0xa0, 0xa5, 0x88, 0x00, 0x63, 0x88, 0xbf, 0x42, 0x88, 0xbf,
+		0x42, 0x88, 0xbf, 0x42, 0x88, 0xbf, 0x42, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
 		};
 /********************************************************************************
  * Global Variables
  *******************************************************************************/
-image_info_t taraz_logo_info = { .width = 574, .height = 56, .pixelFormat = LTDC_PIXEL_FORMAT_ARGB8888, .data = (uint8_t*)Taraz_Logo };
-image_info_t bsp_docs_QR_info = { .width = 200, .height = 200, .pixelFormat = LTDC_PIXEL_FORMAT_ARGB1555, .data = (uint8_t*)BSP_Docs_QR };
+image_info_t taraz_logo_info = { .width = 574, .height = 56, .pixelFormat = LTDC_PIXEL_FORMAT_ARGB8888, .data = Taraz_Logo, .compression = IMAGE_COMPRESSED_RLE, .dataSize = sizeof(Taraz_Logo) };
+image_info_t bsp_docs_QR_info = { .width = 200, .height = 200, .pixelFormat = LTDC_PIXEL_FORMAT_ARGB1555, .data = BSP_Docs_QR, .compression = IMAGE_COMPRESSED_RLE, .dataSize = sizeof(BSP_Docs_QR) };
 /********************************************************************************
  * Function Prototypes
  *******************************************************************************/
@@ -42,6 +42,7 @@ extern "C" {
  * Includes
  *******************************************************************************/
 #include "general_header.h"
+#include "error_config.h"
 /********************************************************************************
  * Defines
  *******************************************************************************/
@@ -49,9 +50,50 @@ extern "C" {
 #define SYS_IMGS_BASE_ADDRESS					(0x08020000)
 // Make sure that the images are in the correct order
 //#define BASE_ADDRESS							(const uint8_t*)(0x08020000)
+/** @defgroup IMGS_Exported_Macros Macros
+ * @{
+ */
+#ifndef IMAGE_CACHE_SIZE
+/**
+ * @brief Size of the RAM holding the decoded images in bytes.
+ * @details The cache is placed after the frame buffer in the AXI SRAM, so the LTDC reads the decoded images without
+ * stalling the flash accesses of the CM7 core. It should hold the largest compressed image.
+ */
+#define IMAGE_CACHE_SIZE						(128 * 1024)
+#endif
+#ifndef IMAGE_CACHE_ENTRIES
+/**
+ * @brief Maximum number of decoded images held in the cache at the same time
+ */
+#define IMAGE_CACHE_ENTRIES						(4)
+#endif
+/**
+ * @}
+ */
 /********************************************************************************
  * Typedefs
  *******************************************************************************/
+/** @defgroup IMGS_Exported_Typedefs Type Definitions
+ * @{
+ */
+/**
+ * @brief Storage format of the image data
+ */
+typedef enum
+{
+	IMAGE_UNCOMPRESSED,		/**< The data holds the pixels in the specified format, row by row */
+	IMAGE_COMPRESSED_RLE,	/**< The pixels are compressed in packets, each starting with a control byte <c>c</c>.
+	 	 	 	 	 	 	 <br><c>0b0nnnnnnn</c>: <c>n+1</c> pixels follow in the specified format.
+	 	 	 	 	 	 	 <br><c>0b10nnnnnn</c>: The following pixel is repeated <c>n+2</c> times.
+	 	 	 	 	 	 	 <br><c>0b11nnnnnn</c>: The next <c>n+2</c> pixels are the same as the pixels of the row above.
+	 	 	 	 	 	 	 <br>The data is generated by the image encoder in <c>Utilities/PC_Software/ImageTools</c>. */
+} image_compression_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
 /** @defgroup IMGS_Exported_Structures Structures
  * @{
  */
@@ -60,17 +102,27 @@ extern "C" {
  */
 typedef struct
 {
-	uint16_t width;	 		/**< @brief Image width */
-	uint16_t height;	 	/**< @brief Image height */
-	uint32_t pixelFormat;	/**< @brief Image pixel format LTDC_Pixelformat */
-	const uint8_t* data;	/**< @brief Image pixel color data in specified format */
+	uint16_t width;	 				/**< @brief Image width */
+	uint16_t height;	 			/**< @brief Image height */
+	uint32_t pixelFormat;			/**< @brief Image pixel format LTDC_Pixelformat */
+	const uint8_t* data;			/**< @brief Image pixel color data in specified format */
+	image_compression_t compression;/**< @brief Storage format of the data */
+	uint32_t dataSize;				/**< @brief Size of the data in bytes. Only required for compressed images */
 } image_info_t;
+/**
+ * @brief Usage statistics of the cache of the decoded images
+ */
+typedef struct
+{
+	uint32_t hits;			/**< @brief No of loads of compressed images found decoded in the cache */
+	uint32_t misses;		/**< @brief No of loads of compressed images decoded into the cache */
+	uint32_t evictions;		/**< @brief No of decoded images removed from the cache to make space for other images */
+	uint32_t failures;		/**< @brief No of loads failing due to the size of the cache or corrupt data */
+	uint32_t usedSize;		/**< @brief Bytes of the cache used by the decoded images */
+} image_cache_stats_t;
 /**
  * @}
  */
-/********************************************************************************
- * Structures
- *******************************************************************************/
 
 /********************************************************************************
  * Exported Variables
@@ -104,6 +156,44 @@ extern image_info_t bsp_docs_QR_info;
 /********************************************************************************
  * Global Function Prototypes
  *******************************************************************************/
+/** @defgroup IMGS_Exported_Functions Functions
+ * @{
+ */
+/**
+ * @brief Get the size of a pixel.
+ * @param pixelFormat Pixel format (LTDC_Pixelformat).
+ * @return Size of the pixel in bytes. 0 if the format is unknown.
+ */
+extern uint32_t Image_GetPixelSize(uint32_t pixelFormat);
+/**
+ * @brief Decode an image into a buffer.
+ * @details The data is decoded in a single pass from start to end, writing each row of the image to the buffer once,
+ * so the buffer can be the memory read by the LTDC layer. Uncompressed images are copied.
+ * @param img Image to be decoded.
+ * @param buff Buffer receiving the pixels row by row.
+ * @param buffSize Size of the buffer in bytes.
+ * @return <c>ERR_OK</c> if successful, <c>ERR_OUT_OF_RANGE</c> if the buffer is too small,
+ * else <c>ERR_ILLEGAL</c> for unknown formats and corrupt data.
+ */
+extern device_err_t Image_Decode(const image_info_t* img, uint8_t* buff, uint32_t buffSize);
+/**
+ * @brief Get the pixels of an image for display.
+ * @details Uncompressed images are displayed from their data. Compressed images are decoded into the image cache,
+ * unless already decoded. If the cache has no space for the image, the least recently loaded images are removed.
+ * Load the images of a screen each time the screen is loaded, as the pixels may be removed by the images of other
+ * screens.
+ * @param img Image to be displayed.
+ * @return Pointer to the pixels. NULL if the image doesn't fit in the cache or its data is corrupt.
+ */
+extern const uint8_t* Image_Load(const image_info_t* img);
+/**
+ * @brief Get the usage statistics of the image cache.
+ * @param stats Structure to be filled with the statistics.
+ */
+extern void Image_GetCacheStats(image_cache_stats_t* stats);
+/**
+ * @}
+ */
 
 /********************************************************************************
  * Code
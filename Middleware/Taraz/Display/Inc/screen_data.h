@@ -93,6 +93,14 @@ extern "C" {
  * @brief Use this tag to indicate touch on Right button
  */
 #define TAG_RIGHT				(8)
+/**
+ * @brief Use this tag to indicate touch on task statistics button
+ */
+#define TAG_TASKS				(9)
+/**
+ * @brief Use this tag to indicate touch on Reset button
+ */
+#define TAG_RESET				(10)
 /**
  * @brief Use this to attach tag
  */
@@ -100,7 +108,7 @@ extern "C" {
 /**
  * @brief Use this to get tag from attached event argument
  */
-#define GET_TAG(e)				((uint32_t)(e->user_data))
+#define GET_TAG(e)				((uint32_t)(uintptr_t)(e->user_data))
 /**
  * @}
  */
@@ -120,6 +128,7 @@ typedef enum
 	SCREEN_CONF,       /**< Configuration Screen */
 	SCREEN_APPINFO,    /**< Application Information Screen */
 	SCREEN_intelliSENS,/**< intelliSENS Information Screen */
+	SCREEN_TASKS,      /**< Task Statistics Screen */
 	SCREEN_COUNT,      /**< Not a type. Use this to get the total number of legal types */
 	SCREEN_NONE,       /**< Invalid Screen */
 	SCREEN_PREVIOUS,   /**< Previous Screen */
@@ -182,6 +191,7 @@ typedef struct
 	disp_ch_measure_t chMeasures[TOTAL_MEASUREMENT_COUNT];	/**< @brief Contains all channel measurement informations */
 	adc_info_t* adcInfo;	/**< @brief Information of the ADC unit */
 	const char** chNames;	/**< @brief Names of all measurement channels */
+	volatile uint32_t updatedChannels;	/**< @brief Mask of the channels with statistics updated since the last refresh of the measurements */
 } disp_measure_t;
 /**
  * @brief Contains the information regarding a specific screen
@@ -54,7 +54,9 @@ extern "C" {
  */
 /**
  * @brief Call the LTDC module to display relevant layer
- * @param layerInfo Layer information
+ * @details The layers change in the vertical blanking. A layer hidden with NULL must be out of the display on return,
+ * so that its pixels can be overwritten.
+ * @param layerInfo Layer information. NULL to hide the layer
  * @param layerIdx Layer ID
  */
 typedef void (*DisplayLayer)(ltdc_layer_info_t* layerInfo, int layerIdx);
@@ -64,7 +66,24 @@ typedef void (*DisplayLayer)(ltdc_layer_info_t* layerInfo, int layerIdx);
 /********************************************************************************
  * Structures
  *******************************************************************************/
-
+/** @defgroup PEDISPLAYSCREEN_Exported_Structures Structures
+ * @{
+ */
+/**
+ * @brief Metrics of the screen switches
+ */
+typedef struct
+{
+	uint32_t switchCount;				/**< @brief No of completed screen switches */
+	uint32_t lastSwitchTime_ms;			/**< @brief Time of the last switch, from the request of the new screen till its layers are displayed */
+	uint32_t maxSwitchTime_ms;			/**< @brief Maximum time of the switches */
+	uint32_t lvMemUsed;					/**< @brief Used LVGL heap after loading the last screen */
+	uint32_t lvMemMaxUsed;				/**< @brief Maximum of the used LVGL heap after loading the screens */
+	uint32_t lvMemFreeBiggest;			/**< @brief Biggest free block of the LVGL heap after loading the last screen */
+} screen_manager_stats_t;
+/**
+ * @}
+ */
 /********************************************************************************
  * Exported Variables
  *******************************************************************************/
@@ -86,6 +105,16 @@ void ScreenManager_Init(DisplayLayer _dispLayer ,adc_info_t* _adcInfo);
  * @brief This function refreshes and manages the screens for display.
  */
 void ScreenManager_Refresh(void);
+/**
+ * @brief Get the metrics of the screen switches.
+ * @param stats Structure to be filled with the metrics.
+ */
+void ScreenManager_GetStats(screen_manager_stats_t* stats);
+/**
+ * @brief This function is called when the measurement settings are changed from the screens, e.g. to store the new states.
+ * @note A weak implementation of this function is provided. User can create a custom implementation if needed.
+ */
+void ScreenManager_SettingsChangedCallback(void);
 /********************************************************************************
  * Code
  *******************************************************************************/
@@ -47,6 +47,7 @@ static lv_obj_t* screen;
 static bool isActive;
 static volatile uint8_t tag = TAG_NONE;
 static lv_obj_t* screenGrid = NULL;
+static ltdc_layer_info_t directLayer;
 /********************************************************************************
  * Global Variables
  *******************************************************************************/
@@ -62,18 +63,19 @@ static void Close_Clicked(lv_event_t * e)
 {
 	if (!isActive)
 		return;
-	tag = TAG_CANCEL;
+	lv_obj_t * obj = lv_event_get_target(e);
+	tag = lv_btnmatrix_get_selected_btn(obj) ? TAG_CANCEL : TAG_TASKS;
 }
 
 static void Close_Create(lv_obj_t * parent, int row, int col)
 {
-	static const char* map[] = {LV_SYMBOL_OK, NULL};
+	static const char* map[] = {"Tasks", LV_SYMBOL_OK, NULL};
 
 	lv_obj_t* kb = lv_keyboard_create(parent);
 	lv_obj_set_grid_cell(kb, LV_GRID_ALIGN_CENTER, col, 1, LV_GRID_ALIGN_STRETCH, row, 1);
 	lv_obj_set_style_text_font(kb, &lv_font_montserrat_30, 0);
 	lv_btnmatrix_set_map(kb, map);
-	lv_obj_set_width(kb, 200);
+	lv_obj_set_width(kb, 400);
 	lv_obj_add_event_cb(kb, Close_Clicked, LV_EVENT_CLICKED, NULL);
 }
 
@@ -142,6 +144,8 @@ static screen_type_t Refresh(void)
 			tag = TAG_NONE;
 			if (tagBuff == TAG_CANCEL)
 				return SCREEN_PREVIOUS;
+			if (tagBuff == TAG_TASKS)
+				return SCREEN_TASKS;
 		}
 	}
 	return SCREEN_NONE;
@@ -167,6 +171,8 @@ static void Load(void)
 		lv_obj_del(screenGrid);
 		screenGrid = NULL;
 	}
+	if (appInfoDisplay.img != NULL)
+		directLayer.data = Image_Load(appInfoDisplay.img);
 	CreateScreen();
 	lv_scr_load(screen);
 	isActive = true;
@@ -188,8 +194,7 @@ static void Unload(void)
  */
 void AppInfoScreen_Init(screens_t* _screen)
 {
-	static ltdc_layer_info_t directLayer;
-	// display the image if required
+	// display the image if required, the image is decoded on loading
 	if (appInfoDisplay.img != NULL)
 	{
 		directLayer.xAlign = ALIGN_CENTER_X;
@@ -200,19 +205,11 @@ void AppInfoScreen_Init(screens_t* _screen)
 		directLayer.PixelFormat = appInfoDisplay.img->pixelFormat;
 		directLayer.width = appInfoDisplay.img->width;
 		directLayer.height = appInfoDisplay.img->height;
-		directLayer.data = appInfoDisplay.img->data;
 	}
 	// Make the screen
-	// create the screen
+	// create the screen, the contents are created on each load
 	screen = lv_obj_create(NULL);
 
-	// create basic grid
-	static lv_coord_t colsScreen[] = {LV_GRID_FR(1), ROW_WIDTH_QR, LV_GRID_TEMPLATE_LAST};
-	lv_obj_t* screenGrid = lv_grid_create_general(screen, colsScreen, singleRowCol, &lvStyleStore.defaultGrid, NULL, NULL, NULL);
-	lv_obj_set_size(screenGrid, DISPLAY_WIDTH_RAM, DISPLAY_HEIGHT_RAM);
-
-	CreateInfo(screenGrid);
-
 	_screen->Refresh = Refresh;
 	_screen->Load = Load;
 	_screen->Unload = Unload;
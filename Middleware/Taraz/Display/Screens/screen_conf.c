@@ -35,6 +35,34 @@
 #define MEASURES_CONFIGURABLE			(1)
 #define PARAMS_CONFIGURABLE				(1)
 #define SETTINGS_CONFIGURABLE			(1)
+#ifndef CONF_SCREEN_PERSISTENT
+/**
+ * @brief Keep the objects of the configuration screen after its first use.
+ * @details Set to 0 to delete the objects when the screen is unloaded, freeing the LVGL heap for the other screens
+ * at the cost of creating them again for each use.
+ */
+#define CONF_SCREEN_PERSISTENT			(1)
+#endif
+/**
+ * @brief Vertical distance between the fields of the parameter list
+ */
+#define FIELD_ROW_PITCH					(FIELD_ROW_HEIGHT + 12)
+/**
+ * @brief No of field rows visible in the parameter list
+ */
+#define CONF_FIELD_ROWS					(6)
+/**
+ * @brief No of rows with fields while scrolling, including the partly visible rows at both ends
+ */
+#define CONF_BOUND_ROWS					(CONF_FIELD_ROWS + 1)
+/**
+ * @brief No of reusable fields. Each row may need a field with a label or a text area.
+ */
+#define CONF_FIELD_POOL_SIZE			(2 * CONF_BOUND_ROWS)
+/**
+ * @brief Size of the buffered text of each setting
+ */
+#define CONF_SETTING_TEXT_SIZE			(20)
 /********************************************************************************
  * Typedefs
  *******************************************************************************/
@@ -50,10 +78,12 @@ typedef enum
  *******************************************************************************/
 typedef struct
 {
+	lv_obj_t* screenGrid;
 	lv_obj_t* itemContainer;
 	lv_obj_t* focusItem;
 	lv_obj_t* keyboard;
-	lv_obj_t* paramGrid;
+	lv_obj_t* paramList;
+	lv_obj_t* paramListEnd;
 	lv_obj_t* paramName;
 	lv_obj_t* nameContainerArea;
 	lv_obj_t* leftRightKb;
@@ -70,11 +100,19 @@ typedef struct
 {
 	lv_obj_t* lblValue;
 } var_objs_t;
+/**
+ * @brief Reusable field of the parameter grid
+ */
 typedef struct
 {
 	lv_obj_t* container;
+	lv_obj_t* name;
 	lv_obj_t* value;
-} conf_field_info_t;
+	bool isTextArea;
+	bool isUsed;
+	int row;
+	lv_event_cb_t event_cb;
+} conf_field_t;
 typedef struct
 {
 	int unitIndex;
@@ -92,8 +130,11 @@ typedef struct
 	int groupCount;
 	int settingsCount;
 	int currentSettingIndex;
+	int firstSetting;
+	int firstRow;
+	int focusRow;
 	data_param_group_t* paramGroups;
-	conf_field_info_t* objs;
+	char (*texts)[CONF_SETTING_TEXT_SIZE];
 } conf_field_data_t;
 /********************************************************************************
  * Static Variables
@@ -106,6 +147,7 @@ static conf_type_t confType = CONF_MEASURE;
 static measure_data_t measureData = {0};
 static var_data_t varData = {0};
 static conf_field_data_t confFieldData = {0};
+static conf_field_t fieldPool[CONF_FIELD_POOL_SIZE] = {0};
 /********************************************************************************
  * Global Variables
  *******************************************************************************/
@@ -229,27 +271,58 @@ static void StaticForm_Create(lv_obj_t * parent)
 	OkClose_Create(grid, 1, 0);
 }
 
-static void CreateParamGrid(void)
-{
-	if (screenObjs.paramGrid != NULL)
-	{
-		lv_obj_del(screenObjs.paramGrid);
-		screenObjs.paramGrid = NULL;
-	}
+static void ParamList_Scrolled(lv_event_t* e);
 
-	static lv_style_t gridStyle;
+/**
+ * @brief Create the scrollable list of the fields.
+ * @details The fields are placed at the positions of their rows, and only the visible rows have fields. An empty
+ * object at the end of the last row sets the scrollable height of the list.
+ */
+static void CreateParamList(void)
+{
+	static lv_style_t listStyle;
 	static bool init = false;
 	// initialize styles once
 	if (!init)
 	{
-		BSP_Screen_InitGridStyle(&gridStyle, 12, 12, 0, 0, NULL);
+		BSP_Screen_InitGridStyle(&listStyle, 12, 12, 0, 0, NULL);
 		init = true;
 	}
-	static lv_coord_t rows[] = {FIELD_ROW_HEIGHT, FIELD_ROW_HEIGHT, FIELD_ROW_HEIGHT,
-			FIELD_ROW_HEIGHT, FIELD_ROW_HEIGHT, FIELD_ROW_HEIGHT,
-			LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
-	screenObjs.paramGrid = lv_grid_create_general(screenObjs.itemContainer, singleRowCol, rows, &gridStyle, NULL, NULL, NULL);
-	lv_obj_set_grid_cell(screenObjs.paramGrid, LV_GRID_ALIGN_STRETCH, 0, 1, LV_GRID_ALIGN_STRETCH, 0, 1);
+	screenObjs.paramList = lv_container_create_general(screenObjs.itemContainer, &listStyle, 0, 0, NULL, NULL);
+	lv_obj_set_scroll_dir(screenObjs.paramList, LV_DIR_VER);
+	lv_obj_add_event_cb(screenObjs.paramList, ParamList_Scrolled, LV_EVENT_SCROLL, NULL);
+	screenObjs.paramListEnd = lv_obj_create(screenObjs.paramList);
+	lv_obj_remove_style_all(screenObjs.paramListEnd);
+	lv_obj_set_size(screenObjs.paramListEnd, 1, 1);
+}
+
+/**
+ * @brief Set the number of rows in the parameter list and scroll to the first row.
+ * @param rowCount No of rows.
+ */
+static void SetRowCount(int rowCount)
+{
+	lv_obj_set_pos(screenObjs.paramListEnd, 0, rowCount > 0 ? (rowCount - 1) * FIELD_ROW_PITCH + FIELD_ROW_HEIGHT - 1 : 0);
+	lv_obj_scroll_to_y(screenObjs.paramList, 0, LV_ANIM_OFF);
+}
+
+/**
+ * @brief Create the objects of the screen if they don't exist yet.
+ */
+static void CreateScreen(void)
+{
+	if (screenObjs.screenGrid != NULL)
+		return;
+
+	// create basic grid
+	static lv_coord_t colsScreen[] = {LV_GRID_FR(1), 350, LV_GRID_TEMPLATE_LAST};
+	static lv_coord_t rowsScreen[] = {60, LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+	screenObjs.screenGrid = lv_grid_create_general(screen, colsScreen, rowsScreen, &lvStyleStore.defaultGrid, NULL, NULL, NULL);
+	lv_obj_set_size(screenObjs.screenGrid, DISPLAY_WIDTH_RAM, DISPLAY_HEIGHT_RAM);
+
+	Numpad_Create(screenObjs.screenGrid);
+	StaticForm_Create(screenObjs.screenGrid);
+	CreateParamList();
 }
 
 static void SetPageTitle(const char* name)
@@ -258,26 +331,131 @@ static void SetPageTitle(const char* name)
 		lv_label_set_text(screenObjs.paramName, name);
 }
 
-static lv_obj_t* AddField(const char* name, const char* value, bool isWriteable, lv_obj_t** container, int row, lv_event_cb_t e, void * eventData)
+/**
+ * @brief Forward the clicks of a pooled field to the handler of its current use.
+ */
+static void Field_Clicked(lv_event_t* e)
+{
+	conf_field_t* field = (conf_field_t*)lv_event_get_user_data(e);
+	if (field->isUsed && field->event_cb != NULL)
+		field->event_cb(e);
+}
+
+/**
+ * @brief Get an unused field from the pool.
+ * @details Fields of the same type are preferred. If there is no such field, an unused field of the other type is
+ * deleted, so the field can be created with the required type.
+ * @param isTextArea <c>true</c> if the value of the field is a text area.
+ * @return Field from the pool. Its container is NULL if it should be created.
+ */
+static conf_field_t* GetFreeField(bool isTextArea)
+{
+	conf_field_t* empty = NULL;
+	conf_field_t* other = NULL;
+	for (int i = 0; i < CONF_FIELD_POOL_SIZE; i++)
+	{
+		conf_field_t* field = &fieldPool[i];
+		if (field->isUsed)
+			continue;
+		if (field->container == NULL)
+		{
+			if (empty == NULL)
+				empty = field;
+		}
+		else if (field->isTextArea == isTextArea)
+			return field;
+		else if (other == NULL)
+			other = field;
+	}
+	if (empty == NULL && other != NULL)
+	{
+		lv_obj_del(other->container);
+		other->container = NULL;
+		empty = other;
+	}
+	return empty;
+}
+
+/**
+ * @brief Show a field in the parameter list, reusing the fields of the previous rows and loads where possible.
+ * @param name Name of the field.
+ * @param value Value of the field.
+ * @param isWriteable <c>true</c> if the value should be editable in a text area.
+ * @param row Row of the field in the parameter list.
+ * @param e Click event handler of the field.
+ * @return Value object of the field. NULL if the pool is exhausted.
+ */
+static lv_obj_t* AddField(const char* name, const char* value, bool isWriteable, int row, lv_event_cb_t e)
+{
+	conf_field_t* field = GetFreeField(isWriteable);
+	if (field == NULL)
+		return NULL;
+	if (field->container == NULL)
+	{
+		static lv_ta_field_data_t fieldData =
+		{
+				.colorFieldName = false,
+				.colWidths = { LV_GRID_FR(1), FIELD_VALUE_WIDTH }
+		};
+		fieldData.nameTxt = name;
+		fieldData.valueTxt = value;
+		fieldData.isTextArea = isWriteable;
+		lv_create_default_text_field(screenObjs.paramList, &fieldData, row, 0, Field_Clicked, field);
+		field->container = fieldData.container;
+		field->name = fieldData.nameField;
+		field->value = fieldData.valueField;
+		field->isTextArea = isWriteable;
+		lv_obj_set_size(field->container, lv_pct(100), FIELD_ROW_HEIGHT);
+	}
+	else
+	{
+		lv_label_set_text(field->name, name);
+		if (isWriteable)
+			lv_textarea_set_text(field->value, value);
+		else
+			lv_label_set_text(field->value, value);
+		lv_obj_clear_flag(field->container, LV_OBJ_FLAG_HIDDEN);
+	}
+	lv_obj_set_pos(field->container, 0, row * FIELD_ROW_PITCH);
+	field->row = row;
+	field->event_cb = e;
+	field->isUsed = true;
+	return field->value;
+}
+
+/**
+ * @brief Hide a field and return it to the pool.
+ * @param field Field to be released.
+ */
+static void ReleaseField(conf_field_t* field)
+{
+	// the keyboard shouldn't edit the field after its reuse for another row
+	if (field->value == screenObjs.focusItem)
+	{
+		screenObjs.focusItem = NULL;
+		lv_keyboard_set_textarea(screenObjs.keyboard, NULL);
+	}
+	lv_obj_add_flag(field->container, LV_OBJ_FLAG_HIDDEN);
+	field->isUsed = false;
+}
+
+/**
+ * @brief Hide all fields and return them to the pool.
+ */
+static void ReleaseFields(void)
 {
-	static lv_ta_field_data_t field =
+	for (int i = 0; i < CONF_FIELD_POOL_SIZE; i++)
 	{
-			.colorFieldName = false,
-			.colWidths = { LV_GRID_FR(1), FIELD_VALUE_WIDTH }
-	};
-	field.nameTxt = name;
-	field.valueTxt = value;
-	field.isTextArea = isWriteable;
-	lv_create_default_text_field(screenObjs.paramGrid, &field, row, 0, e, eventData);
-	if (container != NULL)
-		*container = field.container;
-	return field.valueField;
+		if (fieldPool[i].isUsed)
+			ReleaseField(&fieldPool[i]);
+	}
 }
 
 #if MEASURES_CONFIGURABLE
 
 static void Type_Toggle(lv_event_t* e)
 {
+	LV_UNUSED(e);
 	if (!isActive)
 		return;
 	if (measureData.objs.type != NULL)
@@ -289,6 +467,7 @@ static void Type_Toggle(lv_event_t* e)
 }
 static void Unit_Toggle(lv_event_t* e)
 {
+	LV_UNUSED(e);
 	if (!isActive)
 		return;
 	if (measureData.objs.unit != NULL)
@@ -306,33 +485,36 @@ static void Unit_Toggle(lv_event_t* e)
  */
 void ConfigScreen_LoadMeasurement(int _measurementIndex)
 {
-	if (screenObjs.itemContainer == NULL)
-		return;
+	CreateScreen();
 	measureData.measurementIndex = _measurementIndex;
 	confType = CONF_MEASURE;
 
-	CreateParamGrid();
+	ReleaseFields();
+	SetRowCount(5);
 	SetPageTitle(dispMeasures.chNames[measureData.measurementIndex]);
 	char txt[12];
 	// Type
 	measureData.typeIndex = (uint8_t)dispMeasures.chMeasures[measureData.measurementIndex].type;
-	measureData.objs.type = AddField("Type", measureTxts[measureData.typeIndex], false, NULL, 0, Type_Toggle, NULL);
+	measureData.objs.type = AddField("Type", measureTxts[measureData.typeIndex], false, 0, Type_Toggle);
 	// Units
 	measureData.unitIndex = (uint8_t)dispMeasures.adcInfo->units[measureData.measurementIndex];
-	measureData.objs.unit = AddField("Unit", unitTxts[measureData.unitIndex], false, NULL, 1, Unit_Toggle, NULL);
+	measureData.objs.unit = AddField("Unit", unitTxts[measureData.unitIndex], false, 1, Unit_Toggle);
 	// Sensitivity
 	(void)ftoa_custom(ADC_INFO.sensitivity[measureData.measurementIndex], txt, 7, 4);
-	screenObjs.focusItem = measureData.objs.sensitivity = AddField("Sensitivity", txt, true, NULL, 2, TextArea_Clicked, NULL);
+	screenObjs.focusItem = measureData.objs.sensitivity = AddField("Sensitivity", txt, true, 2, TextArea_Clicked);
 	(void)ftoa_custom(ADC_INFO.offsets[measureData.measurementIndex], txt, 7, 4);
-	measureData.objs.offset = AddField("Offset", txt, true, NULL, 3, TextArea_Clicked, NULL);
+	measureData.objs.offset = AddField("Offset", txt, true, 3, TextArea_Clicked);
 	(void)ftoa_custom(ADC_INFO.freq[measureData.measurementIndex], txt, 7, 1);
-	measureData.objs.freq = AddField("Fundamental Frequency", txt, true, NULL, 4, TextArea_Clicked, NULL);
+	measureData.objs.freq = AddField("Fundamental Frequency", txt, true, 4, TextArea_Clicked);
 
 	lv_keyboard_set_textarea(screenObjs.keyboard, screenObjs.focusItem);
 }
 
 static device_err_t UpdateMeasurementSettings(void)
 {
+	// the fields are missing if the pool was exhausted while loading the measurement
+	if (measureData.objs.freq == NULL || measureData.objs.sensitivity == NULL || measureData.objs.offset == NULL)
+		return ERR_NOT_AVAILABLE;
 	float freq, sensitivity, offset;
 	bool isValid = atof_custom(lv_textarea_get_text(measureData.objs.freq), &freq) &&
 			atof_custom(lv_textarea_get_text(measureData.objs.sensitivity), &sensitivity) &&
@@ -341,6 +523,7 @@ static device_err_t UpdateMeasurementSettings(void)
 		return ERR_INVALID_TEXT;
 	device_err_t err = BSP_ADC_UpdateConfig(dispMeasures.adcInfo, dispMeasures.adcInfo->fs, measureData.measurementIndex, freq, sensitivity, offset, (data_units_t)measureData.unitIndex);
 	dispMeasures.chMeasures[measureData.measurementIndex].type = (measure_type_t)measureData.typeIndex;
+	ScreenManager_SettingsChangedCallback();
 	return err;
 }
 
@@ -355,20 +538,20 @@ static device_err_t UpdateMeasurementSettings(void)
  */
 void ConfigScreen_LoadParam(data_param_info_t* _paramInfo, char* val)
 {
-	if (screenObjs.itemContainer == NULL)
-		return;
+	CreateScreen();
 	confType = CONF_PARAM;
 
-	CreateParamGrid();
+	ReleaseFields();
+	SetRowCount(1);
 	SetPageTitle(_paramInfo->name);
-	screenObjs.focusItem = varData.objs.lblValue = AddField("Value", val, true, NULL, 0, TextArea_Clicked, NULL);
+	screenObjs.focusItem = varData.objs.lblValue = AddField("Value", val, true, 0, TextArea_Clicked);
 	lv_keyboard_set_textarea(screenObjs.keyboard, screenObjs.focusItem);
 	varData.paramInfo = _paramInfo;
 }
 
 static device_err_t UpdateParameter(void)
 {
-	if(varData.paramInfo != NULL)
+	if(varData.paramInfo != NULL && varData.objs.lblValue != NULL)
 		return SetDataParameter_FromText(varData.paramInfo, lv_textarea_get_text(varData.objs.lblValue));
 	return ERR_OK;
 }
@@ -383,10 +566,13 @@ static void EditableParam_Clicked(lv_event_t * e)
 		return;
 	screenObjs.focusItem = lv_event_get_target(e);
 	lv_keyboard_set_textarea(screenObjs.keyboard, screenObjs.focusItem);
+	conf_field_t* field = (conf_field_t*)lv_event_get_user_data(e);
+	confFieldData.focusRow = field->row;
 }
 
 static void ToggleableParam_Clicked(lv_event_t * e)
 {
+	LV_UNUSED(e);
 	if (!isActive)
 		return;
 }
@@ -396,62 +582,137 @@ static bool IsEditableParamField(data_param_info_t* param)
 	return param->type == DTYPE_BOOL ? false : true;
 }
 
-static void AddParamField(int row, data_param_info_t* param, conf_field_info_t* confField)
+/**
+ * @brief Buffer the text of a setting field, so the edits are kept after the reuse of the field for other rows.
+ * @param field Field of the setting.
+ */
+static void SaveSettingField(conf_field_t* field)
 {
-	char value[20];
-	GetDataParameter_InText(param, value, false);
-
-	if (IsEditableParamField(param) == false)
-		confField->value = AddField(param->name, value, false, &confField->container, row, ToggleableParam_Clicked, param);
-	else
-		confField->value = AddField(param->name, value, true, &confField->container, row, EditableParam_Clicked, param);
+	if (confFieldData.texts == NULL)
+		return;
+	const char* txt = field->isTextArea ? lv_textarea_get_text(field->value) : lv_label_get_text(field->value);
+	char* buff = confFieldData.texts[confFieldData.firstSetting + field->row];
+	strncpy(buff, txt, CONF_SETTING_TEXT_SIZE - 1);
+	buff[CONF_SETTING_TEXT_SIZE - 1] = 0;
 }
 
-static void HideAllSettings(void)
+/**
+ * @brief Buffer the texts of the settings shown in the current page, so the edits are kept while changing the pages.
+ */
+static void SaveSettingsPage(void)
 {
-	if (confFieldData.objs == NULL)
+	for (int i = 0; i < CONF_FIELD_POOL_SIZE; i++)
+	{
+		if (fieldPool[i].isUsed)
+			SaveSettingField(&fieldPool[i]);
+	}
+}
+
+/**
+ * @brief Show the setting of a row in a field of the pool.
+ * @details The value of the setting is read when the row is shown for the first time after loading the settings.
+ * Later the buffered text is shown, which holds the edits of the user.
+ * @param row Row of the setting in the current page.
+ */
+static void BindSettingRow(int row)
+{
+	data_param_info_t* param = confFieldData.paramGroups[confFieldData.currentSettingIndex].paramPointers[row];
+	char* txt = confFieldData.texts[confFieldData.firstSetting + row];
+	if (txt[0] == 0)
+		GetDataParameter_InText(param, txt, false);
+	bool isEditable = IsEditableParamField(param);
+	lv_obj_t* value = AddField(param->name, txt, isEditable, row, isEditable ? EditableParam_Clicked : ToggleableParam_Clicked);
+	if (row == confFieldData.focusRow && value != NULL)
+	{
+		screenObjs.focusItem = value;
+		lv_keyboard_set_textarea(screenObjs.keyboard, value);
+	}
+}
+
+/**
+ * @brief Bind the fields to the visible rows of the current page.
+ * @details The fields of the rows scrolled out of view are released after buffering their texts, and the fields
+ * are taken again for the rows scrolled into view.
+ * @param force <c>true</c> to bind the rows even if the visible rows didn't change.
+ */
+static void ShowVisibleSettings(bool force)
+{
+	int rowCount = confFieldData.paramGroups[confFieldData.currentSettingIndex].paramCount;
+	int firstRow = (lv_obj_get_scroll_y(screenObjs.paramList)) / FIELD_ROW_PITCH;
+	if (firstRow > rowCount - CONF_BOUND_ROWS)
+		firstRow = rowCount - CONF_BOUND_ROWS;
+	if (firstRow < 0)
+		firstRow = 0;
+	if (!force && firstRow == confFieldData.firstRow)
 		return;
+	int endRow = firstRow + CONF_BOUND_ROWS < rowCount ? firstRow + CONF_BOUND_ROWS : rowCount;
 
-	for (int i = 0; i < confFieldData.settingsCount; i++)
-		lv_obj_add_flag(confFieldData.objs[i].container, LV_OBJ_FLAG_HIDDEN);
+	bool isBound[CONF_BOUND_ROWS] = {false};
+	for (int i = 0; i < CONF_FIELD_POOL_SIZE; i++)
+	{
+		conf_field_t* field = &fieldPool[i];
+		if (!field->isUsed)
+			continue;
+		if (field->row < firstRow || field->row >= endRow)
+		{
+			SaveSettingField(field);
+			ReleaseField(field);
+		}
+		else
+			isBound[field->row - firstRow] = true;
+	}
+	for (int row = firstRow; row < endRow; row++)
+	{
+		if (!isBound[row - firstRow])
+			BindSettingRow(row);
+	}
+	confFieldData.firstRow = firstRow;
+}
+
+static void ParamList_Scrolled(lv_event_t* e)
+{
+	LV_UNUSED(e);
+	if (isActive && confType == CONF_SETTINGS && confFieldData.texts != NULL)
+		ShowVisibleSettings(false);
 }
 
 static void ShowSpecificSettingWindow(int index)
 {
-	HideAllSettings();
+	// the rows are bound to the buffered texts
+	if (confFieldData.texts == NULL)
+		return;
+	SaveSettingsPage();
+	ReleaseFields();
 
-	int firstSetting = 0;
+	confFieldData.firstSetting = 0;
 	for (int i = 0; i < index; i++)
-		firstSetting += confFieldData.paramGroups[i].paramCount;
+		confFieldData.firstSetting += confFieldData.paramGroups[i].paramCount;
 
 	SetPageTitle(confFieldData.paramGroups[index].title);
 
 	confFieldData.currentSettingIndex = index;
-	for (int i = 0; i < confFieldData.paramGroups[index].paramCount; i++)
-		lv_obj_clear_flag(confFieldData.objs[firstSetting++].container, LV_OBJ_FLAG_HIDDEN);
+	confFieldData.focusRow = -1;
+	SetRowCount(confFieldData.paramGroups[index].paramCount);
+	ShowVisibleSettings(true);
 }
 
-static void FillAllSettings(void)
+/**
+ * @brief Allocate the buffered texts of all settings.
+ * @details The texts are empty till the settings are shown, so the settings are only read when their rows become
+ * visible.
+ * @return <c>true</c> if the texts are allocated.
+ */
+static bool AllocateSettingTexts(void)
 {
-	if (confFieldData.objs != NULL)
-		free(confFieldData.objs);
+	if (confFieldData.texts != NULL)
+		free(confFieldData.texts);
 	confFieldData.settingsCount = 0;
 
 	for (int i = 0; i < confFieldData.groupCount; i++)
 		confFieldData.settingsCount += confFieldData.paramGroups[i].paramCount;
 
-	confFieldData.objs = (conf_field_info_t*) malloc(sizeof(conf_field_info_t) * confFieldData.settingsCount);
-
-	// Create and hide all
-	int index = 0;
-	for (int i = 0; i < confFieldData.groupCount; i++)
-	{
-		for (int j = 0; j < confFieldData.paramGroups[i].paramCount; j++)
-		{
-			AddParamField(j, confFieldData.paramGroups[i].paramPointers[j], &confFieldData.objs[index]);
-			lv_obj_add_flag(confFieldData.objs[index++].container, LV_OBJ_FLAG_HIDDEN);
-		}
-	}
+	confFieldData.texts = calloc(confFieldData.settingsCount, CONF_SETTING_TEXT_SIZE);
+	return confFieldData.texts != NULL;
 }
 
 /**
@@ -461,32 +722,48 @@ static void FillAllSettings(void)
  */
 void ConfigScreen_LoadSettings(data_param_group_t* _paramGroups, int _groupCount)
 {
-	if (screenObjs.itemContainer == NULL)
-		return;
+	CreateScreen();
+	// the fields of the previous settings are not saved
+	ReleaseFields();
 	confType = CONF_SETTINGS;
 
 	confFieldData.paramGroups = _paramGroups;
 	confFieldData.groupCount = _groupCount;
-	CreateParamGrid();
-	FillAllSettings();
+	if (!AllocateSettingTexts())
+	{
+		// show an empty window, which can only be cancelled
+		SetPageTitle("Settings");
+		SetRowCount(0);
+		EnablePageChange(screenObjs.leftRightKb, false);
+		DisplayMessage("Out of Memory", "The settings can't be loaded. Kindly, try again after closing other windows.");
+		return;
+	}
 	ShowSpecificSettingWindow(0);
 	EnablePageChange(screenObjs.leftRightKb, true);
 }
 
+/**
+ * @brief Apply the buffered texts of the settings.
+ * @note The settings never shown are not applied, as they couldn't be edited.
+ */
 static device_err_t UpdateSettings(void)
 {
-	if (confFieldData.paramGroups == NULL || confFieldData.groupCount <= 0 || confFieldData.objs == NULL || confFieldData.settingsCount < 0)
+	if (confFieldData.paramGroups == NULL || confFieldData.groupCount <= 0 || confFieldData.texts == NULL || confFieldData.settingsCount < 0)
 		return ERR_OK;
 
+	SaveSettingsPage();
 	int index = 0;
 	for (int i = 0; i < confFieldData.groupCount; i++)
 	{
 		for (int j = 0; j < confFieldData.paramGroups[i].paramCount; j++)
 		{
 			data_param_info_t* param = confFieldData.paramGroups[i].paramPointers[j];
-			device_err_t err = SetDataParameter_FromText(param, IsEditableParamField(param) == false ? lv_label_get_text(confFieldData.objs[index].value) : lv_textarea_get_text(confFieldData.objs[index].value));
-			if (err != ERR_OK)
-				return err;
+			if (confFieldData.texts[index][0] != 0)
+			{
+				device_err_t err = SetDataParameter_FromText(param, confFieldData.texts[index]);
+				if (err != ERR_OK)
+					return err;
+			}
 			index++;
 		}
 	}
@@ -498,6 +775,7 @@ static device_err_t UpdateSettings(void)
 
 static void Load(void)
 {
+	CreateScreen();
 	lv_scr_load(screen);
 	isActive = true;
 }
@@ -508,12 +786,19 @@ static void Unload(void)
 	{
 		//
 		isActive = false;
-		lv_obj_del(screenObjs.paramGrid);
-		screenObjs.paramGrid = NULL;
-		if (confFieldData.objs != NULL)
-			free(confFieldData.objs);
-		confFieldData.objs = NULL;
+#if SETTINGS_CONFIGURABLE
+		if (confFieldData.texts != NULL)
+			free(confFieldData.texts);
+		confFieldData.texts = NULL;
+#endif
+#if CONF_SCREEN_PERSISTENT
+		ReleaseFields();
 		EnablePageChange(screenObjs.leftRightKb, false);
+#else
+		lv_obj_del(screenObjs.screenGrid);
+		memset(&screenObjs, 0, sizeof(screenObjs));
+		memset(fieldPool, 0, sizeof(fieldPool));
+#endif
 	}
 }
 
@@ -528,7 +813,7 @@ static screen_type_t Refresh(void)
 		else if (tagBuff == TAG_RIGHT && confType == CONF_SETTINGS)
 			ShowSpecificSettingWindow(confFieldData.currentSettingIndex < confFieldData.groupCount - 1 ? confFieldData.currentSettingIndex + 1 : 0);
 		else if (tagBuff == TAG_LEFT && confType == CONF_SETTINGS)
-			ShowSpecificSettingWindow(confFieldData.currentSettingIndex = confFieldData.currentSettingIndex > 0 ? confFieldData.currentSettingIndex - 1 : confFieldData.groupCount - 1);
+			ShowSpecificSettingWindow(confFieldData.currentSettingIndex > 0 ? confFieldData.currentSettingIndex - 1 : confFieldData.groupCount - 1);
 		else if (tagBuff == TAG_OK)
 		{
 			device_err_t err = ERR_OK;
@@ -553,18 +838,9 @@ static screen_type_t Refresh(void)
  */
 void ConfigScreen_Init(screens_t* _screen)
 {
-	// create the screen
+	// create the screen, the objects are created on the first use
 	screen = lv_obj_create(NULL);
 
-	// create basic grid
-	static lv_coord_t colsScreen[] = {LV_GRID_FR(1), 350, LV_GRID_TEMPLATE_LAST};
-	static lv_coord_t rowsScreen[] = {60, LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
-	lv_obj_t* screenGrid = lv_grid_create_general(screen, colsScreen, rowsScreen, &lvStyleStore.defaultGrid, NULL, NULL, NULL);
-	lv_obj_set_size(screenGrid, DISPLAY_WIDTH_RAM, DISPLAY_HEIGHT_RAM);
-
-	Numpad_Create(screenGrid);
-	StaticForm_Create(screenGrid);
-
 	_screen->Refresh = Refresh;
 	_screen->Load = Load;
 	_screen->Unload = Unload;
@@ -68,6 +68,13 @@ static const char* sectionValues[4] = {
 
 		NULL};
 static lv_obj_t* screenGrid = NULL;
+static ltdc_layer_info_t directLayer =
+{
+		.xAlign = ALIGN_CENTER_X,
+		.yAlign = ALIGN_CENTER_Y,
+		.posX = DISPLAY_WIDTH - ROW_WIDTH_QR / 2,
+		.posY = DISPLAY_HEIGHT / 2
+};
 /********************************************************************************
  * Global Variables
  *******************************************************************************/
@@ -81,6 +88,7 @@ static lv_obj_t* screenGrid = NULL;
  *******************************************************************************/
 static void Close_Clicked(lv_event_t * e)
 {
+	LV_UNUSED(e);
 	if (!isActive)
 		return;
 	tag = TAG_CANCEL;
@@ -216,6 +224,7 @@ static void Load(void)
 		lv_obj_del(screenGrid);
 		screenGrid = NULL;
 	}
+	directLayer.data = Image_Load(&intelliSENS_QR_info);
 	CreateScreen();
 	lv_scr_load(screen);
 	isActive = true;
@@ -237,17 +246,10 @@ static void Unload(void)
  */
 void IntellisensScreen_Init(screens_t* _screen)
 {
-	static ltdc_layer_info_t directLayer =
-	{
-			.xAlign = ALIGN_CENTER_X,
-			.yAlign = ALIGN_CENTER_Y,
-			.posX = DISPLAY_WIDTH - ROW_WIDTH_QR / 2,
-			.posY = DISPLAY_HEIGHT / 2
-	};
+	// the image is decoded on loading
 	directLayer.PixelFormat = intelliSENS_QR_info.pixelFormat;
 	directLayer.width = intelliSENS_QR_info.width;
 	directLayer.height = intelliSENS_QR_info.height;
-	directLayer.data = intelliSENS_QR_info.data;
 
 	// Make the screen
 	// create the screen
@@ -72,6 +72,19 @@
 
 #define MEASUREMENT_CH_NAME_FONT	(lv_font_montserrat_22)
 #define MEASUREMENT_TYPE_FONT		(lv_font_montserrat_16)
+
+#ifndef MEASUREMENT_MIN_UPDATE_INTERVAL_ms
+/**
+ * @brief Minimum time between the updates of a measurement value on the display
+ */
+#define MEASUREMENT_MIN_UPDATE_INTERVAL_ms		(250)
+#endif
+#ifndef MEASUREMENT_DISPLAY_HYSTERESIS
+/**
+ * @brief Relative change of a measurement value ignored by the display
+ */
+#define MEASUREMENT_DISPLAY_HYSTERESIS			(0.001f)
+#endif
 /********************************************************************************
  * Typedefs
  *******************************************************************************/
@@ -84,6 +97,10 @@ typedef struct
 	lv_obj_t* gridMeasure;
 	lv_obj_t* gridValue;
 	lv_obj_t* gridName;
+	char txt[10];
+	float shownValue;
+	uint32_t lastUpdateTick;
+	bool isPending;
 } ch_disp_t;
 /********************************************************************************
  * Structures
@@ -97,6 +114,13 @@ static ch_disp_t chDisplay[16];
 static volatile bool isActive;
 static volatile uint8_t tag = TAG_NONE;
 static bool isNotFirstRefresh = false;
+static p2p_data_snapshot_t appAreaSnapshot = {0};
+static ltdc_layer_info_t directLayer =
+{
+		.xAlign = ALIGN_RIGHT_X,
+		.yAlign = ALIGN_UP_Y,
+		.posY = 12
+};
 /********************************************************************************
  * Global Variables
  *******************************************************************************/
@@ -357,12 +381,38 @@ __weak void MainScreen_CreateAppArea(lv_obj_t* parent, int row, int col)
 	/******************************* Parameters *********************************/
 }
 
+/**
+ * @brief Check if any parameter of the application dependent area has a custom getter.
+ * @return <c>true</c> if the parameter values can change without an update of the shared data.
+ */
+static bool HasCustomGetters(void)
+{
+#if CONTROL_CONFS_COUNT > 0
+	for (int i = 0; i < CONTROL_CONFS_COUNT; i++)
+	{
+		if (mainScreenControlConfs[i]->Getter != NULL)
+			return true;
+	}
+#endif
+#if MONITOR_CONFS_COUNT > 0
+	for (int i = 0; i < MONITOR_CONFS_COUNT; i++)
+	{
+		if (mainScreenMonitorConfs[i]->Getter != NULL)
+			return true;
+	}
+#endif
+	return false;
+}
+
 /**
  * @brief Refreshes the application dependent area of the main screen.
  */
 __weak void MainScreen_RefreshAppArea(void)
 {
 	char txt[20];
+	// Values of the parameters with the default getters can only change with the shared data
+	if (P2PComms_TakeSnapshot(&appAreaSnapshot) == 0 && isNotFirstRefresh && !HasCustomGetters())
+		return;
 #if CONTROL_CONFS_COUNT > 0
 	for (int i = 0; i < CONTROL_CONFS_COUNT; i++)
 	{
@@ -538,10 +588,13 @@ static void MeasurementCell_Create(lv_obj_t * parent, int index)
 	disp->gridMeasure = lv_grid_create_general(parent, singleRowCol, rows, &cellGridStyle, NULL, event_handler, MEASURE_TAG(index));
 	lv_obj_set_grid_cell(disp->gridMeasure, LV_GRID_ALIGN_STRETCH, col, 1, LV_GRID_ALIGN_STRETCH, row, 1);
 
-	char txtVal[10];
+	char* txtVal = disp->txt;
 	const char* txtRead = NULL;
 	txtRead = measureTxts[(uint8_t)disp->lastType];
 	ftoa_custom(0, txtVal, 4, 1);
+	disp->shownValue = 0;
+	disp->lastUpdateTick = HAL_GetTick();
+	disp->isPending = true;
 
 	lv_obj_t * containerValue = lv_container_create_general(disp->gridMeasure, &lvStyleStore.defaultGrid, 0, 0, event_handler, MEASURE_TAG(index));
 	disp->gridValue = containerValue;
@@ -608,8 +661,31 @@ static void Header_Create(lv_obj_t* parent)
 	lv_container_create_general(parent, &lvStyleStore.defaultGrid, 0, 1, event_handler, TAG_ATTACH(TAG_intelliSENS));
 }
 
+/**
+ * @brief Create the objects of the screen on the first load.
+ */
+static void CreateScreen(void)
+{
+	if (screen != NULL)
+		return;
+	// create the screen
+	screen = lv_obj_create(NULL);
+
+	// create basic grid
+	static lv_coord_t rowsScreen[] = {60, LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+	static lv_coord_t colsScreen[] = {LV_GRID_FR(MEASUREMENT_AREA_RATIO), LV_GRID_FR(APP_AREA_RATIO), LV_GRID_TEMPLATE_LAST};
+	lv_obj_t* screenGrid = lv_grid_create_general(screen, colsScreen, rowsScreen, &lvStyleStore.defaultGrid, NULL, NULL, NULL);
+	lv_obj_set_size(screenGrid, DISPLAY_WIDTH_RAM, DISPLAY_HEIGHT_RAM);
+
+	Header_Create(screenGrid);
+	MeasurementGrid_Create(screenGrid);
+	MainScreen_CreateAppArea(screenGrid, 1, 1);
+}
+
 static void Load(void)
 {
+	directLayer.data = Image_Load(&intelliSENS_logo_info);
+	CreateScreen();
 	lv_scr_load(screen);
 	isActive = true;
 }
@@ -622,21 +698,51 @@ static void Unload(void)
 	}
 }
 
+/**
+ * @brief Refresh the measurement cells with changed values.
+ * @details Only the channels with updated statistics are evaluated. A cell is redrawn when the type or unit of the
+ * measurement changes, or when its value changes beyond @ref MEASUREMENT_DISPLAY_HYSTERESIS, but not more often than
+ * @ref MEASUREMENT_MIN_UPDATE_INTERVAL_ms. The label is only set if the formatted text differs, so LVGL invalidates
+ * the minimum number of areas.
+ */
 static void MeasurementArea_Refresh(void)
 {
+#if IS_ADC_STATS_CORE && ADC_BULK_STATS
+	uint32_t updated = __atomic_exchange_n(&dispMeasures.updatedChannels, 0, __ATOMIC_RELAXED);
+#else
+	uint32_t updated = 0xFFFF;
+#endif
+	uint32_t tick = HAL_GetTick();
 	for (int i = 0; i < 16; i++)
 	{
+		ch_disp_t* disp = &chDisplay[i];
+		bool isConfigChanged = disp->lastType != dispMeasures.chMeasures[i].type || disp->lastUnit != dispMeasures.adcInfo->units[i];
+		if (updated & (1U << i))
+			disp->isPending = true;
+		if (!isConfigChanged && (!disp->isPending || (tick - disp->lastUpdateTick) < MEASUREMENT_MIN_UPDATE_INTERVAL_ms))
+			continue;
+
 		measure_type_t type = dispMeasures.chMeasures[i].type;
-		float* stats = ((float*)&dispMeasures.adcInfo->stats[i]);
+		float value = ((float*)&dispMeasures.adcInfo->stats[i])[(uint8_t)type];
+		disp->isPending = false;
+		if (!isConfigChanged && fabsf(value - disp->shownValue) <= fabsf(disp->shownValue) * MEASUREMENT_DISPLAY_HYSTERESIS)
+			continue;
+
 		char txt[10];
-		ftoa_custom(stats[(uint8_t)type], txt, 4, 1);
-		lv_label_set_text(chDisplay[i].lblValue, txt);
+		ftoa_custom(value, txt, 4, 1);
+		disp->shownValue = value;
+		disp->lastUpdateTick = tick;
+		if (strcmp(txt, disp->txt) != 0)
+		{
+			strcpy(disp->txt, txt);
+			lv_label_set_text(disp->lblValue, txt);
+		}
 
-		if (chDisplay[i].lastType == dispMeasures.chMeasures[i].type && chDisplay[i].lastUnit == dispMeasures.adcInfo->units[i])
+		if (!isConfigChanged)
 			continue;
 
-		chDisplay[i].lastType = dispMeasures.chMeasures[i].type;
-		chDisplay[i].lastUnit = dispMeasures.adcInfo->units[i];
+		disp->lastType = dispMeasures.chMeasures[i].type;
+		disp->lastUnit = dispMeasures.adcInfo->units[i];
 
 		SelectMeasurementColor(i);
 	}
@@ -685,32 +791,13 @@ static screen_type_t Refresh(void)
  */
 void MainScreen_Init(screens_t* _screen)
 {
-	static ltdc_layer_info_t directLayer =
-	{
-			.xAlign = ALIGN_RIGHT_X,
-			.yAlign = ALIGN_UP_Y,
-			.posY = 12
-	};
+	// the image is decoded on loading
 	directLayer.posX = 10;
 	directLayer.PixelFormat = intelliSENS_logo_info.pixelFormat;
 	directLayer.width = intelliSENS_logo_info.width;
 	directLayer.height = intelliSENS_logo_info.height;
-	directLayer.data = intelliSENS_logo_info.data;
-
-	// Make the screen
-	// create the screen
-	screen = lv_obj_create(NULL);
-
-	// create basic grid
-	static lv_coord_t rowsScreen[] = {60, LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
-	static lv_coord_t colsScreen[] = {LV_GRID_FR(MEASUREMENT_AREA_RATIO), LV_GRID_FR(APP_AREA_RATIO), LV_GRID_TEMPLATE_LAST};
-	lv_obj_t* screenGrid = lv_grid_create_general(screen, colsScreen, rowsScreen, &lvStyleStore.defaultGrid, NULL, NULL, NULL);
-	lv_obj_set_size(screenGrid, DISPLAY_WIDTH_RAM, DISPLAY_HEIGHT_RAM);
-
-	Header_Create(screenGrid);
-	MeasurementGrid_Create(screenGrid);
-	MainScreen_CreateAppArea(screenGrid, 1, 1);
 
+	// The screen is created on the first load
 	_screen->Refresh = Refresh;
 	_screen->Load = Load;
 	_screen->Unload = Unload;
@@ -27,6 +27,7 @@
 #include "screen_manager.h"
 #include "stdlib.h"
 #include "shared_memory.h"
+#include "pecontroller_adc.h"
 /********************************************************************************
  * Defines
  *******************************************************************************/
@@ -45,6 +46,10 @@
 static screens_t screens[SCREEN_COUNT] = { 0 };
 static screen_type_t screenIdx = SCREEN_NONE;
 static DisplayLayer dispLayer = NULL;
+static screen_manager_stats_t stats = {0};
+static uint32_t switchStartTick = 0;
+static screen_type_t history[SCREEN_COUNT];
+static int historyCount = 0;
 /********************************************************************************
  * Global Variables
  *******************************************************************************/
@@ -84,6 +89,11 @@ extern void IntellisensScreen_Init(screens_t* screen);
  * @param *screen Pointer to fill the screen information
  */
 extern void AppInfoScreen_Init(screens_t* screen);
+/**
+ * @brief Initialize screen
+ * @param *screen Pointer to fill the screen information
+ */
+extern void TasksScreen_Init(screens_t* screen);
 /********************************************************************************
  * Code
  *******************************************************************************/
@@ -94,6 +104,7 @@ static void Screens_Init(void)
 	ConfigScreen_Init(&screens[SCREEN_CONF]);
 	IntellisensScreen_Init(&screens[SCREEN_intelliSENS]);
 	AppInfoScreen_Init(&screens[SCREEN_APPINFO]);
+	TasksScreen_Init(&screens[SCREEN_TASKS]);
 }
 
 static void Measurements_Init(adc_info_t* _adcInfo)
@@ -104,6 +115,40 @@ static void Measurements_Init(adc_info_t* _adcInfo)
 	dispMeasures.chNames = chNames;
 }
 
+#if IS_ADC_STATS_CORE && ADC_BULK_STATS
+/**
+ * @brief Marks the channels with updated statistics for the refresh of the measurements.
+ * @param channelMask Mask of the channels with updated statistics. Bit 0 represents the first channel.
+ */
+void BSP_ADC_StatsUpdatedCallback(uint32_t channelMask)
+{
+	__atomic_fetch_or(&dispMeasures.updatedChannels, channelMask, __ATOMIC_RELAXED);
+}
+#endif
+
+/**
+ * @brief This function is called when the measurement settings are changed from the screens, e.g. to store the new states.
+ * @note A weak implementation of this function is provided. User can create a custom implementation if needed.
+ */
+__weak void ScreenManager_SettingsChangedCallback(void)
+{
+}
+
+/**
+ * @brief Measure the LVGL heap after loading a screen.
+ */
+static void UpdateHeapStats(void)
+{
+#if LV_MEM_CUSTOM == 0
+	lv_mem_monitor_t mon;
+	lv_mem_monitor(&mon);
+	stats.lvMemUsed = mon.total_size - mon.free_size;
+	stats.lvMemFreeBiggest = mon.free_biggest_size;
+	if (stats.lvMemUsed > stats.lvMemMaxUsed)
+		stats.lvMemMaxUsed = stats.lvMemUsed;
+#endif
+}
+
 /**
  * @brief Initialize the screen manager
  * @note This function is automatically called by the BSP. No need to call this function externally
@@ -120,6 +165,7 @@ void ScreenManager_Init(DisplayLayer _dispLayer ,adc_info_t* _adcInfo)
 
 	screenIdx = SCREEN_SPLASH;
 	screens[screenIdx].Load();
+	UpdateHeapStats();
 	dispLayer(screens[screenIdx].lvglLayer, LVGL_LAYER);
 	dispLayer(screens[screenIdx].directLayer, DIRECT_LAYER);
 }
@@ -131,17 +177,34 @@ void ScreenManager_Refresh(void)
 {
 	if (changeMode == 0)
 	{
-		static screen_type_t idxPrevious = SCREEN_MAIN;
 		screen_type_t idxNext = screens[screenIdx].Refresh();
 		if (idxNext == SCREEN_NONE)
 			return;
 
+		// keep the path to the current screen, so that screens opened from each other return along it,
+		// the splash screen is never returned to
 		if (idxNext == SCREEN_PREVIOUS)
-			idxNext = idxPrevious;
-
-		idxPrevious = screenIdx;
+			idxNext = historyCount > 0 ? history[--historyCount] : SCREEN_MAIN;
+		else if (screenIdx == SCREEN_SPLASH)
+			historyCount = 0;
+		else
+		{
+			int i = 0;
+			while (i < historyCount && history[i] != idxNext)
+				i++;
+			if (i < historyCount)
+				historyCount = i;
+			else if (historyCount < SCREEN_COUNT)
+				history[historyCount++] = screenIdx;
+		}
 		writeAtScreenEnd = false;
 		changeMode = 1;
+		switchStartTick = HAL_GetTick();
+
+		// hide the layers before loading, as the new screen may decode its image over the displayed image,
+		// the layers are out of the display once hidden
+		dispLayer(NULL, LVGL_LAYER);
+		dispLayer(NULL, DIRECT_LAYER);
 
 		if(screens[screenIdx].Unload != NULL)
 			screens[screenIdx].Unload();
@@ -150,16 +213,28 @@ void ScreenManager_Refresh(void)
 
 		if(screens[screenIdx].Load != NULL)
 			screens[screenIdx].Load();
-
-		dispLayer(NULL, LVGL_LAYER);
-		dispLayer(NULL, DIRECT_LAYER);
+		UpdateHeapStats();
 	}
 	else if (writeAtScreenEnd)
 	{
 		dispLayer(screens[screenIdx].lvglLayer, LVGL_LAYER);
 		dispLayer(screens[screenIdx].directLayer, DIRECT_LAYER);
 		changeMode = 0;
+
+		stats.switchCount++;
+		stats.lastSwitchTime_ms = HAL_GetTick() - switchStartTick;
+		if (stats.lastSwitchTime_ms > stats.maxSwitchTime_ms)
+			stats.maxSwitchTime_ms = stats.lastSwitchTime_ms;
 	}
 }
 
+/**
+ * @brief Get the metrics of the screen switches.
+ * @param _stats Structure to be filled with the metrics.
+ */
+void ScreenManager_GetStats(screen_manager_stats_t* _stats)
+{
+	*_stats = stats;
+}
+
 /* EOF */
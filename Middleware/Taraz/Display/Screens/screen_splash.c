@@ -40,6 +40,13 @@
 /********************************************************************************
  * Static Variables
  *******************************************************************************/
+static ltdc_layer_info_t directLayer =
+{
+		.xAlign = ALIGN_CENTER_X,
+		.yAlign = ALIGN_CENTER_Y,
+		.posX = DISPLAY_WIDTH / 2,
+		.posY = DISPLAY_HEIGHT / 2
+};
 
 /********************************************************************************
  * Global Variables
@@ -55,6 +62,8 @@ uint32_t tickStart = 0;
 static void Load(void)
 {
 	tickStart = HAL_GetTick();
+	if (splashImg != NULL)
+		directLayer.data = Image_Load(splashImg);
 }
 
 /**
@@ -81,17 +90,10 @@ void SplashScreen_Init(screens_t* _screen)
 		_screen->directLayer = NULL;
 	else
 	{
-		static ltdc_layer_info_t directLayer =
-		{
-				.xAlign = ALIGN_CENTER_X,
-				.yAlign = ALIGN_CENTER_Y,
-				.posX = DISPLAY_WIDTH / 2,
-				.posY = DISPLAY_HEIGHT / 2
-		};
+		// the image is decoded on loading
 		directLayer.PixelFormat = splashImg->pixelFormat;
 		directLayer.width = splashImg->width;
 		directLayer.height = splashImg->height;
-		directLayer.data = splashImg->data;
 		_screen->directLayer = &directLayer;
 	}
 	_screen->lvglLayer = NULL;
@@ -0,0 +1,292 @@
+/**
+ ********************************************************************************
+ * @file    	screen_tasks.c
+ * @author 		Waqas Ehsan Butt
+ * @date    	Oct 18, 2026
+ *
+ * @brief   Displays the run time, scheduling latency and stack usage of the tasks
+ ********************************************************************************
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include "screen_base.h"
+#include "shared_memory.h"
+#include "utility_lib.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/**
+ * @brief Number of columns in the statistics table
+ */
+#define COL_COUNT					(7)
+/**
+ * @brief Maximum length of the text of a column
+ */
+#define COL_TEXT_LEN				(TASK_TELEMETRY_MAX_TASKS * TASK_TELEMETRY_NAME_LEN + 1)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static lv_obj_t* screen;
+static bool isActive;
+static volatile uint8_t tag = TAG_NONE;
+static lv_obj_t* screenGrid = NULL;
+static lv_obj_t* lblSummary = NULL;
+static lv_obj_t* lblCols[COL_COUNT];
+static uint32_t lastUpdateCount;
+static task_telemetry_table_t telemetry;
+static const char* colNames[COL_COUNT] = { "Task", "Priority", "CPU", "Runs/s", "Latency", "Peak", "Free Stack" };
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static void Buttons_Clicked(lv_event_t * e)
+{
+	if (!isActive)
+		return;
+	lv_obj_t * obj = lv_event_get_target(e);
+	tag = lv_btnmatrix_get_selected_btn(obj) ? TAG_CANCEL : TAG_RESET;
+}
+
+static void Buttons_Create(lv_obj_t * parent, int row, int col)
+{
+	static const char* map[] = {"Reset", LV_SYMBOL_OK, NULL};
+
+	lv_obj_t* kb = lv_keyboard_create(parent);
+	lv_obj_set_grid_cell(kb, LV_GRID_ALIGN_CENTER, col, 1, LV_GRID_ALIGN_STRETCH, row, 1);
+	lv_obj_set_style_text_font(kb, &lv_font_montserrat_30, 0);
+	lv_btnmatrix_set_map(kb, map);
+	lv_obj_set_width(kb, 400);
+	lv_obj_add_event_cb(kb, Buttons_Clicked, LV_EVENT_CLICKED, NULL);
+}
+
+static void CreateTable(lv_obj_t * parent)
+{
+	static lv_style_t lblStyleType;
+	static lv_style_t lblStyleValue;
+	static lv_style_t lblStyleSummary;
+	static bool init = false;
+	if (!init)
+	{
+		BSP_Screen_InitLabelStyle(&lblStyleType, &lv_font_montserrat_18, LV_TEXT_ALIGN_LEFT, &themeColors.btn);
+		lv_style_set_text_decor(&lblStyleType, LV_TEXT_DECOR_UNDERLINE);
+		BSP_Screen_InitLabelStyle(&lblStyleValue, &lv_font_montserrat_16, LV_TEXT_ALIGN_LEFT, NULL);
+		BSP_Screen_InitLabelStyle(&lblStyleSummary, &lv_font_montserrat_18, LV_TEXT_ALIGN_LEFT, NULL);
+		init = true;
+	}
+
+	// main grid
+	static lv_coord_t rows[] = {LV_GRID_CONTENT, LV_GRID_FR(1), 80, LV_GRID_TEMPLATE_LAST};
+	lv_obj_t* grid = lv_grid_create_general(parent, singleRowCol, rows, &lvStyleStore.thickMarginGrid, NULL, NULL, NULL);
+	lv_obj_set_grid_cell(grid, LV_GRID_ALIGN_STRETCH, 0, 1, LV_GRID_ALIGN_STRETCH, 1, 1);
+
+	lblSummary = lv_label_create_general(grid, &lblStyleSummary, "Waiting for the task statistics", NULL, NULL);
+	lv_obj_set_grid_cell(lblSummary, LV_GRID_ALIGN_START, 0, 1, LV_GRID_ALIGN_START, 0, 1);
+
+	// each column holds the values of all tasks in a single label, one line per task
+	static lv_coord_t cols[] = {LV_GRID_FR(5), LV_GRID_FR(3), LV_GRID_FR(3), LV_GRID_FR(3), LV_GRID_FR(3), LV_GRID_FR(3),
+			LV_GRID_FR(4), LV_GRID_TEMPLATE_LAST};
+	static lv_coord_t rowsTable[] = {LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_TEMPLATE_LAST};
+	lv_obj_t* table = lv_grid_create_general(grid, cols, rowsTable, &lvStyleStore.defaultGrid, NULL, NULL, NULL);
+	lv_obj_set_grid_cell(table, LV_GRID_ALIGN_STRETCH, 0, 1, LV_GRID_ALIGN_START, 1, 1);
+	for (int i = 0; i < COL_COUNT; i++)
+	{
+		lv_obj_t* lblName = lv_label_create_general(table, &lblStyleType, colNames[i], NULL, NULL);
+		lv_obj_set_grid_cell(lblName, LV_GRID_ALIGN_START, i, 1, LV_GRID_ALIGN_START, 0, 1);
+		lblCols[i] = lv_label_create_general(table, &lblStyleValue, "", NULL, NULL);
+		lv_obj_set_grid_cell(lblCols[i], LV_GRID_ALIGN_START, i, 1, LV_GRID_ALIGN_START, 1, 1);
+	}
+
+	Buttons_Create(grid, 2, 0);
+}
+
+/**
+ * @brief Append a text at the end of a string.
+ * @return Pointer to the terminating character of the string.
+ */
+static char* AppendText(char* txt, const char* src)
+{
+	while (*src)
+		*txt++ = *src++;
+	*txt = 0;
+	return txt;
+}
+
+/**
+ * @brief Append a value with its unit as a new line of the column text.
+ * @return Pointer to the terminating character of the text.
+ */
+static char* AppendLine(char* txt, const char* val, const char* unit)
+{
+	return AppendText(AppendText(AppendText(txt, val), unit), "\n");
+}
+
+/**
+ * @brief Set the text of a label if it has changed, so that only the changed columns are redrawn.
+ */
+static void SetText(lv_obj_t* lbl, const char* txt)
+{
+	if (strcmp(lv_label_get_text(lbl), txt) != 0)
+		lv_label_set_text(lbl, txt);
+}
+
+static void UpdateTable(void)
+{
+	static char colTexts[COL_COUNT][COL_TEXT_LEN];
+	char* txts[COL_COUNT];
+	char val[TASK_TELEMETRY_NAME_LEN];
+	for (int i = 0; i < COL_COUNT; i++)
+	{
+		txts[i] = colTexts[i];
+		*txts[i] = 0;
+	}
+
+	// runs per second are computed from the switch-ins in the period
+	float periodScale = telemetry.period_us ? 1000000.f / telemetry.period_us : 0;
+	for (int i = 0; i < telemetry.taskCount; i++)
+	{
+		task_telemetry_entry_t* entry = &telemetry.tasks[i];
+		txts[0] = AppendLine(txts[0], entry->name, "");
+		utoa_custom(entry->priority, val);
+		txts[1] = AppendLine(txts[1], val, "");
+		ftoa_custom(entry->cpuLoad, val, 4, 2);
+		txts[2] = AppendLine(txts[2], val, " %");
+		utoa_custom((uint32_t)(entry->switchIns * periodScale + 0.5f), val);
+		txts[3] = AppendLine(txts[3], val, "");
+		utoa_custom(entry->maxLatency_us, val);
+		txts[4] = AppendLine(txts[4], val, " us");
+		utoa_custom(entry->peakLatency_us, val);
+		txts[5] = AppendLine(txts[5], val, " us");
+		utoa_custom(entry->stackFree, val);
+		txts[6] = AppendLine(txts[6], val, " B");
+	}
+	for (int i = 0; i < COL_COUNT; i++)
+	{
+		// remove the last line break
+		if (txts[i] != colTexts[i])
+			txts[i][-1] = 0;
+		SetText(lblCols[i], colTexts[i]);
+	}
+
+	char summary[80];
+	char* txt = AppendText(summary, "CPU Load: ");
+	txt += ftoa_custom(telemetry.cpuLoad, txt, 4, 2);
+	txt = AppendText(txt, " %, Tasks: ");
+	txt += utoa_custom(telemetry.totalTasks, txt);
+	if (telemetry.totalTasks > telemetry.taskCount)
+	{
+		txt = AppendText(txt, ", Shown: ");
+		txt += utoa_custom(telemetry.taskCount, txt);
+	}
+	txt = AppendText(txt, ", Period: ");
+	txt += utoa_custom(telemetry.period_us / 1000, txt);
+	AppendText(txt, " ms");
+	SetText(lblSummary, summary);
+}
+
+static screen_type_t Refresh(void)
+{
+	if (isActive)
+	{
+		uint8_t tagBuff = tag;
+		if (tagBuff != TAG_NONE)
+		{
+			tag = TAG_NONE;
+			if (tagBuff == TAG_CANCEL)
+				return SCREEN_PREVIOUS;
+			if (tagBuff == TAG_RESET)
+				TaskTelemetry_RequestReset(&TASK_TELEMETRY);
+		}
+		// the table is only copied after each update of the telemetry
+		if (TASK_TELEMETRY.updateCount != lastUpdateCount)
+		{
+			TaskTelemetry_Read(&TASK_TELEMETRY, &telemetry);
+			lastUpdateCount = telemetry.updateCount;
+			UpdateTable();
+		}
+	}
+	return SCREEN_NONE;
+}
+
+static void CreateScreen()
+{
+	// create basic grid
+	static lv_coord_t rowsScreen[] = {60, LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+	screenGrid = lv_grid_create_general(screen, singleRowCol, rowsScreen, &lvStyleStore.defaultGrid, NULL, NULL, NULL);
+	lv_obj_set_size(screenGrid, DISPLAY_WIDTH_RAM, DISPLAY_HEIGHT_RAM);
+
+	lv_grid_pos_info_t gridInfo = { .col = 0, .row = 0, .colSpan = 1, .rowSpan = 1 };
+	CreateTitle(screenGrid, &gridInfo, "Task Statistics");
+	CreateTable(screenGrid);
+}
+
+static void Load(void)
+{
+	if (screenGrid != NULL)
+	{
+		lv_obj_del(screenGrid);
+		screenGrid = NULL;
+	}
+	CreateScreen();
+	// show the last update right away, if there is any
+	lastUpdateCount = 0;
+	lv_scr_load(screen);
+	isActive = true;
+}
+
+static void Unload(void)
+{
+	isActive = false;
+	if (screenGrid != NULL)
+	{
+		lv_obj_del(screenGrid);
+		screenGrid = NULL;
+	}
+}
+
+/**
+ * @brief Initialize screen
+ * @param _screen Pointer to fill the screen information
+ */
+void TasksScreen_Init(screens_t* _screen)
+{
+	// create the screen, the contents are created on each load
+	screen = lv_obj_create(NULL);
+
+	_screen->Refresh = Refresh;
+	_screen->Load = Load;
+	_screen->Unload = Unload;
+	_screen->directLayer = NULL;
+	_screen->lvglLayer = &defaultLayer;
+}
+
+
+/* EOF */
@@ -0,0 +1,249 @@
+/**
+ ********************************************************************************
+ * @file 		adc_codec.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Lossless block codec for the raw ADC records
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef ADC_CODEC_H_
+#define ADC_CODEC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/** @addtogroup Misc_Library
+ * @{
+ */
+
+/** @defgroup ADC_Codec ADC Codec
+ * @brief Lossless compression of the interleaved 16-bit records of @ref adc_raw_data_t.
+ * @details The records are divided in independent blocks so that any block can be decoded without the previous ones.
+ * Each block starts with a byte aligned @ref ADC_CODEC_HEADER_SIZE bytes header followed by a bit stream containing
+ * the channels one after the other. For each channel the encoder selects the fixed polynomial predictor
+ * (order 0-3) giving the smallest residuals and codes the residuals with the best Rice parameter. The channel is
+ * stored verbatim if coding doesn't save any space, so a block never exceeds @ref ADC_CODEC_MAX_BLOCK_SIZE().
+ * The encoder needs only integer operations and two passes over the block, which keeps it real time on the CM4.
+ *
+ * Bit stream of each channel (bits are packed starting from the LSB of each byte):
+ * <table>
+ * <tr><th>Bits</th><th>Contents</th></tr>
+ * <tr><td>3</td><td>Predictor order (0-3) or @ref ADC_CODEC_VERBATIM</td></tr>
+ * <tr><td>5</td><td>Rice parameter k</td></tr>
+ * <tr><td>16 x order</td><td>Warm-up samples</td></tr>
+ * <tr><td>...</td><td>Rice coded zig-zag residuals. A quotient of @ref ADC_CODEC_ESCAPE_Q ones is followed by
+ * the residual in @ref ADC_CODEC_ESCAPE_BITS bits</td></tr>
+ * </table>
+ * Block header (little-endian):
+ * <table>
+ * <tr><th>Offset</th><th>Contents</th></tr>
+ * <tr><td>0</td><td>@ref ADC_CODEC_SYNC (uint16_t)</td></tr>
+ * <tr><td>2</td><td>Number of channels (uint8_t)</td></tr>
+ * <tr><td>3</td><td>Reserved, zero (uint8_t)</td></tr>
+ * <tr><td>4</td><td>Number of records (uint16_t)</td></tr>
+ * <tr><td>6</td><td>Size of the bit stream in bytes (uint16_t)</td></tr>
+ * <tr><td>8</td><td>Index of the first record in the stream (uint32_t)</td></tr>
+ * </table>
+ * @{
+ */
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include "general_header.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** @defgroup AdcCodec_Exported_Macros Macros
+ * @{
+ */
+/**
+ * @brief Marks the start of each block
+ */
+#define ADC_CODEC_SYNC					(0x5A43u)
+/**
+ * @brief Size of the block header in bytes
+ */
+#define ADC_CODEC_HEADER_SIZE			(12)
+/**
+ * @brief Maximum number of channels in each record
+ */
+#define ADC_CODEC_MAX_CHANNELS			(16)
+/**
+ * @brief Maximum number of records in a block
+ */
+#define ADC_CODEC_MAX_BLOCK_ROWS		(1024)
+/**
+ * @brief Default number of records in a block. Half of the raw ADC ring buffer.
+ */
+#define ADC_CODEC_DEFAULT_BLOCK_ROWS	(128)
+/**
+ * @brief Highest fixed predictor order
+ */
+#define ADC_CODEC_MAX_ORDER				(3)
+/**
+ * @brief Channel mode storing the samples without prediction
+ */
+#define ADC_CODEC_VERBATIM				(7)
+/**
+ * @brief Quotient marking an escaped residual
+ */
+#define ADC_CODEC_ESCAPE_Q				(16)
+/**
+ * @brief Number of bits used by an escaped zig-zag residual. Covers the residuals of all predictor orders.
+ */
+#define ADC_CODEC_ESCAPE_BITS			(20)
+/**
+ * @brief Worst case size of a block in bytes
+ * @details Includes the space written by the encoder before falling back to verbatim storage of the last channel.
+ * @param chCount Number of channels in each record
+ * @param rowCount Number of records in the block
+ */
+#define ADC_CODEC_MAX_BLOCK_SIZE(chCount, rowCount)		(ADC_CODEC_HEADER_SIZE + (chCount) * (1 + 2 * (rowCount)) + 8)
+#ifndef ADC_CODEC_GET_CYCLES
+#if defined(DWT)
+/**
+ * @brief Cycle counter used to measure the stream encoder.
+ * @details The DWT cycle counter should be enabled, as done by @ref TaskTelemetry_InitCounter().
+ */
+#define ADC_CODEC_GET_CYCLES()			(DWT->CYCCNT)
+#else
+#define ADC_CODEC_GET_CYCLES()			(0)
+#endif
+#endif
+/**
+ * @}
+ */
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/** @defgroup AdcCodec_Exported_Structures Structures
+ * @{
+ */
+/**
+ * @brief Information available in the block header
+ */
+typedef struct
+{
+	uint32_t chCount;			/**< @brief Number of channels in each record */
+	uint32_t rowCount;			/**< @brief Number of records in the block */
+	uint32_t firstRow;			/**< @brief Index of the first record in the stream */
+	uint32_t size;				/**< @brief Total size of the block including the header */
+} adc_codec_block_info_t;
+/**
+ * @brief Encodes the records of a ring buffer as they are acquired.
+ * @details Use with @ref RAW_ADC_DATA to compress the raw ADC data on the CM4.
+ */
+typedef struct
+{
+	const uint16_t* ring;		/**< @brief Start of the ring buffer */
+	uint32_t ringRows;			/**< @brief Number of records in the ring buffer. Should be 2 ^ n */
+	uint32_t chCount;			/**< @brief Number of channels in each record */
+	uint32_t blockRows;			/**< @brief Number of records in each block */
+	volatile int* wrIndex;		/**< @brief Write index of the acquiring side in records */
+	uint32_t rdIndex;			/**< @brief Index of the next record to be encoded */
+	uint32_t rowCount;			/**< @brief Number of records encoded so far */
+	uint64_t byteCount;			/**< @brief Number of bytes generated so far */
+	uint64_t encodeCycles;		/**< @brief Cycles spent in encoding the blocks so far, measured with @ref ADC_CODEC_GET_CYCLES().
+								Divide by <b>rowCount</b> to get the cycles per record */
+	uint32_t maxBlockCycles;	/**< @brief Longest encoding of a block in cycles */
+} adc_codec_stream_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+/** @defgroup AdcCodec_Exported_Functions Functions
+ * @{
+ */
+/**
+ * @brief Encode a block of interleaved records.
+ * @param records Pointer to the first record.
+ * @param chCount Number of channels in each record.
+ * @param rowCount Number of records in the block.
+ * @param firstRow Index of the first record in the stream.
+ * @param dest Destination buffer.
+ * @param destSize Size of the destination buffer. Should be at least @ref ADC_CODEC_MAX_BLOCK_SIZE().
+ * @return Size of the encoded block in bytes. Zero if the parameters are invalid.
+ */
+extern uint32_t AdcCodec_EncodeBlock(const uint16_t* records, uint32_t chCount, uint32_t rowCount, uint32_t firstRow, uint8_t* dest, uint32_t destSize);
+/**
+ * @brief Read the header of a block.
+ * @param src Start of the block.
+ * @param srcSize Number of bytes available.
+ * @param info Filled with the block information.
+ * @return <c>true</c> if the header is valid and the complete block is available else <c>false</c>.
+ */
+extern bool AdcCodec_GetBlockInfo(const uint8_t* src, uint32_t srcSize, adc_codec_block_info_t* info);
+/**
+ * @brief Decode a block to interleaved records.
+ * @param src Start of the block.
+ * @param srcSize Number of bytes available.
+ * @param records Destination for the records.
+ * @param maxRows Number of records the destination can hold.
+ * @param info Filled with the block information. Can be NULL.
+ * @return Number of records decoded. -1 if the block is invalid or doesn't fit in the destination.
+ */
+extern int AdcCodec_DecodeBlock(const uint8_t* src, uint32_t srcSize, uint16_t* records, uint32_t maxRows, adc_codec_block_info_t* info);
+/**
+ * @brief Initialize the stream encoder.
+ * @param stream Stream to be initialized.
+ * @param ring Start of the ring buffer.
+ * @param ringRows Number of records in the ring buffer. Should be 2 ^ n and a multiple of blockRows.
+ * @param chCount Number of channels in each record.
+ * @param wrIndex Write index of the acquiring side in records.
+ * @param blockRows Number of records in each block.
+ * @return <c>true</c> if the configuration is valid else <c>false</c>.
+ */
+extern bool AdcCodec_StreamInit(adc_codec_stream_t* stream, const uint16_t* ring, uint32_t ringRows, uint32_t chCount, volatile int* wrIndex, uint32_t blockRows);
+/**
+ * @brief Encode the next block if enough records are available.
+ * @note Should be called at least once every <b>ringRows - blockRows</b> records to avoid overwritten data.
+ * @param stream Stream encoder.
+ * @param dest Destination buffer.
+ * @param destSize Size of the destination buffer. Should be at least @ref ADC_CODEC_MAX_BLOCK_SIZE().
+ * @return Size of the encoded block in bytes. Zero if no block is available.
+ */
+extern uint32_t AdcCodec_StreamEncode(adc_codec_stream_t* stream, uint8_t* dest, uint32_t destSize);
+/**
+ * @}
+ */
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+
+
+
+
+/**
+ * @}
+ */
+#ifdef __cplusplus
+}
+#endif
+/**
+ * @}
+ */
+#endif
+/* EOF */
@@ -0,0 +1,241 @@
+/**
+ ********************************************************************************
+ * @file 		capture_format.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Binary layout of the ADC capture files shared by the firmware and PC tools
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef CAPTURE_FORMAT_H_
+#define CAPTURE_FORMAT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/** @addtogroup Misc_Library
+ * @{
+ */
+
+/** @defgroup Capture_Format Capture Format
+ * @brief Defines the self-describing binary format used for ADC captures.
+ * @details The file is designed to be memory-mapped directly. All values are little-endian.
+ * <table>
+ * <tr><th>Offset</th><th>Contents</th></tr>
+ * <tr><td>0</td><td>@ref capture_file_header_t (@ref CAPTURE_HEADER_SIZE bytes)</td></tr>
+ * <tr><td>dataOffset</td><td>Raw records, each record containing one uint16_t per channel in the same
+ * interleaved order as @ref adc_raw_data_t.dataRecord. Records are grouped in blocks of @ref CAPTURE_BLOCK_SAMPLES.</td></tr>
+ * <tr><td>overviewOffset[0]</td><td>Min/Max overview with one @ref capture_overview_entry_t per 16 records</td></tr>
+ * <tr><td>overviewOffset[1]</td><td>Min/Max overview with one @ref capture_overview_entry_t per 256 records</td></tr>
+ * <tr><td>overviewOffset[2]</td><td>Min/Max overview with one @ref capture_overview_entry_t per 4096 records</td></tr>
+ * </table>
+ * The overview is appended once the capture is closed. A file with zero sampleCount is an unfinished
+ * capture whose length can be recovered from the file size.
+ * @{
+ */
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include "general_header.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** @defgroup CaptureFormat_Exported_Macros Macros
+ * @{
+ */
+/**
+ * @brief Magic number identifying a capture file ("TCAP")
+ */
+#define CAPTURE_MAGIC					(0x50414354u)
+/**
+ * @brief Current version of the capture file format
+ */
+#define CAPTURE_VERSION					(1)
+/**
+ * @brief Size of the file header in bytes. Kept at page size so that the records are page aligned when memory-mapped.
+ */
+#define CAPTURE_HEADER_SIZE				(4096)
+/**
+ * @brief Maximum number of channels in a single capture file
+ */
+#define CAPTURE_MAX_CHANNELS			(16)
+/**
+ * @brief Maximum length of a channel name including the null character
+ */
+#define CAPTURE_NAME_LEN				(16)
+/**
+ * @brief Maximum length of a unit string including the null character
+ */
+#define CAPTURE_UNIT_LEN				(8)
+/**
+ * @brief Number of records in each fixed-size block
+ * @note Should be 2 ^ n and equal to the decimation of the coarsest overview level.
+ */
+#define CAPTURE_BLOCK_SAMPLES			(4096)
+/**
+ * @brief Number of levels in the overview pyramid
+ */
+#define CAPTURE_OVERVIEW_LEVELS			(3)
+/**
+ * @brief Each overview level reduces the previous level by 2 ^ CAPTURE_OVERVIEW_SHIFT
+ */
+#define CAPTURE_OVERVIEW_SHIFT			(4)
+/**
+ * @brief Get the number of records represented by a single entry of an overview level
+ * @param level Overview level starting from zero
+ */
+#define CAPTURE_OVERVIEW_DECIMATION(level)		(1ull << (CAPTURE_OVERVIEW_SHIFT * ((level) + 1)))
+/**
+ * @brief The capture contains a valid overview pyramid
+ */
+#define CAPTURE_FLAG_OVERVIEW			(0x1u)
+/**
+ * @brief The records are stored as blocks of the @ref ADC_Codec instead of raw values.
+ * @details The blocks follow each other starting at dataOffset and no overview is available.
+ */
+#define CAPTURE_FLAG_COMPRESSED			(0x2u)
+/**
+ * @}
+ */
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/** @defgroup CaptureFormat_Exported_Structures Structures
+ * @{
+ */
+/**
+ * @brief Describes a single channel in the capture.
+ * @details The engineering value of a channel is computed as <b>(raw - offset) * sensitivity</b>, same as the ADC driver.
+ */
+typedef struct
+{
+	char name[CAPTURE_NAME_LEN];		/**< @brief Null terminated channel name */
+	char unit[CAPTURE_UNIT_LEN];		/**< @brief Null terminated unit string */
+	float sensitivity;					/**< @brief Multiplier from raw value to engineering units */
+	float offset;						/**< @brief Raw value representing zero */
+} capture_channel_info_t;
+/**
+ * @brief Header placed at the start of each capture file.
+ */
+typedef struct
+{
+	uint32_t magic;										/**< @brief Should be @ref CAPTURE_MAGIC */
+	uint16_t version;									/**< @brief Format version @ref CAPTURE_VERSION */
+	uint16_t headerSize;								/**< @brief Size of the header in bytes */
+	uint32_t chCount;									/**< @brief Number of channels in each record */
+	uint32_t blockSamples;								/**< @brief Number of records in each block */
+	float fs;											/**< @brief Sampling frequency in Hz */
+	uint32_t flags;										/**< @brief Combination of CAPTURE_FLAG_xxx */
+	uint64_t startTimeUs;								/**< @brief Start time of the capture in microseconds since epoch. Zero if not known */
+	uint64_t sampleCount;								/**< @brief Number of records in the file. Zero for unfinished captures */
+	uint64_t dataOffset;								/**< @brief Byte offset of the first record */
+	uint64_t overviewOffset[CAPTURE_OVERVIEW_LEVELS];	/**< @brief Byte offset of each overview level */
+	uint64_t overviewCount[CAPTURE_OVERVIEW_LEVELS];	/**< @brief Number of entries in each overview level */
+	capture_channel_info_t channels[CAPTURE_MAX_CHANNELS];	/**< @brief Information of each channel */
+	uint8_t reserved[CAPTURE_HEADER_SIZE - 96 - (CAPTURE_MAX_CHANNELS * sizeof(capture_channel_info_t))];	/**< @brief Reserved for future use. Keep zero */
+} capture_file_header_t;
+/**
+ * @brief Single entry of an overview level containing the raw extremes of each channel
+ */
+typedef struct
+{
+	uint16_t min[CAPTURE_MAX_CHANNELS];		/**< @brief Minimum raw value of each channel */
+	uint16_t max[CAPTURE_MAX_CHANNELS];		/**< @brief Maximum raw value of each channel */
+} capture_overview_entry_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+/** @defgroup CaptureFormat_Exported_Functions Functions
+ * @{
+ */
+/**
+ * @brief Initialize the capture header with default values.
+ * @param header Pointer to the header to be initialized.
+ * @param chCount Number of channels in each record.
+ * @param fs Sampling frequency in Hz.
+ */
+extern void CaptureFormat_InitHeader(capture_file_header_t* header, uint32_t chCount, float fs);
+/**
+ * @brief Check if the header represents a capture file supported by this implementation.
+ * @param header Pointer to the header.
+ * @return <c>true</c> if the header is valid else <c>false</c>.
+ */
+extern bool CaptureFormat_IsHeaderValid(const capture_file_header_t* header);
+/**
+ * @brief Get the size of a single record in bytes.
+ * @param header Pointer to the header.
+ * @return Size of the record in bytes.
+ */
+extern uint32_t CaptureFormat_GetRecordSize(const capture_file_header_t* header);
+/**
+ * @brief Get the number of entries required for an overview level.
+ * @param sampleCount Number of records in the capture.
+ * @param level Overview level starting from zero.
+ * @return Number of entries. Partially filled last entries are included.
+ */
+extern uint64_t CaptureFormat_GetOverviewCount(uint64_t sampleCount, int level);
+/**
+ * @brief Reset an overview entry so that any later insertion overwrites its values.
+ * @param entry Pointer to the overview entry.
+ */
+extern void CaptureFormat_ResetOverview(capture_overview_entry_t* entry);
+/**
+ * @brief Insert raw records in an overview entry.
+ * @param entry Pointer to the overview entry.
+ * @param records Pointer to the first record.
+ * @param chCount Number of channels in each record.
+ * @param recordCount Number of records to be inserted.
+ */
+extern void CaptureFormat_InsertRecords(capture_overview_entry_t* entry, const uint16_t* records, uint32_t chCount, uint32_t recordCount);
+/**
+ * @brief Merge multiple overview entries in a single entry.
+ * @param entry Pointer to the destination overview entry.
+ * @param src Pointer to the first source entry.
+ * @param chCount Number of valid channels.
+ * @param count Number of source entries to be merged.
+ */
+extern void CaptureFormat_MergeOverview(capture_overview_entry_t* entry, const capture_overview_entry_t* src, uint32_t chCount, uint32_t count);
+/**
+ * @}
+ */
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+
+
+
+
+/**
+ * @}
+ */
+#ifdef __cplusplus
+}
+#endif
+/**
+ * @}
+ */
+#endif
+/* EOF */
@@ -39,15 +39,30 @@ extern "C" {
 client.dataWordLen = xxxxx; // Set it to the number of 32-bit memory units required.
 client.InitStatesFromStorage = xxxxx; // Set the callback to the local function which can initiate local states.
 client.RefreshStates = xxxxx; // Set the callback to the local function which can refresh local states storage if states are updated .
-//Configure the flash sectors in @ref flash_sector_config_t for both sectors.
-//Configure the client count in @ref state_storage_config_t
+//Configure the flash sectors in @ref flash_sector_config_t for all sectors in the rotation.
+//Configure the sector and client count in @ref state_storage_config_t
+storage.sectorCount = xxxxx;
 storage.clientCount = xxxxx;
 //Initialize storage
 StateStorage_Init(&storageConfig);
 
 //Poll the storage to update states
 StateStorage_Refresh();
+//Wait for the states to be programmed, e.g. before a reset
+StateStorage_Flush(3000);
 @endcode
+ * The states are kept in flash as a log of records, each protected by a CRC. Every sector in the rotation starts
+ * with a sector record, holding the sequence number and the erase count of the sector, followed by a checkpoint
+ * containing all live words of the store. Each refresh then appends a single delta record with only the changed
+ * runs of words, so a refresh is either restored completely or not at all. A new checkpoint is appended once the
+ * deltas written after the last one exceed @ref STATE_STORAGE_REPLAY_FACTOR times the live words, which bounds
+ * the restore to the last checkpoint and the deltas after it. When a sector is full the next sector in the rotation
+ * is erased and started with a checkpoint, so the erases are spread evenly over all sectors.
+ *
+ * The refresh only queues the flash words of its record in a write pipeline and returns. The flash words are
+ * programmed one at a time from the flash interrupt, and the next sector is erased ahead of time once the active
+ * sector is half full, so neither the storage task nor the code fetches from the same bank wait for a complete record
+ * or sector erase. @ref StateStorage_Flush() waits until the queued states are programmed.
  * @{
  */
 /********************************************************************************
@@ -58,6 +73,24 @@ StateStorage_Refresh();
  * Defines
  *******************************************************************************/
 #define STORE_WORD_SIZE				(128)
+/**
+ * @brief Maximum number of flash sectors used in the rotation
+ */
+#define STATE_STORAGE_MAX_SECTORS	(4)
+/**
+ * @brief A checkpoint is written once the words written in delta records since the last checkpoint exceed
+ * this many times the live words of the store
+ */
+#define STATE_STORAGE_REPLAY_FACTOR	(4)
+/**
+ * @brief No of flash operations buffered by the write pipeline
+ * @note Should be a power of 2, large enough for the erase and records of a sector rotation.
+ */
+#define STATE_STORAGE_QUEUE_SIZE	(32)
+/**
+ * @brief Interrupt priority of the flash interrupt completing the queued operations
+ */
+#define STATE_STORAGE_FLASH_IRQ_PRIORITY	(15)
 
 // Computations
 #define STORE_BYTE_SIZE				(STORE_WORD_SIZE * 4)
@@ -136,21 +169,37 @@ for (int i = 0; i < 2; i++)
 typedef struct
 {
 	uint32_t sectorNo;		/**< Sector number */
-	uint32_t index;			/**< Sector index in the flash bank */
+	uint32_t index;			/**< Word index of the next record in the sector */
 	uint32_t byteCount;		/**< No of bytes in a sector */
 	uint32_t bank;			/**< Flash Bank */
 	uint32_t* addr;			/**< Sector start address */
+	uint32_t eraseCount;	/**< No of times the sector has been erased, maintained by the module */
 } flash_sector_config_t;
 /**
  * @brief Defines the state storage configuration.
  */
 typedef struct
 {
-	flash_sector_config_t sectors[2];	/**< Both sectors' information */
+	flash_sector_config_t sectors[STATE_STORAGE_MAX_SECTORS];	/**< Information of the sectors in the rotation */
+	int sectorCount;					/**< No of sectors used in the rotation. 0 uses two sectors */
 	int clientCount;					/**< No of clients for the module */
 	state_storage_client_t* clients;	/**< Client configuration */
 	uint32_t store[STORE_WORD_SIZE];	/**< Data storage for clients' states */
 } state_storage_config_t;
+/**
+ * @brief Counters of the state storage, used for evaluating the flash usage.
+ */
+typedef struct
+{
+	uint32_t sequence;			/**< Sequence number of the active sector */
+	uint32_t restoredWords;		/**< No of words copied from the flash at initialization */
+	uint32_t changedWords;		/**< No of words changed by the clients since initialization */
+	uint32_t programmedWords;	/**< No of words programmed in the flash since initialization */
+	uint32_t deltaCount;		/**< No of delta records written since initialization */
+	uint32_t checkpointCount;	/**< No of checkpoints written since initialization */
+	uint32_t rotationCount;		/**< No of sector rotations since initialization */
+	uint32_t deferredCount;		/**< No of refreshes deferred because the write pipeline was full */
+} state_storage_stats_t;
 /**
  * @}
  */
@@ -166,14 +215,21 @@ typedef struct
  */
 /**
  * @brief This function initializes the state storage according to the application requirements.
- * @details This function utilizes two distinct sectors to retrieve the states of all system components.
- * By using a ping-pong approach, only one sector is active at a time for updating the states.
- * The first packet within each sector either remains empty or contains the states of all system components.
- * If the first packet is not present, the sector is considered empty and will be promptly erased if it hasn't
- * been already. Following the initial packet, subsequent partial data packets are used to update the system states.
+ * @details The sector with the latest valid sequence number is selected. Its last valid checkpoint is copied to
+ * the store and the delta records after it are replayed, so only the record headers of the remaining sector are read.
+ * If the checkpoint of the latest sector is incomplete, the previous sector in the rotation is used instead.
+ * Unused sectors are only erased when the rotation reaches them. The flash interrupt used by the write pipeline
+ * is enabled here, so the flash should be unlocked before.
+ *
+ * If no sector has a valid sector record, the first two sectors are checked for the legacy ping-pong format and the
+ * states are imported from its newest copy. The first refresh writes them as the first checkpoint in the sector after
+ * the newest legacy sector. The newest legacy sector is only erased when the rotation reaches it, after the checkpoint
+ * is programmed, so the states are imported again if the power is lost before.
+ * @note Should not be called again before the pending states are flushed with @ref StateStorage_Flush().
  * @code
 static state_storage_config_t storageConfig = {0};
 // Initialize both sectors
+storageConfig.sectorCount = 2;
 storageConfig.sectors[0].sectorNo = FLASH_SECTOR_TOTAL - 2;
 storageConfig.sectors[1].sectorNo = FLASH_SECTOR_TOTAL - 1;
 for (int i = 0; i < 2; i++)
@@ -230,14 +286,41 @@ StateStorage_Init(&storageConfig);
 extern void StateStorage_Init(state_storage_config_t* _config);
 /**
  * @brief Refreshes the storage state if required.
- * @details Poll this function periodically to refresh the stored states for all parameters. If the index in the
- * sector is 0 or the packet cannot fit within the remaining space in the sector, the \"isFirstSectorPacket\" flag
- * is set. This flag ensures that all parameters are completely flushed to the beginning of the sector.
+ * @details Poll this function periodically to refresh the stored states for all parameters.
  * To obtain the necessary data, each client is prompted to refresh their states using the @ref state_storage_client_t.RefreshStates() function.
  * It is the responsibility of the client to provide the refreshed data, if necessary, and return the size of
- * the updated data. Finally, the partial data will be flushed to the storage flash.
+ * the updated data. The store is then compared with the stored states and the changed words are queued as a
+ * single delta record. If the record doesn't fit in the active sector, the next sector is started with a checkpoint.
+ *
+ * The function doesn't wait for the flash. The queued flash words are programmed one at a time from
+ * @ref FLASH_IRQHandler(). If the write pipeline is full, the refresh is deferred and the changes are merged in
+ * the record of the next refresh. Use @ref StateStorage_Flush() to wait until the states are programmed.
  */
 extern void StateStorage_Refresh(void);
+/**
+ * @brief Check if all queued states are programmed in the flash.
+ * @return <c>true</c> if the write pipeline is empty and no refresh is deferred.
+ */
+extern bool StateStorage_IsCommitted(void);
+/**
+ * @brief Refresh the states and wait until they are programmed in the flash.
+ * @details Use it as a commit barrier, e.g. before a reset. The completion is signaled by the flash interrupt, so it
+ * should not be called with the interrupts disabled or from an interrupt with a higher priority than
+ * @ref STATE_STORAGE_FLASH_IRQ_PRIORITY.
+ * @param timeout Maximum time to wait in milliseconds. A queued sector erase can take more than a second.
+ * @return <c>true</c> if the states are programmed, <c>false</c> if the timeout elapsed.
+ */
+extern bool StateStorage_Flush(uint32_t timeout);
+/**
+ * @brief Get the counters of the state storage.
+ * @param _stats Structure to be filled with the counters.
+ */
+extern void StateStorage_GetStats(state_storage_stats_t* _stats);
+/**
+ * @brief Completes the flash operation in progress and starts the next queued operation.
+ * @details Defined by the module as the handler of the flash interrupt.
+ */
+extern void FLASH_IRQHandler(void);
 /********************************************************************************
  * Code
  *******************************************************************************/
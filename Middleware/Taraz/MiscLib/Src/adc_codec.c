@@ -0,0 +1,443 @@
+/**
+ ********************************************************************************
+ * @file    	adc_codec.c
+ * @author 		Waqas Ehsan Butt
+ * @date    	Oct 18, 2026
+ *
+ * @brief   Lossless block codec for the raw ADC records
+ ********************************************************************************
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include "adc_codec.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/**
+ * @brief Largest Rice parameter required for the residuals
+ */
+#define MAX_RICE_K					(ADC_CODEC_ESCAPE_BITS - 1)
+/**
+ * @brief Compute the residual of a fixed predictor
+ */
+#define RESIDUAL(order, p, i, stride)	((order) == 0 ? (int32_t)(p)[(i) * (stride)] : \
+										(order) == 1 ? (int32_t)(p)[(i) * (stride)] - (int32_t)(p)[((i) - 1) * (stride)] : \
+										(order) == 2 ? (int32_t)(p)[(i) * (stride)] - 2 * (int32_t)(p)[((i) - 1) * (stride)] + (int32_t)(p)[((i) - 2) * (stride)] : \
+										(int32_t)(p)[(i) * (stride)] - 3 * (int32_t)(p)[((i) - 1) * (stride)] + 3 * (int32_t)(p)[((i) - 2) * (stride)] - (int32_t)(p)[((i) - 3) * (stride)])
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief Writes the bit stream starting from the LSB of each byte
+ */
+typedef struct
+{
+	uint8_t* ptr;
+	uint32_t acc;
+	uint32_t bits;
+} bit_writer_t;
+/**
+ * @brief Reads the bit stream starting from the LSB of each byte
+ */
+typedef struct
+{
+	const uint8_t* ptr;
+	const uint8_t* end;
+	uint32_t acc;
+	uint32_t bits;
+	uint32_t overrun;
+} bit_reader_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Append bits to the stream.
+ * @param bw Bit writer.
+ * @param val Value to be written. Should be less than 2 ^ len.
+ * @param len Number of bits to be written. Should not exceed 25.
+ */
+static inline void PutBits(bit_writer_t* bw, uint32_t val, uint32_t len)
+{
+	bw->acc |= val << bw->bits;
+	bw->bits += len;
+	while (bw->bits >= 8)
+	{
+		*bw->ptr++ = (uint8_t)bw->acc;
+		bw->acc >>= 8;
+		bw->bits -= 8;
+	}
+}
+
+static inline void FlushBits(bit_writer_t* bw)
+{
+	if (bw->bits)
+		*bw->ptr++ = (uint8_t)bw->acc;
+	bw->acc = bw->bits = 0;
+}
+
+/**
+ * @brief Fill the accumulator so that at least 25 bits are available.
+ * @details Zeros are inserted after the end of the stream and counted as overrun.
+ */
+static inline void Refill(bit_reader_t* br)
+{
+	while (br->bits <= 24)
+	{
+		if (br->ptr < br->end)
+			br->acc |= (uint32_t)(*br->ptr++) << br->bits;
+		else
+			br->overrun++;
+		br->bits += 8;
+	}
+}
+
+static inline uint32_t GetBits(bit_reader_t* br, uint32_t len)
+{
+	Refill(br);
+	uint32_t val = br->acc & ((1u << len) - 1);
+	br->acc = len == 32 ? 0 : br->acc >> len;
+	br->bits -= len;
+	return val;
+}
+
+static inline uint32_t ZigZag(int32_t e)
+{
+	return ((uint32_t)e << 1) ^ (uint32_t)(e >> 31);
+}
+
+static inline int32_t UnZigZag(uint32_t u)
+{
+	return (int32_t)(u >> 1) ^ -(int32_t)(u & 1);
+}
+
+static inline void WriteU16(uint8_t* dest, uint32_t val)
+{
+	dest[0] = (uint8_t)val;
+	dest[1] = (uint8_t)(val >> 8);
+}
+
+static inline uint32_t ReadU16(const uint8_t* src)
+{
+	return src[0] | ((uint32_t)src[1] << 8);
+}
+
+static inline void PutRice(bit_writer_t* bw, uint32_t u, uint32_t k)
+{
+	uint32_t q = u >> k;
+	if (q >= ADC_CODEC_ESCAPE_Q)
+	{
+		PutBits(bw, (1u << ADC_CODEC_ESCAPE_Q) - 1, ADC_CODEC_ESCAPE_Q);
+		PutBits(bw, u, ADC_CODEC_ESCAPE_BITS);
+	}
+	// unary quotient, stop bit and remainder in a single write if possible
+	else if (q + 1 + k <= 25)
+		PutBits(bw, ((1u << q) - 1) | ((u & ((1u << k) - 1)) << (q + 1)), q + 1 + k);
+	else
+	{
+		PutBits(bw, (1u << q) - 1, q + 1);
+		PutBits(bw, u & ((1u << k) - 1), k);
+	}
+}
+
+static inline uint32_t GetRice(bit_reader_t* br, uint32_t k)
+{
+	Refill(br);
+	uint32_t q = __builtin_ctz(~br->acc);
+	if (q >= ADC_CODEC_ESCAPE_Q)
+	{
+		br->acc >>= ADC_CODEC_ESCAPE_Q;
+		br->bits -= ADC_CODEC_ESCAPE_Q;
+		return GetBits(br, ADC_CODEC_ESCAPE_BITS);
+	}
+	br->acc >>= q + 1;
+	br->bits -= q + 1;
+	return (q << k) | (k ? GetBits(br, k) : 0);
+}
+
+/**
+ * @brief Select the predictor order with the smallest absolute residuals.
+ * @details All orders are compared over the same records so that the warm-up samples don't bias the selection.
+ */
+static uint32_t SelectOrder(const uint16_t* p, uint32_t stride, uint32_t rowCount, uint32_t* sumAbs)
+{
+	uint32_t sums[ADC_CODEC_MAX_ORDER + 1] = {0};
+	int32_t x1 = p[2 * stride], x2 = p[stride], x3 = p[0];
+	for (uint32_t i = ADC_CODEC_MAX_ORDER; i < rowCount; i++)
+	{
+		int32_t x = p[i * stride];
+		int32_t e0 = x;
+		int32_t e1 = x - x1;
+		int32_t e2 = e1 - (x1 - x2);
+		int32_t e3 = e2 - (x1 - 2 * x2 + x3);
+		sums[0] += e0;
+		sums[1] += e1 < 0 ? -e1 : e1;
+		sums[2] += e2 < 0 ? -e2 : e2;
+		sums[3] += e3 < 0 ? -e3 : e3;
+		x3 = x2;
+		x2 = x1;
+		x1 = x;
+	}
+
+	uint32_t order = 0;
+	for (uint32_t i = 1; i <= ADC_CODEC_MAX_ORDER; i++)
+		if (sums[i] < sums[order])
+			order = i;
+	*sumAbs = sums[order];
+	return order;
+}
+
+/**
+ * @brief Write the channel without prediction.
+ */
+static void EncodeVerbatim(bit_writer_t* bw, const uint16_t* p, uint32_t stride, uint32_t rowCount)
+{
+	PutBits(bw, ADC_CODEC_VERBATIM, 8);
+	for (uint32_t i = 0; i < rowCount; i++)
+		PutBits(bw, p[i * stride], 16);
+}
+
+/**
+ * @brief Encode a single channel of the block.
+ * @details The Rice parameter is estimated from the mean of the zig-zag residuals. If the coded channel gets
+ * larger than the verbatim channel the writer is rewound and the channel is stored verbatim instead.
+ */
+static void EncodeChannel(bit_writer_t* bw, const uint16_t* p, uint32_t stride, uint32_t rowCount)
+{
+	uint32_t sumAbs;
+	if (rowCount <= ADC_CODEC_MAX_ORDER)
+	{
+		EncodeVerbatim(bw, p, stride, rowCount);
+		return;
+	}
+	uint32_t order = SelectOrder(p, stride, rowCount, &sumAbs);
+	uint32_t count = rowCount - order;
+	uint32_t k = 0;
+	while (k < MAX_RICE_K && ((uint64_t)count << (k + 1)) < 2ull * sumAbs)
+		k++;
+
+	bit_writer_t start = *bw;
+	const uint8_t* limit = bw->ptr + 1 + 2 * rowCount;
+	PutBits(bw, order | (k << 3), 8);
+	for (uint32_t i = 0; i < order; i++)
+		PutBits(bw, p[i * stride], 16);
+	// Specialized loops keep the predictor selection out of the inner loop
+	uint32_t i = order;
+	switch (order)
+	{
+	case 0: for (; i < rowCount && bw->ptr < limit; i++) PutRice(bw, ZigZag(RESIDUAL(0, p, i, stride)), k); break;
+	case 1: for (; i < rowCount && bw->ptr < limit; i++) PutRice(bw, ZigZag(RESIDUAL(1, p, i, stride)), k); break;
+	case 2: for (; i < rowCount && bw->ptr < limit; i++) PutRice(bw, ZigZag(RESIDUAL(2, p, i, stride)), k); break;
+	default: for (; i < rowCount && bw->ptr < limit; i++) PutRice(bw, ZigZag(RESIDUAL(3, p, i, stride)), k); break;
+	}
+	if (bw->ptr >= limit)
+	{
+		*bw = start;
+		EncodeVerbatim(bw, p, stride, rowCount);
+	}
+}
+
+/**
+ * @brief Encode a block of interleaved records.
+ * @param records Pointer to the first record.
+ * @param chCount Number of channels in each record.
+ * @param rowCount Number of records in the block.
+ * @param firstRow Index of the first record in the stream.
+ * @param dest Destination buffer.
+ * @param destSize Size of the destination buffer. Should be at least @ref ADC_CODEC_MAX_BLOCK_SIZE().
+ * @return Size of the encoded block in bytes. Zero if the parameters are invalid.
+ */
+uint32_t AdcCodec_EncodeBlock(const uint16_t* records, uint32_t chCount, uint32_t rowCount, uint32_t firstRow, uint8_t* dest, uint32_t destSize)
+{
+	if (chCount == 0 || chCount > ADC_CODEC_MAX_CHANNELS || rowCount == 0 || rowCount > ADC_CODEC_MAX_BLOCK_ROWS
+			|| destSize < ADC_CODEC_MAX_BLOCK_SIZE(chCount, rowCount))
+		return 0;
+
+	bit_writer_t bw = { .ptr = dest + ADC_CODEC_HEADER_SIZE, .acc = 0, .bits = 0 };
+	for (uint32_t ch = 0; ch < chCount; ch++)
+		EncodeChannel(&bw, records + ch, chCount, rowCount);
+	FlushBits(&bw);
+
+	uint32_t payload = (uint32_t)(bw.ptr - dest) - ADC_CODEC_HEADER_SIZE;
+	WriteU16(dest, ADC_CODEC_SYNC);
+	dest[2] = (uint8_t)chCount;
+	dest[3] = 0;
+	WriteU16(dest + 4, rowCount);
+	WriteU16(dest + 6, payload);
+	WriteU16(dest + 8, firstRow);
+	WriteU16(dest + 10, firstRow >> 16);
+	return payload + ADC_CODEC_HEADER_SIZE;
+}
+
+/**
+ * @brief Read the header of a block.
+ * @param src Start of the block.
+ * @param srcSize Number of bytes available.
+ * @param info Filled with the block information.
+ * @return <c>true</c> if the header is valid and the complete block is available else <c>false</c>.
+ */
+bool AdcCodec_GetBlockInfo(const uint8_t* src, uint32_t srcSize, adc_codec_block_info_t* info)
+{
+	if (srcSize < ADC_CODEC_HEADER_SIZE || ReadU16(src) != ADC_CODEC_SYNC)
+		return false;
+	info->chCount = src[2];
+	info->rowCount = ReadU16(src + 4);
+	info->size = ReadU16(src + 6) + ADC_CODEC_HEADER_SIZE;
+	info->firstRow = ReadU16(src + 8) | (ReadU16(src + 10) << 16);
+	return info->chCount != 0 && info->chCount <= ADC_CODEC_MAX_CHANNELS && info->rowCount != 0
+			&& info->rowCount <= ADC_CODEC_MAX_BLOCK_ROWS && info->size <= srcSize
+			&& info->size <= ADC_CODEC_MAX_BLOCK_SIZE(info->chCount, info->rowCount);
+}
+
+/**
+ * @brief Decode a block to interleaved records.
+ * @param src Start of the block.
+ * @param srcSize Number of bytes available.
+ * @param records Destination for the records.
+ * @param maxRows Number of records the destination can hold.
+ * @param info Filled with the block information. Can be NULL.
+ * @return Number of records decoded. -1 if the block is invalid or doesn't fit in the destination.
+ */
+int AdcCodec_DecodeBlock(const uint8_t* src, uint32_t srcSize, uint16_t* records, uint32_t maxRows, adc_codec_block_info_t* info)
+{
+	adc_codec_block_info_t temp;
+	if (info == NULL)
+		info = &temp;
+	if (!AdcCodec_GetBlockInfo(src, srcSize, info) || info->rowCount > maxRows)
+		return -1;
+
+	const uint32_t chCount = info->chCount;
+	const uint32_t rowCount = info->rowCount;
+	bit_reader_t br = { .ptr = src + ADC_CODEC_HEADER_SIZE, .end = src + info->size, .acc = 0, .bits = 0, .overrun = 0 };
+	for (uint32_t ch = 0; ch < chCount; ch++)
+	{
+		uint16_t* p = records + ch;
+		uint32_t params = GetBits(&br, 8);
+		uint32_t order = params & 0x7;
+		uint32_t k = params >> 3;
+		if (order == ADC_CODEC_VERBATIM)
+		{
+			for (uint32_t i = 0; i < rowCount; i++)
+				p[i * chCount] = (uint16_t)GetBits(&br, 16);
+			continue;
+		}
+		if (order > ADC_CODEC_MAX_ORDER || k > MAX_RICE_K || order > rowCount)
+			return -1;
+		for (uint32_t i = 0; i < order; i++)
+			p[i * chCount] = (uint16_t)GetBits(&br, 16);
+
+		int32_t x1 = order > 0 ? p[(order - 1) * chCount] : 0;
+		int32_t x2 = order > 1 ? p[(order - 2) * chCount] : 0;
+		int32_t x3 = order > 2 ? p[(order - 3) * chCount] : 0;
+		for (uint32_t i = order; i < rowCount; i++)
+		{
+			int32_t e = UnZigZag(GetRice(&br, k));
+			int32_t x;
+			switch (order)
+			{
+			case 0: x = e; break;
+			case 1: x = e + x1; break;
+			case 2: x = e + 2 * x1 - x2; break;
+			default: x = e + 3 * x1 - 3 * x2 + x3; break;
+			}
+			p[i * chCount] = (uint16_t)x;
+			x3 = x2;
+			x2 = x1;
+			x1 = (uint16_t)x;
+		}
+	}
+
+	// The accumulator holds refill bytes which aren't consumed yet
+	uint32_t unread = br.bits / 8;
+	if (br.overrun > unread)
+		return -1;
+	return (int)rowCount;
+}
+
+/**
+ * @brief Initialize the stream encoder.
+ * @param stream Stream to be initialized.
+ * @param ring Start of the ring buffer.
+ * @param ringRows Number of records in the ring buffer. Should be 2 ^ n and a multiple of blockRows.
+ * @param chCount Number of channels in each record.
+ * @param wrIndex Write index of the acquiring side in records.
+ * @param blockRows Number of records in each block.
+ * @return <c>true</c> if the configuration is valid else <c>false</c>.
+ */
+bool AdcCodec_StreamInit(adc_codec_stream_t* stream, const uint16_t* ring, uint32_t ringRows, uint32_t chCount, volatile int* wrIndex, uint32_t blockRows)
+{
+	if (ringRows == 0 || (ringRows & (ringRows - 1)) != 0 || blockRows == 0 || blockRows > ADC_CODEC_MAX_BLOCK_ROWS
+			|| blockRows >= ringRows || (ringRows % blockRows) != 0 || chCount == 0 || chCount > ADC_CODEC_MAX_CHANNELS)
+		return false;
+	stream->ring = ring;
+	stream->ringRows = ringRows;
+	stream->chCount = chCount;
+	stream->blockRows = blockRows;
+	stream->wrIndex = wrIndex;
+	// Blocks never wrap around the ring if they are aligned to the block size
+	stream->rdIndex = ((uint32_t)*wrIndex / blockRows) * blockRows;
+	stream->rowCount = 0;
+	stream->byteCount = 0;
+	stream->encodeCycles = 0;
+	stream->maxBlockCycles = 0;
+	return true;
+}
+
+/**
+ * @brief Encode the next block if enough records are available.
+ * @note Should be called at least once every <b>ringRows - blockRows</b> records to avoid overwritten data.
+ * @param stream Stream encoder.
+ * @param dest Destination buffer.
+ * @param destSize Size of the destination buffer. Should be at least @ref ADC_CODEC_MAX_BLOCK_SIZE().
+ * @return Size of the encoded block in bytes. Zero if no block is available.
+ */
+uint32_t AdcCodec_StreamEncode(adc_codec_stream_t* stream, uint8_t* dest, uint32_t destSize)
+{
+	uint32_t available = ((uint32_t)*stream->wrIndex - stream->rdIndex) & (stream->ringRows - 1);
+	if (available < stream->blockRows)
+		return 0;
+	uint32_t startCycles = ADC_CODEC_GET_CYCLES();
+	uint32_t size = AdcCodec_EncodeBlock(stream->ring + stream->rdIndex * stream->chCount, stream->chCount,
+			stream->blockRows, stream->rowCount, dest, destSize);
+	if (size == 0)
+		return 0;
+	uint32_t cycles = ADC_CODEC_GET_CYCLES() - startCycles;
+	stream->encodeCycles += cycles;
+	if (cycles > stream->maxBlockCycles)
+		stream->maxBlockCycles = cycles;
+	stream->rdIndex = (stream->rdIndex + stream->blockRows) & (stream->ringRows - 1);
+	stream->rowCount += stream->blockRows;
+	stream->byteCount += size;
+	return size;
+}
+
+/* EOF */
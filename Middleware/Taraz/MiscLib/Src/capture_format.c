@@ -0,0 +1,174 @@
+/**
+ ********************************************************************************
+ * @file    	capture_format.c
+ * @author 		Waqas Ehsan Butt
+ * @date    	Oct 18, 2026
+ *
+ * @brief   Helpers for the ADC capture file format
+ ********************************************************************************
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include "capture_format.h"
+#include <string.h>
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+_Static_assert(sizeof(capture_file_header_t) == CAPTURE_HEADER_SIZE, "Capture header size mismatch");
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Initialize the capture header with default values.
+ * @param header Pointer to the header to be initialized.
+ * @param chCount Number of channels in each record.
+ * @param fs Sampling frequency in Hz.
+ */
+void CaptureFormat_InitHeader(capture_file_header_t* header, uint32_t chCount, float fs)
+{
+	memset(header, 0, sizeof(capture_file_header_t));
+	header->magic = CAPTURE_MAGIC;
+	header->version = CAPTURE_VERSION;
+	header->headerSize = CAPTURE_HEADER_SIZE;
+	header->chCount = chCount > CAPTURE_MAX_CHANNELS ? CAPTURE_MAX_CHANNELS : chCount;
+	header->blockSamples = CAPTURE_BLOCK_SAMPLES;
+	header->fs = fs;
+	header->dataOffset = CAPTURE_HEADER_SIZE;
+	for (int i = 0; i < CAPTURE_MAX_CHANNELS; i++)
+	{
+		header->channels[i].sensitivity = 1.f;
+		header->channels[i].offset = 0;
+	}
+}
+
+/**
+ * @brief Check if the header represents a capture file supported by this implementation.
+ * @param header Pointer to the header.
+ * @return <c>true</c> if the header is valid else <c>false</c>.
+ */
+bool CaptureFormat_IsHeaderValid(const capture_file_header_t* header)
+{
+	return header->magic == CAPTURE_MAGIC && header->version == CAPTURE_VERSION
+			&& header->headerSize == CAPTURE_HEADER_SIZE && header->chCount != 0
+			&& header->chCount <= CAPTURE_MAX_CHANNELS && header->blockSamples == CAPTURE_BLOCK_SAMPLES
+			&& header->dataOffset >= CAPTURE_HEADER_SIZE;
+}
+
+/**
+ * @brief Get the size of a single record in bytes.
+ * @param header Pointer to the header.
+ * @return Size of the record in bytes.
+ */
+uint32_t CaptureFormat_GetRecordSize(const capture_file_header_t* header)
+{
+	return header->chCount * sizeof(uint16_t);
+}
+
+/**
+ * @brief Get the number of entries required for an overview level.
+ * @param sampleCount Number of records in the capture.
+ * @param level Overview level starting from zero.
+ * @return Number of entries. Partially filled last entries are included.
+ */
+uint64_t CaptureFormat_GetOverviewCount(uint64_t sampleCount, int level)
+{
+	uint64_t decimation = CAPTURE_OVERVIEW_DECIMATION(level);
+	return (sampleCount + decimation - 1) / decimation;
+}
+
+/**
+ * @brief Reset an overview entry so that any later insertion overwrites its values.
+ * @param entry Pointer to the overview entry.
+ */
+void CaptureFormat_ResetOverview(capture_overview_entry_t* entry)
+{
+	for (int i = 0; i < CAPTURE_MAX_CHANNELS; i++)
+	{
+		entry->min[i] = 0xFFFF;
+		entry->max[i] = 0;
+	}
+}
+
+#pragma GCC push_options
+#pragma GCC optimize ("-Ofast")
+/**
+ * @brief Insert raw records in an overview entry.
+ * @param entry Pointer to the overview entry.
+ * @param records Pointer to the first record.
+ * @param chCount Number of channels in each record.
+ * @param recordCount Number of records to be inserted.
+ */
+void CaptureFormat_InsertRecords(capture_overview_entry_t* entry, const uint16_t* records, uint32_t chCount, uint32_t recordCount)
+{
+	while (recordCount--)
+	{
+		for (uint32_t i = 0; i < chCount; i++)
+		{
+			uint16_t val = records[i];
+			if (entry->min[i] > val)
+				entry->min[i] = val;
+			if (entry->max[i] < val)
+				entry->max[i] = val;
+		}
+		records += chCount;
+	}
+}
+
+/**
+ * @brief Merge multiple overview entries in a single entry.
+ * @param entry Pointer to the destination overview entry.
+ * @param src Pointer to the first source entry.
+ * @param chCount Number of valid channels.
+ * @param count Number of source entries to be merged.
+ */
+void CaptureFormat_MergeOverview(capture_overview_entry_t* entry, const capture_overview_entry_t* src, uint32_t chCount, uint32_t count)
+{
+	while (count--)
+	{
+		for (uint32_t i = 0; i < chCount; i++)
+		{
+			if (entry->min[i] > src->min[i])
+				entry->min[i] = src->min[i];
+			if (entry->max[i] < src->max[i])
+				entry->max[i] = src->max[i];
+		}
+		src++;
+	}
+}
+#pragma GCC pop_options
+
+/* EOF */
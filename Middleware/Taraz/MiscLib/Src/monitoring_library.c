@@ -122,8 +122,8 @@ uint32_t Stats_Compute_MultiSample_SingleChannel_16offset(float* data, temp_stat
 	}
 	else
 	{
-		loopCount = sampleCount;
-		tempStats->samplesLeft -= loopCount;
+		loopCount = sampleCount - 1;
+		tempStats->samplesLeft -= sampleCount;
 	}
 
 	// First loop for copying data
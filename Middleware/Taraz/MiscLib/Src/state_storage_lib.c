@@ -18,10 +18,10 @@
  *                        www.opensource.org/licenses/BSD-3-Clause</center>
  *
  * @details
- * This file uses two memory sectors to record the required states of the program.
- * First call @ref StateStorage_Init() to initialize the library according to the
- * application requirements. Periodically call StateStorage_Refresh() to update the
- * application state storage whenever needed.
+ * This file records the required states of the program as a log of records in a
+ * rotation of flash sectors. First call @ref StateStorage_Init() to initialize the
+ * library according to the application requirements. Periodically call
+ * StateStorage_Refresh() to update the application state storage whenever needed.
  ********************************************************************************
  */
 
@@ -29,34 +29,108 @@
  * Includes
  *******************************************************************************/
 #include "state_storage_lib.h"
+#include "ring_buffer.h"
 /********************************************************************************
  * Defines
  *******************************************************************************/
 #define EMPTY_WORD						(0xFFFFFFFF)
-#define HEADER_WORD_SIZE				(2)
-#define FOOTER_WORD_SIZE				(1)
 #define FLASH_BYTE_ALIGNMENT			(32)
 #define STORAGE_HEADER_VALUE			(0xA5A5A5A5)
 #define STORAGE_FOOTER_VALUE			(0x5A5A5A5A)
+/**
+ * @brief Records consist of a header word, a key word, the payload, padding and a CRC in the last word
+ */
+#define RECORD_TAG						(0x5AU)
+#define RECORD_SECTOR					(1U)
+#define RECORD_CHECKPOINT				(2U)
+#define RECORD_DELTA					(3U)
+#define RECORD_OVERHEAD_WORDS			(3)
+#define SECTOR_RECORD_LEN				(2)
+/**
+ * @brief Runs of changed words separated by up to this many unchanged words are merged
+ */
+#define DELTA_MERGE_GAP					(2)
+/**
+ * @brief Index of a queued operation erasing the complete sector
+ */
+#define ERASE_OPERATION					(0xFFFFFFFF)
 
 // Computations
-#define EXTRA_WORDS						(HEADER_WORD_SIZE + FOOTER_WORD_SIZE)
 #define FLASH_WORD_ALIGNMENT			(FLASH_BYTE_ALIGNMENT / 4)
-#define GET_FLASH_ALIGNED_SIZE(size)	((size + EXTRA_WORDS - 1) + (FLASH_WORD_ALIGNMENT - ((size + EXTRA_WORDS - 1) % FLASH_WORD_ALIGNMENT)))
 #define GET_LOCAL_LEN(size)				(size ? size + 2 : 0)
+#define RECORD_HEADER(type, len)		((RECORD_TAG << 24) | ((type) << 16) | (len))
+#define GET_RECORD_TAG(header)			((header) >> 24)
+#define GET_RECORD_TYPE(header)			(((header) >> 16) & 0xFF)
+#define GET_RECORD_LEN(header)			((header) & 0xFFFF)
+#define GET_RECORD_WORDS(len)			((((len) + RECORD_OVERHEAD_WORDS + FLASH_WORD_ALIGNMENT - 1) / FLASH_WORD_ALIGNMENT) * FLASH_WORD_ALIGNMENT)
+#define GET_RECORD_OPS(len)				(GET_RECORD_WORDS(len) / FLASH_WORD_ALIGNMENT)
+#define RUN_HEADER(start, len)			((start) | ((len) << 16))
+#define GET_RUN_START(run)				((run) & 0xFFFF)
+#define GET_RUN_LEN(run)				((run) >> 16)
+/**
+ * @brief Words of a packet of the legacy ping-pong format, i.e. the length and index, the data and the length again
+ * in the last word, always padded with at least one more word
+ */
+#define GET_LEGACY_PACKET_WORDS(len)	((len) + 2 + (FLASH_WORD_ALIGNMENT - (((len) + 2) % FLASH_WORD_ALIGNMENT)))
 /********************************************************************************
  * Typedefs
  *******************************************************************************/
 
+#if (STATE_STORAGE_QUEUE_SIZE & (STATE_STORAGE_QUEUE_SIZE - 1)) != 0 || \
+	STATE_STORAGE_QUEUE_SIZE <= (1 + GET_RECORD_OPS(SECTOR_RECORD_LEN) + GET_RECORD_OPS(STORE_WORD_SIZE))
+#error "STATE_STORAGE_QUEUE_SIZE should be a power of 2 able to hold a complete sector rotation"
+#endif
 /********************************************************************************
  * Structures
  *******************************************************************************/
-
+/**
+ * @brief Flash operation queued in the write pipeline
+ */
+typedef struct
+{
+	flash_sector_config_t* sector;			/**< Sector of the operation */
+	uint32_t index;							/**< Word index of the flash word in the sector, @ref ERASE_OPERATION for a sector erase */
+	uint32_t data[FLASH_WORD_ALIGNMENT];	/**< Flash word to be programmed, kept static so that its address can be passed to the HAL */
+} flash_op_t;
 /********************************************************************************
  * Static Variables
  *******************************************************************************/
 static state_storage_config_t* config;
 static int sectorIndex = -1;
+static int sectorCount;
+/**
+ * @brief No of words of the store used by the clients
+ */
+static uint32_t liveWords;
+/**
+ * @brief No of words written in delta records since the last checkpoint
+ */
+static uint32_t deltaWords;
+static volatile bool isRotationNeeded;
+/**
+ * @brief Copy of the states as stored in the flash
+ */
+static uint32_t persisted[STORE_WORD_SIZE];
+static state_storage_stats_t stats;
+/**
+ * @brief Write pipeline, the operation at the read index is in progress while the flash is busy
+ */
+static flash_op_t ops[STATE_STORAGE_QUEUE_SIZE];
+static ring_buffer_t opsBuff = { .modulo = STATE_STORAGE_QUEUE_SIZE - 1 };
+static volatile bool isFlashBusy;
+static volatile bool isOperationDone;
+/**
+ * @brief Sector in the rotation whose erase is already queued, -1 if none
+ */
+static int preErasedSector = -1;
+static bool isRefreshDeferred;
+static uint32_t flashWordCount;
+static uint32_t recordCrc;
+static const uint32_t crcTable[16] =
+{
+		0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+		0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
 /********************************************************************************
  * Global Variables
  *******************************************************************************/
@@ -76,11 +150,6 @@ static int GetSectorWordSize(flash_sector_config_t* sector)
 	return sector->byteCount / 4;
 }
 
-static inline bool IsSectorEmpty(flash_sector_config_t* sector)
-{
-	return sector->addr[0] == EMPTY_WORD;
-}
-
 static bool IsSectorErased(flash_sector_config_t* sector)
 {
 	int wordSize = GetSectorWordSize(sector);
@@ -93,140 +162,273 @@ static bool IsSectorErased(flash_sector_config_t* sector)
 	return true;
 }
 
-static void EraseSector(flash_sector_config_t* sector)
-{
-	sector->index = 0;
-	FLASH_Erase_Sector(sector->sectorNo, sector->bank, FLASH_VOLTAGE_RANGE_4);
-}
-
-static void EraseSectorIfRequired(flash_sector_config_t* sector)
+/**
+ * @brief Get the no of operations that can still be queued in the write pipeline.
+ */
+static uint32_t GetFreeOps(void)
 {
-	sector->index = 0;
-	if (IsSectorErased(sector) == false)
-		EraseSector(sector);
+	return opsBuff.modulo - ((opsBuff.wrIndex - opsBuff.rdIndex) & opsBuff.modulo);
 }
 
-static int GetSectorWordCount(flash_sector_config_t* sector)
+/**
+ * @brief Start the next queued flash operation.
+ * @details Called from the storage task if the flash is idle and from @ref FLASH_IRQHandler() once the last
+ * operation is completed. Operations rejected by the HAL are dropped and a sector rotation is requested.
+ */
+static void StartNextOperation(void)
 {
-	int wordSize = GetSectorWordSize(sector);
-	while (wordSize--)
+	while (!RingBuffer_IsEmpty(&opsBuff))
 	{
-		if(sector->addr[wordSize] != EMPTY_WORD)
-			break;
+		flash_op_t* op = &ops[opsBuff.rdIndex];
+		HAL_StatusTypeDef status;
+		isFlashBusy = true;
+		if (op->index == ERASE_OPERATION)
+		{
+			FLASH_EraseInitTypeDef erase =
+			{
+					.TypeErase = FLASH_TYPEERASE_SECTORS,
+					.Banks = op->sector->bank,
+					.Sector = op->sector->sectorNo,
+					.NbSectors = 1,
+					.VoltageRange = FLASH_VOLTAGE_RANGE_4
+			};
+			status = HAL_FLASHEx_Erase_IT(&erase);
+		}
+		else
+			status = HAL_FLASH_Program_IT(FLASH_TYPEPROGRAM_FLASHWORD, (uint32_t)(op->sector->addr + op->index), (uint32_t)op->data);
+		if (status == HAL_OK)
+			return;
+		isRotationNeeded = true;
+		RingBuffer_Read(&opsBuff);
 	}
-	return wordSize + 1;
+	isFlashBusy = false;
 }
 
-static int GetSectorWordsLeft(flash_sector_config_t* sector)
+/**
+ * @brief Queue the erase of a sector.
+ */
+static void QueueErase(flash_sector_config_t* sector)
 {
-	int wordSize = GetSectorWordSize(sector);
-	return wordSize - sector->index;
+	flash_op_t* op = &ops[opsBuff.wrIndex];
+	op->sector = sector;
+	op->index = ERASE_OPERATION;
+	sector->eraseCount++;
+	__DMB();
+	RingBuffer_Write(&opsBuff);
 }
 
-static int HasEnoughSpace(flash_sector_config_t* sector, int wordSize)
+/**
+ * @brief Update the CRC-32 with a word, processed from the least significant nibble.
+ */
+static inline uint32_t UpdateCrc(uint32_t crc, uint32_t word)
 {
-	return GetSectorWordsLeft(sector) > GET_FLASH_ALIGNED_SIZE(wordSize);
+	for (int i = 0; i < 8; i++, word >>= 4)
+		crc = (crc >> 4) ^ crcTable[(crc ^ word) & 0xF];
+	return crc;
 }
 
-static bool IsFirstSectorPacketValid(flash_sector_config_t* _sector)
+static uint32_t GetRecordCrc(const uint32_t* record, uint32_t len)
 {
-	uint32_t* addr0 = _sector->addr;
-	uint32_t packageSize = GET_FLASH_ALIGNED_SIZE(STORE_WORD_SIZE);
-
-
-	return (addr0[0] != STORE_WORD_SIZE ||
-			addr0[packageSize - 1] != STORE_WORD_SIZE ||
-			addr0[1] != 0 ||
-			addr0[2] != STORAGE_HEADER_VALUE) ? false : true; //addr0[STORE_WORD_SIZE + 3] != STORAGE_FOOTER_VALUE
+	uint32_t crc = EMPTY_WORD;
+	for (uint32_t i = 0; i < len + 2; i++)
+		crc = UpdateCrc(crc, record[i]);
+	return ~crc;
 }
 
-static int GetInitialSector(void)
+/**
+ * @brief Get the size of the record at the index of the sector from its header.
+ * @return No of words occupied by the record, 0 if the header is invalid.
+ */
+static uint32_t GetRecordWords(flash_sector_config_t* sector, uint32_t index)
 {
-	bool isSectorValid[2];
-	int _sectorIndex = -1;
-	int sectorCount[2];
-	isSectorValid[0] = IsFirstSectorPacketValid(&config->sectors[0]);
-	isSectorValid[1] = IsFirstSectorPacketValid(&config->sectors[1]);
+	uint32_t header = sector->addr[index];
+	uint32_t words = GET_RECORD_WORDS(GET_RECORD_LEN(header));
+	if (GET_RECORD_TAG(header) != RECORD_TAG || index + words > (uint32_t)GetSectorWordSize(sector))
+		return 0;
+	return words;
+}
 
-	// if both sectors have valid data select the one to use and erase the other one if required
-	if (isSectorValid[0] && isSectorValid[1])
-	{
-		sectorCount[0] = GetSectorWordCount(&config->sectors[0]);
-		sectorCount[1] = GetSectorWordCount(&config->sectors[1]);
+static bool IsRecordValid(flash_sector_config_t* sector, uint32_t index)
+{
+	const uint32_t* record = sector->addr + index;
+	uint32_t len = GET_RECORD_LEN(record[0]);
+	return record[GET_RECORD_WORDS(len) - 1] == GetRecordCrc(record, len);
+}
 
-		_sectorIndex = sectorCount[0] < sectorCount[1] ? 0 : 1;
-		EraseSectorIfRequired(&config->sectors[_sectorIndex == 0 ? 1 : 0]);
-	}
-	else if (isSectorValid[0])
+/**
+ * @brief Read the sequence number and the erase count from the sector record.
+ * @return <c>true</c> if the sector starts with a valid sector record.
+ */
+static bool ReadSectorRecord(flash_sector_config_t* sector, uint32_t* sequence)
+{
+	uint32_t* addr = sector->addr;
+	sector->index = 0;
+	if (addr[0] != RECORD_HEADER(RECORD_SECTOR, SECTOR_RECORD_LEN) || !IsRecordValid(sector, 0))
 	{
-		_sectorIndex = 0;
-		EraseSectorIfRequired(&config->sectors[1]);
+		sector->eraseCount = 0;
+		return false;
 	}
-	else if (isSectorValid[1])
-		{
-			_sectorIndex = 1;
-			EraseSectorIfRequired(&config->sectors[0]);
-		}
-	else
+	*sequence = addr[2];
+	sector->eraseCount = addr[3];
+	return true;
+}
+
+/**
+ * @brief Apply the runs of a delta record to the store.
+ * @return <c>true</c> if all runs are within the store.
+ */
+static bool ApplyDelta(const uint32_t* record)
+{
+	uint32_t runCount = record[1];
+	const uint32_t* data = record + 2;
+	const uint32_t* end = data + GET_RECORD_LEN(record[0]);
+	while (runCount--)
 	{
-		EraseSectorIfRequired(&config->sectors[0]);
-		EraseSectorIfRequired(&config->sectors[1]);
+		uint32_t start = GET_RUN_START(*data);
+		uint32_t len = GET_RUN_LEN(*data++);
+		if (start + len > STORE_WORD_SIZE || data + len > end)
+			return false;
+		memcpy(config->store + start, data, len * 4);
+		data += len;
+		stats.restoredWords += len;
 	}
-	return _sectorIndex;
+	return true;
 }
 
-static void FillDataFromSector(flash_sector_config_t* sector)
+/**
+ * @brief Restore the store from the last valid checkpoint of the sector and the delta records after it.
+ * @details Only the record headers are read up to the last checkpoint. A record with an invalid header or CRC can only be
+ * the result of an interrupted write, so the replay stops there and the next sector is started at the next refresh.
+ * @return <c>true</c> if a valid checkpoint is found.
+ */
+static bool RestoreFromSector(flash_sector_config_t* sector)
 {
-	uint32_t* addr = sector->addr;
-	uint32_t* endAddr = addr + (sector->byteCount / 4);
-	while(addr < endAddr)
+	uint32_t wordSize = GetSectorWordSize(sector);
+	uint32_t checkpoints[2] = { 0, 0 };
+	uint32_t index = 0;
+	while (index < wordSize && sector->addr[index] != EMPTY_WORD)
 	{
-		if (*addr == EMPTY_WORD)
-			break;
-		/****** Basic Validation *****/
-		uint32_t* addr0 = addr;
-		int dataLen = *addr++;
-		// Skip further writes in sector if invalid start and end length,
-		// as both should match
-		if (dataLen > STORE_WORD_SIZE || dataLen <= 0)
+		uint32_t words = GetRecordWords(sector, index);
+		if (words == 0)
 		{
-			addr = endAddr;
+			isRotationNeeded = true;
 			break;
 		}
-		uint32_t packageSize = GET_FLASH_ALIGNED_SIZE(dataLen);
-		if (addr0[packageSize - 1] != dataLen)
+		if (GET_RECORD_TYPE(sector->addr[index]) == RECORD_CHECKPOINT)
 		{
-			addr = endAddr;
-			break;
+			checkpoints[0] = checkpoints[1];
+			checkpoints[1] = index;
 		}
-		uint32_t index = *addr++;
-		// skip sector
-		if (index > (STORE_WORD_SIZE - dataLen))
-		{
-			addr = endAddr;
-			addr = addr0 + packageSize;
+		index += words;
+	}
+	sector->index = index;
+
+	// The last checkpoint can only be incomplete if it is the last record
+	for (int i = 1; i >= 0; i--)
+	{
+		uint32_t recordIndex = checkpoints[i];
+		if (recordIndex == 0 || !IsRecordValid(sector, recordIndex))
 			continue;
+		const uint32_t* record = sector->addr + recordIndex;
+		uint32_t len = GET_RECORD_LEN(record[0]);
+		memcpy(config->store, record + 2, (len > STORE_WORD_SIZE ? STORE_WORD_SIZE : len) * 4);
+		stats.restoredWords += len;
+		deltaWords = 0;
+		for (recordIndex += GET_RECORD_WORDS(len); recordIndex < index; recordIndex += GET_RECORD_WORDS(len))
+		{
+			record = sector->addr + recordIndex;
+			len = GET_RECORD_LEN(record[0]);
+			if (!IsRecordValid(sector, recordIndex) ||
+					(GET_RECORD_TYPE(record[0]) == RECORD_DELTA && !ApplyDelta(record)))
+			{
+				isRotationNeeded = true;
+				break;
+			}
+			deltaWords += len;
+		}
+		return true;
+	}
+	return false;
+}
+
+/**
+ * @brief Check if the sector starts with the complete store, as the sectors of the legacy ping-pong format.
+ */
+static bool IsLegacySectorValid(flash_sector_config_t* sector)
+{
+	const uint32_t* addr = sector->addr;
+	return addr[0] == STORE_WORD_SIZE && addr[1] == 0 && addr[2] == STORAGE_HEADER_VALUE &&
+			addr[GET_LEGACY_PACKET_WORDS(STORE_WORD_SIZE) - 1] == STORE_WORD_SIZE;
+}
+
+/**
+ * @brief Get the no of words of the sector up to the last programmed word.
+ */
+static uint32_t GetUsedWords(flash_sector_config_t* sector)
+{
+	uint32_t wordSize = GetSectorWordSize(sector);
+	while (wordSize && sector->addr[wordSize - 1] == EMPTY_WORD)
+		wordSize--;
+	return wordSize;
+}
+
+/**
+ * @brief Restore the store from the first two sectors if they are written in the legacy ping-pong format.
+ * @details The first packet of a legacy sector contains the complete store, and is followed by the packets of the
+ * changed words. If both sectors are valid the power was lost while switching the sectors, before the old sector was
+ * erased, so the sector with less words is the newer one. The sectors are only read here.
+ * @return Index of the sector restored from, -1 if none of the sectors has the legacy format.
+ */
+static int RestoreFromLegacySectors(void)
+{
+	flash_sector_config_t* sectors = config->sectors;
+	bool isValid[2] = { IsLegacySectorValid(&sectors[0]), IsLegacySectorValid(&sectors[1]) };
+	int legacyIndex;
+	if (isValid[0] && isValid[1])
+		legacyIndex = GetUsedWords(&sectors[0]) < GetUsedWords(&sectors[1]) ? 0 : 1;
+	else if (isValid[0] || isValid[1])
+		legacyIndex = isValid[0] ? 0 : 1;
+	else
+		return -1;
+
+	flash_sector_config_t* sector = &sectors[legacyIndex];
+	const uint32_t* addr = sector->addr;
+	const uint32_t* end = addr + GetSectorWordSize(sector);
+	while (addr < end && addr[0] != EMPTY_WORD)
+	{
+		uint32_t len = addr[0];
+		uint32_t index = addr[1];
+		// The length is repeated in the last word, so an interrupted packet ends the replay
+		if (len == 0 || len > STORE_WORD_SIZE || addr + GET_LEGACY_PACKET_WORDS(len) > end ||
+				addr[GET_LEGACY_PACKET_WORDS(len) - 1] != len)
+			break;
+		if (index <= STORE_WORD_SIZE - len)
+		{
+			memcpy(config->store + index, addr + 2, len * 4);
+			stats.restoredWords += len;
 		}
-		/****** Basic Validation *****/
-		uint32_t* storeLoc = config->store;
-		storeLoc += index;
-		while (dataLen--)
-			*storeLoc++ = *addr++;
-		addr = addr0 + packageSize;
+		addr += GET_LEGACY_PACKET_WORDS(len);
 	}
-	sector->index = addr - sector->addr;
+	return legacyIndex;
 }
 
 /**
  * @brief This function initializes the state storage according to the application requirements.
- * @details This function utilizes two distinct sectors to retrieve the states of all system components.
- * By using a ping-pong approach, only one sector is active at a time for updating the states.
- * The first packet within each sector either remains empty or contains the states of all system components.
- * If the first packet is not present, the sector is considered empty and will be promptly erased if it hasn't
- * been already. Following the initial packet, subsequent partial data packets are used to update the system states.
+ * @details The sector with the latest valid sequence number is selected. Its last valid checkpoint is copied to
+ * the store and the delta records after it are replayed, so only the record headers of the remaining sector are read.
+ * If the checkpoint of the latest sector is incomplete, the previous sector in the rotation is used instead.
+ * Unused sectors are only erased when the rotation reaches them. The flash interrupt used by the write pipeline
+ * is enabled here, so the flash should be unlocked before.
+ *
+ * If no sector has a valid sector record, the first two sectors are checked for the legacy ping-pong format and the
+ * states are imported from its newest copy. The first refresh writes them as the first checkpoint in the sector after
+ * the newest legacy sector. The newest legacy sector is only erased when the rotation reaches it, after the checkpoint
+ * is programmed, so the states are imported again if the power is lost before.
+ * @note Should not be called again before the pending states are flushed with @ref StateStorage_Flush().
  * @code
 static state_storage_config_t storageConfig = {0};
 // Initialize both sectors
+storageConfig.sectorCount = 2;
 storageConfig.sectors[0].sectorNo = FLASH_SECTOR_TOTAL - 2;
 storageConfig.sectors[1].sectorNo = FLASH_SECTOR_TOTAL - 1;
 for (int i = 0; i < 2; i++)
@@ -283,17 +485,59 @@ StateStorage_Init(&storageConfig);
 void StateStorage_Init(state_storage_config_t* _config)
 {
 	config = _config;
+	sectorCount = config->sectorCount ? config->sectorCount : 2;
+	if (sectorCount < 2 || sectorCount > STATE_STORAGE_MAX_SECTORS)
+		Error_Handler();
 
 	// force the initial values of each variable to zero.
 	memset((void*)config->store, 0, STORE_BYTE_SIZE);
-	config->sectors[0].index = config->sectors[1].index = 0;
-
-	sectorIndex = GetInitialSector();
+	memset(&stats, 0, sizeof(stats));
+	isRotationNeeded = false;
+	deltaWords = 0;
+	opsBuff.rdIndex = opsBuff.wrIndex = 0;
+	isFlashBusy = isOperationDone = isRefreshDeferred = false;
+	preErasedSector = -1;
+	HAL_NVIC_SetPriority(FLASH_IRQn, STATE_STORAGE_FLASH_IRQ_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(FLASH_IRQn);
+
+	// Select the sector with the latest sequence number having a valid checkpoint
+	bool isSectorValid[STATE_STORAGE_MAX_SECTORS];
+	uint32_t sequences[STATE_STORAGE_MAX_SECTORS];
+	for (int i = 0; i < sectorCount; i++)
+		isSectorValid[i] = ReadSectorRecord(&config->sectors[i], &sequences[i]);
+	sectorIndex = -1;
+	while (sectorIndex == -1)
+	{
+		int latest = -1;
+		for (int i = 0; i < sectorCount; i++)
+		{
+			if (isSectorValid[i] && (latest == -1 || (int32_t)(sequences[i] - sequences[latest]) > 0))
+				latest = i;
+		}
+		if (latest == -1)
+			break;
+		if (RestoreFromSector(&config->sectors[latest]))
+		{
+			sectorIndex = latest;
+			stats.sequence = sequences[latest];
+		}
+		else
+		{
+			// Interrupted rotation, so restart it from the previous sector
+			isSectorValid[latest] = false;
+			isRotationNeeded = true;
+		}
+	}
 	bool isDataValid = sectorIndex != -1;
-	if (isDataValid)
-		FillDataFromSector(&config->sectors[sectorIndex]);
-	else
-		sectorIndex = 0;
+	if (!isDataValid)
+	{
+		// The rotation writing the first checkpoint starts after the newest legacy sector, so it is erased last
+		int legacyIndex = RestoreFromLegacySectors();
+		isDataValid = legacyIndex != -1;
+		sectorIndex = isDataValid ? legacyIndex : sectorCount - 1;
+		isRotationNeeded = true;
+	}
+	memcpy(persisted, config->store, STORE_BYTE_SIZE);
 
 	uint32_t* storeLoc = config->store;
 	for (int i = 0; i < config->clientCount; i++)
@@ -315,107 +559,311 @@ void StateStorage_Init(state_storage_config_t* _config)
 	}
 
 	// Invalid store size, kindly increase store size
-	if ((storeLoc - (uint32_t*)config->store) > STORE_WORD_SIZE)
+	liveWords = storeLoc - (uint32_t*)config->store;
+	if (liveWords > STORE_WORD_SIZE)
 		Error_Handler();
 }
 
-static void PutDataInFlash(uint32_t* _storeLoc, uint32_t _index, uint32_t _wordSize, bool _isFirstSectorPacket)
+/**
+ * @brief Add a word to the flash word being queued, which is queued once complete.
+ * @details The space in the pipeline is checked before the record is started, so the flash word can be assembled in place.
+ */
+static void ProgramWord(uint32_t word)
 {
-	uint32_t packetWordSize = GET_FLASH_ALIGNED_SIZE(_wordSize);
-	if (_isFirstSectorPacket)
+	flash_op_t* op = &ops[opsBuff.wrIndex];
+	op->data[flashWordCount++] = word;
+	if (flashWordCount == FLASH_WORD_ALIGNMENT)
 	{
-		if (config->sectors[sectorIndex].index != 0)
-			sectorIndex = sectorIndex == 0 ? 1 : 0;
+		flash_sector_config_t* sector = &config->sectors[sectorIndex];
+		op->sector = sector;
+		op->index = sector->index;
+		__DMB();
+		RingBuffer_Write(&opsBuff);
+		sector->index += FLASH_WORD_ALIGNMENT;
+		stats.programmedWords += FLASH_WORD_ALIGNMENT;
+		flashWordCount = 0;
 	}
+}
 
-	if (packetWordSize % FLASH_WORD_ALIGNMENT)
-		Error_Handler();
+static void ProgramRecordWord(uint32_t word)
+{
+	recordCrc = UpdateCrc(recordCrc, word);
+	ProgramWord(word);
+}
+
+static void BeginRecord(uint32_t type, uint32_t key, uint32_t len)
+{
+	recordCrc = EMPTY_WORD;
+	flashWordCount = 0;
+	ProgramRecordWord(RECORD_HEADER(type, len));
+	ProgramRecordWord(key);
+}
+
+static void EndRecord(void)
+{
+	while (flashWordCount != FLASH_WORD_ALIGNMENT - 1)
+		ProgramWord(EMPTY_WORD);
+	ProgramWord(~recordCrc);
+}
 
-	uint32_t packCount = packetWordSize / FLASH_WORD_ALIGNMENT;
+static bool HasEnoughSpace(uint32_t len)
+{
+	flash_sector_config_t* sector = &config->sectors[sectorIndex];
+	return sector->index + GET_RECORD_WORDS(len) <= (uint32_t)GetSectorWordSize(sector);
+}
 
-	// Create first word
-	uint32_t data[FLASH_WORD_ALIGNMENT];
-	data[0] = _wordSize;
-	data[1] = _index;
-	uint32_t len = (FLASH_WORD_ALIGNMENT - HEADER_WORD_SIZE);
-	if (packCount == 1)
+/**
+ * @brief Queue a checkpoint containing all live words of the store.
+ * @return <c>true</c> if queued, <c>false</c> if the write pipeline is full.
+ */
+static bool WriteCheckpoint(void)
+{
+	if (GetFreeOps() < GET_RECORD_OPS(liveWords))
+		return false;
+	BeginRecord(RECORD_CHECKPOINT, 0, liveWords);
+	for (uint32_t i = 0; i < liveWords; i++)
+		ProgramRecordWord(config->store[i]);
+	EndRecord();
+	memcpy(persisted, config->store, liveWords * 4);
+	deltaWords = 0;
+	stats.checkpointCount++;
+	return true;
+}
+
+/**
+ * @brief Find the next run of changed words.
+ * @param start Index to start the search from. Updated with the start of the run.
+ * @return Length of the run, 0 if no further words are changed.
+ */
+static uint32_t GetNextRun(uint32_t* start)
+{
+	uint32_t i = *start;
+	while (i < liveWords && config->store[i] == persisted[i])
+		i++;
+	if (i >= liveWords)
+		return 0;
+	*start = i;
+	uint32_t end = i + 1;
+	for (i = end; i < liveWords && i - end <= DELTA_MERGE_GAP; i++)
 	{
-		len = _wordSize;
-		data[FLASH_WORD_ALIGNMENT - 1] = _wordSize;
+		if (config->store[i] != persisted[i])
+			end = i + 1;
 	}
-	uint32_t* storeLoc = _storeLoc;
-	for (uint32_t i = 2; i < len + 2; i++)
-		data[i] = *storeLoc++;
-	uint32_t dataLeft = _wordSize - len;
-	HAL_FLASH_Program(FLASH_TYPEPROGRAM_FLASHWORD, (uint32_t)(config->sectors[sectorIndex].addr + config->sectors[sectorIndex].index), (uint32_t)data);
-	config->sectors[sectorIndex].index += FLASH_WORD_ALIGNMENT;
-
-	for (uint32_t packNo = 1; packNo < packCount; packNo++)
+	return end - *start;
+}
+
+/**
+ * @brief Queue a delta record with the changed runs of the store.
+ * @return <c>true</c> if queued, <c>false</c> if the write pipeline is full.
+ */
+static bool WriteDelta(uint32_t runCount, uint32_t len)
+{
+	if (GetFreeOps() < GET_RECORD_OPS(len))
+		return false;
+	BeginRecord(RECORD_DELTA, runCount, len);
+	uint32_t runLen;
+	for (uint32_t start = 0; (runLen = GetNextRun(&start)) != 0; start += runLen)
 	{
-		uint32_t len = FLASH_WORD_ALIGNMENT;
-		if(packNo == packCount - 1)
-		{
-			len = dataLeft;
-			data[FLASH_WORD_ALIGNMENT - 1] = _wordSize;
-		}
-		for (uint32_t i = 0; i < len; i++)
-			data[i] = *storeLoc++;
-		dataLeft -= len;
-		HAL_FLASH_Program(FLASH_TYPEPROGRAM_FLASHWORD, (uint32_t)(config->sectors[sectorIndex].addr + config->sectors[sectorIndex].index), (uint32_t)data);
-		config->sectors[sectorIndex].index += FLASH_WORD_ALIGNMENT;
+		ProgramRecordWord(RUN_HEADER(start, runLen));
+		for (uint32_t i = start; i < start + runLen; i++)
+			ProgramRecordWord(config->store[i]);
+		memcpy(persisted + start, config->store + start, runLen * 4);
 	}
+	EndRecord();
+	deltaWords += len;
+	stats.deltaCount++;
+	return true;
+}
 
-	if (_isFirstSectorPacket)
-		EraseSector(&config->sectors[sectorIndex == 0 ? 1 : 0]);
+/**
+ * @brief Start the next sector in the rotation with a sector record and a checkpoint.
+ * @details The sector is only erased if it isn't already, and its erase count is carried in the new sector record.
+ * All operations of the rotation are queued together, so the erase is always followed by the new checkpoint.
+ * @return <c>true</c> if queued, <c>false</c> if the write pipeline is full.
+ */
+static bool RotateSector(void)
+{
+	if (GetFreeOps() < 1 + GET_RECORD_OPS(SECTOR_RECORD_LEN) + GET_RECORD_OPS(liveWords))
+		return false;
+	sectorIndex = (sectorIndex + 1) % sectorCount;
+	flash_sector_config_t* sector = &config->sectors[sectorIndex];
+	if (sectorIndex != preErasedSector && IsSectorErased(sector) == false)
+		QueueErase(sector);
+	preErasedSector = -1;
+	sector->index = 0;
+	isRotationNeeded = false;
+	stats.sequence++;
+	stats.rotationCount++;
+	BeginRecord(RECORD_SECTOR, 0, SECTOR_RECORD_LEN);
+	ProgramRecordWord(stats.sequence);
+	ProgramRecordWord(sector->eraseCount);
+	EndRecord();
+	return WriteCheckpoint();
 }
 
-static uint32_t RefreshStatesLocal(uint32_t* storeLoc, state_storage_client_t* client, uint32_t* index)
+/**
+ * @brief Queue the erase of the next sector in the rotation once the active sector is half full.
+ * @details The checkpoint of the active sector is programmed by then, so the previous states are no longer needed,
+ * and the rotation doesn't have to wait for the erase.
+ */
+static void PreEraseNextSector(void)
+{
+	flash_sector_config_t* sector = &config->sectors[sectorIndex];
+	if (preErasedSector != -1 || sector->index < (uint32_t)GetSectorWordSize(sector) / 2 || GetFreeOps() < 1)
+		return;
+	preErasedSector = (sectorIndex + 1) % sectorCount;
+	if (IsSectorErased(&config->sectors[preErasedSector]) == false)
+		QueueErase(&config->sectors[preErasedSector]);
+}
+
+static void RefreshStatesLocal(uint32_t* storeLoc, state_storage_client_t* client, uint32_t* index)
 {
-	uint32_t wordSize = client->RefreshStates(storeLoc + 1, index);
+	client->RefreshStates(storeLoc + 1, index);
 	if (storeLoc[0] != STORAGE_HEADER_VALUE || storeLoc[client->dataWordLen + 1] != STORAGE_FOOTER_VALUE)
 	{
 		storeLoc[0] = STORAGE_HEADER_VALUE;
 		storeLoc[client->dataWordLen + 1] = STORAGE_FOOTER_VALUE;
-		*index = 0;
-		return GET_LOCAL_LEN(client->dataWordLen);
 	}
-	return GET_LOCAL_LEN(wordSize);
 }
 
 /**
  * @brief Refreshes the storage state if required.
- * @details Poll this function periodically to refresh the stored states for all parameters. If the index in the
- * sector is 0 or the packet cannot fit within the remaining space in the sector, the \"isFirstSectorPacket\" flag
- * is set. This flag ensures that all parameters are completely flushed to the beginning of the sector.
+ * @details Poll this function periodically to refresh the stored states for all parameters.
  * To obtain the necessary data, each client is prompted to refresh their states using the @ref state_storage_client_t.RefreshStates() function.
  * It is the responsibility of the client to provide the refreshed data, if necessary, and return the size of
- * the updated data. Finally, the partial data will be flushed to the storage flash.
+ * the updated data. The store is then compared with the stored states and the changed words are queued as a
+ * single delta record. If the record doesn't fit in the active sector, the next sector is started with a checkpoint.
+ *
+ * The function doesn't wait for the flash. The queued flash words are programmed one at a time from
+ * @ref FLASH_IRQHandler(). If the write pipeline is full, the refresh is deferred and the changes are merged in
+ * the record of the next refresh. Use @ref StateStorage_Flush() to wait until the states are programmed.
  */
 void StateStorage_Refresh(void)
 {
 	if (sectorIndex == -1)
 		Error_Handler();
 	uint32_t* storeLoc = config->store;
-	bool isFirstSectorPacket = config->sectors[sectorIndex].index == 0;
-	uint32_t index = 0;
-	uint32_t localIndex = 0;
 	for (int i = 0; i < config->clientCount; i++)
 	{
-		localIndex = 0;
-		uint32_t wordSize = RefreshStatesLocal(storeLoc, &config->clients[i], &localIndex);
-		if (wordSize > 0 && !isFirstSectorPacket)
-		{
-			if (HasEnoughSpace(&config->sectors[sectorIndex], wordSize) == false)
-				isFirstSectorPacket = true;
-			else
-				PutDataInFlash(storeLoc, index + localIndex, wordSize, false);		// one index for local header
-		}
+		uint32_t localIndex = 0;
+		RefreshStatesLocal(storeLoc, &config->clients[i], &localIndex);
 		// size includes local header and footer
 		storeLoc += GET_LOCAL_LEN(config->clients[i].dataWordLen);
-		index += GET_LOCAL_LEN(config->clients[i].dataWordLen);
 	}
-	if (isFirstSectorPacket)
-		PutDataInFlash(config->store, 0, STORE_WORD_SIZE, true);
+
+	// Each run is preceded by its start and length
+	uint32_t runCount = 0, deltaLen = 0, runLen, changedWords = 0;
+	for (uint32_t start = 0; (runLen = GetNextRun(&start)) != 0; start += runLen)
+	{
+		runCount++;
+		deltaLen += runLen + 1;
+	}
+	for (uint32_t i = 0; i < liveWords; i++)
+		changedWords += config->store[i] != persisted[i];
+
+	bool isQueued = true;
+	if (isRotationNeeded)
+		isQueued = RotateSector();
+	// Nothing to store
+	else if (runCount == 0)
+		isQueued = true;
+	// A checkpoint is smaller or limits the deltas to be replayed at initialization
+	else if (deltaLen >= liveWords || deltaWords + deltaLen > liveWords * STATE_STORAGE_REPLAY_FACTOR)
+		isQueued = HasEnoughSpace(liveWords) ? WriteCheckpoint() : RotateSector();
+	else if (HasEnoughSpace(deltaLen))
+		isQueued = WriteDelta(runCount, deltaLen);
+	else
+		isQueued = RotateSector();
+
+	isRefreshDeferred = !isQueued;
+	if (isQueued)
+	{
+		stats.changedWords += changedWords;
+		PreEraseNextSector();
+	}
+	else
+		stats.deferredCount++;
+	if (!isFlashBusy)
+		StartNextOperation();
+}
+
+/**
+ * @brief Check if all queued states are programmed in the flash.
+ * @return <c>true</c> if the write pipeline is empty and no refresh is deferred.
+ */
+bool StateStorage_IsCommitted(void)
+{
+	return RingBuffer_IsEmpty(&opsBuff) && !isRefreshDeferred;
+}
+
+/**
+ * @brief Refresh the states and wait until they are programmed in the flash.
+ * @details Use it as a commit barrier, e.g. before a reset. The completion is signaled by the flash interrupt, so it
+ * should not be called with the interrupts disabled or from an interrupt with a higher priority than
+ * @ref STATE_STORAGE_FLASH_IRQ_PRIORITY.
+ * @param timeout Maximum time to wait in milliseconds. A queued sector erase can take more than a second.
+ * @return <c>true</c> if the states are programmed, <c>false</c> if the timeout elapsed.
+ */
+bool StateStorage_Flush(uint32_t timeout)
+{
+	uint32_t tickstart = HAL_GetTick();
+	StateStorage_Refresh();
+	while (!StateStorage_IsCommitted())
+	{
+		if ((HAL_GetTick() - tickstart) > timeout)
+			return false;
+		// A deferred refresh can only be queued once the pipeline is empty
+		if (isRefreshDeferred && RingBuffer_IsEmpty(&opsBuff))
+			StateStorage_Refresh();
+	}
+	return true;
+}
+
+/**
+ * @brief Get the counters of the state storage.
+ * @param _stats Structure to be filled with the counters.
+ */
+void StateStorage_GetStats(state_storage_stats_t* _stats)
+{
+	*_stats = stats;
+}
+
+/**
+ * @brief Records the end of the flash operation started by the write pipeline.
+ * @note Overrides the weak HAL callback, so the flash interrupt should not be used for other operations.
+ */
+void HAL_FLASH_EndOfOperationCallback(uint32_t ReturnValue)
+{
+	isOperationDone = true;
+}
+
+/**
+ * @brief Records the failure of the flash operation started by the write pipeline, so that the next refresh
+ * starts a new sector.
+ */
+void HAL_FLASH_OperationErrorCallback(uint32_t ReturnValue)
+{
+	isRotationNeeded = true;
+	isOperationDone = true;
+}
+
+/**
+ * @brief Completes the flash operation in progress and starts the next queued operation.
+ * @details The programming and erase bits are cleared as the interrupt mode of the HAL leaves them set.
+ * The next operation is started after @ref HAL_FLASH_IRQHandler() returns, as the HAL is locked in the callbacks.
+ */
+void FLASH_IRQHandler(void)
+{
+	HAL_FLASH_IRQHandler();
+	if (!isOperationDone)
+		return;
+	isOperationDone = false;
+	if (ops[opsBuff.rdIndex].sector->bank == FLASH_BANK_1)
+		CLEAR_BIT(FLASH->CR1, FLASH_CR_PG | FLASH_CR_SER);
+	else
+		CLEAR_BIT(FLASH->CR2, FLASH_CR_PG | FLASH_CR_SER);
+	RingBuffer_Read(&opsBuff);
+	StartNextOperation();
 }
 
 /* EOF */
@@ -0,0 +1,290 @@
+/**
+ ********************************************************************************
+ * @file 		adc_stream.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Streams the ADC records to the subscribed clients over UDP
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef ADC_STREAM_H_
+#define ADC_STREAM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/** @defgroup Net_Comms Network Communication
+ * @brief Services running on the LwIP stack.
+ * @{
+ */
+
+/** @defgroup ADC_Stream ADC Stream
+ * @brief Streams the raw or the processed ADC records to the subscribed clients over UDP.
+ * @details A client subscribes by sending an @ref adc_stream_request_t to @ref ADC_STREAM_PORT, which is acknowledged
+ * by a packet without records. Each packet then starts with an @ref adc_stream_header_t followed by the records in the
+ * same layout as the ring buffers of the ADC, i.e. @ref adc_raw_data_t.dataRecord or @ref adc_processed_data_t.dataRecord.
+ * All values are little-endian.
+ *
+ * The records are not copied. Each packet is a chain of a small header pbuf and PBUF_REF pbufs pointing directly into
+ * the ring buffers, which the Ethernet DMA reads while sending. Only records at least @ref ADC_STREAM_GUARD_RECORDS
+ * behind the overwritten part of the ring are sent, so they are not overwritten before they leave the controller.
+ * A client falling behind skips to the newest records and the skipped records are reported in
+ * @ref adc_stream_header_t.lostRecords.
+ *
+ * A subscription expires after @ref ADC_STREAM_LEASE_ms, so the client should repeat the request periodically.
+ * The following code connects the stream with the ADC data of the shared memory.
+@code
+adc_stream_config_t config = {0};
+config.sources[ADC_STREAM_RAW].records = RAW_ADC_DATA.dataRecord;
+config.sources[ADC_STREAM_RAW].recordIndex = &RAW_ADC_DATA.recordIndex;
+config.sources[ADC_STREAM_RAW].recordSize = TOTAL_MEASUREMENT_COUNT * sizeof(uint16_t);
+config.sources[ADC_STREAM_RAW].recordCount = RAW_MEASURE_SAVE_COUNT;
+config.sources[ADC_STREAM_PROCESSED].records = PROCESSED_ADC_DATA.dataRecord;
+config.sources[ADC_STREAM_PROCESSED].recordIndex = &PROCESSED_ADC_DATA.recordIndex;
+config.sources[ADC_STREAM_PROCESSED].recordSize = sizeof(adc_measures_t);
+config.sources[ADC_STREAM_PROCESSED].recordCount = MEASURE_SAVE_COUNT;
+config.fs = &ADC_INFO.fs;
+// from the tcpip thread, or with the core locked, after the initialization of the network interface
+AdcStream_Init(&config);
+@endcode
+ * The records are taken from the rings every @ref ADC_STREAM_PERIOD_ms by a timer of LwIP, which is enough as long as
+ * the rings take more than two periods of records. @ref AdcStream_Poll() may be called in between for a lower latency.
+ * @note The network interface should send chains of up to @ref ADC_STREAM_MAX_SEGMENTS + 1 pbufs, and
+ * MEMP_NUM_PBUF should allow the PBUF_REF pbufs of all packets being sent. MEMP_NUM_SYS_TIMEOUT should allow the
+ * timer of the stream.
+ * @{
+ */
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+/* the stream is compiled with the LwIP headers, whose error codes clash with device_err_t, so the ADC headers are not
+ * included here */
+#include <stdint.h>
+#include <stdbool.h>
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** @defgroup ADCStream_Exported_Macros Macros
+ * @{
+ */
+/**
+ * @brief UDP port receiving the requests of the clients
+ */
+#ifndef ADC_STREAM_PORT
+#define ADC_STREAM_PORT					(5005)
+#endif
+/**
+ * @brief Maximum no of simultaneous subscriptions
+ */
+#ifndef ADC_STREAM_MAX_CLIENTS
+#define ADC_STREAM_MAX_CLIENTS			(2)
+#endif
+/**
+ * @brief Period of the timer sending the available records in milli-seconds
+ */
+#ifndef ADC_STREAM_PERIOD_ms
+#define ADC_STREAM_PERIOD_ms			(1)
+#endif
+/**
+ * @brief Maximum no of packets sent to a client in each period or poll, limiting the pbufs in use
+ */
+#ifndef ADC_STREAM_MAX_PACKETS
+#define ADC_STREAM_MAX_PACKETS			(8)
+#endif
+/**
+ * @brief Maximum size of the records in a packet, fitting a standard Ethernet frame
+ */
+#ifndef ADC_STREAM_MAX_PAYLOAD
+#define ADC_STREAM_MAX_PAYLOAD			(1440)
+#endif
+/**
+ * @brief Maximum no of record pbufs in a packet.
+ * @details A packet of consecutive records takes two pbufs at most, at the end and the start of the ring. A decimated
+ * packet takes a pbuf for each record, so it holds up to this no of records.
+ */
+#ifndef ADC_STREAM_MAX_SEGMENTS
+#define ADC_STREAM_MAX_SEGMENTS			(8)
+#endif
+/**
+ * @brief No of records at the end of the ring, ahead of the records being written, which are not sent.
+ * @details Should cover the time between queuing a packet and its transmission by the Ethernet DMA.
+ */
+#ifndef ADC_STREAM_GUARD_RECORDS
+#define ADC_STREAM_GUARD_RECORDS		(64)
+#endif
+/**
+ * @brief Time after which a subscription which is not renewed expires in milli-seconds
+ */
+#ifndef ADC_STREAM_LEASE_ms
+#define ADC_STREAM_LEASE_ms				(5000)
+#endif
+/**
+ * @brief Magic number starting each request and packet ("TS")
+ */
+#define ADC_STREAM_MAGIC				(0x5354u)
+/**
+ * @brief Current version of the packets
+ */
+#define ADC_STREAM_VERSION				(1)
+/**
+ * @}
+ */
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+/** @defgroup ADCStream_Exported_Typedefs Type Definitions
+ * @{
+ */
+/**
+ * @brief Types of the streamed records
+ */
+typedef enum
+{
+	ADC_STREAM_RAW,						/**< @brief Raw records of @ref adc_raw_data_t */
+	ADC_STREAM_PROCESSED,				/**< @brief Converted records of @ref adc_processed_data_t */
+	ADC_STREAM_TYPE_COUNT,				/**< @brief Not a type. Use this to get the no of types */
+} adc_stream_type_t;
+/**
+ * @brief Commands of the requests
+ */
+typedef enum
+{
+	ADC_STREAM_CMD_SUBSCRIBE = 1,		/**< @brief Start or renew a subscription of the sender */
+	ADC_STREAM_CMD_UNSUBSCRIBE = 2,		/**< @brief End the subscription of the sender */
+} adc_stream_cmd_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/** @defgroup ADCStream_Exported_Structures Structures
+ * @{
+ */
+/**
+ * @brief Request sent by a client to @ref ADC_STREAM_PORT
+ */
+typedef struct __attribute__((packed))
+{
+	uint16_t magic;						/**< @brief Should be @ref ADC_STREAM_MAGIC */
+	uint8_t command;					/**< @brief One of @ref adc_stream_cmd_t */
+	uint8_t type;						/**< @brief Requested records, one of @ref adc_stream_type_t */
+	uint16_t decimation;				/**< @brief Send every nth record. 0 or 1 for all records */
+	uint16_t recordsPerPacket;			/**< @brief Maximum no of records in a packet. 0 for as many as fit */
+} adc_stream_request_t;
+/**
+ * @brief Header of each packet sent to the clients
+ */
+typedef struct __attribute__((packed))
+{
+	uint16_t magic;						/**< @brief Should be @ref ADC_STREAM_MAGIC */
+	uint8_t version;					/**< @brief Version of the packet @ref ADC_STREAM_VERSION */
+	uint8_t type;						/**< @brief Type of the records, one of @ref adc_stream_type_t */
+	uint32_t sequence;					/**< @brief Packet no of the subscription, 0 for the acknowledgment */
+	uint32_t firstRecord;				/**< @brief No of the first record counted from the start of the stream */
+	uint32_t timestamp_us;				/**< @brief Time of sending the packet in micro-seconds */
+	uint32_t lostRecords;				/**< @brief Total no of records skipped for the subscription */
+	float fs;							/**< @brief Sampling rate of the ADC */
+	uint16_t recordCount;				/**< @brief No of records following the header */
+	uint16_t recordSize;				/**< @brief Size of each record in bytes */
+	uint16_t decimation;				/**< @brief Distance between the records of the packet */
+	uint16_t maxRecords;				/**< @brief Records in a full packet of the subscription */
+} adc_stream_header_t;
+/**
+ * @brief Ring buffer of records being streamed
+ */
+typedef struct
+{
+	const volatile void* records;		/**< @brief Start of the ring buffer */
+	const volatile int* recordIndex;	/**< @brief Index of the next record written to the ring buffer */
+	uint16_t recordSize;				/**< @brief Size of each record in bytes */
+	uint16_t recordCount;				/**< @brief No of records in the ring buffer. Should be 2 ^ n */
+} adc_stream_source_t;
+/**
+ * @brief Configuration of the stream
+ */
+typedef struct
+{
+	adc_stream_source_t sources[ADC_STREAM_TYPE_COUNT];	/**< @brief Ring buffers of each type. NULL records if not available */
+	const volatile float* fs;			/**< @brief Pointer to the sampling rate of the ADC */
+	uint16_t port;						/**< @brief Port receiving the requests. 0 for @ref ADC_STREAM_PORT */
+} adc_stream_config_t;
+/**
+ * @brief Statistics of the stream
+ */
+typedef struct
+{
+	uint32_t requests;					/**< @brief No of valid requests received */
+	uint32_t packets;					/**< @brief No of packets sent */
+	uint32_t records;					/**< @brief No of records sent */
+	uint32_t lostRecords;				/**< @brief No of records skipped as the clients fell behind */
+	uint32_t allocErrors;				/**< @brief No of packets delayed as no pbuf was available */
+	uint32_t sendErrors;				/**< @brief No of packets not accepted by the stack */
+} adc_stream_stats_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+/** @defgroup ADCStream_Exported_Functions Functions
+ * @{
+ */
+/**
+ * @brief Initialize the stream and start listening for the requests.
+ * @note Call from the context of LwIP after the initialization of the stack.
+ * @param config Configuration of the stream. The contents are copied.
+ * @return <c>true</c> if successful else <c>false</c>.
+ */
+extern bool AdcStream_Init(const adc_stream_config_t* config);
+/**
+ * @brief Send the available records to the subscribed clients.
+ * @note Called periodically by a timer of LwIP. Call from the context of LwIP.
+ */
+extern void AdcStream_Poll(void);
+/**
+ * @brief Get the statistics of the stream.
+ * @param stats Pointer to fill the statistics.
+ */
+extern void AdcStream_GetStats(adc_stream_stats_t* stats);
+/**
+ * @brief Get the time for the timestamps of the packets.
+ * @note Defined weak with the resolution of the LwIP time. Redefine for a finer resolution.
+ * @return Time in micro-seconds.
+ */
+extern uint32_t AdcStream_GetTime_us(void);
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+
+/**
+ * @}
+ */
+/**
+ * @}
+ */
+/**
+ * @}
+ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */
@@ -0,0 +1,257 @@
+/**
+ ********************************************************************************
+ * @file 		modbus_server.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Modbus/TCP server for the shared parameters and the ADC statistics
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef MODBUS_SERVER_H_
+#define MODBUS_SERVER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/** @addtogroup Net_Comms
+ * @{
+ */
+
+/** @defgroup Modbus_Server Modbus Server
+ * @brief Serves the parameters of @ref p2pCommsParams and the ADC statistics over Modbus/TCP.
+ * @details The server consists of two parts:
+ * - modbus_server.c handles the connections and the MBAP headers with the raw TCP API of LwIP.
+ * - modbus_map.c processes the requests against the register map below, using the interprocessor communication.
+ *
+ * Each parameter and each statistic takes two consecutive registers holding its 32-bit value, the most significant
+ * word first. Integers are sign extended, booleans and the bits of the bit accessible parameters are 0 or 1, and
+ * floats are in the IEEE 754 format.
+ * | Table | Function codes | Registers | Content |
+ * | ----- | -------------- | --------- | ------- |
+ * | Holding registers | 3, 6, 16 | @ref MODBUS_PARAM_REGISTER(param) | Parameter no param of @ref p2pCommsParams |
+ * | Input registers | 4 | @ref MODBUS_STATS_REGISTER(channel, stat) | Statistic of an ADC channel, see @ref modbus_stat_t |
+ * | Input registers | 4 | @ref MODBUS_FS_REGISTER | Sampling rate of the ADC |
+ *
+ * The reads are served from a snapshot of the shared data (@ref P2PComms_TakeSnapshot()), which is only refreshed when
+ * the CM7 core updated it, so a read of any size takes no request to the CM7 core and all of its values belong to the
+ * same update. All parameters written by a request are validated first and then sent in a single P2P transaction, so
+ * the CM7 core applies them together. Writing half of a parameter keeps the other half from the snapshot. The
+ * response of a write is sent once the transaction completes, and the connection processes no further requests in
+ * the meantime. The custom Getter and Setter callbacks of the parameters are not used.
+ *
+ * The following code starts the server on the CM4 core.
+@code
+// from the tcpip thread, or with the core locked, after the initialization of the network interface
+ModbusServer_Init(0);
+@endcode
+ * @note MEMP_NUM_TCP_PCB should allow @ref MODBUS_SERVER_MAX_CONNECTIONS connections besides the other services,
+ * and MEMP_NUM_SYS_TIMEOUT should allow the timer of the server.
+ * @{
+ */
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+/* the server is compiled with the LwIP headers, whose error codes clash with device_err_t, so the BSP headers are
+ * only included in modbus_map.c */
+#include <stdint.h>
+#include <stdbool.h>
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** @defgroup ModbusServer_Exported_Macros Macros
+ * @{
+ */
+/**
+ * @brief TCP port of the server
+ */
+#ifndef MODBUS_SERVER_PORT
+#define MODBUS_SERVER_PORT				(502)
+#endif
+/**
+ * @brief Maximum no of simultaneous connections. Each connection can have a write in progress.
+ */
+#ifndef MODBUS_SERVER_MAX_CONNECTIONS
+#define MODBUS_SERVER_MAX_CONNECTIONS	(4)
+#endif
+/**
+ * @brief Period of the timer completing the writes in milli-seconds
+ */
+#ifndef MODBUS_SERVER_PERIOD_ms
+#define MODBUS_SERVER_PERIOD_ms			(1)
+#endif
+/**
+ * @brief Time after which a connection without requests is closed in milli-seconds
+ */
+#ifndef MODBUS_SERVER_IDLE_TIMEOUT_ms
+#define MODBUS_SERVER_IDLE_TIMEOUT_ms	(60000)
+#endif
+/**
+ * @brief Size of the largest request or response, with the MBAP header
+ */
+#define MODBUS_MAX_ADU_SIZE				(260)
+/**
+ * @brief Size of the largest request or response, without the MBAP header
+ */
+#define MODBUS_MAX_PDU_SIZE				(253)
+/**
+ * @brief No of ADC channels in the input registers
+ */
+#define MODBUS_ADC_CHANNEL_COUNT		(16)
+/**
+ * @brief First holding register of a parameter.
+ * @param param Index of the parameter in @ref p2pCommsParams.
+ */
+#define MODBUS_PARAM_REGISTER(param)			((param) * 2)
+/**
+ * @brief First input register of a statistic of an ADC channel.
+ * @param channel ADC channel starting from 0.
+ * @param stat Statistic, one of @ref modbus_stat_t.
+ */
+#define MODBUS_STATS_REGISTER(channel, stat)	(((channel) * MODBUS_STAT_COUNT + (stat)) * 2)
+/**
+ * @brief First input register of the sampling rate of the ADC
+ */
+#define MODBUS_FS_REGISTER				MODBUS_STATS_REGISTER(MODBUS_ADC_CHANNEL_COUNT, 0)
+/**
+ * @}
+ */
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+/** @defgroup ModbusServer_Exported_Typedefs Type Definitions
+ * @{
+ */
+/**
+ * @brief Statistics of an ADC channel in the input registers, in the order of @ref stats_data_t
+ */
+typedef enum
+{
+	MODBUS_STAT_RMS,					/**< @brief RMS value */
+	MODBUS_STAT_AVG,					/**< @brief Average value */
+	MODBUS_STAT_MAX,					/**< @brief Maximum value */
+	MODBUS_STAT_MIN,					/**< @brief Minimum value */
+	MODBUS_STAT_PK_TO_PK,				/**< @brief Peak to peak value */
+	MODBUS_STAT_COUNT,					/**< @brief Not a type. Use this to get the no of statistics */
+} modbus_stat_t;
+/**
+ * @brief Result of processing a request by the register map
+ */
+typedef enum
+{
+	MODBUS_MAP_DONE,					/**< @brief The response is ready */
+	MODBUS_MAP_PENDING,					/**< @brief A write is in progress. Poll with @ref ModbusMap_Complete() */
+} modbus_map_status_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/** @defgroup ModbusServer_Exported_Structures Structures
+ * @{
+ */
+/**
+ * @brief Statistics of the server
+ */
+typedef struct
+{
+	uint32_t connections;				/**< @brief No of accepted connections */
+	uint32_t rejectedConnections;		/**< @brief No of connections refused as all slots were in use */
+	uint32_t requests;					/**< @brief No of processed requests */
+	uint32_t exceptions;				/**< @brief No of exception responses */
+	uint32_t frameErrors;				/**< @brief No of connections closed for an invalid MBAP header */
+	uint32_t readRegisters;				/**< @brief No of registers read */
+	uint32_t writtenRegisters;			/**< @brief No of registers written */
+	uint32_t transactions;				/**< @brief No of P2P transactions posted for the writes */
+	uint32_t snapshots;					/**< @brief No of reads refreshing the snapshot of the shared data */
+} modbus_stats_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+/** @defgroup ModbusServer_Exported_Functions Functions
+ * @{
+ */
+/**
+ * @brief Initialize the server and start listening for the connections.
+ * @note Call from the context of LwIP after the initialization of the stack.
+ * @param port TCP port of the server. 0 for @ref MODBUS_SERVER_PORT.
+ * @return <c>true</c> if successful else <c>false</c>.
+ */
+extern bool ModbusServer_Init(uint16_t port);
+/**
+ * @brief Complete the writes in progress and continue with the waiting requests.
+ * @note Called periodically by a timer of LwIP. Call from the context of LwIP.
+ */
+extern void ModbusServer_Poll(void);
+/**
+ * @brief Get the statistics of the server.
+ * @param stats Pointer to fill the statistics.
+ */
+extern void ModbusServer_GetStats(modbus_stats_t* stats);
+/**
+ * @brief Process a request for the register map.
+ * @param slot Slot of the connection keeping a write in progress, below @ref MODBUS_SERVER_MAX_CONNECTIONS.
+ * @param request Request without the MBAP header, starting with the function code.
+ * @param len Length of the request.
+ * @param response Buffer of @ref MODBUS_MAX_PDU_SIZE bytes for the response.
+ * @param responseLen Updated with the length of the response.
+ * @return @ref MODBUS_MAP_DONE if the response is ready else @ref MODBUS_MAP_PENDING.
+ */
+extern modbus_map_status_t ModbusMap_Process(int slot, const uint8_t* request, uint16_t len, uint8_t* response, uint16_t* responseLen);
+/**
+ * @brief Check if the write in progress of a slot is complete.
+ * @param slot Slot of the connection.
+ * @param response Buffer of @ref MODBUS_MAX_PDU_SIZE bytes for the response.
+ * @param responseLen Updated with the length of the response.
+ * @return <c>true</c> if complete and the response is ready else <c>false</c>.
+ */
+extern bool ModbusMap_Complete(int slot, uint8_t* response, uint16_t* responseLen);
+/**
+ * @brief Add the statistics of the register map.
+ * @param stats Statistics to be updated.
+ */
+extern void ModbusMap_GetStats(modbus_stats_t* stats);
+/**
+ * @brief Called from the interrupt context when a write completes.
+ * @note A weak implementation of this function is provided. Redefine it to wake the context of LwIP, e.g. with
+ * tcpip_try_callback() calling @ref ModbusServer_Poll(), so the response doesn't wait for the timer of the server.
+ */
+extern void ModbusMap_WriteCompletedCallback(void);
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+
+/**
+ * @}
+ */
+/**
+ * @}
+ */
+/**
+ * @}
+ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */
@@ -0,0 +1,412 @@
+/**
+ ********************************************************************************
+ * @file 		adc_stream.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Streams the ADC records to the subscribed clients over UDP
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <string.h>
+#include "adc_stream.h"
+#include "lwip/udp.h"
+#include "lwip/pbuf.h"
+#include "lwip/sys.h"
+#include "lwip/timeouts.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** Time after which the pending records are sent even if they don't fill a packet in milli-seconds */
+#define FLUSH_TIME_ms				(10)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief Subscription of a client
+ */
+typedef struct
+{
+	bool isActive;
+	ip_addr_t addr;
+	u16_t port;
+	adc_stream_type_t type;
+	uint16_t decimation;
+	uint16_t maxRecords;
+	uint32_t nextRecord;
+	uint32_t sequence;
+	uint32_t lostRecords;
+	uint32_t lease_ms;
+	uint32_t lastSend_ms;
+} stream_client_t;
+/**
+ * @brief Progress of the ring buffer of a source
+ */
+typedef struct
+{
+	uint32_t recordCount;
+	int lastIndex;
+	uint32_t lastTime_us;
+} source_state_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static adc_stream_config_t streamConfig;
+static struct udp_pcb* pcb = NULL;
+static stream_client_t clients[ADC_STREAM_MAX_CLIENTS];
+static source_state_t sourceStates[ADC_STREAM_TYPE_COUNT];
+static adc_stream_stats_t streamStats;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Get the time for the timestamps of the packets.
+ * @note Defined weak with the resolution of the LwIP time. Redefine for a finer resolution.
+ * @return Time in micro-seconds.
+ */
+__attribute__((weak)) uint32_t AdcStream_GetTime_us(void)
+{
+	return sys_now() * 1000;
+}
+
+/**
+ * @brief Count the records written to the ring buffers since the last update.
+ * @details The index only gives the records modulo the size of the ring, so the complete turns of the writer after a
+ * late update are estimated from the sampling rate.
+ */
+static void UpdateSources(void)
+{
+	uint32_t now = AdcStream_GetTime_us();
+	float fs = streamConfig.fs ? *streamConfig.fs : 0;
+	for (int i = 0; i < ADC_STREAM_TYPE_COUNT; i++)
+	{
+		adc_stream_source_t* source = &streamConfig.sources[i];
+		source_state_t* state = &sourceStates[i];
+		if (source->records == NULL)
+			continue;
+		int index = *source->recordIndex;
+		uint32_t count = (index - state->lastIndex) & (source->recordCount - 1);
+		float expected = (now - state->lastTime_us) * fs * 1e-6f;
+		int32_t turns = (int32_t)((expected - count) / source->recordCount + 0.5f);
+		if (turns > 0)
+			count += source->recordCount * turns;
+		state->recordCount += count;
+		state->lastIndex = index;
+		state->lastTime_us = now;
+	}
+}
+
+/**
+ * @brief Fill the header of a packet.
+ */
+static void FillHeader(adc_stream_header_t* header, stream_client_t* client, uint32_t firstRecord, uint16_t recordCount)
+{
+	header->magic = ADC_STREAM_MAGIC;
+	header->version = ADC_STREAM_VERSION;
+	header->type = client->type;
+	header->sequence = recordCount ? client->sequence : 0;
+	header->firstRecord = firstRecord;
+	header->timestamp_us = AdcStream_GetTime_us();
+	header->lostRecords = client->lostRecords;
+	header->fs = streamConfig.fs ? *streamConfig.fs : 0;
+	header->recordCount = recordCount;
+	header->recordSize = client->maxRecords ? streamConfig.sources[client->type].recordSize : 0;
+	header->decimation = client->decimation;
+	header->maxRecords = client->maxRecords;
+}
+
+/**
+ * @brief Send a packet without records, acknowledging a subscription or refusing it if maxRecords is 0.
+ */
+static void SendAcknowledgment(stream_client_t* client)
+{
+	struct pbuf* p = pbuf_alloc(PBUF_TRANSPORT, sizeof(adc_stream_header_t), PBUF_RAM);
+	if (p == NULL)
+	{
+		streamStats.allocErrors++;
+		return;
+	}
+	FillHeader((adc_stream_header_t*)p->payload, client, sourceStates[client->type].recordCount, 0);
+	if (udp_sendto(pcb, p, &client->addr, client->port) != ERR_OK)
+		streamStats.sendErrors++;
+	pbuf_free(p);
+}
+
+/**
+ * @brief Append the records of the ring buffer to the packet without copying them.
+ * @return <c>true</c> if successful else <c>false</c>.
+ */
+static bool AppendRecords(struct pbuf* packet, adc_stream_source_t* source, uint32_t firstRecord, uint16_t count)
+{
+	struct pbuf* p = pbuf_alloc(PBUF_RAW, count * source->recordSize, PBUF_REF);
+	if (p == NULL)
+		return false;
+	p->payload = (uint8_t*)source->records + (firstRecord & (source->recordCount - 1)) * source->recordSize;
+	pbuf_cat(packet, p);
+	return true;
+}
+
+/**
+ * @brief Send the next packet of a subscription.
+ * @return <c>true</c> if sent else <c>false</c> if no pbuf is available.
+ */
+static bool SendRecords(stream_client_t* client, uint16_t count)
+{
+	adc_stream_source_t* source = &streamConfig.sources[client->type];
+	struct pbuf* packet = pbuf_alloc(PBUF_TRANSPORT, sizeof(adc_stream_header_t), PBUF_RAM);
+	if (packet == NULL)
+		return false;
+	bool isAllocated = true;
+	if (client->decimation == 1)
+	{
+		// consecutive records take two parts at most, at the end and the start of the ring
+		uint16_t tillEnd = source->recordCount - (client->nextRecord & (source->recordCount - 1));
+		uint16_t firstPart = count < tillEnd ? count : tillEnd;
+		isAllocated = AppendRecords(packet, source, client->nextRecord, firstPart);
+		if (isAllocated && count > firstPart)
+			isAllocated = AppendRecords(packet, source, client->nextRecord + firstPart, count - firstPart);
+	}
+	else
+	{
+		for (int i = 0; i < count && isAllocated; i++)
+			isAllocated = AppendRecords(packet, source, client->nextRecord + i * client->decimation, 1);
+	}
+	if (!isAllocated)
+	{
+		pbuf_free(packet);
+		return false;
+	}
+
+	FillHeader((adc_stream_header_t*)packet->payload, client, client->nextRecord, count);
+	if (udp_sendto(pcb, packet, &client->addr, client->port) != ERR_OK)
+		streamStats.sendErrors++;
+	else
+	{
+		streamStats.packets++;
+		streamStats.records += count;
+	}
+	pbuf_free(packet);
+	// a packet which is not accepted is lost like one dropped by the network, seen as a gap in the sequence
+	client->sequence++;
+	client->nextRecord += count * client->decimation;
+	client->lastSend_ms = sys_now();
+	return true;
+}
+
+/**
+ * @brief Send the available records of a subscription.
+ */
+static void ServeClient(stream_client_t* client)
+{
+	adc_stream_source_t* source = &streamConfig.sources[client->type];
+	uint32_t maxLag = source->recordCount - ADC_STREAM_GUARD_RECORDS;
+	for (int i = 0; i < ADC_STREAM_MAX_PACKETS; i++)
+	{
+		// the writer moves on while sending, so the records are checked again for each packet
+		if (i != 0)
+			UpdateSources();
+		// skip the records which may be overwritten while being sent
+		uint32_t lag = sourceStates[client->type].recordCount - client->nextRecord;
+		if ((int32_t)lag > (int32_t)maxLag)
+		{
+			uint32_t skipped = (lag - maxLag + client->decimation - 1) / client->decimation;
+			client->nextRecord += skipped * client->decimation;
+			client->lostRecords += skipped;
+			streamStats.lostRecords += skipped;
+			lag -= skipped * client->decimation;
+		}
+		if ((int32_t)lag <= 0)
+			return;
+		uint32_t available = (lag - 1) / client->decimation + 1;
+		if (available < client->maxRecords && sys_now() - client->lastSend_ms < FLUSH_TIME_ms)
+			return;
+		if (!SendRecords(client, available < client->maxRecords ? available : client->maxRecords))
+		{
+			streamStats.allocErrors++;
+			return;
+		}
+	}
+}
+
+/**
+ * @brief Start, renew or update a subscription.
+ */
+static void Subscribe(const adc_stream_request_t* request, const ip_addr_t* addr, u16_t port)
+{
+	stream_client_t* client = NULL;
+	stream_client_t* freeClient = NULL;
+	for (int i = 0; i < ADC_STREAM_MAX_CLIENTS; i++)
+	{
+		if (!clients[i].isActive)
+		{
+			if (freeClient == NULL)
+				freeClient = &clients[i];
+		}
+		else if (clients[i].port == port && ip_addr_cmp(&clients[i].addr, addr))
+			client = &clients[i];
+	}
+
+	uint16_t decimation = request->decimation ? request->decimation : 1;
+	bool isValid = request->type < ADC_STREAM_TYPE_COUNT && streamConfig.sources[request->type].records != NULL;
+	uint16_t maxRecords = 0;
+	if (isValid)
+	{
+		adc_stream_source_t* source = &streamConfig.sources[request->type];
+		maxRecords = ADC_STREAM_MAX_PAYLOAD / source->recordSize;
+		// each decimated record is a separate pbuf
+		if (decimation > 1 && maxRecords > ADC_STREAM_MAX_SEGMENTS)
+			maxRecords = ADC_STREAM_MAX_SEGMENTS;
+		if (request->recordsPerPacket && maxRecords > request->recordsPerPacket)
+			maxRecords = request->recordsPerPacket;
+		// a packet should be sent before its records get overwritten
+		if (maxRecords * decimation > source->recordCount - ADC_STREAM_GUARD_RECORDS)
+			maxRecords = 0;
+	}
+
+	if (client == NULL || client->type != request->type || client->decimation != decimation
+			|| client->maxRecords != maxRecords)
+	{
+		stream_client_t temp = {0};
+		if (client == NULL)
+			client = (maxRecords && freeClient) ? freeClient : &temp;
+		client->addr = *addr;
+		client->port = port;
+		client->type = isValid ? request->type : ADC_STREAM_RAW;
+		client->decimation = decimation;
+		client->maxRecords = client == &temp ? 0 : maxRecords;
+		client->nextRecord = sourceStates[client->type].recordCount;
+		client->sequence = 1;
+		client->lostRecords = 0;
+		client->lastSend_ms = sys_now();
+		client->isActive = client->maxRecords != 0;
+		SendAcknowledgment(client);
+	}
+	client->lease_ms = sys_now();
+}
+
+/**
+ * @brief Process the requests of the clients.
+ */
+static void Request_Received(void* arg, struct udp_pcb* upcb, struct pbuf* p, const ip_addr_t* addr, u16_t port)
+{
+	LWIP_UNUSED_ARG(arg);
+	LWIP_UNUSED_ARG(upcb);
+	adc_stream_request_t request;
+	if (pbuf_copy_partial(p, &request, sizeof(request), 0) == sizeof(request) && request.magic == ADC_STREAM_MAGIC)
+	{
+		UpdateSources();
+		if (request.command == ADC_STREAM_CMD_SUBSCRIBE)
+		{
+			streamStats.requests++;
+			Subscribe(&request, addr, port);
+		}
+		else if (request.command == ADC_STREAM_CMD_UNSUBSCRIBE)
+		{
+			streamStats.requests++;
+			for (int i = 0; i < ADC_STREAM_MAX_CLIENTS; i++)
+				if (clients[i].isActive && clients[i].port == port && ip_addr_cmp(&clients[i].addr, addr))
+					clients[i].isActive = false;
+		}
+	}
+	pbuf_free(p);
+}
+
+static void Timer_Elapsed(void* arg)
+{
+	LWIP_UNUSED_ARG(arg);
+	AdcStream_Poll();
+	sys_timeout(ADC_STREAM_PERIOD_ms, Timer_Elapsed, NULL);
+}
+
+/**
+ * @brief Initialize the stream and start listening for the requests.
+ * @note Call from the context of LwIP after the initialization of the stack.
+ * @param config Configuration of the stream. The contents are copied.
+ * @return <c>true</c> if successful else <c>false</c>.
+ */
+bool AdcStream_Init(const adc_stream_config_t* config)
+{
+	streamConfig = *config;
+	if (streamConfig.port == 0)
+		streamConfig.port = ADC_STREAM_PORT;
+	memset(clients, 0, sizeof(clients));
+	memset(&streamStats, 0, sizeof(streamStats));
+	for (int i = 0; i < ADC_STREAM_TYPE_COUNT; i++)
+	{
+		sourceStates[i].lastIndex = streamConfig.sources[i].records ? *streamConfig.sources[i].recordIndex : 0;
+		// the records are located in the ring by their count, so the count starts at the position of the ring
+		sourceStates[i].recordCount = sourceStates[i].lastIndex;
+		sourceStates[i].lastTime_us = AdcStream_GetTime_us();
+	}
+
+	pcb = udp_new();
+	if (pcb == NULL)
+		return false;
+	if (udp_bind(pcb, IP_ADDR_ANY, streamConfig.port) != ERR_OK)
+	{
+		udp_remove(pcb);
+		pcb = NULL;
+		return false;
+	}
+	udp_recv(pcb, Request_Received, NULL);
+	sys_timeout(ADC_STREAM_PERIOD_ms, Timer_Elapsed, NULL);
+	return true;
+}
+
+/**
+ * @brief Send the available records to the subscribed clients.
+ * @note Called periodically by a timer of LwIP. Call from the context of LwIP.
+ */
+void AdcStream_Poll(void)
+{
+	if (pcb == NULL)
+		return;
+	UpdateSources();
+	uint32_t now = sys_now();
+	for (int i = 0; i < ADC_STREAM_MAX_CLIENTS; i++)
+	{
+		if (!clients[i].isActive)
+			continue;
+		if (now - clients[i].lease_ms > ADC_STREAM_LEASE_ms)
+			clients[i].isActive = false;
+		else
+			ServeClient(&clients[i]);
+	}
+}
+
+/**
+ * @brief Get the statistics of the stream.
+ * @param stats Pointer to fill the statistics.
+ */
+void AdcStream_GetStats(adc_stream_stats_t* stats)
+{
+	*stats = streamStats;
+}
+
+/* EOF */
@@ -0,0 +1,435 @@
+/**
+ ********************************************************************************
+ * @file 		modbus_map.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Maps the shared parameters and the ADC statistics to the Modbus registers
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <string.h>
+#include "modbus_server.h"
+#include "p2p_comms.h"
+#include "shared_memory.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+#if TOTAL_MEASUREMENT_COUNT != MODBUS_ADC_CHANNEL_COUNT
+#error "The input registers expect 16 ADC channels"
+#endif
+/** Function codes */
+#define FC_READ_HOLDING_REGISTERS		(3)
+#define FC_READ_INPUT_REGISTERS			(4)
+#define FC_WRITE_SINGLE_REGISTER		(6)
+#define FC_WRITE_MULTIPLE_REGISTERS		(16)
+/** Exception codes */
+#define EX_ILLEGAL_FUNCTION				(1)
+#define EX_ILLEGAL_DATA_ADDRESS			(2)
+#define EX_ILLEGAL_DATA_VALUE			(3)
+#define EX_SERVER_DEVICE_FAILURE		(4)
+/** Maximum no of registers in a read or write request, fitting the largest response or request */
+#define MAX_READ_REGISTERS				(125)
+#define MAX_WRITE_REGISTERS				(123)
+/** No of holding registers */
+#define HOLDING_REGISTER_COUNT			MODBUS_PARAM_REGISTER(P2P_PARAM_COUNT)
+/** No of input registers */
+#define INPUT_REGISTER_COUNT			(MODBUS_FS_REGISTER + 2)
+/** Size of the response of a write */
+#define WRITE_RESPONSE_SIZE				(5)
+/** Exponent bits of a float, all set for infinity and NaN */
+#define FLOAT_EXPONENT_MASK				(0x7F800000U)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief Write in progress of a connection
+ */
+typedef struct
+{
+	bool isPending;
+	bool isPosted;
+	p2p_txn_t txn;
+	p2p_txn_item_t items[P2P_COMMS_TXN_MAX_ITEMS];
+	uint8_t response[WRITE_RESPONSE_SIZE];
+} write_slot_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static p2p_data_snapshot_t snapshot;
+static write_slot_t writeSlots[MODBUS_SERVER_MAX_CONNECTIONS];
+static modbus_stats_t mapStats;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static inline uint16_t GetU16(const uint8_t* data)
+{
+	return ((uint16_t)data[0] << 8) | data[1];
+}
+
+static inline void PutU16(uint8_t* data, uint16_t value)
+{
+	data[0] = value >> 8;
+	data[1] = value & 0xFF;
+}
+
+static inline uint16_t GetWord(uint32_t value, int reg)
+{
+	// the most significant word comes first
+	return (reg & 1) ? (value & 0xFFFF) : (value >> 16);
+}
+
+static uint16_t Exception(uint8_t function, uint8_t code, uint8_t* response)
+{
+	response[0] = function | 0x80;
+	response[1] = code;
+	mapStats.exceptions++;
+	return 2;
+}
+
+/**
+ * @brief Called from the interrupt context when a write completes.
+ * @note A weak implementation of this function is provided. Redefine it to wake the context of LwIP, e.g. with
+ * tcpip_try_callback() calling @ref ModbusServer_Poll(), so the response doesn't wait for the timer of the server.
+ */
+__weak void ModbusMap_WriteCompletedCallback(void)
+{
+}
+
+static void Transaction_Completed(p2p_txn_t* txn)
+{
+	ModbusMap_WriteCompletedCallback();
+}
+
+/**
+ * @brief Refresh the snapshot of the shared data if the CM7 core updated it.
+ */
+static void RefreshSnapshot(void)
+{
+	if (P2PComms_TakeSnapshot(&snapshot) != 0)
+		mapStats.snapshots++;
+}
+
+/**
+ * @brief Get the 32-bit register value of a parameter from the snapshot.
+ * @param param Valid parameter.
+ */
+static uint32_t GetParamValue(const data_param_info_t* param)
+{
+	const p2p_data_buffs_t* data = &snapshot.data;
+	uint32_t value;
+	switch (param->type)
+	{
+	case DTYPE_BOOL: return data->bools[param->index] ? 1 : 0;
+	case DTYPE_U8: return data->u8s[param->index];
+	case DTYPE_S8: return (uint32_t)(int32_t)data->s8s[param->index];
+	case DTYPE_U16: return data->u16s[param->index];
+	case DTYPE_S16: return (uint32_t)(int32_t)data->s16s[param->index];
+	case DTYPE_U32: return data->u32s[param->index];
+	case DTYPE_S32: return (uint32_t)data->s32s[param->index];
+	case DTYPE_FLOAT:
+		memcpy(&value, &data->floats[param->index], sizeof(value));
+		return value;
+	// a parameter for some bits reads 1 if all of them are set, else the complete register is read
+	case DTYPE_BIT_ACCESS:
+		value = data->bitAccess[param->index];
+		return param->arg == 0 ? value : ((value & param->arg) == param->arg);
+	default: return 0;
+	}
+}
+
+/**
+ * @brief Add the transaction item writing a parameter.
+ * @param slot Write being prepared.
+ * @param param Valid parameter.
+ * @param value 32-bit register value.
+ * @return 0 if successful else the exception code.
+ */
+static uint8_t AddWriteItem(write_slot_t* slot, const data_param_info_t* param, uint32_t value)
+{
+	if (slot->txn.count >= P2P_COMMS_TXN_MAX_ITEMS)
+		return EX_ILLEGAL_DATA_VALUE;
+	p2p_txn_item_t* item = &slot->items[slot->txn.count];
+	int32_t signedValue = (int32_t)value;
+	item->index = param->index;
+	item->value.u32 = 0;
+	switch (param->type)
+	{
+	case DTYPE_BOOL:
+		if (value > 1) return EX_ILLEGAL_DATA_VALUE;
+		item->type = MSG_SET_BOOL;
+		item->value.b = value;
+		break;
+	case DTYPE_U8:
+		if (value > UINT8_MAX) return EX_ILLEGAL_DATA_VALUE;
+		item->type = MSG_SET_U8;
+		item->value.u8 = value;
+		break;
+	case DTYPE_S8:
+		if (signedValue > INT8_MAX || signedValue < INT8_MIN) return EX_ILLEGAL_DATA_VALUE;
+		item->type = MSG_SET_S8;
+		item->value.s8 = signedValue;
+		break;
+	case DTYPE_U16:
+		if (value > UINT16_MAX) return EX_ILLEGAL_DATA_VALUE;
+		item->type = MSG_SET_U16;
+		item->value.u16 = value;
+		break;
+	case DTYPE_S16:
+		if (signedValue > INT16_MAX || signedValue < INT16_MIN) return EX_ILLEGAL_DATA_VALUE;
+		item->type = MSG_SET_S16;
+		item->value.s16 = signedValue;
+		break;
+	case DTYPE_U32:
+		item->type = MSG_SET_U32;
+		item->value.u32 = value;
+		break;
+	case DTYPE_S32:
+		item->type = MSG_SET_S32;
+		item->value.s32 = signedValue;
+		break;
+	case DTYPE_FLOAT:
+		// checked on the bits, as the fast math of the projects assumes finite values
+		if ((value & FLOAT_EXPONENT_MASK) == FLOAT_EXPONENT_MASK) return EX_ILLEGAL_DATA_VALUE;
+		item->type = MSG_SET_FLOAT;
+		memcpy(&item->value.f, &value, sizeof(value));
+		break;
+	// only the parameters for some bits are writable, as the CM7 core sets or clears bits but never the register
+	case DTYPE_BIT_ACCESS:
+		if (param->arg == 0) return EX_ILLEGAL_DATA_ADDRESS;
+		if (value > 1) return EX_ILLEGAL_DATA_VALUE;
+		item->type = value ? MSG_SET_BITS : MSG_CLR_BITS;
+		item->value.bits = param->arg;
+		break;
+	default: return EX_ILLEGAL_DATA_ADDRESS;
+	}
+	slot->txn.count++;
+	return 0;
+}
+
+/**
+ * @brief Read the holding registers of the parameters from the snapshot.
+ * @return Length of the response.
+ */
+static uint16_t ReadHoldingRegisters(uint16_t address, uint16_t count, uint8_t* response)
+{
+	if (address + count > HOLDING_REGISTER_COUNT)
+		return Exception(FC_READ_HOLDING_REGISTERS, EX_ILLEGAL_DATA_ADDRESS, response);
+	for (int p = address / 2; p <= (address + count - 1) / 2; p++)
+	{
+		if (!P2PComms_IsParameterValid(&p2pCommsParams[p]))
+			return Exception(FC_READ_HOLDING_REGISTERS, EX_ILLEGAL_DATA_ADDRESS, response);
+	}
+
+	RefreshSnapshot();
+	uint8_t* data = response + 2;
+	for (int reg = address; reg < address + count; reg++, data += 2)
+		PutU16(data, GetWord(GetParamValue(&p2pCommsParams[reg / 2]), reg));
+	response[0] = FC_READ_HOLDING_REGISTERS;
+	response[1] = count * 2;
+	mapStats.readRegisters += count;
+	return 2 + count * 2;
+}
+
+/**
+ * @brief Read the input registers of the ADC statistics.
+ * @details The statistics are computed on this core, and are copied once so that a channel isn't read in between.
+ * @return Length of the response.
+ */
+static uint16_t ReadInputRegisters(uint16_t address, uint16_t count, uint8_t* response)
+{
+	if (address + count > INPUT_REGISTER_COUNT)
+		return Exception(FC_READ_INPUT_REGISTERS, EX_ILLEGAL_DATA_ADDRESS, response);
+
+	float values[INPUT_REGISTER_COUNT / 2];
+	memcpy(values, (const void*)ADC_INFO.stats, sizeof(ADC_INFO.stats));
+	values[MODBUS_FS_REGISTER / 2] = ADC_INFO.fs;
+	uint8_t* data = response + 2;
+	for (int reg = address; reg < address + count; reg++, data += 2)
+	{
+		uint32_t value;
+		memcpy(&value, &values[reg / 2], sizeof(value));
+		PutU16(data, GetWord(value, reg));
+	}
+	response[0] = FC_READ_INPUT_REGISTERS;
+	response[1] = count * 2;
+	mapStats.readRegisters += count;
+	return 2 + count * 2;
+}
+
+/**
+ * @brief Validate the written parameters and post them in a single transaction.
+ * @param values Register values, two bytes each.
+ * @return @ref MODBUS_MAP_PENDING if posted else @ref MODBUS_MAP_DONE with an exception response.
+ */
+static modbus_map_status_t WriteRegisters(write_slot_t* slot, uint8_t function, uint16_t address, uint16_t count,
+		const uint8_t* values, uint8_t* response, uint16_t* responseLen)
+{
+	if (address + count > HOLDING_REGISTER_COUNT)
+	{
+		*responseLen = Exception(function, EX_ILLEGAL_DATA_ADDRESS, response);
+		return MODBUS_MAP_DONE;
+	}
+	int first = address / 2;
+	int last = (address + count - 1) / 2;
+	for (int p = first; p <= last; p++)
+	{
+		if (!P2PComms_IsParameterValid(&p2pCommsParams[p]))
+		{
+			*responseLen = Exception(function, EX_ILLEGAL_DATA_ADDRESS, response);
+			return MODBUS_MAP_DONE;
+		}
+	}
+	// the halves of the parameters which are not written are taken from the snapshot
+	if ((address & 1) || (count & 1))
+		RefreshSnapshot();
+
+	slot->txn = (p2p_txn_t){ .items = slot->items, .Callback = Transaction_Completed };
+	for (int p = first; p <= last; p++)
+	{
+		uint32_t value = 0;
+		for (int reg = p * 2; reg < p * 2 + 2; reg++)
+		{
+			uint16_t word = (reg >= address && reg < address + count) ?
+					GetU16(values + (reg - address) * 2) : GetWord(GetParamValue(&p2pCommsParams[p]), reg);
+			value |= (uint32_t)word << ((reg & 1) ? 0 : 16);
+		}
+		uint8_t code = AddWriteItem(slot, &p2pCommsParams[p], value);
+		if (code != 0)
+		{
+			*responseLen = Exception(function, code, response);
+			return MODBUS_MAP_DONE;
+		}
+	}
+
+	// write responses repeat the address and the value or the count
+	slot->response[0] = function;
+	PutU16(&slot->response[1], address);
+	PutU16(&slot->response[3], function == FC_WRITE_SINGLE_REGISTER ? GetU16(values) : count);
+	slot->isPending = true;
+	slot->isPosted = P2PComms_Transaction_Async(&slot->txn) == ERR_OK;
+	mapStats.transactions++;
+	mapStats.writtenRegisters += count;
+	return MODBUS_MAP_PENDING;
+}
+
+/**
+ * @brief Process a request for the register map.
+ * @param slot Slot of the connection keeping a write in progress, below @ref MODBUS_SERVER_MAX_CONNECTIONS.
+ * @param request Request without the MBAP header, starting with the function code.
+ * @param len Length of the request.
+ * @param response Buffer of @ref MODBUS_MAX_PDU_SIZE bytes for the response.
+ * @param responseLen Updated with the length of the response.
+ * @return @ref MODBUS_MAP_DONE if the response is ready else @ref MODBUS_MAP_PENDING.
+ */
+modbus_map_status_t ModbusMap_Process(int slot, const uint8_t* request, uint16_t len, uint8_t* response, uint16_t* responseLen)
+{
+	uint8_t function = request[0];
+	uint16_t address = len >= 3 ? GetU16(&request[1]) : 0;
+	uint16_t count = len >= 5 ? GetU16(&request[3]) : 0;
+	switch (function)
+	{
+	case FC_READ_HOLDING_REGISTERS:
+	case FC_READ_INPUT_REGISTERS:
+		if (len != 5 || count < 1 || count > MAX_READ_REGISTERS)
+			*responseLen = Exception(function, EX_ILLEGAL_DATA_VALUE, response);
+		else if (function == FC_READ_HOLDING_REGISTERS)
+			*responseLen = ReadHoldingRegisters(address, count, response);
+		else
+			*responseLen = ReadInputRegisters(address, count, response);
+		return MODBUS_MAP_DONE;
+	case FC_WRITE_SINGLE_REGISTER:
+		if (len != 5)
+			break;
+		return WriteRegisters(&writeSlots[slot], function, address, 1, &request[3], response, responseLen);
+	case FC_WRITE_MULTIPLE_REGISTERS:
+		if (len < 6 || count < 1 || count > MAX_WRITE_REGISTERS || request[5] != count * 2 || len != 6 + count * 2)
+			break;
+		return WriteRegisters(&writeSlots[slot], function, address, count, &request[6], response, responseLen);
+	default:
+		*responseLen = Exception(function, EX_ILLEGAL_FUNCTION, response);
+		return MODBUS_MAP_DONE;
+	}
+	*responseLen = Exception(function, EX_ILLEGAL_DATA_VALUE, response);
+	return MODBUS_MAP_DONE;
+}
+
+/**
+ * @brief Check if the write in progress of a slot is complete.
+ * @param slot Slot of the connection.
+ * @param response Buffer of @ref MODBUS_MAX_PDU_SIZE bytes for the response.
+ * @param responseLen Updated with the length of the response.
+ * @return <c>true</c> if complete and the response is ready else <c>false</c>.
+ */
+bool ModbusMap_Complete(int slot, uint8_t* response, uint16_t* responseLen)
+{
+	write_slot_t* write = &writeSlots[slot];
+	if (!write->isPending)
+		return false;
+	// the message buffers were full when the write was processed
+	if (!write->isPosted)
+	{
+		write->isPosted = P2PComms_Transaction_Async(&write->txn) == ERR_OK;
+		return false;
+	}
+	if (!write->txn.isComplete)
+	{
+		// completes the transaction even if the completion notification of the CM7 core is not enabled
+		__disable_irq();
+		P2PComms_ProcessCompletedTransactions();
+		__enable_irq();
+		if (!write->txn.isComplete)
+			return false;
+	}
+
+	write->isPending = false;
+	if (write->txn.err != ERR_OK)
+		*responseLen = Exception(write->response[0], EX_SERVER_DEVICE_FAILURE, response);
+	else
+	{
+		memcpy(response, write->response, WRITE_RESPONSE_SIZE);
+		*responseLen = WRITE_RESPONSE_SIZE;
+	}
+	return true;
+}
+
+/**
+ * @brief Add the statistics of the register map.
+ * @param stats Statistics to be updated.
+ */
+void ModbusMap_GetStats(modbus_stats_t* stats)
+{
+	stats->exceptions = mapStats.exceptions;
+	stats->readRegisters = mapStats.readRegisters;
+	stats->writtenRegisters = mapStats.writtenRegisters;
+	stats->transactions = mapStats.transactions;
+	stats->snapshots = mapStats.snapshots;
+}
+
+/* EOF */
@@ -0,0 +1,311 @@
+/**
+ ********************************************************************************
+ * @file 		modbus_server.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Handles the Modbus/TCP connections with the raw TCP API of LwIP
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <string.h>
+#include "modbus_server.h"
+#include "lwip/tcp.h"
+#include "lwip/pbuf.h"
+#include "lwip/sys.h"
+#include "lwip/timeouts.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** Size of the MBAP header, including the unit identifier */
+#define MBAP_HEADER_SIZE			(7)
+/** Interval of the poll callback of the connections, in units of the coarse TCP timer (500 ms) */
+#define IDLE_POLL_INTERVAL			(2)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief Connection of a client
+ */
+typedef struct
+{
+	struct tcp_pcb* pcb;
+	struct pbuf* rxQueue;
+	bool isPending;
+	uint8_t header[MBAP_HEADER_SIZE];
+	uint32_t lastRequest_ms;
+} modbus_conn_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static struct tcp_pcb* listenPcb = NULL;
+static modbus_conn_t connections[MODBUS_SERVER_MAX_CONNECTIONS];
+static modbus_stats_t serverStats;
+static uint8_t txAdu[MODBUS_MAX_ADU_SIZE];
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static inline uint16_t GetU16(const uint8_t* data)
+{
+	return ((uint16_t)data[0] << 8) | data[1];
+}
+
+static inline void PutU16(uint8_t* data, uint16_t value)
+{
+	data[0] = value >> 8;
+	data[1] = value & 0xFF;
+}
+
+/**
+ * @brief Close a connection. A write in progress is completed by @ref ModbusServer_Poll() and its response dropped.
+ * @param isAbort <c>true</c> to reset the connection instead of closing it gracefully.
+ */
+static void CloseConnection(modbus_conn_t* conn, bool isAbort)
+{
+	struct tcp_pcb* pcb = conn->pcb;
+	tcp_arg(pcb, NULL);
+	tcp_recv(pcb, NULL);
+	tcp_sent(pcb, NULL);
+	tcp_err(pcb, NULL);
+	tcp_poll(pcb, NULL, 0);
+	if (conn->rxQueue != NULL)
+		pbuf_free(conn->rxQueue);
+	conn->rxQueue = NULL;
+	conn->pcb = NULL;
+	if (isAbort || tcp_close(pcb) != ERR_OK)
+		tcp_abort(pcb);
+}
+
+/**
+ * @brief Queue the response in @ref txAdu for the request with the saved MBAP header.
+ * @param len Length of the response without the MBAP header.
+ */
+static void SendResponse(modbus_conn_t* conn, uint16_t len)
+{
+	// the transaction and the protocol identifiers and the unit identifier are repeated
+	memcpy(txAdu, conn->header, MBAP_HEADER_SIZE);
+	PutU16(&txAdu[4], len + 1);
+	// the space is checked before processing the request
+	tcp_write(conn->pcb, txAdu, MBAP_HEADER_SIZE + len, TCP_WRITE_FLAG_COPY);
+}
+
+/**
+ * @brief Process the complete requests received on a connection, one at a time.
+ * @details Stops at a write in progress or if the send buffer can't take the largest response, and continues from
+ * @ref ModbusServer_Poll() or the sent callback. The received data is only acknowledged to the TCP window once
+ * processed, so a client can't queue more requests than the window holds.
+ * @return ERR_ABRT if the connection is aborted for an invalid MBAP header else ERR_OK.
+ */
+static err_t ProcessRequests(modbus_conn_t* conn)
+{
+	while (!conn->isPending && conn->rxQueue != NULL && conn->rxQueue->tot_len >= MBAP_HEADER_SIZE)
+	{
+		if (tcp_sndbuf(conn->pcb) < MODBUS_MAX_ADU_SIZE || tcp_sndqueuelen(conn->pcb) >= TCP_SND_QUEUELEN)
+			break;
+		uint8_t adu[MODBUS_MAX_ADU_SIZE];
+		pbuf_copy_partial(conn->rxQueue, adu, MBAP_HEADER_SIZE, 0);
+		uint16_t len = GetU16(&adu[4]);
+		if (GetU16(&adu[2]) != 0 || len < 2 || len > MODBUS_MAX_PDU_SIZE + 1)
+		{
+			serverStats.frameErrors++;
+			CloseConnection(conn, true);
+			return ERR_ABRT;
+		}
+		uint16_t aduLen = MBAP_HEADER_SIZE - 1 + len;
+		if (conn->rxQueue->tot_len < aduLen)
+			break;
+		pbuf_copy_partial(conn->rxQueue, adu + MBAP_HEADER_SIZE, len - 1, MBAP_HEADER_SIZE);
+		conn->rxQueue = pbuf_free_header(conn->rxQueue, aduLen);
+		tcp_recved(conn->pcb, aduLen);
+		conn->lastRequest_ms = sys_now();
+		serverStats.requests++;
+
+		uint16_t responseLen;
+		memcpy(conn->header, adu, MBAP_HEADER_SIZE);
+		if (ModbusMap_Process(conn - connections, adu + MBAP_HEADER_SIZE, len - 1, txAdu + MBAP_HEADER_SIZE,
+				&responseLen) == MODBUS_MAP_PENDING)
+			conn->isPending = true;
+		else
+			SendResponse(conn, responseLen);
+	}
+	tcp_output(conn->pcb);
+	return ERR_OK;
+}
+
+static err_t Connection_Received(void* arg, struct tcp_pcb* pcb, struct pbuf* p, err_t err)
+{
+	modbus_conn_t* conn = (modbus_conn_t*)arg;
+	// closed by the client
+	if (p == NULL)
+	{
+		CloseConnection(conn, false);
+		return ERR_OK;
+	}
+	if (err != ERR_OK)
+	{
+		pbuf_free(p);
+		return err;
+	}
+	if (conn->rxQueue == NULL)
+		conn->rxQueue = p;
+	else
+		pbuf_cat(conn->rxQueue, p);
+	return ProcessRequests(conn);
+}
+
+static err_t Connection_Sent(void* arg, struct tcp_pcb* pcb, u16_t len)
+{
+	return ProcessRequests((modbus_conn_t*)arg);
+}
+
+/**
+ * @brief Called by LwIP after freeing the connection on a reset or an error.
+ */
+static void Connection_Error(void* arg, err_t err)
+{
+	modbus_conn_t* conn = (modbus_conn_t*)arg;
+	if (conn->rxQueue != NULL)
+		pbuf_free(conn->rxQueue);
+	conn->rxQueue = NULL;
+	conn->pcb = NULL;
+}
+
+/**
+ * @brief Close the connections without requests for @ref MODBUS_SERVER_IDLE_TIMEOUT_ms.
+ */
+static err_t Connection_Poll(void* arg, struct tcp_pcb* pcb)
+{
+	modbus_conn_t* conn = (modbus_conn_t*)arg;
+	if (!conn->isPending && sys_now() - conn->lastRequest_ms > MODBUS_SERVER_IDLE_TIMEOUT_ms)
+	{
+		CloseConnection(conn, true);
+		return ERR_ABRT;
+	}
+	return ERR_OK;
+}
+
+static err_t Connection_Accepted(void* arg, struct tcp_pcb* pcb, err_t err)
+{
+	if (err != ERR_OK || pcb == NULL)
+		return ERR_VAL;
+	// a slot is only reused after its write in progress is completed
+	modbus_conn_t* conn = NULL;
+	for (int i = 0; i < MODBUS_SERVER_MAX_CONNECTIONS && conn == NULL; i++)
+	{
+		if (connections[i].pcb == NULL && !connections[i].isPending)
+			conn = &connections[i];
+	}
+	if (conn == NULL)
+	{
+		serverStats.rejectedConnections++;
+		tcp_abort(pcb);
+		return ERR_ABRT;
+	}
+
+	conn->pcb = pcb;
+	conn->rxQueue = NULL;
+	conn->lastRequest_ms = sys_now();
+	// each response is sent as soon as it is ready
+	tcp_nagle_disable(pcb);
+	tcp_arg(pcb, conn);
+	tcp_recv(pcb, Connection_Received);
+	tcp_sent(pcb, Connection_Sent);
+	tcp_err(pcb, Connection_Error);
+	tcp_poll(pcb, Connection_Poll, IDLE_POLL_INTERVAL);
+	serverStats.connections++;
+	return ERR_OK;
+}
+
+static void Timer_Elapsed(void* arg)
+{
+	ModbusServer_Poll();
+	sys_timeout(MODBUS_SERVER_PERIOD_ms, Timer_Elapsed, NULL);
+}
+
+/**
+ * @brief Initialize the server and start listening for the connections.
+ * @note Call from the context of LwIP after the initialization of the stack.
+ * @param port TCP port of the server. 0 for @ref MODBUS_SERVER_PORT.
+ * @return <c>true</c> if successful else <c>false</c>.
+ */
+bool ModbusServer_Init(uint16_t port)
+{
+	struct tcp_pcb* pcb = tcp_new_ip_type(IPADDR_TYPE_ANY);
+	if (pcb == NULL)
+		return false;
+	if (tcp_bind(pcb, IP_ANY_TYPE, port ? port : MODBUS_SERVER_PORT) != ERR_OK)
+	{
+		tcp_close(pcb);
+		return false;
+	}
+	listenPcb = tcp_listen(pcb);
+	if (listenPcb == NULL)
+	{
+		tcp_close(pcb);
+		return false;
+	}
+	tcp_accept(listenPcb, Connection_Accepted);
+	sys_timeout(MODBUS_SERVER_PERIOD_ms, Timer_Elapsed, NULL);
+	return true;
+}
+
+/**
+ * @brief Complete the writes in progress and continue with the waiting requests.
+ * @note Called periodically by a timer of LwIP. Call from the context of LwIP.
+ */
+void ModbusServer_Poll(void)
+{
+	if (listenPcb == NULL)
+		return;
+	for (int i = 0; i < MODBUS_SERVER_MAX_CONNECTIONS; i++)
+	{
+		modbus_conn_t* conn = &connections[i];
+		uint16_t responseLen;
+		if (!conn->isPending || !ModbusMap_Complete(i, txAdu + MBAP_HEADER_SIZE, &responseLen))
+			continue;
+		conn->isPending = false;
+		// the response of a closed connection is dropped
+		if (conn->pcb == NULL)
+			continue;
+		SendResponse(conn, responseLen);
+		ProcessRequests(conn);
+	}
+}
+
+/**
+ * @brief Get the statistics of the server.
+ * @param stats Pointer to fill the statistics.
+ */
+void ModbusServer_GetStats(modbus_stats_t* stats)
+{
+	*stats = serverStats;
+	ModbusMap_GetStats(stats);
+}
+
+/* EOF */
@@ -0,0 +1,261 @@
+/**
+ ********************************************************************************
+ * @file 		usbd_adc_stream.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    USB vendor class streaming the raw ADC records over a bulk endpoint
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef USBD_ADC_STREAM_H_
+#define USBD_ADC_STREAM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/** @defgroup Usb_Comms USB Communication
+ * @brief Device classes for the STM32 USB device library.
+ * @{
+ */
+
+/** @defgroup USBD_ADC_Stream USB ADC Stream
+ * @brief Streams the records of an ADC ring buffer to the USB host over a vendor specific bulk IN endpoint.
+ * @details The device has a single vendor specific interface (class 0xFF, subclass @ref USBD_ADC_STREAM_SUBCLASS) with
+ * the bulk IN endpoint @ref USBD_ADC_STREAM_IN_EP. The host starts and stops the stream with the vendor requests of
+ * @ref usbd_adc_stream_req_t sent to the interface. Each transfer then starts with an @ref usbd_adc_stream_header_t
+ * followed by the records in the same layout as the ring buffer, i.e. @ref adc_raw_data_t.dataRecord. All values are
+ * little-endian.
+ *
+ * The records are copied into two transfer buffers. While the USB core sends one of them, the records are copied into
+ * the other one, which is handed over to the endpoint as soon as the previous transfer completes, so the endpoint is
+ * never idle while records are waiting. The records are taken from the ring at each start of frame and after each
+ * transfer, and a buffer is sent once it holds the requested records or after @ref USBD_ADC_STREAM_FLUSH_ms. If both
+ * buffers are still queued when the writer gets within @ref USBD_ADC_STREAM_GUARD_RECORDS of the oldest record, the
+ * oldest records are skipped and reported in @ref usbd_adc_stream_header_t.lostRecords.
+ *
+ * A transfer of less than @ref USBD_ADC_STREAM_BUFFER_SIZE bytes ends with a short packet or a zero length packet, so
+ * the host should read with buffers of @ref USBD_ADC_STREAM_BUFFER_SIZE bytes.
+ * The following code connects the stream with the raw ADC data of the shared memory.
+@code
+usbd_adc_stream_config_t config = {0};
+config.records = RAW_ADC_DATA.dataRecord;
+config.recordIndex = &RAW_ADC_DATA.recordIndex;
+config.recordSize = TOTAL_MEASUREMENT_COUNT * sizeof(uint16_t);
+config.recordCount = RAW_MEASURE_SAVE_COUNT;
+config.fs = &ADC_INFO.fs;
+UsbdAdcStream_Init(&config);
+USBD_Init(&hUsbDeviceHS, &HS_Desc, DEVICE_HS);
+USBD_RegisterClass(&hUsbDeviceHS, &USBD_AdcStream);
+USBD_Start(&hUsbDeviceHS);
+@endcode
+ * @note The start of frame interrupt of the PCD should be enabled (Sof_enable), as it takes the records from the ring.
+ * All callbacks of the class run from the USB interrupt, so no locking is needed between them. The transfer buffers
+ * should be placed in a memory reachable by the DMA of the USB controller if it is enabled.
+ * @note 16 channels at 100 kSPS take 3.2 MB/s, so the full rate needs a high speed connection. At full speed the
+ * records are streamed as fast as the bus allows and the rest are reported as lost.
+ * @{
+ */
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "usbd_ioreq.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** @defgroup USBDADCStream_Exported_Macros Macros
+ * @{
+ */
+/**
+ * @brief Address of the bulk IN endpoint
+ */
+#ifndef USBD_ADC_STREAM_IN_EP
+#define USBD_ADC_STREAM_IN_EP				(0x81U)
+#endif
+/**
+ * @brief Maximum packet size of the bulk IN endpoint at high speed
+ */
+#define USBD_ADC_STREAM_HS_MAX_PACKET		(512U)
+/**
+ * @brief Maximum packet size of the bulk IN endpoint at full speed
+ */
+#define USBD_ADC_STREAM_FS_MAX_PACKET		(64U)
+/**
+ * @brief Size of each of the two transfer buffers in bytes, with the header
+ */
+#ifndef USBD_ADC_STREAM_BUFFER_SIZE
+#define USBD_ADC_STREAM_BUFFER_SIZE			(4096U)
+#endif
+/**
+ * @brief No of records at the end of the ring, ahead of the records being written, which are not copied.
+ * @details Should cover the time taken by the copy.
+ */
+#ifndef USBD_ADC_STREAM_GUARD_RECORDS
+#define USBD_ADC_STREAM_GUARD_RECORDS		(16)
+#endif
+/**
+ * @brief Time after which the records are sent even if they don't fill a transfer in milli-seconds
+ */
+#ifndef USBD_ADC_STREAM_FLUSH_ms
+#define USBD_ADC_STREAM_FLUSH_ms			(2)
+#endif
+/**
+ * @brief Interface subclass identifying the stream among the vendor specific interfaces ('T')
+ */
+#define USBD_ADC_STREAM_SUBCLASS			(0x54U)
+/**
+ * @brief Interface protocol of the stream, same as @ref USBD_ADC_STREAM_VERSION
+ */
+#define USBD_ADC_STREAM_PROTOCOL			(0x01U)
+/**
+ * @brief Magic number starting each transfer ("TU")
+ */
+#define USBD_ADC_STREAM_MAGIC				(0x5554u)
+/**
+ * @brief Current version of the transfers
+ */
+#define USBD_ADC_STREAM_VERSION				(1)
+/**
+ * @brief Size of the configuration descriptor
+ */
+#define USBD_ADC_STREAM_CONFIG_DESC_SIZE	(9U + 9U + 7U)
+/**
+ * @}
+ */
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+/** @defgroup USBDADCStream_Exported_Typedefs Type Definitions
+ * @{
+ */
+/**
+ * @brief Vendor requests of the interface, with wIndex holding the interface no
+ */
+typedef enum
+{
+	USBD_ADC_STREAM_REQ_START = 1,		/**< @brief Host to device. Start or restart the stream with wValue records per transfer, 0 for as many as fit */
+	USBD_ADC_STREAM_REQ_STOP = 2,		/**< @brief Host to device. Stop the stream after the transfer in progress */
+	USBD_ADC_STREAM_REQ_GET_STATS = 3,	/**< @brief Device to host. Read the @ref usbd_adc_stream_stats_t */
+} usbd_adc_stream_req_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/** @defgroup USBDADCStream_Exported_Structures Structures
+ * @{
+ */
+/**
+ * @brief Header of each transfer
+ */
+typedef struct __attribute__((packed))
+{
+	uint16_t magic;						/**< @brief Should be @ref USBD_ADC_STREAM_MAGIC */
+	uint8_t version;					/**< @brief Version of the transfer @ref USBD_ADC_STREAM_VERSION */
+	uint8_t reserved;					/**< @brief Reserved for future use. Zero */
+	uint32_t sequence;					/**< @brief Transfer no counted from the start of the stream */
+	uint32_t firstRecord;				/**< @brief No of the first record counted from the start of the stream */
+	uint32_t timestamp_us;				/**< @brief Time of taking the first record in micro-seconds */
+	uint32_t lostRecords;				/**< @brief Total no of records skipped since the start of the stream */
+	float fs;							/**< @brief Sampling rate of the ADC */
+	uint16_t recordCount;				/**< @brief No of records following the header */
+	uint16_t recordSize;				/**< @brief Size of each record in bytes */
+	uint16_t maxRecords;				/**< @brief Records in a full transfer of the stream */
+	uint16_t reserved2;					/**< @brief Reserved for future use. Zero */
+} usbd_adc_stream_header_t;
+/**
+ * @brief Configuration of the stream
+ */
+typedef struct
+{
+	const volatile void* records;		/**< @brief Start of the ring buffer */
+	const volatile int* recordIndex;	/**< @brief Index of the next record written to the ring buffer */
+	uint16_t recordSize;				/**< @brief Size of each record in bytes */
+	uint16_t recordCount;				/**< @brief No of records in the ring buffer. Should be 2 ^ n */
+	const volatile float* fs;			/**< @brief Pointer to the sampling rate of the ADC */
+} usbd_adc_stream_config_t;
+/**
+ * @brief Statistics of the stream
+ */
+typedef struct __attribute__((packed))
+{
+	uint32_t starts;					/**< @brief No of start requests */
+	uint32_t transfers;					/**< @brief No of completed transfers */
+	uint32_t records;					/**< @brief No of records sent */
+	uint32_t lostRecords;				/**< @brief No of records skipped as both buffers were queued */
+	uint32_t zeroLengthPackets;			/**< @brief No of zero length packets ending the transfers */
+	uint32_t waits;						/**< @brief No of frames finding both buffers queued */
+} usbd_adc_stream_stats_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+/** @defgroup USBDADCStream_Exported_Variables Variables
+ * @{
+ */
+/**
+ * @brief Class callbacks for @ref USBD_RegisterClass()
+ */
+extern USBD_ClassTypeDef USBD_AdcStream;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+/** @defgroup USBDADCStream_Exported_Functions Functions
+ * @{
+ */
+/**
+ * @brief Set the ring buffer of the stream.
+ * @note Call before registering the class.
+ * @param config Configuration of the stream. The contents are copied.
+ * @return <c>true</c> if successful else <c>false</c> if a record doesn't fit the transfer buffers.
+ */
+extern bool UsbdAdcStream_Init(const usbd_adc_stream_config_t* config);
+/**
+ * @brief Get the statistics of the stream.
+ * @param stats Pointer to fill the statistics.
+ */
+extern void UsbdAdcStream_GetStats(usbd_adc_stream_stats_t* stats);
+/**
+ * @brief Get the time for the records counting and the timestamps of the transfers.
+ * @note Defined weak with the resolution of the HAL tick. Redefine for a finer resolution.
+ * @return Time in micro-seconds.
+ */
+extern uint32_t UsbdAdcStream_GetTime_us(void);
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+
+/**
+ * @}
+ */
+/**
+ * @}
+ */
+/**
+ * @}
+ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */
@@ -0,0 +1,562 @@
+/**
+ ********************************************************************************
+ * @file 		usbd_adc_stream.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Double buffered bulk transfers of the ADC records for the USB device library
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <string.h>
+#include "usbd_adc_stream.h"
+#include "usbd_ctlreq.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** Size of the header of a transfer */
+#define HEADER_SIZE					(sizeof(usbd_adc_stream_header_t))
+/** No of transfer buffers */
+#define BUFFER_COUNT				(2)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+/**
+ * @brief States of a transfer buffer
+ */
+typedef enum
+{
+	BUFFER_FREE,				/**< Receiving the records */
+	BUFFER_READY,				/**< Complete and waiting for the endpoint */
+	BUFFER_BUSY,				/**< Being sent by the endpoint */
+} buffer_state_t;
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief Transfer buffer
+ */
+typedef struct
+{
+	uint8_t data[USBD_ADC_STREAM_BUFFER_SIZE] __attribute__((aligned(4)));
+	uint32_t len;
+	buffer_state_t state;
+} stream_buffer_t;
+/**
+ * @brief State of the stream
+ */
+typedef struct
+{
+	stream_buffer_t buffers[BUFFER_COUNT];
+	uint8_t fillIndex;
+	int8_t sendIndex;
+	bool isStreaming;
+	bool isZlpSent;
+	uint16_t maxPacket;
+	uint16_t maxRecords;
+	uint32_t nextRecord;
+	uint32_t sequence;
+	uint32_t lostRecords;
+	uint32_t fillStart_us;
+	/* progress of the ring buffer */
+	uint32_t recordCount;
+	int lastIndex;
+	uint32_t lastTime_us;
+} stream_handle_t;
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+static uint8_t UsbdAdcStream_Init_Class(USBD_HandleTypeDef* pdev, uint8_t cfgidx);
+static uint8_t UsbdAdcStream_DeInit_Class(USBD_HandleTypeDef* pdev, uint8_t cfgidx);
+static uint8_t UsbdAdcStream_Setup(USBD_HandleTypeDef* pdev, USBD_SetupReqTypedef* req);
+static uint8_t UsbdAdcStream_DataIn(USBD_HandleTypeDef* pdev, uint8_t epnum);
+static uint8_t UsbdAdcStream_SOF(USBD_HandleTypeDef* pdev);
+static uint8_t* UsbdAdcStream_GetHSCfgDesc(uint16_t* length);
+static uint8_t* UsbdAdcStream_GetFSCfgDesc(uint16_t* length);
+static uint8_t* UsbdAdcStream_GetOtherSpeedCfgDesc(uint16_t* length);
+static uint8_t* UsbdAdcStream_GetDeviceQualifierDesc(uint16_t* length);
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static usbd_adc_stream_config_t streamConfig;
+static stream_handle_t streamHandle;
+static usbd_adc_stream_stats_t streamStats;
+/** Copy of the statistics being sent for @ref USBD_ADC_STREAM_REQ_GET_STATS */
+static usbd_adc_stream_stats_t statsResponse;
+
+/**
+ * @brief Configuration descriptor at high speed, with a vendor specific interface and a bulk IN endpoint
+ */
+__ALIGN_BEGIN static uint8_t hsConfigDesc[USBD_ADC_STREAM_CONFIG_DESC_SIZE] __ALIGN_END =
+{
+	/* configuration descriptor */
+	0x09, USB_DESC_TYPE_CONFIGURATION, LOBYTE(USBD_ADC_STREAM_CONFIG_DESC_SIZE), HIBYTE(USBD_ADC_STREAM_CONFIG_DESC_SIZE),
+	0x01,										/* bNumInterfaces */
+	0x01,										/* bConfigurationValue */
+	0x00,										/* iConfiguration */
+#if (USBD_SELF_POWERED == 1U)
+	0xC0,										/* bmAttributes: self powered */
+#else
+	0x80,										/* bmAttributes: bus powered */
+#endif
+	USBD_MAX_POWER,
+	/* interface descriptor */
+	0x09, USB_DESC_TYPE_INTERFACE,
+	0x00,										/* bInterfaceNumber */
+	0x00,										/* bAlternateSetting */
+	0x01,										/* bNumEndpoints */
+	0xFF,										/* bInterfaceClass: vendor specific */
+	USBD_ADC_STREAM_SUBCLASS,
+	USBD_ADC_STREAM_PROTOCOL,
+	0x00,										/* iInterface */
+	/* endpoint descriptor */
+	0x07, USB_DESC_TYPE_ENDPOINT,
+	USBD_ADC_STREAM_IN_EP,
+	USBD_EP_TYPE_BULK,
+	LOBYTE(USBD_ADC_STREAM_HS_MAX_PACKET), HIBYTE(USBD_ADC_STREAM_HS_MAX_PACKET),
+	0x00,										/* bInterval */
+};
+/**
+ * @brief Configuration descriptor at full speed and for the other speed
+ */
+__ALIGN_BEGIN static uint8_t fsConfigDesc[USBD_ADC_STREAM_CONFIG_DESC_SIZE] __ALIGN_END =
+{
+	0x09, USB_DESC_TYPE_CONFIGURATION, LOBYTE(USBD_ADC_STREAM_CONFIG_DESC_SIZE), HIBYTE(USBD_ADC_STREAM_CONFIG_DESC_SIZE),
+	0x01, 0x01, 0x00,
+#if (USBD_SELF_POWERED == 1U)
+	0xC0,
+#else
+	0x80,
+#endif
+	USBD_MAX_POWER,
+	0x09, USB_DESC_TYPE_INTERFACE, 0x00, 0x00, 0x01, 0xFF, USBD_ADC_STREAM_SUBCLASS, USBD_ADC_STREAM_PROTOCOL, 0x00,
+	0x07, USB_DESC_TYPE_ENDPOINT, USBD_ADC_STREAM_IN_EP, USBD_EP_TYPE_BULK,
+	LOBYTE(USBD_ADC_STREAM_FS_MAX_PACKET), HIBYTE(USBD_ADC_STREAM_FS_MAX_PACKET), 0x00,
+};
+__ALIGN_BEGIN static uint8_t deviceQualifierDesc[USB_LEN_DEV_QUALIFIER_DESC] __ALIGN_END =
+{
+	USB_LEN_DEV_QUALIFIER_DESC, USB_DESC_TYPE_DEVICE_QUALIFIER,
+	0x00, 0x02,									/* bcdUSB */
+	0x00, 0x00, 0x00,							/* class defined by the interface */
+	0x40,										/* bMaxPacketSize0 */
+	0x01,										/* bNumConfigurations */
+	0x00,
+};
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+/**
+ * @brief Class callbacks for @ref USBD_RegisterClass()
+ */
+USBD_ClassTypeDef USBD_AdcStream =
+{
+	UsbdAdcStream_Init_Class,
+	UsbdAdcStream_DeInit_Class,
+	UsbdAdcStream_Setup,
+	NULL,
+	NULL,
+	UsbdAdcStream_DataIn,
+	NULL,
+	UsbdAdcStream_SOF,
+	NULL,
+	NULL,
+	UsbdAdcStream_GetHSCfgDesc,
+	UsbdAdcStream_GetFSCfgDesc,
+	UsbdAdcStream_GetOtherSpeedCfgDesc,
+	UsbdAdcStream_GetDeviceQualifierDesc,
+};
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Get the time for the records counting and the timestamps of the transfers.
+ * @note Defined weak with the resolution of the HAL tick. Redefine for a finer resolution.
+ * @return Time in micro-seconds.
+ */
+__weak uint32_t UsbdAdcStream_GetTime_us(void)
+{
+	return HAL_GetTick() * 1000;
+}
+
+/**
+ * @brief Count the records written to the ring buffer since the last update.
+ * @details The index only gives the records modulo the size of the ring, so the complete turns of the writer after a
+ * late update are estimated from the sampling rate.
+ */
+static void UpdateSource(stream_handle_t* handle)
+{
+	uint32_t now = UsbdAdcStream_GetTime_us();
+	float fs = streamConfig.fs ? *streamConfig.fs : 0;
+	int index = *streamConfig.recordIndex;
+	uint32_t count = (index - handle->lastIndex) & (streamConfig.recordCount - 1);
+	float expected = (now - handle->lastTime_us) * fs * 1e-6f;
+	int32_t turns = (int32_t)((expected - count) / streamConfig.recordCount + 0.5f);
+	if (turns > 0)
+		count += streamConfig.recordCount * turns;
+	handle->recordCount += count;
+	handle->lastIndex = index;
+	handle->lastTime_us = now;
+}
+
+/**
+ * @brief Hand a buffer over to the endpoint.
+ */
+static void StartTransfer(USBD_HandleTypeDef* pdev, stream_handle_t* handle, int index)
+{
+	stream_buffer_t* buffer = &handle->buffers[index];
+	buffer->state = BUFFER_BUSY;
+	handle->sendIndex = index;
+	handle->isZlpSent = false;
+	(void)USBD_LL_Transmit(pdev, USBD_ADC_STREAM_IN_EP, buffer->data, buffer->len);
+}
+
+/**
+ * @brief Complete the buffer being filled and send it if the endpoint is idle.
+ */
+static void SubmitBuffer(USBD_HandleTypeDef* pdev, stream_handle_t* handle)
+{
+	int index = handle->fillIndex;
+	stream_buffer_t* buffer = &handle->buffers[index];
+	usbd_adc_stream_header_t* header = (usbd_adc_stream_header_t*)buffer->data;
+	header->magic = USBD_ADC_STREAM_MAGIC;
+	header->version = USBD_ADC_STREAM_VERSION;
+	header->reserved = 0;
+	header->sequence = handle->sequence++;
+	header->timestamp_us = handle->fillStart_us;
+	header->lostRecords = handle->lostRecords;
+	header->fs = streamConfig.fs ? *streamConfig.fs : 0;
+	header->recordCount = (buffer->len - HEADER_SIZE) / streamConfig.recordSize;
+	header->recordSize = streamConfig.recordSize;
+	header->maxRecords = handle->maxRecords;
+	header->reserved2 = 0;
+	buffer->state = BUFFER_READY;
+	handle->fillIndex = (index + 1) % BUFFER_COUNT;
+	if (handle->sendIndex < 0)
+		StartTransfer(pdev, handle, index);
+}
+
+/**
+ * @brief Copy consecutive records of the ring to the buffer being filled.
+ */
+static void CopyRecords(stream_buffer_t* buffer, uint32_t firstRecord, uint32_t count)
+{
+	uint32_t first = firstRecord & (streamConfig.recordCount - 1);
+	// consecutive records take two parts at most, at the end and the start of the ring
+	uint32_t tillEnd = streamConfig.recordCount - first;
+	uint32_t firstPart = count < tillEnd ? count : tillEnd;
+	const uint8_t* records = (const uint8_t*)streamConfig.records;
+	memcpy(buffer->data + buffer->len, records + first * streamConfig.recordSize, firstPart * streamConfig.recordSize);
+	buffer->len += firstPart * streamConfig.recordSize;
+	if (count > firstPart)
+	{
+		memcpy(buffer->data + buffer->len, records, (count - firstPart) * streamConfig.recordSize);
+		buffer->len += (count - firstPart) * streamConfig.recordSize;
+	}
+}
+
+/**
+ * @brief Copy the available records to the free buffers, submitting each buffer once full or after
+ * @ref USBD_ADC_STREAM_FLUSH_ms.
+ */
+static void FillBuffers(USBD_HandleTypeDef* pdev, stream_handle_t* handle)
+{
+	UpdateSource(handle);
+	// skip the records which may be overwritten while being copied
+	uint32_t maxLag = streamConfig.recordCount - USBD_ADC_STREAM_GUARD_RECORDS;
+	uint32_t lag = handle->recordCount - handle->nextRecord;
+	if ((int32_t)lag > (int32_t)maxLag)
+	{
+		// the records of a transfer are consecutive, so the records before the gap are sent on their own
+		stream_buffer_t* buffer = &handle->buffers[handle->fillIndex];
+		if (buffer->state == BUFFER_FREE && buffer->len > HEADER_SIZE)
+			SubmitBuffer(pdev, handle);
+		handle->nextRecord += lag - maxLag;
+		handle->lostRecords += lag - maxLag;
+		streamStats.lostRecords += lag - maxLag;
+		lag = maxLag;
+	}
+
+	while (true)
+	{
+		stream_buffer_t* buffer = &handle->buffers[handle->fillIndex];
+		// both buffers are queued, so the records wait in the ring
+		if (buffer->state != BUFFER_FREE)
+		{
+			if ((int32_t)lag > 0)
+				streamStats.waits++;
+			return;
+		}
+		uint32_t filled = (buffer->len - HEADER_SIZE) / streamConfig.recordSize;
+		if ((int32_t)lag > 0)
+		{
+			if (filled == 0)
+			{
+				((usbd_adc_stream_header_t*)buffer->data)->firstRecord = handle->nextRecord;
+				handle->fillStart_us = handle->lastTime_us;
+			}
+			uint32_t count = handle->maxRecords - filled;
+			if (count > lag)
+				count = lag;
+			CopyRecords(buffer, handle->nextRecord, count);
+			handle->nextRecord += count;
+			lag -= count;
+			filled += count;
+		}
+		if (filled != handle->maxRecords &&
+				(filled == 0 || handle->lastTime_us - handle->fillStart_us < USBD_ADC_STREAM_FLUSH_ms * 1000))
+			return;
+		SubmitBuffer(pdev, handle);
+	}
+}
+
+/**
+ * @brief Reset the buffers which are not being sent.
+ */
+static void ResetBuffers(stream_handle_t* handle)
+{
+	for (int i = 0; i < BUFFER_COUNT; i++)
+	{
+		if (handle->buffers[i].state != BUFFER_BUSY)
+		{
+			handle->buffers[i].state = BUFFER_FREE;
+			handle->buffers[i].len = HEADER_SIZE;
+		}
+	}
+}
+
+/**
+ * @brief Start or restart the stream with the newest records.
+ * @return USBD_OK if successful else USBD_FAIL for an invalid no of records.
+ */
+static uint8_t StartStream(stream_handle_t* handle, uint16_t maxRecords)
+{
+	uint16_t limit = (USBD_ADC_STREAM_BUFFER_SIZE - HEADER_SIZE) / streamConfig.recordSize;
+	if (maxRecords > limit)
+		return (uint8_t)USBD_FAIL;
+	handle->maxRecords = maxRecords ? maxRecords : limit;
+	ResetBuffers(handle);
+	UpdateSource(handle);
+	handle->nextRecord = handle->recordCount;
+	handle->sequence = 0;
+	handle->lostRecords = 0;
+	handle->isStreaming = true;
+	streamStats.starts++;
+	return (uint8_t)USBD_OK;
+}
+
+/**
+ * @brief Open the endpoint when the host sets the configuration.
+ */
+static uint8_t UsbdAdcStream_Init_Class(USBD_HandleTypeDef* pdev, uint8_t cfgidx)
+{
+	UNUSED(cfgidx);
+	stream_handle_t* handle = &streamHandle;
+	if (streamConfig.records == NULL)
+		return (uint8_t)USBD_FAIL;
+	handle->maxPacket = pdev->dev_speed == USBD_SPEED_HIGH ? USBD_ADC_STREAM_HS_MAX_PACKET : USBD_ADC_STREAM_FS_MAX_PACKET;
+	(void)USBD_LL_OpenEP(pdev, USBD_ADC_STREAM_IN_EP, USBD_EP_TYPE_BULK, handle->maxPacket);
+	pdev->ep_in[USBD_ADC_STREAM_IN_EP & 0xFU].is_used = 1U;
+	handle->isStreaming = false;
+	handle->sendIndex = -1;
+	handle->fillIndex = 0;
+	for (int i = 0; i < BUFFER_COUNT; i++)
+		handle->buffers[i].state = BUFFER_FREE;
+	ResetBuffers(handle);
+	// the count starts from the index, so it gives the position of each record in the ring
+	handle->lastIndex = *streamConfig.recordIndex;
+	handle->recordCount = handle->lastIndex;
+	handle->lastTime_us = UsbdAdcStream_GetTime_us();
+	pdev->pClassData = handle;
+	return (uint8_t)USBD_OK;
+}
+
+/**
+ * @brief Close the endpoint when the device is reset or unconfigured. A transfer in progress is dropped.
+ */
+static uint8_t UsbdAdcStream_DeInit_Class(USBD_HandleTypeDef* pdev, uint8_t cfgidx)
+{
+	UNUSED(cfgidx);
+	stream_handle_t* handle = &streamHandle;
+	(void)USBD_LL_CloseEP(pdev, USBD_ADC_STREAM_IN_EP);
+	pdev->ep_in[USBD_ADC_STREAM_IN_EP & 0xFU].is_used = 0U;
+	handle->isStreaming = false;
+	handle->sendIndex = -1;
+	for (int i = 0; i < BUFFER_COUNT; i++)
+		handle->buffers[i].state = BUFFER_FREE;
+	pdev->pClassData = NULL;
+	return (uint8_t)USBD_OK;
+}
+
+/**
+ * @brief Handle the vendor requests of the stream and the standard requests of the interface.
+ */
+static uint8_t UsbdAdcStream_Setup(USBD_HandleTypeDef* pdev, USBD_SetupReqTypedef* req)
+{
+	stream_handle_t* handle = (stream_handle_t*)pdev->pClassData;
+	uint8_t ifalt = 0U;
+	uint16_t statusInfo = 0U;
+	uint8_t ret = (uint8_t)USBD_OK;
+
+	if (handle == NULL || pdev->dev_state != USBD_STATE_CONFIGURED)
+	{
+		USBD_CtlError(pdev, req);
+		return (uint8_t)USBD_FAIL;
+	}
+
+	switch (req->bmRequest & USB_REQ_TYPE_MASK)
+	{
+		case USB_REQ_TYPE_VENDOR:
+			if (req->bRequest == USBD_ADC_STREAM_REQ_START && req->wLength == 0U)
+				ret = StartStream(handle, req->wValue);
+			else if (req->bRequest == USBD_ADC_STREAM_REQ_STOP && req->wLength == 0U)
+			{
+				handle->isStreaming = false;
+				ResetBuffers(handle);
+			}
+			else if (req->bRequest == USBD_ADC_STREAM_REQ_GET_STATS && (req->bmRequest & 0x80U) != 0U)
+			{
+				statsResponse = streamStats;
+				(void)USBD_CtlSendData(pdev, (uint8_t*)&statsResponse, MIN(sizeof(statsResponse), req->wLength));
+			}
+			else
+				ret = (uint8_t)USBD_FAIL;
+			break;
+
+		case USB_REQ_TYPE_STANDARD:
+			switch (req->bRequest)
+			{
+				case USB_REQ_GET_STATUS:
+					(void)USBD_CtlSendData(pdev, (uint8_t*)&statusInfo, 2U);
+					break;
+				case USB_REQ_GET_INTERFACE:
+					(void)USBD_CtlSendData(pdev, &ifalt, 1U);
+					break;
+				case USB_REQ_SET_INTERFACE:
+				case USB_REQ_CLEAR_FEATURE:
+					break;
+				default:
+					ret = (uint8_t)USBD_FAIL;
+					break;
+			}
+			break;
+
+		default:
+			ret = (uint8_t)USBD_FAIL;
+			break;
+	}
+
+	if (ret != (uint8_t)USBD_OK)
+		USBD_CtlError(pdev, req);
+	return ret;
+}
+
+/**
+ * @brief Hand the next buffer over to the endpoint once a transfer completes, and refill the sent buffer.
+ * @details A transfer of a multiple of the maximum packet size which doesn't fill the buffer of the host is ended
+ * with a zero length packet first.
+ */
+static uint8_t UsbdAdcStream_DataIn(USBD_HandleTypeDef* pdev, uint8_t epnum)
+{
+	UNUSED(epnum);
+	stream_handle_t* handle = (stream_handle_t*)pdev->pClassData;
+	if (handle == NULL || handle->sendIndex < 0)
+		return (uint8_t)USBD_FAIL;
+	stream_buffer_t* buffer = &handle->buffers[handle->sendIndex];
+	if (!handle->isZlpSent && (buffer->len % handle->maxPacket) == 0U && buffer->len < USBD_ADC_STREAM_BUFFER_SIZE)
+	{
+		handle->isZlpSent = true;
+		streamStats.zeroLengthPackets++;
+		(void)USBD_LL_Transmit(pdev, USBD_ADC_STREAM_IN_EP, NULL, 0U);
+		return (uint8_t)USBD_OK;
+	}
+
+	streamStats.transfers++;
+	streamStats.records += (buffer->len - HEADER_SIZE) / streamConfig.recordSize;
+	buffer->state = BUFFER_FREE;
+	buffer->len = HEADER_SIZE;
+	// the other buffer is sent right away if it was completed in the meantime
+	int next = (handle->sendIndex + 1) % BUFFER_COUNT;
+	handle->sendIndex = -1;
+	if (handle->buffers[next].state == BUFFER_READY)
+		StartTransfer(pdev, handle, next);
+	// the freed buffer takes the records waiting in the ring
+	if (handle->isStreaming)
+		FillBuffers(pdev, handle);
+	return (uint8_t)USBD_OK;
+}
+
+/**
+ * @brief Take the new records from the ring at each start of frame.
+ */
+static uint8_t UsbdAdcStream_SOF(USBD_HandleTypeDef* pdev)
+{
+	stream_handle_t* handle = (stream_handle_t*)pdev->pClassData;
+	if (handle != NULL && handle->isStreaming)
+		FillBuffers(pdev, handle);
+	return (uint8_t)USBD_OK;
+}
+
+static uint8_t* UsbdAdcStream_GetHSCfgDesc(uint16_t* length)
+{
+	*length = (uint16_t)sizeof(hsConfigDesc);
+	return hsConfigDesc;
+}
+
+static uint8_t* UsbdAdcStream_GetFSCfgDesc(uint16_t* length)
+{
+	*length = (uint16_t)sizeof(fsConfigDesc);
+	return fsConfigDesc;
+}
+
+static uint8_t* UsbdAdcStream_GetOtherSpeedCfgDesc(uint16_t* length)
+{
+	*length = (uint16_t)sizeof(fsConfigDesc);
+	return fsConfigDesc;
+}
+
+static uint8_t* UsbdAdcStream_GetDeviceQualifierDesc(uint16_t* length)
+{
+	*length = (uint16_t)sizeof(deviceQualifierDesc);
+	return deviceQualifierDesc;
+}
+
+/**
+ * @brief Set the ring buffer of the stream.
+ * @note Call before registering the class.
+ * @param config Configuration of the stream. The contents are copied.
+ * @return <c>true</c> if successful else <c>false</c> if a record doesn't fit the transfer buffers.
+ */
+bool UsbdAdcStream_Init(const usbd_adc_stream_config_t* config)
+{
+	if (config->records == NULL || config->recordSize == 0 ||
+			HEADER_SIZE + config->recordSize > USBD_ADC_STREAM_BUFFER_SIZE)
+		return false;
+	streamConfig = *config;
+	memset(&streamStats, 0, sizeof(streamStats));
+	return true;
+}
+
+/**
+ * @brief Get the statistics of the stream.
+ * @param stats Pointer to fill the statistics.
+ */
+void UsbdAdcStream_GetStats(usbd_adc_stream_stats_t* stats)
+{
+	*stats = streamStats;
+}
+
+/* EOF */
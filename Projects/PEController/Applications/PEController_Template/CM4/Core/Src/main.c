@@ -29,6 +29,7 @@
 #endif
 
 #include "shared_memory.h"
+#include "task_telemetry.h"
 
 #include "state_storage_lib.h"
 #include "pecontroller_adc.h"
@@ -50,6 +51,14 @@
 #ifndef HSEM_ID_0
 #define HSEM_ID_0 (0U) /* HW semaphore 0*/
 #endif
+/* Longest wait of the statistics for a block of ADC records, bounding the delay of the records after the last block */
+#define ADC_RECORDS_WAIT_TIMEOUT_ms		(20)
+/* Thread flag used to request the storage of the changed states */
+#define STORAGE_REFRESH_THREAD_FLAG		(1UL << 0)
+/* Period of the refresh of the states, storing the changes made without a request */
+#define STORAGE_REFRESH_PERIOD_ms		(2000)
+/* Delay of the storage after a request, so that the changes made together are stored in a single record */
+#define STORAGE_REFRESH_DELAY_ms		(100)
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -162,6 +171,8 @@ int main(void)
 	P2PComms_ConfigStorage(&storageClients[2]);
 	StateStorage_Init(&storageConfig);
 	sharedData->isStateStorageInitialized = true;
+	P2PComms_InitDoorbell();
+	SharedMemory_InitAdcNotification();
   /* USER CODE END Init */
 
   /* USER CODE BEGIN SysInit */
@@ -196,6 +207,7 @@ int main(void)
 
   /* USER CODE BEGIN RTOS_TIMERS */
 	/* start timers, add new ones, ... */
+	TaskTelemetry_Init();
   /* USER CODE END RTOS_TIMERS */
 
   /* USER CODE BEGIN RTOS_QUEUES */
@@ -403,7 +415,21 @@ static void MX_GPIO_Init(void)
 }
 
 /* USER CODE BEGIN 4 */
+/**
+ * @brief Wake the storage task to store the parameters updated by the CM4 core.
+ */
+void P2PComms_ParametersUpdatedCallback(void)
+{
+	osThreadFlagsSet(storageTaskHandle, STORAGE_REFRESH_THREAD_FLAG);
+}
 
+/**
+ * @brief Wake the storage task to store the measurement settings changed from the screens.
+ */
+void ScreenManager_SettingsChangedCallback(void)
+{
+	osThreadFlagsSet(storageTaskHandle, STORAGE_REFRESH_THREAD_FLAG);
+}
 /* USER CODE END 4 */
 
 /* USER CODE BEGIN Header_StartStorageTask */
@@ -419,8 +445,13 @@ void StartStorageTask(void *argument)
 	/* Infinite loop */
 	for(;;)
 	{
+		uint32_t flags = osThreadFlagsWait(STORAGE_REFRESH_THREAD_FLAG, osFlagsWaitAny, STORAGE_REFRESH_PERIOD_ms);
+		if ((flags & osFlagsError) == 0)
+		{
+			osDelay(STORAGE_REFRESH_DELAY_ms);
+			osThreadFlagsClear(STORAGE_REFRESH_THREAD_FLAG);
+		}
 		StateStorage_Refresh();
-		osDelay(2000);
 	}
   /* USER CODE END 5 */
 }
@@ -438,8 +469,9 @@ void StartStatsTask(void *argument)
 	/* Infinite loop */
 	for(;;)
 	{
-		BSP_ADC_ComputeStatsInBulk((adc_processed_data_t*)&PROCESSED_ADC_DATA, (float)ADC_INFO.fs);
-		osDelay(1);
+		SharedMemory_WaitForAdcRecords(ADC_RECORDS_WAIT_TIMEOUT_ms);
+		if (BSP_ADC_ComputeStatsInBulk((adc_processed_data_t*)&PROCESSED_ADC_DATA, (float)ADC_INFO.fs))
+			BSP_Display_NotifyEvents(DISPLAY_EVENT_STATS);
 	}
   /* USER CODE END StartStatsTask */
 }
@@ -455,16 +487,14 @@ void StartDisplayTask(void *argument)
 {
   /* USER CODE BEGIN StartDisplayTask */
 	/* Infinite loop */
-	int i = 0;
 	for(;;)
 	{
-		if (++i > 4)
-		{
-			ScreenManager_Refresh();
-			i = 0;
-		}
+		// the touch inputs are read first, so the screens handle their tags right away
 		lv_timer_handler();
-		osDelay(5);
+		ScreenManager_Refresh();
+		// draw the changes of the screens, then sleep till an event, the next timer of LVGL or the next poll
+		uint32_t timeout = lv_timer_handler();
+		BSP_Display_WaitForEvents(timeout < DISPLAY_POLL_PERIOD_ms ? timeout : DISPLAY_POLL_PERIOD_ms);
 	}
   /* USER CODE END StartDisplayTask */
 }
@@ -484,8 +514,16 @@ void StartTouchTask(void *argument)
 	/* Infinite loop */
 	for(;;)
 	{
+#if TS_IRQ_MODE
+		BSP_TS_WaitAndProcess();
+#else
 		BSP_TS_Poll();
+#endif
+		if (BSP_TS_IsEventPending())
+			BSP_Display_NotifyEvents(DISPLAY_EVENT_TOUCH);
+#if !TS_IRQ_MODE
 		osDelay(20);
+#endif
 	}
   /* USER CODE END StartTouchTask */
 }
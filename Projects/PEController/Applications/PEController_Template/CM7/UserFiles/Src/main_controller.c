@@ -56,7 +56,7 @@ static void ADC_Callback(adc_measures_t* result)
 {
 	if (modeChangeRequest.isPending)
 	{
-		INTER_CORE_DATA.bools[P2P_CONTROL_STATE] = modeChangeRequest.state;
+		P2PComms_WriteBool(P2P_CONTROL_STATE, modeChangeRequest.state);
 		modeChangeRequest.err = ERR_OK;
 		modeChangeRequest.isPending = false;
 	}
@@ -41,6 +41,7 @@
  * Static Variables
  *******************************************************************************/
 static data_param_info_t* settingsParam[] = { &p2pCommsParams[P2P_PARAM_f_GRID], &p2pCommsParams[P2P_PARAM_V_GRID], &p2pCommsParams[P2P_PARAM_L_OUT_mH], };
+static data_param_info_t* protectionParam[] = { &p2pCommsParams[P2P_PARAM_PROT_VDC_MAX], &p2pCommsParams[P2P_PARAM_PROT_I_MAX], };
 /********************************************************************************
  * Global Variables
  *******************************************************************************/
@@ -78,6 +79,11 @@ data_param_group_t settingWindows[SETTINGS_WINDOW_COUNT] =
 				.title = "Grid Tie Configuration",
 				.paramPointers = settingsParam,
 				.paramCount = 3
+		},
+		{
+				.title = "Protection Limits",
+				.paramPointers = protectionParam,
+				.paramCount = 2
 		}
 };
 /********************************************************************************
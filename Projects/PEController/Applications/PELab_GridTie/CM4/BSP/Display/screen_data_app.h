@@ -53,7 +53,7 @@ extern "C" {
 /**
  * @brief Number of setting groups to be displayed. Size of @ref settingWindows
  */
- #define SETTINGS_WINDOW_COUNT			(1)
+ #define SETTINGS_WINDOW_COUNT			(2)
 /**
   * @}
   */
@@ -167,6 +167,23 @@ standard names. */
 
 /* USER CODE BEGIN Defines */
 /* Section where parameter definitions can be added (for instance, to override default ones in FreeRTOS.h) */
+/* Run time statistics, scheduling latency and stack usage of the tasks for the task telemetry.
+The run time is counted by the DWT cycle counter, and the trace hooks find the statistics of a task
+through its application task tag. */
+#if defined(__ICCARM__) || defined(__CC_ARM) || defined(__GNUC__)
+extern void TaskTelemetry_InitCounter(void);
+extern uint32_t TaskTelemetry_GetCounter(void);
+extern void TaskTelemetry_TaskReady(uint32_t tag);
+extern void TaskTelemetry_TaskSwitchedIn(uint32_t tag);
+#endif
+#define configGENERATE_RUN_TIME_STATS            1
+#define configUSE_APPLICATION_TASK_TAG           1
+#define INCLUDE_xTaskGetIdleTaskHandle           1
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() TaskTelemetry_InitCounter()
+#define portGET_RUN_TIME_COUNTER_VALUE()         TaskTelemetry_GetCounter()
+/* The running task is only moved to the ready list by the changes of its priority, which are not wake ups. */
+#define traceMOVED_TASK_TO_READY_STATE(pxTCB)    TaskTelemetry_TaskReady((pxTCB) == pxCurrentTCB ? 0 : (uint32_t)(uintptr_t)(pxTCB)->pxTaskTag)
+#define traceTASK_SWITCHED_IN()                  TaskTelemetry_TaskSwitchedIn((uint32_t)(uintptr_t)pxCurrentTCB->pxTaskTag)
 /* USER CODE END Defines */
 
 #endif /* FREERTOS_CONFIG_H */
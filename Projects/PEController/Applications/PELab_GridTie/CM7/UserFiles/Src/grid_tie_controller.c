@@ -28,6 +28,7 @@
 #include "pecontroller_digital_in.h"
 #include "shared_memory.h"
 #include "control_library.h"
+#include "pecontroller_adc.h"
 /********************************************************************************
  * Defines
  *******************************************************************************/
@@ -184,10 +185,16 @@ device_err_t GridTie_EnableBoost(grid_tie_t* gridTie, bool en)
 	//return ERR_INVERTER_ACTIVE;
 	// refresh the PI Controller
 	boostPI.Integral = 0;
+#if EN_ADC_PROTECTION
+	// re-arm the protection before the outputs are enabled again
+	if (en)
+		BSP_ADC_ResetProtection();
+#endif
 	for (int i = 0; i < BOOST_COUNT; i++)
 		BSP_PWMOut_Enable((1 << (gridTie->boostConfig[i].pinNo - 1)) , en);
 	// correct flags
-	INTER_CORE_DATA.bools[P2P_BOOST_STATE] = gridTie->isBoostEnabled = en;
+	gridTie->isBoostEnabled = en;
+	P2PComms_WriteBool(P2P_BOOST_STATE, en);
 	return ERR_OK;
 }
 
@@ -205,7 +212,8 @@ device_err_t GridTie_EnableInverter(grid_tie_t* gridTie, bool en)
 		// Disable inverters
 		Inverter3Ph_Activate(&gridTie->inverterConfig, en);
 		// set flags
-		INTER_CORE_DATA.bools[P2P_INVERTER_STATE] = gridTie->isInverterEnabled = en;
+		gridTie->isInverterEnabled = en;
+		P2PComms_WriteBool(P2P_INVERTER_STATE, en);
 		return ERR_OK;
 	}
 	else
@@ -216,10 +224,15 @@ device_err_t GridTie_EnableInverter(grid_tie_t* gridTie, bool en)
 			return ERR_RELAY_OFF;
 		if (gridTie->pll.status != PLL_LOCKED)
 			return ERR_PLL_NOT_LOCKED;
+#if EN_ADC_PROTECTION
+		// re-arm the protection before the outputs are enabled again
+		BSP_ADC_ResetProtection();
+#endif
 		// Enable inverters
 		Inverter3Ph_Activate(&gridTie->inverterConfig, en);
 		// set flags
-		INTER_CORE_DATA.bools[P2P_INVERTER_STATE] = gridTie->isInverterEnabled = en;
+		gridTie->isInverterEnabled = en;
+		P2PComms_WriteBool(P2P_INVERTER_STATE, en);
 		return ERR_OK;
 	}
 }
@@ -251,7 +264,7 @@ static void GridTie_GenerateOutput(grid_tie_t* gridTie)
 	// Transform the current measurements to DQ coordinates
 	Transform_abc_dq0(&iCoor->abc, &iCoor->dq0, &iCoor->trigno, SRC_ABC, PARK_SINE);
 	if(Average_Compute(&iGenAvg, iCoor->dq0.d))
-		INTER_CORE_DATA.floats[P2P_CURR_RMS_CURRENT] = iGenAvg.avg / 1.414f;
+		P2PComms_WriteFloat(P2P_CURR_RMS_CURRENT, iGenAvg.avg / 1.414f);
 	// Apply PI control to both DQ coordinates gridTie->dCompensator.dt
 	LIB_COOR_ALL_t coor;
 
@@ -288,7 +301,8 @@ static void ControlRelays(grid_tie_t* gridTie)
 		// Turn off relay if goes beyond acceptable voltage
 		if (gridTie->vdc < RELAY_TURN_ON_VDC)
 		{
-			gridTie->isRelayOn = INTER_CORE_DATA.bools[P2P_RELAY_STATUS] = false;
+			gridTie->isRelayOn = false;
+			P2PComms_WriteBool(P2P_RELAY_STATUS, false);
 			gridTie->tempIndex = 0;
 			for (int i = 0; i < GRID_RELAY_COUNT; i++)
 				BSP_Dout_SetAsIOPin(GRID_RELAY_IO + i, GPIO_PIN_RESET);
@@ -302,7 +316,8 @@ static void ControlRelays(grid_tie_t* gridTie)
 		// wait for stabilization of boost
 		else if (++gridTie->tempIndex == (int)PWM_FREQ_Hz)
 		{
-			gridTie->isRelayOn = INTER_CORE_DATA.bools[P2P_RELAY_STATUS] = true;
+			gridTie->isRelayOn = true;
+			P2PComms_WriteBool(P2P_RELAY_STATUS, true);
 			for (int i = 0; i < GRID_RELAY_COUNT; i++)
 				BSP_Dout_SetAsIOPin(GRID_RELAY_IO + i, GPIO_PIN_SET);
 			gridTie->tempIndex = 0;
@@ -323,9 +338,8 @@ void GridTieControl_Loop(grid_tie_t* gridTie)
 	// Only compute and apply if the boost is already enabled
 	if (gridTie->isBoostEnabled)
 	{
+		// the DC link over-voltage is handled by the protection of the ADC
 		float boostDuty = GridTie_BoostControl(gridTie);
-		if (gridTie->vdc > 800.f)				// --FIXME-- Limit should be on Vdc
-			boostDuty = 0;
 
 		for (int i = 0; i < BOOST_COUNT; i++)
 			gridTie->boostConfig[i].dutyUpdateFnc(gridTie->boostConfig[i].pinNo, boostDuty, &gridTie->boostConfig[i].pwmConfig);
@@ -336,7 +350,7 @@ void GridTieControl_Loop(grid_tie_t* gridTie)
 
 	// Implement phase lock loop
 	Pll_LockGrid(pll);
-	INTER_CORE_DATA.bools[P2P_PLL_STATUS] = gridTie->pll.status == PLL_LOCKED;
+	P2PComms_WriteBool(P2P_PLL_STATUS, gridTie->pll.status == PLL_LOCKED);
 
 	// Generate inverter PWM is enabled and not faulty
 	if (gridTie->isInverterEnabled)
@@ -345,7 +359,8 @@ void GridTieControl_Loop(grid_tie_t* gridTie)
 		if(gridTie->isRelayOn == false || gridTie->pll.status != PLL_LOCKED)
 		{
 			Inverter3Ph_Activate(&gridTie->inverterConfig, false);
-			gridTie->isInverterEnabled = INTER_CORE_DATA.bools[P2P_INVERTER_STATE] = false;
+			gridTie->isInverterEnabled = false;
+			P2PComms_WriteBool(P2P_INVERTER_STATE, false);
 			Average_Reset(&iGenAvg);
 		}
 		else
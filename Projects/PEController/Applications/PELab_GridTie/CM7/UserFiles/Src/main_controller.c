@@ -21,9 +21,18 @@
 #include "pecontroller_timers.h"
 #include "p2p_comms.h"
 #include "grid_tie_controller.h"
+#include <math.h>
 /*******************************************************************************
  * Defines
  ******************************************************************************/
+/**
+ * @brief ADC channel index measuring the DC link voltage (Ch9)
+ */
+#define VDC_CHANNEL_INDEX				(8)
+/**
+ * @brief ADC channel index measuring the current of the first phase (Ch1), followed by the other phases
+ */
+#define CURRENT_CHANNEL_INDEX			(0)
 
 /*******************************************************************************
  * Enums
@@ -53,12 +62,59 @@ static void MainControl_Loop(adc_measures_t* result);
  */
 grid_tie_t gridTieConfig = {0};
 static adc_mode_t adcMode = ADC_MODE_MONITORING;
+#if IS_ADC_CORE
+/**
+ * @brief DC link voltage limit applied to the protection
+ */
+static float protVdcMax = 0;
+/**
+ * @brief Phase current limit applied to the protection
+ */
+static float protCurrentMax = 0;
+#endif
 /*******************************************************************************
  * Code
  ******************************************************************************/
 #if IS_ADC_CORE
+#pragma GCC push_options
+#pragma GCC optimize ("no-fast-math")
+/**
+ * @brief Apply the protection limits if updated from the other core.
+ * @note Invalid limits are ignored and the previous limits are kept. Kept out of the fast math of the project, which
+ * assumes finite values and would let NaN through.
+ */
+static void UpdateProtectionLimits(void)
+{
+	float vdcMax = INTER_CORE_DATA.floats[P2P_PROT_VDC_MAX];
+	if (vdcMax != protVdcMax && isfinite(vdcMax) && vdcMax >= MIN_PROT_VDC_MAX && vdcMax <= MAX_PROT_VDC_MAX)
+	{
+		(void)BSP_ADC_SetProtectionLimits(VDC_CHANNEL_INDEX, ADC_PROTECTION_NO_LOWER_LIMIT, vdcMax);
+		protVdcMax = vdcMax;
+	}
+	float currentMax = INTER_CORE_DATA.floats[P2P_PROT_CURRENT_MAX];
+	if (currentMax != protCurrentMax && isfinite(currentMax) && currentMax >= MIN_PROT_CURRENT_MAX && currentMax <= MAX_PROT_CURRENT_MAX)
+	{
+		for (int i = 0; i < 3; i++)
+			(void)BSP_ADC_SetProtectionLimits(CURRENT_CHANNEL_INDEX + i, -currentMax, currentMax);
+		protCurrentMax = currentMax;
+	}
+}
+#pragma GCC pop_options
+
+/**
+ * @brief Turn off the boost and inverter when the protection trips.
+ * @note The PWM outputs are already disabled by the ADC drivers. This only updates the states.
+ * @param channelMask Mask of the newly tripped channels. Bit 0 represents the first channel.
+ */
+void BSP_ADC_ProtectionTrippedCallback(uint32_t channelMask)
+{
+	(void)GridTie_EnableBoost(&gridTieConfig, false);
+	(void)GridTie_EnableInverter(&gridTieConfig, false);
+}
+
 static void ADC_Callback(adc_measures_t* result)
 {
+	UpdateProtectionLimits();
 	if (boostStateUpdateRequest.isPending)
 	{
 		boostStateUpdateRequest.err = GridTie_EnableBoost(&gridTieConfig, boostStateUpdateRequest.state);
@@ -74,11 +130,9 @@ static void ADC_Callback(adc_measures_t* result)
 	{
 		if (adcMode == ADC_MODE_MONITORING)
 		{
-			(void) BSP_ADC_Stop();
-			// If timer 1 is used can be triggered based on timer 1
+			// If timer 1 is used can be triggered based on timer 1, conversions keep running during the switch
 			tim_in_trigger_config_t _slaveConfig = { .type = TIM_TRGI_TYPE_RST, .src = TIM_TRG_SRC_TIM1 };
-			(void)BSP_ADC_SetInputOutputTrigger(&_slaveConfig, NULL, CONTROL_FREQUENCY_Hz);
-			(void) BSP_ADC_Run();
+			(void)BSP_ADC_UpdateInputOutputTrigger(&_slaveConfig, NULL, CONTROL_FREQUENCY_Hz);
 			adcMode = ADC_MODE_CONTROL;
 		}
 	}
@@ -86,9 +140,7 @@ static void ADC_Callback(adc_measures_t* result)
 	{
 		if (adcMode == ADC_MODE_CONTROL)
 		{
-			(void) BSP_ADC_Stop();
-			(void)BSP_ADC_SetInputOutputTrigger(NULL, NULL, MONITORING_FREQUENCY_Hz);
-			(void) BSP_ADC_Run();
+			(void)BSP_ADC_UpdateInputOutputTrigger(NULL, NULL, CONTROL_FREQUENCY_Hz);
 			adcMode = ADC_MODE_MONITORING;
 		}
 	}
@@ -124,8 +176,17 @@ void MainControl_Init(void)
 #if IS_ADC_CORE
 	adc_cont_config_t adcConfig = {
 			.callback = ADC_Callback,
-			.fs = MONITORING_FREQUENCY_Hz };
+			.fs = CONTROL_FREQUENCY_Hz,
+			.monitoringFs = MONITORING_FREQUENCY_Hz };
 	BSP_ADC_Init(ADC_MODE_CONT, &adcConfig, &RAW_ADC_DATA, &PROCESSED_ADC_DATA);
+	// the states are loaded from the storage before the initialization, the defaults are only kept if they are invalid
+	protVdcMax = DEFAULT_PROT_VDC_MAX;
+	protCurrentMax = DEFAULT_PROT_CURRENT_MAX;
+	(void)BSP_ADC_SetProtectionLimits(VDC_CHANNEL_INDEX, ADC_PROTECTION_NO_LOWER_LIMIT, protVdcMax);
+	for (int i = 0; i < 3; i++)
+		(void)BSP_ADC_SetProtectionLimits(CURRENT_CHANNEL_INDEX + i, -protCurrentMax, protCurrentMax);
+	UpdateProtectionLimits();
+	BSP_ADC_EnableProtection(0xffff, true);
 	(void) BSP_ADC_Run();
 #endif
 }
@@ -169,6 +169,14 @@ extern "C" {
  * @brief The output current of the inverter 1st time the application is run. Current value can be updated from screen
  */
 #define DEFAULT_CURRENT_INJ				(3.f)
+/**
+ * @brief The DC link voltage tripping the protection 1st time the application is run. Current value can be updated from screen
+ */
+#define DEFAULT_PROT_VDC_MAX			(800.f)
+/**
+ * @brief The peak phase current tripping the protection 1st time the application is run. Current value can be updated from screen
+ */
+#define DEFAULT_PROT_CURRENT_MAX		(40.f)
 /**
  * @brief The maximum allowed value of the grid frequency
  */
@@ -201,6 +209,22 @@ extern "C" {
  * @brief The minimum allowed value of output current to be injected
  */
 #define MIN_CURRENT_INJ					(.1f)
+/**
+ * @brief The maximum allowed value of the DC link voltage tripping the protection
+ */
+#define MAX_PROT_VDC_MAX				(900.f)
+/**
+ * @brief The minimum allowed value of the DC link voltage tripping the protection
+ */
+#define MIN_PROT_VDC_MAX				(100.f)
+/**
+ * @brief The maximum allowed value of the peak phase current tripping the protection
+ */
+#define MAX_PROT_CURRENT_MAX			(60.f)
+/**
+ * @brief The minimum allowed value of the peak phase current tripping the protection
+ */
+#define MIN_PROT_CURRENT_MAX			(1.f)
 /**
  * @}
  */
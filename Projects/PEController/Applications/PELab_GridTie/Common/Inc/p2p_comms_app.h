@@ -137,6 +137,8 @@ typedef enum
 	P2P_GRID_VOLTAGE,
 	P2P_REQ_RMS_CURRENT,
 	P2P_LOUT_mH,
+	P2P_PROT_VDC_MAX,
+	P2P_PROT_CURRENT_MAX,
 	// Monitors
 	P2P_CURR_RMS_CURRENT,
 	P2P_FLOAT_COUNT,   /**< Not a type. Use this to get the total number of legal types */
@@ -161,6 +163,8 @@ typedef enum
 	P2P_PARAM_V_GRID,
 	P2P_PARAM_I_RMS_REQ,
 	P2P_PARAM_L_OUT_mH,
+	P2P_PARAM_PROT_VDC_MAX,
+	P2P_PARAM_PROT_I_MAX,
 	P2P_PARAM_I_RMS,
 	P2P_PARAM_BOOST_EN,
 	P2P_PARAM_INV_EN,
@@ -82,11 +82,11 @@ extern "C" {
  */
 #define ENABLE_INTELLISENS		(1)
 /**
- * @brief Use this frequency when no control loop is enabled to get high bandwidth measurements. Max value is 100K.
+ * @brief Rate of the measurements stored for monitoring. Decimated on the fly from @ref CONTROL_FREQUENCY_Hz so should not exceed it.
  */
 #define MONITORING_FREQUENCY_Hz		(40000)
 /**
- * @brief Use this frequency when control loop is enabled to get low bandwidth measurements. Max value is 100K and is dependent upon the control performance.
+ * @brief The ADC always runs at this frequency, synchronized to the PWM when the control loop is enabled. Max value is 100K and is dependent upon the control performance.
  */
 #define CONTROL_FREQUENCY_Hz		(40000)
 /******** MEASUREMENT CONFIGURATION ***********/
@@ -26,6 +26,7 @@
 #include "p2p_comms.h"
 #include "shared_memory.h"
 #include "utility_lib.h"
+#include <math.h>
 /********************************************************************************
  * Defines
  *******************************************************************************/
@@ -61,6 +62,8 @@ data_param_info_t p2pCommsParams[P2P_PARAM_COUNT] =
 		{ .name = "Grid Voltage (P-N)", .index = P2P_GRID_VOLTAGE, .type = DTYPE_FLOAT, .arg = 1, .unit = UNIT_V},
 		{ .name = "iReq (RMS)", .index = P2P_REQ_RMS_CURRENT, .type = DTYPE_FLOAT, .arg = 2, .unit = UNIT_A },
 		{ .name = "Filter Inductance (mH)", .index = P2P_LOUT_mH, .type = DTYPE_FLOAT,  .arg = 2, .unit = UNIT_NONE},
+		{ .name = "Max DC Link Voltage", .index = P2P_PROT_VDC_MAX, .type = DTYPE_FLOAT,  .arg = 1, .unit = UNIT_V},
+		{ .name = "Max Current (Peak)", .index = P2P_PROT_CURRENT_MAX, .type = DTYPE_FLOAT,  .arg = 1, .unit = UNIT_A},
 		{ .name = "iGen (RMS)", .index = P2P_CURR_RMS_CURRENT, .type = DTYPE_FLOAT,  .arg = 2, .unit = UNIT_A },
 		{ .name = "Enable Boost", .index = P2P_BOOST_STATE, .type = DTYPE_BOOL },
 		{ .name = "Enable Inverter", .index = P2P_INVERTER_STATE, .type = DTYPE_BOOL},
@@ -75,6 +78,22 @@ data_param_info_t p2pCommsParams[P2P_PARAM_COUNT] =
 /********************************************************************************
  * Code
  *******************************************************************************/
+#pragma GCC push_options
+#pragma GCC optimize ("no-fast-math")
+/**
+ * @brief Check if a protection limit is within its range.
+ * @note Kept out of the fast math of the project, which assumes finite values and would let NaN through.
+ * @param value Value to be checked.
+ * @param min Minimum allowed value.
+ * @param max Maximum allowed value.
+ * @return <c>true</c> if the value is finite and within the range else <c>false</c>.
+ */
+static bool IsProtectionLimitValid(float value, float min, float max)
+{
+	return isfinite(value) && value >= min && value <= max;
+}
+#pragma GCC pop_options
+
 #if IS_STORAGE_CORE
 /**
  * @brief Check if the flash needs to be updated.
@@ -87,7 +106,9 @@ bool P2PComms_IsStateStorageUpdateNeeded(p2p_data_buffs_t* dest, p2p_data_buffs_
 	return dest->floats[P2P_GRID_FREQ] != src->floats[P2P_GRID_FREQ] ||
 			dest->floats[P2P_GRID_VOLTAGE] != src->floats[P2P_GRID_VOLTAGE] ||
 			dest->floats[P2P_REQ_RMS_CURRENT] != src->floats[P2P_REQ_RMS_CURRENT] ||
-			dest->floats[P2P_LOUT_mH] != src->floats[P2P_LOUT_mH];
+			dest->floats[P2P_LOUT_mH] != src->floats[P2P_LOUT_mH] ||
+			dest->floats[P2P_PROT_VDC_MAX] != src->floats[P2P_PROT_VDC_MAX] ||
+			dest->floats[P2P_PROT_CURRENT_MAX] != src->floats[P2P_PROT_CURRENT_MAX];
 }
 #pragma GCC push_options
 #pragma GCC optimize ("-O0")
@@ -102,6 +123,8 @@ void P2PComms_UpdateStorableStates(p2p_data_buffs_t* dest, p2p_data_buffs_t* src
 	dest->floats[P2P_GRID_VOLTAGE] = src->floats[P2P_GRID_VOLTAGE] < MAX_GRID_VOLTAGE && src->floats[P2P_GRID_VOLTAGE] > MIN_GRID_VOLTAGE ? src->floats[P2P_GRID_VOLTAGE] : DEFAULT_GRID_VOLTAGE;
 	dest->floats[P2P_REQ_RMS_CURRENT] = src->floats[P2P_REQ_RMS_CURRENT] < MAX_CURRENT_INJ && src->floats[P2P_REQ_RMS_CURRENT] > MIN_CURRENT_INJ ? src->floats[P2P_REQ_RMS_CURRENT] : DEFAULT_CURRENT_INJ;
 	dest->floats[P2P_LOUT_mH] = src->floats[P2P_LOUT_mH] < MAX_LOUT_mH && src->floats[P2P_LOUT_mH] > MIN_LOUT_mH ? src->floats[P2P_LOUT_mH] : DEFAULT_LOUT_mH;
+	dest->floats[P2P_PROT_VDC_MAX] = IsProtectionLimitValid(src->floats[P2P_PROT_VDC_MAX], MIN_PROT_VDC_MAX, MAX_PROT_VDC_MAX) ? src->floats[P2P_PROT_VDC_MAX] : DEFAULT_PROT_VDC_MAX;
+	dest->floats[P2P_PROT_CURRENT_MAX] = IsProtectionLimitValid(src->floats[P2P_PROT_CURRENT_MAX], MIN_PROT_CURRENT_MAX, MAX_PROT_CURRENT_MAX) ? src->floats[P2P_PROT_CURRENT_MAX] : DEFAULT_PROT_CURRENT_MAX;
 }
 #pragma GCC pop_options
 
@@ -133,6 +156,8 @@ void P2PComms_InitStatesFromStorage(uint32_t* data, bool isDataValid)
 		dest->floats[P2P_GRID_VOLTAGE] = DEFAULT_GRID_VOLTAGE;
 		dest->floats[P2P_REQ_RMS_CURRENT] = DEFAULT_CURRENT_INJ;
 		dest->floats[P2P_LOUT_mH] = DEFAULT_LOUT_mH;
+		dest->floats[P2P_PROT_VDC_MAX] = DEFAULT_PROT_VDC_MAX;
+		dest->floats[P2P_PROT_CURRENT_MAX] = DEFAULT_PROT_CURRENT_MAX;
 	}
 }
 
@@ -194,6 +219,16 @@ device_err_t P2PComms_UpdateFloat(uint8_t index, float value)
 		if(value < MIN_CURRENT_INJ || value > MAX_CURRENT_INJ)
 			return ERR_OUT_OF_RANGE;
 	}
+	else if (index == P2P_PROT_VDC_MAX)
+	{
+		if(!IsProtectionLimitValid(value, MIN_PROT_VDC_MAX, MAX_PROT_VDC_MAX))
+			return ERR_OUT_OF_RANGE;
+	}
+	else if (index == P2P_PROT_CURRENT_MAX)
+	{
+		if(!IsProtectionLimitValid(value, MIN_PROT_CURRENT_MAX, MAX_PROT_CURRENT_MAX))
+			return ERR_OUT_OF_RANGE;
+	}
 	else if (index >= P2P_CURR_RMS_CURRENT)
 		return ERR_ILLEGAL;
 	INTER_CORE_DATA.floats[index] = value;
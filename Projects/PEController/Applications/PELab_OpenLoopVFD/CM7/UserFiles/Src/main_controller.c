@@ -63,7 +63,7 @@ static void ProcessInverterActivation(state_update_request* request, int regID,
 	{
 		if (config == NULL)
 		{
-			INTER_CORE_DATA.bools[regID] = request->state;
+			P2PComms_WriteBool(regID, request->state);
 			request->err = ERR_OK;
 		}
 		else if (config->requestedState != config->inverterConfig.pmConfig.state)
@@ -71,7 +71,7 @@ static void ProcessInverterActivation(state_update_request* request, int regID,
 		else
 		{
 			config->requestedState = request->state ? POWER_MODULE_ACTIVE : POWER_MODULE_INACTIVE;
-			INTER_CORE_DATA.bools[regID] = request->state;
+			P2PComms_WriteBool(regID, request->state);
 			request->err = ERR_OK;
 		}
 		request->isPending = false;
@@ -98,11 +98,9 @@ static void ADC_Callback(adc_measures_t* result)
 	{
 		if (adcMode == ADC_MODE_MONITORING)
 		{
-			(void) BSP_ADC_Stop();
-			// If timer 1 is used can be triggered based on timer 1
+			// If timer 1 is used can be triggered based on timer 1, conversions keep running during the switch
 			tim_in_trigger_config_t _slaveConfig = { .type = TIM_TRGI_TYPE_RST, .src = TIM_TRG_SRC_TIM1 };
-			(void)BSP_ADC_SetInputOutputTrigger(&_slaveConfig, NULL, CONTROL_FREQUENCY_Hz);
-			(void) BSP_ADC_Run();
+			(void)BSP_ADC_UpdateInputOutputTrigger(&_slaveConfig, NULL, CONTROL_FREQUENCY_Hz);
 			adcMode = ADC_MODE_CONTROL;
 		}
 	}
@@ -110,9 +108,7 @@ static void ADC_Callback(adc_measures_t* result)
 	{
 		if (adcMode == ADC_MODE_CONTROL)
 		{
-			(void) BSP_ADC_Stop();
-			(void)BSP_ADC_SetInputOutputTrigger(NULL, NULL, MONITORING_FREQUENCY_Hz);
-			(void) BSP_ADC_Run();
+			(void)BSP_ADC_UpdateInputOutputTrigger(NULL, NULL, CONTROL_FREQUENCY_Hz);
 			adcMode = ADC_MODE_MONITORING;
 		}
 	}
@@ -142,7 +138,8 @@ void MainControl_Init(void)
 	openLoopVfConfig1.nominalModulationIndex = INTER_CORE_DATA.floats[P2P_INV1_NOM_m];
 	openLoopVfConfig1.outputFreq = INTER_CORE_DATA.floats[P2P_INV1_REQ_FREQ];
 	openLoopVfConfig1.acceleration = INTER_CORE_DATA.floats[P2P_INV1_ACCELERATION];
-	openLoopVfConfig1.currentDir = openLoopVfConfig1.dir = INTER_CORE_DATA.bools[P2P_INV1_DIRECTION] = INTER_CORE_DATA.bools[P2P_INV1_REQ_DIRECTION];
+	openLoopVfConfig1.currentDir = openLoopVfConfig1.dir = INTER_CORE_DATA.bools[P2P_INV1_REQ_DIRECTION];
+	P2PComms_WriteBool(P2P_INV1_DIRECTION, openLoopVfConfig1.dir);
 	OpenLoopVfControl_Init(&openLoopVfConfig1, NULL);
 
 #if VFD_COUNT == 2
@@ -156,7 +153,8 @@ void MainControl_Init(void)
 	openLoopVfConfig2.nominalModulationIndex = INTER_CORE_DATA.floats[P2P_INV2_NOM_m];
 	openLoopVfConfig2.outputFreq = INTER_CORE_DATA.floats[P2P_INV2_REQ_FREQ];
 	openLoopVfConfig2.acceleration = INTER_CORE_DATA.floats[P2P_INV2_ACCELERATION];
-	openLoopVfConfig2.currentDir = openLoopVfConfig2.dir = INTER_CORE_DATA.bools[P2P_INV2_DIRECTION] = INTER_CORE_DATA.bools[P2P_INV2_REQ_DIRECTION];
+	openLoopVfConfig2.currentDir = openLoopVfConfig2.dir = INTER_CORE_DATA.bools[P2P_INV2_REQ_DIRECTION];
+	P2PComms_WriteBool(P2P_INV2_DIRECTION, openLoopVfConfig2.dir);
 	OpenLoopVfControl_Init(&openLoopVfConfig2, NULL);
 #endif
 
@@ -174,7 +172,8 @@ void MainControl_Init(void)
 #if IS_ADC_CORE
 	adc_cont_config_t adcConfig = {
 			.callback = ADC_Callback,
-			.fs = MONITORING_FREQUENCY_Hz };
+			.fs = CONTROL_FREQUENCY_Hz,
+			.monitoringFs = MONITORING_FREQUENCY_Hz };
 	BSP_ADC_Init(ADC_MODE_CONT, &adcConfig, &RAW_ADC_DATA, &PROCESSED_ADC_DATA);
 	(void) BSP_ADC_Run();
 #endif
@@ -196,6 +195,28 @@ void MainControl_Stop(void)
 	BSP_PWM_Stop(0xffff, false);
 }
 
+/**
+ * @brief Publish the running state of an inverter to the other core.
+ * @note All values are updated in a single section so that they are always read together, and only if
+ * any of them changed.
+ * @param config Inverter configuration.
+ * @param freqID Register of the current frequency.
+ * @param mID Register of the current modulation index.
+ * @param dirID Register of the current direction.
+ */
+static void PublishInverterState(openloopvf_config_t* config, int freqID, int mID, int dirID)
+{
+	if (INTER_CORE_DATA.floats[freqID] == config->currentFreq &&
+			INTER_CORE_DATA.floats[mID] == config->currentModulationIndex &&
+			INTER_CORE_DATA.bools[dirID] == config->currentDir)
+		return;
+	P2PComms_BeginUpdate();
+	INTER_CORE_DATA.floats[freqID] = config->currentFreq;
+	INTER_CORE_DATA.floats[mID] = config->currentModulationIndex;
+	INTER_CORE_DATA.bools[dirID] = config->currentDir;
+	P2PComms_EndUpdate(P2P_DATA_GROUP(DTYPE_FLOAT) | P2P_DATA_GROUP(DTYPE_BOOL));
+}
+
 /**
  * @brief Call this function to process the control loop.
  * @param result ADC conversion data
@@ -208,9 +229,7 @@ static void MainControl_Loop(adc_measures_t* result)
 	openLoopVfConfig1.acceleration = INTER_CORE_DATA.floats[P2P_INV1_ACCELERATION];
 	openLoopVfConfig1.dir = INTER_CORE_DATA.bools[P2P_INV1_REQ_DIRECTION];
 	OpenLoopVfControl_Loop(&openLoopVfConfig1);
-	INTER_CORE_DATA.floats[P2P_INV1_FREQ] = openLoopVfConfig1.currentFreq;
-	INTER_CORE_DATA.floats[P2P_INV1_m] = openLoopVfConfig1.currentModulationIndex;
-	INTER_CORE_DATA.bools[P2P_INV1_DIRECTION] = openLoopVfConfig1.currentDir;
+	PublishInverterState(&openLoopVfConfig1, P2P_INV1_FREQ, P2P_INV1_m, P2P_INV1_DIRECTION);
 #if VFD_COUNT == 2
 	openLoopVfConfig2.nominalFreq = INTER_CORE_DATA.floats[P2P_INV2_NOM_FREQ];
 	openLoopVfConfig2.outputFreq = INTER_CORE_DATA.floats[P2P_INV2_REQ_FREQ];
@@ -218,9 +237,7 @@ static void MainControl_Loop(adc_measures_t* result)
 	openLoopVfConfig2.acceleration = INTER_CORE_DATA.floats[P2P_INV2_ACCELERATION];
 	openLoopVfConfig2.dir = INTER_CORE_DATA.bools[P2P_INV2_REQ_DIRECTION];
 	OpenLoopVfControl_Loop(&openLoopVfConfig2);
-	INTER_CORE_DATA.floats[P2P_INV2_FREQ] = openLoopVfConfig2.currentFreq;
-	INTER_CORE_DATA.floats[P2P_INV2_m] = openLoopVfConfig2.currentModulationIndex;
-	INTER_CORE_DATA.bools[P2P_INV2_DIRECTION] = openLoopVfConfig2.currentDir;
+	PublishInverterState(&openLoopVfConfig2, P2P_INV2_FREQ, P2P_INV2_m, P2P_INV2_DIRECTION);
 #endif
 }
 
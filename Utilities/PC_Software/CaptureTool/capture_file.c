@@ -0,0 +1,613 @@
+/**
+ ********************************************************************************
+ * @file    	capture_file.c
+ * @author 		Waqas Ehsan Butt
+ * @date    	Oct 18, 2026
+ *
+ * @brief   PC side reader/writer for the ADC capture files
+ ********************************************************************************
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#define _FILE_OFFSET_BITS 64
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "capture_file.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/**
+ * @brief Number of records converted at once for the statistics computation
+ */
+#define STATS_CHUNK_RECORDS				(1024)
+/**
+ * @brief Alignment of each overview level in the file
+ */
+#define OVERVIEW_ALIGNMENT				(64)
+/**
+ * @brief Largest encoded block handled by the compression helpers
+ */
+#define MAX_CODEC_BLOCK_SIZE			ADC_CODEC_MAX_BLOCK_SIZE(ADC_CODEC_MAX_CHANNELS, ADC_CODEC_MAX_BLOCK_ROWS)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Check if the overview pyramid in the header lies within the mapped file.
+ */
+static bool IsOverviewValid(const capture_file_t* file)
+{
+	const capture_file_header_t* header = file->header;
+	if ((header->flags & CAPTURE_FLAG_OVERVIEW) == 0)
+		return false;
+	for (int level = 0; level < CAPTURE_OVERVIEW_LEVELS; level++)
+	{
+		uint64_t count = CaptureFormat_GetOverviewCount(file->sampleCount, level);
+		if (header->overviewCount[level] != count || header->overviewOffset[level] % sizeof(uint16_t)
+				|| header->overviewOffset[level] + count * sizeof(capture_overview_entry_t) > file->mapSize)
+			return false;
+	}
+	return true;
+}
+
+/**
+ * @brief Open a capture file for reading.
+ * @param file Pointer to the file state to be filled.
+ * @param path Path of the capture file.
+ * @return 0 if successful else -1 with errno set.
+ */
+int CaptureFile_Open(capture_file_t* file, const char* path)
+{
+	struct stat st;
+	memset(file, 0, sizeof(capture_file_t));
+	file->fd = open(path, O_RDONLY);
+	if (file->fd < 0)
+		return -1;
+	if (fstat(file->fd, &st) != 0)
+		goto fail;
+	if ((uint64_t)st.st_size < CAPTURE_HEADER_SIZE)
+	{
+		errno = EINVAL;
+		goto fail;
+	}
+	file->mapSize = (size_t)st.st_size;
+	file->map = mmap(NULL, file->mapSize, PROT_READ, MAP_SHARED, file->fd, 0);
+	if (file->map == MAP_FAILED)
+	{
+		file->map = NULL;
+		goto fail;
+	}
+	file->header = (const capture_file_header_t*)file->map;
+	if (!CaptureFormat_IsHeaderValid(file->header) || file->header->dataOffset > file->mapSize)
+	{
+		errno = EINVAL;
+		goto fail;
+	}
+	// Compressed captures need to be decompressed first
+	if (file->header->flags & CAPTURE_FLAG_COMPRESSED)
+	{
+		errno = ENOTSUP;
+		goto fail;
+	}
+
+	// Unfinished captures don't contain the record count, so compute it from the file size
+	uint64_t maxCount = (file->mapSize - file->header->dataOffset) / CaptureFormat_GetRecordSize(file->header);
+	file->sampleCount = file->header->sampleCount;
+	if (file->sampleCount == 0 || file->sampleCount > maxCount)
+		file->sampleCount = maxCount;
+	file->records = (const uint16_t*)(file->map + file->header->dataOffset);
+
+	if (IsOverviewValid(file))
+	{
+		for (int level = 0; level < CAPTURE_OVERVIEW_LEVELS; level++)
+			file->overview[level] = (const capture_overview_entry_t*)(file->map + file->header->overviewOffset[level]);
+	}
+	return 0;
+
+fail:
+	CaptureFile_Close(file);
+	return -1;
+}
+
+/**
+ * @brief Close a capture file opened by @ref CaptureFile_Open().
+ * @param file Pointer to the file state.
+ */
+void CaptureFile_Close(capture_file_t* file)
+{
+	int err = errno;
+	if (file->map)
+		munmap((void*)file->map, file->mapSize);
+	if (file->fd >= 0)
+		close(file->fd);
+	memset(file, 0, sizeof(capture_file_t));
+	file->fd = -1;
+	errno = err;
+}
+
+/**
+ * @brief Limit the range to the available records.
+ */
+static uint64_t ClipRange(const capture_file_t* file, uint64_t start, uint64_t count)
+{
+	if (start >= file->sampleCount)
+		return 0;
+	if (count > file->sampleCount - start)
+		count = file->sampleCount - start;
+	return count;
+}
+
+/**
+ * @brief Convert a range of records to engineering units.
+ * @param file Pointer to the file state.
+ * @param start Index of the first record.
+ * @param count Number of records required.
+ * @param out Output buffer with space for <b>count * chCount</b> values.
+ * @return Number of records converted.
+ */
+uint64_t CaptureFile_ReadRange(const capture_file_t* file, uint64_t start, uint64_t count, float* out)
+{
+	uint32_t chCount = file->header->chCount;
+	count = ClipRange(file, start, count);
+	const uint16_t* src = file->records + start * chCount;
+	for (uint64_t i = 0; i < count; i++)
+	{
+		for (uint32_t ch = 0; ch < chCount; ch++)
+			*out++ = CaptureFile_Convert(&file->header->channels[ch], *src++);
+	}
+	return count;
+}
+
+/**
+ * @brief Compute the statistics of each channel over a range of records.
+ * @param file Pointer to the file state.
+ * @param start Index of the first record.
+ * @param count Number of records in the range.
+ * @param stats Output array with one entry for each channel.
+ * @return 0 if successful else -1 with errno set.
+ */
+int CaptureFile_ComputeStats(const capture_file_t* file, uint64_t start, uint64_t count, stats_data_t* stats)
+{
+	static float data[STATS_CHUNK_RECORDS * CAPTURE_MAX_CHANNELS];
+	temp_stats_data_t tempStats[CAPTURE_MAX_CHANNELS];
+	stats_data_t localStats[CAPTURE_MAX_CHANNELS];
+	uint32_t chCount = file->header->chCount;
+
+	count = ClipRange(file, start, count);
+	if (count == 0 || count > INT_MAX)
+	{
+		errno = ERANGE;
+		return -1;
+	}
+
+	// The whole range forms a single statistics window
+	for (int i = 0; i < CAPTURE_MAX_CHANNELS; i++)
+		tempStats[i].sampleCount = (int)count;
+	Stats_Reset(tempStats, localStats, CAPTURE_MAX_CHANNELS);
+	madvise((void*)file->map, file->mapSize, MADV_SEQUENTIAL);
+
+	// The statistics library expects 16 interleaved channels, so unused channels are zero filled
+	memset(data, 0, sizeof(data));
+	while (count)
+	{
+		uint32_t n = count > STATS_CHUNK_RECORDS ? STATS_CHUNK_RECORDS : (uint32_t)count;
+		const uint16_t* src = file->records + start * chCount;
+		float* dst = data;
+		for (uint32_t i = 0; i < n; i++)
+		{
+			for (uint32_t ch = 0; ch < chCount; ch++)
+				dst[ch] = CaptureFile_Convert(&file->header->channels[ch], *src++);
+			dst += CAPTURE_MAX_CHANNELS;
+		}
+		Stats_Compute_MultiSample_16ch(data, tempStats, localStats, (int)n);
+		start += n;
+		count -= n;
+	}
+
+	memcpy(stats, localStats, chCount * sizeof(stats_data_t));
+	return 0;
+}
+
+/**
+ * @brief Insert the extremes of the records [start, end) using the given and finer overview levels.
+ */
+static void InsertExtremes(const capture_file_t* file, uint64_t start, uint64_t end, int level, capture_overview_entry_t* entry)
+{
+	uint32_t chCount = file->header->chCount;
+	if (start >= end)
+		return;
+	if (level < 0)
+	{
+		CaptureFormat_InsertRecords(entry, file->records + start * chCount, chCount, (uint32_t)(end - start));
+		return;
+	}
+
+	// Use the completely covered entries of this level and finer levels for the edges
+	uint64_t decimation = CAPTURE_OVERVIEW_DECIMATION(level);
+	uint64_t first = (start + decimation - 1) / decimation;
+	uint64_t last = end / decimation;
+	if (first >= last)
+	{
+		InsertExtremes(file, start, end, level - 1, entry);
+		return;
+	}
+	InsertExtremes(file, start, first * decimation, level - 1, entry);
+	CaptureFormat_MergeOverview(entry, file->overview[level] + first, chCount, (uint32_t)(last - first));
+	InsertExtremes(file, last * decimation, end, level - 1, entry);
+}
+
+/**
+ * @brief Get the raw extremes of each channel over a range of records.
+ * @param file Pointer to the file state.
+ * @param start Index of the first record.
+ * @param count Number of records in the range.
+ * @param entry Output entry.
+ */
+void CaptureFile_GetExtremes(const capture_file_t* file, uint64_t start, uint64_t count, capture_overview_entry_t* entry)
+{
+	count = ClipRange(file, start, count);
+	CaptureFormat_ResetOverview(entry);
+	InsertExtremes(file, start, start + count, file->overview[0] ? CAPTURE_OVERVIEW_LEVELS - 1 : -1, entry);
+}
+
+/**
+ * @brief Divide a range of records in equal buckets and get the raw extremes of each bucket.
+ * @param file Pointer to the file state.
+ * @param start Index of the first record.
+ * @param count Number of records in the range.
+ * @param points Number of buckets required.
+ * @param out Output array with space for <b>points</b> entries.
+ * @return Number of buckets filled. Less than points if the range contains fewer records.
+ */
+uint32_t CaptureFile_GetOverview(const capture_file_t* file, uint64_t start, uint64_t count, uint32_t points, capture_overview_entry_t* out)
+{
+	count = ClipRange(file, start, count);
+	if (points > count)
+		points = (uint32_t)count;
+	for (uint32_t i = 0; i < points; i++)
+	{
+		uint64_t s = start + (count * i) / points;
+		uint64_t e = start + (count * (i + 1)) / points;
+		CaptureFile_GetExtremes(file, s, e - s, out + i);
+	}
+	return points;
+}
+
+/**
+ * @brief Write the data to file and report errors.
+ */
+static int WriteAll(int fd, const void* data, size_t len)
+{
+	const uint8_t* ptr = (const uint8_t*)data;
+	while (len)
+	{
+		ssize_t n = write(fd, ptr, len);
+		if (n < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			return -1;
+		}
+		ptr += n;
+		len -= (size_t)n;
+	}
+	return 0;
+}
+
+/**
+ * @brief Rebuild the overview pyramid of a capture file.
+ * @details Unfinished captures are finalized by computing the record count from the file size.
+ * Any incomplete trailing record is discarded.
+ * @param path Path of the capture file.
+ * @return 0 if successful else -1 with errno set.
+ */
+int CaptureFile_BuildOverview(const char* path)
+{
+	capture_file_t file;
+	capture_file_header_t header;
+	capture_overview_entry_t* levels[CAPTURE_OVERVIEW_LEVELS] = {NULL};
+	int result = -1;
+
+	if (CaptureFile_Open(&file, path) != 0)
+		return -1;
+	header = *file.header;
+	uint32_t chCount = header.chCount;
+	uint64_t sampleCount = file.sampleCount;
+
+	// Level 0 is built from the records and each following level from the previous one
+	for (int level = 0; level < CAPTURE_OVERVIEW_LEVELS; level++)
+	{
+		uint64_t count = CaptureFormat_GetOverviewCount(sampleCount, level);
+		levels[level] = (capture_overview_entry_t*)malloc((count ? count : 1) * sizeof(capture_overview_entry_t));
+		if (levels[level] == NULL)
+			goto exit;
+		uint64_t srcCount = level == 0 ? sampleCount : header.overviewCount[level - 1];
+		for (uint64_t i = 0; i < count; i++)
+		{
+			uint64_t s = i << CAPTURE_OVERVIEW_SHIFT;
+			uint32_t n = (uint32_t)((srcCount - s) < (1u << CAPTURE_OVERVIEW_SHIFT) ? (srcCount - s) : (1u << CAPTURE_OVERVIEW_SHIFT));
+			CaptureFormat_ResetOverview(&levels[level][i]);
+			if (level == 0)
+				CaptureFormat_InsertRecords(&levels[level][i], file.records + s * chCount, chCount, n);
+			else
+				CaptureFormat_MergeOverview(&levels[level][i], levels[level - 1] + s, chCount, n);
+		}
+		header.overviewCount[level] = count;
+	}
+	CaptureFile_Close(&file);
+
+	// Drop any old overview or partial record and append the new pyramid
+	int fd = open(path, O_RDWR);
+	if (fd < 0)
+		goto exit;
+	uint64_t offset = header.dataOffset + sampleCount * CaptureFormat_GetRecordSize(&header);
+	static const uint8_t zeros[OVERVIEW_ALIGNMENT] = {0};
+	uint64_t pad = (OVERVIEW_ALIGNMENT - (offset % OVERVIEW_ALIGNMENT)) % OVERVIEW_ALIGNMENT;
+	if (ftruncate(fd, (off_t)offset) != 0 || lseek(fd, (off_t)offset, SEEK_SET) < 0 || WriteAll(fd, zeros, pad) != 0)
+		goto close;
+	offset += pad;
+	for (int level = 0; level < CAPTURE_OVERVIEW_LEVELS; level++)
+	{
+		size_t len = header.overviewCount[level] * sizeof(capture_overview_entry_t);
+		header.overviewOffset[level] = offset;
+		if (WriteAll(fd, levels[level], len) != 0)
+			goto close;
+		offset += len;
+	}
+	header.sampleCount = sampleCount;
+	header.flags |= CAPTURE_FLAG_OVERVIEW;
+	if (lseek(fd, 0, SEEK_SET) < 0 || WriteAll(fd, &header, sizeof(header)) != 0)
+		goto close;
+	result = 0;
+
+close:
+	if (close(fd) != 0)
+		result = -1;
+exit:
+	if (file.map)
+		CaptureFile_Close(&file);
+	for (int level = 0; level < CAPTURE_OVERVIEW_LEVELS; level++)
+		free(levels[level]);
+	return result;
+}
+
+/**
+ * @brief Create a new capture file.
+ * @param writer Pointer to the writer state to be filled.
+ * @param path Path of the capture file.
+ * @param header Header of the capture file. The offsets and counts are managed by the writer.
+ * @return 0 if successful else -1 with errno set.
+ */
+int CaptureWriter_Create(capture_writer_t* writer, const char* path, const capture_file_header_t* header)
+{
+	memset(writer, 0, sizeof(capture_writer_t));
+	if (!CaptureFormat_IsHeaderValid(header))
+	{
+		errno = EINVAL;
+		return -1;
+	}
+	writer->header = *header;
+	writer->header.dataOffset = CAPTURE_HEADER_SIZE;
+	writer->header.sampleCount = 0;
+	writer->header.flags &= ~CAPTURE_FLAG_OVERVIEW;
+	memset(writer->header.overviewOffset, 0, sizeof(writer->header.overviewOffset));
+	memset(writer->header.overviewCount, 0, sizeof(writer->header.overviewCount));
+	writer->path = strdup(path);
+	if (writer->path == NULL)
+		return -1;
+	writer->fp = fopen(path, "wb");
+	if (writer->fp == NULL
+			|| fwrite(&writer->header, sizeof(capture_file_header_t), 1, writer->fp) != 1)
+	{
+		if (writer->fp)
+			fclose(writer->fp);
+		free(writer->path);
+		writer->path = NULL;
+		return -1;
+	}
+	return 0;
+}
+
+/**
+ * @brief Append raw records to the capture file.
+ * @param writer Pointer to the writer state.
+ * @param records Pointer to the first record.
+ * @param count Number of records to be written.
+ * @return 0 if successful else -1 with errno set.
+ */
+int CaptureWriter_Append(capture_writer_t* writer, const uint16_t* records, uint32_t count)
+{
+	if (fwrite(records, CaptureFormat_GetRecordSize(&writer->header), count, writer->fp) != count)
+		return -1;
+	writer->header.sampleCount += count;
+	return 0;
+}
+
+/**
+ * @brief Finalize the capture file and build its overview pyramid.
+ * @param writer Pointer to the writer state.
+ * @return 0 if successful else -1 with errno set.
+ */
+int CaptureWriter_Close(capture_writer_t* writer)
+{
+	int result = 0;
+	if (fseek(writer->fp, 0, SEEK_SET) != 0
+			|| fwrite(&writer->header, sizeof(capture_file_header_t), 1, writer->fp) != 1)
+		result = -1;
+	if (fclose(writer->fp) != 0)
+		result = -1;
+	if (result == 0)
+		result = CaptureFile_BuildOverview(writer->path);
+	free(writer->path);
+	memset(writer, 0, sizeof(capture_writer_t));
+	return result;
+}
+
+/**
+ * @brief Compress a capture file using the @ref ADC_Codec.
+ * @param file Pointer to the source file state.
+ * @param path Path of the compressed file.
+ * @param blockRows Number of records in each block.
+ * @return 0 if successful else -1 with errno set.
+ */
+int CaptureFile_Compress(const capture_file_t* file, const char* path, uint32_t blockRows)
+{
+	capture_file_header_t header = *file->header;
+	uint32_t chCount = header.chCount;
+	uint8_t* block;
+	int result = -1;
+	if (blockRows == 0 || blockRows > ADC_CODEC_MAX_BLOCK_ROWS)
+	{
+		errno = EINVAL;
+		return -1;
+	}
+	block = (uint8_t*)malloc(MAX_CODEC_BLOCK_SIZE);
+	if (block == NULL)
+		return -1;
+
+	header.flags = (header.flags & ~CAPTURE_FLAG_OVERVIEW) | CAPTURE_FLAG_COMPRESSED;
+	header.sampleCount = file->sampleCount;
+	header.dataOffset = CAPTURE_HEADER_SIZE;
+	memset(header.overviewOffset, 0, sizeof(header.overviewOffset));
+	memset(header.overviewCount, 0, sizeof(header.overviewCount));
+	int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+		goto exit;
+	if (WriteAll(fd, &header, sizeof(header)) != 0)
+		goto close;
+	for (uint64_t start = 0; start < file->sampleCount; start += blockRows)
+	{
+		uint32_t n = (file->sampleCount - start) < blockRows ? (uint32_t)(file->sampleCount - start) : blockRows;
+		uint32_t size = AdcCodec_EncodeBlock(file->records + start * chCount, chCount, n, (uint32_t)start, block, MAX_CODEC_BLOCK_SIZE);
+		if (size == 0)
+		{
+			errno = EINVAL;
+			goto close;
+		}
+		if (WriteAll(fd, block, size) != 0)
+			goto close;
+	}
+	result = 0;
+
+close:
+	if (close(fd) != 0)
+		result = -1;
+exit:
+	free(block);
+	return result;
+}
+
+/**
+ * @brief Decompress a file generated by @ref CaptureFile_Compress() or streamed by the firmware.
+ * @details Decoding stops at the first invalid or truncated block, so partially written streams are recovered.
+ * @param src Path of the compressed file.
+ * @param dest Path of the capture file to be created.
+ * @param blockCount Filled with the number of decoded blocks. Can be NULL.
+ * @return 0 if successful else -1 with errno set.
+ */
+int CaptureFile_Decompress(const char* src, const char* dest, uint64_t* blockCount)
+{
+	capture_writer_t writer;
+	adc_codec_block_info_t info;
+	struct stat st;
+	uint16_t* records = NULL;
+	const uint8_t* map = MAP_FAILED;
+	uint64_t blocks = 0, rows = 0;
+	int result = -1;
+
+	int fd = open(src, O_RDONLY);
+	if (fd < 0)
+		return -1;
+	if (fstat(fd, &st) != 0)
+		goto exit;
+	if ((uint64_t)st.st_size < CAPTURE_HEADER_SIZE)
+	{
+		errno = EINVAL;
+		goto exit;
+	}
+	map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	if (map == MAP_FAILED)
+		goto exit;
+	const capture_file_header_t* header = (const capture_file_header_t*)map;
+	if (!CaptureFormat_IsHeaderValid(header) || (header->flags & CAPTURE_FLAG_COMPRESSED) == 0
+			|| header->dataOffset > (uint64_t)st.st_size)
+	{
+		errno = EINVAL;
+		goto exit;
+	}
+	records = (uint16_t*)malloc(ADC_CODEC_MAX_BLOCK_ROWS * ADC_CODEC_MAX_CHANNELS * sizeof(uint16_t));
+	if (records == NULL)
+		goto exit;
+
+	capture_file_header_t rawHeader = *header;
+	rawHeader.flags &= ~CAPTURE_FLAG_COMPRESSED;
+	if (CaptureWriter_Create(&writer, dest, &rawHeader) != 0)
+		goto exit;
+	uint64_t offset = header->dataOffset;
+	while (offset < (uint64_t)st.st_size)
+	{
+		uint64_t left = (uint64_t)st.st_size - offset;
+		int n = AdcCodec_DecodeBlock(map + offset, left > UINT32_MAX ? UINT32_MAX : (uint32_t)left, records, ADC_CODEC_MAX_BLOCK_ROWS, &info);
+		// Blocks should follow each other without gaps
+		if (n < 0 || info.chCount != header->chCount || info.firstRow != (uint32_t)rows)
+			break;
+		if (CaptureWriter_Append(&writer, records, (uint32_t)n) != 0)
+		{
+			CaptureWriter_Close(&writer);
+			goto exit;
+		}
+		offset += info.size;
+		rows += (uint64_t)n;
+		blocks++;
+	}
+	result = CaptureWriter_Close(&writer);
+	if (blockCount)
+		*blockCount = blocks;
+
+exit:
+	if (map != MAP_FAILED)
+		munmap((void*)map, (size_t)st.st_size);
+	close(fd);
+	free(records);
+	return result;
+}
+
+/* EOF */
@@ -0,0 +1,215 @@
+/**
+ ********************************************************************************
+ * @file 		capture_file.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    PC side reader/writer for the ADC capture files
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef CAPTURE_FILE_H_
+#define CAPTURE_FILE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup Capture_File Capture File
+ * @brief Memory-mapped access to the capture files described in @ref Capture_Format.
+ * @details The file is memory-mapped so only the pages touched by a request are loaded by the operating system.
+ * Range statistics only walk the requested records while the overview requests are served from the
+ * min/max pyramid, falling back to finer levels only at the edges of each bucket.
+ * @{
+ */
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdio.h>
+#include "capture_format.h"
+#include "adc_codec.h"
+#include "monitoring_library.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/** @defgroup CaptureFile_Exported_Structures Structures
+ * @{
+ */
+/**
+ * @brief Contains the state of an opened capture file
+ */
+typedef struct
+{
+	int fd;														/**< @brief File descriptor */
+	const uint8_t* map;											/**< @brief Start of the memory-mapped file */
+	size_t mapSize;												/**< @brief Size of the mapping in bytes */
+	const capture_file_header_t* header;						/**< @brief File header */
+	uint64_t sampleCount;										/**< @brief Number of complete records available */
+	const uint16_t* records;									/**< @brief Pointer to the first record */
+	const capture_overview_entry_t* overview[CAPTURE_OVERVIEW_LEVELS];	/**< @brief Overview levels. NULL if not available */
+} capture_file_t;
+/**
+ * @brief Contains the state of a capture file being written
+ */
+typedef struct
+{
+	FILE* fp;									/**< @brief File being written */
+	char* path;									/**< @brief Path of the file being written */
+	capture_file_header_t header;				/**< @brief Header of the file */
+} capture_writer_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+/** @defgroup CaptureFile_Exported_Functions Functions
+ * @{
+ */
+/**
+ * @brief Open a capture file for reading.
+ * @param file Pointer to the file state to be filled.
+ * @param path Path of the capture file.
+ * @return 0 if successful else -1 with errno set.
+ */
+extern int CaptureFile_Open(capture_file_t* file, const char* path);
+/**
+ * @brief Close a capture file opened by @ref CaptureFile_Open().
+ * @param file Pointer to the file state.
+ */
+extern void CaptureFile_Close(capture_file_t* file);
+/**
+ * @brief Convert a range of records to engineering units.
+ * @param file Pointer to the file state.
+ * @param start Index of the first record.
+ * @param count Number of records required.
+ * @param out Output buffer with space for <b>count * chCount</b> values.
+ * @return Number of records converted.
+ */
+extern uint64_t CaptureFile_ReadRange(const capture_file_t* file, uint64_t start, uint64_t count, float* out);
+/**
+ * @brief Compute the statistics of each channel over a range of records.
+ * @param file Pointer to the file state.
+ * @param start Index of the first record.
+ * @param count Number of records in the range.
+ * @param stats Output array with one entry for each channel.
+ * @return 0 if successful else -1 with errno set.
+ */
+extern int CaptureFile_ComputeStats(const capture_file_t* file, uint64_t start, uint64_t count, stats_data_t* stats);
+/**
+ * @brief Get the raw extremes of each channel over a range of records.
+ * @param file Pointer to the file state.
+ * @param start Index of the first record.
+ * @param count Number of records in the range.
+ * @param entry Output entry.
+ */
+extern void CaptureFile_GetExtremes(const capture_file_t* file, uint64_t start, uint64_t count, capture_overview_entry_t* entry);
+/**
+ * @brief Divide a range of records in equal buckets and get the raw extremes of each bucket.
+ * @param file Pointer to the file state.
+ * @param start Index of the first record.
+ * @param count Number of records in the range.
+ * @param points Number of buckets required.
+ * @param out Output array with space for <b>points</b> entries.
+ * @return Number of buckets filled. Less than points if the range contains fewer records.
+ */
+extern uint32_t CaptureFile_GetOverview(const capture_file_t* file, uint64_t start, uint64_t count, uint32_t points, capture_overview_entry_t* out);
+/**
+ * @brief Rebuild the overview pyramid of a capture file.
+ * @details Unfinished captures are finalized by computing the record count from the file size.
+ * Any incomplete trailing record is discarded.
+ * @param path Path of the capture file.
+ * @return 0 if successful else -1 with errno set.
+ */
+extern int CaptureFile_BuildOverview(const char* path);
+/**
+ * @brief Create a new capture file.
+ * @param writer Pointer to the writer state to be filled.
+ * @param path Path of the capture file.
+ * @param header Header of the capture file. The offsets and counts are managed by the writer.
+ * @return 0 if successful else -1 with errno set.
+ */
+extern int CaptureWriter_Create(capture_writer_t* writer, const char* path, const capture_file_header_t* header);
+/**
+ * @brief Append raw records to the capture file.
+ * @param writer Pointer to the writer state.
+ * @param records Pointer to the first record.
+ * @param count Number of records to be written.
+ * @return 0 if successful else -1 with errno set.
+ */
+extern int CaptureWriter_Append(capture_writer_t* writer, const uint16_t* records, uint32_t count);
+/**
+ * @brief Finalize the capture file and build its overview pyramid.
+ * @param writer Pointer to the writer state.
+ * @return 0 if successful else -1 with errno set.
+ */
+extern int CaptureWriter_Close(capture_writer_t* writer);
+/**
+ * @brief Compress a capture file using the @ref ADC_Codec.
+ * @param file Pointer to the source file state.
+ * @param path Path of the compressed file.
+ * @param blockRows Number of records in each block.
+ * @return 0 if successful else -1 with errno set.
+ */
+extern int CaptureFile_Compress(const capture_file_t* file, const char* path, uint32_t blockRows);
+/**
+ * @brief Decompress a file generated by @ref CaptureFile_Compress() or streamed by the firmware.
+ * @details Decoding stops at the first invalid or truncated block, so partially written streams are recovered.
+ * @param src Path of the compressed file.
+ * @param dest Path of the capture file to be created.
+ * @param blockCount Filled with the number of decoded blocks. Can be NULL.
+ * @return 0 if successful else -1 with errno set.
+ */
+extern int CaptureFile_Decompress(const char* src, const char* dest, uint64_t* blockCount);
+/**
+ * @brief Convert a raw value to engineering units.
+ * @param ch Channel information.
+ * @param raw Raw value.
+ * @return Value in engineering units.
+ */
+static inline float CaptureFile_Convert(const capture_channel_info_t* ch, uint16_t raw)
+{
+	return (raw - ch->offset) * ch->sensitivity;
+}
+/**
+ * @}
+ */
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+
+
+
+
+/**
+ * @}
+ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */
@@ -0,0 +1,447 @@
+/**
+ ********************************************************************************
+ * @file    	capture_tool.c
+ * @author 		Waqas Ehsan Butt
+ * @date    	Oct 18, 2026
+ *
+ * @brief   Command line utility for inspecting the ADC capture files
+ ********************************************************************************
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <errno.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <time.h>
+#include "capture_file.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+#define PI							(3.14159265358979f)
+/**
+ * @brief Number of records converted at once by the extract command
+ */
+#define EXTRACT_CHUNK_RECORDS		(1024)
+/**
+ * @brief Number of times the benchmark is repeated to get stable timing
+ */
+#define BENCH_REPEAT				(5)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static void PrintUsage(void)
+{
+	fprintf(stderr,
+			"Usage: capture_tool <command> <file> [arguments]\n"
+			"Commands:\n"
+			"  info     <file>                             Print the header information\n"
+			"  extract  <file> <start> <count>             Print the records as CSV in engineering units\n"
+			"  stats    <file> <start> <count>             Print RMS/AVG/MAX/MIN/PkToPk of each channel\n"
+			"  overview <file> <start> <count> <points>    Print min/max of each channel for equally sized buckets\n"
+			"  index    <file>                             Finalize the capture and rebuild the overview\n"
+			"  generate <file> <seconds> [fs]              Create a capture with synthetic three phase signals\n"
+			"  compress <file> <out> [blockRows]           Losslessly compress the records\n"
+			"  decompress <file> <out>                     Decompress a compressed capture or stream\n"
+			"  bench    <file> [blockRows]                 Measure the compression ratio and codec speed\n"
+			"Positions are in records. Add the suffix 's' to specify seconds. A count of 0 selects till the end.\n");
+}
+
+/**
+ * @brief Parse a position in records or seconds.
+ */
+static uint64_t ParsePosition(const char* txt, float fs)
+{
+	char* end;
+	double val = strtod(txt, &end);
+	if (*end == 's')
+		val *= fs;
+	return val < 0 ? 0 : (uint64_t)val;
+}
+
+/**
+ * @brief Parse the start and count of the range and limit them to the file.
+ */
+static uint64_t ParseRange(const capture_file_t* file, char** args, uint64_t* start)
+{
+	*start = ParsePosition(args[0], file->header->fs);
+	uint64_t count = ParsePosition(args[1], file->header->fs);
+	if (*start >= file->sampleCount)
+		return 0;
+	if (count == 0 || count > file->sampleCount - *start)
+		count = file->sampleCount - *start;
+	return count;
+}
+
+static void PrintChannelHeaders(const capture_file_t* file, const char* suffix1, const char* suffix2)
+{
+	printf("time");
+	for (uint32_t ch = 0; ch < file->header->chCount; ch++)
+	{
+		const capture_channel_info_t* info = &file->header->channels[ch];
+		printf(",%s%s[%s]", info->name, suffix1, info->unit);
+		if (suffix2)
+			printf(",%s%s[%s]", info->name, suffix2, info->unit);
+	}
+	printf("\n");
+}
+
+static int Info(const capture_file_t* file)
+{
+	const capture_file_header_t* header = file->header;
+	printf("Version:      %u\n", header->version);
+	printf("Channels:     %" PRIu32 "\n", header->chCount);
+	printf("Sampling:     %.3f Hz\n", header->fs);
+	printf("Records:      %" PRIu64 "%s\n", file->sampleCount, header->sampleCount ? "" : " (unfinished capture)");
+	printf("Duration:     %.3f s\n", file->sampleCount / header->fs);
+	printf("Start Time:   %" PRIu64 " us\n", header->startTimeUs);
+	printf("Overview:     %s\n", file->overview[0] ? "available" : "not available, run the index command");
+	printf("%-16s %-8s %14s %14s\n", "Channel", "Unit", "Sensitivity", "Offset");
+	for (uint32_t ch = 0; ch < header->chCount; ch++)
+	{
+		const capture_channel_info_t* info = &header->channels[ch];
+		printf("%-16s %-8s %14.6g %14.6g\n", info->name, info->unit, info->sensitivity, info->offset);
+	}
+	return 0;
+}
+
+static int Extract(const capture_file_t* file, char** args)
+{
+	static float data[EXTRACT_CHUNK_RECORDS * CAPTURE_MAX_CHANNELS];
+	uint64_t start;
+	uint64_t count = ParseRange(file, args, &start);
+	uint32_t chCount = file->header->chCount;
+
+	PrintChannelHeaders(file, "", NULL);
+	while (count)
+	{
+		uint64_t n = CaptureFile_ReadRange(file, start, count > EXTRACT_CHUNK_RECORDS ? EXTRACT_CHUNK_RECORDS : count, data);
+		for (uint64_t i = 0; i < n; i++)
+		{
+			printf("%.7f", (start + i) / file->header->fs);
+			for (uint32_t ch = 0; ch < chCount; ch++)
+				printf(",%g", data[i * chCount + ch]);
+			printf("\n");
+		}
+		start += n;
+		count -= n;
+	}
+	return 0;
+}
+
+static int Stats(const capture_file_t* file, char** args)
+{
+	stats_data_t stats[CAPTURE_MAX_CHANNELS];
+	uint64_t start;
+	uint64_t count = ParseRange(file, args, &start);
+	if (CaptureFile_ComputeStats(file, start, count, stats) != 0)
+	{
+		perror("stats");
+		return 1;
+	}
+	printf("%-16s %-8s %14s %14s %14s %14s %14s\n", "Channel", "Unit", "RMS", "AVG", "MAX", "MIN", "PkToPk");
+	for (uint32_t ch = 0; ch < file->header->chCount; ch++)
+	{
+		const capture_channel_info_t* info = &file->header->channels[ch];
+		printf("%-16s %-8s %14.6g %14.6g %14.6g %14.6g %14.6g\n", info->name, info->unit,
+				stats[ch].rms, stats[ch].avg, stats[ch].max, stats[ch].min, stats[ch].pkTopk);
+	}
+	return 0;
+}
+
+static int Overview(const capture_file_t* file, char** args)
+{
+	uint64_t start;
+	uint64_t count = ParseRange(file, args, &start);
+	uint32_t points = (uint32_t)strtoul(args[2], NULL, 0);
+	capture_overview_entry_t* entries = (capture_overview_entry_t*)malloc((points ? points : 1) * sizeof(capture_overview_entry_t));
+	if (entries == NULL)
+	{
+		perror("overview");
+		return 1;
+	}
+
+	points = CaptureFile_GetOverview(file, start, count, points, entries);
+	PrintChannelHeaders(file, ".min", ".max");
+	for (uint32_t i = 0; i < points; i++)
+	{
+		printf("%.7f", (start + (count * i) / points) / file->header->fs);
+		for (uint32_t ch = 0; ch < file->header->chCount; ch++)
+		{
+			const capture_channel_info_t* info = &file->header->channels[ch];
+			float v1 = CaptureFile_Convert(info, entries[i].min[ch]);
+			float v2 = CaptureFile_Convert(info, entries[i].max[ch]);
+			// negative sensitivity swaps the extremes
+			printf(",%g,%g", v1 < v2 ? v1 : v2, v1 < v2 ? v2 : v1);
+		}
+		printf("\n");
+	}
+	free(entries);
+	return 0;
+}
+
+/**
+ * @brief Generate a capture with three phase inverter currents and grid voltages, a DC link and noise on the rest of the channels.
+ * @details The currents contain switching ripple and the 5th harmonic, the voltages the 5th and 7th harmonics and the DC link
+ * the 100 Hz ripple.
+ */
+static int Generate(const char* path, char** args, int argCount)
+{
+	capture_file_header_t header;
+	capture_writer_t writer;
+	uint16_t records[EXTRACT_CHUNK_RECORDS][CAPTURE_MAX_CHANNELS];
+	float fs = argCount > 1 ? strtof(args[1], NULL) : 40000.f;
+	uint64_t count = (uint64_t)(strtod(args[0], NULL) * fs);
+	uint64_t index = 0;
+	uint32_t seed = 1;
+
+	CaptureFormat_InitHeader(&header, CAPTURE_MAX_CHANNELS, fs);
+	for (int ch = 0; ch < CAPTURE_MAX_CHANNELS; ch++)
+	{
+		capture_channel_info_t* info = &header.channels[ch];
+		if (ch < 6)
+			snprintf(info->name, CAPTURE_NAME_LEN, "%c%c", ch < 3 ? 'I' : 'V', 'a' + (ch % 3));
+		else if (ch == 8)
+			strcpy(info->name, "Vdc");
+		else
+			snprintf(info->name, CAPTURE_NAME_LEN, "Ch%d", ch + 1);
+		strcpy(info->unit, ch < 3 ? "A" : "V");
+		info->offset = 32768.f;
+		info->sensitivity = ch < 3 ? 0.001f : 0.02f;
+	}
+	if (CaptureWriter_Create(&writer, path, &header) != 0)
+	{
+		perror(path);
+		return 1;
+	}
+
+	while (index < count)
+	{
+		uint32_t n = (count - index) > EXTRACT_CHUNK_RECORDS ? EXTRACT_CHUNK_RECORDS : (uint32_t)(count - index);
+		for (uint32_t i = 0; i < n; i++, index++)
+		{
+			float theta = 2 * PI * 50.f * index / fs;
+			// triangular switching ripple at 10 kHz
+			float phase = fmodf(10000.f * index / fs, 1.f);
+			float ripple = 4 * (phase < 0.5f ? phase : 1 - phase) - 1;
+			for (int ch = 0; ch < CAPTURE_MAX_CHANNELS; ch++)
+			{
+				// sensor and quantization noise with triangular distribution of +/-16 LSB
+				seed = seed * 1664525u + 1013904223u;
+				float noise = (float)((int)(seed >> 28) + (int)((seed >> 24) & 0xf) - 15);
+				float val;
+				float angle = theta - (2 * PI / 3) * (ch % 3);
+				if (ch < 3)
+					val = 20000.f * sinf(angle) + 600.f * sinf(5 * angle) + 800.f * ripple;
+				else if (ch < 6)
+					val = 16000.f * sinf(angle) + 480.f * sinf(5 * angle) + 320.f * sinf(7 * angle);
+				else if (ch == 8)
+					val = 30000.f + 300.f * sinf(2 * theta);
+				else
+					val = 0;
+				records[i][ch] = (uint16_t)(32768.f + val + noise);
+			}
+		}
+		if (CaptureWriter_Append(&writer, &records[0][0], n) != 0)
+		{
+			perror(path);
+			CaptureWriter_Close(&writer);
+			return 1;
+		}
+	}
+	if (CaptureWriter_Close(&writer) != 0)
+	{
+		perror(path);
+		return 1;
+	}
+	return 0;
+}
+
+static inline uint64_t GetTime_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Compress the capture in memory and report the compression ratio and codec speed.
+ */
+static int Bench(const capture_file_t* file, char** args, int argCount)
+{
+	uint32_t blockRows = argCount > 0 ? (uint32_t)strtoul(args[0], NULL, 0) : ADC_CODEC_DEFAULT_BLOCK_ROWS;
+	uint32_t chCount = file->header->chCount;
+	uint64_t count = file->sampleCount;
+	if (blockRows == 0 || blockRows > ADC_CODEC_MAX_BLOCK_ROWS || count == 0)
+	{
+		PrintUsage();
+		return 1;
+	}
+	uint64_t blockCount = (count + blockRows - 1) / blockRows;
+	size_t maxBlock = ADC_CODEC_MAX_BLOCK_SIZE(chCount, blockRows);
+	uint8_t* encoded = (uint8_t*)malloc(blockCount * maxBlock);
+	uint32_t* sizes = (uint32_t*)malloc(blockCount * sizeof(uint32_t));
+	uint16_t* decoded = (uint16_t*)malloc(blockRows * chCount * sizeof(uint16_t));
+	if (encoded == NULL || sizes == NULL || decoded == NULL)
+	{
+		perror("bench");
+		return 1;
+	}
+
+	uint64_t bytes = 0, encodeTime = UINT64_MAX, decodeTime = UINT64_MAX;
+	for (int r = 0; r < BENCH_REPEAT; r++)
+	{
+		uint64_t t0 = GetTime_ns();
+		bytes = 0;
+		for (uint64_t b = 0; b < blockCount; b++)
+		{
+			uint64_t start = b * blockRows;
+			uint32_t n = (count - start) < blockRows ? (uint32_t)(count - start) : blockRows;
+			sizes[b] = AdcCodec_EncodeBlock(file->records + start * chCount, chCount, n, (uint32_t)start, encoded + b * maxBlock, maxBlock);
+			bytes += sizes[b];
+		}
+		uint64_t t = GetTime_ns() - t0;
+		encodeTime = t < encodeTime ? t : encodeTime;
+	}
+	for (int r = 0; r < BENCH_REPEAT; r++)
+	{
+		uint64_t t0 = GetTime_ns();
+		for (uint64_t b = 0; b < blockCount; b++)
+		{
+			int n = AdcCodec_DecodeBlock(encoded + b * maxBlock, sizes[b], decoded, blockRows, NULL);
+			// Verify during the first pass only to keep the comparison out of the timing
+			if (r == 0 && (n < 0 || memcmp(decoded, file->records + b * blockRows * chCount, (size_t)n * chCount * sizeof(uint16_t)) != 0))
+			{
+				fprintf(stderr, "Block %" PRIu64 " didn't decode to the original records\n", b);
+				return 1;
+			}
+		}
+		uint64_t t = GetTime_ns() - t0;
+		decodeTime = t < decodeTime ? t : decodeTime;
+	}
+
+	uint64_t rawBytes = count * chCount * sizeof(uint16_t);
+	double seconds = count / file->header->fs;
+	printf("Records:          %" PRIu64 " x %" PRIu32 " channels, %" PRIu32 " records per block\n", count, chCount, blockRows);
+	printf("Raw Size:         %" PRIu64 " bytes (%.1f kB/s)\n", rawBytes, rawBytes / seconds / 1000);
+	printf("Compressed Size:  %" PRIu64 " bytes (%.1f kB/s)\n", bytes, bytes / seconds / 1000);
+	printf("Ratio:            %.3f (%.2f bits per sample)\n", (double)rawBytes / bytes, 8.0 * bytes / (count * chCount));
+	printf("Encode:           %.1f ns per record\n", (double)encodeTime / count);
+	printf("Decode:           %.1f ns per record\n", (double)decodeTime / count);
+	printf("Lossless:         verified\n");
+	free(encoded);
+	free(sizes);
+	free(decoded);
+	return 0;
+}
+
+int main(int argc, char** argv)
+{
+	capture_file_t file;
+	int result;
+	if (argc < 3)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	const char* cmd = argv[1];
+	const char* path = argv[2];
+	char** args = &argv[3];
+	int argCount = argc - 3;
+
+	if (strcmp(cmd, "generate") == 0)
+	{
+		if (argCount < 1)
+		{
+			PrintUsage();
+			return 1;
+		}
+		return Generate(path, args, argCount);
+	}
+	if (strcmp(cmd, "decompress") == 0 && argCount >= 1)
+	{
+		uint64_t blocks;
+		if (CaptureFile_Decompress(path, args[0], &blocks) != 0)
+		{
+			perror(path);
+			return 1;
+		}
+		printf("%" PRIu64 " blocks decoded\n", blocks);
+		return 0;
+	}
+	if (strcmp(cmd, "index") == 0)
+	{
+		if (CaptureFile_BuildOverview(path) != 0)
+		{
+			perror(path);
+			return 1;
+		}
+		return 0;
+	}
+
+	if (CaptureFile_Open(&file, path) != 0)
+	{
+		perror(path);
+		return 1;
+	}
+	if (strcmp(cmd, "info") == 0)
+		result = Info(&file);
+	else if (strcmp(cmd, "extract") == 0 && argCount >= 2)
+		result = Extract(&file, args);
+	else if (strcmp(cmd, "stats") == 0 && argCount >= 2)
+		result = Stats(&file, args);
+	else if (strcmp(cmd, "overview") == 0 && argCount >= 3)
+		result = Overview(&file, args);
+	else if (strcmp(cmd, "bench") == 0)
+		result = Bench(&file, args, argCount);
+	else if (strcmp(cmd, "compress") == 0 && argCount >= 1)
+	{
+		uint32_t blockRows = argCount > 1 ? (uint32_t)strtoul(args[1], NULL, 0) : ADC_CODEC_DEFAULT_BLOCK_ROWS;
+		result = CaptureFile_Compress(&file, args[0], blockRows);
+		if (result != 0)
+			perror(args[0]);
+	}
+	else
+	{
+		PrintUsage();
+		result = 1;
+	}
+	CaptureFile_Close(&file);
+	return result;
+}
+
+/* EOF */
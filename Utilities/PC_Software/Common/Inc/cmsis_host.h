@@ -0,0 +1,69 @@
+/**
+ ********************************************************************************
+ * @file 		cmsis_host.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Host replacements of the CMSIS compiler intrinsics
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef CMSIS_HOST_H_
+#define CMSIS_HOST_H_
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdint.h>
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/**
+ * @brief Prevents the inclusion of cmsis_gcc.h, whose intrinsics use ARM instructions.
+ * @details Force include this file (<c>-include cmsis_host.h</c>) when compiling the firmware sources with the HAL
+ * headers on the PC. Barriers map to full memory fences of the host. The interrupt intrinsics are declared
+ * only and should be defined by the tools needing them.
+ */
+#define __CMSIS_GCC_H
+
+#define __ASM							__asm
+#define __INLINE						inline
+#define __STATIC_INLINE					static inline
+#define __STATIC_FORCEINLINE			static inline
+#define __NO_RETURN						__attribute__((__noreturn__))
+#define __USED							__attribute__((used))
+#define __WEAK							__attribute__((weak))
+#define __PACKED						__attribute__((packed, aligned(1)))
+#define __PACKED_STRUCT					struct __attribute__((packed, aligned(1)))
+#define __PACKED_UNION					union __attribute__((packed, aligned(1)))
+#define __ALIGNED(x)					__attribute__((aligned(x)))
+#define __RESTRICT						__restrict
+#define __COMPILER_BARRIER()			__asm volatile("" ::: "memory")
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+extern void __disable_irq(void);
+extern void __enable_irq(void);
+extern uint32_t __get_IPSR(void);
+extern uint32_t __get_PRIMASK(void);
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static inline void __NOP(void) { }
+static inline void __DMB(void) { __sync_synchronize(); }
+static inline void __DSB(void) { __sync_synchronize(); }
+static inline void __ISB(void) { __sync_synchronize(); }
+
+#endif
+/* EOF */
@@ -0,0 +1,77 @@
+/**
+ ********************************************************************************
+ * @file 		general_header.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Replacement of the BSP general header used when compiling the
+ * hardware independent libraries on a PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef GENERAL_HEADER_H
+#define GENERAL_HEADER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/**
+ * @brief Time critical code is placed in ITCM on the target. Normal placement is used on PC.
+ */
+#define TCritical
+/**
+ * @brief Weak symbol definition
+ */
+#ifndef __weak
+#define __weak				__attribute__((weak))
+#endif
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */
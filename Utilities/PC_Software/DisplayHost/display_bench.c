@@ -0,0 +1,98 @@
+/**
+ ********************************************************************************
+ * @file 		display_bench.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Measures the frame time of the main screen on the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "display_host.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** Time for the splash screen to switch to the main screen */
+#define STARTUP_TIME_ms				(3000)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+int main(int argc, char** argv)
+{
+	int seconds = argc > 1 ? atoi(argv[1]) : 60;
+	if (seconds <= 0)
+	{
+		fprintf(stderr, "usage: %s [seconds]\n", argv[0]);
+		return 1;
+	}
+
+	srand(1);
+	DisplayHost_Init();
+	uint32_t time_ms = 0;
+	for (; time_ms < STARTUP_TIME_ms; time_ms += DISPLAY_HOST_TASK_PERIOD_ms)
+	{
+		if (time_ms % DISPLAY_HOST_STATS_PERIOD_ms == 0)
+			DisplayHost_UpdateSyntheticStats();
+		DisplayHost_Run(1);
+	}
+	display_host_stats_t stats;
+	DisplayHost_GetStats(&stats);
+	printf("startup: %u frames, %.1f ms rendering, %.2f Mpixels flushed\n", stats.frameCount, stats.frameTime_us / 1000, stats.flushedPixels / 1e6);
+
+	DisplayHost_ResetStats();
+	for (uint32_t end = time_ms + seconds * 1000; time_ms < end; time_ms += DISPLAY_HOST_TASK_PERIOD_ms)
+	{
+		if (time_ms % DISPLAY_HOST_STATS_PERIOD_ms == 0)
+			DisplayHost_UpdateSyntheticStats();
+		DisplayHost_Run(1);
+	}
+	DisplayHost_GetStats(&stats);
+
+	uint32_t frames = stats.frameCount ? stats.frameCount : 1;
+	printf("main screen: %d s, %u task periods, %u frames\n", seconds, stats.periodCount, stats.frameCount);
+	printf("  frame time:     %8.1f us avg %8.1f us max\n", stats.frameTime_us / frames, stats.maxFrameTime_us);
+	printf("  flush time:     %8.1f us/frame\n", stats.flushTime_us / frames);
+	printf("  flushed:        %8.0f pixels/frame in %.1f areas/frame\n", (double)stats.flushedPixels / frames, (double)stats.flushCount / frames);
+	printf("  screen refresh: %8.1f us/period\n", stats.screenTime_us / stats.periodCount);
+	printf("  LVGL heap:      %8u bytes max used of %u\n", stats.lvMemMaxUsed, stats.lvMemSize);
+	printf("  display task:   %8.2f %% of the host time per emulated time\n", 100 * (stats.screenTime_us + stats.timerTime_us) / (seconds * 1e6));
+	return 0;
+}
+
+/* EOF */
@@ -0,0 +1,439 @@
+/**
+ ********************************************************************************
+ * @file 		display_host.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Headless emulation of the display module for the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "display_host.h"
+#include "pecontroller_display.h"
+#include "pecontroller_display_flush.h"
+#include "pecontroller_adc.h"
+#include "pecontroller_intelliSENS.h"
+#include "clut_data.h"
+#include "lvgl.h"
+#include "lv_theme_taraz.h"
+#include "screen_data.h"
+#include "screen_manager.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+/**
+ * @brief Shared data of the cores, only used by the CM4 core in the emulation
+ */
+static shared_data_t hostSharedData;
+static uint32_t tick;
+static display_host_stats_t stats;
+static bool isTouchPressed;
+static int touchX, touchY;
+static FILE* frameLog;
+static double periodFlushTime_us;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+volatile shared_data_t * const sharedData = &hostSharedData;
+uint8_t frame_buff[DISPLAY_HEIGHT_RAM][DISPLAY_WIDTH_RAM];
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+double DisplayHost_GetHostTime_us(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+uint32_t HAL_GetTick(void)
+{
+	return tick;
+}
+
+void Error_Handler(void)
+{
+	fprintf(stderr, "Error_Handler() called by the screens\n");
+	abort();
+}
+
+/**
+ * @brief Only the display configuration of the ADC is updated, as the ADC is not emulated.
+ */
+device_err_t BSP_ADC_UpdateConfig(adc_info_t* _info, float _fs, int _channelIndex, float _freq, float _sensitivity, float _offset, data_units_t _unit)
+{
+	_info->fs = _fs;
+	_info->freq[_channelIndex] = _freq;
+	_info->sensitivity[_channelIndex] = _sensitivity;
+	_info->offsets[_channelIndex] = _offset;
+	_info->units[_channelIndex] = _unit;
+	return ERR_OK;
+}
+
+/**
+ * @brief The screens run in a single thread without the CM7 core, so the interrupts are not emulated.
+ */
+void __disable_irq(void)
+{
+}
+
+void __enable_irq(void)
+{
+}
+
+void HAL_HSEM_ActivateNotification(uint32_t SemMask)
+{
+	(void)SemMask;
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+	(void)IRQn;
+	(void)PreemptPriority;
+	(void)SubPriority;
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+	(void)IRQn;
+}
+
+const char* intelliSENS_GetLicenseNumberString(void)
+{
+	return "Host";
+}
+
+/**
+ * @brief Same conversion as the display driver of the BSP with the 180 degrees rotation fused in the flush.
+ */
+static void FlushLVGLScreen(lv_disp_drv_t * disp, const lv_area_t * area, lv_color_t * color_p)
+{
+	double start = DisplayHost_GetHostTime_us();
+	DisplayFlush_ConvertArea((uint8_t*)frame_buff, DISPLAY_WIDTH_RAM, DISPLAY_HEIGHT_RAM, area->x1, area->y1, area->x2, area->y2,
+			(const uint16_t*)color_p, color_map, true);
+	writeAtScreenEnd = ((DISPLAY_WIDTH - 1 - area->x1) > DISPLAY_WIDTH - 30);
+	periodFlushTime_us += DisplayHost_GetHostTime_us() - start;
+	stats.flushCount++;
+	stats.flushedPixels += (uint64_t)lv_area_get_width(area) * lv_area_get_height(area);
+	lv_disp_flush_ready(disp);
+}
+
+/**
+ * @brief The touch panel reports the coordinates of the frame buffer, which LVGL rotates back to the screen.
+ */
+static void ReadTouchPad(struct _lv_indev_drv_t * indev, lv_indev_data_t * data)
+{
+	LV_UNUSED(indev);
+	if (isTouchPressed)
+	{
+		data->state = LV_INDEV_STATE_PRESSED;
+		data->point.x = DISPLAY_WIDTH - 1 - touchX;
+		data->point.y = DISPLAY_HEIGHT - 1 - touchY;
+	}
+	else
+		data->state = LV_INDEV_STATE_RELEASED;
+}
+
+void DisplayHost_SetTouch(bool isPressed, int x, int y)
+{
+	isTouchPressed = isPressed;
+	touchX = x < 0 ? 0 : (x >= DISPLAY_WIDTH ? DISPLAY_WIDTH - 1 : x);
+	touchY = y < 0 ? 0 : (y >= DISPLAY_HEIGHT ? DISPLAY_HEIGHT - 1 : y);
+}
+
+void DisplayHost_SetFrameLog(FILE* file)
+{
+	frameLog = file;
+	if (frameLog)
+		fprintf(frameLog, "time_ms,frame_us,flush_us,areas,pixels\n");
+}
+
+/**
+ * @brief Write a little endian value to a byte array.
+ */
+static void WriteLE(uint8_t* dest, uint32_t value, int len)
+{
+	for (int i = 0; i < len; i++)
+		dest[i] = (uint8_t)(value >> (8 * i));
+}
+
+int DisplayHost_DumpFrame(const char* path)
+{
+	FILE* file = fopen(path, "wb");
+	if (file == NULL)
+		return -1;
+	// file header, information header and palette of an uncompressed 8-bit BMP
+	uint8_t header[14 + 40 + 256 * 4] = { 'B', 'M' };
+	uint32_t dataOffset = sizeof(header);
+	WriteLE(&header[2], dataOffset + DISPLAY_WIDTH * DISPLAY_HEIGHT, 4);
+	WriteLE(&header[10], dataOffset, 4);
+	WriteLE(&header[14], 40, 4);
+	WriteLE(&header[18], DISPLAY_WIDTH, 4);
+	WriteLE(&header[22], DISPLAY_HEIGHT, 4);
+	WriteLE(&header[26], 1, 2);
+	WriteLE(&header[28], 8, 2);
+	WriteLE(&header[34], DISPLAY_WIDTH * DISPLAY_HEIGHT, 4);
+	WriteLE(&header[46], 256, 4);
+	for (int i = 0; i < 256; i++)
+		WriteLE(&header[54 + i * 4], clut_data[i] & 0xFFFFFF, 4);
+	int err = fwrite(header, sizeof(header), 1, file) == 1 ? 0 : -1;
+
+	// BMP rows are stored from the bottom of the image, which is the first row of the frame buffer after the rotation.
+	// So only the pixels of each row need to be reversed.
+	uint8_t row[DISPLAY_WIDTH];
+	for (int y = 0; y < DISPLAY_HEIGHT && err == 0; y++)
+	{
+		for (int x = 0; x < DISPLAY_WIDTH; x++)
+			row[x] = frame_buff[y][DISPLAY_WIDTH - 1 - x];
+		err = fwrite(row, sizeof(row), 1, file) == 1 ? 0 : -1;
+	}
+	if (fclose(file) != 0)
+		err = -1;
+	return err;
+}
+
+void DisplayHost_UpdateSyntheticStats(void)
+{
+	adc_info_t* info = (adc_info_t*)&ADC_INFO;
+	info->fs = 40000;
+	for (int i = 0; i < TOTAL_MEASUREMENT_COUNT; i++)
+	{
+		float noise = 0.0005f * ((rand() % 2001) - 1000) / 1000.f;
+		float amplitude = (i < 8 ? 325.f : 10.f) * (1 + 0.05f * sinf(tick * 0.0001f + i) + noise);
+		float offset = amplitude * 0.01f * cosf(tick * 0.0007f + i);
+		info->stats[i].max = offset + amplitude;
+		info->stats[i].min = offset - amplitude;
+		info->stats[i].avg = offset;
+		info->stats[i].rms = sqrtf(offset * offset + amplitude * amplitude / 2);
+		info->stats[i].pkTopk = 2 * amplitude;
+	}
+	BSP_ADC_StatsUpdatedCallback((1U << TOTAL_MEASUREMENT_COUNT) - 1);
+}
+
+void DisplayHost_UpdateSyntheticTelemetry(void)
+{
+	static const struct
+	{
+		const char* name;
+		uint8_t priority;
+		float load;
+		uint32_t runsPerSec;
+		uint32_t latency_us;
+		uint32_t stackFree;
+	} tasks[] =
+	{
+		// FreeRTOS priorities of the CMSIS priorities used by the CM4 core
+		{ "statsTask", 47, 18.f, 1000, 4, 2848 },
+		{ "displayTask", 40, 22.f, 200, 9, 1204 },
+		{ "touchTask", 45, 0.2f, 10, 6, 652 },
+		{ "storageTask", 8, 0.05f, 1, 35, 284 },
+		{ "Tmr Svc", 2, 0.01f, 1, 12, 812 },
+		{ "IDLE", 0, 0, 1211, 0, 420 },
+	};
+	static uint32_t peakLatency_us[sizeof(tasks) / sizeof(tasks[0])];
+	static uint32_t lastResetRequests;
+	volatile task_telemetry_table_t* table = &TASK_TELEMETRY;
+	bool isReset = table->resetRequests != lastResetRequests;
+	lastResetRequests = table->resetRequests;
+
+	table->seq++;
+	__DMB();
+	table->updateCount++;
+	table->period_us = TASK_TELEMETRY_PERIOD_ms * 1000;
+	table->taskCount = table->totalTasks = sizeof(tasks) / sizeof(tasks[0]);
+	table->cpuLoad = 0;
+	for (int i = 0; i < table->taskCount; i++)
+	{
+		volatile task_telemetry_entry_t* entry = &table->tasks[i];
+		float drift = 1 + 0.1f * sinf(tick * 0.0003f + i);
+		strcpy((char*)entry->name, tasks[i].name);
+		entry->priority = tasks[i].priority;
+		// eRunning for the first task, eBlocked for the others
+		entry->state = i == 0 ? 0 : 2;
+		entry->cpuLoad = tasks[i].load * drift;
+		entry->runTime_us = (uint32_t)(entry->cpuLoad * table->period_us / 100);
+		entry->switchIns = tasks[i].runsPerSec;
+		entry->maxLatency_us = (uint32_t)(tasks[i].latency_us * drift * (1 + rand() % 3));
+		if (isReset)
+			peakLatency_us[i] = 0;
+		if (entry->maxLatency_us > peakLatency_us[i])
+			peakLatency_us[i] = entry->maxLatency_us;
+		entry->peakLatency_us = peakLatency_us[i];
+		entry->stackFree = tasks[i].stackFree;
+		table->cpuLoad += entry->cpuLoad;
+	}
+	// the idle task takes the rest of the time
+	table->tasks[table->taskCount - 1].cpuLoad = 100 - table->cpuLoad;
+	__DMB();
+	table->seq++;
+}
+
+/**
+ * @brief Same sequence as @ref P2PComms_BeginUpdate() of the CM7 core.
+ */
+p2p_data_buffs_t* DisplayHost_BeginDataUpdate(void)
+{
+	__atomic_fetch_add(&INTER_CORE_DATA_SYNC.writers, 1, __ATOMIC_SEQ_CST);
+	return (p2p_data_buffs_t*)&INTER_CORE_DATA;
+}
+
+/**
+ * @brief Same sequence as @ref P2PComms_EndUpdate() of the CM7 core.
+ */
+void DisplayHost_EndDataUpdate(uint32_t groups)
+{
+	volatile p2p_data_sync_t* sync = &INTER_CORE_DATA_SYNC;
+	uint32_t seq = sync->seq + 1;
+	for (int i = 0; i < DTYPE_COUNT; i++)
+	{
+		if (groups & P2P_DATA_GROUP(i))
+			sync->groupSeq[i] = seq;
+	}
+	__atomic_fetch_add(&sync->seq, 1, __ATOMIC_SEQ_CST);
+	__atomic_fetch_sub(&sync->writers, 1, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief The LTDC layers are not emulated.
+ */
+static void LayerDisplay(ltdc_layer_info_t* layerInfo, int layerIdx)
+{
+	(void)layerInfo;
+	(void)layerIdx;
+}
+
+/**
+ * @brief Update the high-water mark of the LVGL heap.
+ * @note The maximum of LVGL only counts the allocations but not the reallocations, so the free memory is measured.
+ */
+static void SampleHeapUsage(void)
+{
+	lv_mem_monitor_t mon;
+	lv_mem_monitor(&mon);
+	if (mon.total_size - mon.free_size > stats.lvMemMaxUsed)
+		stats.lvMemMaxUsed = mon.total_size - mon.free_size;
+}
+
+void DisplayHost_Init(void)
+{
+	memset(&hostSharedData, 0, sizeof(hostSharedData));
+	tick = 0;
+	isTouchPressed = false;
+	lv_init();
+	static lv_disp_draw_buf_t disp_buf;
+	static lv_color_t lv_buff[LVGL_BUFF_SIZE];
+	lv_disp_draw_buf_init(&disp_buf, lv_buff, NULL, LVGL_BUFF_SIZE);
+
+	static lv_disp_drv_t disp_drv;
+	lv_disp_drv_init(&disp_drv);
+	disp_drv.flush_cb = FlushLVGLScreen;
+	disp_drv.draw_buf = &disp_buf;
+	disp_drv.hor_res = DISPLAY_WIDTH;
+	disp_drv.ver_res = DISPLAY_HEIGHT;
+	disp_drv.rotated = LV_DISP_ROT_180;
+	disp_drv.sw_rotate = 0;
+	lv_disp_t* disp = lv_disp_drv_register(&disp_drv);
+	disp->theme = lv_theme_taraz_init(disp, lv_color_make(0, 100, 100), lv_color_make(0, 200, 200), true, LV_FONT_DEFAULT);
+
+	static lv_indev_drv_t indev_drv;
+	lv_indev_drv_init(&indev_drv);
+	indev_drv.type = LV_INDEV_TYPE_POINTER;
+	indev_drv.read_cb = ReadTouchPad;
+	lv_indev_drv_register(&indev_drv);
+
+	ScreenManager_Init(LayerDisplay, (adc_info_t*)&ADC_INFO);
+	DisplayHost_ResetStats();
+}
+
+/**
+ * @brief Same sequence as the display task of the CM4 core.
+ */
+void DisplayHost_Run(uint32_t periods)
+{
+	static int i = 0;
+	while (periods--)
+	{
+		double start = DisplayHost_GetHostTime_us();
+		if (++i >= DISPLAY_HOST_SCREEN_REFRESH_DIV)
+		{
+			ScreenManager_Refresh();
+			i = 0;
+		}
+		double screenTime = DisplayHost_GetHostTime_us() - start;
+		stats.screenTime_us += screenTime;
+		if (screenTime > stats.maxScreenTime_us)
+			stats.maxScreenTime_us = screenTime;
+		SampleHeapUsage();
+
+		double mid = DisplayHost_GetHostTime_us();
+		uint32_t flushCount = stats.flushCount;
+		uint64_t flushedPixels = stats.flushedPixels;
+		periodFlushTime_us = 0;
+		lv_timer_handler();
+		double end = DisplayHost_GetHostTime_us();
+
+		SampleHeapUsage();
+		stats.periodCount++;
+		stats.timerTime_us += end - mid;
+		stats.flushTime_us += periodFlushTime_us;
+		if (stats.flushCount != flushCount)
+		{
+			stats.frameCount++;
+			stats.frameTime_us += end - mid;
+			if (frameLog)
+				fprintf(frameLog, "%u,%.1f,%.1f,%u,%llu\n", tick, end - mid, periodFlushTime_us, stats.flushCount - flushCount,
+						(unsigned long long)(stats.flushedPixels - flushedPixels));
+		}
+		if (end - mid > stats.maxFrameTime_us)
+			stats.maxFrameTime_us = end - mid;
+
+		tick += DISPLAY_HOST_TASK_PERIOD_ms;
+		lv_tick_inc(DISPLAY_HOST_TASK_PERIOD_ms);
+	}
+}
+
+void DisplayHost_GetStats(display_host_stats_t* _stats)
+{
+	*_stats = stats;
+	_stats->lvMemSize = LV_MEM_SIZE;
+}
+
+void DisplayHost_ResetStats(void)
+{
+	memset(&stats, 0, sizeof(stats));
+}
+
+/* EOF */
@@ -0,0 +1,189 @@
+/**
+ ********************************************************************************
+ * @file 		display_host.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Headless emulation of the display module for the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef DISPLAY_HOST_H_
+#define DISPLAY_HOST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup Display_Host Display Host
+ * @brief Runs the screens of the CM4 core with LVGL on a PC without the display hardware.
+ * @details LVGL is registered in the same way as by the display driver of the BSP, with the same flush kernels
+ * converting the rendered areas to the L8 frame buffer. The display task is emulated with a virtual time, which
+ * advances by @ref DISPLAY_HOST_TASK_PERIOD_ms with each period of the task.
+ *
+ * The touch input is set by the caller, and the data of the other cores is replaced by synthetic statistics of the
+ * ADC channels and synthetic values of the shared P2P registers.
+ * @{
+ */
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdio.h>
+#include "general_header.h"
+#include "shared_memory.h"
+#include "p2p_comms.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** @defgroup DisplayHost_Exported_Macros Macros
+ * @{
+ */
+/**
+ * @brief Period of the display task in milli-seconds
+ */
+#define DISPLAY_HOST_TASK_PERIOD_ms			(5)
+/**
+ * @brief The screen manager is refreshed once in this many periods of the display task
+ */
+#define DISPLAY_HOST_SCREEN_REFRESH_DIV		(5)
+/**
+ * @brief Period of the ADC statistics, which are computed over half a second of samples by the ADC driver
+ */
+#define DISPLAY_HOST_STATS_PERIOD_ms		(500)
+/**
+ * @}
+ */
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/** @defgroup DisplayHost_Exported_Structures Structures
+ * @{
+ */
+/**
+ * @brief Timings of the display task, measured in the host time
+ */
+typedef struct
+{
+	uint32_t periodCount;			/**< @brief No of emulated periods of the display task */
+	uint32_t frameCount;			/**< @brief No of periods in which LVGL flushed areas */
+	uint32_t flushCount;			/**< @brief No of flushed areas */
+	uint64_t flushedPixels;			/**< @brief Total pixels of the flushed areas */
+	double screenTime_us;			/**< @brief Total time of the screen manager refreshes */
+	double maxScreenTime_us;		/**< @brief Maximum time of a screen manager refresh, including the loading of the screens */
+	double timerTime_us;			/**< @brief Total time of the LVGL timer handler */
+	double frameTime_us;			/**< @brief Total time of the LVGL timer handler in the periods with flushes */
+	double maxFrameTime_us;			/**< @brief Maximum time of the LVGL timer handler in a period */
+	double flushTime_us;			/**< @brief Total time taken by the flushes */
+	uint32_t lvMemSize;				/**< @brief Size of the LVGL heap (LV_MEM_SIZE) */
+	uint32_t lvMemMaxUsed;			/**< @brief Maximum use of the LVGL heap, sampled after the screen refreshes and the frames */
+} display_host_stats_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+/** @defgroup DisplayHost_Exported_Functions Functions
+ * @{
+ */
+/**
+ * @brief Initialize LVGL, register the host display and initialize the screens.
+ */
+extern void DisplayHost_Init(void);
+/**
+ * @brief Run the display task for a number of periods.
+ * @param periods No of periods of the display task.
+ */
+extern void DisplayHost_Run(uint32_t periods);
+/**
+ * @brief Get the timings of the display task.
+ * @param stats Structure to be filled with the timings.
+ */
+extern void DisplayHost_GetStats(display_host_stats_t* stats);
+/**
+ * @brief Reset the timings of the display task.
+ */
+extern void DisplayHost_ResetStats(void);
+/**
+ * @brief Set the state of the touch input, read by LVGL in the next periods of the display task.
+ * @param isPressed <c>true</c> if the screen is touched.
+ * @param x Horizontal coordinate of the touch as seen on the screen and in the dumped frames.
+ * @param y Vertical coordinate of the touch as seen on the screen and in the dumped frames.
+ */
+extern void DisplayHost_SetTouch(bool isPressed, int x, int y);
+/**
+ * @brief Log the timings of each flushed frame.
+ * @details A line <c>time_ms,frame_us,flush_us,areas,pixels</c> is written for each period of the display task with
+ * flushes, where <c>time_ms</c> is the virtual time of the period.
+ * @param file File receiving the log. Set to NULL to stop the log.
+ */
+extern void DisplayHost_SetFrameLog(FILE* file);
+/**
+ * @brief Write the frame buffer to an 8-bit BMP file with the CLUT of the display as its palette.
+ * @note The frame is written as seen on the screen, i.e. with the rotation of the display undone.
+ * @param path Path of the file.
+ * @return 0 if successful else -1.
+ */
+extern int DisplayHost_DumpFrame(const char* path);
+/**
+ * @brief Fill the statistics of the ADC channels with 50 Hz signals of slowly drifting amplitudes and some noise,
+ * and report all channels as updated as the ADC driver does.
+ * @note Call once in @ref DISPLAY_HOST_STATS_PERIOD_ms to emulate the ADC driver.
+ */
+extern void DisplayHost_UpdateSyntheticStats(void);
+/**
+ * @brief Fill the task telemetry with the tasks of the CM4 core, with slowly drifting loads and latencies, in the same
+ * sequence as the collector of the CM4 core. The peak latencies are reset on the requests of the screens.
+ * @note Call once in @ref TASK_TELEMETRY_PERIOD_ms to emulate the collector.
+ */
+extern void DisplayHost_UpdateSyntheticTelemetry(void);
+/**
+ * @brief Start an update of the shared P2P registers in place of the CM7 core.
+ * @return Pointer to the shared registers to be updated.
+ */
+extern p2p_data_buffs_t* DisplayHost_BeginDataUpdate(void);
+/**
+ * @brief End the update started with @ref DisplayHost_BeginDataUpdate(), so the screens see the updated registers.
+ * @param groups Mask of the updated data types (See @ref P2P_DATA_GROUP()).
+ */
+extern void DisplayHost_EndDataUpdate(uint32_t groups);
+/**
+ * @brief Get the monotonic time of the host.
+ * @return Time in micro-seconds.
+ */
+extern double DisplayHost_GetHostTime_us(void);
+/**
+ * @}
+ */
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+
+/**
+ * @}
+ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */
@@ -0,0 +1,174 @@
+/**
+ ********************************************************************************
+ * @file 		display_script.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Runs the screens on the PC with a scripted touch input
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "display_host.h"
+#include "screen_manager.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** Period of the synthetic updates of the shared P2P registers */
+#define P2P_UPDATE_PERIOD_ms		(100)
+/** Duration of the touch and of the release after it for the tap command */
+#define TAP_TIME_ms					(100)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static uint32_t time_ms = 0;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Update the shared registers as the control code of the CM7 core would.
+ */
+static void UpdateSyntheticP2P(void)
+{
+	p2p_data_buffs_t* data = DisplayHost_BeginDataUpdate();
+	data->floats[P2P_SAMPLE_FLOAT] = 50 + sinf(time_ms * 0.001f);
+	data->u32s[P2P_SAMPLE_U32] = time_ms / 1000;
+	data->bitAccess[P2P_SAMPLE_BIT_ACCESS] = (time_ms / 1000) & 3;
+	DisplayHost_EndDataUpdate(P2P_DATA_GROUP(DTYPE_FLOAT) | P2P_DATA_GROUP(DTYPE_U32) | P2P_DATA_GROUP(DTYPE_BIT_ACCESS));
+}
+
+/**
+ * @brief Run the display task with the synthetic data of the other cores for some time.
+ */
+static void Wait(uint32_t duration_ms)
+{
+	for (uint32_t end = time_ms + duration_ms; time_ms < end; time_ms += DISPLAY_HOST_TASK_PERIOD_ms)
+	{
+		if (time_ms % DISPLAY_HOST_STATS_PERIOD_ms == 0)
+			DisplayHost_UpdateSyntheticStats();
+		if (time_ms % P2P_UPDATE_PERIOD_ms == 0)
+			UpdateSyntheticP2P();
+		if (time_ms % TASK_TELEMETRY_PERIOD_ms == 0)
+			DisplayHost_UpdateSyntheticTelemetry();
+		DisplayHost_Run(1);
+	}
+}
+
+/**
+ * @brief Print the timings since the last report and reset them.
+ */
+static void Report(const char* label)
+{
+	display_host_stats_t stats;
+	screen_manager_stats_t screenStats;
+	DisplayHost_GetStats(&stats);
+	ScreenManager_GetStats(&screenStats);
+	uint32_t frames = stats.frameCount ? stats.frameCount : 1;
+	printf("%s: %u ms, %u frames, %.1f us/frame avg, %.1f us max, %.1f us flush/frame, %.0f pixels/frame, LVGL heap %u/%u bytes max used\n",
+			label, stats.periodCount * DISPLAY_HOST_TASK_PERIOD_ms, stats.frameCount, stats.frameTime_us / frames, stats.maxFrameTime_us,
+			stats.flushTime_us / frames, (double)stats.flushedPixels / frames, stats.lvMemMaxUsed, stats.lvMemSize);
+	printf("  screens: %.1f us max refresh, %u switches, %u ms last switch, %u bytes heap after the last load\n",
+			stats.maxScreenTime_us, screenStats.switchCount, screenStats.lastSwitchTime_ms, screenStats.lvMemUsed);
+	DisplayHost_ResetStats();
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		fprintf(stderr, "usage: %s script-file [frame-log.csv]\n", argv[0]);
+		return 1;
+	}
+	FILE* script = fopen(argv[1], "r");
+	if (script == NULL)
+	{
+		perror(argv[1]);
+		return 1;
+	}
+	FILE* log = NULL;
+	if (argc > 2 && (log = fopen(argv[2], "w")) == NULL)
+	{
+		perror(argv[2]);
+		return 1;
+	}
+
+	srand(1);
+	DisplayHost_Init();
+	DisplayHost_SetFrameLog(log);
+
+	char line[256];
+	int lineNo = 0;
+	int err = 0;
+	while (err == 0 && fgets(line, sizeof(line), script) != NULL)
+	{
+		lineNo++;
+		char cmd[32], arg[200];
+		int x, y;
+		unsigned duration;
+		if (sscanf(line, "%31s", cmd) != 1 || cmd[0] == '#')
+			continue;
+		if (strcmp(cmd, "wait") == 0 && sscanf(line, "%*s %u", &duration) == 1)
+			Wait(duration);
+		else if (strcmp(cmd, "press") == 0 && sscanf(line, "%*s %d %d", &x, &y) == 2)
+			DisplayHost_SetTouch(true, x, y);
+		else if (strcmp(cmd, "release") == 0)
+			DisplayHost_SetTouch(false, 0, 0);
+		else if (strcmp(cmd, "tap") == 0 && sscanf(line, "%*s %d %d", &x, &y) == 2)
+		{
+			DisplayHost_SetTouch(true, x, y);
+			Wait(TAP_TIME_ms);
+			DisplayHost_SetTouch(false, x, y);
+			Wait(TAP_TIME_ms);
+		}
+		else if (strcmp(cmd, "dump") == 0 && sscanf(line, "%*s %199s", arg) == 1)
+		{
+			if ((err = DisplayHost_DumpFrame(arg)) != 0)
+				perror(arg);
+		}
+		else if (strcmp(cmd, "report") == 0)
+			Report(sscanf(line, "%*s %199s", arg) == 1 ? arg : "report");
+		else
+		{
+			fprintf(stderr, "%s:%d: invalid command\n", argv[1], lineNo);
+			err = -1;
+		}
+	}
+
+	fclose(script);
+	if (log)
+		fclose(log);
+	return err ? 1 : 0;
+}
+
+/* EOF */
@@ -0,0 +1,45 @@
+/**
+ ********************************************************************************
+ * @file 		lv_conf.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    LVGL configuration of the application adapted to the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef DISPLAY_HOST_LV_CONF_H_
+#define DISPLAY_HOST_LV_CONF_H_
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+/* Configuration of the application, found after this folder in the include paths */
+#include_next "lv_conf.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+#ifndef DISPLAY_HOST_LV_MEM_SIZE
+/**
+ * @brief Size of the LVGL heap on the PC
+ * @details The LVGL objects hold many pointers, so they take more memory on a 64-bit PC than on the CM4. The heap
+ * is doubled, so the screens fitting in the heap of the CM4 also fit on the PC.
+ */
+#define DISPLAY_HOST_LV_MEM_SIZE		(2U * 64U * 1024U)
+#endif
+#undef LV_MEM_SIZE
+#define LV_MEM_SIZE						DISPLAY_HOST_LV_MEM_SIZE
+
+#endif
+/* EOF */
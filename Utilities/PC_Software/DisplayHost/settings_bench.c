@@ -0,0 +1,201 @@
+/**
+ ********************************************************************************
+ * @file 		settings_bench.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Measures the configuration screen with large numbers of synthetic settings
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "display_host.h"
+#include "screen_base.h"
+#include "lvgl.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** Maximum no of synthetic settings */
+#define MAX_SETTINGS				(1024)
+/** No of settings in each synthetic group */
+#define GROUP_SIZE					(64)
+/** Duration of the touch and of the release after it for a tap */
+#define TAP_TIME_ms					(100)
+/** Vertical distance of each drag on the parameter list */
+#define DRAG_DISTANCE				(250)
+/** Movement of the touch per period of the display task while dragging */
+#define DRAG_STEP					(10)
+/** No of drags on the first page of the settings */
+#define DRAG_COUNT					(12)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static float values[MAX_SETTINGS];
+static char names[MAX_SETTINGS][24];
+static data_param_info_t params[MAX_SETTINGS];
+static data_param_info_t* paramPointers[MAX_SETTINGS];
+static data_param_group_t groups[MAX_SETTINGS / GROUP_SIZE];
+static uint32_t getCount = 0;
+static uint32_t setCount = 0;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static device_err_t Synthetic_GetInText(data_param_info_t* paramInfo, char* value, bool addUnit)
+{
+	(void)addUnit;
+	getCount++;
+	if (paramInfo->type == DTYPE_BOOL)
+		strcpy(value, values[paramInfo->arg] != 0 ? "ON" : "OFF");
+	else
+		sprintf(value, "%.3f", values[paramInfo->arg]);
+	return ERR_OK;
+}
+
+static device_err_t Synthetic_SetFromText(data_param_info_t* paramInfo, const char* value)
+{
+	setCount++;
+	values[paramInfo->arg] = paramInfo->type == DTYPE_BOOL ? strcmp(value, "ON") == 0 : strtof(value, NULL);
+	return ERR_OK;
+}
+
+/**
+ * @brief Fill the synthetic settings in groups of @ref GROUP_SIZE, with every eighth setting a boolean.
+ * @return No of groups.
+ */
+static int CreateSettings(int count)
+{
+	static char titles[MAX_SETTINGS / GROUP_SIZE][24];
+	for (int i = 0; i < count; i++)
+	{
+		values[i] = i * 0.5f;
+		sprintf(names[i], "Parameter %d", i + 1);
+		params[i] = (data_param_info_t){ .type = (i % 8) == 7 ? DTYPE_BOOL : DTYPE_FLOAT, .arg = i, .name = names[i],
+			.Getter_InText = Synthetic_GetInText, .Setter_FromText = Synthetic_SetFromText };
+		paramPointers[i] = &params[i];
+	}
+	int groupCount = (count + GROUP_SIZE - 1) / GROUP_SIZE;
+	for (int i = 0; i < groupCount; i++)
+	{
+		sprintf(titles[i], "Synthetic %d", i + 1);
+		groups[i].title = titles[i];
+		groups[i].paramPointers = &paramPointers[i * GROUP_SIZE];
+		groups[i].paramCount = count - i * GROUP_SIZE < GROUP_SIZE ? count - i * GROUP_SIZE : GROUP_SIZE;
+	}
+	return groupCount;
+}
+
+static uint32_t GetLVGLHeapUsed(void)
+{
+	lv_mem_monitor_t mon;
+	lv_mem_monitor(&mon);
+	return mon.total_size - mon.free_size;
+}
+
+static void Tap(int x, int y)
+{
+	DisplayHost_SetTouch(true, x, y);
+	DisplayHost_Run(TAP_TIME_ms / DISPLAY_HOST_TASK_PERIOD_ms);
+	DisplayHost_SetTouch(false, x, y);
+	DisplayHost_Run(TAP_TIME_ms / DISPLAY_HOST_TASK_PERIOD_ms);
+}
+
+/**
+ * @brief Drag the parameter list upwards, scrolling it down.
+ */
+static void Drag(int x, int y)
+{
+	for (int d = 0; d <= DRAG_DISTANCE; d += DRAG_STEP)
+	{
+		DisplayHost_SetTouch(true, x, y - d);
+		DisplayHost_Run(1);
+	}
+	DisplayHost_SetTouch(false, x, y - DRAG_DISTANCE);
+	DisplayHost_Run(100);
+}
+
+static void Measure(int count, const char* dumpPath)
+{
+	int groupCount = CreateSettings(count);
+	// open the configuration screen with the settings of the application
+	Tap(35, 30);
+	DisplayHost_Run(200);
+
+	// replace the settings and render the first frame
+	DisplayHost_ResetStats();
+	getCount = setCount = 0;
+	double start = DisplayHost_GetHostTime_us();
+	ConfigScreen_LoadSettings(groups, groupCount);
+	double load_us = DisplayHost_GetHostTime_us() - start;
+	display_host_stats_t stats;
+	do
+	{
+		DisplayHost_Run(1);
+		DisplayHost_GetStats(&stats);
+	} while (stats.frameCount == 0);
+	double open_us = DisplayHost_GetHostTime_us() - start;
+	uint32_t openGets = getCount;
+	uint32_t openHeap = GetLVGLHeapUsed();
+
+	// scroll through the first page
+	DisplayHost_ResetStats();
+	for (int i = 0; i < DRAG_COUNT; i++)
+		Drag(220, 380);
+	DisplayHost_GetStats(&stats);
+	uint32_t scrollGets = getCount - openGets;
+	uint32_t frames = stats.frameCount ? stats.frameCount : 1;
+	if (dumpPath != NULL && DisplayHost_DumpFrame(dumpPath) != 0)
+		perror(dumpPath);
+
+	// accept the settings
+	Tap(115, 437);
+	DisplayHost_Run(400);
+
+	printf("%5d settings: %8.1f us load, %8.1f us open, %4u reads, LVGL heap %6u bytes after open, %6u bytes max while scrolling\n",
+			count, load_us, open_us, openGets, openHeap, stats.lvMemMaxUsed);
+	printf("               scrolling: %u frames, %.1f us/frame avg, %.1f us max, %u reads; %u settings applied\n",
+			stats.frameCount, stats.frameTime_us / frames, stats.maxFrameTime_us, scrollGets, setCount);
+}
+
+int main(int argc, char** argv)
+{
+	static const int counts[] = { 8, 64, 256, 1024 };
+	DisplayHost_Init();
+	// splash screen to the main screen
+	DisplayHost_Run(4000 / DISPLAY_HOST_TASK_PERIOD_ms);
+	for (unsigned i = 0; i < sizeof(counts) / sizeof(counts[0]); i++)
+		Measure(counts[i], i == 1 && argc > 1 ? argv[1] : NULL);
+	return 0;
+}
+
+/* EOF */
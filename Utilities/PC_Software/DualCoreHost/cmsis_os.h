@@ -0,0 +1,81 @@
+/**
+ ********************************************************************************
+ * @file 		cmsis_os.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    CMSIS-RTOS2 subset used by the firmware emulated on the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef CMSIS_OS_H_
+#define CMSIS_OS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup DualCoreHost_RTOS Host RTOS
+ * @brief Thread flags and delays of CMSIS-RTOS2 implemented with POSIX threads. The tick is 1 ms.
+ * @{
+ */
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdint.h>
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+#define osFlagsWaitAny				(0x00000000U)
+#define osWaitForever				(0xFFFFFFFFU)
+#define osFlagsError				(0x80000000U)
+#define osFlagsErrorTimeout			(0xFFFFFFFEU)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+typedef void* osThreadId_t;
+
+typedef enum
+{
+	osKernelInactive = 0,
+	osKernelReady = 1,
+	osKernelRunning = 2,
+} osKernelState_t;
+
+typedef enum
+{
+	osOK = 0,
+	osError = -1,
+} osStatus_t;
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+extern osKernelState_t osKernelGetState(void);
+extern osThreadId_t osThreadGetId(void);
+extern uint32_t osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags);
+extern uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout);
+extern osStatus_t osDelay(uint32_t ticks);
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+
+/**
+ * @}
+ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */
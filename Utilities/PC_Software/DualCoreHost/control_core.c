@@ -0,0 +1,104 @@
+/**
+ ********************************************************************************
+ * @file 		control_core.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    CM7 core process of the dual core emulation on the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <sched.h>
+#include <stdio.h>
+#include "dual_core_host.h"
+#include "shared_memory.h"
+#include "pecontroller_adc.h"
+#include "stm32h7xx_hal.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+#define HSEM_ID_0						(0U)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief The ADC is not emulated, so the processed data keeps the values of the map file.
+ */
+void BSP_ADC_SetDefaultParams(adc_processed_data_t* _processedAdcData, adc_raw_data_t* _rawAdcData)
+{
+}
+
+void BSP_ADC_RefreshData(void)
+{
+}
+
+/**
+ * @brief Runs the boot sequence and the main loop of the CM7 core until a core requests to stop.
+ * @details Yields when idle so that the emulation also works on a single host core.
+ */
+int main(int argc, char** argv)
+{
+	if (argc != 2)
+	{
+		fprintf(stderr, "usage: %s map-file\n", argv[0]);
+		return 1;
+	}
+	if (DualCoreHost_Attach(argv[1], false) != 0)
+	{
+		perror(argv[1]);
+		return 1;
+	}
+
+	// Same sequence as the CM7 main.c
+	SharedMemory_Init();
+	__HAL_RCC_HSEM_CLK_ENABLE();
+	HAL_HSEM_FastTake(HSEM_ID_0);
+	HAL_HSEM_Release(HSEM_ID_0, 0);
+	while (sharedData->isStateStorageInitialized == false && !DualCoreHost_IsStopRequested())
+		sched_yield();
+
+	while (!DualCoreHost_IsStopRequested())
+	{
+		if (RingBuffer_IsEmpty((ring_buffer_t*)&CORE_MSGS.msgsRingBuff))
+			sched_yield();
+		SharedMemory_Refresh();
+	}
+	DualCoreHost_Detach();
+	return 0;
+}
+
+/* EOF */
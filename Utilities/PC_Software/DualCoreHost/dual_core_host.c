@@ -0,0 +1,363 @@
+/**
+ ********************************************************************************
+ * @file 		dual_core_host.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Emulation of the dual core hardware shared by the CM7 and CM4 cores on the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "dual_core_host.h"
+#include "shared_memory.h"
+#include "stm32h7xx_hal.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE					(0x100000)
+#endif
+/**
+ * @brief Page of the system control space containing the system control block
+ */
+#define SCS_PAGE_SIZE						(0x1000)
+#if defined(CORE_CM7)
+#define CORE_CPUID							(0x411FC271UL)
+#define CORE_HSEM_IRQn						(HSEM1_IRQn)
+#define CORE_HSEM_IRQHandler				HSEM1_IRQHandler
+#else
+#define CORE_CPUID							(0x410FC241UL)
+#define CORE_HSEM_IRQn						(HSEM2_IRQn)
+#define CORE_HSEM_IRQHandler				HSEM2_IRQHandler
+#endif
+/**
+ * @brief Offsets of the regions inside the map file
+ */
+#define FILE_SRAM_OFFSET					(0)
+#define FILE_PERIPH_OFFSET					(FILE_SRAM_OFFSET + DUAL_CORE_HOST_SRAM_SIZE)
+#define FILE_CTRL_OFFSET					(FILE_PERIPH_OFFSET + DUAL_CORE_HOST_PERIPH_SIZE)
+#define FILE_SIZE							(FILE_CTRL_OFFSET + sizeof(host_ctrl_t))
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief Host state shared by both processes, placed after the emulated memories in the map file
+ */
+typedef struct
+{
+	pthread_mutex_t lock;				/**< @brief Protects the interrupt registers of the HSEM */
+	pthread_cond_t cond;				/**< @brief Signaled on every change of the interrupt registers */
+	volatile bool isStopRequested;		/**< @brief Requests both cores to stop */
+} host_ctrl_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static int mapFd = -1;
+static host_ctrl_t* ctrl = NULL;
+static pthread_t irqThread;
+/**
+ * @brief Emulates the disabled interrupts of the executing core
+ */
+static pthread_mutex_t irqLock = PTHREAD_MUTEX_INITIALIZER;
+static bool isIrqEnabled = false;
+static uint32_t interruptCount = 0;
+/**
+ * @brief Interrupt registers of the CM7 and CM4 cores
+ */
+static HSEM_Common_TypeDef* const irqLines[2] = { (HSEM_Common_TypeDef*)&HSEM->C1IER, (HSEM_Common_TypeDef*)&HSEM->C2IER };
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+/**
+ * @brief HSEM interrupt handler of the executing core, as placed in the vector table
+ */
+extern void CORE_HSEM_IRQHandler(void) __attribute__((weak));
+_Static_assert(sizeof(shared_data_t) <= DUAL_CORE_HOST_SRAM_SIZE, "Shared data doesn't fit in the D3 SRAM");
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Apply the write-one-to-clear registers and update the masked status of both cores.
+ * @note Call with the lock of the host state taken.
+ */
+static void UpdateInterrupts(void)
+{
+	for (int i = 0; i < 2; i++)
+	{
+		irqLines[i]->ISR &= ~irqLines[i]->ICR;
+		irqLines[i]->ICR = 0;
+		irqLines[i]->MISR = irqLines[i]->ISR & irqLines[i]->IER;
+	}
+	pthread_cond_broadcast(&ctrl->cond);
+}
+
+/**
+ * @brief Emulates the NVIC of the executing core for the HSEM interrupt.
+ */
+static void* InterruptThread(void* arg)
+{
+	pthread_mutex_lock(&ctrl->lock);
+	while (!ctrl->isStopRequested)
+	{
+		if (!isIrqEnabled || HSEM_COMMON->MISR == 0)
+		{
+			pthread_cond_wait(&ctrl->cond, &ctrl->lock);
+			continue;
+		}
+		pthread_mutex_unlock(&ctrl->lock);
+		__disable_irq();
+		CORE_HSEM_IRQHandler();
+		__enable_irq();
+		pthread_mutex_lock(&ctrl->lock);
+		UpdateInterrupts();
+		interruptCount++;
+	}
+	pthread_mutex_unlock(&ctrl->lock);
+	return NULL;
+}
+
+/**
+ * @brief Map a region at its target address.
+ * @return 0 if successful else -1 with errno set.
+ */
+static int MapRegion(uintptr_t addr, size_t size, int fd, off_t offset)
+{
+	int flags = MAP_FIXED_NOREPLACE | (fd < 0 ? MAP_PRIVATE | MAP_ANONYMOUS : MAP_SHARED);
+	void* map = mmap((void*)addr, size, PROT_READ | PROT_WRITE, flags, fd, offset);
+	if (map == MAP_FAILED)
+		return -1;
+	// Older kernels treat the address as a hint only
+	if (map != (void*)addr)
+	{
+		munmap(map, size);
+		errno = EEXIST;
+		return -1;
+	}
+	return 0;
+}
+
+static void InitCtrl(void)
+{
+	pthread_mutexattr_t mutexAttr;
+	pthread_mutexattr_init(&mutexAttr);
+	pthread_mutexattr_setpshared(&mutexAttr, PTHREAD_PROCESS_SHARED);
+	pthread_mutex_init(&ctrl->lock, &mutexAttr);
+	pthread_mutexattr_destroy(&mutexAttr);
+	pthread_condattr_t condAttr;
+	pthread_condattr_init(&condAttr);
+	pthread_condattr_setpshared(&condAttr, PTHREAD_PROCESS_SHARED);
+	pthread_cond_init(&ctrl->cond, &condAttr);
+	pthread_condattr_destroy(&condAttr);
+	ctrl->isStopRequested = false;
+}
+
+/**
+ * @brief Map the shared memory and the peripherals at their target addresses and start the interrupt thread.
+ * @details The process creating the map file should attach before starting the other core.
+ * @param path Path of the map file shared by both cores.
+ * @param isCreate <c>true</c> to create or reset the map file, else an existing file is attached.
+ * @return 0 if successful else -1 with errno set.
+ */
+int DualCoreHost_Attach(const char* path, bool isCreate)
+{
+	mapFd = open(path, isCreate ? O_RDWR | O_CREAT | O_TRUNC : O_RDWR, 0600);
+	if (mapFd < 0)
+		return -1;
+	if ((isCreate && ftruncate(mapFd, FILE_SIZE) != 0)
+			|| MapRegion(D3_SRAM_BASE, DUAL_CORE_HOST_SRAM_SIZE, mapFd, FILE_SRAM_OFFSET) != 0
+			|| MapRegion(DUAL_CORE_HOST_PERIPH_BASE, DUAL_CORE_HOST_PERIPH_SIZE, mapFd, FILE_PERIPH_OFFSET) != 0
+			|| MapRegion(SCS_BASE, SCS_PAGE_SIZE, -1, 0) != 0)
+		goto error;
+	ctrl = mmap(NULL, sizeof(host_ctrl_t), PROT_READ | PROT_WRITE, MAP_SHARED, mapFd, FILE_CTRL_OFFSET);
+	if (ctrl == MAP_FAILED)
+		goto error;
+	if (isCreate)
+		InitCtrl();
+	*(volatile uint32_t*)&SCB->CPUID = CORE_CPUID;
+	if (pthread_create(&irqThread, NULL, InterruptThread, NULL) != 0)
+		goto error;
+	return 0;
+error:
+	{
+		int err = errno;
+		close(mapFd);
+		mapFd = -1;
+		errno = err;
+	}
+	return -1;
+}
+
+/**
+ * @brief Request both cores to stop, wait for the interrupt thread and remove the mappings.
+ */
+void DualCoreHost_Detach(void)
+{
+	DualCoreHost_RequestStop();
+	pthread_join(irqThread, NULL);
+	munmap(ctrl, sizeof(host_ctrl_t));
+	munmap((void*)D3_SRAM_BASE, DUAL_CORE_HOST_SRAM_SIZE);
+	munmap((void*)DUAL_CORE_HOST_PERIPH_BASE, DUAL_CORE_HOST_PERIPH_SIZE);
+	munmap((void*)SCS_BASE, SCS_PAGE_SIZE);
+	close(mapFd);
+	mapFd = -1;
+}
+
+/**
+ * @brief Request both cores to stop.
+ */
+void DualCoreHost_RequestStop(void)
+{
+	pthread_mutex_lock(&ctrl->lock);
+	ctrl->isStopRequested = true;
+	pthread_cond_broadcast(&ctrl->cond);
+	pthread_mutex_unlock(&ctrl->lock);
+}
+
+/**
+ * @brief Check if a core has requested to stop.
+ * @return <c>true</c> if stop is requested.
+ */
+bool DualCoreHost_IsStopRequested(void)
+{
+	return ctrl->isStopRequested;
+}
+
+/**
+ * @brief Get the number of interrupts handled by the executing core.
+ * @return Number of HSEM interrupts handled since the attachment.
+ */
+uint32_t DualCoreHost_GetInterruptCount(void)
+{
+	return __atomic_load_n(&interruptCount, __ATOMIC_RELAXED);
+}
+
+/********************************************************************************
+ * Emulated HAL
+ *******************************************************************************/
+void __disable_irq(void)
+{
+	pthread_mutex_lock(&irqLock);
+}
+
+void __enable_irq(void)
+{
+	pthread_mutex_unlock(&irqLock);
+}
+
+/**
+ * @brief Lock the semaphore if it is free or already locked by the same process of this core.
+ */
+HAL_StatusTypeDef HAL_HSEM_Take(uint32_t SemID, uint32_t ProcessID)
+{
+	uint32_t value = HSEM_R_LOCK | HSEM_CR_COREID_CURRENT | ProcessID;
+	uint32_t expected = 0;
+	if (__atomic_compare_exchange_n((uint32_t*)&HSEM->R[SemID], &expected, value, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+		return HAL_OK;
+	return expected == value ? HAL_OK : HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_HSEM_FastTake(uint32_t SemID)
+{
+	return HAL_HSEM_Take(SemID, 0);
+}
+
+/**
+ * @brief Free the semaphore if locked by the same process of this core and raise the interrupt status of both cores.
+ */
+void HAL_HSEM_Release(uint32_t SemID, uint32_t ProcessID)
+{
+	uint32_t expected = HSEM_R_LOCK | HSEM_CR_COREID_CURRENT | ProcessID;
+	if (!__atomic_compare_exchange_n((uint32_t*)&HSEM->R[SemID], &expected, 0, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+		return;
+	pthread_mutex_lock(&ctrl->lock);
+	// Clears written before the release take effect first
+	UpdateInterrupts();
+	for (int i = 0; i < 2; i++)
+		irqLines[i]->ISR |= __HAL_HSEM_SEMID_TO_MASK(SemID);
+	UpdateInterrupts();
+	pthread_mutex_unlock(&ctrl->lock);
+}
+
+void HAL_HSEM_ActivateNotification(uint32_t SemMask)
+{
+	pthread_mutex_lock(&ctrl->lock);
+	HSEM_COMMON->IER |= SemMask;
+	UpdateInterrupts();
+	pthread_mutex_unlock(&ctrl->lock);
+}
+
+void HAL_HSEM_DeactivateNotification(uint32_t SemMask)
+{
+	pthread_mutex_lock(&ctrl->lock);
+	HSEM_COMMON->IER &= ~SemMask;
+	UpdateInterrupts();
+	pthread_mutex_unlock(&ctrl->lock);
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+	if (IRQn != CORE_HSEM_IRQn || CORE_HSEM_IRQHandler == NULL)
+		return;
+	pthread_mutex_lock(&ctrl->lock);
+	isIrqEnabled = true;
+	pthread_cond_broadcast(&ctrl->cond);
+	pthread_mutex_unlock(&ctrl->lock);
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+	if (IRQn != CORE_HSEM_IRQn)
+		return;
+	pthread_mutex_lock(&ctrl->lock);
+	isIrqEnabled = false;
+	pthread_mutex_unlock(&ctrl->lock);
+}
+
+void HAL_PWREx_ClearPendingEvent(void)
+{
+}
+
+/**
+ * @brief Sleep until an HSEM interrupt of this core is pending, as used by the boot sequence of the CM4 core.
+ */
+void HAL_PWREx_EnterSTOPMode(uint32_t Regulator, uint8_t STOPEntry, uint32_t Domain)
+{
+	pthread_mutex_lock(&ctrl->lock);
+	while (HSEM_COMMON->MISR == 0 && !ctrl->isStopRequested)
+		pthread_cond_wait(&ctrl->cond, &ctrl->lock);
+	pthread_mutex_unlock(&ctrl->lock);
+}
+
+/* EOF */
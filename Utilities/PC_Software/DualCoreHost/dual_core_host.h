@@ -0,0 +1,131 @@
+/**
+ ********************************************************************************
+ * @file 		dual_core_host.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Emulation of the dual core hardware shared by the CM7 and CM4 cores on the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef DUAL_CORE_HOST_H_
+#define DUAL_CORE_HOST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup Dual_Core_Host Dual Core Host
+ * @brief Runs each core of the firmware as a separate Linux process sharing the memory of the target.
+ * @details A map file shared by both processes is mapped at the target addresses of the D3 SRAM (@ref sharedData),
+ * and of the D3 peripherals containing the RCC and the hardware semaphores. The firmware sources are compiled
+ * unchanged with the HAL headers, so <b>HSEM_COMMON</b> and the HSEM macros access the registers inside the map file.
+ * The system control block is mapped privately to each process with the CPUID of the compiled core, which
+ * selects the interrupt registers of the executing core in the dual core HAL macros.
+ *
+ * Only the HAL functions used by the interprocessor communication are emulated.
+ * - Taking a semaphore is an atomic compare and swap of its lock register.
+ * - Releasing a semaphore sets the interrupt status of both cores and wakes up their interrupt threads.
+ * - The write-one-to-clear interrupt clear registers are applied after each interrupt handler and before each release.
+ * - Each process has an interrupt thread running the HSEM interrupt handler of its core, once enabled with
+ * <b>HAL_NVIC_EnableIRQ()</b>, while holding the lock taken by <b>__disable_irq()</b>.
+ * - <b>HAL_PWREx_EnterSTOPMode()</b> waits for a pending HSEM interrupt of the core, which is used by the boot sequence.
+ * @{
+ */
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** @defgroup DualCoreHost_Exported_Macros Macros
+ * @{
+ */
+/**
+ * @brief Size of the D3 SRAM mapped at <b>D3_SRAM_BASE</b>
+ */
+#define DUAL_CORE_HOST_SRAM_SIZE			(0x10000)
+/**
+ * @brief Base address of the mapped D3 peripherals, containing the RCC and the HSEM
+ */
+#define DUAL_CORE_HOST_PERIPH_BASE			(0x58020000UL)
+/**
+ * @brief Size of the mapped D3 peripherals
+ */
+#define DUAL_CORE_HOST_PERIPH_SIZE			(0x8000)
+/**
+ * @}
+ */
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+/** @defgroup DualCoreHost_Exported_Functions Functions
+ * @{
+ */
+/**
+ * @brief Map the shared memory and the peripherals at their target addresses and start the interrupt thread.
+ * @details The process creating the map file should attach before starting the other core.
+ * @param path Path of the map file shared by both cores.
+ * @param isCreate <c>true</c> to create or reset the map file, else an existing file is attached.
+ * @return 0 if successful else -1 with errno set.
+ */
+extern int DualCoreHost_Attach(const char* path, bool isCreate);
+/**
+ * @brief Request both cores to stop, wait for the interrupt thread and remove the mappings.
+ */
+extern void DualCoreHost_Detach(void);
+/**
+ * @brief Request both cores to stop.
+ */
+extern void DualCoreHost_RequestStop(void);
+/**
+ * @brief Check if a core has requested to stop.
+ * @return <c>true</c> if stop is requested.
+ */
+extern bool DualCoreHost_IsStopRequested(void);
+/**
+ * @brief Get the number of interrupts handled by the executing core.
+ * @return Number of HSEM interrupts handled since the attachment.
+ */
+extern uint32_t DualCoreHost_GetInterruptCount(void);
+/**
+ * @}
+ */
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+
+/**
+ * @}
+ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */
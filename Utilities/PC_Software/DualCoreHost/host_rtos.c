@@ -0,0 +1,136 @@
+/**
+ ********************************************************************************
+ * @file 		host_rtos.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    CMSIS-RTOS2 subset used by the firmware emulated on the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+#include "cmsis_os.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/**
+ * @brief Length of the RTOS tick in nano-seconds
+ */
+#define TICK_ns							(1000000ull)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief Emulated RTOS thread
+ */
+typedef struct
+{
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	uint32_t flags;
+} host_thread_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static __thread host_thread_t* currentThread = NULL;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static void AddTime_ns(struct timespec* ts, uint64_t ns)
+{
+	ns += ts->tv_nsec;
+	ts->tv_sec += ns / 1000000000ull;
+	ts->tv_nsec = ns % 1000000000ull;
+}
+
+static host_thread_t* GetThread(void)
+{
+	if (currentThread == NULL)
+	{
+		currentThread = calloc(1, sizeof(host_thread_t));
+		pthread_mutex_init(&currentThread->lock, NULL);
+		pthread_cond_init(&currentThread->cond, NULL);
+	}
+	return currentThread;
+}
+
+osKernelState_t osKernelGetState(void)
+{
+	return osKernelRunning;
+}
+
+osThreadId_t osThreadGetId(void)
+{
+	return GetThread();
+}
+
+uint32_t osThreadFlagsSet(osThreadId_t thread_id, uint32_t flags)
+{
+	host_thread_t* thread = (host_thread_t*)thread_id;
+	pthread_mutex_lock(&thread->lock);
+	thread->flags |= flags;
+	uint32_t result = thread->flags;
+	pthread_cond_signal(&thread->cond);
+	pthread_mutex_unlock(&thread->lock);
+	return result;
+}
+
+uint32_t osThreadFlagsWait(uint32_t flags, uint32_t options, uint32_t timeout)
+{
+	(void)options;
+	host_thread_t* thread = GetThread();
+	struct timespec deadline;
+	clock_gettime(CLOCK_REALTIME, &deadline);
+	AddTime_ns(&deadline, timeout * TICK_ns);
+
+	pthread_mutex_lock(&thread->lock);
+	while ((thread->flags & flags) == 0)
+	{
+		if (timeout != osWaitForever && pthread_cond_timedwait(&thread->cond, &thread->lock, &deadline) != 0)
+			break;
+		else if (timeout == osWaitForever)
+			pthread_cond_wait(&thread->cond, &thread->lock);
+	}
+	uint32_t result = thread->flags & flags;
+	thread->flags &= ~result;
+	pthread_mutex_unlock(&thread->lock);
+	return result ? result : osFlagsErrorTimeout;
+}
+
+osStatus_t osDelay(uint32_t ticks)
+{
+	struct timespec ts = { .tv_sec = 0, .tv_nsec = 0 };
+	AddTime_ns(&ts, ticks * TICK_ns);
+	nanosleep(&ts, NULL);
+	return osOK;
+}
+
+/* EOF */
@@ -0,0 +1,259 @@
+/**
+ ********************************************************************************
+ * @file 		flush_bench.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Compares the display flush kernels on the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "clut_data.h"
+#include "pecontroller_display_flush.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+#define WIDTH						(800)
+#define HEIGHT						(480)
+/** Same as LVGL_BUFF_SIZE of the display driver */
+#define BUFF_SIZE					((WIDTH * HEIGHT * 10) / 100)
+#define AREA_COUNT					(2000)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+typedef struct
+{
+	int x1, y1, x2, y2;
+} area_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static uint16_t frame[HEIGHT][WIDTH];
+static uint16_t buff[BUFF_SIZE];
+static uint8_t outOld[HEIGHT][WIDTH];
+static uint8_t outNew[HEIGHT][WIDTH];
+static area_t areas[AREA_COUNT];
+static int areaCount;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static double GetTime_us(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static uint16_t ToRGB565(uint32_t argb)
+{
+	return (uint16_t)((((argb >> 19) & 0x1F) << 11) | (((argb >> 10) & 0x3F) << 5) | ((argb >> 3) & 0x1F));
+}
+
+/**
+ * @brief Same as lv_color_mix() of LVGL for 16-bit colors.
+ */
+static uint16_t Mix(uint16_t c1, uint16_t c2, uint32_t mix)
+{
+	uint32_t r = (((c1 >> 11) * mix + (c2 >> 11) * (255 - mix) + 128) * 0x8081) >> 23;
+	uint32_t g = ((((c1 >> 5) & 0x3F) * mix + ((c2 >> 5) & 0x3F) * (255 - mix) + 128) * 0x8081) >> 23;
+	uint32_t b = (((c1 & 0x1F) * mix + (c2 & 0x1F) * (255 - mix) + 128) * 0x8081) >> 23;
+	return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+static uint16_t RandomThemeColor(void)
+{
+	return ToRGB565(clut_data[rand() % 256]);
+}
+
+/**
+ * @brief Render a frame resembling the screens, with flat widgets of the theme colors, anti-aliased text and gradients.
+ */
+static void RenderFrame(void)
+{
+	uint16_t bg = RandomThemeColor();
+	for (int y = 0; y < HEIGHT; y++)
+		for (int x = 0; x < WIDTH; x++)
+			frame[y][x] = bg;
+	for (int i = 0; i < 60; i++)
+	{
+		int w = 20 + rand() % 300, h = 10 + rand() % 120;
+		int x0 = rand() % (WIDTH - w), y0 = rand() % (HEIGHT - h);
+		uint16_t c = RandomThemeColor(), c2 = RandomThemeColor();
+		int kind = rand() % 3;
+		for (int y = y0; y < y0 + h; y++)
+			for (int x = x0; x < x0 + w; x++)
+			{
+				if (kind == 0)
+					frame[y][x] = c;
+				else if (kind == 1)
+					frame[y][x] = Mix(c, c2, ((x - x0) * 255) / w);
+				else
+				{
+					// text, mostly the background with anti-aliased glyph edges
+					int r = rand() % 8;
+					frame[y][x] = r < 5 ? frame[y][x] : (r < 7 ? Mix(c, frame[y][x], rand() % 256) : c);
+				}
+			}
+	}
+}
+
+/**
+ * @brief Flush of the display driver before the fused kernels, after the software rotation of LVGL.
+ */
+static void FlushOld(uint8_t* out, int x1, int y1, int x2, int y2, uint16_t* src)
+{
+	// draw_buf_rotate_180() of LVGL
+	uint32_t total = (x2 - x1 + 1) * (y2 - y1 + 1);
+	uint32_t i = total - 1, j = 0;
+	while (i > j)
+	{
+		uint16_t tmp = src[i];
+		src[i] = src[j];
+		src[j] = tmp;
+		i--;
+		j++;
+	}
+	int tmp = y2;
+	y2 = HEIGHT - y1 - 1;
+	y1 = HEIGHT - tmp - 1;
+	tmp = x2;
+	x2 = WIDTH - x1 - 1;
+	x1 = WIDTH - tmp - 1;
+	// FlushLVGLScreen()
+	for (int y = y1; y <= y2; y++)
+		for (int x = x1; x <= x2; x++)
+			out[y * WIDTH + x] = color_map[*src++];
+}
+
+static void FlushNew(uint8_t* out, int x1, int y1, int x2, int y2, uint16_t* src)
+{
+	DisplayFlush_ConvertArea(out, WIDTH, HEIGHT, x1, y1, x2, y2, src, color_map, true);
+}
+
+/**
+ * @brief Run a flush over all areas, copying each area to the draw buffer first as LVGL renders it there.
+ * @return Time taken by the flushes in micro-seconds, excluding the copies.
+ */
+static double RunAreas(void (*flush)(uint8_t*, int, int, int, int, uint16_t*), uint8_t* out)
+{
+	double total = 0;
+	for (int i = 0; i < areaCount; i++)
+	{
+		area_t* a = &areas[i];
+		int w = a->x2 - a->x1 + 1;
+		uint16_t* dst = buff;
+		for (int y = a->y1; y <= a->y2; y++, dst += w)
+			memcpy(dst, &frame[y][a->x1], w * 2);
+		double start = GetTime_us();
+		flush(out, a->x1, a->y1, a->x2, a->y2, buff);
+		total += GetTime_us() - start;
+	}
+	return total;
+}
+
+static void MakeFrameAreas(void)
+{
+	int rows = BUFF_SIZE / WIDTH;
+	areaCount = 0;
+	for (int y = 0; y < HEIGHT; y += rows)
+		areas[areaCount++] = (area_t){ 0, y, WIDTH - 1, (y + rows > HEIGHT ? HEIGHT : y + rows) - 1 };
+}
+
+static void MakeWidgetAreas(void)
+{
+	areaCount = AREA_COUNT;
+	for (int i = 0; i < areaCount; i++)
+	{
+		int w = 1 + rand() % 200, h = 1 + rand() % 60;
+		int x = rand() % (WIDTH - w + 1), y = rand() % (HEIGHT - h + 1);
+		areas[i] = (area_t){ x, y, x + w - 1, y + h - 1 };
+	}
+}
+
+static int CountPixels(void)
+{
+	int count = 0;
+	for (int i = 0; i < areaCount; i++)
+		count += (areas[i].x2 - areas[i].x1 + 1) * (areas[i].y2 - areas[i].y1 + 1);
+	return count;
+}
+
+/**
+ * @return No of mismatching pixels between the old and fused kernels.
+ */
+static long RunCase(const char* name, int frames)
+{
+	double tOld = 0, tNew = 0;
+	long mismatches = 0, pixels = 0;
+	for (int f = 0; f < frames; f++)
+	{
+		RenderFrame();
+		memset(outOld, 0, sizeof(outOld));
+		memset(outNew, 0, sizeof(outNew));
+		tOld += RunAreas(FlushOld, &outOld[0][0]);
+		tNew += RunAreas(FlushNew, &outNew[0][0]);
+		for (int y = 0; y < HEIGHT; y++)
+			for (int x = 0; x < WIDTH; x++)
+				if (outOld[y][x] != outNew[y][x])
+					mismatches++;
+		pixels += CountPixels();
+	}
+	double mpix = pixels / 1e6;
+	printf("%s: %d frames, %d areas/frame, %.1f Mpixels\n", name, frames, areaCount, mpix);
+	printf("  old (rotate + per-pixel): %8.3f ms/frame %7.1f Mpixel/s\n", tOld / frames / 1000, mpix / (tOld / 1e6));
+	printf("  fused word kernel:        %8.3f ms/frame %7.1f Mpixel/s (x%.2f)\n", tNew / frames / 1000, mpix / (tNew / 1e6), tOld / tNew);
+	printf("  fused vs old mismatches:  %ld\n", mismatches);
+	return mismatches;
+}
+
+int main(int argc, char** argv)
+{
+	int frames = argc > 1 ? atoi(argv[1]) : 50;
+	if (frames <= 0)
+	{
+		fprintf(stderr, "usage: %s [frames]\n", argv[0]);
+		return 1;
+	}
+	srand(1);
+
+	long mismatches = 0;
+	MakeFrameAreas();
+	mismatches += RunCase("full frame", frames);
+	MakeWidgetAreas();
+	mismatches += RunCase("widget areas", frames);
+	return mismatches ? 1 : 0;
+}
+
+/* EOF */
@@ -0,0 +1,148 @@
+/**
+ ********************************************************************************
+ * @file 		image_bench.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Measures the decoding of the compressed images and the image cache on the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "image_dictionary.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief An image of the dictionary with its name
+ */
+typedef struct
+{
+	const char* name;			/**< @brief Name of the image */
+	image_info_t* img;			/**< @brief Image information */
+} asset_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static asset_t assets[] =
+{
+		{ "taraz_logo", &taraz_logo_info },
+		{ "bsp_docs_QR", &bsp_docs_QR_info },
+		{ "intelliSENS_QR", &intelliSENS_QR_info },
+		{ "intelliSENS_logo", &intelliSENS_logo_info },
+};
+/** Images loaded by the screens of PEController_Template, starting with the splash screen */
+static image_info_t* const screenImages[] =
+{
+		&taraz_logo_info, &intelliSENS_logo_info, &bsp_docs_QR_info, &intelliSENS_logo_info,
+		&intelliSENS_QR_info, &intelliSENS_logo_info, &bsp_docs_QR_info, &intelliSENS_logo_info,
+};
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static double GetTime_us(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+int main(int argc, char** argv)
+{
+	int iterations = argc > 1 ? atoi(argv[1]) : 1000;
+	if (iterations <= 0)
+	{
+		fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+		return 1;
+	}
+
+	printf("%-18s %9s %9s %7s %12s %12s %10s\n", "image", "raw", "stored", "ratio", "decode", "copy", "decode");
+	uint32_t totalRaw = 0, totalStored = 0;
+	for (size_t i = 0; i < sizeof(assets) / sizeof(assets[0]); i++)
+	{
+		image_info_t* img = assets[i].img;
+		uint32_t size = img->width * img->height * Image_GetPixelSize(img->pixelFormat);
+		uint32_t stored = img->compression == IMAGE_UNCOMPRESSED ? size : img->dataSize;
+		uint8_t* buff = malloc(size);
+		uint8_t* copy = malloc(size);
+		if (Image_Decode(img, buff, size) != ERR_OK)
+		{
+			printf("%s: decoding failed\n", assets[i].name);
+			return 1;
+		}
+
+		double start = GetTime_us();
+		for (int j = 0; j < iterations; j++)
+			Image_Decode(img, buff, size);
+		double decode_us = (GetTime_us() - start) / iterations;
+		// copying the decoded pixels is the cost of an uncompressed image copied to the RAM
+		start = GetTime_us();
+		for (int j = 0; j < iterations; j++)
+		{
+			memcpy(copy, buff, size);
+			__asm__ volatile("" : : "r"(copy) : "memory");
+		}
+		double copy_us = (GetTime_us() - start) / iterations;
+
+		printf("%-18s %9u %9u %6.1f%% %9.1f us %9.1f us %6.0f MB/s\n", assets[i].name, size, stored,
+				100.0 * stored / size, decode_us, copy_us, size / decode_us);
+		totalRaw += size;
+		totalStored += stored;
+		free(buff);
+		free(copy);
+	}
+	printf("%-18s %9u %9u %6.1f%%\n", "total", totalRaw, totalStored, 100.0 * totalStored / totalRaw);
+
+	printf("\nimage cache of %u bytes and %u entries, loading the images of the screens:\n", IMAGE_CACHE_SIZE, IMAGE_CACHE_ENTRIES);
+	for (size_t i = 0; i < sizeof(screenImages) / sizeof(screenImages[0]); i++)
+	{
+		const char* name = "";
+		for (size_t j = 0; j < sizeof(assets) / sizeof(assets[0]); j++)
+		{
+			if (assets[j].img == screenImages[i])
+				name = assets[j].name;
+		}
+		double start = GetTime_us();
+		const uint8_t* pixels = Image_Load(screenImages[i]);
+		double load_us = GetTime_us() - start;
+		image_cache_stats_t stats;
+		Image_GetCacheStats(&stats);
+		printf("  %-18s %8.1f us %s, %u hits, %u misses, %u evictions, %u failures, %u bytes used\n", name, load_us,
+				pixels ? "loaded" : "failed", stats.hits, stats.misses, stats.evictions, stats.failures, stats.usedSize);
+	}
+	return 0;
+}
+
+/* EOF */
@@ -0,0 +1,239 @@
+/**
+ ********************************************************************************
+ * @file 		image_encoder.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Converts raw images to the compressed C arrays of the image dictionary
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "image_dictionary.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** Maximum pixels of a literal packet */
+#define MAX_LITERAL_COUNT			(128)
+/** Maximum pixels of a repeat or copy packet */
+#define MAX_REPEAT_COUNT			(65)
+/** Bytes per line of the generated array */
+#define BYTES_PER_LINE				(24)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief Pixel format supported by the encoder
+ */
+typedef struct
+{
+	const char* name;			/**< @brief Name in LTDC_PIXEL_FORMAT_<name> */
+	uint32_t pixelFormat;		/**< @brief LTDC_Pixelformat */
+} format_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static const format_t formats[] =
+{
+		{ "ARGB8888", LTDC_PIXEL_FORMAT_ARGB8888 },
+		{ "RGB888", LTDC_PIXEL_FORMAT_RGB888 },
+		{ "RGB565", LTDC_PIXEL_FORMAT_RGB565 },
+		{ "ARGB1555", LTDC_PIXEL_FORMAT_ARGB1555 },
+		{ "ARGB4444", LTDC_PIXEL_FORMAT_ARGB4444 },
+};
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Convert the BGRA pixels to the pixel format of the display.
+ * @param bgra Pixels with the blue, green, red and alpha bytes, as ARGB8888 in the memory of the CM4.
+ * @param count No of pixels.
+ * @param pixelFormat Target format (LTDC_Pixelformat).
+ * @param dst Destination of the converted pixels.
+ */
+static void ConvertPixels(const uint8_t* bgra, uint32_t count, uint32_t pixelFormat, uint8_t* dst)
+{
+	for (uint32_t i = 0; i < count; i++, bgra += 4)
+	{
+		uint32_t b = bgra[0], g = bgra[1], r = bgra[2], a = bgra[3];
+		uint16_t px16;
+		switch (pixelFormat)
+		{
+		case LTDC_PIXEL_FORMAT_ARGB8888:
+			memcpy(dst, bgra, 4);
+			dst += 4;
+			continue;
+		case LTDC_PIXEL_FORMAT_RGB888:
+			memcpy(dst, bgra, 3);
+			dst += 3;
+			continue;
+		case LTDC_PIXEL_FORMAT_RGB565:
+			px16 = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+			break;
+		case LTDC_PIXEL_FORMAT_ARGB1555:
+			px16 = ((a >> 7) << 15) | ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3);
+			break;
+		default:
+			px16 = ((a >> 4) << 12) | ((r >> 4) << 8) | ((g >> 4) << 4) | (b >> 4);
+			break;
+		}
+		memcpy(dst, &px16, 2);
+		dst += 2;
+	}
+}
+
+/**
+ * @brief Compress the pixels in the format of @ref IMAGE_COMPRESSED_RLE.
+ * @details The packets are selected greedily at each pixel: a copy of the row above if it covers at least as many
+ * pixels as a repeat, a repeat of at least two pixels, else a literal pixel.
+ * @param pixels Pixels of the image.
+ * @param width Image width.
+ * @param height Image height.
+ * @param pixelSize Size of a pixel in bytes.
+ * @param dst Destination of the compressed data, large enough for the worst case.
+ * @return Size of the compressed data.
+ */
+static uint32_t Compress(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t pixelSize, uint8_t* dst)
+{
+	uint32_t count = width * height;
+	uint8_t* start = dst;
+	uint8_t* literal = NULL;
+	for (uint32_t i = 0; i < count;)
+	{
+		const uint8_t* px = pixels + i * pixelSize;
+		uint32_t repeat = 1;
+		while (repeat < MAX_REPEAT_COUNT && i + repeat < count && memcmp(px, px + repeat * pixelSize, pixelSize) == 0)
+			repeat++;
+		uint32_t copy = 0;
+		if (i >= width)
+		{
+			while (copy < MAX_REPEAT_COUNT && i + copy < count
+					&& memcmp(px + copy * pixelSize, px + copy * pixelSize - width * pixelSize, pixelSize) == 0)
+				copy++;
+		}
+
+		if (copy >= 2 && copy + 1 >= repeat)
+		{
+			*dst++ = 0xC0 | (copy - 2);
+			i += copy;
+			literal = NULL;
+		}
+		else if (repeat >= 2)
+		{
+			*dst++ = 0x80 | (repeat - 2);
+			memcpy(dst, px, pixelSize);
+			dst += pixelSize;
+			i += repeat;
+			literal = NULL;
+		}
+		else
+		{
+			// extend the current literal packet or start a new one
+			if (literal == NULL || *literal == MAX_LITERAL_COUNT - 1)
+			{
+				literal = dst++;
+				*literal = 0;
+			}
+			else
+				(*literal)++;
+			memcpy(dst, px, pixelSize);
+			dst += pixelSize;
+			i++;
+		}
+	}
+	return dst - start;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 7)
+	{
+		fprintf(stderr, "usage: %s input.bgra width height format array-name info-name\n", argv[0]);
+		return 1;
+	}
+	uint32_t width = atoi(argv[2]);
+	uint32_t height = atoi(argv[3]);
+	const format_t* format = NULL;
+	for (size_t i = 0; i < sizeof(formats) / sizeof(formats[0]); i++)
+	{
+		if (strcmp(argv[4], formats[i].name) == 0)
+			format = &formats[i];
+	}
+	if (width == 0 || height == 0 || width > UINT16_MAX || height > UINT16_MAX || format == NULL)
+	{
+		fprintf(stderr, "invalid size or format, the formats are ARGB8888, RGB888, RGB565, ARGB1555 and ARGB4444\n");
+		return 1;
+	}
+
+	uint32_t count = width * height;
+	uint32_t pixelSize = Image_GetPixelSize(format->pixelFormat);
+	uint8_t* bgra = malloc(count * 4);
+	uint8_t* pixels = malloc(count * pixelSize);
+	// a literal packet per 128 pixels in the worst case
+	uint8_t* data = malloc(count * pixelSize + count / MAX_LITERAL_COUNT + 1);
+	uint8_t* decoded = malloc(count * pixelSize);
+	FILE* in = fopen(argv[1], "rb");
+	if (in == NULL)
+	{
+		perror(argv[1]);
+		return 1;
+	}
+	if (fread(bgra, 4, count, in) != count)
+	{
+		fprintf(stderr, "%s: less than %u pixels\n", argv[1], count);
+		return 1;
+	}
+	fclose(in);
+
+	ConvertPixels(bgra, count, format->pixelFormat, pixels);
+	uint32_t dataSize = Compress(pixels, width, height, pixelSize, data);
+
+	// check the compressed data with the decoder of the firmware
+	image_info_t img = { .width = width, .height = height, .pixelFormat = format->pixelFormat, .data = data,
+			.compression = IMAGE_COMPRESSED_RLE, .dataSize = dataSize };
+	if (Image_Decode(&img, decoded, count * pixelSize) != ERR_OK || memcmp(decoded, pixels, count * pixelSize) != 0)
+	{
+		fprintf(stderr, "the decoded image differs from the input\n");
+		return 1;
+	}
+
+	printf("// array size is %u, compressed from %u\n", dataSize, count * pixelSize);
+	printf("static const uint8_t %s[] __attribute__((section(\".SystemImages\"))) = {", argv[5]);
+	for (uint32_t i = 0; i < dataSize; i++)
+		printf("%s0x%02x,", i % BYTES_PER_LINE ? " " : "\n\t\t", data[i]);
+	printf("\n\t\t};\n");
+	printf("image_info_t %s = { .width = %u, .height = %u, .pixelFormat = LTDC_PIXEL_FORMAT_%s, .data = %s,"
+			" .compression = IMAGE_COMPRESSED_RLE, .dataSize = sizeof(%s) };\n",
+			argv[6], width, height, format->name, argv[5], argv[5]);
+	fprintf(stderr, "%s: %u bytes compressed to %u (%.1f%%)\n", argv[5], count * pixelSize, dataSize, 100.0 * dataSize / (count * pixelSize));
+	return 0;
+}
+
+/* EOF */
@@ -0,0 +1,445 @@
+/**
+ ********************************************************************************
+ * @file 		modbus_client.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Checks the register map of the Modbus server and measures its request rate
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include "modbus_server.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** Maximum no of connections and of requests in flight on each connection */
+#define MAX_CONNECTIONS				(8)
+#define MAX_DEPTH					(64)
+/** Size of the MBAP header, including the unit identifier */
+#define MBAP_HEADER_SIZE			(7)
+/** No of parameters checked with -v, which are the parameters of PEController_Template before the control state */
+#define CHECKED_PARAMS				(8)
+/** Parameter of PEController_Template holding a float */
+#define FLOAT_PARAM					(9)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief Connection measuring the request rate
+ */
+typedef struct
+{
+	int sock;
+	uint16_t nextId;
+	uint16_t expectedId;
+	int inFlight;
+	double sendTime[MAX_DEPTH];
+	uint8_t rxBuffer[4 * MODBUS_MAX_ADU_SIZE];
+	int rxLen;
+} connection_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static connection_t connections[MAX_CONNECTIONS];
+static double* latencies;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static double GetTime_us(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e6 + ts.tv_nsec * 1e-3;
+}
+
+static inline uint16_t GetU16(const uint8_t* data)
+{
+	return ((uint16_t)data[0] << 8) | data[1];
+}
+
+static inline void PutU16(uint8_t* data, uint16_t value)
+{
+	data[0] = value >> 8;
+	data[1] = value & 0xFF;
+}
+
+static int Connect(const char* ip)
+{
+	struct sockaddr_in device = { .sin_family = AF_INET, .sin_port = htons(MODBUS_SERVER_PORT) };
+	inet_pton(AF_INET, ip, &device.sin_addr);
+	int sock = socket(AF_INET, SOCK_STREAM, 0);
+	int flag = 1;
+	setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+	if (connect(sock, (struct sockaddr*)&device, sizeof(device)) != 0)
+	{
+		perror(ip);
+		close(sock);
+		return -1;
+	}
+	return sock;
+}
+
+/**
+ * @brief Build a request with its MBAP header.
+ * @return Length of the request.
+ */
+static int BuildRequest(uint8_t* adu, uint16_t id, const uint8_t* pdu, int len)
+{
+	PutU16(&adu[0], id);
+	PutU16(&adu[2], 0);
+	PutU16(&adu[4], len + 1);
+	adu[6] = 1;
+	memcpy(adu + MBAP_HEADER_SIZE, pdu, len);
+	return MBAP_HEADER_SIZE + len;
+}
+
+/**
+ * @brief Send a request and wait for its response.
+ * @return Length of the response without the MBAP header, -1 on a connection error.
+ */
+static int Transact(int sock, const uint8_t* pdu, int len, uint8_t* response)
+{
+	static uint16_t id = 0x8000;
+	uint8_t adu[MODBUS_MAX_ADU_SIZE];
+	int aduLen = BuildRequest(adu, ++id, pdu, len);
+	if (send(sock, adu, aduLen, 0) != aduLen)
+		return -1;
+	int received = 0;
+	while (received < MBAP_HEADER_SIZE || received < MBAP_HEADER_SIZE - 1 + GetU16(&adu[4]))
+	{
+		int n = recv(sock, adu + received, sizeof(adu) - received, 0);
+		if (n <= 0)
+			return -1;
+		received += n;
+	}
+	if (GetU16(&adu[0]) != id)
+		return -1;
+	memcpy(response, adu + MBAP_HEADER_SIZE, received - MBAP_HEADER_SIZE);
+	return received - MBAP_HEADER_SIZE;
+}
+
+static int ReadRegisters(int sock, uint8_t function, uint16_t address, uint16_t count, uint16_t* values)
+{
+	uint8_t pdu[5] = { function }, response[MODBUS_MAX_PDU_SIZE];
+	PutU16(&pdu[1], address);
+	PutU16(&pdu[3], count);
+	int len = Transact(sock, pdu, sizeof(pdu), response);
+	if (len != 2 + count * 2 || response[0] != function)
+		return len > 1 && response[0] == (function | 0x80) ? response[1] : -1;
+	for (int i = 0; i < count; i++)
+		values[i] = GetU16(&response[2 + i * 2]);
+	return 0;
+}
+
+static int WriteRegisters(int sock, uint16_t address, uint16_t count, const uint16_t* values)
+{
+	uint8_t pdu[MODBUS_MAX_PDU_SIZE] = { 16 }, response[MODBUS_MAX_PDU_SIZE];
+	PutU16(&pdu[1], address);
+	PutU16(&pdu[3], count);
+	pdu[5] = count * 2;
+	for (int i = 0; i < count; i++)
+		PutU16(&pdu[6 + i * 2], values[i]);
+	int len = Transact(sock, pdu, 6 + count * 2, response);
+	if (len != 5 || response[0] != 16)
+		return len > 1 && response[0] == (16 | 0x80) ? response[1] : -1;
+	return 0;
+}
+
+static int WriteRegister(int sock, uint16_t address, uint16_t value)
+{
+	uint8_t pdu[5] = { 6 }, response[MODBUS_MAX_PDU_SIZE];
+	PutU16(&pdu[1], address);
+	PutU16(&pdu[3], value);
+	int len = Transact(sock, pdu, sizeof(pdu), response);
+	if (len != 5 || memcmp(pdu, response, 5) != 0)
+		return len > 1 && response[0] == (6 | 0x80) ? response[1] : -1;
+	return 0;
+}
+
+static void SetParam(uint16_t* regs, int param, uint32_t value)
+{
+	regs[param * 2] = value >> 16;
+	regs[param * 2 + 1] = value & 0xFFFF;
+}
+
+static uint32_t GetParam(const uint16_t* regs, int param)
+{
+	return ((uint32_t)regs[param * 2] << 16) | regs[param * 2 + 1];
+}
+
+static int Check(bool condition, const char* name)
+{
+	printf("%-60s %s\n", name, condition ? "ok" : "FAILED");
+	return condition ? 0 : 1;
+}
+
+/**
+ * @brief Check the register map against the parameters of PEController_Template and the synthetic statistics of
+ * modbus_host.
+ * @return No of failed checks.
+ */
+static int VerifyMap(int sock)
+{
+	int failures = 0;
+	uint16_t inputs[MODBUS_FS_REGISTER + 2];
+	// more than the 125 registers of a read
+	int half = MODBUS_FS_REGISTER / 2;
+	bool isMatching = ReadRegisters(sock, 4, 0, half, inputs) == 0 &&
+			ReadRegisters(sock, 4, half, MODBUS_FS_REGISTER + 2 - half, inputs + half) == 0;
+	for (int ch = 0; ch < MODBUS_ADC_CHANNEL_COUNT && isMatching; ch++)
+	{
+		for (int i = 0; i < MODBUS_STAT_COUNT; i++)
+		{
+			uint32_t bits = GetParam(inputs, ch * MODBUS_STAT_COUNT + i);
+			float value;
+			memcpy(&value, &bits, sizeof(value));
+			isMatching &= value == ch * 10 + i;
+		}
+	}
+	uint32_t fsBits = GetParam(inputs, MODBUS_FS_REGISTER / 2);
+	float fs;
+	memcpy(&fs, &fsBits, sizeof(fs));
+	failures += Check(isMatching && fs == 40000, "input registers hold the statistics and the sampling rate");
+
+	// u8, u16, u32, s8, s16, s32 and two status bits in one transaction
+	uint16_t written[CHECKED_PARAMS * 2], read[CHECKED_PARAMS * 2];
+	SetParam(written, 0, 200);
+	SetParam(written, 1, 60000);
+	SetParam(written, 2, 0xDEADBEEF);
+	SetParam(written, 3, (uint32_t)-100);
+	SetParam(written, 4, (uint32_t)-30000);
+	SetParam(written, 5, (uint32_t)-123456789);
+	SetParam(written, 6, 1);
+	SetParam(written, 7, 0);
+	failures += Check(WriteRegisters(sock, 0, CHECKED_PARAMS * 2, written) == 0, "write multiple registers");
+	failures += Check(ReadRegisters(sock, 3, 0, CHECKED_PARAMS * 2, read) == 0 &&
+			memcmp(written, read, sizeof(read)) == 0, "holding registers read back the written values");
+
+	// half of a parameter
+	failures += Check(WriteRegister(sock, 5, 0x1234) == 0, "write single register");
+	failures += Check(ReadRegisters(sock, 3, 4, 2, read) == 0 && GetParam(read, 0) == 0xDEAD1234,
+			"the other half of the parameter is kept");
+
+	// exceptions, and no parameter written by a rejected request
+	uint8_t pdu[5] = { 0x2B }, response[MODBUS_MAX_PDU_SIZE];
+	failures += Check(Transact(sock, pdu, 1, response) == 2 && response[0] == 0xAB && response[1] == 1,
+			"unknown function code gives illegal function");
+	failures += Check(ReadRegisters(sock, 3, MODBUS_PARAM_REGISTER(10), 2, read) == 2,
+			"reading beyond the parameters gives illegal data address");
+	failures += Check(ReadRegisters(sock, 4, MODBUS_FS_REGISTER + 1, 2, read) == 2,
+			"reading beyond the statistics gives illegal data address");
+	SetParam(written, 0, 256);
+	SetParam(written, 1, 5);
+	failures += Check(WriteRegisters(sock, 0, 4, written) == 3, "out of range value gives illegal data value");
+	failures += Check(ReadRegisters(sock, 3, 0, 4, read) == 0 && GetParam(read, 0) == 200 && GetParam(read, 1) == 60000,
+			"a rejected write changes no parameter");
+
+	// non-finite floats
+	float f = 1.5f;
+	uint32_t fBits;
+	memcpy(&fBits, &f, sizeof(fBits));
+	SetParam(written, 0, fBits);
+	failures += Check(WriteRegisters(sock, MODBUS_PARAM_REGISTER(FLOAT_PARAM), 2, written) == 0, "write a float");
+	SetParam(written, 0, 0x7FC00000);
+	failures += Check(WriteRegisters(sock, MODBUS_PARAM_REGISTER(FLOAT_PARAM), 2, written) == 3,
+			"NaN gives illegal data value");
+	SetParam(written, 0, 0xFF800000);
+	failures += Check(WriteRegisters(sock, MODBUS_PARAM_REGISTER(FLOAT_PARAM), 2, written) == 3,
+			"infinity gives illegal data value");
+	failures += Check(ReadRegisters(sock, 3, MODBUS_PARAM_REGISTER(FLOAT_PARAM), 2, read) == 0 && GetParam(read, 0) == fBits,
+			"a rejected float keeps the parameter");
+	return failures;
+}
+
+static int CompareLatency(const void* a, const void* b)
+{
+	double x = *(const double*)a, y = *(const double*)b;
+	return x < y ? -1 : x > y;
+}
+
+static void PrintUsage(const char* name)
+{
+	printf("usage: %s device-ip [-f read|input|write] [-a address] [-r registers] [-n requests] [-q depth] "
+			"[-c connections] [-v]\n", name);
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		PrintUsage(argv[0]);
+		return 1;
+	}
+	const char* ip = argv[1];
+	uint8_t function = 3;
+	uint16_t address = 0, count = 2;
+	int requests = 20000, depth = 1, connectionCount = 1;
+	bool isVerify = false;
+	for (int i = 2; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+		{
+			i++;
+			function = strcmp(argv[i], "input") == 0 ? 4 : (strcmp(argv[i], "write") == 0 ? 16 : 3);
+		}
+		else if (strcmp(argv[i], "-a") == 0 && i + 1 < argc)
+			address = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+			count = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+			requests = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-q") == 0 && i + 1 < argc)
+			depth = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+			connectionCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-v") == 0)
+			isVerify = true;
+		else
+		{
+			PrintUsage(argv[0]);
+			return 1;
+		}
+	}
+	if (depth < 1 || depth > MAX_DEPTH || connectionCount < 1 || connectionCount > MAX_CONNECTIONS || count < 1 ||
+			count > 123 || requests < 1)
+	{
+		PrintUsage(argv[0]);
+		return 1;
+	}
+
+	for (int i = 0; i < connectionCount; i++)
+	{
+		connections[i].sock = Connect(ip);
+		if (connections[i].sock < 0)
+			return 1;
+	}
+	int failures = isVerify ? VerifyMap(connections[0].sock) : 0;
+
+	// the writes repeat the current values, so they work with any parameter types
+	uint8_t pdu[MODBUS_MAX_PDU_SIZE] = { function };
+	int pduLen = 5;
+	PutU16(&pdu[1], address);
+	PutU16(&pdu[3], count);
+	if (function == 16)
+	{
+		uint16_t values[123];
+		if (ReadRegisters(connections[0].sock, 3, address, count, values) != 0)
+		{
+			printf("reading the registers to be written failed\n");
+			return 1;
+		}
+		pdu[5] = count * 2;
+		for (int i = 0; i < count; i++)
+			PutU16(&pdu[6 + i * 2], values[i]);
+		pduLen = 6 + count * 2;
+	}
+
+	latencies = calloc(requests, sizeof(double));
+	int sent = 0, completed = 0, exceptions = 0, errors = 0;
+	double start = GetTime_us();
+	while (completed < requests && errors == 0)
+	{
+		struct pollfd fds[MAX_CONNECTIONS];
+		for (int i = 0; i < connectionCount; i++)
+		{
+			connection_t* conn = &connections[i];
+			for (; conn->inFlight < depth && sent < requests; conn->inFlight++, sent++)
+			{
+				uint8_t adu[MODBUS_MAX_ADU_SIZE];
+				int len = BuildRequest(adu, conn->nextId, pdu, pduLen);
+				conn->sendTime[conn->nextId++ % MAX_DEPTH] = GetTime_us();
+				if (send(conn->sock, adu, len, 0) != len)
+					errors++;
+			}
+			fds[i] = (struct pollfd){ .fd = conn->sock, .events = POLLIN };
+		}
+		if (poll(fds, connectionCount, 1000) <= 0)
+		{
+			printf("no response\n");
+			errors++;
+			break;
+		}
+		for (int i = 0; i < connectionCount; i++)
+		{
+			connection_t* conn = &connections[i];
+			if (!(fds[i].revents & POLLIN))
+				continue;
+			int n = recv(conn->sock, conn->rxBuffer + conn->rxLen, sizeof(conn->rxBuffer) - conn->rxLen, 0);
+			if (n <= 0)
+			{
+				errors++;
+				break;
+			}
+			conn->rxLen += n;
+			double now = GetTime_us();
+			// the responses of a connection come in the order of the requests
+			while (conn->rxLen >= MBAP_HEADER_SIZE && conn->rxLen >= MBAP_HEADER_SIZE - 1 + GetU16(&conn->rxBuffer[4]))
+			{
+				int len = MBAP_HEADER_SIZE - 1 + GetU16(&conn->rxBuffer[4]);
+				if (GetU16(conn->rxBuffer) != conn->expectedId)
+					errors++;
+				if (conn->rxBuffer[MBAP_HEADER_SIZE] & 0x80)
+					exceptions++;
+				latencies[completed++] = now - conn->sendTime[conn->expectedId++ % MAX_DEPTH];
+				conn->inFlight--;
+				conn->rxLen -= len;
+				memmove(conn->rxBuffer, conn->rxBuffer + len, conn->rxLen);
+			}
+		}
+	}
+	double duration = (GetTime_us() - start) * 1e-6;
+	for (int i = 0; i < connectionCount; i++)
+		close(connections[i].sock);
+
+	qsort(latencies, completed, sizeof(double), CompareLatency);
+	double sum = 0;
+	for (int i = 0; i < completed; i++)
+		sum += latencies[i];
+	printf("%d requests of %u registers, %d connections with %d in flight each\n", completed, count, connectionCount,
+			depth);
+	printf("rate: %.0f requests/s, %.0f registers/s\n", completed / duration, completed * count / duration);
+	if (completed)
+		printf("latency [us]: %.0f avg, %.0f p50, %.0f p99, %.0f max\n", sum / completed, latencies[completed / 2],
+				latencies[completed * 99 / 100], latencies[completed - 1]);
+	printf("%d exceptions, %d errors\n", exceptions, errors);
+	free(latencies);
+	return (failures || exceptions || errors) ? 1 : 0;
+}
+
+/* EOF */
@@ -0,0 +1,205 @@
+/**
+ ********************************************************************************
+ * @file 		modbus_host.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Runs the Modbus server on the emulated CM4 core with LwIP on a TAP device
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <signal.h>
+#include <spawn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include "dual_core_host.h"
+#include "shared_memory.h"
+#include "stm32h7xx_hal.h"
+#include "modbus_server.h"
+#include "tapif_host.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+#define HSEM_ID_0						(0U)
+/**
+ * @brief Default paths of the CM7 core executable and of the map file shared with it
+ */
+#define DEFAULT_CONTROL_CORE			"./control_core"
+#define DEFAULT_MAP_FILE				"modbus_host.map"
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static volatile sig_atomic_t isStopRequested = 0;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+const char* unitTxts[UNIT_COUNT] = {"V", "A", "W", "Hz"};
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+extern char** environ;
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static double GetTime_us(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e6 + ts.tv_nsec * 1e-3;
+}
+
+static void Stop_Requested(int signal)
+{
+	isStopRequested = 1;
+}
+
+/**
+ * @brief Wake the loop of LwIP when a write completes, as tcpip_try_callback() does on target.
+ */
+void ModbusMap_WriteCompletedCallback(void)
+{
+	TapIf_Wake();
+}
+
+/**
+ * @brief Start the CM7 core process and run the boot sequence of the CM4 core.
+ * @return 0 if successful else -1.
+ */
+static int BootCores(const char* controlCore, const char* mapFile, pid_t* pid)
+{
+	if (DualCoreHost_Attach(mapFile, true) != 0)
+	{
+		perror(mapFile);
+		return -1;
+	}
+	char* args[] = { (char*)controlCore, (char*)mapFile, NULL };
+	int err = posix_spawn(pid, controlCore, NULL, NULL, args, environ);
+	if (err != 0)
+	{
+		fprintf(stderr, "%s: %s\n", controlCore, strerror(err));
+		return -1;
+	}
+
+	// Same sequence as the CM4 main.c, without the state storage
+	SharedMemory_Init();
+	__HAL_RCC_HSEM_CLK_ENABLE();
+	HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(HSEM_ID_0));
+	HAL_PWREx_ClearPendingEvent();
+	HAL_PWREx_EnterSTOPMode(PWR_MAINREGULATOR_ON, PWR_STOPENTRY_WFE, PWR_D2_DOMAIN);
+	__HAL_HSEM_CLEAR_FLAG(__HAL_HSEM_SEMID_TO_MASK(HSEM_ID_0));
+	sharedData->isStateStorageInitialized = true;
+	P2PComms_InitDoorbell();
+	return 0;
+}
+
+/**
+ * @brief Fill the ADC statistics with synthetic values, (channel * 10 + statistic) for each statistic of a channel.
+ */
+static void FillStats(void)
+{
+	for (int ch = 0; ch < TOTAL_MEASUREMENT_COUNT; ch++)
+	{
+		float* stats = (float*)&ADC_INFO.stats[ch];
+		for (int i = 0; i < MODBUS_STAT_COUNT; i++)
+			stats[i] = ch * 10 + i;
+	}
+	ADC_INFO.fs = 40000;
+}
+
+static void PrintUsage(const char* name)
+{
+	printf("usage: %s [-t tap-device] [-s seconds] [-c control-core] [-m map-file]\n", name);
+}
+
+int main(int argc, char** argv)
+{
+	const char* tapName = "tap0";
+	int duration_s = 0;
+	const char* controlCore = DEFAULT_CONTROL_CORE;
+	const char* mapFile = DEFAULT_MAP_FILE;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+			tapName = argv[++i];
+		else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+			duration_s = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+			controlCore = argv[++i];
+		else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc)
+			mapFile = argv[++i];
+		else
+		{
+			PrintUsage(argv[0]);
+			return 1;
+		}
+	}
+
+	pid_t pid;
+	if (BootCores(controlCore, mapFile, &pid) != 0)
+		return 1;
+	int result = 0;
+	FillStats();
+	if (!TapIf_Init(tapName) || !ModbusServer_Init(0))
+	{
+		fprintf(stderr, "server initialization failed\n");
+		result = 1;
+		goto exit;
+	}
+	signal(SIGINT, Stop_Requested);
+	signal(SIGTERM, Stop_Requested);
+	printf("serving %d parameters on %s at %s:%d\n", P2P_PARAM_COUNT, tapName, TAPIF_HOST_IP, MODBUS_SERVER_PORT);
+
+	double start = GetTime_us();
+	while (!isStopRequested && (duration_s == 0 || GetTime_us() - start < duration_s * 1e6))
+	{
+		TapIf_Process(MODBUS_SERVER_PERIOD_ms * 1000);
+		// the completed writes are responded without waiting for the timer
+		ModbusServer_Poll();
+	}
+
+	modbus_stats_t stats;
+	tapif_stats_t netStats;
+	ModbusServer_GetStats(&stats);
+	TapIf_GetStats(&netStats);
+	uint32_t requests = stats.requests ? stats.requests : 1;
+	printf("connections: %u accepted, %u rejected, %u closed for invalid frames\n", stats.connections,
+			stats.rejectedConnections, stats.frameErrors);
+	printf("requests: %u, %u exceptions, %u registers read, %u registers written\n", stats.requests, stats.exceptions,
+			stats.readRegisters, stats.writtenRegisters);
+	printf("p2p: %u transactions, %u snapshot refreshes\n", stats.transactions, stats.snapshots);
+	printf("cpu: %.2f us/request in LwIP and the server, %.2f us/request writing to the TAP device\n",
+			netStats.stackTime_ns * 1e-3 / requests, netStats.txTime_ns * 1e-3 / requests);
+exit:
+	DualCoreHost_Detach();
+	waitpid(pid, NULL, 0);
+	return result;
+}
+
+/* EOF */
@@ -0,0 +1,431 @@
+/**
+ ********************************************************************************
+ * @file 		p2p_bench.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    CM4 core process benchmarking the P2P communication with the dual core emulation on the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <inttypes.h>
+#include <sched.h>
+#include <spawn.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include "cmsis_os.h"
+#include "dual_core_host.h"
+#include "shared_memory.h"
+#include "stm32h7xx_hal.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+#define HSEM_ID_0						(0U)
+/**
+ * @brief Default number of round trips measured for each case
+ */
+#define DEFAULT_ROUNDS					(2000)
+/**
+ * @brief Number of rounds for the polled single messages, which take at least a tick each
+ */
+#define LEGACY_ROUNDS					(50)
+/**
+ * @brief Default number of registers changed in each round
+ */
+#define DEFAULT_REGISTERS				(8)
+/**
+ * @brief Default paths of the CM7 core executable and of the map file shared with it
+ */
+#define DEFAULT_CONTROL_CORE			"./control_core"
+#define DEFAULT_MAP_FILE				"p2p_bench.map"
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief Latency statistics of a benchmark case
+ */
+typedef struct
+{
+	uint64_t* samples;
+	int count;
+} bench_stats_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+/**
+ * @brief Transactions kept in flight by the async case
+ */
+static p2p_txn_item_t asyncItems[P2P_COMMS_MSGS_SIZE][P2P_COMMS_TXN_MAX_ITEMS];
+static p2p_txn_t asyncTxns[P2P_COMMS_MSGS_SIZE];
+static atomic_uint asyncCompleted = 0;
+static atomic_uint asyncErrors = 0;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+const char* unitTxts[UNIT_COUNT] = {"V", "A", "W", "Hz"};
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+extern char** environ;
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static inline uint64_t GetTime_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/**
+ * @brief Start the CM7 core process and run the boot sequence of the CM4 core.
+ * @return 0 if successful else -1.
+ */
+static int BootCores(const char* controlCore, const char* mapFile, pid_t* pid)
+{
+	if (DualCoreHost_Attach(mapFile, true) != 0)
+	{
+		perror(mapFile);
+		return -1;
+	}
+	char* args[] = { (char*)controlCore, (char*)mapFile, NULL };
+	int err = posix_spawn(pid, controlCore, NULL, NULL, args, environ);
+	if (err != 0)
+	{
+		fprintf(stderr, "%s: %s\n", controlCore, strerror(err));
+		return -1;
+	}
+
+	// Same sequence as the CM4 main.c, without the state storage
+	SharedMemory_Init();
+	__HAL_RCC_HSEM_CLK_ENABLE();
+	HAL_HSEM_ActivateNotification(__HAL_HSEM_SEMID_TO_MASK(HSEM_ID_0));
+	HAL_PWREx_ClearPendingEvent();
+	HAL_PWREx_EnterSTOPMode(PWR_MAINREGULATOR_ON, PWR_STOPENTRY_WFE, PWR_D2_DOMAIN);
+	__HAL_HSEM_CLEAR_FLAG(__HAL_HSEM_SEMID_TO_MASK(HSEM_ID_0));
+	sharedData->isStateStorageInitialized = true;
+	P2PComms_InitDoorbell();
+	return 0;
+}
+
+/********************************************************************************
+ * Benchmark
+ *******************************************************************************/
+/**
+ * @brief Single message posted and polled every tick as done before the transactions.
+ */
+static device_err_t PolledSingleUpdate(p2p_msg_type_t type, uint8_t index, data_union_t value)
+{
+	__disable_irq();
+	volatile p2p_msg_t* msg = &CORE_MSGS.msgs[CORE_MSGS.msgsRingBuff.wrIndex];
+	msg->type = type;
+	msg->firstReg = index;
+	msg->cmdIndex = CORE_MSGS.cmdsRingBuff.wrIndex;
+	CORE_MSGS.cmds[msg->cmdIndex] = value;
+	msg->cmdLen = 1;
+	msg->responseIndex = msg->responseLen = -1;
+	RingBuffer_Write((ring_buffer_t*)&CORE_MSGS.cmdsRingBuff);
+	__DMB();
+	RingBuffer_Write((ring_buffer_t*)&CORE_MSGS.msgsRingBuff);
+	__enable_irq();
+
+	int temp = -1;
+	while (temp == -1)
+	{
+		osDelay(1);
+		temp = msg->responseIndex;
+	}
+	return (device_err_t)CORE_MSGS.response[temp].u8;
+}
+
+/**
+ * @brief Fill the items writing the registers of all types in turn.
+ */
+static void FillItems(p2p_txn_item_t* items, int count, int round)
+{
+	static const p2p_msg_type_t types[] = { MSG_SET_U8, MSG_SET_U16, MSG_SET_U32, MSG_SET_S8, MSG_SET_S16, MSG_SET_S32, MSG_SET_FLOAT };
+	for (int i = 0; i < count; i++)
+	{
+		items[i].type = types[i % (sizeof(types) / sizeof(types[0]))];
+		items[i].index = 0;
+		items[i].value.u32 = 0;
+		if (items[i].type == MSG_SET_FLOAT)
+			items[i].value.f = round + i * 0.5f;
+		else
+			items[i].value.u8 = (uint8_t)(round + i);
+	}
+}
+
+static int CompareU64(const void* a, const void* b)
+{
+	uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+	return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+static void PrintStats(const char* name, bench_stats_t* stats, int registers)
+{
+	qsort(stats->samples, stats->count, sizeof(uint64_t), CompareU64);
+	uint64_t sum = 0;
+	for (int i = 0; i < stats->count; i++)
+		sum += stats->samples[i];
+	double avg = (double)sum / stats->count;
+	printf("%-28s %8.1f %8.1f %8.1f %8.1f %10.2f\n", name, avg / 1000, stats->samples[stats->count / 2] / 1000.,
+			stats->samples[(stats->count * 99) / 100] / 1000., stats->samples[stats->count - 1] / 1000., avg / 1000 / registers);
+}
+
+/**
+ * @brief Check the transaction against the shared registers.
+ * @return <c>true</c> if the responses match the expectations.
+ */
+static bool VerifyTransactions(void)
+{
+	bool isValid = true;
+	p2p_txn_item_t items[6] =
+	{
+			{ .type = MSG_SET_FLOAT, .index = 0, .value.f = 12.5f },
+			{ .type = MSG_GET_FLOAT, .index = 0 },
+			{ .type = MSG_SET_BITS, .index = 0, .value.bits = 0x5 },
+			{ .type = MSG_TOGGLE_BITS, .index = 0, .value.bits = 0x3 },
+			{ .type = MSG_GET_U32, .index = P2P_U32_COUNT },
+			{ .type = MSG_GET_BOOL, .index = 0 },
+	};
+	INTER_CORE_DATA.bitAccess[0] = 0;
+	static p2p_data_snapshot_t snapshot = {0};
+	isValid &= P2PComms_TakeSnapshot(&snapshot) == P2P_DATA_GROUP_ALL;
+	isValid &= P2PComms_TakeSnapshot(&snapshot) == 0;
+
+	p2p_txn_t txn = { .items = items, .count = 6 };
+	device_err_t err = P2PComms_Transaction_Blocking(&txn);
+	isValid &= err == ERR_ILLEGAL && txn.isComplete;
+	isValid &= items[0].err == ERR_OK && items[1].err == ERR_OK && items[1].value.f == 12.5f;
+	isValid &= INTER_CORE_DATA.bitAccess[0] == 0x6;
+	isValid &= items[4].err == ERR_ILLEGAL && items[5].err == ERR_OK;
+
+	// Only the updated data types are reported and copied
+	isValid &= P2PComms_TakeSnapshot(&snapshot) == (P2P_DATA_GROUP(DTYPE_FLOAT) | P2P_DATA_GROUP(DTYPE_BIT_ACCESS));
+	isValid &= snapshot.data.floats[0] == 12.5f && snapshot.data.bitAccess[0] == 0x6;
+
+	p2p_txn_t nested = { .items = items, .count = 1 };
+	items[0].type = MSG_TRANSACTION;
+	isValid &= P2PComms_Transaction_Blocking(&nested) == ERR_ILLEGAL;
+	p2p_txn_t tooLarge = { .items = items, .count = P2P_COMMS_TXN_MAX_ITEMS + 1 };
+	isValid &= P2PComms_Transaction_Blocking(&tooLarge) == ERR_ILLEGAL;
+	return isValid;
+}
+
+/**
+ * @brief Compare the value of a register with the written value using the width of its type.
+ */
+static bool IsSameValue(p2p_msg_type_t type, data_union_t a, data_union_t b)
+{
+	switch (type)
+	{
+	case MSG_SET_U8:
+	case MSG_SET_S8:
+		return a.u8 == b.u8;
+	case MSG_SET_U16:
+	case MSG_SET_S16:
+		return a.u16 == b.u16;
+	case MSG_SET_FLOAT:
+		return a.f == b.f;
+	default:
+		return a.u32 == b.u32;
+	}
+}
+
+/**
+ * @brief Read back the registers written by the items from the CM7 core.
+ * @return <c>true</c> if each register holds the value of its last write.
+ */
+static bool VerifyRegisters(const p2p_txn_item_t* items, int count)
+{
+	p2p_txn_item_t reads[P2P_COMMS_TXN_MAX_ITEMS];
+	for (int i = 0; i < count; i++)
+		reads[i] = (p2p_txn_item_t){ .type = items[i].type + MSG_GET_BOOL, .index = items[i].index };
+	p2p_txn_t txn = { .items = reads, .count = count };
+	if (P2PComms_Transaction_Blocking(&txn) != ERR_OK)
+		return false;
+	for (int i = 0; i < count; i++)
+	{
+		bool isOverwritten = false;
+		for (int j = i + 1; j < count; j++)
+			isOverwritten |= items[j].type == items[i].type && items[j].index == items[i].index;
+		if (!isOverwritten && !IsSameValue(items[i].type, reads[i].value, items[i].value))
+			return false;
+	}
+	return true;
+}
+
+/**
+ * @brief Check that the transactions complete in the order of posting with all items accepted.
+ */
+static void AsyncCallback(p2p_txn_t* txn)
+{
+	bool isValid = txn == &asyncTxns[atomic_load(&asyncCompleted) % P2P_COMMS_MSGS_SIZE];
+	for (int i = 0; i < txn->count; i++)
+		isValid &= txn->items[i].err == ERR_OK;
+	if (!isValid)
+		atomic_fetch_add(&asyncErrors, 1);
+	atomic_fetch_add(&asyncCompleted, 1);
+}
+
+static void PrintUsage(const char* name)
+{
+	fprintf(stderr, "usage: %s [-n rounds] [-r registers] [-l] [-c control-core] [-m map-file]\n"
+			"  -n  round trips measured for each case (default %d)\n"
+			"  -r  registers changed in each round, 1-%d (default %d)\n"
+			"  -l  also measure the single messages polled every tick\n"
+			"  -c  executable of the CM7 core (default %s)\n"
+			"  -m  map file shared by the cores (default %s)\n", name, DEFAULT_ROUNDS, P2P_COMMS_TXN_MAX_ITEMS, DEFAULT_REGISTERS,
+			DEFAULT_CONTROL_CORE, DEFAULT_MAP_FILE);
+}
+
+int main(int argc, char** argv)
+{
+	int rounds = DEFAULT_ROUNDS;
+	int registers = DEFAULT_REGISTERS;
+	bool measurePolled = false;
+	const char* controlCore = DEFAULT_CONTROL_CORE;
+	const char* mapFile = DEFAULT_MAP_FILE;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+			rounds = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+			registers = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-l") == 0)
+			measurePolled = true;
+		else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+			controlCore = argv[++i];
+		else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc)
+			mapFile = argv[++i];
+		else
+		{
+			PrintUsage(argv[0]);
+			return 1;
+		}
+	}
+	if (rounds < 1 || registers < 1 || registers > P2P_COMMS_TXN_MAX_ITEMS)
+	{
+		PrintUsage(argv[0]);
+		return 1;
+	}
+
+	pid_t pid;
+	if (BootCores(controlCore, mapFile, &pid) != 0)
+		return 1;
+	int result = 0;
+	if (!VerifyTransactions())
+	{
+		fprintf(stderr, "Transaction responses don't match the shared registers\n");
+		result = 1;
+		goto exit;
+	}
+
+	bench_stats_t stats = { .samples = calloc(rounds * registers, sizeof(uint64_t)) };
+	p2p_txn_item_t items[P2P_COMMS_TXN_MAX_ITEMS];
+	printf("Registers per round: %d\n", registers);
+	printf("%-28s %8s %8s %8s %8s %10s\n", "Case [us]", "avg", "p50", "p99", "max", "avg/reg");
+
+	if (measurePolled)
+	{
+		stats.count = 0;
+		for (int r = 0; r < LEGACY_ROUNDS; r++)
+		{
+			FillItems(items, registers, r);
+			uint64_t start = GetTime_ns();
+			for (int i = 0; i < registers; i++)
+				PolledSingleUpdate(items[i].type, items[i].index, items[i].value);
+			stats.samples[stats.count++] = GetTime_ns() - start;
+		}
+		PrintStats("Single messages, polled", &stats, registers);
+	}
+
+	stats.count = 0;
+	for (int r = 0; r < rounds; r++)
+	{
+		FillItems(items, registers, r);
+		uint64_t start = GetTime_ns();
+		for (int i = 0; i < registers; i++)
+			P2PComms_SingleUpdateRequest_Blocking(items[i].type, items[i].index, items[i].value);
+		stats.samples[stats.count++] = GetTime_ns() - start;
+	}
+	PrintStats("Single messages, doorbell", &stats, registers);
+
+	stats.count = 0;
+	for (int r = 0; r < rounds; r++)
+	{
+		FillItems(items, registers, r);
+		p2p_txn_t txn = { .items = items, .count = registers };
+		uint64_t start = GetTime_ns();
+		P2PComms_Transaction_Blocking(&txn);
+		stats.samples[stats.count++] = GetTime_ns() - start;
+	}
+	PrintStats("Transaction, blocking", &stats, registers);
+
+	// Keep the message buffers full and measure the completion rate
+	unsigned posted = 0;
+	unsigned doorbells = DualCoreHost_GetInterruptCount();
+	uint64_t start = GetTime_ns();
+	while (posted < (unsigned)rounds)
+	{
+		// Transactions complete in order so the entry is free once its previous use is completed
+		p2p_txn_t* txn = &asyncTxns[posted % P2P_COMMS_MSGS_SIZE];
+		if (posted >= P2P_COMMS_MSGS_SIZE && atomic_load(&asyncCompleted) <= posted - P2P_COMMS_MSGS_SIZE)
+		{
+			sched_yield();
+			continue;
+		}
+		FillItems(asyncItems[posted % P2P_COMMS_MSGS_SIZE], registers, posted);
+		*txn = (p2p_txn_t){ .items = asyncItems[posted % P2P_COMMS_MSGS_SIZE], .count = registers, .Callback = AsyncCallback };
+		if (P2PComms_Transaction_Async(txn) == ERR_OK)
+			posted++;
+		else
+			sched_yield();
+	}
+	while (atomic_load(&asyncCompleted) < posted)
+		sched_yield();
+	double asyncTime = (GetTime_ns() - start) / 1000.;
+	printf("%-28s %8.1f us per transaction, %u doorbells for %u transactions\n", "Transaction, async", asyncTime / rounds,
+			DualCoreHost_GetInterruptCount() - doorbells, posted);
+	free(stats.samples);
+
+	if (atomic_load(&asyncErrors) != 0)
+	{
+		fprintf(stderr, "%u async transactions completed out of order or failed\n", atomic_load(&asyncErrors));
+		result = 1;
+	}
+	else if (!VerifyRegisters(asyncItems[(posted - 1) % P2P_COMMS_MSGS_SIZE], registers))
+	{
+		fprintf(stderr, "Shared registers don't match the last async transaction\n");
+		result = 1;
+	}
+exit:
+	DualCoreHost_Detach();
+	waitpid(pid, NULL, 0);
+	return result;
+}
+
+/* EOF */
@@ -0,0 +1,236 @@
+/**
+ ********************************************************************************
+ * @file 		protection_bench.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Checks and measures the protection comparators of the ADC channels on the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "pecontroller_adc_protection.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+#define CH_COUNT					(ADC_PROTECTION_CHANNEL_COUNT)
+/** No of samples cycled by the benchmark, large enough to defeat the branch history of the PC */
+#define SAMPLE_COUNT				(8192)
+#define RANDOM_TEST_COUNT			(1000000)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+typedef uint32_t (*trip_fnc_t)(const float* data, const adc_protection_limits_t* limits);
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static float samples[SAMPLE_COUNT][CH_COUNT];
+static adc_protection_limits_t limits;
+static int failCount = 0;
+static volatile uint32_t sink;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static double GetTime_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static float Random(float min, float max)
+{
+	return min + (max - min) * (rand() / (float)RAND_MAX);
+}
+
+/**
+ * @brief Branchless kernel of the conversion interrupt.
+ */
+static __attribute__((noinline)) uint32_t GetTripsBranchless(const float* data, const adc_protection_limits_t* limits)
+{
+	return ADCProtection_GetTrips(data, limits);
+}
+
+/**
+ * @brief Reference with a branch for each comparison, as the scattered checks of the applications.
+ */
+static __attribute__((noinline)) uint32_t GetTripsBranchy(const float* data, const adc_protection_limits_t* limits)
+{
+	uint32_t trips = 0;
+	for (int i = 0; i < CH_COUNT; i++)
+	{
+		if (data[i] > limits->upper[i])
+			trips |= 1U << i;
+		else if (data[i] < limits->lower[i])
+			trips |= 1U << i;
+		__asm__ volatile("" ::: "memory");
+	}
+	return trips;
+}
+
+static void Check(const char* name, uint32_t result, uint32_t expected)
+{
+	if (result == expected)
+		return;
+	printf("FAIL %s: trips 0x%04x expected 0x%04x\n", name, result, expected);
+	failCount++;
+}
+
+/**
+ * @brief Check the limits of each channel separately and the disabled limits.
+ */
+static void TestEdges(void)
+{
+	float data[CH_COUNT];
+	ADCProtection_ResetLimits(&limits);
+	for (int i = 0; i < CH_COUNT; i++)
+		data[i] = 1e30f * ((i & 1) ? -1 : 1);
+	Check("disabled limits", GetTripsBranchless(data, &limits), 0);
+	for (int i = 0; i < CH_COUNT; i++)
+	{
+		limits.lower[i] = -10.f - i;
+		limits.upper[i] = 10.f + i;
+		data[i] = 0;
+	}
+	Check("inside limits", GetTripsBranchless(data, &limits), 0);
+	for (int ch = 0; ch < CH_COUNT; ch++)
+	{
+		data[ch] = limits.upper[ch];
+		Check("equal to upper", GetTripsBranchless(data, &limits), 0);
+		data[ch] = limits.lower[ch];
+		Check("equal to lower", GetTripsBranchless(data, &limits), 0);
+		data[ch] = limits.upper[ch] + .001f;
+		Check("above upper", GetTripsBranchless(data, &limits), 1U << ch);
+		data[ch] = limits.lower[ch] - .001f;
+		Check("below lower", GetTripsBranchless(data, &limits), 1U << ch);
+		data[ch] = 0;
+	}
+	for (int i = 0; i < CH_COUNT; i++)
+		data[i] = (i & 1) ? 100.f : -100.f;
+	Check("all channels", GetTripsBranchless(data, &limits), 0xFFFF);
+}
+
+/**
+ * @brief Fill the samples with values crossing the limits with the given probability per channel.
+ */
+static void FillSamples(float tripProbability)
+{
+	for (int i = 0; i < CH_COUNT; i++)
+	{
+		limits.lower[i] = -100.f;
+		limits.upper[i] = 100.f;
+	}
+	for (int s = 0; s < SAMPLE_COUNT; s++)
+	{
+		for (int i = 0; i < CH_COUNT; i++)
+		{
+			bool isTrip = rand() < tripProbability * RAND_MAX;
+			float value = Random(-99.f, 99.f);
+			samples[s][i] = isTrip ? (value < 0 ? value - 100.f : value + 100.f) : value;
+		}
+	}
+}
+
+/**
+ * @brief Compare against the reference for random limits, some of them disabled, and random data.
+ */
+static void TestRandom(void)
+{
+	float data[CH_COUNT];
+	for (int n = 0; n < RANDOM_TEST_COUNT; n++)
+	{
+		for (int i = 0; i < CH_COUNT; i++)
+		{
+			float a = Random(-1000.f, 1000.f), b = Random(-1000.f, 1000.f);
+			limits.lower[i] = (rand() & 7) == 0 ? ADC_PROTECTION_NO_LOWER_LIMIT : (a < b ? a : b);
+			limits.upper[i] = (rand() & 7) == 0 ? ADC_PROTECTION_NO_UPPER_LIMIT : (a < b ? b : a);
+			// hit the limits exactly in some cases
+			int r = rand() & 15;
+			data[i] = r == 0 ? limits.lower[i] : r == 1 ? limits.upper[i] : Random(-1200.f, 1200.f);
+		}
+		uint32_t expected = GetTripsBranchy(data, &limits);
+		uint32_t result = GetTripsBranchless(data, &limits);
+		if (result != expected)
+		{
+			Check("random", result, expected);
+			if (failCount > 10)
+				return;
+		}
+	}
+}
+
+/**
+ * @brief Time a kernel over the samples.
+ * @return Time per sample in nano-seconds.
+ */
+static double Measure(trip_fnc_t fnc, int passes)
+{
+	uint32_t acc = 0;
+	// warm up
+	for (int s = 0; s < SAMPLE_COUNT; s++)
+		acc += fnc(samples[s], &limits);
+	double start = GetTime_ns();
+	for (int p = 0; p < passes; p++)
+		for (int s = 0; s < SAMPLE_COUNT; s++)
+			acc += fnc(samples[s], &limits);
+	double elapsed = GetTime_ns() - start;
+	sink = acc;
+	return elapsed / ((double)passes * SAMPLE_COUNT);
+}
+
+int main(int argc, char** argv)
+{
+	int passes = argc > 1 ? atoi(argv[1]) : 200;
+	if (passes <= 0)
+		passes = 1;
+	srand(1);
+
+	TestEdges();
+	TestRandom();
+	printf("Correctness: %s (%d random samples against the branch reference)\n", failCount ? "FAILED" : "passed", RANDOM_TEST_COUNT);
+
+	static const float probabilities[] = { 0, .001f, .01f, .1f, .5f };
+	printf("Cost per sample of %d channels, %d passes of %d samples:\n", CH_COUNT, passes, SAMPLE_COUNT);
+	printf("  trip probability  branchless  branch per channel\n");
+	for (unsigned i = 0; i < sizeof(probabilities) / sizeof(probabilities[0]); i++)
+	{
+		FillSamples(probabilities[i]);
+		double branchless = Measure(GetTripsBranchless, passes);
+		double branchy = Measure(GetTripsBranchy, passes);
+		printf("  %15.1f%%  %7.2f ns  %12.2f ns (x%.2f)\n", probabilities[i] * 100, branchless, branchy, branchy / branchless);
+	}
+	return failCount ? 1 : 0;
+}
+
+/* EOF */
@@ -0,0 +1,295 @@
+/**
+ ********************************************************************************
+ * @file    	bsp_mock.c
+ * @author 		Waqas Ehsan Butt
+ * @date    	Oct 18, 2026
+ *
+ * @brief   Recording replacements of the BSP drivers used by the control applications
+ ********************************************************************************
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include "replay_harness.h"
+#include "pecontroller_pwm.h"
+#include "pecontroller_digital_in.h"
+#include "pecontroller_digital_out.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** @defgroup BSP_Mock BSP Mock
+ * @brief Replaces the hardware drivers with implementations recording the requested outputs.
+ * @details Duty cycles are clipped to the configured limits in the same way as the drivers.
+ * Dead time compensation and timer quantization are not modeled.
+ * @{
+ */
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+/**
+ * @brief Shared memory placed in the host memory instead of SRAM4
+ */
+static shared_data_t hostSharedData;
+/**
+ * @brief Returned for all the pin configuration requests
+ */
+static const digital_pin_t mockPin = {0};
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+volatile shared_data_t * const sharedData = &hostSharedData;
+bsp_mock_t bspMock;
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Reset the state of the mocked BSP drivers.
+ */
+void BSPMock_Reset(void)
+{
+	memset(&bspMock, 0, sizeof(bspMock));
+	memset(&hostSharedData, 0, sizeof(hostSharedData));
+	ADCProtection_ResetLimits(&bspMock.protectionLimits);
+}
+
+/**
+ * @brief Compare a sample against the protection limits before the ADC callback, as the conversion interrupt.
+ * @param measures Sample passed to the ADC callback.
+ */
+void BSPMock_CheckProtection(const adc_measures_t* measures)
+{
+	if (!bspMock.isProtectionEnabled)
+		return;
+	uint32_t trips = ADCProtection_GetTrips((const float*)measures, &bspMock.protectionLimits);
+	if (trips == 0)
+		return;
+	BSP_PWMOut_DisableFromISR(bspMock.protectionPwmMask);
+	bspMock.protectionStats.tripCount++;
+	uint32_t newTrips = trips & ~bspMock.protectionStats.tripMask;
+	if (newTrips == 0)
+		return;
+	bspMock.protectionStats.tripMask |= newTrips;
+	BSP_ADC_ProtectionTrippedCallback(newTrips);
+}
+
+void Error_Handler(void)
+{
+	fprintf(stderr, "Error_Handler() called by the application\n");
+	abort();
+}
+
+/**
+ * @brief Apply the duty cycle limits in the same way as the PWM drivers.
+ */
+static float ApplyDuty(uint32_t pwmNo, float duty, pwm_config_t* config)
+{
+	float min = 0, max = 1;
+	if (config && config->lim.max > config->lim.min)
+	{
+		min = config->lim.min;
+		max = config->lim.max;
+	}
+	if (duty > max)
+		duty = max;
+	else if (duty < min)
+		duty = min;
+	if (pwmNo >= 1 && pwmNo <= MOCK_PWM_COUNT)
+		bspMock.duty[pwmNo - 1] = duty;
+	return duty;
+}
+
+float BSP_PWM_UpdatePairDuty(uint32_t pwmNo, float duty, pwm_config_t* config)
+{
+	return ApplyDuty(pwmNo, duty, config);
+}
+
+float BSP_PWM_UpdateChannelDuty(uint32_t pwmNo, float duty, pwm_config_t* config)
+{
+	return ApplyDuty(pwmNo, duty, config);
+}
+
+DutyCycleUpdateFnc BSP_PWM_ConfigInvertedPair(uint16_t pwmNo, pwm_config_t *config)
+{
+	if (pwmNo < 1 || pwmNo > MOCK_PWM_COUNT)
+		return NULL;
+	bspMock.configuredMask |= 1U << (pwmNo - 1);
+	return BSP_PWM_UpdatePairDuty;
+}
+
+DutyCycleUpdateFnc BSP_PWM_ConfigChannel(uint16_t pwmNo, pwm_config_t *config)
+{
+	if (pwmNo < 1 || pwmNo > MOCK_PWM_COUNT)
+		return NULL;
+	bspMock.configuredMask |= 1U << (pwmNo - 1);
+	return BSP_PWM_UpdateChannelDuty;
+}
+
+float BSP_PWM_UpdatePhaseShift(uint32_t pwmNo, float psRatio)
+{
+	return psRatio;
+}
+
+void BSP_PWM_Config_Interrupt(uint32_t pwmNo, bool enable, PWMResetCallback callback, int priority)
+{
+	// PWM reset interrupts are not generated during replay
+}
+
+void BSP_PWM_Start(uint32_t pwmMask, bool masterHRTIM)
+{
+	bspMock.isPwmRunning = true;
+}
+
+void BSP_PWM_Stop(uint32_t pwmMask, bool masterHRTIM)
+{
+	bspMock.isPwmRunning = false;
+}
+
+void BSP_PWMOut_Enable(uint32_t pwmMask, bool en)
+{
+	if (en)
+		bspMock.pwmEnableMask |= pwmMask;
+	else
+		bspMock.pwmEnableMask &= ~pwmMask;
+}
+
+void BSP_PWMOut_DisableFromISR(uint32_t pwmMask)
+{
+	bspMock.pwmEnableMask &= ~pwmMask;
+}
+
+void BSP_DigitalPins_Init(void)
+{
+}
+
+void BSP_Din_SetPortGPIO(void)
+{
+}
+
+const digital_pin_t* BSP_Dout_SetAsIOPin(uint32_t pinNo, GPIO_PinState state)
+{
+	uint32_t mask = 1U << (pinNo - 1);
+	bspMock.pwmPinMask &= ~mask;
+	if (state == GPIO_PIN_SET)
+		bspMock.doutState |= mask;
+	else
+		bspMock.doutState &= ~mask;
+	return &mockPin;
+}
+
+const digital_pin_t* BSP_Dout_SetAsPWMPin(uint32_t pinNo)
+{
+	bspMock.pwmPinMask |= 1U << (pinNo - 1);
+	return &mockPin;
+}
+
+void BSP_Dout_SetPortAsGPIO(void)
+{
+	bspMock.pwmPinMask = 0;
+}
+
+void BSP_Dout_SetPortValue(uint32_t val)
+{
+	bspMock.doutState = val;
+}
+
+void BSP_ADC_Init(adc_acq_mode_t _type, adc_cont_config_t* _contConfig, volatile adc_raw_data_t* _rawAdcData, volatile adc_processed_data_t* _processedAdcData)
+{
+	bspMock.adcCallback = _contConfig->callback;
+	bspMock.adcFs = _contConfig->fs;
+	bspMock.adcMonitoringFs = _contConfig->monitoringFs;
+}
+
+adc_measures_t* BSP_ADC_Run(void)
+{
+	bspMock.isAdcRunning = true;
+	return NULL;
+}
+
+void BSP_ADC_Stop(void)
+{
+	if (bspMock.isAdcRunning)
+		bspMock.adcRestartCount++;
+	bspMock.isAdcRunning = false;
+}
+
+timer_trigger_src_t BSP_ADC_SetInputOutputTrigger(tim_in_trigger_config_t* _slaveConfig, tim_out_trigger_config_t* _masterConfig, float _fs)
+{
+	bspMock.adcFs = _fs;
+	return TIM_TRG_SRC_TIM4;
+}
+
+timer_trigger_src_t BSP_ADC_UpdateInputOutputTrigger(tim_in_trigger_config_t* _slaveConfig, tim_out_trigger_config_t* _masterConfig, float _fs)
+{
+	bspMock.adcFs = _fs;
+	bspMock.adcTriggerUpdateCount++;
+	return _masterConfig ? TIM_TRG_SRC_TIM4 : TIM_TRG_SRC_NONE;
+}
+
+device_err_t BSP_ADC_SetProtectionLimits(int _channelIndex, float _lower, float _upper)
+{
+	if (_channelIndex < 0 || _channelIndex >= ADC_PROTECTION_CHANNEL_COUNT || _lower > _upper)
+		return ERR_ILLEGAL;
+	bspMock.protectionLimits.lower[_channelIndex] = _lower;
+	bspMock.protectionLimits.upper[_channelIndex] = _upper;
+	return ERR_OK;
+}
+
+void BSP_ADC_EnableProtection(uint32_t _pwmMask, bool _en)
+{
+	bspMock.protectionPwmMask = _pwmMask;
+	bspMock.isProtectionEnabled = _en;
+}
+
+void BSP_ADC_ResetProtection(void)
+{
+	bspMock.protectionStats.tripMask = 0;
+}
+
+void BSP_ADC_GetProtectionStats(adc_protection_stats_t* _stats)
+{
+	*_stats = bspMock.protectionStats;
+}
+
+__weak void BSP_ADC_ProtectionTrippedCallback(uint32_t channelMask)
+{
+}
+
+HAL_StatusTypeDef HAL_HSEM_FastTake(uint32_t SemID)
+{
+	return HAL_OK;
+}
+
+void HAL_HSEM_Release(uint32_t SemID, uint32_t ProcessID)
+{
+	// The completion is polled by the harness
+}
+
+/**
+ * @}
+ */
+/* EOF */
@@ -0,0 +1,115 @@
+/**
+ ********************************************************************************
+ * @file    	replay_gridtie.c
+ * @author 		Waqas Ehsan Butt
+ * @date    	Oct 18, 2026
+ *
+ * @brief   Replay harness adapter for the PELab_GridTie application
+ ********************************************************************************
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include "replay_harness.h"
+#include "grid_tie_controller.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static const replay_register_t regs[] =
+{
+		REPLAY_REGISTER(DTYPE_BOOL, P2P_BOOST_STATE),
+		REPLAY_REGISTER(DTYPE_BOOL, P2P_INVERTER_STATE),
+		REPLAY_REGISTER(DTYPE_BOOL, P2P_RELAY_STATUS),
+		REPLAY_REGISTER(DTYPE_BOOL, P2P_PLL_STATUS),
+		REPLAY_REGISTER(DTYPE_FLOAT, P2P_GRID_FREQ),
+		REPLAY_REGISTER(DTYPE_FLOAT, P2P_GRID_VOLTAGE),
+		REPLAY_REGISTER(DTYPE_FLOAT, P2P_REQ_RMS_CURRENT),
+		REPLAY_REGISTER(DTYPE_FLOAT, P2P_LOUT_mH),
+		REPLAY_REGISTER(DTYPE_FLOAT, P2P_PROT_VDC_MAX),
+		REPLAY_REGISTER(DTYPE_FLOAT, P2P_PROT_CURRENT_MAX),
+		REPLAY_REGISTER(DTYPE_FLOAT, P2P_CURR_RMS_CURRENT),
+};
+static volatile bool* const pendingFlags[] =
+{
+		&boostStateUpdateRequest.isPending,
+		&inverterStateUpdateRequest.isPending,
+};
+static const char* const stateNames[] =
+{
+		"pllStatus", "relay", "boost", "inverter", "vdc", "iRef", "iRms",
+};
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+extern grid_tie_t gridTieConfig;
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+static void SetDefaults(void);
+static void GetStates(float* states);
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Default values written by the CM4 when no stored states are available.
+ */
+static void SetDefaults(void)
+{
+	INTER_CORE_DATA.floats[P2P_GRID_FREQ] = DEFAULT_GRID_FREQ;
+	INTER_CORE_DATA.floats[P2P_LOUT_mH] = DEFAULT_LOUT_mH;
+	INTER_CORE_DATA.floats[P2P_GRID_VOLTAGE] = DEFAULT_GRID_VOLTAGE;
+	INTER_CORE_DATA.floats[P2P_REQ_RMS_CURRENT] = DEFAULT_CURRENT_INJ;
+	INTER_CORE_DATA.floats[P2P_PROT_VDC_MAX] = DEFAULT_PROT_VDC_MAX;
+	INTER_CORE_DATA.floats[P2P_PROT_CURRENT_MAX] = DEFAULT_PROT_CURRENT_MAX;
+}
+
+static void GetStates(float* states)
+{
+	states[0] = (float)gridTieConfig.pll.status;
+	states[1] = gridTieConfig.isRelayOn;
+	states[2] = gridTieConfig.isBoostEnabled;
+	states[3] = gridTieConfig.isInverterEnabled;
+	states[4] = gridTieConfig.vdc;
+	states[5] = gridTieConfig.iRef;
+	states[6] = INTER_CORE_DATA.floats[P2P_CURR_RMS_CURRENT];
+}
+
+const replay_app_t replayApp =
+{
+		.name = "PELab_GridTie",
+		.regs = regs,
+		.regCount = sizeof(regs) / sizeof(regs[0]),
+		.pendingFlags = pendingFlags,
+		.pendingCount = sizeof(pendingFlags) / sizeof(pendingFlags[0]),
+		.stateNames = stateNames,
+		.stateCount = sizeof(stateNames) / sizeof(stateNames[0]),
+		.SetDefaults = SetDefaults,
+		.GetStates = GetStates,
+};
+
+/* EOF */
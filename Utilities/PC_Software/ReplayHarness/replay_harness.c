@@ -0,0 +1,556 @@
+/**
+ ********************************************************************************
+ * @file    	replay_harness.c
+ * @author 		Waqas Ehsan Butt
+ * @date    	Oct 18, 2026
+ *
+ * @brief   Record/replay harness running the control applications on a PC
+ ********************************************************************************
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <inttypes.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <strings.h>
+#include <time.h>
+#include <unistd.h>
+#include "replay_harness.h"
+#include "capture_file.h"
+#include "main_controller.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/**
+ * @brief Number of records converted at once from the capture file
+ */
+#define REPLAY_CHUNK_RECORDS			(1024)
+/**
+ * @brief Resolution of the loop cost histogram in nano-seconds
+ */
+#define COST_BIN_ns						(10)
+/**
+ * @brief Number of bins in the loop cost histogram. Longer iterations are placed in the last bin.
+ */
+#define COST_BIN_COUNT					(10000)
+/**
+ * @brief Maximum length of a line in the event file
+ */
+#define EVENT_LINE_LEN					(256)
+/**
+ * @brief FNV-1a hash parameters used for the output digest
+ */
+#define FNV_OFFSET						(0xcbf29ce484222325ull)
+#define FNV_PRIME						(0x100000001b3ull)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief Timed P2P parameter change
+ */
+typedef struct
+{
+	bool isInit;				/**< @brief Applied directly to the shared data before initializing the application */
+	double time;				/**< @brief Time of the change in seconds from the start of the capture */
+	p2p_msg_type_t type;		/**< @brief Message type posted by the CM4 */
+	base_data_type_t dataType;	/**< @brief Data type of the register */
+	uint8_t index;				/**< @brief Register index */
+	data_union_t value;			/**< @brief Value of the message */
+	int line;					/**< @brief Line in the event file */
+} replay_event_t;
+/**
+ * @brief Maps the event file keywords to the message types
+ */
+typedef struct
+{
+	const char* txt;
+	p2p_msg_type_t type;
+	base_data_type_t dataType;
+} event_keyword_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static const event_keyword_t keywords[] =
+{
+		{ "bool", MSG_SET_BOOL, DTYPE_BOOL },
+		{ "u8", MSG_SET_U8, DTYPE_U8 },
+		{ "u16", MSG_SET_U16, DTYPE_U16 },
+		{ "u32", MSG_SET_U32, DTYPE_U32 },
+		{ "s8", MSG_SET_S8, DTYPE_S8 },
+		{ "s16", MSG_SET_S16, DTYPE_S16 },
+		{ "s32", MSG_SET_S32, DTYPE_S32 },
+		{ "float", MSG_SET_FLOAT, DTYPE_FLOAT },
+		{ "setbits", MSG_SET_BITS, DTYPE_BIT_ACCESS },
+		{ "clrbits", MSG_CLR_BITS, DTYPE_BIT_ACCESS },
+		{ "togglebits", MSG_TOGGLE_BITS, DTYPE_BIT_ACCESS },
+};
+static replay_event_t* events = NULL;
+static int eventCount = 0;
+/**
+ * @brief State of the thread emulating the CM7 main loop processing the P2P messages
+ */
+static pthread_t worker;
+static bool isWorkerActive = false;
+static atomic_bool isWorkerDone;
+static const replay_event_t* workerEvent;
+static volatile p2p_msg_t* workerMsg;
+static uint64_t costBins[COST_BIN_COUNT];
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static void PrintUsage(const char* name)
+{
+	fprintf(stderr,
+			"Usage: %s <capture> [options]\n"
+			"Replays an ADC capture through the %s control application.\n"
+			"Options:\n"
+			"  -e <file>    Timed P2P parameter changes\n"
+			"  -o <file>    Output CSV file (default stdout)\n"
+			"  -d <n>       Write every n-th record to the output (default 1, 0 disables output)\n"
+			"  -s <start>   First record to replay. Add the suffix 's' to specify seconds\n"
+			"  -n <count>   Number of records to replay. Add the suffix 's' to specify seconds\n"
+			"Event file lines: <time[s]|init> <bool|u8|u16|u32|s8|s16|s32|float|setbits|clrbits|togglebits> <register> <value>\n"
+			"Registers are given by their P2P name or index.\n", name, replayApp.name);
+}
+
+static uint64_t ParsePosition(const char* txt, float fs)
+{
+	char* end;
+	double val = strtod(txt, &end);
+	if (*end == 's')
+		val *= fs;
+	return val < 0 ? 0 : (uint64_t)val;
+}
+
+static int CompareEvents(const void* a, const void* b)
+{
+	const replay_event_t* e1 = (const replay_event_t*)a;
+	const replay_event_t* e2 = (const replay_event_t*)b;
+	if (e1->isInit != e2->isInit)
+		return e1->isInit ? -1 : 1;
+	if (e1->time != e2->time)
+		return e1->time < e2->time ? -1 : 1;
+	return e1->line - e2->line;
+}
+
+/**
+ * @brief Parse the value according to the data type of the register.
+ */
+static bool ParseValue(const char* txt, base_data_type_t type, data_union_t* value)
+{
+	char* end;
+	memset(value, 0, sizeof(data_union_t));
+	if (type == DTYPE_FLOAT)
+		value->f = strtof(txt, &end);
+	else if (type == DTYPE_S8 || type == DTYPE_S16 || type == DTYPE_S32)
+	{
+		long val = strtol(txt, &end, 0);
+		if (type == DTYPE_S8)
+			value->s8 = (int8_t)val;
+		else if (type == DTYPE_S16)
+			value->s16 = (int16_t)val;
+		else
+			value->s32 = (int32_t)val;
+	}
+	else
+	{
+		unsigned long val = strtoul(txt, &end, 0);
+		if (type == DTYPE_BOOL)
+			value->b = val != 0;
+		else if (type == DTYPE_U8)
+			value->u8 = (uint8_t)val;
+		else if (type == DTYPE_U16)
+			value->u16 = (uint16_t)val;
+		else if (type == DTYPE_U32)
+			value->u32 = (uint32_t)val;
+		else
+			value->bits = (uint8_t)val;
+	}
+	return end != txt && *end == '\0';
+}
+
+static int LoadEvents(const char* path)
+{
+	char line[EVENT_LINE_LEN];
+	int lineNo = 0;
+	FILE* fp = fopen(path, "r");
+	if (fp == NULL)
+	{
+		perror(path);
+		return -1;
+	}
+	while (fgets(line, sizeof(line), fp))
+	{
+		char timeTxt[32], typeTxt[32], regTxt[64], valTxt[64];
+		replay_event_t ev = { .line = ++lineNo };
+		char* comment = strchr(line, '#');
+		if (comment)
+			*comment = '\0';
+		int n = sscanf(line, "%31s %31s %63s %63s", timeTxt, typeTxt, regTxt, valTxt);
+		if (n <= 0)
+			continue;
+		if (n != 4)
+			goto error;
+
+		ev.isInit = strcasecmp(timeTxt, "init") == 0;
+		if (!ev.isInit)
+			ev.time = strtod(timeTxt, NULL);
+
+		size_t k;
+		for (k = 0; k < sizeof(keywords) / sizeof(keywords[0]); k++)
+			if (strcasecmp(typeTxt, keywords[k].txt) == 0)
+				break;
+		if (k == sizeof(keywords) / sizeof(keywords[0]))
+			goto error;
+		ev.type = keywords[k].type;
+		ev.dataType = keywords[k].dataType;
+
+		// Register names are resolved through the application table, otherwise use the index directly
+		char* end;
+		unsigned long index = strtoul(regTxt, &end, 0);
+		if (*end != '\0')
+		{
+			int r;
+			for (r = 0; r < replayApp.regCount; r++)
+				if (strcmp(regTxt, replayApp.regs[r].name) == 0)
+					break;
+			if (r == replayApp.regCount || replayApp.regs[r].type != ev.dataType)
+				goto error;
+			index = replayApp.regs[r].index;
+		}
+		ev.index = (uint8_t)index;
+		if (!ParseValue(valTxt, ev.dataType, &ev.value))
+			goto error;
+
+		replay_event_t* temp = (replay_event_t*)realloc(events, (eventCount + 1) * sizeof(replay_event_t));
+		if (temp == NULL)
+		{
+			fclose(fp);
+			return -1;
+		}
+		events = temp;
+		events[eventCount++] = ev;
+	}
+	fclose(fp);
+	qsort(events, eventCount, sizeof(replay_event_t), CompareEvents);
+	return 0;
+
+error:
+	fprintf(stderr, "%s:%d: invalid event\n", path, lineNo);
+	fclose(fp);
+	return -1;
+}
+
+/**
+ * @brief Write the initial values directly in the shared data as done by the CM4 while restoring the states.
+ */
+static void ApplyInitEvent(const replay_event_t* ev)
+{
+	volatile p2p_data_buffs_t* data = &INTER_CORE_DATA;
+	switch (ev->dataType)
+	{
+	case DTYPE_BOOL: data->bools[ev->index] = ev->value.b; break;
+	case DTYPE_U8: data->u8s[ev->index] = ev->value.u8; break;
+	case DTYPE_U16: data->u16s[ev->index] = ev->value.u16; break;
+	case DTYPE_U32: data->u32s[ev->index] = ev->value.u32; break;
+	case DTYPE_S8: data->s8s[ev->index] = ev->value.s8; break;
+	case DTYPE_S16: data->s16s[ev->index] = ev->value.s16; break;
+	case DTYPE_S32: data->s32s[ev->index] = ev->value.s32; break;
+	case DTYPE_FLOAT: data->floats[ev->index] = ev->value.f; break;
+	default: data->bitAccess[ev->index] = ev->value.bits; break;
+	}
+}
+
+/**
+ * @brief Emulates the CM7 main loop servicing a single P2P message.
+ */
+static void* WorkerThread(void* arg)
+{
+	P2PComms_ProcessPendingRequests();
+	atomic_store(&isWorkerDone, true);
+	return NULL;
+}
+
+static bool IsRequestPending(void)
+{
+	for (int i = 0; i < replayApp.pendingCount; i++)
+		if (*replayApp.pendingFlags[i])
+			return true;
+	return false;
+}
+
+/**
+ * @brief Post the message in the same way as the CM4 and let the CM7 main loop process it.
+ * @details Returns once the request is either completed or waiting for the ADC callback, so the
+ * sample at which the request is serviced is deterministic.
+ */
+static void DispatchEvent(const replay_event_t* ev)
+{
+	volatile p2p_msg_t* msg = &CORE_MSGS.msgs[CORE_MSGS.msgsRingBuff.wrIndex];
+	msg->type = ev->type;
+	msg->firstReg = ev->index;
+	msg->cmdIndex = CORE_MSGS.cmdsRingBuff.wrIndex;
+	CORE_MSGS.cmds[msg->cmdIndex] = ev->value;
+	msg->cmdLen = 1;
+	msg->responseIndex = msg->responseLen = -1;
+	RingBuffer_Write((ring_buffer_t*)&CORE_MSGS.msgsRingBuff);
+	RingBuffer_Write((ring_buffer_t*)&CORE_MSGS.cmdsRingBuff);
+
+	workerEvent = ev;
+	workerMsg = msg;
+	atomic_store(&isWorkerDone, false);
+	if (pthread_create(&worker, NULL, WorkerThread, NULL) != 0)
+	{
+		perror("pthread_create");
+		exit(1);
+	}
+	isWorkerActive = true;
+	while (!atomic_load(&isWorkerDone) && !IsRequestPending())
+		sched_yield();
+}
+
+/**
+ * @brief Complete the active request if it is not waiting for the ADC callback.
+ */
+static void CompleteEvent(float fs, uint64_t index)
+{
+	if (!isWorkerActive)
+		return;
+	while (!atomic_load(&isWorkerDone))
+	{
+		if (IsRequestPending())
+			return;
+		sched_yield();
+	}
+	pthread_join(worker, NULL);
+	isWorkerActive = false;
+
+	device_err_t err = (device_err_t)CORE_MSGS.response[workerMsg->responseIndex].u8;
+	fprintf(stderr, "%.6f: event at line %d applied%s (error %d)\n", index / fs, workerEvent->line,
+			err == ERR_OK ? "" : " with error", (int)err);
+}
+
+static inline uint64_t Hash(uint64_t hash, const void* data, size_t len)
+{
+	const uint8_t* ptr = (const uint8_t*)data;
+	while (len--)
+		hash = (hash ^ *ptr++) * FNV_PRIME;
+	return hash;
+}
+
+static void PrintHeader(FILE* out)
+{
+	fprintf(out, "time,adcFs,pwmEnable,doutState");
+	for (int i = 0; i < MOCK_PWM_COUNT; i++)
+		if (bspMock.configuredMask & (1U << i))
+			fprintf(out, ",D%d", i + 1);
+	for (int i = 0; i < replayApp.stateCount; i++)
+		fprintf(out, ",%s", replayApp.stateNames[i]);
+	fprintf(out, "\n");
+}
+
+static void PrintRecord(FILE* out, double time, const float* states)
+{
+	fprintf(out, "%.7f,%g,0x%04" PRIx32 ",0x%04" PRIx32, time, bspMock.adcFs, bspMock.pwmEnableMask, bspMock.doutState);
+	for (int i = 0; i < MOCK_PWM_COUNT; i++)
+		if (bspMock.configuredMask & (1U << i))
+			fprintf(out, ",%.6f", bspMock.duty[i]);
+	for (int i = 0; i < replayApp.stateCount; i++)
+		fprintf(out, ",%g", states[i]);
+	fprintf(out, "\n");
+}
+
+static uint64_t GetCostPercentile(uint64_t total, double ratio)
+{
+	uint64_t target = (uint64_t)(total * ratio);
+	uint64_t sum = 0;
+	for (int i = 0; i < COST_BIN_COUNT; i++)
+	{
+		sum += costBins[i];
+		if (sum > target)
+			return (uint64_t)i * COST_BIN_ns;
+	}
+	return (uint64_t)COST_BIN_COUNT * COST_BIN_ns;
+}
+
+static inline uint64_t GetTime_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+int main(int argc, char** argv)
+{
+	static float data[REPLAY_CHUNK_RECORDS * CAPTURE_MAX_CHANNELS];
+	capture_file_t file;
+	FILE* out = stdout;
+	const char* eventPath = NULL;
+	const char* outPath = NULL;
+	const char* startTxt = "0";
+	const char* countTxt = "0";
+	uint64_t decimation = 1;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "e:o:d:s:n:h")) != -1)
+	{
+		switch (opt)
+		{
+		case 'e': eventPath = optarg; break;
+		case 'o': outPath = optarg; break;
+		case 'd': decimation = strtoull(optarg, NULL, 0); break;
+		case 's': startTxt = optarg; break;
+		case 'n': countTxt = optarg; break;
+		default: PrintUsage(argv[0]); return 1;
+		}
+	}
+	if (optind >= argc)
+	{
+		PrintUsage(argv[0]);
+		return 1;
+	}
+	if (CaptureFile_Open(&file, argv[optind]) != 0)
+	{
+		perror(argv[optind]);
+		return 1;
+	}
+	if (eventPath && LoadEvents(eventPath) != 0)
+		return 1;
+	if (outPath && (out = fopen(outPath, "w")) == NULL)
+	{
+		perror(outPath);
+		return 1;
+	}
+
+	const float fs = file.header->fs;
+	const uint32_t chCount = file.header->chCount;
+	uint64_t start = ParsePosition(startTxt, fs);
+	uint64_t count = ParsePosition(countTxt, fs);
+	if (start > file.sampleCount)
+		start = file.sampleCount;
+	if (count == 0 || count > file.sampleCount - start)
+		count = file.sampleCount - start;
+
+	// Bring up the system in the same sequence as the firmware
+	BSPMock_Reset();
+	replayApp.SetDefaults();
+	int nextEvent = 0;
+	while (nextEvent < eventCount && events[nextEvent].isInit)
+		ApplyInitEvent(&events[nextEvent++]);
+	P2PComms_InitData();
+	MainControl_Init();
+	if (bspMock.adcCallback == NULL)
+	{
+		fprintf(stderr, "The application didn't register an ADC callback\n");
+		return 1;
+	}
+	if (decimation)
+		PrintHeader(out);
+
+	float* states = (float*)calloc(replayApp.stateCount ? replayApp.stateCount : 1, sizeof(float));
+	uint64_t digest = FNV_OFFSET;
+	uint64_t totalCost = 0, maxCost = 0;
+	bool isFsWarned = false;
+	uint64_t wallStart = GetTime_ns();
+
+	for (uint64_t done = 0; done < count;)
+	{
+		uint64_t n = CaptureFile_ReadRange(&file, start + done, (count - done) > REPLAY_CHUNK_RECORDS ? REPLAY_CHUNK_RECORDS : (count - done), data);
+		for (uint64_t i = 0; i < n; i++, done++)
+		{
+			uint64_t index = start + done;
+			double time = index / (double)fs;
+			adc_measures_t measures = {0};
+			memcpy(&measures, &data[i * chCount], chCount * sizeof(float));
+
+			// Post the due messages. Only a single message is processed at a time as in the CM7 main loop
+			while (!isWorkerActive && nextEvent < eventCount && events[nextEvent].time <= time)
+				DispatchEvent(&events[nextEvent++]);
+
+			uint64_t t0 = GetTime_ns();
+			BSPMock_CheckProtection(&measures);
+			bspMock.adcCallback(&measures);
+			uint64_t cost = GetTime_ns() - t0;
+			totalCost += cost;
+			if (cost > maxCost)
+				maxCost = cost;
+			costBins[cost / COST_BIN_ns < COST_BIN_COUNT ? cost / COST_BIN_ns : COST_BIN_COUNT - 1]++;
+
+			CompleteEvent(fs, index);
+			if (!isFsWarned && bspMock.adcFs != fs)
+			{
+				fprintf(stderr, "%.6f: application requested %g Hz sampling but the capture is recorded at %g Hz\n", time, bspMock.adcFs, fs);
+				isFsWarned = true;
+			}
+
+			if (replayApp.GetStates)
+				replayApp.GetStates(states);
+			digest = Hash(digest, bspMock.duty, sizeof(bspMock.duty));
+			digest = Hash(digest, &bspMock.pwmEnableMask, sizeof(bspMock.pwmEnableMask));
+			digest = Hash(digest, &bspMock.doutState, sizeof(bspMock.doutState));
+			digest = Hash(digest, states, replayApp.stateCount * sizeof(float));
+			if (decimation && (done % decimation) == 0)
+				PrintRecord(out, time, states);
+		}
+		if (n == 0)
+			break;
+	}
+	uint64_t wall = GetTime_ns() - wallStart;
+
+	if (isWorkerActive)
+		fprintf(stderr, "Event at line %d was never serviced by the application\n", workerEvent->line);
+	else if (nextEvent < eventCount)
+		fprintf(stderr, "%d events after the end of the replay were ignored\n", eventCount - nextEvent);
+	fprintf(stderr, "Application:     %s\n", replayApp.name);
+	fprintf(stderr, "Records:         %" PRIu64 " (%.3f s)\n", count, count / fs);
+	fprintf(stderr, "Replay Time:     %.3f s (%.1fx real time)\n", wall / 1e9, wall ? (count / fs) / (wall / 1e9) : 0);
+	if (count)
+		fprintf(stderr, "Loop Cost:       avg %.0f ns, p50 %" PRIu64 " ns, p99 %" PRIu64 " ns, max %" PRIu64 " ns\n",
+				(double)totalCost / count, GetCostPercentile(count, 0.5), GetCostPercentile(count, 0.99), maxCost);
+	fprintf(stderr, "ADC Restarts:    %" PRIu32 "\n", bspMock.adcRestartCount);
+	fprintf(stderr, "Trigger Updates: %" PRIu32 "\n", bspMock.adcTriggerUpdateCount);
+	fprintf(stderr, "Protection:      %" PRIu32 " tripped samples, channels 0x%04" PRIx32 "\n",
+			bspMock.protectionStats.tripCount, bspMock.protectionStats.tripMask);
+	fprintf(stderr, "Output Digest:   %016" PRIx64 "\n", digest);
+
+	if (out != stdout)
+		fclose(out);
+	else
+		fflush(out);
+	free(states);
+	free(events);
+	CaptureFile_Close(&file);
+	fflush(stderr);
+	// A request which is never serviced keeps the worker thread blocked
+	_exit(isWorkerActive ? 2 : 0);
+}
+
+/* EOF */
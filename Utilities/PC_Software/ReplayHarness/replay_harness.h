@@ -0,0 +1,164 @@
+/**
+ ********************************************************************************
+ * @file 		replay_harness.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Record/replay harness running the control applications on a PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef REPLAY_HARNESS_H_
+#define REPLAY_HARNESS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup Replay_Harness Replay Harness
+ * @brief Feeds captured ADC records and timed P2P parameter changes through the CM7 control application.
+ * @details The application sources are compiled unchanged for the control core. The BSP drivers used by them
+ * are replaced by @ref BSP_Mock which records the generated duty cycles and pin states. The ADC callback registered
+ * by <b>MainControl_Init()</b> is invoked once for each captured record, so the application runs exactly the
+ * same code path as on the target.
+ * @{
+ */
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdio.h>
+#include "general_header.h"
+#include "pecontroller_adc.h"
+#include "shared_memory.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/**
+ * @brief Number of PWM channels tracked by the mock
+ */
+#define MOCK_PWM_COUNT				(16)
+/**
+ * @brief Helper for defining the named registers of an application
+ */
+#define REPLAY_REGISTER(_type, _index)		{ .name = #_index, .type = _type, .index = _index }
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/** @defgroup ReplayHarness_Exported_Structures Structures
+ * @{
+ */
+/**
+ * @brief Describes a named P2P register of the application
+ */
+typedef struct
+{
+	const char* name;				/**< @brief Name of the register as used in the event files */
+	base_data_type_t type;			/**< @brief Type of the register */
+	uint8_t index;					/**< @brief Index of the register in the relevant buffer */
+} replay_register_t;
+/**
+ * @brief Describes the application specific parts of the harness
+ */
+typedef struct
+{
+	const char* name;								/**< @brief Name of the application */
+	const replay_register_t* regs;					/**< @brief Named P2P registers */
+	int regCount;									/**< @brief Number of named P2P registers */
+	volatile bool* const* pendingFlags;				/**< @brief Pending flags of the requests serviced by the ADC callback */
+	int pendingCount;								/**< @brief Number of pending flags */
+	const char* const* stateNames;					/**< @brief Names of the recorded application states */
+	int stateCount;									/**< @brief Number of recorded application states */
+	void (*SetDefaults)(void);						/**< @brief Set the shared data as restored by the CM4 from an empty flash */
+	void (*GetStates)(float* states);				/**< @brief Get the current application states */
+} replay_app_t;
+/**
+ * @brief Recorded state of the mocked BSP drivers
+ */
+typedef struct
+{
+	float duty[MOCK_PWM_COUNT];				/**< @brief Last duty cycle applied to each PWM channel */
+	uint32_t configuredMask;				/**< @brief PWM channels configured by the application */
+	uint32_t pwmEnableMask;					/**< @brief PWM outputs enabled using @ref BSP_PWMOut_Enable() */
+	uint32_t pwmPinMask;					/**< @brief Digital outputs configured as PWM pins */
+	uint32_t doutState;						/**< @brief State of the digital outputs configured as IOs */
+	bool isPwmRunning;						/**< @brief PWM timers running */
+	bool isAdcRunning;						/**< @brief ADC conversions running */
+	float adcFs;							/**< @brief Sampling frequency requested by the application */
+	float adcMonitoringFs;					/**< @brief Rate of the stored records requested by the application */
+	uint32_t adcRestartCount;				/**< @brief Number of times the application stopped and restarted the ADC */
+	uint32_t adcTriggerUpdateCount;			/**< @brief Number of trigger changes applied without stopping the ADC */
+	adcMeauresDataCallback adcCallback;		/**< @brief Callback registered by the application */
+	adc_protection_limits_t protectionLimits;	/**< @brief Trip limits set using @ref BSP_ADC_SetProtectionLimits() */
+	bool isProtectionEnabled;				/**< @brief Protection enabled using @ref BSP_ADC_EnableProtection() */
+	uint32_t protectionPwmMask;				/**< @brief PWM outputs disabled by the protection */
+	adc_protection_stats_t protectionStats;	/**< @brief Trips of the protection. The latencies are not measured */
+} bsp_mock_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+/** @defgroup ReplayHarness_Exported_Variables Variables
+ * @{
+ */
+/**
+ * @brief Application description. Defined by each application adapter.
+ */
+extern const replay_app_t replayApp;
+/**
+ * @brief Recorded state of the mocked BSP drivers.
+ */
+extern bsp_mock_t bspMock;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+/** @defgroup ReplayHarness_Exported_Functions Functions
+ * @{
+ */
+/**
+ * @brief Reset the state of the mocked BSP drivers.
+ */
+extern void BSPMock_Reset(void);
+/**
+ * @brief Compare a sample against the protection limits before the ADC callback, as the conversion interrupt.
+ * @param measures Sample passed to the ADC callback.
+ */
+extern void BSPMock_CheckProtection(const adc_measures_t* measures);
+/**
+ * @}
+ */
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+
+
+
+
+/**
+ * @}
+ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */
@@ -0,0 +1,135 @@
+/**
+ ********************************************************************************
+ * @file    	replay_openloopvfd.c
+ * @author 		Waqas Ehsan Butt
+ * @date    	Oct 18, 2026
+ *
+ * @brief   Replay harness adapter for the PELab_OpenLoopVFD application
+ ********************************************************************************
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include "replay_harness.h"
+#include "open_loop_vf_controller.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static const replay_register_t regs[] =
+{
+		REPLAY_REGISTER(DTYPE_BOOL, P2P_INV1_STATE),
+		REPLAY_REGISTER(DTYPE_BOOL, P2P_INV2_STATE),
+		REPLAY_REGISTER(DTYPE_BOOL, P2P_INV1_REQ_DIRECTION),
+		REPLAY_REGISTER(DTYPE_BOOL, P2P_INV2_REQ_DIRECTION),
+		REPLAY_REGISTER(DTYPE_BOOL, P2P_INV1_DIRECTION),
+		REPLAY_REGISTER(DTYPE_BOOL, P2P_INV2_DIRECTION),
+		REPLAY_REGISTER(DTYPE_FLOAT, P2P_INV1_REQ_FREQ),
+		REPLAY_REGISTER(DTYPE_FLOAT, P2P_INV1_NOM_FREQ),
+		REPLAY_REGISTER(DTYPE_FLOAT, P2P_INV1_NOM_m),
+		REPLAY_REGISTER(DTYPE_FLOAT, P2P_INV1_ACCELERATION),
+		REPLAY_REGISTER(DTYPE_FLOAT, P2P_INV2_REQ_FREQ),
+		REPLAY_REGISTER(DTYPE_FLOAT, P2P_INV2_NOM_FREQ),
+		REPLAY_REGISTER(DTYPE_FLOAT, P2P_INV2_NOM_m),
+		REPLAY_REGISTER(DTYPE_FLOAT, P2P_INV2_ACCELERATION),
+		REPLAY_REGISTER(DTYPE_FLOAT, P2P_INV1_FREQ),
+		REPLAY_REGISTER(DTYPE_FLOAT, P2P_INV1_m),
+		REPLAY_REGISTER(DTYPE_FLOAT, P2P_INV2_FREQ),
+		REPLAY_REGISTER(DTYPE_FLOAT, P2P_INV2_m),
+};
+static volatile bool* const pendingFlags[] =
+{
+		&inv1StateUpdateRequest.isPending,
+		&inv2StateUpdateRequest.isPending,
+};
+static const char* const stateNames[] =
+{
+		"inv1State", "inv1Freq", "inv1m", "inv1Dir",
+#if VFD_COUNT == 2
+		"inv2State", "inv2Freq", "inv2m", "inv2Dir",
+#endif
+};
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+extern openloopvf_config_t openLoopVfConfig1;
+#if VFD_COUNT == 2
+extern openloopvf_config_t openLoopVfConfig2;
+#endif
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+static void SetDefaults(void);
+static void GetStates(float* states);
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Default values written by the CM4 when no stored states are available.
+ */
+static void SetDefaults(void)
+{
+	INTER_CORE_DATA.floats[P2P_INV1_REQ_FREQ] = DEFAULT_OUTPUT_FREQ;
+	INTER_CORE_DATA.floats[P2P_INV1_NOM_FREQ] = DEFAULT_NOMINAL_FREQ;
+	INTER_CORE_DATA.floats[P2P_INV1_NOM_m] = DEFAULT_NOMINAL_m;
+	INTER_CORE_DATA.floats[P2P_INV1_ACCELERATION] = DEFAULT_ACCELERATION;
+	INTER_CORE_DATA.floats[P2P_INV2_REQ_FREQ] = DEFAULT_OUTPUT_FREQ;
+	INTER_CORE_DATA.floats[P2P_INV2_NOM_FREQ] = DEFAULT_NOMINAL_FREQ;
+	INTER_CORE_DATA.floats[P2P_INV2_NOM_m] = DEFAULT_NOMINAL_m;
+	INTER_CORE_DATA.floats[P2P_INV2_ACCELERATION] = DEFAULT_ACCELERATION;
+}
+
+static void GetInverterStates(const openloopvf_config_t* config, float* states)
+{
+	states[0] = (float)config->inverterConfig.pmConfig.state;
+	states[1] = config->currentFreq;
+	states[2] = config->currentModulationIndex;
+	states[3] = config->currentDir;
+}
+
+static void GetStates(float* states)
+{
+	GetInverterStates(&openLoopVfConfig1, &states[0]);
+#if VFD_COUNT == 2
+	GetInverterStates(&openLoopVfConfig2, &states[4]);
+#endif
+}
+
+const replay_app_t replayApp =
+{
+		.name = "PELab_OpenLoopVFD",
+		.regs = regs,
+		.regCount = sizeof(regs) / sizeof(regs[0]),
+		.pendingFlags = pendingFlags,
+		.pendingCount = sizeof(pendingFlags) / sizeof(pendingFlags[0]),
+		.stateNames = stateNames,
+		.stateCount = sizeof(stateNames) / sizeof(stateNames[0]),
+		.SetDefaults = SetDefaults,
+		.GetStates = GetStates,
+};
+
+/* EOF */
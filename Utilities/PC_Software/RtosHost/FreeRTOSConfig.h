@@ -0,0 +1,53 @@
+/**
+ ********************************************************************************
+ * @file 		FreeRTOSConfig.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    FreeRTOS configuration of the CM4 core adapted to the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef RTOS_HOST_FREERTOS_CONFIG_H_
+#define RTOS_HOST_FREERTOS_CONFIG_H_
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+/* Configuration of the application, found after this folder in the include paths */
+#include_next "FreeRTOSConfig.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+#ifndef RTOS_HOST_HEAP_SIZE
+/**
+ * @brief Size of the heap of FreeRTOS on the PC
+ * @details The stack sizes in bytes of CMSIS-RTOS2 are kept, but the TCBs and the kernel objects hold many
+ * pointers, so they take more memory on a 64-bit PC than on the CM4. The heap is quadrupled, so the tasks fitting
+ * in the heap of the CM4 also fit on the PC.
+ */
+#define RTOS_HOST_HEAP_SIZE				(4U * 15360U)
+#endif
+#undef configTOTAL_HEAP_SIZE
+#define configTOTAL_HEAP_SIZE			((size_t)RTOS_HOST_HEAP_SIZE)
+/* The C library of the PC has no reentrancy structures of newlib */
+#undef configUSE_NEWLIB_REENTRANT
+#define configUSE_NEWLIB_REENTRANT		0
+/* Report the failed assertions instead of halting silently */
+#undef configASSERT
+extern void vAssertCalled(const char* file, int line);
+#define configASSERT(x)					if ((x) == 0) vAssertCalled(__FILE__, __LINE__)
+
+#endif
+/* EOF */
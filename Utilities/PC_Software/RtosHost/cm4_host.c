@@ -0,0 +1,463 @@
+/**
+ ********************************************************************************
+ * @file 		cm4_host.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Runs the CM4 firmware of an application on the PC with the emulated peripherals and CM7 core
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "cmsis_os.h"
+#include "rtos_host.h"
+#include "flash_host.h"
+#include "headless_display.h"
+#include "touch_panel.h"
+#include "screen_manager.h"
+/**
+ * The main.c of the CM4 core of the application is built in this file unchanged, with its entry point renamed and
+ * the start of the kernel redirected to @ref KernelStart(), which reports the results once the kernel stops.
+ */
+static osStatus_t KernelStart(void);
+#define main					Cm4_Main
+#define osKernelStart			KernelStart
+#include "main.c"
+#undef main
+#undef osKernelStart
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/**
+ * @brief Period of the publication of the records by the emulated CM7 core
+ */
+#define PRODUCER_PERIOD_ns				(100000ULL)
+/**
+ * @brief Records published in each period
+ */
+#define PRODUCER_RECORDS				((int)(MONITORING_FREQUENCY_Hz * PRODUCER_PERIOD_ns / 1000000000ULL))
+/**
+ * @brief Frequency, amplitude and offset of the synthetic signals
+ */
+#define SIGNAL_FREQ_Hz					(50)
+#define SIGNAL_AMPLITUDE				(100.f)
+#define SIGNAL_OFFSET					(10.f)
+#define SIGNAL_PERIOD_SAMPLES			(MONITORING_FREQUENCY_Hz / SIGNAL_FREQ_Hz)
+/**
+ * @brief Index of the floating point register changed by the emulated CM7 core.
+ * @note Should be one of the registers stored by the state storage of the application, e.g. the first one of
+ * PEController_Template and PWMGenerator.
+ */
+#ifndef CM4_HOST_PARAM_INDEX
+#define CM4_HOST_PARAM_INDEX			(0)
+#endif
+/**
+ * @brief Default options
+ */
+#define DEFAULT_DURATION_s				(60.0)
+#define DEFAULT_FLASH_FILE				"cm4_flash.bin"
+#define DEFAULT_PARAM_PERIOD_ms			(700)
+#define DEFAULT_TAP_PERIOD_ms			(1000)
+/**
+ * @brief Duration of each tap and its position, in an empty area of the main screen
+ */
+#define TAP_DURATION_ms					(80)
+#define TAP_X							(400)
+#define TAP_Y							(470)
+/**
+ * @brief Start of the parameter updates and of the taps, after the splash screen
+ */
+#define INPUTS_START_ms					(3000)
+#define MS_TO_NS(x)						((uint64_t)((x) * 1000000.0))
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static TIM_HandleTypeDef htim7 = { .Instance = TIM7 };
+static float signalTable[SIGNAL_PERIOD_SAMPLES];
+static uint64_t producedRecords = 0;
+static rtos_host_timer_t producerTimer, tim7Timer, paramTimer, pressTimer, releaseTimer, reportTimer;
+static double duration_s = DEFAULT_DURATION_s;
+static const char* flashPath = DEFAULT_FLASH_FILE;
+static bool isParamRestored = false;
+static float restoredParam = 0;
+static uint32_t paramUpdates = 0;
+static struct timespec startTime;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Publish the records of a period as the ADC of the CM7 core, notifying the CM4 core in the same way.
+ */
+static void ProducerInterrupt(void)
+{
+	static int notifiedIndex = 0;
+	int recordIndex = PROCESSED_ADC_DATA.recordIndex;
+	// amplitude changing every 250 ms, so that each block of the statistics shows new values
+	float gain = 1.f + 0.01f * ((producedRecords / (MONITORING_FREQUENCY_Hz / 4)) % 8);
+	for (int i = 0; i < PRODUCER_RECORDS; i++)
+	{
+		float* record = (float*)&PROCESSED_ADC_DATA.dataRecord[recordIndex];
+		for (int ch = 0; ch < TOTAL_MEASUREMENT_COUNT; ch++)
+			record[ch] = gain * signalTable[(producedRecords + ch * (SIGNAL_PERIOD_SAMPLES / TOTAL_MEASUREMENT_COUNT)) % SIGNAL_PERIOD_SAMPLES];
+		producedRecords++;
+		recordIndex = (recordIndex + 1) & (MEASURE_SAVE_COUNT - 1);
+	}
+	__DMB();
+	PROCESSED_ADC_DATA.recordIndex = recordIndex;
+	if (((recordIndex - notifiedIndex) & (MEASURE_SAVE_COUNT - 1)) < SHARED_MEMORY_ADC_NOTIFY_COUNT)
+		return;
+	notifiedIndex = recordIndex;
+	if (HAL_HSEM_FastTake(SHARED_MEMORY_ADC_HSEM_ID) == HAL_OK)
+		HAL_HSEM_Release(SHARED_MEMORY_ADC_HSEM_ID, 0);
+}
+
+/**
+ * @brief Time base of the HAL, as TIM7 of the application.
+ */
+static void Tim7Interrupt(void)
+{
+	HAL_TIM_PeriodElapsedCallback(&htim7);
+}
+
+/**
+ * @brief Write the parameter in an update section, as <b>P2PComms_WriteFloat()</b> of the CM7 core.
+ */
+static void WriteParam(float value)
+{
+	volatile p2p_data_sync_t* sync = &INTER_CORE_DATA_SYNC;
+	__atomic_fetch_add(&sync->writers, 1, __ATOMIC_SEQ_CST);
+	INTER_CORE_DATA.floats[CM4_HOST_PARAM_INDEX] = value;
+	sync->groupSeq[DTYPE_FLOAT] = sync->seq + 1;
+	__atomic_fetch_add(&sync->seq, 1, __ATOMIC_SEQ_CST);
+	__atomic_fetch_sub(&sync->writers, 1, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @brief Parameter changed by a transaction completed for the CM4 core, continuing from the restored value.
+ */
+static void ParamInterrupt(void)
+{
+	if (!isParamRestored)
+	{
+		restoredParam = INTER_CORE_DATA.floats[CM4_HOST_PARAM_INDEX];
+		isParamRestored = true;
+	}
+	WriteParam(INTER_CORE_DATA.floats[CM4_HOST_PARAM_INDEX] + 1);
+	paramUpdates++;
+	P2PComms_ParametersUpdatedCallback();
+}
+
+static void PressInterrupt(void)
+{
+	TouchPanel_Touch(true, TAP_X, TAP_Y);
+}
+
+static void ReleaseInterrupt(void)
+{
+	TouchPanel_Touch(false, TAP_X, TAP_Y);
+}
+
+static double GetElapsedTime_s(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec - startTime.tv_sec) + (now.tv_nsec - startTime.tv_nsec) / 1e9;
+}
+
+/**
+ * @brief Print the progress of a long run.
+ */
+static void ReportInterrupt(void)
+{
+	headless_display_stats_t display;
+	state_storage_stats_t storage;
+	flash_host_stats_t flash;
+	HeadlessDisplay_GetStats(&display);
+	StateStorage_GetStats(&storage);
+	FlashHost_GetStats(&flash);
+	printf("%8.0f s  frames %8u  records %6u  flash words %7u  PC time %7.1f s\n", RtosHost_GetTime_ns() / 1e9,
+			display.frameCount, storage.deltaCount + storage.checkpointCount, flash.programCount, GetElapsedTime_s());
+	fflush(stdout);
+}
+
+/**
+ * @brief Set the ADC information and the synthetic signals published by the emulated CM7 core.
+ */
+static void InitAdc(void)
+{
+	ADC_INFO.fs = MONITORING_FREQUENCY_Hz;
+	for (int i = 0; i < TOTAL_MEASUREMENT_COUNT; i++)
+	{
+		ADC_INFO.units[i] = UNIT_V;
+		ADC_INFO.sensitivity[i] = 1;
+		ADC_INFO.offsets[i] = 0;
+		ADC_INFO.freq[i] = SIGNAL_FREQ_Hz;
+	}
+	for (int i = 0; i < SIGNAL_PERIOD_SAMPLES; i++)
+		signalTable[i] = SIGNAL_OFFSET + SIGNAL_AMPLITUDE * sinf(2 * (float)M_PI * i / SIGNAL_PERIOD_SAMPLES);
+}
+
+/**
+ * @brief Print the telemetry of the tasks, the activity of the emulated peripherals and the checks of the run.
+ * @return <c>true</c> if all checks passed.
+ */
+static bool PrintResults(void)
+{
+	rtos_host_stats_t rtos;
+	headless_display_stats_t display;
+	touch_panel_stats_t touch;
+	state_storage_stats_t storage;
+	flash_host_stats_t flash;
+	screen_manager_stats_t screens;
+	task_telemetry_table_t telemetry;
+	RtosHost_GetStats(&rtos);
+	HeadlessDisplay_GetStats(&display);
+	TouchPanel_GetStats(&touch);
+	StateStorage_GetStats(&storage);
+	FlashHost_GetStats(&flash);
+	ScreenManager_GetStats(&screens);
+	TaskTelemetry_Read(&TASK_TELEMETRY, &telemetry);
+
+	printf("Virtual time %.1f s in %.1f s on the PC\n", duration_s, GetElapsedTime_s());
+	// wake-ups of the tasks of the application over the run, CPU share over the last period of the telemetry
+	osThreadId_t tasks[] = { storageTaskHandle, statsTaskHandle, displayTaskHandle, touchTaskHandle };
+	printf("%-16s %10s %10s %12s\n", "Task", "wakeups/s", "CPU [%]", "latency [us]");
+	for (int i = 0; i < telemetry.taskCount; i++)
+	{
+		char wakeups[16] = "-";
+		for (int j = 0; j < sizeof(tasks) / sizeof(tasks[0]); j++)
+		{
+			if (strcmp(osThreadGetName(tasks[j]), telemetry.tasks[i].name) != 0)
+				continue;
+			rtos_host_task_stats_t task;
+			RtosHost_GetTaskStats(tasks[j], &task);
+			snprintf(wakeups, sizeof(wakeups), "%.1f", task.switchIns / duration_s);
+		}
+		printf("%-16s %10s %10.3f %12u\n", telemetry.tasks[i].name, wakeups, telemetry.tasks[i].cpuLoad,
+				telemetry.tasks[i].peakLatency_us);
+	}
+	printf("%-28s %10.1f\n", "Context switches/s", rtos.contextSwitches / duration_s);
+	printf("%-28s %10.1f\n", "Interrupts/s", rtos.interrupts / duration_s);
+	printf("%-28s %10.1f\n", "Frames/s", display.frameCount / duration_s);
+	printf("%-28s %10u\n", "Touch events read", touch.readEvents);
+	printf("%-28s %10u\n", "Screen switches", screens.switchCount);
+	printf("%-28s %10u\n", "Parameter updates", paramUpdates);
+	printf("%-28s %10u / %u / %u\n", "Records delta/checkpoint", storage.deltaCount, storage.checkpointCount, storage.rotationCount);
+	printf("%-28s %10u\n", "Restored words", storage.restoredWords);
+	printf("%-28s %10u\n", "Flash words programmed", flash.programCount);
+	printf("%-28s %10u / %u\n", "Flash sector erases", flash.eraseCounts[FLASH_SECTOR_TOTAL - 2], flash.eraseCounts[FLASH_SECTOR_TOTAL - 1]);
+	if (isParamRestored)
+		printf("%-28s %10.0f -> %.0f\n", "Parameter restored -> last", restoredParam, INTER_CORE_DATA.floats[CM4_HOST_PARAM_INDEX]);
+
+	bool isPassed = true;
+	if (display.frameCount == 0)
+	{
+		printf("FAIL: no frames drawn\n");
+		isPassed = false;
+	}
+	if (flash.errorCount != 0)
+	{
+		printf("FAIL: %u flash operations rejected\n", flash.errorCount);
+		isPassed = false;
+	}
+	if (paramUpdates != 0 && storage.deltaCount + storage.checkpointCount == 0)
+	{
+		printf("FAIL: parameter updates not stored\n");
+		isPassed = false;
+	}
+	if (!StateStorage_IsCommitted())
+		printf("Storage not committed at the stop, the next run restores the previous record\n");
+	if (isPassed)
+		printf("PASS\n");
+	return isPassed;
+}
+
+/**
+ * @brief Start the kernel of the application, and report the results once it stops at the end of the run.
+ * @details The application never returns from its main function, so the tool exits here.
+ */
+static osStatus_t KernelStart(void)
+{
+	RtosHost_AddTimer(&tim7Timer, Tim7Interrupt, TIM7_IRQn, MS_TO_NS(1), MS_TO_NS(1));
+	osStatus_t status = osKernelStart();
+	if (status != osOK)
+	{
+		fprintf(stderr, "Kernel start failed\n");
+		exit(1);
+	}
+	bool isPassed = PrintResults();
+	FlashHost_Close();
+	exit(isPassed ? 0 : 2);
+}
+
+/********************************************************************************
+ * Emulated HAL
+ *******************************************************************************/
+HAL_StatusTypeDef HAL_Init(void)
+{
+	return HAL_OK;
+}
+
+/**
+ * @brief The emulated CM7 core has initialized the system before the start of the tool.
+ */
+void HAL_PWREx_ClearPendingEvent(void)
+{
+}
+
+void HAL_PWREx_EnterSTOPMode(uint32_t Regulator, uint8_t STOPEntry, uint32_t Domain)
+{
+}
+
+void HAL_GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_Init)
+{
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef* htim)
+{
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Init(TIM_HandleTypeDef* htim)
+{
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef* htim, TIM_OC_InitTypeDef* sConfig, uint32_t Channel)
+{
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIMEx_ConfigBreakDeadTime(TIM_HandleTypeDef* htim, TIM_BreakDeadTimeConfigTypeDef* sBreakDeadTimeConfig)
+{
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef* htim, uint32_t Channel)
+{
+	return HAL_OK;
+}
+
+void HAL_TIM_MspPostInit(TIM_HandleTypeDef* htim)
+{
+}
+
+/**
+ * @brief The samples of intelliSENS are not streamed on the PC.
+ */
+void intelliSENS_Init(float* _mults, float* _offsets, uint16_t* _dataCenter, int _dataCenterSize, uint16_t _ticks, volatile int* _wrIndex)
+{
+}
+
+static void PrintUsage(const char* name)
+{
+	fprintf(stderr, "usage: %s [-t seconds] [-f flash-file] [-s cpu-scale] [-p period-ms] [-k period-ms] [-r seconds]\n"
+			"  -t  virtual time of the run (default %.0f)\n"
+			"  -f  file of the flash, kept between the runs (default %s)\n"
+			"  -s  ratio of the speed of the PC to the CM4 core, 0 to run the tasks in no time (default 0)\n"
+			"  -p  period of the parameter updates, 0 to disable (default %d)\n"
+			"  -k  period of the taps on the screen, 0 to disable (default %d)\n"
+			"  -r  period of the progress reports, 0 to disable (default 0)\n", name, DEFAULT_DURATION_s, DEFAULT_FLASH_FILE,
+			DEFAULT_PARAM_PERIOD_ms, DEFAULT_TAP_PERIOD_ms);
+}
+
+int main(int argc, char** argv)
+{
+	double cpuScale = 0;
+	double reportPeriod_s = 0;
+	int paramPeriod_ms = DEFAULT_PARAM_PERIOD_ms;
+	int tapPeriod_ms = DEFAULT_TAP_PERIOD_ms;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+			duration_s = atof(argv[++i]);
+		else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+			flashPath = argv[++i];
+		else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+			cpuScale = atof(argv[++i]);
+		else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+			paramPeriod_ms = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc)
+			tapPeriod_ms = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+			reportPeriod_s = atof(argv[++i]);
+		else
+		{
+			PrintUsage(argv[0]);
+			return 1;
+		}
+	}
+	if (duration_s <= 0 || cpuScale < 0 || paramPeriod_ms < 0 || tapPeriod_ms < 0 || reportPeriod_s < 0
+			|| (tapPeriod_ms > 0 && tapPeriod_ms <= TAP_DURATION_ms))
+	{
+		PrintUsage(argv[0]);
+		return 1;
+	}
+	if (RtosHost_Init() != 0)
+	{
+		perror("Mapping the memories of the firmware");
+		return 1;
+	}
+	if (FlashHost_Open(flashPath) != 0)
+	{
+		perror("Mapping the flash file");
+		return 1;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &startTime);
+	RtosHost_SetCpuScale(cpuScale);
+	// the CM7 core initializes the ADC before releasing the CM4 core
+	InitAdc();
+	RtosHost_AddTimer(&producerTimer, ProducerInterrupt, CM7_SEV_IRQn, PRODUCER_PERIOD_ns, 0);
+	if (paramPeriod_ms > 0)
+		RtosHost_AddTimer(&paramTimer, ParamInterrupt, HSEM2_IRQn, MS_TO_NS(paramPeriod_ms), MS_TO_NS(INPUTS_START_ms));
+	if (tapPeriod_ms > 0)
+	{
+		RtosHost_AddTimer(&pressTimer, PressInterrupt, EXTI2_IRQn, MS_TO_NS(tapPeriod_ms), MS_TO_NS(INPUTS_START_ms));
+		RtosHost_AddTimer(&releaseTimer, ReleaseInterrupt, EXTI2_IRQn, MS_TO_NS(tapPeriod_ms),
+				MS_TO_NS(INPUTS_START_ms + TAP_DURATION_ms));
+	}
+	if (reportPeriod_s > 0)
+		RtosHost_AddTimer(&reportTimer, ReportInterrupt, TIM7_IRQn, MS_TO_NS(reportPeriod_s * 1000), MS_TO_NS(reportPeriod_s * 1000));
+	RtosHost_SetStopTime(MS_TO_NS(duration_s * 1000));
+	return Cm4_Main();
+}
+
+/* EOF */
@@ -0,0 +1,276 @@
+/**
+ ********************************************************************************
+ * @file 		flash_host.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    File backed flash in the virtual time of the RTOS host
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "flash_host.h"
+#include "rtos_host.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE					(0x100000)
+#endif
+#define FLASH_WORD_BYTES					(32)
+#define BANK_SIZE							(FLASH_SECTOR_SIZE * FLASH_SECTOR_TOTAL)
+#define PAGE_SIZE							(4096)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief Flash operation in progress
+ */
+typedef struct
+{
+	bool isPending;							/**< <c>true</c> while the operation is in progress */
+	bool isErase;							/**< <c>true</c> for a sector erase, <c>false</c> for programming */
+	uint32_t offset;						/**< Offset of the flash word or sector in the bank */
+	uint8_t data[FLASH_WORD_BYTES];			/**< Data latched for programming */
+	bool isCompleted;						/**< Set at completion until reported by @ref HAL_FLASH_IRQHandler() */
+	uint32_t returnValue;					/**< Value reported to the HAL callbacks */
+} flash_operation_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static int flashFd = -1;
+static uint8_t* const bank = (uint8_t*)FLASH_BANK1_BASE;
+/**
+ * @brief Page holding the flash registers, which are only written by the clients
+ */
+static uint8_t* const registers = (uint8_t*)(FLASH_R_BASE & ~(PAGE_SIZE - 1));
+static flash_host_stats_t stats;
+static uint64_t programTime_ns = FLASH_HOST_PROGRAM_TIME_ns;
+static uint64_t eraseTime_ns = FLASH_HOST_ERASE_TIME_ns;
+static flash_operation_t operation;
+/**
+ * @brief Single shot timer completing the operation in progress
+ */
+static rtos_host_timer_t completionTimer;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+extern void FLASH_IRQHandler(void);
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Complete the operation in progress and raise the flash interrupt.
+ */
+static void CompleteOperation(void)
+{
+	if (operation.isErase)
+	{
+		memset(bank + operation.offset, 0xFF, FLASH_SECTOR_SIZE);
+		stats.eraseCounts[operation.offset / FLASH_SECTOR_SIZE]++;
+		stats.busyTime_ns += eraseTime_ns;
+	}
+	else
+	{
+		memcpy(bank + operation.offset, operation.data, FLASH_WORD_BYTES);
+		stats.programCount++;
+		stats.busyTime_ns += programTime_ns;
+	}
+	operation.isPending = false;
+	operation.isCompleted = true;
+	RtosHost_SetPendingIRQ(FLASH_IRQn);
+}
+
+/**
+ * @brief Map the flash file at the address of the flash bank 1 and register the flash interrupt.
+ * @note Call after <b>RtosHost_Init()</b> and before the initialization of the state storage.
+ * @param path Path of the flash file. Created in the erased state if not present.
+ * @return 0 if successful else -1 with errno set.
+ */
+int FlashHost_Open(const char* path)
+{
+	void* map = mmap(registers, PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+	if (map == MAP_FAILED)
+		return -1;
+	if (map != registers)
+	{
+		munmap(map, PAGE_SIZE);
+		errno = EEXIST;
+		return -1;
+	}
+	flashFd = open(path, O_RDWR | O_CREAT, 0600);
+	if (flashFd < 0)
+		goto error;
+	struct stat st;
+	bool isNew = fstat(flashFd, &st) == 0 && st.st_size == 0;
+	if (ftruncate(flashFd, BANK_SIZE) != 0)
+		goto error;
+	map = mmap(bank, BANK_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED_NOREPLACE, flashFd, 0);
+	if (map == MAP_FAILED)
+		goto error;
+	// Older kernels treat the address as a hint only
+	if (map != bank)
+	{
+		munmap(map, BANK_SIZE);
+		errno = EEXIST;
+		goto error;
+	}
+	if (isNew)
+		memset(bank, 0xFF, BANK_SIZE);
+	RtosHost_SetVector(FLASH_IRQn, FLASH_IRQHandler);
+	RtosHost_AddTimer(&completionTimer, CompleteOperation, FLASH_IRQn, 0, UINT64_MAX);
+	return 0;
+error:
+	{
+		int err = errno;
+		if (flashFd >= 0)
+			close(flashFd);
+		flashFd = -1;
+		munmap(registers, PAGE_SIZE);
+		errno = err;
+	}
+	return -1;
+}
+
+/**
+ * @brief Remove the mapping of the flash file, writing the programmed data to the file.
+ */
+void FlashHost_Close(void)
+{
+	msync(bank, BANK_SIZE, MS_SYNC);
+	munmap(bank, BANK_SIZE);
+	munmap(registers, PAGE_SIZE);
+	close(flashFd);
+	flashFd = -1;
+}
+
+/**
+ * @brief Set the durations of the flash operations.
+ * @param _programTime_ns Time taken to program a flash word in nano-seconds.
+ * @param _eraseTime_ns Time taken to erase a sector in nano-seconds.
+ */
+void FlashHost_SetTimings(uint64_t _programTime_ns, uint64_t _eraseTime_ns)
+{
+	programTime_ns = _programTime_ns;
+	eraseTime_ns = _eraseTime_ns;
+}
+
+/**
+ * @brief Check if a flash operation is in progress.
+ * @return <c>true</c> if the flash is busy.
+ */
+bool FlashHost_IsBusy(void)
+{
+	return operation.isPending;
+}
+
+/**
+ * @brief Get the operation counters of the emulated flash.
+ * @param _stats Structure to be filled with the counters.
+ */
+void FlashHost_GetStats(flash_host_stats_t* _stats)
+{
+	*_stats = stats;
+}
+
+/********************************************************************************
+ * Emulated HAL
+ *******************************************************************************/
+HAL_StatusTypeDef HAL_FLASH_Unlock(void)
+{
+	return HAL_OK;
+}
+
+/**
+ * @brief Start programming a flash word, failing if busy, not aligned, outside the bank or already programmed.
+ * @details The data is latched at the start, as it is by the write buffer of the flash.
+ */
+HAL_StatusTypeDef HAL_FLASH_Program_IT(uint32_t TypeProgram, uint32_t FlashAddress, uint32_t DataAddress)
+{
+	if (operation.isPending)
+		return HAL_BUSY;
+	uint32_t offset = FlashAddress - FLASH_BANK1_BASE;
+	if (TypeProgram != FLASH_TYPEPROGRAM_FLASHWORD || FlashAddress < FLASH_BANK1_BASE ||
+			offset >= BANK_SIZE || (offset % FLASH_WORD_BYTES) != 0)
+	{
+		stats.errorCount++;
+		return HAL_ERROR;
+	}
+	for (int i = 0; i < FLASH_WORD_BYTES; i++)
+	{
+		if (bank[offset + i] != 0xFF)
+		{
+			stats.errorCount++;
+			return HAL_ERROR;
+		}
+	}
+	operation.isPending = true;
+	operation.isErase = false;
+	operation.offset = offset;
+	operation.returnValue = FlashAddress;
+	memcpy(operation.data, (const void*)(uintptr_t)DataAddress, FLASH_WORD_BYTES);
+	RtosHost_StartTimer(&completionTimer, RtosHost_GetTime_ns() + programTime_ns);
+	return HAL_OK;
+}
+
+/**
+ * @brief Start erasing a single sector of the bank 1.
+ */
+HAL_StatusTypeDef HAL_FLASHEx_Erase_IT(FLASH_EraseInitTypeDef* pEraseInit)
+{
+	if (operation.isPending)
+		return HAL_BUSY;
+	if (pEraseInit->TypeErase != FLASH_TYPEERASE_SECTORS || pEraseInit->Banks != FLASH_BANK_1 ||
+			pEraseInit->NbSectors != 1 || pEraseInit->Sector >= FLASH_SECTOR_TOTAL)
+	{
+		stats.errorCount++;
+		return HAL_ERROR;
+	}
+	operation.isPending = true;
+	operation.isErase = true;
+	operation.offset = pEraseInit->Sector * FLASH_SECTOR_SIZE;
+	operation.returnValue = 0xFFFFFFFFU;
+	RtosHost_StartTimer(&completionTimer, RtosHost_GetTime_ns() + eraseTime_ns);
+	return HAL_OK;
+}
+
+/**
+ * @brief Report the completed operation to the HAL callbacks.
+ */
+void HAL_FLASH_IRQHandler(void)
+{
+	if (!operation.isCompleted)
+		return;
+	operation.isCompleted = false;
+	HAL_FLASH_EndOfOperationCallback(operation.returnValue);
+}
+
+/* EOF */
@@ -0,0 +1,137 @@
+/**
+ ********************************************************************************
+ * @file 		flash_host.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    File backed flash in the virtual time of the RTOS host
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef FLASH_HOST_H_
+#define FLASH_HOST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup Flash_Host Flash Host
+ * @brief Emulates the flash bank 1 of the controller with a memory-mapped file, for the CM4 tasks on the PC.
+ * @details The file is mapped at <b>FLASH_BANK1_BASE</b> and the flash registers at <b>FLASH_R_BASE</b>, so the
+ * state storage runs unchanged with the sectors configured by the applications. The interrupt mode of the HAL is
+ * emulated with the same rules as the flash emulator of the storage bench: <b>HAL_FLASHEx_Erase_IT()</b> erases a
+ * single sector and <b>HAL_FLASH_Program_IT()</b> programs an aligned and erased flash word of 32 bytes.
+ *
+ * Each operation completes after its duration in the virtual time of @ref RtosHost, raising <b>FLASH_IRQn</b>
+ * through the emulated NVIC, so the flash interrupt runs when enabled with <b>HAL_NVIC_EnableIRQ()</b>.
+ * @{
+ */
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdbool.h>
+#include "stm32h7xx_hal.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** @defgroup FlashHost_Exported_Macros Macros
+ * @{
+ */
+/**
+ * @brief Default time taken to program a flash word in nano-seconds
+ */
+#define FLASH_HOST_PROGRAM_TIME_ns			(20000ULL)
+/**
+ * @brief Default time taken to erase a sector in nano-seconds
+ */
+#define FLASH_HOST_ERASE_TIME_ns			(1000000000ULL)
+/**
+ * @}
+ */
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/** @defgroup FlashHost_Exported_Structures Structures
+ * @{
+ */
+/**
+ * @brief Operation counters of the emulated flash
+ */
+typedef struct
+{
+	uint32_t eraseCounts[FLASH_SECTOR_TOTAL];	/**< @brief No of erases of each sector */
+	uint32_t programCount;						/**< @brief No of programmed flash words */
+	uint32_t errorCount;						/**< @brief No of rejected operations */
+	uint64_t busyTime_ns;						/**< @brief Total duration of the completed operations in nano-seconds */
+} flash_host_stats_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+/** @defgroup FlashHost_Exported_Functions Functions
+ * @{
+ */
+/**
+ * @brief Map the flash file at the address of the flash bank 1 and register the flash interrupt.
+ * @note Call after <b>RtosHost_Init()</b> and before the initialization of the state storage.
+ * @param path Path of the flash file. Created in the erased state if not present.
+ * @return 0 if successful else -1 with errno set.
+ */
+extern int FlashHost_Open(const char* path);
+/**
+ * @brief Remove the mapping of the flash file, writing the programmed data to the file.
+ */
+extern void FlashHost_Close(void);
+/**
+ * @brief Set the durations of the flash operations.
+ * @param programTime_ns Time taken to program a flash word in nano-seconds.
+ * @param eraseTime_ns Time taken to erase a sector in nano-seconds.
+ */
+extern void FlashHost_SetTimings(uint64_t programTime_ns, uint64_t eraseTime_ns);
+/**
+ * @brief Check if a flash operation is in progress.
+ * @return <c>true</c> if the flash is busy.
+ */
+extern bool FlashHost_IsBusy(void);
+/**
+ * @brief Get the operation counters of the emulated flash.
+ * @param stats Structure to be filled with the counters.
+ */
+extern void FlashHost_GetStats(flash_host_stats_t* stats);
+/**
+ * @}
+ */
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+
+/**
+ * @}
+ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */
@@ -0,0 +1,238 @@
+/**
+ ********************************************************************************
+ * @file 		headless_display.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Display driver of the BSP without the display hardware, for the CM4 tasks on the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include "headless_display.h"
+#include "pecontroller_display.h"
+#include "pecontroller_display_flush.h"
+#include "pecontroller_ts.h"
+#include "clut_data.h"
+#include "lvgl.h"
+#include "lv_theme_taraz.h"
+#include "screen_data.h"
+#include "screen_manager.h"
+#include "shared_memory.h"
+#include "cmsis_os.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+/**
+ * @brief Input device of the touch screen
+ */
+static lv_indev_t* touchIndev = NULL;
+/**
+ * @brief Task waiting for the display events
+ */
+static osThreadId_t volatile displayTask = NULL;
+/**
+ * @brief Tick of LVGL at the last touch
+ */
+static uint32_t lastTouchTick = 0;
+/**
+ * @brief Pause the reads of the idle touch input, as the display driver of the BSP
+ */
+static bool isTouchPauseEnabled = true;
+static headless_display_stats_t stats;
+static void (*frameCallback)(void) = NULL;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+uint8_t frame_buff[DISPLAY_HEIGHT_RAM][DISPLAY_WIDTH_RAM];
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Same as the input device of the BSP.
+ */
+static void ReadTouchPad(struct _lv_indev_drv_t * indev, lv_indev_data_t * data)
+{
+	TS_StateTypeDef event;
+	TS_StateTypeDef* state = BSP_TS_GetEvent(&event) ? &event : BSP_TS_GetState();
+	data->continue_reading = BSP_TS_IsEventPending();
+	if (state->touchDetected)
+	{
+		data->state = LV_INDEV_STATE_PRESSED;
+		data->point.x = state->touchX;
+		data->point.y = state->touchY;
+	}
+	else
+		data->state = LV_INDEV_STATE_RELEASED;
+	stats.touchReads++;
+	if (state->touchDetected || data->continue_reading)
+		lastTouchTick = lv_tick_get();
+	else if (isTouchPauseEnabled && lv_tick_elaps(lastTouchTick) > DISPLAY_TOUCH_IDLE_ms)
+		lv_timer_pause(indev->read_timer);
+}
+
+/**
+ * @brief Same conversion as the display driver of the BSP with the 180 degrees rotation fused in the flush.
+ */
+static void FlushLVGLScreen(lv_disp_drv_t * disp, const lv_area_t * area, lv_color_t * color_p)
+{
+	DisplayFlush_ConvertArea((uint8_t*)frame_buff, DISPLAY_WIDTH_RAM, DISPLAY_HEIGHT_RAM, area->x1, area->y1, area->x2, area->y2,
+			(const uint16_t*)color_p, color_map, true);
+	writeAtScreenEnd = ((DISPLAY_WIDTH - 1 - area->x1) > DISPLAY_WIDTH - 30);
+	stats.flushCount++;
+	stats.flushedPixels += (uint64_t)lv_area_get_width(area) * lv_area_get_height(area);
+	bool isLast = lv_disp_flush_is_last(disp);
+	lv_disp_flush_ready(disp);
+	if (isLast)
+	{
+		stats.frameCount++;
+		if (frameCallback)
+			frameCallback();
+	}
+}
+
+/**
+ * @brief The LTDC layers are not emulated.
+ */
+static void LayerDisplay(ltdc_layer_info_t* layerInfo, int layerIdx)
+{
+}
+
+/**
+ * @brief Initialize LVGL, register the headless display and initialize the screens.
+ */
+void BSP_Display_Init(void)
+{
+	lv_init();
+	static lv_disp_draw_buf_t disp_buf;
+	static lv_color_t lv_buff[LVGL_BUFF_SIZE];
+	lv_disp_draw_buf_init(&disp_buf, lv_buff, NULL, LVGL_BUFF_SIZE);
+
+	static lv_disp_drv_t disp_drv;
+	lv_disp_drv_init(&disp_drv);
+	disp_drv.flush_cb = FlushLVGLScreen;
+	disp_drv.draw_buf = &disp_buf;
+	disp_drv.hor_res = DISPLAY_WIDTH;
+	disp_drv.ver_res = DISPLAY_HEIGHT;
+	disp_drv.rotated = LV_DISP_ROT_180;
+	disp_drv.sw_rotate = 0;
+	lv_disp_t* disp = lv_disp_drv_register(&disp_drv);
+	disp->theme = lv_theme_taraz_init(disp, lv_color_make(0, 100, 100), lv_color_make(0, 200, 200), true, LV_FONT_DEFAULT);
+
+	static lv_indev_drv_t indev_drv;
+	lv_indev_drv_init(&indev_drv);
+	indev_drv.type = LV_INDEV_TYPE_POINTER;
+	indev_drv.read_cb = ReadTouchPad;
+	touchIndev = lv_indev_drv_register(&indev_drv);
+
+	ScreenManager_Init(LayerDisplay, (adc_info_t*)&ADC_INFO);
+}
+
+/**
+ * @brief Wake the display task with the given events.
+ * @note Can be called from the interrupts. The events sent before the display task starts waiting are ignored.
+ * @param events Events to be signaled, e.g. @ref DISPLAY_EVENT_TOUCH.
+ */
+void BSP_Display_NotifyEvents(uint32_t events)
+{
+	osThreadId_t task = displayTask;
+	if (task != NULL)
+		osThreadFlagsSet(task, events & DISPLAY_EVENT_ALL);
+}
+
+/**
+ * @brief Wait for the events of the display, and prepare LVGL to handle them in the next call of lv_timer_handler().
+ * @note Call from the display task only.
+ * @param timeout Maximum time to wait in ticks, e.g. the time till the next timer of LVGL.
+ * @return Mask of the received events. 0 if the timeout elapsed.
+ */
+uint32_t BSP_Display_WaitForEvents(uint32_t timeout)
+{
+	displayTask = osThreadGetId();
+	uint32_t events = osThreadFlagsWait(DISPLAY_EVENT_ALL, osFlagsWaitAny, timeout);
+	if (events & osFlagsError)
+		return 0;
+	// read the new touch events right away
+	if ((events & DISPLAY_EVENT_TOUCH) && touchIndev != NULL)
+	{
+		lastTouchTick = lv_tick_get();
+		lv_timer_resume(touchIndev->driver->read_timer);
+		lv_timer_ready(touchIndev->driver->read_timer);
+	}
+	// draw the new statistics once the screens show them, instead of at the next refresh period of LVGL
+	if (events & DISPLAY_EVENT_STATS)
+	{
+		lv_disp_t* disp = lv_disp_get_default();
+		if (disp != NULL && disp->refr_timer != NULL)
+			lv_timer_ready(disp->refr_timer);
+	}
+	return events;
+}
+
+/**
+ * @brief Enable or disable the pause of the reads of the idle touch input.
+ * @details Disable to emulate the display driver preceding the events of the display task, whose input device
+ * is read at every period of LVGL.
+ * @param isEnabled <c>true</c> to pause the reads as the display driver of the BSP, which is the default.
+ */
+void HeadlessDisplay_EnableTouchPause(bool isEnabled)
+{
+	isTouchPauseEnabled = isEnabled;
+}
+
+/**
+ * @brief Set a function called after the last area of each frame is flushed.
+ * @param callback Function to be called. NULL to remove.
+ */
+void HeadlessDisplay_SetFrameCallback(void (*callback)(void))
+{
+	frameCallback = callback;
+}
+
+/**
+ * @brief Get the statistics of the rendering.
+ * @param _stats Structure to be filled.
+ */
+void HeadlessDisplay_GetStats(headless_display_stats_t* _stats)
+{
+	*_stats = stats;
+}
+
+/**
+ * @brief The license of intelliSENS is not available on the PC.
+ */
+const char* intelliSENS_GetLicenseNumberString(void)
+{
+	return "Host";
+}
+
+/* EOF */
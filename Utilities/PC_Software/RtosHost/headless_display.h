@@ -0,0 +1,111 @@
+/**
+ ********************************************************************************
+ * @file 		headless_display.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Display driver of the BSP without the display hardware, for the CM4 tasks on the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef HEADLESS_DISPLAY_H_
+#define HEADLESS_DISPLAY_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup Headless_Display Headless Display
+ * @brief Replaces the display driver of the BSP (pecontroller_display.c) when the CM4 tasks run on the PC.
+ * @details LVGL is registered in the same way as by the display driver of the BSP, with the same flush kernels
+ * converting the rendered areas to the L8 frame buffer, but the LTDC is not emulated.
+ * The events of the display task and the pause of the idle touch input work as in the BSP, so the display task of
+ * the application runs unchanged. The touch input comes from the emulated touch screen driver of @ref Touch_Panel.
+ * @{
+ */
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/** @defgroup HeadlessDisplay_Exported_Structures Structures
+ * @{
+ */
+/**
+ * @brief Statistics of the rendering
+ */
+typedef struct
+{
+	uint32_t frameCount;			/**< @brief No of frames, i.e. refreshes of LVGL flushing areas */
+	uint32_t flushCount;			/**< @brief No of flushed areas */
+	uint64_t flushedPixels;			/**< @brief Total pixels of the flushed areas */
+	uint32_t touchReads;			/**< @brief No of reads of the touch input by LVGL */
+} headless_display_stats_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+/** @defgroup HeadlessDisplay_Exported_Functions Functions
+ * @{
+ */
+/**
+ * @brief Enable or disable the pause of the reads of the idle touch input.
+ * @details Disable to emulate the display driver preceding the events of the display task, whose input device
+ * is read at every period of LVGL.
+ * @param isEnabled <c>true</c> to pause the reads as the display driver of the BSP, which is the default.
+ */
+extern void HeadlessDisplay_EnableTouchPause(bool isEnabled);
+/**
+ * @brief Set a function called after the last area of each frame is flushed.
+ * @param callback Function to be called. NULL to remove.
+ */
+extern void HeadlessDisplay_SetFrameCallback(void (*callback)(void));
+/**
+ * @brief Get the statistics of the rendering.
+ * @param stats Structure to be filled.
+ */
+extern void HeadlessDisplay_GetStats(headless_display_stats_t* stats);
+/**
+ * @}
+ */
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+
+/**
+ * @}
+ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */
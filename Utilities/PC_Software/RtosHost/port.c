@@ -0,0 +1,472 @@
+/**
+ ********************************************************************************
+ * @file 		port.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    FreeRTOS port of the PC running the tasks in virtual time
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <ucontext.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stm32h7xx.h"
+#include "rtos_host.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+#define TICK_PERIOD_ns					(1000000000ULL / configTICK_RATE_HZ)
+/**
+ * @brief Exception number of the interrupts as reported by the IPSR
+ */
+#define IRQ_TO_EXCEPTION(irqn)			((uint32_t)((irqn) + 16))
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief Context of a task on the PC, referenced by the top of the stack of its TCB
+ */
+typedef struct
+{
+	ucontext_t ctx;						/**< @brief Saved context of the task */
+	TaskFunction_t code;				/**< @brief Function of the task */
+	void* params;						/**< @brief Parameters of the function */
+	void* stack;						/**< @brief Stack on the PC */
+	rtos_host_task_stats_t stats;		/**< @brief Statistics of the task */
+} host_task_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+/**
+ * @brief Context of the caller of the scheduler, restored when the scheduler ends
+ */
+static ucontext_t schedulerCtx;
+static volatile UBaseType_t criticalNesting = 0;
+static bool isYieldPending = false;
+static bool isStopRequested = false;
+/**
+ * @brief Masks the interrupts as the BASEPRI register of the Cortex-M ports
+ */
+static bool isInterruptMasked = false;
+static uint32_t primask = 0;
+static uint32_t ipsr = 0;
+static uint64_t time_ns = 0;
+static uint64_t nextTick_ns = TICK_PERIOD_ns;
+static uint64_t stopTime_ns = UINT64_MAX;
+static double cpuScale = 0;
+static uint64_t lastCpuTime_ns = 0;
+static rtos_host_timer_t* timers = NULL;
+static void (*vectors[RTOS_HOST_IRQ_COUNT])(void);
+static bool isIrqEnabled[RTOS_HOST_IRQ_COUNT];
+static bool isIrqPending[RTOS_HOST_IRQ_COUNT];
+static rtos_host_stats_t stats;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+/**
+ * @brief TCB of the running task, defined by tasks.c. Its first member is the top of the stack.
+ */
+extern void* volatile pxCurrentTCB;
+/**
+ * @brief SysTick handler of the CMSIS-RTOS2 layer, if linked
+ */
+extern void SysTick_Handler(void) __attribute__((weak));
+extern void xPortSysTickHandler(void);
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static inline host_task_t* GetTask(void* tcb)
+{
+	return *(host_task_t**)(*(StackType_t**)tcb);
+}
+
+static uint64_t GetCpuTime_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+	return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/**
+ * @brief Make the DWT cycle counter follow the virtual time.
+ */
+static void UpdateCycleCounter(void)
+{
+	DWT->CYCCNT = (uint32_t)(uint64_t)(time_ns * ((double)configCPU_CLOCK_HZ / 1e9));
+}
+
+static void RunHandler(int irqn, void (*handler)(void))
+{
+	uint32_t lastIpsr = ipsr;
+	ipsr = IRQ_TO_EXCEPTION(irqn);
+	handler();
+	ipsr = lastIpsr;
+}
+
+/**
+ * @brief Run the enabled pending interrupts, in the order of their numbers.
+ */
+static void DispatchInterrupts(void)
+{
+	for (int i = 0; i < RTOS_HOST_IRQ_COUNT; i++)
+	{
+		if (isInterruptMasked || primask)
+			return;
+		if (!isIrqPending[i] || !isIrqEnabled[i] || vectors[i] == NULL)
+			continue;
+		isIrqPending[i] = false;
+		stats.interrupts++;
+		RunHandler(i, vectors[i]);
+		// the handler may have raised a lower interrupt
+		i = -1;
+	}
+}
+
+static uint64_t GetNextEventTime(void)
+{
+	uint64_t next = nextTick_ns < stopTime_ns ? nextTick_ns : stopTime_ns;
+	for (rtos_host_timer_t* timer = timers; timer != NULL; timer = timer->next)
+		if (timer->next_ns < next)
+			next = timer->next_ns;
+	return next;
+}
+
+/**
+ * @brief Run the events due till the given time in their order, and advance the virtual time to it.
+ */
+static void ProcessEvents(uint64_t until_ns)
+{
+	DispatchInterrupts();
+	while (!isInterruptMasked && !primask)
+	{
+		uint64_t next = GetNextEventTime();
+		if (next > until_ns)
+			break;
+		// the events of a masked period are late
+		if (next > time_ns)
+			time_ns = next;
+		UpdateCycleCounter();
+		if (next >= stopTime_ns)
+		{
+			isStopRequested = true;
+			stopTime_ns = UINT64_MAX;
+		}
+		if (next == nextTick_ns)
+		{
+			nextTick_ns += TICK_PERIOD_ns;
+			stats.ticks++;
+			RunHandler(SysTick_IRQn, SysTick_Handler ? SysTick_Handler : xPortSysTickHandler);
+		}
+		for (rtos_host_timer_t* timer = timers; timer != NULL; timer = timer->next)
+		{
+			if (timer->next_ns != next)
+				continue;
+			timer->next_ns = timer->period_ns != 0 ? timer->next_ns + timer->period_ns : UINT64_MAX;
+			stats.interrupts++;
+			RunHandler(timer->irqn, timer->handler);
+		}
+		DispatchInterrupts();
+	}
+	if (until_ns > time_ns)
+		time_ns = until_ns;
+	UpdateCycleCounter();
+}
+
+/**
+ * @brief Enter the port from the running code, charging the CPU time used since leaving it and running the events
+ * due till now.
+ */
+static void Enter(void)
+{
+	if (cpuScale > 0)
+	{
+		uint64_t cpuTime = GetCpuTime_ns();
+		uint64_t elapsed = (uint64_t)((cpuTime - lastCpuTime_ns) * cpuScale);
+		time_ns += elapsed;
+		if (pxCurrentTCB != NULL)
+			GetTask(pxCurrentTCB)->stats.runTime_ns += elapsed;
+	}
+	ProcessEvents(time_ns);
+}
+
+/**
+ * @brief Leave the port, so the CPU time used by the running code is charged from now on.
+ */
+static void Leave(void)
+{
+	if (cpuScale > 0)
+		lastCpuTime_ns = GetCpuTime_ns();
+}
+
+/**
+ * @brief Switch to the task selected by the kernel.
+ * @details Only the idle task being ready means that all tasks wait for an event, so the time skips to the next
+ * event till another task becomes ready.
+ */
+static void Switch(void)
+{
+	void* from = pxCurrentTCB;
+	TaskHandle_t idle = xTaskGetIdleTaskHandle();
+	isYieldPending = false;
+	while (1)
+	{
+		if (isStopRequested)
+			vTaskEndScheduler();
+		vTaskSwitchContext();
+		if (pxCurrentTCB != (void*)idle || from != (void*)idle)
+			break;
+		stats.idleSleeps++;
+		ProcessEvents(GetNextEventTime());
+	}
+	if (pxCurrentTCB == from)
+		return;
+	stats.contextSwitches++;
+	host_task_t* task = GetTask(pxCurrentTCB);
+	task->stats.switchIns++;
+	swapcontext(&GetTask(from)->ctx, &task->ctx);
+}
+
+static void TaskEntry(void)
+{
+	host_task_t* task = GetTask(pxCurrentTCB);
+	isInterruptMasked = false;
+	Leave();
+	task->code(task->params);
+	fprintf(stderr, "Task %s returned from its function\n", pcTaskGetName(NULL));
+	abort();
+}
+
+StackType_t* pxPortInitialiseStack(StackType_t* pxTopOfStack, TaskFunction_t pxCode, void* pvParameters)
+{
+	host_task_t* task = calloc(1, sizeof(host_task_t));
+	if (task == NULL || (task->stack = malloc(RTOS_HOST_TASK_STACK_SIZE)) == NULL)
+	{
+		fprintf(stderr, "No memory for the stack of a task\n");
+		abort();
+	}
+	task->code = pxCode;
+	task->params = pvParameters;
+	getcontext(&task->ctx);
+	task->ctx.uc_stack.ss_sp = task->stack;
+	task->ctx.uc_stack.ss_size = RTOS_HOST_TASK_STACK_SIZE;
+	task->ctx.uc_link = NULL;
+	makecontext(&task->ctx, TaskEntry, 0);
+	// the top of the stack only references the context of the task on the PC
+	*--pxTopOfStack = (StackType_t)task;
+	return pxTopOfStack;
+}
+
+void vPortCleanUpTCB(void* pxTCB)
+{
+	host_task_t* task = GetTask(pxTCB);
+	free(task->stack);
+	free(task);
+}
+
+BaseType_t xPortStartScheduler(void)
+{
+	nextTick_ns = time_ns + TICK_PERIOD_ns;
+	criticalNesting = 0;
+	isStopRequested = false;
+	UpdateCycleCounter();
+	host_task_t* task = GetTask(pxCurrentTCB);
+	task->stats.switchIns++;
+	swapcontext(&schedulerCtx, &task->ctx);
+	// only reached once the scheduler ends
+	criticalNesting = 0;
+	isInterruptMasked = false;
+	return pdFALSE;
+}
+
+void vPortEndScheduler(void)
+{
+	swapcontext(&GetTask(pxCurrentTCB)->ctx, &schedulerCtx);
+}
+
+void vPortYield(void)
+{
+	// pended like the PendSV, till the end of the critical section or of the interrupt
+	if (criticalNesting != 0 || ipsr != 0)
+	{
+		isYieldPending = true;
+		return;
+	}
+	Enter();
+	Switch();
+	Leave();
+}
+
+void vPortYieldFromISR(void)
+{
+	isYieldPending = true;
+}
+
+void vPortDisableInterrupts(void)
+{
+	isInterruptMasked = true;
+}
+
+void vPortEnableInterrupts(void)
+{
+	isInterruptMasked = false;
+}
+
+void vPortEnterCritical(void)
+{
+	isInterruptMasked = true;
+	criticalNesting++;
+}
+
+void vPortExitCritical(void)
+{
+	if (--criticalNesting != 0)
+		return;
+	isInterruptMasked = false;
+	if (isYieldPending && ipsr == 0)
+		vPortYield();
+}
+
+uint32_t ulPortSetInterruptMask(void)
+{
+	uint32_t mask = isInterruptMasked;
+	isInterruptMasked = true;
+	return mask;
+}
+
+void vPortClearInterruptMask(uint32_t ulNewMask)
+{
+	isInterruptMasked = ulNewMask != 0;
+}
+
+void xPortSysTickHandler(void)
+{
+	uint32_t mask = ulPortSetInterruptMask();
+	if (xTaskIncrementTick() != pdFALSE)
+		vPortYieldFromISR();
+	vPortClearInterruptMask(mask);
+}
+
+/********************************************************************************
+ * CMSIS intrinsics
+ *******************************************************************************/
+uint32_t __get_IPSR(void)
+{
+	return ipsr;
+}
+
+uint32_t __get_PRIMASK(void)
+{
+	return primask;
+}
+
+void __disable_irq(void)
+{
+	primask = 1;
+}
+
+void __enable_irq(void)
+{
+	primask = 0;
+}
+
+/********************************************************************************
+ * Virtual time and interrupts
+ *******************************************************************************/
+void RtosHost_SetCpuScale(float scale)
+{
+	cpuScale = scale;
+	lastCpuTime_ns = GetCpuTime_ns();
+}
+
+uint64_t RtosHost_GetTime_ns(void)
+{
+	return time_ns;
+}
+
+void RtosHost_Busy(uint64_t duration_ns)
+{
+	Enter();
+	if (pxCurrentTCB != NULL && ipsr == 0)
+		GetTask(pxCurrentTCB)->stats.runTime_ns += duration_ns;
+	ProcessEvents(time_ns + duration_ns);
+	if (isYieldPending && criticalNesting == 0 && ipsr == 0 && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+		Switch();
+	Leave();
+}
+
+void RtosHost_AddTimer(rtos_host_timer_t* timer, void (*handler)(void), int irqn, uint64_t period_ns, uint64_t start_ns)
+{
+	timer->handler = handler;
+	timer->irqn = irqn;
+	timer->period_ns = period_ns;
+	timer->next_ns = start_ns;
+	timer->next = timers;
+	timers = timer;
+}
+
+void RtosHost_StartTimer(rtos_host_timer_t* timer, uint64_t start_ns)
+{
+	timer->next_ns = start_ns;
+}
+
+void RtosHost_SetVector(int irqn, void (*handler)(void))
+{
+	vectors[irqn] = handler;
+}
+
+void RtosHost_EnableIRQ(int irqn, bool isEnabled)
+{
+	isIrqEnabled[irqn] = isEnabled;
+}
+
+void RtosHost_SetPendingIRQ(int irqn)
+{
+	isIrqPending[irqn] = true;
+	// raised by an interrupt, e.g. the emulated CM7 core, so it runs right after it
+	if (ipsr != 0)
+		DispatchInterrupts();
+}
+
+void RtosHost_SetStopTime(uint64_t stop_ns)
+{
+	stopTime_ns = stop_ns;
+}
+
+void RtosHost_GetStats(rtos_host_stats_t* _stats)
+{
+	*_stats = stats;
+}
+
+void RtosHost_GetTaskStats(void* handle, rtos_host_task_stats_t* _stats)
+{
+	*_stats = GetTask(handle)->stats;
+}
+
+/* EOF */
@@ -0,0 +1,101 @@
+/**
+ ********************************************************************************
+ * @file 		portmacro.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    FreeRTOS port of the PC running the tasks in virtual time
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef PORTMACRO_H_
+#define PORTMACRO_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdint.h>
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/* Type definitions */
+#define portCHAR						char
+#define portFLOAT						float
+#define portDOUBLE						double
+#define portLONG						long
+#define portSHORT						short
+#define portSTACK_TYPE					uintptr_t
+#define portBASE_TYPE					long
+#define portPOINTER_SIZE_TYPE			uintptr_t
+
+typedef portSTACK_TYPE StackType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+
+#if (configUSE_16_BIT_TICKS == 1)
+#error "The host port only supports 32-bit ticks."
+#endif
+typedef uint32_t TickType_t;
+#define portMAX_DELAY					((TickType_t)0xffffffffUL)
+#define portTICK_TYPE_IS_ATOMIC			1
+
+/* Architecture specifics */
+#define portSTACK_GROWTH				(-1)
+#define portTICK_PERIOD_MS				((TickType_t)1000 / configTICK_RATE_HZ)
+#define portBYTE_ALIGNMENT				16
+#define portNOP()
+#define portMEMORY_BARRIER()			__sync_synchronize()
+
+/* Scheduler utilities, the yields inside the critical sections are pended as the PendSV of the Cortex-M ports */
+#define portYIELD()						vPortYield()
+#define portEND_SWITCHING_ISR(x)		do { if (x) vPortYieldFromISR(); } while (0)
+#define portYIELD_FROM_ISR(x)			portEND_SWITCHING_ISR(x)
+
+/* Critical section management */
+#define portDISABLE_INTERRUPTS()		vPortDisableInterrupts()
+#define portENABLE_INTERRUPTS()			vPortEnableInterrupts()
+#define portENTER_CRITICAL()			vPortEnterCritical()
+#define portEXIT_CRITICAL()				vPortExitCritical()
+#define portSET_INTERRUPT_MASK_FROM_ISR()		ulPortSetInterruptMask()
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)	vPortClearInterruptMask(x)
+
+/* Task function macros as described on the FreeRTOS.org WEB site */
+#define portTASK_FUNCTION_PROTO(vFunction, pvParameters)	void vFunction(void *pvParameters)
+#define portTASK_FUNCTION(vFunction, pvParameters)			void vFunction(void *pvParameters)
+
+/* Each task runs on its own stack allocated by the port, which is freed with the task */
+#define portCLEAN_UP_TCB(pxTCB)			vPortCleanUpTCB(pxTCB)
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+extern void vPortYield(void);
+extern void vPortYieldFromISR(void);
+extern void vPortDisableInterrupts(void);
+extern void vPortEnableInterrupts(void);
+extern void vPortEnterCritical(void);
+extern void vPortExitCritical(void);
+extern uint32_t ulPortSetInterruptMask(void);
+extern void vPortClearInterruptMask(uint32_t ulNewMask);
+extern void vPortCleanUpTCB(void* pxTCB);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */
@@ -0,0 +1,532 @@
+/**
+ ********************************************************************************
+ * @file 		rtos_bench.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Compares the wake-ups and the latencies of the polling and the event driven tasks of the CM4 core
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cmsis_os.h"
+#include "rtos_host.h"
+#include "headless_display.h"
+#include "touch_panel.h"
+#include "user_config.h"
+#include "shared_memory.h"
+#include "task_telemetry.h"
+#include "pecontroller_adc.h"
+#include "pecontroller_display.h"
+#include "pecontroller_ts.h"
+#include "screen_manager.h"
+#include "lvgl.h"
+#include "stm32h7xx_hal.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/**
+ * @brief Period of the publication of the records by the emulated CM7 core
+ */
+#define PRODUCER_PERIOD_ns				(100000ULL)
+/**
+ * @brief Records published in each period
+ */
+#define PRODUCER_RECORDS				((int)(MONITORING_FREQUENCY_Hz * PRODUCER_PERIOD_ns / 1000000000ULL))
+/**
+ * @brief Frequency, amplitude and offset of the synthetic signals
+ */
+#define SIGNAL_FREQ_Hz					(50)
+#define SIGNAL_AMPLITUDE				(100.f)
+#define SIGNAL_OFFSET					(10.f)
+#define SIGNAL_PERIOD_SAMPLES			(MONITORING_FREQUENCY_Hz / SIGNAL_FREQ_Hz)
+/**
+ * @brief Default warm-up, covering the splash screen, and default measured time
+ */
+#define DEFAULT_WARMUP_s				(5.0)
+#define DEFAULT_DURATION_s				(20.0)
+/**
+ * @brief Default periods of the parameter updates of the CM7 core and of the taps on the screen
+ */
+#define DEFAULT_PARAM_PERIOD_ms			(700)
+#define DEFAULT_TAP_PERIOD_ms			(1000)
+/**
+ * @brief Duration of each tap and its position, in an empty area of the main screen
+ */
+#define TAP_DURATION_ms					(80)
+#define TAP_X							(400)
+#define TAP_Y							(470)
+/* Longest wait of the statistics for a block of ADC records, as in the application */
+#define ADC_RECORDS_WAIT_TIMEOUT_ms		(20)
+/* Storage requests of the event driven application */
+#define STORAGE_REFRESH_THREAD_FLAG		(1UL << 0)
+#define STORAGE_REFRESH_PERIOD_ms		(2000)
+#define STORAGE_REFRESH_DELAY_ms		(100)
+#define MS_TO_NS(x)						((uint64_t)((x) * 1000000.0))
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+/**
+ * @brief Scheduling of the tasks
+ */
+typedef enum
+{
+	MODE_POLL,					/**< @brief Tasks polling at fixed periods, as before the events */
+	MODE_EVENT,					/**< @brief Tasks woken up by the events, as in the applications */
+} bench_mode_t;
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief Accumulated latencies of a path
+ */
+typedef struct
+{
+	uint32_t count;
+	uint64_t total_ns;
+	uint64_t max_ns;
+} latency_t;
+/**
+ * @brief Counters taken at the end of the warm-up
+ */
+typedef struct
+{
+	rtos_host_stats_t rtos;
+	rtos_host_task_stats_t tasks[4];
+	headless_display_stats_t display;
+	touch_panel_stats_t touch;
+} snapshot_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static bench_mode_t mode = MODE_EVENT;
+static uint64_t warmup_ns;
+static osThreadId_t taskHandles[4];
+static const char* taskNames[4] = { "storageTask", "statsTask", "displayTask", "touchTask" };
+static const osThreadAttr_t taskAttributes[4] = {
+		{ .name = "storageTask", .stack_size = 128 * 4, .priority = (osPriority_t) osPriorityLow },
+		{ .name = "statsTask", .stack_size = 1024 * 4, .priority = (osPriority_t) osPriorityHigh7 },
+		{ .name = "displayTask", .stack_size = 512 * 4, .priority = (osPriority_t) osPriorityHigh },
+		{ .name = "touchTask", .stack_size = 256 * 4, .priority = (osPriority_t) osPriorityHigh5 },
+};
+static volatile bool isDispInitialized = false;
+static float signalTable[SIGNAL_PERIOD_SAMPLES];
+static uint64_t producedRecords = 0;
+/**
+ * @brief Records published before the last computation of the statistics
+ */
+static uint64_t processedRecords = 0;
+static rtos_host_timer_t producerTimer, tim7Timer, paramTimer, pressTimer, releaseTimer, snapshotTimer;
+static snapshot_t warm;
+/**
+ * @brief Time of the statistics waiting to be shown, and if the screens were refreshed since then
+ */
+static uint64_t statsPending_ns = 0;
+static bool isStatsRefreshed = false;
+/**
+ * @brief Time of the oldest parameter change not stored yet
+ */
+static uint64_t paramPending_ns = 0;
+static latency_t statsLatency, frameLatency, storageLatency;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static bool IsMeasuring(void)
+{
+	return RtosHost_GetTime_ns() >= warmup_ns;
+}
+
+static void AddLatency(latency_t* latency, uint64_t value_ns)
+{
+	if (!IsMeasuring())
+		return;
+	latency->count++;
+	latency->total_ns += value_ns;
+	if (value_ns > latency->max_ns)
+		latency->max_ns = value_ns;
+}
+
+/**
+ * @brief Time of publication of a record by the emulated CM7 core.
+ */
+static uint64_t GetRecordTime_ns(uint64_t record)
+{
+	return (record / PRODUCER_RECORDS) * PRODUCER_PERIOD_ns;
+}
+
+/**
+ * @brief Publish the records of a period as the ADC core, notifying the CM4 core in the same way.
+ */
+static void ProducerInterrupt(void)
+{
+	static int notifiedIndex = 0;
+	int recordIndex = PROCESSED_ADC_DATA.recordIndex;
+	// amplitude changing every 250 ms, so that each block of the statistics shows new values
+	float gain = 1.f + 0.01f * ((producedRecords / (MONITORING_FREQUENCY_Hz / 4)) % 8);
+	for (int i = 0; i < PRODUCER_RECORDS; i++)
+	{
+		float* record = (float*)&PROCESSED_ADC_DATA.dataRecord[recordIndex];
+		for (int ch = 0; ch < TOTAL_MEASUREMENT_COUNT; ch++)
+			record[ch] = gain * signalTable[(producedRecords + ch * (SIGNAL_PERIOD_SAMPLES / TOTAL_MEASUREMENT_COUNT)) % SIGNAL_PERIOD_SAMPLES];
+		producedRecords++;
+		recordIndex = (recordIndex + 1) & (MEASURE_SAVE_COUNT - 1);
+	}
+	__DMB();
+	PROCESSED_ADC_DATA.recordIndex = recordIndex;
+	if (((recordIndex - notifiedIndex) & (MEASURE_SAVE_COUNT - 1)) < SHARED_MEMORY_ADC_NOTIFY_COUNT)
+		return;
+	notifiedIndex = recordIndex;
+	if (HAL_HSEM_FastTake(SHARED_MEMORY_ADC_HSEM_ID) == HAL_OK)
+		HAL_HSEM_Release(SHARED_MEMORY_ADC_HSEM_ID, 0);
+}
+
+static void Tim7Interrupt(void)
+{
+	HAL_IncTick();
+	if (isDispInitialized)
+		lv_tick_inc(1);
+}
+
+/**
+ * @brief Parameter changed by a transaction completed for the CM4 core.
+ */
+static void ParamInterrupt(void)
+{
+	if (paramPending_ns == 0)
+		paramPending_ns = RtosHost_GetTime_ns();
+	P2PComms_ParametersUpdatedCallback();
+}
+
+static void PressInterrupt(void)
+{
+	TouchPanel_Touch(true, TAP_X, TAP_Y);
+}
+
+static void ReleaseInterrupt(void)
+{
+	TouchPanel_Touch(false, TAP_X, TAP_Y);
+}
+
+static void SnapshotInterrupt(void)
+{
+	RtosHost_GetStats(&warm.rtos);
+	for (int i = 0; i < 4; i++)
+		RtosHost_GetTaskStats(taskHandles[i], &warm.tasks[i]);
+	HeadlessDisplay_GetStats(&warm.display);
+	TouchPanel_GetStats(&warm.touch);
+}
+
+/**
+ * @brief Compute the statistics as the application, measuring the age of the oldest record used by each update of
+ * the statistics, which bounds the delay from the last record of a block of the statistics to its values.
+ * @return Mask of the channels with updated statistics.
+ */
+static uint32_t ComputeStats(void)
+{
+	uint64_t oldestRecord = processedRecords;
+	processedRecords = producedRecords;
+	uint32_t channelMask = BSP_ADC_ComputeStatsInBulk((adc_processed_data_t*)&PROCESSED_ADC_DATA, (float)ADC_INFO.fs);
+	if ((channelMask & 1) == 0)
+		return channelMask;
+	uint64_t now = RtosHost_GetTime_ns();
+	AddLatency(&statsLatency, now - GetRecordTime_ns(oldestRecord));
+	if (statsPending_ns == 0)
+	{
+		statsPending_ns = now;
+		isStatsRefreshed = false;
+	}
+	return channelMask;
+}
+
+/**
+ * @brief Measure the delay from the statistics to the first frame drawn after the screens showed them.
+ */
+static void FrameDone(void)
+{
+	if (statsPending_ns == 0 || !isStatsRefreshed)
+		return;
+	AddLatency(&frameLatency, RtosHost_GetTime_ns() - statsPending_ns);
+	statsPending_ns = 0;
+}
+
+static void RefreshScreens(void)
+{
+	ScreenManager_Refresh();
+	if (statsPending_ns != 0)
+		isStatsRefreshed = true;
+}
+
+/**
+ * @brief Stores the changed states of the application, measuring the delay of the parameter changes.
+ */
+void StateStorage_Refresh(void)
+{
+	if (paramPending_ns == 0)
+		return;
+	AddLatency(&storageLatency, RtosHost_GetTime_ns() - paramPending_ns);
+	paramPending_ns = 0;
+}
+
+void Error_Handler(void)
+{
+	fprintf(stderr, "Error handler called\n");
+	abort();
+}
+
+void P2PComms_ParametersUpdatedCallback(void)
+{
+	if (mode == MODE_EVENT)
+		osThreadFlagsSet(taskHandles[0], STORAGE_REFRESH_THREAD_FLAG);
+}
+
+void ScreenManager_SettingsChangedCallback(void)
+{
+	if (mode == MODE_EVENT)
+		osThreadFlagsSet(taskHandles[0], STORAGE_REFRESH_THREAD_FLAG);
+}
+
+static void StorageTask(void* argument)
+{
+	for (;;)
+	{
+		if (mode == MODE_POLL)
+		{
+			StateStorage_Refresh();
+			osDelay(2000);
+			continue;
+		}
+		uint32_t flags = osThreadFlagsWait(STORAGE_REFRESH_THREAD_FLAG, osFlagsWaitAny, STORAGE_REFRESH_PERIOD_ms);
+		if ((flags & osFlagsError) == 0)
+		{
+			osDelay(STORAGE_REFRESH_DELAY_ms);
+			osThreadFlagsClear(STORAGE_REFRESH_THREAD_FLAG);
+		}
+		StateStorage_Refresh();
+	}
+}
+
+static void StatsTask(void* argument)
+{
+	for (;;)
+	{
+		if (mode == MODE_POLL)
+		{
+			ComputeStats();
+			osDelay(1);
+			continue;
+		}
+		SharedMemory_WaitForAdcRecords(ADC_RECORDS_WAIT_TIMEOUT_ms);
+		if (ComputeStats())
+			BSP_Display_NotifyEvents(DISPLAY_EVENT_STATS);
+	}
+}
+
+static void DisplayTask(void* argument)
+{
+	int i = 0;
+	for (;;)
+	{
+		if (mode == MODE_POLL)
+		{
+			if (++i > 4)
+			{
+				RefreshScreens();
+				i = 0;
+			}
+			lv_timer_handler();
+			osDelay(5);
+			continue;
+		}
+		lv_timer_handler();
+		RefreshScreens();
+		uint32_t timeout = lv_timer_handler();
+		BSP_Display_WaitForEvents(timeout < DISPLAY_POLL_PERIOD_ms ? timeout : DISPLAY_POLL_PERIOD_ms);
+	}
+}
+
+static void TouchTask(void* argument)
+{
+	while (BSP_TS_Init(800, 480) != TS_OK)
+		osDelay(100);
+	for (;;)
+	{
+		BSP_TS_WaitAndProcess();
+		if (mode == MODE_EVENT && BSP_TS_IsEventPending())
+			BSP_Display_NotifyEvents(DISPLAY_EVENT_TOUCH);
+	}
+}
+
+/**
+ * @brief Set the ADC information normally set by the ADC core.
+ */
+static void InitAdcInfo(void)
+{
+	ADC_INFO.fs = MONITORING_FREQUENCY_Hz;
+	for (int i = 0; i < TOTAL_MEASUREMENT_COUNT; i++)
+	{
+		ADC_INFO.units[i] = UNIT_V;
+		ADC_INFO.sensitivity[i] = 1;
+		ADC_INFO.offsets[i] = 0;
+		ADC_INFO.freq[i] = SIGNAL_FREQ_Hz;
+	}
+	for (int i = 0; i < SIGNAL_PERIOD_SAMPLES; i++)
+		signalTable[i] = SIGNAL_OFFSET + SIGNAL_AMPLITUDE * sinf(2 * (float)M_PI * i / SIGNAL_PERIOD_SAMPLES);
+}
+
+static void PrintLatency(const char* name, const latency_t* latency)
+{
+	if (latency->count == 0)
+		printf("%-28s %8d %10s %10s\n", name, 0, "-", "-");
+	else
+		printf("%-28s %8u %10.2f %10.2f\n", name, latency->count, latency->total_ns / 1e6 / latency->count, latency->max_ns / 1e6);
+}
+
+static void PrintResults(double duration_s)
+{
+	rtos_host_stats_t rtos;
+	headless_display_stats_t display;
+	touch_panel_stats_t touch;
+	RtosHost_GetStats(&rtos);
+	HeadlessDisplay_GetStats(&display);
+	TouchPanel_GetStats(&touch);
+
+	printf("Mode: %s, %.1f s measured after %.1f s of warm-up\n", mode == MODE_POLL ? "poll" : "event", duration_s, warmup_ns / 1e9);
+	printf("%-28s %10s %10s\n", "Task", "wakeups/s", "CPU [%]");
+	uint64_t totalWakeups = 0;
+	for (int i = 0; i < 4; i++)
+	{
+		rtos_host_task_stats_t task;
+		RtosHost_GetTaskStats(taskHandles[i], &task);
+		uint64_t wakeups = task.switchIns - warm.tasks[i].switchIns;
+		totalWakeups += wakeups;
+		printf("%-28s %10.1f %10.3f\n", taskNames[i], wakeups / duration_s,
+				(task.runTime_ns - warm.tasks[i].runTime_ns) / (duration_s * 1e7));
+	}
+	printf("%-28s %10.1f\n", "All tasks", totalWakeups / duration_s);
+	printf("%-28s %10.1f\n", "Context switches/s", (rtos.contextSwitches - warm.rtos.contextSwitches) / duration_s);
+	printf("%-28s %10.1f\n", "Idle sleeps/s", (rtos.idleSleeps - warm.rtos.idleSleeps) / duration_s);
+	printf("%-28s %10.1f\n", "Frames/s", (display.frameCount - warm.display.frameCount) / duration_s);
+	printf("%-28s %10.1f\n", "Touch reads/s", (display.touchReads - warm.display.touchReads) / duration_s);
+	printf("%-28s %8s %10s %10s\n", "Latency [ms]", "count", "avg", "max");
+	PrintLatency("Oldest record -> statistics", &statsLatency);
+	PrintLatency("Statistics -> frame", &frameLatency);
+	PrintLatency("Parameter -> storage", &storageLatency);
+	latency_t touchLatency = { .count = touch.readEvents - warm.touch.readEvents,
+			.total_ns = touch.totalLatency_ns - warm.touch.totalLatency_ns, .max_ns = touch.maxLatency_ns };
+	PrintLatency("Touch -> input read", &touchLatency);
+}
+
+static void PrintUsage(const char* name)
+{
+	fprintf(stderr, "usage: %s [-m poll|event] [-t seconds] [-w seconds] [-s cpu-scale] [-p period-ms] [-k period-ms]\n"
+			"  -m  scheduling of the tasks (default event)\n"
+			"  -t  measured virtual time (default %.0f)\n"
+			"  -w  warm-up before the measurement (default %.0f)\n"
+			"  -s  ratio of the speed of the PC to the CM4 core, 0 to run the tasks in no time (default 0)\n"
+			"  -p  period of the parameter updates, 0 to disable (default %d)\n"
+			"  -k  period of the taps on the screen, 0 to disable (default %d)\n", name, DEFAULT_DURATION_s, DEFAULT_WARMUP_s,
+			DEFAULT_PARAM_PERIOD_ms, DEFAULT_TAP_PERIOD_ms);
+}
+
+int main(int argc, char** argv)
+{
+	double duration_s = DEFAULT_DURATION_s;
+	double warmup_s = DEFAULT_WARMUP_s;
+	double cpuScale = 0;
+	int paramPeriod_ms = DEFAULT_PARAM_PERIOD_ms;
+	int tapPeriod_ms = DEFAULT_TAP_PERIOD_ms;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-m") == 0 && i + 1 < argc && strcmp(argv[i + 1], "poll") == 0)
+			mode = MODE_POLL, i++;
+		else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc && strcmp(argv[i + 1], "event") == 0)
+			mode = MODE_EVENT, i++;
+		else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+			duration_s = atof(argv[++i]);
+		else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc)
+			warmup_s = atof(argv[++i]);
+		else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+			cpuScale = atof(argv[++i]);
+		else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+			paramPeriod_ms = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc)
+			tapPeriod_ms = atoi(argv[++i]);
+		else
+		{
+			PrintUsage(argv[0]);
+			return 1;
+		}
+	}
+	if (duration_s <= 0 || warmup_s < 0 || cpuScale < 0 || paramPeriod_ms < 0 || tapPeriod_ms < 0
+			|| (tapPeriod_ms > 0 && tapPeriod_ms <= TAP_DURATION_ms))
+	{
+		PrintUsage(argv[0]);
+		return 1;
+	}
+	if (RtosHost_Init() != 0)
+	{
+		perror("Mapping the memories of the firmware");
+		return 1;
+	}
+	warmup_ns = MS_TO_NS(warmup_s * 1000);
+
+	SharedMemory_Init();
+	InitAdcInfo();
+	if (mode == MODE_EVENT)
+		SharedMemory_InitAdcNotification();
+	BSP_Display_Init();
+	isDispInitialized = true;
+	HeadlessDisplay_EnableTouchPause(mode == MODE_EVENT);
+	HeadlessDisplay_SetFrameCallback(FrameDone);
+	RtosHost_SetCpuScale(cpuScale);
+
+	osKernelInitialize();
+	TaskTelemetry_Init();
+	osThreadFunc_t functions[4] = { StorageTask, StatsTask, DisplayTask, TouchTask };
+	for (int i = 0; i < 4; i++)
+		taskHandles[i] = osThreadNew(functions[i], NULL, &taskAttributes[i]);
+
+	RtosHost_AddTimer(&tim7Timer, Tim7Interrupt, TIM7_IRQn, MS_TO_NS(1), MS_TO_NS(1));
+	RtosHost_AddTimer(&producerTimer, ProducerInterrupt, CM7_SEV_IRQn, PRODUCER_PERIOD_ns, 0);
+	if (paramPeriod_ms > 0)
+		RtosHost_AddTimer(&paramTimer, ParamInterrupt, HSEM2_IRQn, MS_TO_NS(paramPeriod_ms), warmup_ns + MS_TO_NS(paramPeriod_ms));
+	if (tapPeriod_ms > 0)
+	{
+		RtosHost_AddTimer(&pressTimer, PressInterrupt, EXTI2_IRQn, MS_TO_NS(tapPeriod_ms), warmup_ns + MS_TO_NS(tapPeriod_ms));
+		RtosHost_AddTimer(&releaseTimer, ReleaseInterrupt, EXTI2_IRQn, MS_TO_NS(tapPeriod_ms),
+				warmup_ns + MS_TO_NS(tapPeriod_ms + TAP_DURATION_ms));
+	}
+	RtosHost_AddTimer(&snapshotTimer, SnapshotInterrupt, TIM7_IRQn, UINT64_MAX / 2, warmup_ns);
+	RtosHost_SetStopTime(warmup_ns + MS_TO_NS(duration_s * 1000));
+	osKernelStart();
+
+	PrintResults(duration_s);
+	return 0;
+}
+
+/* EOF */
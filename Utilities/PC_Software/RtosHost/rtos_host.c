@@ -0,0 +1,215 @@
+/**
+ ********************************************************************************
+ * @file 		rtos_host.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Runs the FreeRTOS tasks of the CM4 core on the PC in virtual time
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#define _GNU_SOURCE
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include "rtos_host.h"
+#include "shared_memory.h"
+#include "stm32h7xx_hal.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE					(0x100000)
+#endif
+#define CORE_CPUID							(0x410FC241UL)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+/**
+ * @brief Interrupt registers of the CM7 and CM4 cores
+ */
+static HSEM_Common_TypeDef* const irqLines[2] = { (HSEM_Common_TypeDef*)&HSEM->C1IER, (HSEM_Common_TypeDef*)&HSEM->C2IER };
+static volatile uint32_t tick = 0;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+/**
+ * @brief Clock of the CM4 core, used by the run time statistics
+ */
+uint32_t SystemD2Clock = 240000000UL;
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+/**
+ * @brief HSEM interrupt handler of the CM4 core, as placed in the vector table
+ */
+extern void HSEM2_IRQHandler(void) __attribute__((weak));
+_Static_assert(sizeof(shared_data_t) <= RTOS_HOST_SRAM_SIZE, "Shared data doesn't fit in the D3 SRAM");
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Apply the write-one-to-clear registers, update the masked status of both cores and set the interrupt of
+ * the CM4 core pending if any of its semaphores is pending.
+ */
+static void UpdateInterrupts(void)
+{
+	for (int i = 0; i < 2; i++)
+	{
+		irqLines[i]->ISR &= ~irqLines[i]->ICR;
+		irqLines[i]->ICR = 0;
+		irqLines[i]->MISR = irqLines[i]->ISR & irqLines[i]->IER;
+	}
+	if (HSEM_COMMON->MISR)
+		RtosHost_SetPendingIRQ(HSEM2_IRQn);
+}
+
+/**
+ * @brief Run the HSEM interrupt handler of the CM4 core, and apply its clears.
+ */
+static void HsemInterrupt(void)
+{
+	HSEM2_IRQHandler();
+	UpdateInterrupts();
+}
+
+/**
+ * @brief Map a private region at its target address.
+ * @return 0 if successful else -1 with errno set.
+ */
+static int MapRegion(uintptr_t addr, size_t size)
+{
+	void* map = mmap((void*)addr, size, PROT_READ | PROT_WRITE, MAP_FIXED_NOREPLACE | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (map == MAP_FAILED)
+		return -1;
+	// Older kernels treat the address as a hint only
+	if (map != (void*)addr)
+	{
+		munmap(map, size);
+		errno = EEXIST;
+		return -1;
+	}
+	return 0;
+}
+
+/**
+ * @brief Map the memories and the peripherals used by the firmware at their target addresses.
+ * @note Call before using the shared memory or the HAL, and before starting the kernel.
+ * @return 0 if successful else -1 with errno set.
+ */
+int RtosHost_Init(void)
+{
+	if (MapRegion(D3_SRAM_BASE, RTOS_HOST_SRAM_SIZE) != 0
+			|| MapRegion(RTOS_HOST_PERIPH_BASE, RTOS_HOST_PERIPH_SIZE) != 0
+			|| MapRegion(RTOS_HOST_CORE_PERIPH_BASE, RTOS_HOST_CORE_PERIPH_SIZE) != 0)
+		return -1;
+	*(volatile uint32_t*)&SCB->CPUID = CORE_CPUID;
+	if (HSEM2_IRQHandler != NULL)
+		RtosHost_SetVector(HSEM2_IRQn, HsemInterrupt);
+	return 0;
+}
+
+/**
+ * @brief Report a failed assertion of FreeRTOS.
+ */
+void vAssertCalled(const char* file, int line)
+{
+	fprintf(stderr, "FreeRTOS assertion failed at %s:%d\n", file, line);
+	abort();
+}
+
+/********************************************************************************
+ * Emulated HAL
+ *******************************************************************************/
+void HAL_IncTick(void)
+{
+	tick++;
+}
+
+uint32_t HAL_GetTick(void)
+{
+	return tick;
+}
+
+/**
+ * @brief Lock the semaphore if it is free or already locked by the same process.
+ * @note The CM7 core is emulated by the interrupts of the tools, so it takes the semaphores as the CM4 core.
+ */
+HAL_StatusTypeDef HAL_HSEM_Take(uint32_t SemID, uint32_t ProcessID)
+{
+	uint32_t value = HSEM_R_LOCK | HSEM_CR_COREID_CURRENT | ProcessID;
+	if (HSEM->R[SemID] == 0)
+		HSEM->R[SemID] = value;
+	return HSEM->R[SemID] == value ? HAL_OK : HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_HSEM_FastTake(uint32_t SemID)
+{
+	return HAL_HSEM_Take(SemID, 0);
+}
+
+/**
+ * @brief Free the semaphore if locked by the same process and raise the interrupt status of both cores.
+ */
+void HAL_HSEM_Release(uint32_t SemID, uint32_t ProcessID)
+{
+	if (HSEM->R[SemID] != (HSEM_R_LOCK | HSEM_CR_COREID_CURRENT | ProcessID))
+		return;
+	HSEM->R[SemID] = 0;
+	// Clears written before the release take effect first
+	UpdateInterrupts();
+	for (int i = 0; i < 2; i++)
+		irqLines[i]->ISR |= __HAL_HSEM_SEMID_TO_MASK(SemID);
+	UpdateInterrupts();
+}
+
+void HAL_HSEM_ActivateNotification(uint32_t SemMask)
+{
+	HSEM_COMMON->IER |= SemMask;
+	UpdateInterrupts();
+}
+
+void HAL_HSEM_DeactivateNotification(uint32_t SemMask)
+{
+	HSEM_COMMON->IER &= ~SemMask;
+	UpdateInterrupts();
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+	RtosHost_EnableIRQ(IRQn, true);
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn)
+{
+	RtosHost_EnableIRQ(IRQn, false);
+}
+
+/* EOF */
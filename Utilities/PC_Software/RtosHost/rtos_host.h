@@ -0,0 +1,230 @@
+/**
+ ********************************************************************************
+ * @file 		rtos_host.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Runs the FreeRTOS tasks of the CM4 core on the PC in virtual time
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef RTOS_HOST_H_
+#define RTOS_HOST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup RtosHost RTOS Host
+ * @brief Runs the unchanged FreeRTOS kernel and CMSIS-RTOS2 layer with the tasks of the CM4 core in a single
+ * Linux thread.
+ * @details The port of this folder switches the tasks with <b>ucontext</b>, each task having its own stack on the
+ * PC. The time is virtual, so the runs are repeatable and much faster than the real time:
+ * - The tick and the emulated interrupts are events in virtual time. They are run at the kernel calls of the tasks
+ * and while the idle task sleeps, which skips directly to the next event.
+ * - The tasks take no time by default. @ref RtosHost_SetCpuScale() charges the CPU time used on the PC, scaled to
+ * the CM4 core, and @ref RtosHost_Busy() a given time.
+ * - The interrupts run in the context of the interrupted task with <b>__get_IPSR()</b> returning their exception
+ * number, so the CMSIS-RTOS2 layer uses the API of FreeRTOS for the interrupts. A context switch requested by an
+ * interrupt is done once the interrupt returns, as the PendSV of the Cortex-M ports.
+ * - The D3 SRAM, the D3 peripherals containing the hardware semaphores and the core peripherals containing the
+ * DWT and the NVIC are mapped at their target addresses, so the firmware accesses them through the HAL headers.
+ * The DWT cycle counter follows the virtual time for the run time statistics of FreeRTOS.
+ * @{
+ */
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** @defgroup RtosHost_Exported_Macros Macros
+ * @{
+ */
+/**
+ * @brief Size of the stack of each task on the PC
+ * @note The stacks given to FreeRTOS are left unused, as the PC code needs larger stacks than the CM4 core.
+ */
+#ifndef RTOS_HOST_TASK_STACK_SIZE
+#define RTOS_HOST_TASK_STACK_SIZE			(1024U * 1024U)
+#endif
+/**
+ * @brief Number of the emulated interrupt lines of the NVIC
+ */
+#define RTOS_HOST_IRQ_COUNT					(150)
+/**
+ * @brief Size of the D3 SRAM mapped at <b>D3_SRAM_BASE</b>
+ */
+#define RTOS_HOST_SRAM_SIZE					(0x10000)
+/**
+ * @brief Base address of the mapped D3 peripherals, containing the RCC and the HSEM
+ */
+#define RTOS_HOST_PERIPH_BASE				(0x58020000UL)
+/**
+ * @brief Size of the mapped D3 peripherals
+ */
+#define RTOS_HOST_PERIPH_SIZE				(0x8000)
+/**
+ * @brief Base address of the mapped core peripherals, containing the DWT and the system control space
+ */
+#define RTOS_HOST_CORE_PERIPH_BASE			(0xE0000000UL)
+/**
+ * @brief Size of the mapped core peripherals
+ */
+#define RTOS_HOST_CORE_PERIPH_SIZE			(0x10000)
+/**
+ * @}
+ */
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/** @defgroup RtosHost_Exported_Structures Structures
+ * @{
+ */
+/**
+ * @brief Periodic interrupt in virtual time, e.g. of a timer or of the emulated CM7 core
+ */
+typedef struct rtos_host_timer_t
+{
+	void (*handler)(void);				/**< @brief Handler run in the interrupt context */
+	int irqn;							/**< @brief Interrupt number reported by <b>__get_IPSR()</b> */
+	uint64_t period_ns;					/**< @brief Period of the interrupt in nano-seconds, 0 for a single interrupt */
+	uint64_t next_ns;					/**< @brief Time of the next interrupt in nano-seconds */
+	struct rtos_host_timer_t* next;		/**< @brief Next timer of the list */
+} rtos_host_timer_t;
+/**
+ * @brief Statistics of the scheduler
+ */
+typedef struct
+{
+	uint64_t contextSwitches;			/**< @brief Switches between different tasks */
+	uint64_t idleSleeps;				/**< @brief Times the idle task slept till the next event */
+	uint64_t interrupts;				/**< @brief Interrupts run apart from the tick */
+	uint64_t ticks;						/**< @brief Ticks of the kernel */
+} rtos_host_stats_t;
+/**
+ * @brief Statistics of a task
+ */
+typedef struct
+{
+	uint64_t switchIns;					/**< @brief Times the task was switched in */
+	uint64_t runTime_ns;				/**< @brief Virtual time spent in the task */
+} rtos_host_task_stats_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+/** @defgroup RtosHost_Exported_Functions Functions
+ * @{
+ */
+/**
+ * @brief Map the memories and the peripherals used by the firmware at their target addresses.
+ * @note Call before using the shared memory or the HAL, and before starting the kernel.
+ * @return 0 if successful else -1 with errno set.
+ */
+extern int RtosHost_Init(void);
+/**
+ * @brief Scale the CPU time used by the tasks and the interrupts on the PC to the virtual time.
+ * @param scale Ratio of the speed of the PC to the CM4 core. 0 to run the code in no time, which is the default.
+ */
+extern void RtosHost_SetCpuScale(float scale);
+/**
+ * @brief Get the virtual time.
+ * @return Time since the start of the tool in nano-seconds.
+ */
+extern uint64_t RtosHost_GetTime_ns(void);
+/**
+ * @brief Spend the given virtual time in the running task or interrupt.
+ * @details The events due in the meantime are run, and a context switch requested by them is done right away
+ * if called from a task outside the critical sections.
+ * @param time_ns Time in nano-seconds.
+ */
+extern void RtosHost_Busy(uint64_t time_ns);
+/**
+ * @brief Add a periodic interrupt.
+ * @param timer Timer to be added, which should stay valid while the kernel runs.
+ * @param handler Handler of the interrupt.
+ * @param irqn Interrupt number of the handler, e.g. <b>TIM7_IRQn</b>.
+ * @param period_ns Period of the interrupt in nano-seconds. 0 runs the handler once, till the timer is restarted.
+ * @param start_ns Time of the first interrupt in nano-seconds. <c>UINT64_MAX</c> to add a stopped timer.
+ */
+extern void RtosHost_AddTimer(rtos_host_timer_t* timer, void (*handler)(void), int irqn, uint64_t period_ns, uint64_t start_ns);
+/**
+ * @brief Restart an added timer, e.g. to schedule the completion of an operation of an emulated peripheral.
+ * @param timer Timer added with @ref RtosHost_AddTimer().
+ * @param start_ns Time of the next interrupt in nano-seconds. <c>UINT64_MAX</c> to stop the timer.
+ */
+extern void RtosHost_StartTimer(rtos_host_timer_t* timer, uint64_t start_ns);
+/**
+ * @brief Set the handler of an interrupt line of the emulated NVIC.
+ * @param irqn Interrupt number, e.g. <b>HSEM2_IRQn</b>.
+ * @param handler Handler of the interrupt.
+ */
+extern void RtosHost_SetVector(int irqn, void (*handler)(void));
+/**
+ * @brief Enable or disable an interrupt line of the emulated NVIC.
+ * @param irqn Interrupt number, e.g. <b>HSEM2_IRQn</b>.
+ * @param isEnabled <c>true</c> to enable the interrupt.
+ */
+extern void RtosHost_EnableIRQ(int irqn, bool isEnabled);
+/**
+ * @brief Set an interrupt line of the emulated NVIC pending.
+ * @details The handler runs at the next event or kernel call if the line is enabled, or once it is enabled.
+ * @param irqn Interrupt number, e.g. <b>HSEM2_IRQn</b>.
+ */
+extern void RtosHost_SetPendingIRQ(int irqn);
+/**
+ * @brief Stop the kernel at the given time, returning from <b>osKernelStart()</b>.
+ * @param time_ns Virtual time in nano-seconds.
+ */
+extern void RtosHost_SetStopTime(uint64_t time_ns);
+/**
+ * @brief Get the statistics of the scheduler.
+ * @param stats Statistics to be filled.
+ */
+extern void RtosHost_GetStats(rtos_host_stats_t* stats);
+/**
+ * @brief Get the statistics of a task.
+ * @param handle Handle of the task, e.g. as returned by <b>osThreadNew()</b>.
+ * @param stats Statistics to be filled.
+ */
+extern void RtosHost_GetTaskStats(void* handle, rtos_host_task_stats_t* stats);
+/**
+ * @}
+ */
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+
+/**
+ * @}
+ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */
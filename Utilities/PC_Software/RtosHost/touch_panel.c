@@ -0,0 +1,165 @@
+/**
+ ********************************************************************************
+ * @file 		touch_panel.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Touch screen driver of the BSP with an emulated controller, for the CM4 tasks on the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include "touch_panel.h"
+#include "rtos_host.h"
+#include "pecontroller_ts.h"
+#include "cmsis_os.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static TS_StateTypeDef fifo[TOUCH_PANEL_FIFO_SIZE];
+static uint64_t fifoTimes_ns[TOUCH_PANEL_FIFO_SIZE];
+static volatile uint32_t fifoWrIndex = 0, fifoRdIndex = 0;
+static TS_StateTypeDef eventQueue[TS_EVENT_QUEUE_SIZE];
+static uint64_t eventTimes_ns[TS_EVENT_QUEUE_SIZE];
+static volatile uint32_t eventWrIndex = 0, eventRdIndex = 0;
+static TS_StateTypeDef state;
+static TS_StatsTypeDef tsStats;
+static touch_panel_stats_t panelStats;
+static osThreadId_t volatile tsTask = NULL;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+uint8_t BSP_TS_Init(uint16_t ts_SizeX, uint16_t ts_SizeY)
+{
+	tsTask = osThreadGetId();
+	return TS_OK;
+}
+
+TS_StateTypeDef* BSP_TS_GetState(void)
+{
+	return &state;
+}
+
+/**
+ * @brief Move the messages of the emulated controller to the event queue, while the queue has space.
+ */
+void BSP_TS_Poll(void)
+{
+	while (fifoRdIndex != fifoWrIndex && (eventWrIndex - eventRdIndex) < TS_EVENT_QUEUE_SIZE)
+	{
+		state = fifo[fifoRdIndex % TOUCH_PANEL_FIFO_SIZE];
+		eventTimes_ns[eventWrIndex % TS_EVENT_QUEUE_SIZE] = fifoTimes_ns[fifoRdIndex % TOUCH_PANEL_FIFO_SIZE];
+		fifoRdIndex++;
+		tsStats.messages++;
+		eventQueue[eventWrIndex % TS_EVENT_QUEUE_SIZE] = state;
+		eventWrIndex++;
+		tsStats.events++;
+	}
+	tsStats.reads++;
+}
+
+void BSP_TS_WaitAndProcess(void)
+{
+	// the line stays asserted while messages are pending
+	if (fifoRdIndex == fifoWrIndex)
+		osThreadFlagsWait(TS_CHG_THREAD_FLAG, osFlagsWaitAny, osWaitForever);
+	if ((eventWrIndex - eventRdIndex) >= TS_EVENT_QUEUE_SIZE)
+	{
+		osDelay(TS_QUEUE_FULL_DELAY_ms);
+		return;
+	}
+	BSP_TS_Poll();
+}
+
+bool BSP_TS_GetEvent(TS_StateTypeDef* event)
+{
+	if (eventRdIndex == eventWrIndex)
+		return false;
+	*event = eventQueue[eventRdIndex % TS_EVENT_QUEUE_SIZE];
+	uint64_t latency = RtosHost_GetTime_ns() - eventTimes_ns[eventRdIndex % TS_EVENT_QUEUE_SIZE];
+	eventRdIndex++;
+	panelStats.readEvents++;
+	panelStats.totalLatency_ns += latency;
+	if (latency > panelStats.maxLatency_ns)
+		panelStats.maxLatency_ns = latency;
+	return true;
+}
+
+bool BSP_TS_IsEventPending(void)
+{
+	return eventRdIndex != eventWrIndex;
+}
+
+void BSP_TS_GetStats(TS_StatsTypeDef* stats)
+{
+	*stats = tsStats;
+}
+
+/**
+ * @brief Report a touch or a release to the emulated controller.
+ * @note Call from an emulated interrupt, e.g. a timer added with <b>RtosHost_AddTimer()</b>.
+ * @param isPressed <c>true</c> if the screen is touched.
+ * @param x Horizontal coordinate reported by the controller.
+ * @param y Vertical coordinate reported by the controller.
+ * @return <c>true</c> if the message was queued, <c>false</c> if the FIFO was full.
+ */
+bool TouchPanel_Touch(bool isPressed, uint16_t x, uint16_t y)
+{
+	if ((fifoWrIndex - fifoRdIndex) >= TOUCH_PANEL_FIFO_SIZE)
+	{
+		tsStats.droppedEvents++;
+		return false;
+	}
+	fifo[fifoWrIndex % TOUCH_PANEL_FIFO_SIZE] = (TS_StateTypeDef){ .touchDetected = isPressed, .touchX = x, .touchY = y };
+	fifoTimes_ns[fifoWrIndex % TOUCH_PANEL_FIFO_SIZE] = RtosHost_GetTime_ns();
+	fifoWrIndex++;
+	// assertion of the CHG line
+	tsStats.interrupts++;
+	if (tsTask != NULL)
+		osThreadFlagsSet(tsTask, TS_CHG_THREAD_FLAG);
+	return true;
+}
+
+/**
+ * @brief Get the delays of the reads of the touch events.
+ * @param stats Structure to be filled.
+ */
+void TouchPanel_GetStats(touch_panel_stats_t* stats)
+{
+	*stats = panelStats;
+}
+
+/* EOF */
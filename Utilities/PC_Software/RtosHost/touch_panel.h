@@ -0,0 +1,117 @@
+/**
+ ********************************************************************************
+ * @file 		touch_panel.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Touch screen driver of the BSP with an emulated controller, for the CM4 tasks on the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef TOUCH_PANEL_H_
+#define TOUCH_PANEL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup Touch_Panel Touch Panel
+ * @brief Replaces the touch screen driver of the BSP (pecontroller_ts.c) when the CM4 tasks run on the PC.
+ * @details The controller is reduced to a message FIFO filled by @ref TouchPanel_Touch(). The CHG line is asserted
+ * while the FIFO has messages, waking the task waiting in <b>BSP_TS_WaitAndProcess()</b>, which moves the messages to
+ * the event queue read by the input device of the display, as the driver of the BSP does.
+ * @{
+ */
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdbool.h>
+#include <stdint.h>
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** @defgroup TouchPanel_Exported_Macros Macros
+ * @{
+ */
+/**
+ * @brief Size of the message FIFO of the emulated controller
+ */
+#ifndef TOUCH_PANEL_FIFO_SIZE
+#define TOUCH_PANEL_FIFO_SIZE				(32)
+#endif
+/**
+ * @}
+ */
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/** @defgroup TouchPanel_Exported_Structures Structures
+ * @{
+ */
+/**
+ * @brief Delays from the touches to their reads by the input device of the display
+ */
+typedef struct
+{
+	uint32_t readEvents;				/**< @brief No of events read with <b>BSP_TS_GetEvent()</b> */
+	uint64_t totalLatency_ns;			/**< @brief Sum of the delays from @ref TouchPanel_Touch() to the reads */
+	uint64_t maxLatency_ns;				/**< @brief Longest delay from @ref TouchPanel_Touch() to the read */
+} touch_panel_stats_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+/** @defgroup TouchPanel_Exported_Functions Functions
+ * @{
+ */
+/**
+ * @brief Report a touch or a release to the emulated controller.
+ * @note Call from an emulated interrupt, e.g. a timer added with <b>RtosHost_AddTimer()</b>.
+ * @param isPressed <c>true</c> if the screen is touched.
+ * @param x Horizontal coordinate reported by the controller.
+ * @param y Vertical coordinate reported by the controller.
+ * @return <c>true</c> if the message was queued, <c>false</c> if the FIFO was full.
+ */
+extern bool TouchPanel_Touch(bool isPressed, uint16_t x, uint16_t y);
+/**
+ * @brief Get the delays of the reads of the touch events.
+ * @param stats Structure to be filled.
+ */
+extern void TouchPanel_GetStats(touch_panel_stats_t* stats);
+/**
+ * @}
+ */
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+
+/**
+ * @}
+ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */
@@ -0,0 +1,379 @@
+/**
+ ********************************************************************************
+ * @file 		flash_emulator.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    File backed emulation of the internal flash for the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "flash_emulator.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE					(0x100000)
+#endif
+#define FLASH_WORD_BYTES					(32)
+#define BANK_SIZE							(FLASH_SECTOR_SIZE * FLASH_SECTOR_TOTAL)
+#define PAGE_SIZE							(4096)
+#define DEFAULT_PROGRAM_TIME_us				(20)
+#define DEFAULT_ERASE_TIME_us				(1000000)
+/**
+ * @brief Time taken by each poll of the tick while waiting
+ */
+#define TICK_POLL_TIME_us					(1)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief Flash operation in progress
+ */
+typedef struct
+{
+	bool isPending;							/**< <c>true</c> while the operation is in progress */
+	bool isErase;							/**< <c>true</c> for a sector erase, <c>false</c> for programming */
+	uint32_t offset;						/**< Offset of the flash word or sector in the bank */
+	uint64_t endTime_us;					/**< Virtual time at which the operation completes */
+	uint8_t data[FLASH_WORD_BYTES];			/**< Data latched for programming */
+	bool isCompleted;						/**< Set at completion until reported by @ref HAL_FLASH_IRQHandler() */
+	bool isFailed;							/**< Set if the completed operation failed */
+	uint32_t returnValue;					/**< Value reported to the HAL callbacks */
+} flash_operation_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static int flashFd = -1;
+static uint8_t* const bank = (uint8_t*)FLASH_BANK1_BASE;
+/**
+ * @brief Page holding the flash registers, which are only written by the clients
+ */
+static uint8_t* const registers = (uint8_t*)(FLASH_R_BASE & ~(PAGE_SIZE - 1));
+static flash_emulator_stats_t stats;
+static uint32_t operationsLeft = 0;
+static bool isPoweredDown = false;
+static bool isIrqEnabled = false;
+static uint64_t now_us = 0;
+static uint32_t programTime_us = DEFAULT_PROGRAM_TIME_us;
+static uint32_t eraseTime_us = DEFAULT_ERASE_TIME_us;
+static flash_operation_t operation;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+extern void FLASH_IRQHandler(void);
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Map the flash file at the address of the flash bank 1.
+ * @param path Path of the flash file. Created in the erased state if not present.
+ * @return 0 if successful else -1 with errno set.
+ */
+int FlashEmulator_Open(const char* path)
+{
+	void* map = mmap(registers, PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+	if (map == MAP_FAILED)
+		return -1;
+	if (map != registers)
+	{
+		munmap(map, PAGE_SIZE);
+		errno = EEXIST;
+		return -1;
+	}
+	flashFd = open(path, O_RDWR | O_CREAT, 0600);
+	if (flashFd < 0)
+		goto error;
+	struct stat st;
+	bool isNew = fstat(flashFd, &st) == 0 && st.st_size == 0;
+	if (ftruncate(flashFd, BANK_SIZE) != 0)
+		goto error;
+	map = mmap(bank, BANK_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED_NOREPLACE, flashFd, 0);
+	if (map == MAP_FAILED)
+		goto error;
+	// Older kernels treat the address as a hint only
+	if (map != bank)
+	{
+		munmap(map, BANK_SIZE);
+		errno = EEXIST;
+		goto error;
+	}
+	if (isNew)
+		FlashEmulator_Format();
+	return 0;
+error:
+	{
+		int err = errno;
+		if (flashFd >= 0)
+			close(flashFd);
+		flashFd = -1;
+		munmap(registers, PAGE_SIZE);
+		errno = err;
+	}
+	return -1;
+}
+
+/**
+ * @brief Remove the mapping of the flash file.
+ */
+void FlashEmulator_Close(void)
+{
+	munmap(bank, BANK_SIZE);
+	munmap(registers, PAGE_SIZE);
+	close(flashFd);
+	flashFd = -1;
+}
+
+/**
+ * @brief Erase the complete flash bank without counting the erases.
+ */
+void FlashEmulator_Format(void)
+{
+	memset(bank, 0xFF, BANK_SIZE);
+}
+
+/**
+ * @brief Set the durations of the flash operations.
+ * @param _programTime_us Time taken to program a flash word in micro-seconds.
+ * @param _eraseTime_us Time taken to erase a sector in micro-seconds.
+ */
+void FlashEmulator_SetTimings(uint32_t _programTime_us, uint32_t _eraseTime_us)
+{
+	programTime_us = _programTime_us;
+	eraseTime_us = _eraseTime_us;
+}
+
+/**
+ * @brief Get the virtual time of the emulation.
+ * @return Time in micro-seconds.
+ */
+uint64_t FlashEmulator_GetTime(void)
+{
+	return now_us;
+}
+
+/**
+ * @brief Complete the operation in progress, programming only half of the flash word or sector if the power is lost.
+ */
+static void CompleteOperation(void)
+{
+	int len = operation.isErase ? FLASH_SECTOR_SIZE : FLASH_WORD_BYTES;
+	if (operationsLeft != 0 && --operationsLeft == 0)
+	{
+		len /= 2;
+		isPoweredDown = true;
+	}
+	if (operation.isErase)
+	{
+		memset(bank + operation.offset, 0xFF, len);
+		stats.eraseCounts[operation.offset / FLASH_SECTOR_SIZE]++;
+		stats.busyTime_us += eraseTime_us;
+	}
+	else
+	{
+		memcpy(bank + operation.offset, operation.data, len);
+		stats.programCount++;
+		stats.busyTime_us += programTime_us;
+	}
+	operation.isPending = false;
+	operation.isCompleted = true;
+	operation.isFailed = isPoweredDown;
+}
+
+/**
+ * @brief Advance the virtual time, completing the operations due in this time.
+ * @details The flash interrupt is raised at the completion of each operation if enabled, which may start the next
+ * operation. Nothing is completed once the power is lost.
+ * @param time_us Time to advance in micro-seconds.
+ */
+void FlashEmulator_AdvanceTime(uint64_t time_us)
+{
+	uint64_t endTime_us = now_us + time_us;
+	while (operation.isPending && !isPoweredDown && operation.endTime_us <= endTime_us)
+	{
+		now_us = operation.endTime_us;
+		CompleteOperation();
+		if (isIrqEnabled && !isPoweredDown)
+			FLASH_IRQHandler();
+	}
+	now_us = endTime_us;
+}
+
+/**
+ * @brief Check if a flash operation is in progress.
+ * @return <c>true</c> if the flash is busy.
+ */
+bool FlashEmulator_IsBusy(void)
+{
+	return operation.isPending;
+}
+
+/**
+ * @brief Schedule a power loss.
+ * @param count No of flash operations completed before the power loss, counted from now. The last one is only
+ * completed partially. 0 cancels a scheduled power loss.
+ */
+void FlashEmulator_SetPowerLoss(uint32_t count)
+{
+	operationsLeft = count;
+}
+
+/**
+ * @brief Check if the scheduled power loss has occurred.
+ * @return <c>true</c> if the flash is powered down.
+ */
+bool FlashEmulator_IsPoweredDown(void)
+{
+	return isPoweredDown;
+}
+
+/**
+ * @brief Restore the power after a power loss, discarding the operation in progress.
+ */
+void FlashEmulator_PowerUp(void)
+{
+	isPoweredDown = false;
+	operationsLeft = 0;
+	memset(&operation, 0, sizeof(operation));
+}
+
+/**
+ * @brief Get the operation counters of the emulated flash.
+ * @param _stats Structure to be filled with the counters.
+ */
+void FlashEmulator_GetStats(flash_emulator_stats_t* _stats)
+{
+	*_stats = stats;
+}
+
+/**
+ * @brief Reset the operation counters of the emulated flash.
+ */
+void FlashEmulator_ResetStats(void)
+{
+	memset(&stats, 0, sizeof(stats));
+}
+
+/********************************************************************************
+ * Emulated HAL
+ *******************************************************************************/
+/**
+ * @brief Start programming a flash word, failing if busy, not aligned, outside the bank or already programmed.
+ * @details The data is latched at the start, as it is by the write buffer of the flash.
+ */
+HAL_StatusTypeDef HAL_FLASH_Program_IT(uint32_t TypeProgram, uint32_t FlashAddress, uint32_t DataAddress)
+{
+	if (operation.isPending)
+		return HAL_BUSY;
+	uint32_t offset = FlashAddress - FLASH_BANK1_BASE;
+	if (TypeProgram != FLASH_TYPEPROGRAM_FLASHWORD || FlashAddress < FLASH_BANK1_BASE ||
+			offset >= BANK_SIZE || (offset % FLASH_WORD_BYTES) != 0)
+	{
+		stats.errorCount++;
+		return HAL_ERROR;
+	}
+	for (int i = 0; i < FLASH_WORD_BYTES; i++)
+	{
+		if (bank[offset + i] != 0xFF)
+		{
+			stats.errorCount++;
+			return HAL_ERROR;
+		}
+	}
+	if (isPoweredDown)
+		return HAL_OK;
+	operation.isPending = true;
+	operation.isErase = false;
+	operation.offset = offset;
+	operation.endTime_us = now_us + programTime_us;
+	operation.returnValue = FlashAddress;
+	memcpy(operation.data, (const void*)(uintptr_t)DataAddress, FLASH_WORD_BYTES);
+	return HAL_OK;
+}
+
+/**
+ * @brief Start erasing a single sector of the bank 1.
+ */
+HAL_StatusTypeDef HAL_FLASHEx_Erase_IT(FLASH_EraseInitTypeDef* pEraseInit)
+{
+	if (operation.isPending)
+		return HAL_BUSY;
+	if (pEraseInit->TypeErase != FLASH_TYPEERASE_SECTORS || pEraseInit->Banks != FLASH_BANK_1 ||
+			pEraseInit->NbSectors != 1 || pEraseInit->Sector >= FLASH_SECTOR_TOTAL)
+	{
+		stats.errorCount++;
+		return HAL_ERROR;
+	}
+	if (isPoweredDown)
+		return HAL_OK;
+	operation.isPending = true;
+	operation.isErase = true;
+	operation.offset = pEraseInit->Sector * FLASH_SECTOR_SIZE;
+	operation.endTime_us = now_us + eraseTime_us;
+	operation.returnValue = 0xFFFFFFFFU;
+	return HAL_OK;
+}
+
+/**
+ * @brief Report the completed operation to the HAL callbacks.
+ */
+void HAL_FLASH_IRQHandler(void)
+{
+	if (!operation.isCompleted)
+		return;
+	operation.isCompleted = false;
+	if (operation.isFailed)
+		HAL_FLASH_OperationErrorCallback(operation.returnValue);
+	else
+		HAL_FLASH_EndOfOperationCallback(operation.returnValue);
+}
+
+/**
+ * @brief The tick advances by the time taken to poll it, so that the waiting loops complete the flash operations.
+ */
+uint32_t HAL_GetTick(void)
+{
+	FlashEmulator_AdvanceTime(TICK_POLL_TIME_us);
+	return (uint32_t)(now_us / 1000);
+}
+
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority)
+{
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+	if (IRQn == FLASH_IRQn)
+		isIrqEnabled = true;
+}
+
+/* EOF */
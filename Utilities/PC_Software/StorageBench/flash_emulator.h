@@ -0,0 +1,162 @@
+/**
+ ********************************************************************************
+ * @file 		flash_emulator.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    File backed emulation of the internal flash for the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef FLASH_EMULATOR_H_
+#define FLASH_EMULATOR_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup Flash_Emulator Flash Emulator
+ * @brief Emulates the flash bank 1 of the controller with a memory-mapped file.
+ * @details The file is mapped at <b>FLASH_BANK1_BASE</b>, so the sector addresses configured by the applications
+ * are used unchanged. The interrupt mode of the HAL is emulated: <b>HAL_FLASHEx_Erase_IT()</b> erases a complete
+ * sector while <b>HAL_FLASH_Program_IT()</b> only programs complete flash words of 32 bytes, which should be aligned
+ * and erased as the ECC of the flash doesn't allow programming a flash word twice.
+ *
+ * The operations take a configurable duration of a virtual time, which only advances with
+ * @ref FlashEmulator_AdvanceTime() and the polls of <b>HAL_GetTick()</b>. At the completion of each operation the
+ * flash interrupt is raised by calling <b>FLASH_IRQHandler()</b>, if enabled with <b>HAL_NVIC_EnableIRQ()</b>.
+ *
+ * A power loss can be scheduled after a number of flash operations. Only the first half of the flash word or sector
+ * of the last operation is changed, and all further operations are ignored until @ref FlashEmulator_PowerUp() is called.
+ * @{
+ */
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdbool.h>
+#include "stm32h7xx_hal.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/** @defgroup FlashEmulator_Exported_Structures Structures
+ * @{
+ */
+/**
+ * @brief Operation counters of the emulated flash
+ */
+typedef struct
+{
+	uint32_t eraseCounts[FLASH_SECTOR_TOTAL];	/**< @brief No of erases of each sector */
+	uint32_t programCount;						/**< @brief No of programmed flash words */
+	uint32_t errorCount;						/**< @brief No of rejected operations */
+	uint64_t busyTime_us;						/**< @brief Total duration of the completed operations in micro-seconds */
+} flash_emulator_stats_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+/** @defgroup FlashEmulator_Exported_Functions Functions
+ * @{
+ */
+/**
+ * @brief Map the flash file at the address of the flash bank 1.
+ * @param path Path of the flash file. Created in the erased state if not present.
+ * @return 0 if successful else -1 with errno set.
+ */
+extern int FlashEmulator_Open(const char* path);
+/**
+ * @brief Remove the mapping of the flash file.
+ */
+extern void FlashEmulator_Close(void);
+/**
+ * @brief Erase the complete flash bank without counting the erases.
+ */
+extern void FlashEmulator_Format(void);
+/**
+ * @brief Set the durations of the flash operations.
+ * @param programTime_us Time taken to program a flash word in micro-seconds.
+ * @param eraseTime_us Time taken to erase a sector in micro-seconds.
+ */
+extern void FlashEmulator_SetTimings(uint32_t programTime_us, uint32_t eraseTime_us);
+/**
+ * @brief Get the virtual time of the emulation.
+ * @return Time in micro-seconds.
+ */
+extern uint64_t FlashEmulator_GetTime(void);
+/**
+ * @brief Advance the virtual time, completing the operations due in this time.
+ * @details The flash interrupt is raised at the completion of each operation if enabled, which may start the next
+ * operation. Nothing is completed once the power is lost.
+ * @param time_us Time to advance in micro-seconds.
+ */
+extern void FlashEmulator_AdvanceTime(uint64_t time_us);
+/**
+ * @brief Check if a flash operation is in progress.
+ * @return <c>true</c> if the flash is busy.
+ */
+extern bool FlashEmulator_IsBusy(void);
+/**
+ * @brief Schedule a power loss.
+ * @param count No of flash operations completed before the power loss, counted from now. The last one is only
+ * completed partially. 0 cancels a scheduled power loss.
+ */
+extern void FlashEmulator_SetPowerLoss(uint32_t count);
+/**
+ * @brief Check if the scheduled power loss has occurred.
+ * @return <c>true</c> if the flash is powered down.
+ */
+extern bool FlashEmulator_IsPoweredDown(void);
+/**
+ * @brief Restore the power after a power loss, discarding the operation in progress.
+ */
+extern void FlashEmulator_PowerUp(void);
+/**
+ * @brief Get the operation counters of the emulated flash.
+ * @param stats Structure to be filled with the counters.
+ */
+extern void FlashEmulator_GetStats(flash_emulator_stats_t* stats);
+/**
+ * @brief Reset the operation counters of the emulated flash.
+ */
+extern void FlashEmulator_ResetStats(void);
+/**
+ * @}
+ */
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+
+/**
+ * @}
+ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */
@@ -0,0 +1,557 @@
+/**
+ ********************************************************************************
+ * @file 		storage_bench.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Measures the refresh and restore times, write amplification and power loss behavior of the state storage on the PC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "flash_emulator.h"
+#include "state_storage_lib.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+#define DEFAULT_SECTORS					(2)
+#define DEFAULT_CLIENT_WORDS			(60)
+#define DEFAULT_CHANGES					(2)
+#define DEFAULT_REFRESHES				(20000)
+#define DEFAULT_TRIALS					(200)
+#define DEFAULT_FLASH_FILE				"storage_bench.flash"
+#define DEFAULT_PERIOD_ms				(10)
+#define DEFAULT_PROGRAM_TIME_us			(20)
+#define DEFAULT_ERASE_TIME_ms			(1000)
+/**
+ * @brief Timeout for flushing the states, enough for a queued erase followed by a rotation
+ */
+#define FLUSH_TIMEOUT_ms				(60000)
+/**
+ * @brief No of points at which the restore time is measured during the refreshes
+ */
+#define RESTORE_POINTS					(8)
+/**
+ * @brief No of initializations averaged for each restore time
+ */
+#define RESTORE_REPEATS					(20)
+/**
+ * @brief Maximum no of refreshes before the power loss of a trial
+ */
+#define TRIAL_MAX_WARMUP				(10000)
+/**
+ * @brief Maximum no of flash operations completed before the power is lost
+ */
+#define TRIAL_MAX_OPERATIONS			(24)
+/**
+ * @brief Maximum no of refreshes before the power loss, kept to check the restored states
+ */
+#define TRIAL_MAX_HISTORY				(4096)
+/**
+ * @brief No of refreshes after the power loss before checking the restored states again
+ */
+#define TRIAL_RECOVERY_REFRESHES		(20)
+/**
+ * @brief Maximum no of partial packets after the complete store in a sector of the legacy format
+ */
+#define LEGACY_MAX_PACKETS				(200)
+/**
+ * @brief Maximum no of refreshes waiting for the power loss during the migration of the legacy format
+ */
+#define LEGACY_MAX_REFRESHES			(1000)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static state_storage_config_t storageConfig;
+static state_storage_client_t storageClient;
+/**
+ * @brief States of the emulated client
+ */
+static uint32_t clientStates[STORE_WORD_SIZE];
+static uint32_t clientWords = DEFAULT_CLIENT_WORDS;
+static uint32_t randState = 0x12345678;
+static uint32_t period_us = DEFAULT_PERIOD_ms * 1000;
+/**
+ * @brief States after each refresh of a power loss trial
+ */
+static uint32_t history[TRIAL_MAX_HISTORY][STORE_WORD_SIZE];
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+void Error_Handler(void)
+{
+	fprintf(stderr, "Error_Handler called by the state storage\n");
+	exit(1);
+}
+
+static inline uint64_t GetTime_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+static uint32_t Random(void)
+{
+	randState ^= randState << 13;
+	randState ^= randState >> 17;
+	randState ^= randState << 5;
+	return randState;
+}
+
+static void InitStatesFromStorage(uint32_t* data, bool isDataValid)
+{
+	if (isDataValid)
+		memcpy(clientStates, data, clientWords * 4);
+	else
+		memset(clientStates, 0, clientWords * 4);
+}
+
+static uint32_t RefreshStates(uint32_t* data, uint32_t* indexPtr)
+{
+	*indexPtr = 0;
+	if (memcmp(data, clientStates, clientWords * 4) == 0)
+		return 0;
+	memcpy(data, clientStates, clientWords * 4);
+	return clientWords;
+}
+
+/**
+ * @brief Initialize the state storage on the last sectors of the bank in the same way as the applications.
+ */
+static void InitStorage(int sectorCount)
+{
+	storageConfig.sectorCount = sectorCount;
+	for (int i = 0; i < sectorCount; i++)
+	{
+		storageConfig.sectors[i].sectorNo = FLASH_SECTOR_TOTAL - sectorCount + i;
+		storageConfig.sectors[i].bank = FLASH_BANK_1;
+		storageConfig.sectors[i].byteCount = FLASH_SECTOR_SIZE;
+		storageConfig.sectors[i].addr =  (uint32_t*)(FLASH_BANK1_BASE + (storageConfig.sectors[i].sectorNo * FLASH_SECTOR_SIZE));
+	}
+	storageClient.InitStatesFromStorage = InitStatesFromStorage;
+	storageClient.RefreshStates = RefreshStates;
+	storageClient.dataWordLen = clientWords;
+	storageConfig.clientCount = 1;
+	storageConfig.clients = &storageClient;
+	StateStorage_Init(&storageConfig);
+}
+
+/**
+ * @brief Change random words of the client states.
+ * @return No of words changed.
+ */
+static uint32_t ChangeStates(int count)
+{
+	uint32_t changed = 0;
+	while (count--)
+	{
+		uint32_t index = Random() % clientWords;
+		uint32_t value = Random();
+		changed += clientStates[index] != value;
+		clientStates[index] = value;
+	}
+	return changed;
+}
+
+static void AddStats(state_storage_stats_t* total)
+{
+	state_storage_stats_t stats;
+	StateStorage_GetStats(&stats);
+	total->deltaCount += stats.deltaCount;
+	total->checkpointCount += stats.checkpointCount;
+	total->rotationCount += stats.rotationCount;
+	total->deferredCount += stats.deferredCount;
+}
+
+static uint32_t GetActiveSectorFill(int sectorCount)
+{
+	uint32_t fill = 0;
+	for (int i = 0; i < sectorCount; i++)
+	{
+		if (storageConfig.sectors[i].index > fill)
+			fill = storageConfig.sectors[i].index;
+	}
+	return (fill * 400ull) / FLASH_SECTOR_SIZE;
+}
+
+/**
+ * @brief Run the refreshes with the write pipeline, measuring the refresh and restore times.
+ * @details The states are flushed before each restore time measurement.
+ * @return <c>true</c> if the restored states always matched.
+ */
+static bool MeasureRefreshes(int sectorCount, int changes, int refreshes)
+{
+	bool isValid = true;
+	uint32_t expected[STORE_WORD_SIZE];
+	uint64_t changedWords = 0, refreshTime = 0, maxRefreshTime = 0;
+	state_storage_stats_t total = {0};
+	FlashEmulator_Format();
+	FlashEmulator_ResetStats();
+	InitStorage(sectorCount);
+
+	printf("%10s %10s %15s %10s\n", "Refreshes", "Fill [%]", "Restored words", "Init [us]");
+	for (int r = 1; r <= refreshes; r++)
+	{
+		changedWords += ChangeStates(changes);
+		uint64_t start = GetTime_ns();
+		StateStorage_Refresh();
+		uint64_t time = GetTime_ns() - start;
+		refreshTime += time;
+		if (time > maxRefreshTime)
+			maxRefreshTime = time;
+		FlashEmulator_AdvanceTime(period_us);
+		if (r % (refreshes / RESTORE_POINTS > 0 ? refreshes / RESTORE_POINTS : 1) != 0)
+			continue;
+		isValid &= StateStorage_Flush(FLUSH_TIMEOUT_ms);
+		AddStats(&total);
+		memcpy(expected, clientStates, clientWords * 4);
+		start = GetTime_ns();
+		for (int i = 0; i < RESTORE_REPEATS; i++)
+			InitStorage(sectorCount);
+		double initTime = (GetTime_ns() - start) / 1000. / RESTORE_REPEATS;
+		isValid &= memcmp(expected, clientStates, clientWords * 4) == 0;
+		state_storage_stats_t stats;
+		StateStorage_GetStats(&stats);
+		printf("%10d %10u %15u %10.2f\n", r, GetActiveSectorFill(sectorCount), stats.restoredWords, initTime);
+	}
+	isValid &= StateStorage_Flush(FLUSH_TIMEOUT_ms);
+	AddStats(&total);
+
+	flash_emulator_stats_t flash;
+	FlashEmulator_GetStats(&flash);
+	printf("\nChanged words:          %llu\n", (unsigned long long)changedWords);
+	printf("Programmed words:       %llu\n", flash.programCount * 8ull);
+	printf("Write amplification:    %.2f\n", changedWords ? flash.programCount * 8. / changedWords : 0);
+	printf("Records:                %u deltas, %u checkpoints, %u rotations, %u deferred refreshes\n", total.deltaCount,
+			total.checkpointCount, total.rotationCount, total.deferredCount);
+	printf("Erases:                ");
+	for (int i = 0; i < sectorCount; i++)
+		printf(" %u", flash.eraseCounts[FLASH_SECTOR_TOTAL - sectorCount + i]);
+	printf("\nFlash busy:             %.1f %% of %.1f s\n", flash.busyTime_us * 100. / FlashEmulator_GetTime(),
+			FlashEmulator_GetTime() / 1e6);
+	printf("Refresh call [us]:      %.2f avg, %.2f max (host time, pipelined)\n", refreshTime / 1000. / refreshes,
+			maxRefreshTime / 1000.);
+	return isValid;
+}
+
+/**
+ * @brief Run the refreshes waiting for the flash after each one, as the storage did before the write pipeline.
+ * @return <c>true</c> if all refreshes were flushed.
+ */
+static bool MeasureBlockingRefreshes(int sectorCount, int changes, int refreshes)
+{
+	bool isValid = true;
+	uint64_t stallTime = 0, maxStallTime = 0;
+	FlashEmulator_Format();
+	InitStorage(sectorCount);
+	for (int r = 1; r <= refreshes; r++)
+	{
+		ChangeStates(changes);
+		uint64_t start = FlashEmulator_GetTime();
+		isValid &= StateStorage_Flush(FLUSH_TIMEOUT_ms);
+		uint64_t time = FlashEmulator_GetTime() - start;
+		stallTime += time;
+		if (time > maxStallTime)
+			maxStallTime = time;
+		FlashEmulator_AdvanceTime(period_us);
+	}
+	printf("Refresh stall [us]:     %.1f avg, %llu max (emulated flash time, blocking)\n", (double)stallTime / refreshes,
+			(unsigned long long)maxStallTime);
+	return isValid;
+}
+
+/**
+ * @brief Find the refresh whose states were restored after a power loss.
+ * @return Index of the refresh in the history, -1 if the states don't match any refresh.
+ */
+static int FindRestoredRefresh(int count)
+{
+	for (int i = count - 1; i >= 0; i--)
+	{
+		if (memcmp(history[i], clientStates, clientWords * 4) == 0)
+			return i;
+	}
+	return -1;
+}
+
+/**
+ * @brief Cut the power after a random number of flash operations and check the restored states.
+ * @details The states are flushed before the power loss is scheduled, and the states after each further refresh are
+ * kept. The restored states should match one of these refreshes, as the refreshes still queued at the power loss
+ * are lost. After further refreshes and a flush the latest states should be restored again.
+ * @return No of failed trials.
+ */
+static int RunPowerLossTrials(int sectorCount, int changes, int trials)
+{
+	int failures = 0, lost = 0, maxLost = 0;
+	uint32_t expected[STORE_WORD_SIZE];
+	for (int t = 0; t < trials; t++)
+	{
+		FlashEmulator_Format();
+		InitStorage(sectorCount);
+		int warmup = Random() % TRIAL_MAX_WARMUP;
+		while (warmup--)
+		{
+			ChangeStates(changes);
+			StateStorage_Refresh();
+			FlashEmulator_AdvanceTime(period_us);
+		}
+		bool isValid = StateStorage_Flush(FLUSH_TIMEOUT_ms);
+
+		int count = 0;
+		memcpy(history[count++], clientStates, clientWords * 4);
+		FlashEmulator_SetPowerLoss(1 + Random() % TRIAL_MAX_OPERATIONS);
+		while (!FlashEmulator_IsPoweredDown() && count < TRIAL_MAX_HISTORY)
+		{
+			ChangeStates(changes);
+			StateStorage_Refresh();
+			memcpy(history[count++], clientStates, clientWords * 4);
+			FlashEmulator_AdvanceTime(period_us);
+		}
+		FlashEmulator_PowerUp();
+		InitStorage(sectorCount);
+		int restored = FindRestoredRefresh(count);
+		isValid &= restored != -1;
+		if (restored != -1)
+		{
+			lost += count - 1 - restored;
+			if (count - 1 - restored > maxLost)
+				maxLost = count - 1 - restored;
+		}
+
+		for (int r = 0; r < TRIAL_RECOVERY_REFRESHES; r++)
+		{
+			ChangeStates(changes);
+			StateStorage_Refresh();
+			FlashEmulator_AdvanceTime(period_us);
+		}
+		isValid &= StateStorage_Flush(FLUSH_TIMEOUT_ms);
+		memcpy(expected, clientStates, clientWords * 4);
+		InitStorage(sectorCount);
+		isValid &= memcmp(expected, clientStates, clientWords * 4) == 0;
+		failures += !isValid;
+	}
+	printf("Power loss trials:      %d, %.2f avg / %d max refreshes lost, %d failed\n", trials,
+			trials ? (double)lost / trials : 0, maxLost, failures);
+	return failures;
+}
+
+/**
+ * @brief Write a packet of the legacy ping-pong format, as the storage did before the log records.
+ * @param isComplete <c>false</c> to leave out the length in the last word, as if the power was lost while writing it.
+ * @return Address after the packet.
+ */
+static uint32_t* WriteLegacyPacket(uint32_t* addr, const uint32_t* store, uint32_t index, uint32_t len, bool isComplete)
+{
+	uint32_t words = len + 2 + (8 - (len + 2) % 8);
+	addr[0] = len;
+	addr[1] = index;
+	memcpy(addr + 2, store + index, len * 4);
+	memset(addr + 2 + len, 0, (words - len - 2) * 4);
+	addr[words - 1] = isComplete ? len : 0xFFFFFFFF;
+	return addr + words;
+}
+
+/**
+ * @brief Write the states in a sector of the legacy format, with the complete store followed by partial packets.
+ * @details The states are changed randomly by each partial packet.
+ * @return Address after the last packet.
+ */
+static uint32_t* WriteLegacySector(uint32_t* addr, uint32_t* store, int packets)
+{
+	memset(store, 0, STORE_WORD_SIZE * 4);
+	store[0] = 0xA5A5A5A5;
+	store[clientWords + 1] = 0x5A5A5A5A;
+	for (uint32_t i = 1; i <= clientWords; i++)
+		store[i] = Random();
+	addr = WriteLegacyPacket(addr, store, 0, STORE_WORD_SIZE, true);
+	while (packets--)
+	{
+		uint32_t index = 1 + Random() % clientWords;
+		uint32_t len = 1 + Random() % (clientWords + 1 - index);
+		for (uint32_t i = index; i < index + len; i++)
+			store[i] = Random();
+		addr = WriteLegacyPacket(addr, store, index, len, true);
+	}
+	return addr;
+}
+
+/**
+ * @brief Check the import of the legacy ping-pong format, including a power loss while it is migrated.
+ * @details The newest legacy states are written in one of the first two sectors of the rotation. In some trials the
+ * other sector holds older states, as left by a power loss before the old sector was erased, or the newest sector
+ * ends with an interrupted packet. The imported states should match the newest states, also after a power loss
+ * during the first refreshes, and the latest states should be restored after further refreshes and a flush.
+ * @return No of failed trials.
+ */
+static int RunLegacyMigrationTrials(int sectorCount, int trials)
+{
+	int failures = 0;
+	uint32_t store[STORE_WORD_SIZE];
+	uint32_t expected[STORE_WORD_SIZE];
+	for (int t = 0; t < trials; t++)
+	{
+		FlashEmulator_Format();
+		uint32_t* sectors[2];
+		for (int i = 0; i < 2; i++)
+			sectors[i] = (uint32_t*)(FLASH_BANK1_BASE + (FLASH_SECTOR_TOTAL - sectorCount + i) * FLASH_SECTOR_SIZE);
+		int newest = Random() & 1;
+		// the newer sector of an interrupted switch only has the complete store
+		bool isSwitchInterrupted = (Random() & 3) == 0;
+		if (isSwitchInterrupted)
+			WriteLegacySector(sectors[!newest], store, 1 + Random() % LEGACY_MAX_PACKETS);
+		uint32_t* addr = WriteLegacySector(sectors[newest], store, isSwitchInterrupted ? 0 : Random() % LEGACY_MAX_PACKETS);
+		memcpy(expected, store + 1, clientWords * 4);
+		if ((Random() & 3) == 0)
+		{
+			uint32_t interrupted[STORE_WORD_SIZE];
+			memcpy(interrupted, store, sizeof(interrupted));
+			interrupted[1] = ~interrupted[1];
+			WriteLegacyPacket(addr, interrupted, 1, 1, false);
+		}
+
+		InitStorage(sectorCount);
+		bool isValid = memcmp(expected, clientStates, clientWords * 4) == 0;
+		// lose the power while the states are migrated to the first checkpoint
+		FlashEmulator_SetPowerLoss(1 + Random() % TRIAL_MAX_OPERATIONS);
+		for (int r = 0; r < LEGACY_MAX_REFRESHES && !FlashEmulator_IsPoweredDown(); r++)
+		{
+			StateStorage_Refresh();
+			FlashEmulator_AdvanceTime(period_us);
+		}
+		FlashEmulator_PowerUp();
+		InitStorage(sectorCount);
+		isValid &= memcmp(expected, clientStates, clientWords * 4) == 0;
+
+		for (int r = 0; r < TRIAL_RECOVERY_REFRESHES; r++)
+		{
+			ChangeStates(2);
+			StateStorage_Refresh();
+			FlashEmulator_AdvanceTime(period_us);
+		}
+		isValid &= StateStorage_Flush(FLUSH_TIMEOUT_ms);
+		memcpy(expected, clientStates, clientWords * 4);
+		InitStorage(sectorCount);
+		isValid &= memcmp(expected, clientStates, clientWords * 4) == 0;
+		failures += !isValid;
+	}
+	printf("Legacy import trials:   %d, %d failed\n", trials, failures);
+	return failures;
+}
+
+static void PrintUsage(const char* name)
+{
+	fprintf(stderr, "usage: %s [-s sectors] [-w words] [-c changes] [-n refreshes] [-p trials] [-t period]\n"
+			"       [-g program-time] [-e erase-time] [-f flash-file]\n"
+			"  -s  sectors in the rotation, 2-%d (default %d)\n"
+			"  -w  words stored by the client (default %d)\n"
+			"  -c  words changed before each refresh (default %d)\n"
+			"  -n  refreshes measured (default %d)\n"
+			"  -p  power loss trials (default %d)\n"
+			"  -t  refresh period in ms (default %d)\n"
+			"  -g  flash word program time in us (default %d)\n"
+			"  -e  sector erase time in ms (default %d)\n"
+			"  -f  flash file (default %s)\n", name, STATE_STORAGE_MAX_SECTORS, DEFAULT_SECTORS, DEFAULT_CLIENT_WORDS,
+			DEFAULT_CHANGES, DEFAULT_REFRESHES, DEFAULT_TRIALS, DEFAULT_PERIOD_ms, DEFAULT_PROGRAM_TIME_us,
+			DEFAULT_ERASE_TIME_ms, DEFAULT_FLASH_FILE);
+}
+
+int main(int argc, char** argv)
+{
+	int sectorCount = DEFAULT_SECTORS;
+	int changes = DEFAULT_CHANGES;
+	int refreshes = DEFAULT_REFRESHES;
+	int trials = DEFAULT_TRIALS;
+	int period = DEFAULT_PERIOD_ms;
+	int programTime = DEFAULT_PROGRAM_TIME_us;
+	int eraseTime = DEFAULT_ERASE_TIME_ms;
+	const char* flashFile = DEFAULT_FLASH_FILE;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+			sectorCount = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc)
+			clientWords = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+			changes = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+			refreshes = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+			trials = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+			period = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-g") == 0 && i + 1 < argc)
+			programTime = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc)
+			eraseTime = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+			flashFile = argv[++i];
+		else
+		{
+			PrintUsage(argv[0]);
+			return 1;
+		}
+	}
+	// The client needs a local header and footer in the store
+	if (sectorCount < 2 || sectorCount > STATE_STORAGE_MAX_SECTORS || clientWords < 1 || clientWords > STORE_WORD_SIZE - 2 ||
+			changes < 1 || refreshes < 1 || trials < 0 || period < 1 || programTime < 1 || eraseTime < 1)
+	{
+		PrintUsage(argv[0]);
+		return 1;
+	}
+	if (FlashEmulator_Open(flashFile) != 0)
+	{
+		perror(flashFile);
+		return 1;
+	}
+
+	period_us = period * 1000;
+	FlashEmulator_SetTimings(programTime, eraseTime * 1000);
+	printf("Sectors: %d, client words: %u, changed words per refresh: %d\n", sectorCount, clientWords, changes);
+	printf("Refresh period: %d ms, flash word program: %d us, sector erase: %d ms\n\n", period, programTime, eraseTime);
+	bool isValid = MeasureRefreshes(sectorCount, changes, refreshes);
+	isValid &= MeasureBlockingRefreshes(sectorCount, changes, refreshes);
+	if (!isValid)
+		fprintf(stderr, "Restored states don't match the refreshed states\n");
+	if (RunPowerLossTrials(sectorCount, changes, trials) != 0)
+		isValid = false;
+	if (RunLegacyMigrationTrials(sectorCount, trials) != 0)
+		isValid = false;
+	FlashEmulator_Close();
+	return isValid ? 0 : 1;
+}
+
+/* EOF */
@@ -0,0 +1,78 @@
+/**
+ ********************************************************************************
+ * @file 		lwipopts.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Options of LwIP for running the network services on a PC without an operating system
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef LWIPOPTS_H_
+#define LWIPOPTS_H_
+
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/* single threaded main loop */
+#define NO_SYS							1
+#define SYS_LIGHTWEIGHT_PROT			0
+#define LWIP_SOCKET						0
+#define LWIP_NETCONN					0
+
+/* memory, sized as for the CM4 */
+#define MEM_ALIGNMENT					4
+#define MEM_SIZE						(16 * 1024)
+#define MEMP_NUM_PBUF					32
+#define PBUF_POOL_SIZE					16
+#define PBUF_POOL_BUFSIZE				1536
+#define MEMP_NUM_UDP_PCB				4
+#define MEMP_NUM_SYS_TIMEOUT			(LWIP_NUM_SYS_TIMEOUT_INTERNAL + 2)
+
+/* protocols */
+#define LWIP_ARP						1
+#define LWIP_ETHERNET					1
+#define LWIP_IPV4						1
+#define LWIP_ICMP						1
+#define LWIP_UDP						1
+#ifndef LWIP_TCP
+#define LWIP_TCP						0
+#endif
+#define LWIP_DHCP						0
+/* TCP for the Modbus server, with -DLWIP_TCP=1 */
+#if LWIP_TCP
+#define MEMP_NUM_TCP_PCB				6
+#define MEMP_NUM_TCP_SEG				32
+#define TCP_MSS							1460
+#define TCP_WND							(4 * TCP_MSS)
+#define TCP_SND_BUF						(4 * TCP_MSS)
+#endif
+#define LWIP_NETIF_LINK_CALLBACK		0
+
+/* the Ethernet MAC of the STM32H7 computes the checksums of the sent frames, -DHOST_SW_CHECKSUM=1 computes them in
+ * software instead for measuring its cost */
+#ifndef HOST_SW_CHECKSUM
+#define HOST_SW_CHECKSUM				0
+#endif
+#define CHECKSUM_GEN_IP					1
+#define CHECKSUM_GEN_UDP				HOST_SW_CHECKSUM
+#define CHECKSUM_GEN_TCP				1
+#define CHECKSUM_CHECK_IP				1
+#define CHECKSUM_CHECK_UDP				1
+#define CHECKSUM_CHECK_TCP				1
+
+#define LWIP_STATS						0
+
+#endif
+/* EOF */
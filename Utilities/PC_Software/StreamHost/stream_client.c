@@ -0,0 +1,196 @@
+/**
+ ********************************************************************************
+ * @file 		stream_client.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Subscribes to the ADC stream and checks the received records
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include "adc_stream.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** Period of renewing the subscription in seconds */
+#define RENEW_PERIOD_s				(1)
+/** No of channels in each record */
+#define CHANNEL_COUNT				(16)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static int sock;
+static struct sockaddr_in device;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static double GetTime_us(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e6 + ts.tv_nsec * 1e-3;
+}
+
+static void SendRequest(uint8_t command, uint8_t type, uint16_t decimation, uint16_t recordsPerPacket)
+{
+	adc_stream_request_t request = { .magic = ADC_STREAM_MAGIC, .command = command, .type = type,
+			.decimation = decimation, .recordsPerPacket = recordsPerPacket };
+	sendto(sock, &request, sizeof(request), 0, (struct sockaddr*)&device, sizeof(device));
+}
+
+/**
+ * @brief Count the records not matching the synthetic values of stream_host, i.e. (record * 16 + channel).
+ */
+static uint32_t CheckRecords(const adc_stream_header_t* header, const uint8_t* data)
+{
+	uint32_t errors = 0;
+	for (int i = 0; i < header->recordCount; i++)
+	{
+		uint32_t value = (header->firstRecord + i * header->decimation) * CHANNEL_COUNT;
+		for (int ch = 0; ch < CHANNEL_COUNT; ch++)
+		{
+			if (header->type == ADC_STREAM_RAW)
+				errors += ((const uint16_t*)data)[i * CHANNEL_COUNT + ch] != (uint16_t)(value + ch);
+			else
+				errors += ((const float*)data)[i * CHANNEL_COUNT + ch] != (float)((value + ch) & 0xFFFFF);
+		}
+	}
+	return errors;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		printf("usage: stream_client device-ip [raw|processed] [decimation] [seconds] [records-per-packet]\n");
+		return 1;
+	}
+	uint8_t type = argc > 2 && strcmp(argv[2], "processed") == 0 ? ADC_STREAM_PROCESSED : ADC_STREAM_RAW;
+	uint16_t decimation = argc > 3 ? atoi(argv[3]) : 1;
+	int duration_s = argc > 4 ? atoi(argv[4]) : 10;
+	uint16_t recordsPerPacket = argc > 5 ? atoi(argv[5]) : 0;
+
+	sock = socket(AF_INET, SOCK_DGRAM, 0);
+	int bufSize = 4 * 1024 * 1024;
+	setsockopt(sock, SOL_SOCKET, SO_RCVBUF, &bufSize, sizeof(bufSize));
+	struct timeval tv = { .tv_sec = 0, .tv_usec = 100000 };
+	setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+	device.sin_family = AF_INET;
+	device.sin_port = htons(ADC_STREAM_PORT);
+	inet_pton(AF_INET, argv[1], &device.sin_addr);
+
+	static uint8_t buffer[2048];
+	bool isAcknowledged = false;
+	uint32_t packets = 0, records = 0, lostPackets = 0, lostRecords = 0, gaps = 0, errors = 0;
+	uint32_t nextSequence = 1, nextRecord = 0, lastLost = 0;
+	uint64_t bytes = 0;
+	double latencySum = 0, latencyMax = 0;
+	double start = GetTime_us(), lastRequest = 0, firstPacket = 0, lastPacket = 0;
+	while (GetTime_us() - start < duration_s * 1e6)
+	{
+		if (GetTime_us() - lastRequest > RENEW_PERIOD_s * 1e6)
+		{
+			SendRequest(ADC_STREAM_CMD_SUBSCRIBE, type, decimation, recordsPerPacket);
+			lastRequest = GetTime_us();
+		}
+		ssize_t len = recv(sock, buffer, sizeof(buffer), 0);
+		if (len < (ssize_t)sizeof(adc_stream_header_t))
+			continue;
+		double now = GetTime_us();
+		const adc_stream_header_t* header = (const adc_stream_header_t*)buffer;
+		if (header->magic != ADC_STREAM_MAGIC || header->version != ADC_STREAM_VERSION)
+			continue;
+		if (header->recordCount == 0)
+		{
+			if (header->maxRecords == 0)
+			{
+				printf("subscription refused\n");
+				return 1;
+			}
+			if (!isAcknowledged)
+				printf("subscribed: %.0f records/s, %u records of %u bytes in each packet, decimation %u\n",
+						header->fs, header->maxRecords, header->recordSize, header->decimation);
+			isAcknowledged = true;
+			nextSequence = 1;
+			nextRecord = header->firstRecord;
+			lastLost = 0;
+			continue;
+		}
+		if ((size_t)len != sizeof(adc_stream_header_t) + header->recordCount * header->recordSize)
+		{
+			errors++;
+			continue;
+		}
+		if (packets == 0)
+			firstPacket = now;
+		lastPacket = now;
+		packets++;
+		records += header->recordCount;
+		bytes += len;
+		// lost packets, and records skipped by the controller
+		if (header->sequence != nextSequence)
+			lostPackets += header->sequence - nextSequence;
+		lostRecords += header->lostRecords - lastLost;
+		if (header->firstRecord != nextRecord + (header->lostRecords - lastLost) * header->decimation)
+			gaps++;
+		nextSequence = header->sequence + 1;
+		nextRecord = header->firstRecord + header->recordCount * header->decimation;
+		lastLost = header->lostRecords;
+		errors += CheckRecords(header, buffer + sizeof(adc_stream_header_t));
+		double latency = (uint32_t)((uint32_t)now - header->timestamp_us);
+		latencySum += latency;
+		if (latency > latencyMax)
+			latencyMax = latency;
+	}
+	SendRequest(ADC_STREAM_CMD_UNSUBSCRIBE, type, decimation, recordsPerPacket);
+
+	double duration = (lastPacket - firstPacket) * 1e-6;
+	if (duration <= 0)
+		duration = 1;
+	printf("received: %u packets, %u records, %.0f records/s, %.3f MB/s\n", packets, records, records / duration,
+			bytes / duration * 1e-6);
+	printf("lost: %u packets, %u records skipped by the controller, %u gaps in the records, %u wrong values\n",
+			lostPackets, lostRecords, gaps, errors);
+	if (packets)
+		printf("latency on the same PC: %.0f us avg, %.0f us max\n", latencySum / packets, latencyMax);
+	return (lostPackets || gaps || errors || !isAcknowledged) ? 1 : 0;
+}
+
+/* EOF */
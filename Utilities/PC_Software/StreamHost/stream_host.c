@@ -0,0 +1,179 @@
+/**
+ ********************************************************************************
+ * @file 		stream_host.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Runs the ADC stream on a PC with synthetic ADC records and a TAP device
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+#include "adc_config.h"
+#include "adc_stream.h"
+#include "tapif_host.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** Period of the thread writing the records, as the DMA bursts of the ADC */
+#define WRITER_PERIOD_us			(250)
+/** Default sampling rate of the synthetic records */
+#define DEFAULT_FS					(40000)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static adc_raw_data_t rawData;
+static adc_processed_data_t processedData;
+static volatile bool isRunning = true;
+static uint64_t writtenRecords = 0;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static double GetTime_us(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e6 + ts.tv_nsec * 1e-3;
+}
+
+uint32_t AdcStream_GetTime_us(void)
+{
+	return (uint32_t)GetTime_us();
+}
+
+/**
+ * @brief Write a synthetic record to the rings, with the values given by the record no and channel,
+ * i.e. (record * 16 + channel) for both raw and processed records.
+ */
+static void WriteRecord(uint64_t record)
+{
+	int index = record & (RAW_MEASURE_SAVE_COUNT - 1);
+	uint32_t value = (uint32_t)record * TOTAL_MEASUREMENT_COUNT;
+	float* processed = (float*)&processedData.dataRecord[index];
+	for (int ch = 0; ch < TOTAL_MEASUREMENT_COUNT; ch++)
+	{
+		rawData.dataRecord[index * TOTAL_MEASUREMENT_COUNT + ch] = (uint16_t)(value + ch);
+		processed[ch] = (float)((value + ch) & 0xFFFFF);
+	}
+	// the records are complete before the index moves past them
+	__atomic_store_n(&rawData.recordIndex, (index + 1) & (RAW_MEASURE_SAVE_COUNT - 1), __ATOMIC_RELEASE);
+	__atomic_store_n(&processedData.recordIndex, (index + 1) & (MEASURE_SAVE_COUNT - 1), __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Write the synthetic records to the rings at the sampling rate.
+ */
+static void* WriterThread(void* arg)
+{
+	(void)arg;
+	uint64_t firstRecord = writtenRecords;
+	double start = GetTime_us();
+	while (isRunning)
+	{
+		uint64_t due = firstRecord + (uint64_t)((GetTime_us() - start) * processedData.info.fs * 1e-6);
+		for (; writtenRecords < due; writtenRecords++)
+			WriteRecord(writtenRecords);
+		usleep(WRITER_PERIOD_us);
+	}
+	return NULL;
+}
+
+int main(int argc, char** argv)
+{
+	const char* tapName = argc > 1 ? argv[1] : "tap0";
+	processedData.info.fs = argc > 2 ? atof(argv[2]) : DEFAULT_FS;
+	int duration_s = argc > 3 ? atoi(argv[3]) : 0;
+	int ringStart = argc > 4 ? atoi(argv[4]) & (RAW_MEASURE_SAVE_COUNT - 1) : 0;
+	if (!TapIf_Init(tapName))
+		return 1;
+	// the rings of the controller are already running when the stream is initialized, so the stream has to number
+	// the records from any index of the ring
+	for (; writtenRecords < (uint64_t)ringStart; writtenRecords++)
+		WriteRecord(writtenRecords);
+
+	adc_stream_config_t config = {0};
+	config.sources[ADC_STREAM_RAW].records = rawData.dataRecord;
+	config.sources[ADC_STREAM_RAW].recordIndex = &rawData.recordIndex;
+	config.sources[ADC_STREAM_RAW].recordSize = TOTAL_MEASUREMENT_COUNT * sizeof(uint16_t);
+	config.sources[ADC_STREAM_RAW].recordCount = RAW_MEASURE_SAVE_COUNT;
+	config.sources[ADC_STREAM_PROCESSED].records = processedData.dataRecord;
+	config.sources[ADC_STREAM_PROCESSED].recordIndex = &processedData.recordIndex;
+	config.sources[ADC_STREAM_PROCESSED].recordSize = sizeof(adc_measures_t);
+	config.sources[ADC_STREAM_PROCESSED].recordCount = MEASURE_SAVE_COUNT;
+	config.fs = &processedData.info.fs;
+	if (!AdcStream_Init(&config))
+	{
+		fprintf(stderr, "AdcStream_Init failed\n");
+		return 1;
+	}
+	// the records are written by the DMA on target, which is never delayed by the stack, and the stack runs in the
+	// most urgent task of its core, so both are real-time threads if allowed
+	pthread_t writer;
+	pthread_create(&writer, NULL, WriterThread, NULL);
+	struct sched_param param = { .sched_priority = 2 };
+	bool isRealTime = pthread_setschedparam(writer, SCHED_FIFO, &param) == 0;
+	param.sched_priority = 1;
+	isRealTime &= pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+	if (!isRealTime)
+		printf("real-time priorities not allowed, the records may be delayed by other processes\n");
+	printf("streaming %.0f records/s on %s at %s:%d, ring starting at %d\n", processedData.info.fs, tapName,
+			TAPIF_HOST_IP, ADC_STREAM_PORT, ringStart);
+
+	double start = GetTime_us();
+	while (duration_s == 0 || GetTime_us() - start < duration_s * 1e6)
+		TapIf_Process(ADC_STREAM_PERIOD_ms * 1000);
+	isRunning = false;
+	pthread_join(writer, NULL);
+
+	adc_stream_stats_t stats;
+	tapif_stats_t netStats;
+	AdcStream_GetStats(&stats);
+	TapIf_GetStats(&netStats);
+	uint32_t packets = stats.packets ? stats.packets : 1;
+	uint32_t frames = netStats.txFrames ? netStats.txFrames : 1;
+	printf("written: %llu records\n", (unsigned long long)writtenRecords);
+	printf("stream: %u requests, %u packets, %u records, %u lost, %u alloc errors, %u send errors\n", stats.requests,
+			stats.packets, stats.records, stats.lostRecords, stats.allocErrors, stats.sendErrors);
+	printf("network: %u frames sent, %.2f pbufs/frame, %.2f MB/s, %u frames received\n", netStats.txFrames,
+			(double)netStats.txPbufs / frames, netStats.txBytes / (GetTime_us() - start), netStats.rxFrames);
+	printf("cpu: %.2f us/packet in LwIP and the stream, %.2f us/packet writing to the TAP device\n",
+			netStats.stackTime_ns * 1e-3 / packets, netStats.txTime_ns * 1e-3 / packets);
+	return 0;
+}
+
+/* EOF */
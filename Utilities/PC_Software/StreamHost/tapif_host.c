@@ -0,0 +1,234 @@
+/**
+ ********************************************************************************
+ * @file 		tapif_host.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Runs LwIP on a PC with a Linux TAP device in place of the Ethernet MAC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <fcntl.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/select.h>
+#include <sys/uio.h>
+#include <linux/if.h>
+#include <linux/if_tun.h>
+#include "lwip/init.h"
+#include "lwip/netif.h"
+#include "lwip/pbuf.h"
+#include "lwip/etharp.h"
+#include "lwip/timeouts.h"
+#include "netif/ethernet.h"
+#include "tapif_host.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** Maximum no of pbufs in a sent frame */
+#define MAX_TX_PBUFS				(16)
+/** Size of the largest received frame */
+#define MAX_FRAME_SIZE				(1514)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static int tapFd = -1;
+static int wakeFds[2] = { -1, -1 };
+static struct netif tapNetif;
+static tapif_stats_t tapStats;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static uint64_t GetCpuTime_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+	return ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+/**
+ * @brief Time of LwIP in milli-seconds.
+ */
+u32_t sys_now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/**
+ * @brief Send a frame by gathering its pbufs, as the Ethernet DMA does with a descriptor for each pbuf.
+ */
+static err_t LinkOutput(struct netif* netif, struct pbuf* p)
+{
+	(void)netif;
+	struct iovec iov[MAX_TX_PBUFS];
+	int count = 0;
+	for (struct pbuf* q = p; q != NULL; q = q->next)
+	{
+		if (count == MAX_TX_PBUFS)
+			return ERR_BUF;
+		iov[count].iov_base = q->payload;
+		iov[count++].iov_len = q->len;
+	}
+	uint64_t start = GetCpuTime_ns();
+	ssize_t written = writev(tapFd, iov, count);
+	tapStats.txTime_ns += GetCpuTime_ns() - start;
+	if (written != p->tot_len)
+		return ERR_IF;
+	tapStats.txFrames++;
+	tapStats.txBytes += written;
+	tapStats.txPbufs += count;
+	return ERR_OK;
+}
+
+static err_t TapNetif_Init(struct netif* netif)
+{
+	static const u8_t mac[6] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 };
+	netif->name[0] = 't';
+	netif->name[1] = 'p';
+	netif->output = etharp_output;
+	netif->linkoutput = LinkOutput;
+	netif->mtu = 1500;
+	netif->hwaddr_len = ETH_HWADDR_LEN;
+	memcpy(netif->hwaddr, mac, sizeof(mac));
+	netif->flags = NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP | NETIF_FLAG_ETHERNET | NETIF_FLAG_LINK_UP;
+	return ERR_OK;
+}
+
+/**
+ * @brief Initialize LwIP and add the TAP device as the default network interface with @ref TAPIF_HOST_IP.
+ * @param name Name of an existing TAP device, configured with @ref TAPIF_HOST_GATEWAY.
+ * @return <c>true</c> if successful else <c>false</c>.
+ */
+bool TapIf_Init(const char* name)
+{
+	tapFd = open("/dev/net/tun", O_RDWR);
+	if (tapFd < 0)
+	{
+		perror("/dev/net/tun");
+		return false;
+	}
+	struct ifreq ifr = {0};
+	ifr.ifr_flags = IFF_TAP | IFF_NO_PI;
+	strncpy(ifr.ifr_name, name, IFNAMSIZ - 1);
+	if (ioctl(tapFd, TUNSETIFF, &ifr) < 0)
+	{
+		perror(name);
+		close(tapFd);
+		return false;
+	}
+
+	if (pipe(wakeFds) != 0)
+	{
+		perror("pipe");
+		close(tapFd);
+		return false;
+	}
+	fcntl(wakeFds[0], F_SETFL, O_NONBLOCK);
+	fcntl(wakeFds[1], F_SETFL, O_NONBLOCK);
+
+	lwip_init();
+	ip4_addr_t addr, mask, gw;
+	ip4addr_aton(TAPIF_HOST_IP, &addr);
+	ip4addr_aton("255.255.255.0", &mask);
+	ip4addr_aton(TAPIF_HOST_GATEWAY, &gw);
+	netif_add(&tapNetif, &addr, &mask, &gw, NULL, TapNetif_Init, ethernet_input);
+	netif_set_default(&tapNetif);
+	netif_set_up(&tapNetif);
+	return true;
+}
+
+/**
+ * @brief Receive the pending frames and run the timers of LwIP.
+ * @param timeout_us Maximum time waiting for a frame.
+ */
+void TapIf_Process(uint32_t timeout_us)
+{
+	fd_set fds;
+	FD_ZERO(&fds);
+	FD_SET(tapFd, &fds);
+	FD_SET(wakeFds[0], &fds);
+	struct timeval tv = { .tv_sec = timeout_us / 1000000, .tv_usec = timeout_us % 1000000 };
+	int ready = select((tapFd > wakeFds[0] ? tapFd : wakeFds[0]) + 1, &fds, NULL, NULL, &tv);
+
+	uint64_t start = GetCpuTime_ns();
+	uint64_t txTime = tapStats.txTime_ns;
+	if (ready > 0 && FD_ISSET(wakeFds[0], &fds))
+	{
+		uint8_t dummy[16];
+		while (read(wakeFds[0], dummy, sizeof(dummy)) > 0);
+	}
+	if (ready > 0 && FD_ISSET(tapFd, &fds))
+	{
+		static uint8_t frame[MAX_FRAME_SIZE];
+		ssize_t len = read(tapFd, frame, sizeof(frame));
+		if (len > 0)
+		{
+			struct pbuf* p = pbuf_alloc(PBUF_RAW, len, PBUF_POOL);
+			if (p != NULL)
+			{
+				pbuf_take(p, frame, len);
+				tapStats.rxFrames++;
+				if (tapNetif.input(p, &tapNetif) != ERR_OK)
+					pbuf_free(p);
+			}
+		}
+	}
+	sys_check_timeouts();
+	tapStats.stackTime_ns += GetCpuTime_ns() - start - (tapStats.txTime_ns - txTime);
+}
+
+/**
+ * @brief Make the waiting @ref TapIf_Process() return, as the semaphore of the tcpip thread on target.
+ * @note Can be called from any thread.
+ */
+void TapIf_Wake(void)
+{
+	uint8_t dummy = 0;
+	(void)write(wakeFds[1], &dummy, 1);
+}
+
+/**
+ * @brief Get the statistics of the network interface.
+ * @param stats Pointer to fill the statistics.
+ */
+void TapIf_GetStats(tapif_stats_t* stats)
+{
+	*stats = tapStats;
+}
+
+/* EOF */
@@ -0,0 +1,97 @@
+/**
+ ********************************************************************************
+ * @file 		tapif_host.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Runs LwIP on a PC with a Linux TAP device in place of the Ethernet MAC
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef TAPIF_HOST_H_
+#define TAPIF_HOST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+/* kept free of the LwIP headers, so it can be included together with the headers of the firmware */
+#include <stdint.h>
+#include <stdbool.h>
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** Address of the emulated controller on the TAP network */
+#define TAPIF_HOST_IP					"192.168.7.2"
+/** Address of the PC on the TAP network */
+#define TAPIF_HOST_GATEWAY				"192.168.7.1"
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief Statistics of the network interface
+ */
+typedef struct
+{
+	uint32_t rxFrames;					/**< @brief No of frames received */
+	uint32_t txFrames;					/**< @brief No of frames sent */
+	uint64_t txBytes;					/**< @brief No of bytes sent */
+	uint32_t txPbufs;					/**< @brief No of pbufs in the sent frames, i.e. the DMA descriptors on target */
+	uint64_t txTime_ns;					/**< @brief CPU time writing the frames to the TAP device, standing for the MAC */
+	uint64_t stackTime_ns;				/**< @brief CPU time in LwIP and the services, excluding the writes of the frames */
+} tapif_stats_t;
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+/**
+ * @brief Initialize LwIP and add the TAP device as the default network interface with @ref TAPIF_HOST_IP.
+ * @param name Name of an existing TAP device, configured with @ref TAPIF_HOST_GATEWAY.
+ * @return <c>true</c> if successful else <c>false</c>.
+ */
+extern bool TapIf_Init(const char* name);
+/**
+ * @brief Receive the pending frames and run the timers of LwIP.
+ * @param timeout_us Maximum time waiting for a frame.
+ */
+extern void TapIf_Process(uint32_t timeout_us);
+/**
+ * @brief Make the waiting @ref TapIf_Process() return, as the semaphore of the tcpip thread on target.
+ * @note Can be called from any thread.
+ */
+extern void TapIf_Wake(void);
+/**
+ * @brief Get the statistics of the network interface.
+ * @param stats Pointer to fill the statistics.
+ */
+extern void TapIf_GetStats(tapif_stats_t* stats);
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */
@@ -0,0 +1,383 @@
+/**
+ ********************************************************************************
+ * @file    	timer_sync_model.c
+ * @author 		Waqas Ehsan Butt
+ * @date    	Oct 18, 2026
+ *
+ * @brief   PC model of the timer synchronization graph
+ ********************************************************************************
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "pecontroller_timer_sync.h"
+#include "pecontroller_adc.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/**
+ * @brief Maximum length of a line in the graph file
+ */
+#define MAX_LINE_LENGTH				(256)
+/**
+ * @brief Default number of columns of the timing diagram
+ */
+#define DEFAULT_COLUMNS				(80)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief Maps a name in the graph file to a value
+ */
+typedef struct
+{
+	const char* name;
+	int value;
+} name_value_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static const name_value_t nodeNames[] =
+{
+		{ "tim1", TIM_SYNC_NODE_TIM1 },
+		{ "hrtim", TIM_SYNC_NODE_HRTIM_MASTER },
+		{ "fiberrx", TIM_SYNC_NODE_FIBER_RX },
+		{ "fibertx", TIM_SYNC_NODE_FIBER_TX },
+		{ "adc", TIM_SYNC_NODE_ADC },
+};
+static const name_value_t sourceNames[] =
+{
+		{ "none", TIM_TRG_SRC_NONE },
+		{ "tim1", TIM_TRG_SRC_TIM1 },
+		{ "tim2", TIM_TRG_SRC_TIM2 },
+		{ "fiberrx", TIM_TRG_SRC_TIM2 },
+		{ "tim3", TIM_TRG_SRC_TIM3 },
+		{ "fibertx", TIM_TRG_SRC_TIM3 },
+		{ "tim4", TIM_TRG_SRC_TIM4 },
+		{ "adc", TIM_TRG_SRC_TIM4 },
+		{ "tim5", TIM_TRG_SRC_TIM5 },
+		{ "tim8", TIM_TRG_SRC_TIM8 },
+		{ "tim15", TIM_TRG_SRC_TIM15 },
+		{ "hrtim", TIM_TRG_SRC_HRTIM_MASTER_PERIOD },
+		{ "pin", TIM_TRG_SRC_PIN },
+};
+static const name_value_t typeNames[] =
+{
+		{ "none", TIM_TRGI_TYPE_NONE },
+		{ "rst", TIM_TRGI_TYPE_RST },
+		{ "start", TIM_TRGI_TYPE_START },
+		{ "rststart", TIM_TRGI_TYPE_RESET_AND_START },
+};
+static const name_value_t edgeNames[] =
+{
+		{ "rising", TIM_SLAVE_RISING },
+		{ "falling", TIM_SLAVE_FALLING },
+};
+static const name_value_t placementNames[] =
+{
+		{ "trigger", TIM_SYNC_SAMPLE_AT_TRIGGER },
+		{ "center", TIM_SYNC_SAMPLE_DATA_AT_CENTER },
+		{ "end", TIM_SYNC_SAMPLE_DATA_AT_END },
+};
+static const char* issueNames[] =
+{
+		[TIM_SYNC_OK] = "valid",
+		[TIM_SYNC_ERR_FREQUENCY] = "frequency out of the range of the timer",
+		[TIM_SYNC_ERR_SOURCE] = "trigger source not available for the node",
+		[TIM_SYNC_ERR_SOURCE_DISABLED] = "trigger source is a disabled node",
+		[TIM_SYNC_ERR_TRIGGER_TYPE] = "trigger type not available for the node",
+		[TIM_SYNC_ERR_LOOP] = "node follows itself",
+		[TIM_SYNC_ERR_RATIO] = "frequency is not an integer multiple of the source",
+		[TIM_SYNC_ERR_DELAY] = "output delay not available or longer than the period",
+		[TIM_SYNC_ERR_PLACEMENT] = "sampling instant can't be placed",
+};
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static const char* GetName(const name_value_t* list, int count, int value)
+{
+	for (int i = 0; i < count; i++)
+	{
+		if (list[i].value == value)
+			return list[i].name;
+	}
+	return "?";
+}
+
+static bool GetValue(const name_value_t* list, int count, const char* name, int* value)
+{
+	for (int i = 0; i < count; i++)
+	{
+		if (strcmp(list[i].name, name) == 0)
+		{
+			*value = list[i].value;
+			return true;
+		}
+	}
+	return false;
+}
+
+#define GET_NAME(list, value)			GetName(list, sizeof(list) / sizeof(list[0]), value)
+#define GET_VALUE(list, name, value)	GetValue(list, sizeof(list) / sizeof(list[0]), name, value)
+
+/*************** Replacements of the drivers configured by BSP_TimerSync_Apply() ***************/
+static const char* GetOutName(tim_out_trigger_config_t* out)
+{
+	if (out == NULL)
+		return "none";
+	return out->type == TIM_TRGO_OUT_OC1 ? "oc1" : (out->type == TIM_TRGO_OUT_UPDATE ? "update" :
+			(out->type == TIM_TRGO_OUT_RST ? "reset" : "enable"));
+}
+
+void BSP_MasterHRTIM_Config(hrtim_opts_t* opts)
+{
+	printf("  BSP_MasterHRTIM_Config(f=%g, src=%s, type=%s)\n", opts->f,
+			GET_NAME(sourceNames, opts->syncSrc), GET_NAME(typeNames, opts->syncType));
+}
+
+void BSP_TIM2_ConfigFiberRx(tim_trg_in_type_t slaveType, tim_slave_edge_t slaveEdge, tim_out_trigger_config_t* outTrigger, float _fs)
+{
+	printf("  BSP_TIM2_ConfigFiberRx(type=%s, edge=%s, out=%s, f=%g)\n", GET_NAME(typeNames, slaveType),
+			GET_NAME(edgeNames, slaveEdge), GetOutName(outTrigger), _fs);
+}
+
+void BSP_TIM3_ConfigFiberTx(tim_in_trigger_config_t* inTrigger, tim_out_trigger_config_t* outTrigger, float _fs)
+{
+	printf("  BSP_TIM3_ConfigFiberTx(src=%s, type=%s, out=%s", inTrigger ? GET_NAME(sourceNames, inTrigger->src) : "none",
+			inTrigger ? GET_NAME(typeNames, inTrigger->type) : "none", GetOutName(outTrigger));
+	if (outTrigger && outTrigger->isTriggerDelayInitRequired)
+		printf(", delay=%gus", outTrigger->triggerDelayInUsec);
+	printf(", f=%g)\n", _fs);
+}
+
+void BSP_ADC_SetTriggerDelay(float delayInUsec)
+{
+	printf("  BSP_ADC_SetTriggerDelay(%.4gus) -> %u timer ticks\n", delayInUsec,
+			(unsigned)lroundf(delayInUsec * (TIM_SYNC_TIMER_CLOCK_Hz / 1000000.f)));
+}
+
+timer_trigger_src_t BSP_ADC_UpdateInputOutputTrigger(tim_in_trigger_config_t* _slaveConfig, tim_out_trigger_config_t* _masterConfig, float _fs)
+{
+	printf("  BSP_ADC_UpdateInputOutputTrigger(src=%s, type=%s, out=%s, fs=%g)\n",
+			_slaveConfig ? GET_NAME(sourceNames, _slaveConfig->src) : "none",
+			_slaveConfig ? GET_NAME(typeNames, _slaveConfig->type) : "none", GetOutName(_masterConfig), _fs);
+	return _masterConfig ? TIM_TRG_SRC_TIM4 : TIM_TRG_SRC_NONE;
+}
+/*************** Replacements of the drivers configured by BSP_TimerSync_Apply() ***************/
+
+/**
+ * @brief Parse a graph file.
+ * @details Each line starts with a node name followed by <b>key=value</b> pairs.
+ * The <b>sample</b> line selects the placement of the ADC samples.
+ */
+static bool ParseGraph(FILE* fp, tim_sync_graph_t* graph)
+{
+	char line[MAX_LINE_LENGTH];
+	int lineNo = 0;
+	while (fgets(line, sizeof(line), fp))
+	{
+		lineNo++;
+		char* comment = strchr(line, '#');
+		if (comment)
+			*comment = 0;
+		char* token = strtok(line, " \t\r\n");
+		if (token == NULL)
+			continue;
+		int node = -1;
+		bool isSample = strcmp(token, "sample") == 0;
+		if (!isSample && !GET_VALUE(nodeNames, token, &node))
+		{
+			fprintf(stderr, "line %d: unknown node '%s'\n", lineNo, token);
+			return false;
+		}
+		tim_sync_node_config_t* config = node >= 0 ? &graph->nodes[node] : NULL;
+		if (config)
+			config->isEnabled = true;
+		// Fiber Rx always follows the pin
+		if (node == TIM_SYNC_NODE_FIBER_RX)
+			config->in.src = TIM_TRG_SRC_PIN;
+		while ((token = strtok(NULL, " \t\r\n")) != NULL)
+		{
+			char* value = strchr(token, '=');
+			int val = 0;
+			bool isValid = value != NULL;
+			if (isValid)
+			{
+				*value++ = 0;
+				if (isSample && strcmp(token, "place") == 0)
+				{
+					isValid = GET_VALUE(placementNames, value, &val);
+					graph->samplePlacement = (tim_sync_placement_t)val;
+				}
+				else if (isSample && strcmp(token, "offset") == 0)
+					graph->sampleOffsetInUsec = strtof(value, NULL);
+				else if (config && strcmp(token, "f") == 0)
+					config->f = strtof(value, NULL);
+				else if (config && strcmp(token, "delay") == 0)
+					config->outDelayInUsec = strtof(value, NULL);
+				else if (config && strcmp(token, "src") == 0)
+				{
+					isValid = GET_VALUE(sourceNames, value, &val);
+					config->in.src = (timer_trigger_src_t)val;
+				}
+				else if (config && strcmp(token, "type") == 0)
+				{
+					isValid = GET_VALUE(typeNames, value, &val);
+					config->in.type = (tim_trg_in_type_t)val;
+				}
+				else if (config && strcmp(token, "edge") == 0)
+				{
+					isValid = GET_VALUE(edgeNames, value, &val);
+					config->in.edge = (tim_slave_edge_t)val;
+				}
+				else
+					isValid = false;
+			}
+			if (!isValid)
+			{
+				fprintf(stderr, "line %d: invalid setting '%s'\n", lineNo, token);
+				return false;
+			}
+		}
+		// slaves are reset by default
+		if (config && config->in.src != TIM_TRG_SRC_NONE && config->in.type == TIM_TRGI_TYPE_NONE)
+			config->in.type = TIM_TRGI_TYPE_RST;
+	}
+	return true;
+}
+
+/**
+ * @brief Print the timing table of the nodes.
+ */
+static void PrintTiming(const tim_sync_graph_t* graph, const tim_sync_report_t* report)
+{
+	printf("%-8s %-8s %-8s %10s %10s %10s %10s %-8s %s\n", "Node", "Source", "Type", "f (Hz)", "T (us)", "Start (us)", "Event (us)", "Root", "Locked");
+	for (int i = 0; i < TIM_SYNC_NODE_COUNT; i++)
+	{
+		const tim_sync_timing_t* timing = &report->timing[i];
+		if (!timing->isEnabled)
+			continue;
+		printf("%-8s %-8s %-8s %10g %10.3f %10.3f %10.3f %-8s %s\n", GET_NAME(nodeNames, i),
+				GET_NAME(sourceNames, graph->nodes[i].in.src), GET_NAME(typeNames, graph->nodes[i].in.type),
+				graph->nodes[i].f, timing->periodInUsec, timing->startInUsec, timing->eventInUsec,
+				GET_NAME(nodeNames, timing->root), timing->isLocked ? "yes" : "no");
+	}
+	if (report->timing[TIM_SYNC_NODE_ADC].isEnabled)
+		printf("\nADC: conversion starts %.3f us after the trigger, %u conversion(s) per trigger, first data ready at %.3f us\n",
+				report->adcDelayInUsec, report->adcSamplesPerTrigger, report->adcDataReadyInUsec);
+}
+
+/**
+ * @brief Print an ASCII timing diagram of the nodes.
+ * @details Period starts are shown with '|' and the trigger outputs with '^'.
+ * For the ADC 'S' marks the start of conversion, '=' the conversion and 'D' the data ready instant.
+ */
+static void PrintDiagram(const tim_sync_report_t* report, float spanInUsec, int columns)
+{
+	char row[columns + 1];
+	float usPerColumn = spanInUsec / columns;
+	printf("\nTiming diagram, %.3f us per column\n", usPerColumn);
+	for (int i = 0; i < TIM_SYNC_NODE_COUNT; i++)
+	{
+		const tim_sync_timing_t* timing = &report->timing[i];
+		if (!timing->isEnabled)
+			continue;
+		memset(row, '.', columns);
+		row[columns] = 0;
+		for (float t = timing->startInUsec; t < spanInUsec; t += timing->periodInUsec)
+		{
+			int start = (int)(t / usPerColumn);
+			int event = (int)((t + timing->eventInUsec - timing->startInUsec) / usPerColumn);
+			if (i == TIM_SYNC_NODE_ADC)
+			{
+				int ready = (int)((t + report->adcDataReadyInUsec - timing->startInUsec) / usPerColumn);
+				for (int c = event; c <= ready && c < columns; c++)
+					row[c] = c == event ? 'S' : (c == ready ? 'D' : '=');
+			}
+			else
+			{
+				if (start < columns)
+					row[start] = '|';
+				if (event != start && event < columns)
+					row[event] = '^';
+			}
+		}
+		printf("%-8s %s\n", GET_NAME(nodeNames, i), row);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		fprintf(stderr, "Usage: timer_sync_model <graph file> [span in us] [columns]\n");
+		return 2;
+	}
+	FILE* fp = strcmp(argv[1], "-") == 0 ? stdin : fopen(argv[1], "r");
+	if (fp == NULL)
+	{
+		perror(argv[1]);
+		return 2;
+	}
+	tim_sync_graph_t graph = {0};
+	bool isParsed = ParseGraph(fp, &graph);
+	if (fp != stdin)
+		fclose(fp);
+	if (!isParsed)
+		return 2;
+
+	tim_sync_report_t report;
+	if (!BSP_TimerSync_Validate(&graph, &report))
+	{
+		printf("Invalid graph: %s: %s\n", GET_NAME(nodeNames, report.node), issueNames[report.issue]);
+		return 1;
+	}
+	PrintTiming(&graph, &report);
+
+	// show two periods of the slowest node by default
+	float span = 0;
+	for (int i = 0; i < TIM_SYNC_NODE_COUNT; i++)
+	{
+		if (report.timing[i].isEnabled && report.timing[i].periodInUsec * 2 > span)
+			span = report.timing[i].periodInUsec * 2;
+	}
+	if (argc > 2)
+		span = strtof(argv[2], NULL);
+	int columns = argc > 3 ? atoi(argv[3]) : DEFAULT_COLUMNS;
+	if (span > 0 && columns > 0)
+		PrintDiagram(&report, span, columns);
+
+	printf("\nDriver calls:\n");
+	BSP_TimerSync_Apply(&graph, NULL);
+	return 0;
+}
+
+/* EOF */
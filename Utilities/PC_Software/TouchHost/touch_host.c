@@ -0,0 +1,715 @@
+/**
+ ********************************************************************************
+ * @file 		touch_host.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Tests the message processing of the touch screen drivers against an emulated mXT336T
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+#include "cmsis_os.h"
+#include "pecontroller_ts.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** Start of the mapped D3 peripherals, holding the EXTI and the RCC registers */
+#define D3_PERIPH_START				(0x58000000UL)
+/** Size of the mapped D3 peripherals */
+#define D3_PERIPH_SIZE				(0x30000UL)
+/** Duration of a bit on the I2C bus in micro-seconds, i.e. 100 kHz with the timing of the BSP */
+#define I2C_BIT_us					(10)
+/** Size of a T5 message read by the drivers, without the CRC byte */
+#define MSG_SIZE					(9)
+/** Time on the bus for each message read with others */
+#define MSG_TIME_us					(MSG_SIZE * 9 * I2C_BIT_us)
+/** Address of the T44 message count, directly followed by the T5 message processor */
+#define T44_ADDRESS					(0x0200)
+/** Address of the T5 message processor */
+#define T5_ADDRESS					(T44_ADDRESS + 1)
+/** No of report IDs of the T100 touch screen, the 2 status reports and 10 touches */
+#define T100_REPORT_IDS				(12)
+/** First report ID of the T100 touch screen, after the single report ID of the T6 command processor */
+#define T100_REPORT_ID_MIN			(2)
+/** Report ID of the T6 command processor */
+#define T6_REPORT_ID				(1)
+/** Report ID of the T15 key array, after the T100 touch screen */
+#define T15_REPORT_ID				(T100_REPORT_ID_MIN + T100_REPORT_IDS)
+/** Capacity of the message FIFO of the controller */
+#define FIFO_SIZE					(256)
+/** Maximum no of touch events of a test */
+#define MAX_EVENTS					(4096)
+/** Period of the touch task in the polling mode, as in the CM4 main.c */
+#define POLL_PERIOD_ms				(20)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief Pending DMA read of the I2C
+ */
+typedef struct
+{
+	I2C_HandleTypeDef* hi2c;
+	uint32_t duration_us;
+	bool isPending;
+} dma_read_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static pthread_mutex_t deviceLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t dmaCond = PTHREAD_COND_INITIALIZER;
+static uint8_t deviceMemory[0x10000];
+static uint8_t fifo[FIFO_SIZE][MSG_SIZE];
+static int fifoRd = 0, fifoCount = 0;
+static bool isChgIrqEnabled = false;
+static bool isChgIrqPending = false;
+static bool isChgStuck = false;
+static dma_read_t dmaRead = {0};
+static uint64_t busTime_us = 0;
+static uint32_t busReads = 0;
+static uint32_t fifoOverflows = 0;
+static volatile bool isConsumerRunning = false;
+static TS_StateTypeDef received[MAX_EVENTS];
+static double receivedTime_us[MAX_EVENTS];
+static volatile int receivedCount = 0;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+extern void EXTI2_IRQHandler(void);
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static double GetTime_us(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e6 + ts.tv_nsec * 1e-3;
+}
+
+#if !TS_IRQ_MODE
+/* the CHG line and the DMA transfers are not used by the drivers while polling */
+void EXTI2_IRQHandler(void) { }
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c) { (void)hi2c; }
+#endif
+void __disable_irq(void) { }
+void __enable_irq(void) { }
+void Error_Handler(void)
+{
+	fprintf(stderr, "Error_Handler called\n");
+	exit(1);
+}
+
+/**
+ * @brief Run the handler of the CHG line as the EXTI interrupt would, if enabled.
+ * @note Call with the device lock taken.
+ */
+static void RaiseChgIrq(void)
+{
+	if (!isChgIrqEnabled)
+	{
+		isChgIrqPending = true;
+		return;
+	}
+	isChgIrqPending = false;
+	// the pending register is write 1 to clear on the target, so it is cleared after the handler
+	EXTI_D2->PR1 = CTP_INT_Pin;
+	EXTI2_IRQHandler();
+	EXTI_D2->PR1 = 0;
+}
+
+/**
+ * @brief Fill the info block and the object table of the controller.
+ */
+static void InitDevice(void)
+{
+	memset(deviceMemory, 0, sizeof(deviceMemory));
+	// family, variant, version, build, matrix size, objects
+	const uint8_t info[] = { 0xA6, 0x18, 0x10, 0xAA, 24, 14, 0x27 };
+	memcpy(deviceMemory, info, sizeof(info));
+	// type, size, instances, report IDs of the used objects, followed by unused objects of type 0
+	const uint8_t objects[][4] = {
+			{ MXT_GEN_MESSAGE_T5, MSG_SIZE + 1, 1, 0 }, { MXT_GEN_COMMAND_T6, 6, 1, 1 },
+			{ MXT_GEN_POWER_T7, 5, 1, 0 }, { MXT_GEN_ACQUIRE_T8, 15, 1, 0 },
+			{ MXT_SPT_MESSAGECOUNT_T44, 1, 1, 0 }, { MXT_TOUCH_MULTI_T100, 60, 1, T100_REPORT_IDS },
+			{ MXT_TOUCH_KEYARRAY_T15, 11, 1, 1 }, { MXT_SPT_COMMSCONFIG_T18, 2, 1, 0 },
+			{ MXT_PROCI_RETRANSMISSIONCOMPENSATION_T80, 14, 1, 0 }, { MXT_SPT_AUXTOUCHCONFIG_T104, 11, 1, 0 },
+	};
+	uint16_t address = 0x0300;
+	for (int i = 0; i < 0x27; i++)
+	{
+		uint8_t* entry = &deviceMemory[MXT_OBJECT_START + i * MXT_OBJECT_SIZE];
+		if (i >= (int)(sizeof(objects) / sizeof(objects[0])))
+		{
+			entry[0] = 0;
+			continue;
+		}
+		uint16_t start = objects[i][0] == MXT_SPT_MESSAGECOUNT_T44 ? T44_ADDRESS :
+				objects[i][0] == MXT_GEN_MESSAGE_T5 ? T5_ADDRESS : address;
+		entry[0] = objects[i][0];
+		entry[1] = start & 0xff;
+		entry[2] = start >> 8;
+		entry[3] = objects[i][1] - 1;
+		entry[4] = objects[i][2] - 1;
+		entry[5] = objects[i][3];
+		if (start == address)
+			address += objects[i][1];
+	}
+	fifoRd = fifoCount = 0;
+}
+
+/**
+ * @brief Read the memory of the controller, where the reads of T5 pop the messages from the FIFO.
+ * @note Call with the device lock taken.
+ */
+static void ReadDevice(uint16_t reg, uint8_t* buffer, uint16_t len)
+{
+	for (int i = 0; i < len; i++, reg++)
+	{
+		if (reg == T44_ADDRESS)
+			buffer[i] = fifoCount;
+		else if (reg >= T5_ADDRESS)
+		{
+			// consecutive messages are read with a single transfer
+			int msgIndex = (reg - T5_ADDRESS) % MSG_SIZE;
+			if (fifoCount == 0)
+				buffer[i] = msgIndex == 0 ? MXT_RPTID_NOMSG : 0;
+			else
+			{
+				buffer[i] = fifo[fifoRd][msgIndex];
+				if (msgIndex == MSG_SIZE - 1)
+				{
+					fifoRd = (fifoRd + 1) % FIFO_SIZE;
+					fifoCount--;
+				}
+			}
+		}
+		else
+			buffer[i] = deviceMemory[reg];
+	}
+	busReads++;
+	busTime_us += ((4 + len) * 9 + 2) * I2C_BIT_us;
+}
+
+/**
+ * @brief Queue messages in the controller, asserting the CHG line if the FIFO was empty.
+ */
+static void PushMessages(const uint8_t (*msgs)[MSG_SIZE], int count)
+{
+	pthread_mutex_lock(&deviceLock);
+	bool wasEmpty = fifoCount == 0;
+	for (int i = 0; i < count; i++)
+	{
+		if (fifoCount < FIFO_SIZE)
+			memcpy(fifo[(fifoRd + fifoCount++) % FIFO_SIZE], msgs[i], MSG_SIZE);
+		else
+			fifoOverflows++;
+	}
+	if (wasEmpty && fifoCount > 0)
+		RaiseChgIrq();
+	pthread_mutex_unlock(&deviceLock);
+}
+
+/**
+ * @brief Fill a T100 touch message of the first touch.
+ */
+static void TouchMessage(uint8_t* msg, int touchId, uint8_t event, bool isDetected, uint16_t x, uint16_t y)
+{
+	memset(msg, 0, MSG_SIZE);
+	msg[0] = T100_REPORT_ID_MIN + 2 + touchId;
+	msg[1] = (isDetected ? MXT_T100_DETECT : 0) | event;
+	msg[2] = x & 0xff;
+	msg[3] = x >> 8;
+	msg[4] = y & 0xff;
+	msg[5] = y >> 8;
+}
+
+/********************************************************************************
+ * HAL replacements
+ *******************************************************************************/
+HAL_StatusTypeDef HAL_I2C_Init(I2C_HandleTypeDef *hi2c) { hi2c->State = HAL_I2C_STATE_READY; return HAL_OK; }
+HAL_StatusTypeDef HAL_I2C_DeInit(I2C_HandleTypeDef *hi2c) { hi2c->State = HAL_I2C_STATE_RESET; return HAL_OK; }
+HAL_StatusTypeDef HAL_I2CEx_ConfigAnalogFilter(I2C_HandleTypeDef *hi2c, uint32_t AnalogFilter) { (void)hi2c; (void)AnalogFilter; return HAL_OK; }
+HAL_StatusTypeDef HAL_I2CEx_ConfigDigitalFilter(I2C_HandleTypeDef *hi2c, uint32_t DigitalFilter) { (void)hi2c; (void)DigitalFilter; return HAL_OK; }
+void HAL_I2C_EV_IRQHandler(I2C_HandleTypeDef *hi2c) { (void)hi2c; }
+void HAL_I2C_ER_IRQHandler(I2C_HandleTypeDef *hi2c) { (void)hi2c; }
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma) { (void)hdma; return HAL_OK; }
+void HAL_DMA_IRQHandler(DMA_HandleTypeDef *hdma) { (void)hdma; }
+HAL_StatusTypeDef HAL_RCCEx_PeriphCLKConfig(RCC_PeriphCLKInitTypeDef *PeriphClkInit) { (void)PeriphClkInit; return HAL_OK; }
+void HAL_GPIO_Init(GPIO_TypeDef *GPIOx, GPIO_InitTypeDef *GPIO_Init) { (void)GPIOx; (void)GPIO_Init; }
+void HAL_NVIC_SetPriority(IRQn_Type IRQn, uint32_t PreemptPriority, uint32_t SubPriority) { (void)IRQn; (void)PreemptPriority; (void)SubPriority; }
+void HAL_Delay(uint32_t Delay) { (void)Delay; }
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState)
+{
+	(void)GPIOx;
+	// the reset of the controller releases the CHG line
+	if (GPIO_Pin == CTP_RST_Pin && PinState == GPIO_PIN_RESET)
+	{
+		pthread_mutex_lock(&deviceLock);
+		isChgStuck = false;
+		pthread_mutex_unlock(&deviceLock);
+	}
+}
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn)
+{
+	if (IRQn != EXTI2_IRQn)
+		return;
+	pthread_mutex_lock(&deviceLock);
+	isChgIrqEnabled = true;
+	if (isChgIrqPending)
+		RaiseChgIrq();
+	pthread_mutex_unlock(&deviceLock);
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef *GPIOx, uint16_t GPIO_Pin)
+{
+	(void)GPIOx;
+	(void)GPIO_Pin;
+	// the CHG line is low while messages are pending
+	pthread_mutex_lock(&deviceLock);
+	GPIO_PinState state = fifoCount > 0 || isChgStuck ? GPIO_PIN_RESET : GPIO_PIN_SET;
+	pthread_mutex_unlock(&deviceLock);
+	return state;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+		uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	(void)hi2c;
+	(void)DevAddress;
+	(void)MemAddSize;
+	(void)Timeout;
+	uint16_t reg = (MemAddress >> 8) | (MemAddress << 8);
+	pthread_mutex_lock(&deviceLock);
+	memcpy(&deviceMemory[reg], pData, Size);
+	pthread_mutex_unlock(&deviceLock);
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+		uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout)
+{
+	(void)hi2c;
+	(void)DevAddress;
+	(void)MemAddSize;
+	(void)Timeout;
+	uint16_t reg = (MemAddress >> 8) | (MemAddress << 8);
+	pthread_mutex_lock(&deviceLock);
+	uint64_t start_us = busTime_us;
+	ReadDevice(reg, pData, Size);
+	uint32_t duration_us = busTime_us - start_us;
+	pthread_mutex_unlock(&deviceLock);
+	// the blocking read keeps the CPU busy for the duration of the transfer
+	double end = GetTime_us() + duration_us;
+	while (GetTime_us() < end);
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+		uint16_t MemAddSize, uint8_t *pData, uint16_t Size)
+{
+	(void)DevAddress;
+	(void)MemAddSize;
+	uint16_t reg = (MemAddress >> 8) | (MemAddress << 8);
+	pthread_mutex_lock(&deviceLock);
+	if (dmaRead.isPending)
+	{
+		pthread_mutex_unlock(&deviceLock);
+		return HAL_BUSY;
+	}
+	uint64_t start_us = busTime_us;
+	ReadDevice(reg, pData, Size);
+	dmaRead.hi2c = hi2c;
+	dmaRead.duration_us = busTime_us - start_us;
+	dmaRead.isPending = true;
+	pthread_cond_signal(&dmaCond);
+	pthread_mutex_unlock(&deviceLock);
+	return HAL_OK;
+}
+
+/**
+ * @brief Completes the DMA reads after their duration on the bus.
+ */
+static void* DMAThread(void* arg)
+{
+	(void)arg;
+	pthread_mutex_lock(&deviceLock);
+	for (;;)
+	{
+		while (!dmaRead.isPending)
+			pthread_cond_wait(&dmaCond, &deviceLock);
+		uint32_t duration_us = dmaRead.duration_us;
+		pthread_mutex_unlock(&deviceLock);
+		usleep(duration_us);
+		pthread_mutex_lock(&deviceLock);
+		dmaRead.isPending = false;
+		I2C_HandleTypeDef* hi2c = dmaRead.hi2c;
+		pthread_mutex_unlock(&deviceLock);
+		HAL_I2C_MemRxCpltCallback(hi2c);
+		pthread_mutex_lock(&deviceLock);
+	}
+	return NULL;
+}
+
+/********************************************************************************
+ * Tasks
+ *******************************************************************************/
+/**
+ * @brief Same loop as the touch task of the CM4 core.
+ */
+static void* TouchTask(void* arg)
+{
+	(void)arg;
+	while (BSP_TS_Init(800, 480) != TS_OK)
+		osDelay(100);
+	for (;;)
+	{
+#if TS_IRQ_MODE
+		BSP_TS_WaitAndProcess();
+#else
+		BSP_TS_Poll();
+		osDelay(POLL_PERIOD_ms);
+#endif
+	}
+	return NULL;
+}
+
+/**
+ * @brief Reads the touch events as the input device of LVGL, but continuously.
+ */
+static void* ConsumerThread(void* arg)
+{
+	(void)arg;
+	for (;;)
+	{
+		TS_StateTypeDef event;
+		if (isConsumerRunning && BSP_TS_GetEvent(&event))
+		{
+			int i = receivedCount;
+			if (i < MAX_EVENTS)
+			{
+				received[i] = event;
+				receivedTime_us[i] = GetTime_us();
+				receivedCount = i + 1;
+			}
+		}
+		else
+			usleep(50);
+	}
+	return NULL;
+}
+
+/********************************************************************************
+ * Tests
+ *******************************************************************************/
+static int failures = 0;
+
+static void Check(bool condition, const char* test, const char* what)
+{
+	if (!condition)
+	{
+		printf("FAIL %s: %s\n", test, what);
+		failures++;
+	}
+}
+
+static bool WaitForEvents(int count, uint32_t timeout_ms)
+{
+	double end = GetTime_us() + timeout_ms * 1000.0;
+	while (receivedCount < count && GetTime_us() < end)
+		usleep(100);
+	// wait for any unexpected extra events
+	usleep(2 * POLL_PERIOD_ms * 1000);
+	return receivedCount == count;
+}
+
+static void ResetReceived(void)
+{
+	receivedCount = 0;
+}
+
+static bool IsEvent(int i, bool isPressed, uint16_t x, uint16_t y)
+{
+	return received[i].touchDetected == isPressed && received[i].touchX == x && received[i].touchY == y;
+}
+
+/**
+ * @brief A tap, and a tap shorter than an acquisition reported as a single message.
+ */
+static void TestTaps(void)
+{
+	uint8_t msgs[3][MSG_SIZE];
+	ResetReceived();
+	TouchMessage(msgs[0], 0, MXT_T100_EVENT_DOWN, true, 100, 200);
+	TouchMessage(msgs[1], 0, MXT_T100_EVENT_UP, false, 0, 0);
+	TouchMessage(msgs[2], 0, MXT_T100_EVENT_DOWNUP, false, 640, 400);
+	PushMessages(msgs, 3);
+	Check(WaitForEvents(4, 500), "taps", "4 events expected");
+	Check(IsEvent(0, true, 100, 200) && IsEvent(1, false, 100, 200), "taps", "press and release at the position");
+	Check(IsEvent(2, true, 640, 400) && IsEvent(3, false, 640, 400), "taps", "short tap as press and release");
+}
+
+/**
+ * @brief A drag with other messages in between: status of the T6 command processor, T100 screen status, other
+ * touches and moves without a preceding touch.
+ */
+static void TestMixedMessages(void)
+{
+	uint8_t msgs[12][MSG_SIZE] = {0};
+	int n = 0;
+	ResetReceived();
+	TouchMessage(msgs[n++], 0, MXT_T100_EVENT_MOVE, true, 1, 1);			// move without a touch is ignored
+	msgs[n][0] = T6_REPORT_ID; msgs[n++][1] = 0x10;							// T6 status
+	TouchMessage(msgs[n++], 0, MXT_T100_EVENT_DOWN, true, 300, 100);
+	msgs[n][0] = T100_REPORT_ID_MIN; msgs[n][1] = 0x80; msgs[n++][2] = 1;	// T100 screen status
+	TouchMessage(msgs[n++], 1, MXT_T100_EVENT_DOWN, true, 10, 10);			// second touch is not tracked
+	TouchMessage(msgs[n++], 0, MXT_T100_EVENT_MOVE, true, 310, 120);
+	msgs[n][0] = T15_REPORT_ID; msgs[n++][1] = 0x01;						// key array
+	TouchMessage(msgs[n++], 0, MXT_T100_EVENT_MOVE, true, 320, 140);
+	TouchMessage(msgs[n++], 1, MXT_T100_EVENT_UP, false, 10, 10);
+	TouchMessage(msgs[n++], 0, MXT_T100_EVENT_UP, false, 320, 140);
+	PushMessages((const uint8_t (*)[MSG_SIZE])msgs, n);
+	Check(WaitForEvents(4, 500), "mixed", "4 events expected");
+	Check(IsEvent(0, true, 300, 100) && IsEvent(1, true, 310, 120) && IsEvent(2, true, 320, 140)
+			&& IsEvent(3, false, 320, 140), "mixed", "drag of the first touch only");
+}
+
+/**
+ * @brief Bursts of random gestures pushed at random times, more than a read of the drivers or the queue can take.
+ */
+static void TestBursts(int rounds)
+{
+	static uint8_t msgs[MAX_EVENTS][MSG_SIZE];
+	static TS_StateTypeDef expected[MAX_EVENTS];
+	int n = 0, e = 0;
+	srand(1);
+	ResetReceived();
+	for (int r = 0; r < rounds && n < MAX_EVENTS - 40; r++)
+	{
+		uint16_t x = rand() % 800, y = rand() % 480;
+		if (rand() % 4 == 0)
+		{
+			TouchMessage(msgs[n++], 0, MXT_T100_EVENT_DOWNUP, false, x, y);
+			expected[e++] = (TS_StateTypeDef){ true, x, y };
+			expected[e++] = (TS_StateTypeDef){ false, x, y };
+			continue;
+		}
+		TouchMessage(msgs[n++], 0, MXT_T100_EVENT_DOWN, true, x, y);
+		expected[e++] = (TS_StateTypeDef){ true, x, y };
+		int moves = rand() % 30;
+		for (int m = 0; m < moves; m++)
+		{
+			x = (x + rand() % 21 - 10) & 511;
+			y = (y + rand() % 21 - 10) & 255;
+			if (rand() % 5 == 0)
+			{
+				msgs[n][0] = T6_REPORT_ID;
+				msgs[n++][1] = rand();
+			}
+			TouchMessage(msgs[n++], 0, MXT_T100_EVENT_MOVE, true, x, y);
+			expected[e++] = (TS_StateTypeDef){ true, x, y };
+		}
+		TouchMessage(msgs[n++], 0, MXT_T100_EVENT_UP, false, 0, 0);
+		expected[e++] = (TS_StateTypeDef){ false, x, y };
+	}
+	// push in random chunks while the previous ones are read, at about a third of the rate the bus can take
+	for (int i = 0; i < n; )
+	{
+		int chunk = 1 + rand() % 40;
+		if (chunk > n - i)
+			chunk = n - i;
+		PushMessages((const uint8_t (*)[MSG_SIZE])&msgs[i], chunk);
+		i += chunk;
+		usleep(rand() % (chunk * 8 * MSG_TIME_us));
+	}
+	bool isComplete = WaitForEvents(e, TS_IRQ_MODE ? 10000 : 1000);
+	int mismatches = 0;
+	for (int i = 0; i < e && i < receivedCount; i++)
+		mismatches += !IsEvent(i, expected[i].touchDetected, expected[i].touchX, expected[i].touchY);
+	// polling drops the events of the messages exceeding the queue in a period, so it is only measured
+	if (TS_IRQ_MODE)
+	{
+		Check(isComplete, "bursts", "all events expected");
+		Check(mismatches == 0, "bursts", "events in the order of the messages");
+	}
+	printf("bursts: %d messages, %d events expected, %d received, %d mismatches\n", n, e, receivedCount, mismatches);
+}
+
+#if TS_IRQ_MODE
+/**
+ * @brief Messages stay in the controller while the queue is not read, and none of their events is lost.
+ */
+static void TestFullQueue(void)
+{
+	uint8_t msgs[40][MSG_SIZE];
+	TS_StatsTypeDef before, after;
+	isConsumerRunning = false;
+	ResetReceived();
+	BSP_TS_GetStats(&before);
+	TouchMessage(msgs[0], 0, MXT_T100_EVENT_DOWN, true, 0, 0);
+	for (int i = 1; i < 39; i++)
+		TouchMessage(msgs[i], 0, MXT_T100_EVENT_MOVE, true, i, i);
+	TouchMessage(msgs[39], 0, MXT_T100_EVENT_UP, false, 0, 0);
+	PushMessages(msgs, 40);
+	usleep(200000);
+	BSP_TS_GetStats(&after);
+	Check(BSP_TS_IsEventPending() && after.events - before.events <= TS_EVENT_QUEUE_SIZE, "full queue", "queue filled");
+	Check(HAL_GPIO_ReadPin(CTP_INT_GPIO_Port, CTP_INT_Pin) == GPIO_PIN_RESET, "full queue", "messages pending in the controller");
+	isConsumerRunning = true;
+	Check(WaitForEvents(40, 1000), "full queue", "40 events expected");
+	BSP_TS_GetStats(&after);
+	Check(after.droppedEvents == before.droppedEvents, "full queue", "no events dropped");
+	int mismatches = 0;
+	for (int i = 0; i < 39; i++)
+		mismatches += !IsEvent(i, true, i, i);
+	Check(mismatches == 0 && IsEvent(39, false, 38, 38), "full queue", "events in the order of the messages");
+}
+
+/**
+ * @brief The controller holds the CHG line without messages, till it is reset by the drivers. The touch task should
+ * neither read back to back meanwhile nor lose the events after the reset.
+ */
+static void TestStuckChg(void)
+{
+	uint8_t msgs[2][MSG_SIZE];
+	TS_StatsTypeDef before, after;
+	BSP_TS_GetStats(&before);
+	pthread_mutex_lock(&deviceLock);
+	uint32_t reads = busReads;
+	isChgStuck = true;
+	RaiseChgIrq();
+	pthread_mutex_unlock(&deviceLock);
+	usleep(500000);
+	pthread_mutex_lock(&deviceLock);
+	reads = busReads - reads;
+	bool isReleased = !isChgStuck;
+	pthread_mutex_unlock(&deviceLock);
+	BSP_TS_GetStats(&after);
+	Check(isReleased && after.recoveries > before.recoveries, "stuck CHG", "controller reset");
+	// the reads while waiting for the line, and the reads of the initialization after the reset
+	Check(reads < 100, "stuck CHG", "no back to back reads");
+	ResetReceived();
+	TouchMessage(msgs[0], 0, MXT_T100_EVENT_DOWN, true, 50, 60);
+	TouchMessage(msgs[1], 0, MXT_T100_EVENT_UP, false, 0, 0);
+	PushMessages(msgs, 2);
+	Check(WaitForEvents(2, 500) && IsEvent(0, true, 50, 60) && IsEvent(1, false, 50, 60), "stuck CHG",
+			"events after the reset");
+	printf("stuck CHG: %u reads in 500 ms, %u resets\n", reads, after.recoveries - before.recoveries);
+}
+#endif
+
+/**
+ * @brief Time from the first message of a tap to its event in the queue.
+ */
+static void MeasureLatency(int count)
+{
+	double sum = 0, max = 0;
+	uint8_t msgs[2][MSG_SIZE];
+	for (int i = 0; i < count; i++)
+	{
+		ResetReceived();
+		TouchMessage(msgs[0], 0, MXT_T100_EVENT_DOWN, true, i, i);
+		TouchMessage(msgs[1], 0, MXT_T100_EVENT_UP, false, 0, 0);
+		// random phase to the polling period
+		usleep(rand() % (POLL_PERIOD_ms * 1000));
+		double start = GetTime_us();
+		PushMessages(msgs, 2);
+		while (receivedCount < 1)
+			usleep(20);
+		double latency = receivedTime_us[0] - start;
+		sum += latency;
+		if (latency > max)
+			max = latency;
+		while (receivedCount < 2)
+			usleep(20);
+	}
+	printf("latency: %.0f us avg, %.0f us max over %d taps\n", sum / count, max, count);
+}
+
+/**
+ * @brief Reads of the controller and the time on the bus while nothing is touched.
+ */
+static void MeasureIdle(uint32_t duration_ms)
+{
+	pthread_mutex_lock(&deviceLock);
+	uint32_t reads = busReads;
+	uint64_t time_us = busTime_us;
+	pthread_mutex_unlock(&deviceLock);
+	usleep(duration_ms * 1000);
+	pthread_mutex_lock(&deviceLock);
+	reads = busReads - reads;
+	time_us = busTime_us - time_us;
+	pthread_mutex_unlock(&deviceLock);
+	printf("idle: %.1f reads/s, %.2f %% of the time on the bus\n", reads * 1000.0 / duration_ms,
+			time_us * 100.0 / (duration_ms * 1000.0));
+}
+
+int main(int argc, char** argv)
+{
+	void* map = mmap((void*)D3_PERIPH_START, D3_PERIPH_SIZE, PROT_READ | PROT_WRITE,
+			MAP_FIXED_NOREPLACE | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (map != (void*)D3_PERIPH_START)
+	{
+		perror("mmap");
+		return 1;
+	}
+	InitDevice();
+	pthread_t thread;
+	pthread_create(&thread, NULL, DMAThread, NULL);
+	pthread_create(&thread, NULL, TouchTask, NULL);
+	isConsumerRunning = true;
+	pthread_create(&thread, NULL, ConsumerThread, NULL);
+	// initialization of the drivers
+	usleep(100000);
+	printf("mode: %s\n", TS_IRQ_MODE ? "CHG interrupt with DMA reads" : "polling every 20 ms");
+
+	TestTaps();
+	TestMixedMessages();
+	TestBursts(argc > 1 ? atoi(argv[1]) : 100);
+#if TS_IRQ_MODE
+	TestFullQueue();
+	TestStuckChg();
+#endif
+	MeasureLatency(100);
+	MeasureIdle(2000);
+
+	TS_StatsTypeDef stats;
+	BSP_TS_GetStats(&stats);
+	printf("stats: %u interrupts, %u reads, %u messages, %u events, %u dropped, %u errors, %u resets\n",
+			stats.interrupts, stats.reads, stats.messages, stats.events, stats.droppedEvents, stats.errors,
+			stats.recoveries);
+	Check(fifoOverflows == 0, "controller", "no overflow of the message FIFO");
+	printf("%s: %d failures\n", failures ? "FAILED" : "PASSED", failures);
+	return failures ? 1 : 0;
+}
+
+/* EOF */
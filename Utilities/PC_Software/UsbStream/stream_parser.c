@@ -0,0 +1,132 @@
+/**
+ ********************************************************************************
+ * @file 		stream_parser.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Splits the data of the USB ADC stream into transfers and checks their continuity
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <string.h>
+#include "stream_parser.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+#define HEADER_SIZE			(sizeof(usbd_adc_stream_header_t))
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+/**
+ * @brief Initialize the parser for a new stream.
+ * @param parser Parser to be initialized.
+ * @param callback Callback for the records. NULL if not needed.
+ * @param arg Argument of the callback.
+ */
+void StreamParser_Init(stream_parser_t* parser, stream_records_callback_t callback, void* arg)
+{
+	memset(parser, 0, sizeof(*parser));
+	parser->callback = callback;
+	parser->arg = arg;
+}
+
+/**
+ * @brief Check a complete transfer against the previous one and pass on its records.
+ */
+static void ProcessTransfer(stream_parser_t* parser, const usbd_adc_stream_header_t* header, const uint8_t* records)
+{
+	if (parser->isStarted)
+	{
+		if (header->sequence != parser->nextSequence)
+			parser->errors++;
+		// the records missing between the transfers should be the ones reported as lost
+		else if (header->firstRecord - parser->nextRecord != header->lostRecords - parser->lostRecords)
+			parser->errors++;
+	}
+	parser->isStarted = true;
+	parser->nextSequence = header->sequence + 1;
+	parser->nextRecord = header->firstRecord + header->recordCount;
+	parser->lostRecords = header->lostRecords;
+	parser->transfers++;
+	parser->records += header->recordCount;
+	if (parser->callback)
+		parser->callback(parser->arg, header, records);
+}
+
+/**
+ * @brief Parse the data read from the endpoint.
+ * @param parser Parser of the stream.
+ * @param data Data read from the endpoint.
+ * @param len Length of the data.
+ */
+void StreamParser_Feed(stream_parser_t* parser, const uint8_t* data, uint32_t len)
+{
+	while (len > 0)
+	{
+		uint32_t count = sizeof(parser->data) - parser->len;
+		if (count > len)
+			count = len;
+		memcpy(parser->data + parser->len, data, count);
+		parser->len += count;
+		data += count;
+		len -= count;
+
+		uint32_t offset = 0;
+		while (parser->len - offset >= HEADER_SIZE)
+		{
+			usbd_adc_stream_header_t header;
+			memcpy(&header, parser->data + offset, HEADER_SIZE);
+			uint32_t size = HEADER_SIZE + (uint32_t)header.recordCount * header.recordSize;
+			if (header.magic != USBD_ADC_STREAM_MAGIC || header.version != USBD_ADC_STREAM_VERSION
+					|| size > USBD_ADC_STREAM_BUFFER_SIZE || header.recordCount > header.maxRecords)
+			{
+				// the rest can't be split reliably, so it is dropped and the next read starts a transfer
+				parser->errors++;
+				offset = parser->len;
+				break;
+			}
+			if (parser->len - offset < size)
+				break;
+			ProcessTransfer(parser, &header, parser->data + offset + HEADER_SIZE);
+			offset += size;
+		}
+		memmove(parser->data, parser->data + offset, parser->len - offset);
+		parser->len -= offset;
+	}
+}
+
+/* EOF */
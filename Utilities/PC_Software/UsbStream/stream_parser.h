@@ -0,0 +1,127 @@
+/**
+ ********************************************************************************
+ * @file 		stream_parser.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Splits the data of the USB ADC stream into transfers and checks their continuity
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef STREAM_PARSER_H_
+#define STREAM_PARSER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @defgroup Stream_Parser Stream Parser
+ * @brief Parses the bulk data of @ref USBD_ADC_Stream on the host.
+ * @details The data read from the endpoint is split at the headers, so the reads don't have to match the transfers.
+ * Each transfer is checked for the next sequence no, and for a gap in the records matching the increase of the lost
+ * records reported by the device. The records of the valid transfers are passed to the callback.
+ * @{
+ */
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "usbd_adc_stream.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+/** @defgroup StreamParser_Exported_Typedefs Type Definitions
+ * @{
+ */
+/**
+ * @brief Called for the records of each valid transfer.
+ * @param arg Argument given to @ref StreamParser_Init().
+ * @param header Header of the transfer.
+ * @param records Records of the transfer.
+ */
+typedef void (*stream_records_callback_t)(void* arg, const usbd_adc_stream_header_t* header, const uint8_t* records);
+/**
+ * @}
+ */
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/** @defgroup StreamParser_Exported_Structures Structures
+ * @{
+ */
+/**
+ * @brief State of the parser
+ */
+typedef struct
+{
+	uint8_t data[2 * USBD_ADC_STREAM_BUFFER_SIZE];	/**< @brief Data of the incomplete transfer */
+	uint32_t len;						/**< @brief Length of the incomplete transfer */
+	bool isStarted;						/**< @brief The first transfer is received */
+	uint32_t nextSequence;				/**< @brief Expected sequence no of the next transfer */
+	uint32_t nextRecord;				/**< @brief Expected first record of the next transfer if none are lost */
+	uint32_t lostRecords;				/**< @brief Lost records reported by the last transfer */
+	uint64_t transfers;					/**< @brief No of valid transfers */
+	uint64_t records;					/**< @brief No of received records */
+	uint32_t errors;					/**< @brief No of invalid headers, sequence errors and record gaps */
+	stream_records_callback_t callback;	/**< @brief Callback for the records */
+	void* arg;							/**< @brief Argument of the callback */
+} stream_parser_t;
+/**
+ * @}
+ */
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+/** @defgroup StreamParser_Exported_Functions Functions
+ * @{
+ */
+/**
+ * @brief Initialize the parser for a new stream.
+ * @param parser Parser to be initialized.
+ * @param callback Callback for the records. NULL if not needed.
+ * @param arg Argument of the callback.
+ */
+extern void StreamParser_Init(stream_parser_t* parser, stream_records_callback_t callback, void* arg);
+/**
+ * @brief Parse the data read from the endpoint.
+ * @param parser Parser of the stream.
+ * @param data Data read from the endpoint.
+ * @param len Length of the data.
+ */
+extern void StreamParser_Feed(stream_parser_t* parser, const uint8_t* data, uint32_t len);
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+
+/**
+ * @}
+ */
+/**
+ * @}
+ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */
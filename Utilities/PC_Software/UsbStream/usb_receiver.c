@@ -0,0 +1,361 @@
+/**
+ ********************************************************************************
+ * @file 		usb_receiver.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Receives the USB ADC stream on Linux and writes it to a capture file
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <time.h>
+#include <unistd.h>
+#include <linux/usbdevice_fs.h>
+#include "usbd_adc_stream.h"
+#include "stream_parser.h"
+#include "capture_file.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** Default no of reads queued on the endpoint */
+#define DEFAULT_QUEUED_READS			(8)
+#define MAX_QUEUED_READS				(64)
+#define CONTROL_TIMEOUT_ms				(1000)
+#define SYSFS_USB_DEVICES				"/sys/bus/usb/devices"
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief State of the capture file being written
+ */
+typedef struct
+{
+	const char* path;
+	capture_writer_t writer;
+	bool isOpen;
+	uint32_t nextRecord;
+	uint16_t lastRecord[CAPTURE_MAX_CHANNELS];
+	uint64_t filledRecords;
+	int error;
+} capture_output_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static volatile sig_atomic_t isStopRequested = 0;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static double GetTime_s(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void Stop_Requested(int signal)
+{
+	(void)signal;
+	isStopRequested = 1;
+}
+
+static int ReadSysfsInt(const char* dir, const char* name, int base)
+{
+	char path[512];
+	char text[32] = {0};
+	snprintf(path, sizeof(path), "%s/%s/%s", SYSFS_USB_DEVICES, dir, name);
+	FILE* fp = fopen(path, "r");
+	if (fp == NULL)
+		return -1;
+	bool isRead = fgets(text, sizeof(text), fp) != NULL;
+	fclose(fp);
+	return isRead ? (int)strtol(text, NULL, base) : -1;
+}
+
+/**
+ * @brief Find the first interface of the stream in sysfs.
+ * @param device Updated with the path of the usbfs device.
+ * @param interface Updated with the interface no.
+ * @return 0 if found else -1.
+ */
+static int FindDevice(char* device, size_t len, int* interface)
+{
+	DIR* dir = opendir(SYSFS_USB_DEVICES);
+	if (dir == NULL)
+		return -1;
+	struct dirent* entry;
+	int result = -1;
+	while (result != 0 && (entry = readdir(dir)) != NULL)
+	{
+		// the interfaces are named bus-port:config.interface
+		char* colon = strchr(entry->d_name, ':');
+		if (colon == NULL || ReadSysfsInt(entry->d_name, "bInterfaceClass", 16) != 0xFF
+				|| ReadSysfsInt(entry->d_name, "bInterfaceSubClass", 16) != USBD_ADC_STREAM_SUBCLASS
+				|| ReadSysfsInt(entry->d_name, "bInterfaceProtocol", 16) != USBD_ADC_STREAM_PROTOCOL)
+			continue;
+		char parent[256];
+		snprintf(parent, sizeof(parent), "%.*s", (int)(colon - entry->d_name), entry->d_name);
+		int bus = ReadSysfsInt(parent, "busnum", 10);
+		int dev = ReadSysfsInt(parent, "devnum", 10);
+		*interface = ReadSysfsInt(entry->d_name, "bInterfaceNumber", 16);
+		if (bus > 0 && dev > 0 && *interface >= 0)
+		{
+			snprintf(device, len, "/dev/bus/usb/%03d/%03d", bus, dev);
+			result = 0;
+		}
+	}
+	closedir(dir);
+	return result;
+}
+
+/**
+ * @brief Send a vendor request to the interface of the stream.
+ * @return No of bytes of the data stage if successful else -1 with errno set.
+ */
+static int VendorRequest(int fd, int interface, bool isRead, uint8_t request, uint16_t value, void* data, uint16_t len)
+{
+	struct usbdevfs_ctrltransfer control = {0};
+	control.bRequestType = (isRead ? 0x80 : 0x00) | USB_REQ_TYPE_VENDOR | USB_REQ_RECIPIENT_INTERFACE;
+	control.bRequest = request;
+	control.wValue = value;
+	control.wIndex = interface;
+	control.wLength = len;
+	control.timeout = CONTROL_TIMEOUT_ms;
+	control.data = data;
+	return ioctl(fd, USBDEVFS_CONTROL, &control);
+}
+
+/**
+ * @brief Write the records of a transfer to the capture file, holding the last record over the lost records so the
+ * time base of the capture is kept.
+ */
+static void Records_Received(void* arg, const usbd_adc_stream_header_t* header, const uint8_t* records)
+{
+	capture_output_t* output = (capture_output_t*)arg;
+	uint32_t chCount = header->recordSize / sizeof(uint16_t);
+	if (output->path == NULL || output->error || header->recordCount == 0 || chCount > CAPTURE_MAX_CHANNELS)
+		return;
+	if (!output->isOpen)
+	{
+		capture_file_header_t fileHeader;
+		CaptureFormat_InitHeader(&fileHeader, chCount, header->fs);
+		for (uint32_t ch = 0; ch < chCount; ch++)
+			snprintf(fileHeader.channels[ch].name, CAPTURE_NAME_LEN, "Ch%u", ch + 1);
+		if (CaptureWriter_Create(&output->writer, output->path, &fileHeader) != 0)
+		{
+			perror(output->path);
+			output->error = 1;
+			return;
+		}
+		output->isOpen = true;
+		output->nextRecord = header->firstRecord;
+	}
+	for (; output->nextRecord != header->firstRecord; output->nextRecord++, output->filledRecords++)
+		output->error |= CaptureWriter_Append(&output->writer, output->lastRecord, 1);
+	output->error |= CaptureWriter_Append(&output->writer, (const uint16_t*)records, header->recordCount);
+	memcpy(output->lastRecord, records + (header->recordCount - 1) * header->recordSize, header->recordSize);
+	output->nextRecord += header->recordCount;
+}
+
+static void PrintUsage(const char* name)
+{
+	printf("usage: %s [-d device] [-i interface] [-s seconds] [-r records-per-transfer] [-q reads] [-o capture-file]\n",
+			name);
+}
+
+int main(int argc, char** argv)
+{
+	char device[64] = {0};
+	int interface = -1;
+	double duration_s = 0;
+	int recordsPerTransfer = 0;
+	int queuedReads = DEFAULT_QUEUED_READS;
+	capture_output_t output = {0};
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+			snprintf(device, sizeof(device), "%s", argv[++i]);
+		else if (strcmp(argv[i], "-i") == 0 && i + 1 < argc)
+			interface = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+			duration_s = atof(argv[++i]);
+		else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+			recordsPerTransfer = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-q") == 0 && i + 1 < argc)
+			queuedReads = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+			output.path = argv[++i];
+		else
+		{
+			PrintUsage(argv[0]);
+			return 1;
+		}
+	}
+	if (queuedReads < 1 || queuedReads > MAX_QUEUED_READS)
+	{
+		fprintf(stderr, "reads should be between 1 and %d\n", MAX_QUEUED_READS);
+		return 1;
+	}
+	if (device[0] == 0 && FindDevice(device, sizeof(device), &interface) != 0)
+	{
+		fprintf(stderr, "no device with the ADC stream interface found\n");
+		return 1;
+	}
+	if (interface < 0)
+		interface = 0;
+
+	int fd = open(device, O_RDWR);
+	if (fd < 0)
+	{
+		perror(device);
+		return 1;
+	}
+	unsigned int claimed = interface;
+	if (ioctl(fd, USBDEVFS_CLAIMINTERFACE, &claimed) != 0)
+	{
+		perror("claim interface");
+		close(fd);
+		return 1;
+	}
+
+	static struct usbdevfs_urb urbs[MAX_QUEUED_READS];
+	static uint8_t buffers[MAX_QUEUED_READS][USBD_ADC_STREAM_BUFFER_SIZE];
+	static stream_parser_t parser;
+	StreamParser_Init(&parser, Records_Received, &output);
+	int result = 0;
+	int pending = 0;
+	if (VendorRequest(fd, interface, false, USBD_ADC_STREAM_REQ_START, recordsPerTransfer, NULL, 0) < 0)
+	{
+		perror("start request");
+		result = 1;
+		goto exit;
+	}
+	// the reads are queued so the host controller always has a buffer for the next transfer
+	for (int i = 0; i < queuedReads; i++)
+	{
+		urbs[i].type = USBDEVFS_URB_TYPE_BULK;
+		urbs[i].endpoint = USBD_ADC_STREAM_IN_EP;
+		urbs[i].buffer = buffers[i];
+		urbs[i].buffer_length = USBD_ADC_STREAM_BUFFER_SIZE;
+		if (ioctl(fd, USBDEVFS_SUBMITURB, &urbs[i]) != 0)
+		{
+			perror("submit read");
+			result = 1;
+			break;
+		}
+		pending++;
+	}
+	signal(SIGINT, Stop_Requested);
+	signal(SIGTERM, Stop_Requested);
+	printf("receiving from %s interface %d\n", device, interface);
+
+	double start = GetTime_s();
+	double lastPrint = start;
+	uint64_t bytes = 0;
+	bool isStopping = result != 0;
+	while (pending > 0)
+	{
+		if (!isStopping && (isStopRequested || (duration_s > 0 && GetTime_s() - start >= duration_s)))
+		{
+			isStopping = true;
+			VendorRequest(fd, interface, false, USBD_ADC_STREAM_REQ_STOP, 0, NULL, 0);
+			for (int i = 0; i < queuedReads; i++)
+				ioctl(fd, USBDEVFS_DISCARDURB, &urbs[i]);
+		}
+		// completed reads make the device writable
+		struct pollfd pfd = { fd, POLLOUT, 0 };
+		if (poll(&pfd, 1, 100) < 0 && errno != EINTR)
+			break;
+		struct usbdevfs_urb* urb;
+		while (ioctl(fd, USBDEVFS_REAPURBNDELAY, &urb) == 0)
+		{
+			pending--;
+			if (urb->status == 0 || (isStopping && urb->actual_length > 0))
+			{
+				StreamParser_Feed(&parser, urb->buffer, urb->actual_length);
+				bytes += urb->actual_length;
+			}
+			else if (!isStopping)
+			{
+				fprintf(stderr, "read failed: %s\n", strerror(-urb->status));
+				isStopRequested = 1;
+			}
+			if (!isStopping && ioctl(fd, USBDEVFS_SUBMITURB, urb) == 0)
+				pending++;
+		}
+		if (errno == ENODEV)
+		{
+			fprintf(stderr, "device disconnected\n");
+			result = 1;
+			break;
+		}
+		double now = GetTime_s();
+		if (now - lastPrint >= 1)
+		{
+			printf("%.0f s: %llu records, %u lost, %.2f MB/s\n", now - start, (unsigned long long)parser.records,
+					parser.lostRecords, bytes / (now - lastPrint) * 1e-6);
+			lastPrint = now;
+			bytes = 0;
+		}
+	}
+
+	usbd_adc_stream_stats_t stats;
+	if (VendorRequest(fd, interface, true, USBD_ADC_STREAM_REQ_GET_STATS, 0, &stats, sizeof(stats)) == sizeof(stats))
+		printf("device: %u transfers, %u records, %u lost, %u zero length packets, %u waits\n", stats.transfers,
+				stats.records, stats.lostRecords, stats.zeroLengthPackets, stats.waits);
+	printf("received: %llu transfers, %llu records, %u lost, %u errors\n", (unsigned long long)parser.transfers,
+			(unsigned long long)parser.records, parser.lostRecords, parser.errors);
+	if (parser.errors)
+		result = 1;
+exit:
+	if (output.isOpen)
+	{
+		if (CaptureWriter_Close(&output.writer) != 0 || output.error)
+		{
+			perror(output.path);
+			result = 1;
+		}
+		else
+			printf("%s: %llu records filled for the lost records\n", output.path,
+					(unsigned long long)output.filledRecords);
+	}
+	ioctl(fd, USBDEVFS_RELEASEINTERFACE, &claimed);
+	close(fd);
+	return result;
+}
+
+/* EOF */
@@ -0,0 +1,556 @@
+/**
+ ********************************************************************************
+ * @file 		usb_stream_test.c
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Checks the USB ADC stream through the USB device library with a mocked low level driver
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "usbd_core.h"
+#include "usbd_adc_stream.h"
+#include "stream_parser.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+/** Records in the ring, as RAW_MEASURE_SAVE_COUNT */
+#define RING_RECORDS				(256)
+/** Channels in each record, as TOTAL_MEASUREMENT_COUNT */
+#define CHANNEL_COUNT				(16)
+#define RECORD_SIZE					(CHANNEL_COUNT * sizeof(uint16_t))
+#define NEVER						(UINT64_MAX)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+/**
+ * @brief Ring of the ADC records, with the layout of adc_raw_data_t
+ */
+typedef struct
+{
+	volatile int recordIndex;
+	uint16_t dataRecord[RING_RECORDS * CHANNEL_COUNT];
+} ring_t;
+/**
+ * @brief Conditions of a test
+ */
+typedef struct
+{
+	const char* name;
+	USBD_SpeedTypeDef speed;
+	float fs;
+	double duration_s;
+	uint16_t recordsPerTransfer;
+	double bandwidth_Bps;				/**< Bulk throughput of the bus left to the endpoint */
+	double packetTime_us;				/**< Time of a short or zero length packet */
+	double hostPauseStart_s;			/**< Start of a time in which the host reads nothing */
+	double hostPauseEnd_s;
+	double irqBlockStart_s;				/**< Start of a time in which the USB interrupt is not served */
+	double irqBlockEnd_s;
+	bool isLossExpected;
+	bool isZlpExpected;
+} test_case_t;
+/**
+ * @brief Transfer in progress on the bulk IN endpoint
+ */
+typedef struct
+{
+	bool isBusy;
+	const uint8_t* data;
+	uint32_t len;
+	uint8_t copy[USBD_ADC_STREAM_BUFFER_SIZE];
+	uint64_t done_ns;
+} in_transfer_t;
+/**
+ * @brief Read of the host from the bulk IN endpoint, completed by a short packet or when full
+ */
+typedef struct
+{
+	uint8_t data[USBD_ADC_STREAM_BUFFER_SIZE];
+	uint32_t len;
+	uint32_t transfers;
+} host_urb_t;
+/**
+ * @brief Results of the checks of the received records
+ */
+typedef struct
+{
+	bool isOffsetKnown;
+	int64_t offset;
+	uint64_t valueErrors;
+	double latencySum_us;
+	double latencyMax_us;
+	uint64_t latencyCount;
+} record_check_t;
+/********************************************************************************
+ * Static Variables
+ *******************************************************************************/
+static ring_t ring;
+static float samplingRate;
+static uint64_t now_ns;
+static uint64_t writtenRecords;
+/** Time and no of records at the last change of the sampling rate */
+static uint64_t writerBase_ns;
+static uint64_t writerBaseRecords;
+static uint64_t testStart_ns;
+
+static USBD_HandleTypeDef device;
+static const test_case_t* activeTest;
+static in_transfer_t inTransfer;
+static host_urb_t urb;
+static uint16_t openedMaxPacket;
+static uint8_t ep0Data[256];
+static uint32_t ep0Len;
+static bool isEp0Stalled;
+static uint32_t handoffErrors;
+static uint32_t mergedUrbs;
+static uint32_t emptyUrbs;
+
+static stream_parser_t parser;
+static record_check_t recordCheck;
+static int failures = 0;
+/********************************************************************************
+ * Global Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+static void Check(bool condition, const char* test, const char* what)
+{
+	if (!condition)
+	{
+		printf("FAIL %s: %s\n", test, what);
+		failures++;
+	}
+}
+
+uint32_t HAL_GetTick(void)
+{
+	return (uint32_t)(now_ns / 1000000);
+}
+
+uint32_t UsbdAdcStream_GetTime_us(void)
+{
+	return (uint32_t)(now_ns / 1000);
+}
+
+/**
+ * @brief Write the records of the ADC up to the current time. Channels 0 and 1 hold the record no, the others
+ * (record * 16 + channel).
+ */
+static void AdvanceWriter(void)
+{
+	uint64_t target = writerBaseRecords + (uint64_t)((now_ns - writerBase_ns) * 1e-9 * samplingRate);
+	uint64_t first = target > writtenRecords + RING_RECORDS ? target - RING_RECORDS : writtenRecords;
+	for (uint64_t n = first; n < target; n++)
+	{
+		uint16_t* record = &ring.dataRecord[(n & (RING_RECORDS - 1)) * CHANNEL_COUNT];
+		record[0] = (uint16_t)n;
+		record[1] = (uint16_t)(n >> 16);
+		for (int ch = 2; ch < CHANNEL_COUNT; ch++)
+			record[ch] = (uint16_t)(n * 16 + ch);
+	}
+	writtenRecords = target;
+	ring.recordIndex = (int)(target & (RING_RECORDS - 1));
+}
+
+/********************************************************************************
+ * Mocked low level driver
+ *******************************************************************************/
+USBD_StatusTypeDef USBD_LL_Init(USBD_HandleTypeDef* pdev) { (void)pdev; return USBD_OK; }
+USBD_StatusTypeDef USBD_LL_DeInit(USBD_HandleTypeDef* pdev) { (void)pdev; return USBD_OK; }
+USBD_StatusTypeDef USBD_LL_Start(USBD_HandleTypeDef* pdev) { (void)pdev; return USBD_OK; }
+USBD_StatusTypeDef USBD_LL_Stop(USBD_HandleTypeDef* pdev) { (void)pdev; return USBD_OK; }
+USBD_StatusTypeDef USBD_LL_FlushEP(USBD_HandleTypeDef* pdev, uint8_t ep_addr) { (void)pdev; (void)ep_addr; return USBD_OK; }
+USBD_StatusTypeDef USBD_LL_SetUSBAddress(USBD_HandleTypeDef* pdev, uint8_t dev_addr) { (void)pdev; (void)dev_addr; return USBD_OK; }
+uint8_t USBD_LL_IsStallEP(USBD_HandleTypeDef* pdev, uint8_t ep_addr) { (void)pdev; (void)ep_addr; return 0; }
+uint32_t USBD_LL_GetRxDataSize(USBD_HandleTypeDef* pdev, uint8_t ep_addr) { (void)pdev; (void)ep_addr; return 0; }
+void USBD_LL_Delay(uint32_t Delay) { (void)Delay; }
+
+USBD_StatusTypeDef USBD_LL_OpenEP(USBD_HandleTypeDef* pdev, uint8_t ep_addr, uint8_t ep_type, uint16_t ep_mps)
+{
+	(void)pdev;
+	if (ep_addr == USBD_ADC_STREAM_IN_EP && ep_type == USBD_EP_TYPE_BULK)
+		openedMaxPacket = ep_mps;
+	return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_CloseEP(USBD_HandleTypeDef* pdev, uint8_t ep_addr)
+{
+	(void)pdev;
+	if (ep_addr == USBD_ADC_STREAM_IN_EP)
+	{
+		inTransfer.isBusy = false;
+		openedMaxPacket = 0;
+	}
+	return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_StallEP(USBD_HandleTypeDef* pdev, uint8_t ep_addr)
+{
+	(void)pdev;
+	if ((ep_addr & 0x7F) == 0)
+		isEp0Stalled = true;
+	return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_ClearStallEP(USBD_HandleTypeDef* pdev, uint8_t ep_addr)
+{
+	(void)pdev;
+	(void)ep_addr;
+	return USBD_OK;
+}
+
+USBD_StatusTypeDef USBD_LL_PrepareReceive(USBD_HandleTypeDef* pdev, uint8_t ep_addr, uint8_t* pbuf, uint32_t size)
+{
+	(void)pdev;
+	(void)ep_addr;
+	(void)pbuf;
+	(void)size;
+	return USBD_OK;
+}
+
+static uint64_t Defer(uint64_t time_ns, double start_s, double end_s)
+{
+	if (time_ns >= start_s * 1e9 && time_ns < end_s * 1e9)
+		return (uint64_t)(end_s * 1e9);
+	return time_ns;
+}
+
+/**
+ * @brief Start a transfer. The data of the bulk IN endpoint is copied to detect the changes while it is sent, and
+ * its completion is timed with the bandwidth of the test.
+ */
+USBD_StatusTypeDef USBD_LL_Transmit(USBD_HandleTypeDef* pdev, uint8_t ep_addr, uint8_t* pbuf, uint32_t size)
+{
+	(void)pdev;
+	if ((ep_addr & 0x7F) == 0)
+	{
+		if (size > sizeof(ep0Data))
+			size = sizeof(ep0Data);
+		memcpy(ep0Data, pbuf, size);
+		ep0Len = size;
+		return USBD_OK;
+	}
+	if (inTransfer.isBusy || ep_addr != USBD_ADC_STREAM_IN_EP || size > USBD_ADC_STREAM_BUFFER_SIZE)
+	{
+		handoffErrors++;
+		return USBD_FAIL;
+	}
+	inTransfer.isBusy = true;
+	inTransfer.data = pbuf;
+	inTransfer.len = size;
+	memcpy(inTransfer.copy, pbuf, size);
+	// a paused host doesn't take any packet
+	uint64_t start = Defer(now_ns - testStart_ns, activeTest->hostPauseStart_s, activeTest->hostPauseEnd_s) + testStart_ns;
+	double time_us = size / activeTest->bandwidth_Bps * 1e6;
+	if (size % openedMaxPacket != 0 || size == 0)
+		time_us += activeTest->packetTime_us;
+	inTransfer.done_ns = start + (uint64_t)(time_us * 1000);
+	return USBD_OK;
+}
+
+/********************************************************************************
+ * Host side
+ *******************************************************************************/
+/**
+ * @brief Check the records of a transfer against the values of the writer, and their latency.
+ */
+static void Records_Received(void* arg, const usbd_adc_stream_header_t* header, const uint8_t* records)
+{
+	record_check_t* check = (record_check_t*)arg;
+	for (int i = 0; i < header->recordCount; i++)
+	{
+		uint16_t record[CHANNEL_COUNT];
+		memcpy(record, records + i * header->recordSize, RECORD_SIZE);
+		uint64_t n = record[0] | ((uint64_t)record[1] << 16);
+		if (!check->isOffsetKnown)
+		{
+			check->isOffsetKnown = true;
+			check->offset = (int64_t)n - header->firstRecord;
+		}
+		bool isValid = (int64_t)n == (int64_t)(header->firstRecord + i) + check->offset;
+		for (int ch = 2; ch < CHANNEL_COUNT; ch++)
+			isValid &= record[ch] == (uint16_t)(n * 16 + ch);
+		if (!isValid)
+			check->valueErrors++;
+	}
+	if (header->recordCount)
+	{
+		double written_us = writerBase_ns * 1e-3 +
+				((double)(header->firstRecord + check->offset) + 1 - writerBaseRecords) / samplingRate * 1e6;
+		double latency_us = now_ns * 1e-3 - written_us;
+		check->latencySum_us += latency_us;
+		check->latencyCount++;
+		if (latency_us > check->latencyMax_us)
+			check->latencyMax_us = latency_us;
+	}
+}
+
+/**
+ * @brief Pass the completed read to the parser.
+ */
+static void CompleteUrb(void)
+{
+	if (urb.len == 0)
+		emptyUrbs++;
+	if (urb.transfers > 1)
+		mergedUrbs++;
+	StreamParser_Feed(&parser, urb.data, urb.len);
+	urb.len = 0;
+	urb.transfers = 0;
+}
+
+/**
+ * @brief Complete the transfer of the bulk IN endpoint, as seen by the read of the host, and notify the core.
+ */
+static void CompleteTransfer(void)
+{
+	inTransfer.isBusy = false;
+	if (memcmp(inTransfer.copy, inTransfer.data, inTransfer.len) != 0)
+		handoffErrors++;
+	if (inTransfer.len)
+	{
+		memcpy(urb.data + urb.len, inTransfer.copy, inTransfer.len);
+		urb.len += inTransfer.len;
+		urb.transfers++;
+	}
+	// a short packet or a full buffer ends the read
+	if (inTransfer.len % openedMaxPacket != 0 || inTransfer.len == 0 || urb.len == USBD_ADC_STREAM_BUFFER_SIZE)
+		CompleteUrb();
+	USBD_LL_DataInStage(&device, USBD_ADC_STREAM_IN_EP & 0x7F, (uint8_t*)inTransfer.data);
+}
+
+/**
+ * @brief Run a control request through the core.
+ * @return <c>true</c> if accepted else <c>false</c> if the endpoint 0 stalled.
+ */
+static bool ControlRequest(uint8_t bmRequest, uint8_t bRequest, uint16_t wValue, uint16_t wIndex, uint16_t wLength)
+{
+	uint8_t setup[8] = { bmRequest, bRequest, wValue & 0xFF, wValue >> 8, wIndex & 0xFF, wIndex >> 8, wLength & 0xFF,
+			wLength >> 8 };
+	isEp0Stalled = false;
+	ep0Len = 0;
+	USBD_LL_SetupStage(&device, setup);
+	if (isEp0Stalled)
+		return false;
+	// data stage of a read and the status stages
+	USBD_LL_DataInStage(&device, 0, NULL);
+	if ((bmRequest & 0x80) != 0 && wLength)
+		USBD_LL_DataOutStage(&device, 0, NULL);
+	return true;
+}
+
+/**
+ * @brief Reset the device and enumerate it at the speed of the test.
+ */
+static void Enumerate(const test_case_t* test)
+{
+	USBD_LL_SetSpeed(&device, test->speed);
+	USBD_LL_Reset(&device);
+	ControlRequest(0x00, USB_REQ_SET_ADDRESS, 5, 0, 0);
+	ControlRequest(0x00, USB_REQ_SET_CONFIGURATION, 1, 0, 0);
+}
+
+/**
+ * @brief Check the descriptors, the endpoint and the control requests of the stream.
+ */
+static void CheckControl(void)
+{
+	const char* name = "control";
+	test_case_t test = { .speed = USBD_SPEED_HIGH };
+	activeTest = &test;
+	Enumerate(&test);
+	Check(device.dev_state == USBD_STATE_CONFIGURED, name, "device configured");
+	Check(openedMaxPacket == USBD_ADC_STREAM_HS_MAX_PACKET, name, "bulk IN endpoint of 512 bytes at high speed");
+	Check(ControlRequest(0x80, USB_REQ_GET_DESCRIPTOR, USB_DESC_TYPE_CONFIGURATION << 8, 0, 255), name,
+			"configuration descriptor");
+	Check(ep0Len == USBD_ADC_STREAM_CONFIG_DESC_SIZE && ep0Data[9 + 5] == 0xFF && ep0Data[9 + 6] == USBD_ADC_STREAM_SUBCLASS
+			&& ep0Data[18 + 2] == USBD_ADC_STREAM_IN_EP && ep0Data[18 + 3] == USBD_EP_TYPE_BULK
+			&& (ep0Data[18 + 4] | (ep0Data[18 + 5] << 8)) == USBD_ADC_STREAM_HS_MAX_PACKET, name,
+			"vendor specific interface with the bulk IN endpoint");
+	Check(ControlRequest(0x80, USB_REQ_GET_DESCRIPTOR, USB_DESC_TYPE_OTHER_SPEED_CONFIGURATION << 8, 0, 255), name,
+			"other speed configuration descriptor");
+	Check((ep0Data[18 + 4] | (ep0Data[18 + 5] << 8)) == USBD_ADC_STREAM_FS_MAX_PACKET, name,
+			"64 bytes at the other speed");
+	Check(!ControlRequest(0x41, USBD_ADC_STREAM_REQ_START, 1000, 0, 0), name, "too many records per transfer stall");
+	Check(!ControlRequest(0x41, 0x55, 0, 0, 0), name, "unknown request stalls");
+	Check(ControlRequest(0xC1, USBD_ADC_STREAM_REQ_GET_STATS, 0, 0, sizeof(usbd_adc_stream_stats_t)) &&
+			ep0Len == sizeof(usbd_adc_stream_stats_t), name, "statistics read");
+
+	// no transfer starts before the start request
+	for (int i = 0; i < 100; i++)
+	{
+		now_ns += 125000;
+		AdvanceWriter();
+		USBD_LL_SOF(&device);
+	}
+	Check(!inTransfer.isBusy, name, "nothing sent before the start");
+
+	USBD_LL_SetSpeed(&device, USBD_SPEED_FULL);
+	USBD_LL_Reset(&device);
+	Check(openedMaxPacket == 0, name, "endpoint closed by the reset");
+	ControlRequest(0x00, USB_REQ_SET_ADDRESS, 5, 0, 0);
+	ControlRequest(0x00, USB_REQ_SET_CONFIGURATION, 1, 0, 0);
+	Check(openedMaxPacket == USBD_ADC_STREAM_FS_MAX_PACKET, name, "bulk IN endpoint of 64 bytes at full speed");
+	printf("%s: %s\n", name, failures ? "failed" : "passed");
+}
+
+/**
+ * @brief Stream for the time of a test, with the USB interrupts at the start of the frames and at the end of each
+ * transfer, and check the received transfers and records.
+ */
+static void RunTest(const test_case_t* test)
+{
+	activeTest = test;
+	writerBase_ns = now_ns;
+	writerBaseRecords = writtenRecords;
+	samplingRate = test->fs;
+	Enumerate(test);
+	StreamParser_Init(&parser, Records_Received, &recordCheck);
+	memset(&recordCheck, 0, sizeof(recordCheck));
+	memset(&urb, 0, sizeof(urb));
+	handoffErrors = mergedUrbs = emptyUrbs = 0;
+	usbd_adc_stream_stats_t before;
+	UsbdAdcStream_GetStats(&before);
+
+	Check(ControlRequest(0x41, USBD_ADC_STREAM_REQ_START, test->recordsPerTransfer, 0, 0), test->name, "stream started");
+	uint64_t sofPeriod_ns = test->speed == USBD_SPEED_HIGH ? 125000 : 1000000;
+	uint64_t nextSof_ns = (now_ns / sofPeriod_ns + 1) * sofPeriod_ns;
+	uint64_t end_ns = now_ns + (uint64_t)(test->duration_s * 1e9);
+	testStart_ns = now_ns;
+	double cpu_ns = 0;
+	uint64_t interrupts = 0;
+	while (now_ns < end_ns)
+	{
+		uint64_t sof = Defer(nextSof_ns - testStart_ns, test->irqBlockStart_s, test->irqBlockEnd_s) + testStart_ns;
+		uint64_t done = inTransfer.isBusy ?
+				Defer(inTransfer.done_ns - testStart_ns, test->irqBlockStart_s, test->irqBlockEnd_s) + testStart_ns : NEVER;
+		now_ns = done <= sof ? done : sof;
+		AdvanceWriter();
+		struct timespec t0, t1;
+		clock_gettime(CLOCK_MONOTONIC, &t0);
+		if (done <= sof)
+			CompleteTransfer();
+		else
+		{
+			USBD_LL_SOF(&device);
+			// the frames missed while the interrupt was blocked are a single interrupt
+			nextSof_ns = (now_ns / sofPeriod_ns + 1) * sofPeriod_ns;
+		}
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		cpu_ns += (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+		interrupts++;
+	}
+
+	// stop and complete the transfer in progress
+	Check(ControlRequest(0x41, USBD_ADC_STREAM_REQ_STOP, 0, 0, 0), test->name, "stream stopped");
+	while (inTransfer.isBusy)
+	{
+		now_ns = inTransfer.done_ns > now_ns ? inTransfer.done_ns : now_ns;
+		CompleteTransfer();
+	}
+	for (int i = 0; i < 20; i++)
+	{
+		now_ns += sofPeriod_ns;
+		AdvanceWriter();
+		USBD_LL_SOF(&device);
+	}
+	Check(!inTransfer.isBusy, test->name, "nothing sent after the stop");
+	if (urb.len)
+		CompleteUrb();
+
+	Check(ControlRequest(0xC1, USBD_ADC_STREAM_REQ_GET_STATS, 0, 0, sizeof(usbd_adc_stream_stats_t)), test->name,
+			"statistics read");
+	usbd_adc_stream_stats_t stats;
+	memcpy(&stats, ep0Data, sizeof(stats));
+	uint32_t transfers = stats.transfers - before.transfers;
+	uint32_t records = stats.records - before.records;
+	uint32_t lost = stats.lostRecords - before.lostRecords;
+	uint32_t zlps = stats.zeroLengthPackets - before.zeroLengthPackets;
+	uint64_t expected = (uint64_t)(test->duration_s * test->fs);
+
+	Check(handoffErrors == 0, test->name, "a single transfer at a time and no change of a buffer being sent");
+	Check(parser.errors == 0, test->name, "sequence and record gaps matching the lost records");
+	Check(recordCheck.valueErrors == 0 && recordCheck.isOffsetKnown, test->name, "records with the written values");
+	Check(parser.transfers == transfers && parser.records == records, test->name, "all sent transfers received");
+	Check(mergedUrbs == 0, test->name, "each read ends with its transfer");
+	Check(parser.lostRecords <= lost, test->name, "lost records reported");
+	Check(records + lost <= expected + RING_RECORDS && records + lost + 2 * RING_RECORDS >= expected, test->name,
+			"received and lost records cover the written records");
+	Check(test->isLossExpected ? lost > 0 : lost == 0, test->name, test->isLossExpected ? "records lost" : "no records lost");
+	Check(test->isZlpExpected ? zlps > 0 : zlps == 0, test->name, test->isZlpExpected ? "zero length packets" :
+			"no zero length packets");
+	printf("%s: %u transfers, %u records (%.1f per transfer), %u lost (%.2f %%), %u zlp, %u waits, "
+			"latency %.0f us avg %.0f us max, %.0f ns cpu per record\n", test->name, transfers, records,
+			transfers ? (double)records / transfers : 0, lost, 100.0 * lost / (records + lost ? records + lost : 1), zlps,
+			stats.waits - before.waits, recordCheck.latencySum_us / (recordCheck.latencyCount ? recordCheck.latencyCount : 1),
+			recordCheck.latencyMax_us, cpu_ns / (records ? records : 1));
+	(void)interrupts;
+}
+
+int main(void)
+{
+	usbd_adc_stream_config_t config = {0};
+	config.records = ring.dataRecord;
+	config.recordIndex = &ring.recordIndex;
+	config.recordSize = RECORD_SIZE;
+	config.recordCount = RING_RECORDS;
+	config.fs = &samplingRate;
+	samplingRate = 100000;
+	if (!UsbdAdcStream_Init(&config))
+	{
+		printf("FAIL init\n");
+		return 1;
+	}
+	USBD_Init(&device, NULL, 0);
+	USBD_RegisterClass(&device, &USBD_AdcStream);
+	USBD_Start(&device);
+	CheckControl();
+
+	// high speed bulk of about 40 MB/s left to the endpoint, full speed of about 1.1 MB/s
+	const test_case_t tests[] =
+	{
+		{ "hs 100k", USBD_SPEED_HIGH, 100000, 2, 0, 40e6, 10, 0, 0, 0, 0, false, false },
+		{ "hs 100k 8 records", USBD_SPEED_HIGH, 100000, 2, 8, 40e6, 10, 0, 0, 0, 0, false, false },
+		{ "hs 200k", USBD_SPEED_HIGH, 200000, 2, 0, 40e6, 10, 0, 0, 0, 0, false, false },
+		{ "hs host pause", USBD_SPEED_HIGH, 100000, 1, 0, 40e6, 10, 0.5, 0.51, 0, 0, true, false },
+		{ "hs irq blocked", USBD_SPEED_HIGH, 100000, 1, 0, 40e6, 10, 0, 0, 0.5, 0.507, true, false },
+		{ "fs 100k", USBD_SPEED_FULL, 100000, 2, 0, 1.1e6, 60, 0, 0, 0, 0, true, false },
+		{ "fs 20k", USBD_SPEED_FULL, 20000, 2, 0, 1.1e6, 60, 0, 0, 0, 0, false, false },
+		{ "fs 1k 1 record", USBD_SPEED_FULL, 1000, 2, 1, 1.1e6, 60, 0, 0, 0, 0, false, true },
+	};
+	for (unsigned i = 0; i < sizeof(tests) / sizeof(tests[0]); i++)
+		RunTest(&tests[i]);
+	printf("%s: %d failures\n", failures ? "FAILED" : "PASSED", failures);
+	return failures ? 1 : 0;
+}
+
+/* EOF */
@@ -0,0 +1,79 @@
+/**
+ ********************************************************************************
+ * @file 		usbd_conf.h
+ * @author 		Waqas Ehsan Butt
+ * @date 		Oct 18, 2026
+ *
+ * @brief    Configuration of the USB device library for the host test of the ADC stream
+ ********************************************************************************
+ * @attention
+ *
+ * <h2><center>&copy; Copyright (c) 2021 Taraz Technologies Pvt. Ltd.</center></h2>
+ * <h3><center>All rights reserved.</center></h3>
+ *
+ * <center>This software component is licensed by Taraz Technologies under BSD 3-Clause license,
+ * the "License"; You may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *                        www.opensource.org/licenses/BSD-3-Clause</center>
+ *
+ ********************************************************************************
+ */
+
+#ifndef USBD_CONF_H_
+#define USBD_CONF_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/********************************************************************************
+ * Includes
+ *******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stm32h7xx_hal.h"
+/********************************************************************************
+ * Defines
+ *******************************************************************************/
+#define USBD_MAX_NUM_INTERFACES				1U
+#define USBD_MAX_NUM_CONFIGURATION			1U
+#define USBD_MAX_STR_DESC_SIZ				0x100U
+#define USBD_SELF_POWERED					1U
+#define USBD_DEBUG_LEVEL					0U
+/* the class data is static */
+#define USBD_malloc(size)					NULL
+#define USBD_free(ptr)
+#define USBD_memset							memset
+#define USBD_memcpy							memcpy
+#define USBD_Delay(ms)
+#define USBD_UsrLog(...)					do {} while (0)
+#define USBD_ErrLog(...)					do {} while (0)
+#define USBD_DbgLog(...)					do {} while (0)
+/********************************************************************************
+ * Typedefs
+ *******************************************************************************/
+
+/********************************************************************************
+ * Structures
+ *******************************************************************************/
+
+/********************************************************************************
+ * Exported Variables
+ *******************************************************************************/
+
+/********************************************************************************
+ * Global Function Prototypes
+ *******************************************************************************/
+
+/********************************************************************************
+ * Code
+ *******************************************************************************/
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* EOF */